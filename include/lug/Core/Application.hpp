@@ -134,6 +134,13 @@ public:
      */
     bool run();
 
+    /**
+     * @brief      Sets the period of the dump of the tracked memory to the logger, see lug::System::Memory::Tracking.
+     *
+     * @param[in]  seconds  The period, in seconds. 0 to disable the dump, the default.
+     */
+    void setMemoryDumpPeriod(float seconds);
+
     /**
      * @brief      Close the application.
      *
@@ -164,13 +171,19 @@ private:
 private:
     Info _info;
     bool _closed{false};
+    float _memoryDumpPeriod{0.0f};
 
 
     lug::Graphics::Graphics::InitInfo _graphicsInitInfo{
         lug::Graphics::Renderer::Type::Vulkan,              // type
         {                                                   // rendererInitInfo
             "shaders/",                                     // shaders root
-            lug::Graphics::Render::Technique::Type::Forward // renderTechnique
+            lug::Graphics::Render::Technique::Type::Forward,// renderTechnique
+            0,                                              // memoryBudget
+            false,                                          // hotReload
+            false,                                          // bindless
+            false,                                          // textureStreaming
+            4                                               // maxLoadsPerFrame
         },
         {                                                   // mandatoryModules
             lug::Graphics::Module::Type::Core
@@ -42,3 +42,7 @@ inline const lug::Graphics::Graphics::InitInfo& Application::getGraphicsInfo() c
 inline lug::Graphics::Graphics::InitInfo& Application::getGraphicsInfo() {
     return _graphicsInitInfo;
 }
+
+inline void Application::setMemoryDumpPeriod(float seconds) {
+    _memoryDumpPeriod = seconds;
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <lug/Graphics/Animation/Clip.hpp>
+#include <lug/Graphics/Animation/Pose.hpp>
+#include <lug/Graphics/Animation/Skeleton.hpp>
+#include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Resource.hpp>
+#include <lug/Math/Batch.hpp>
+#include <lug/Math/Matrix.hpp>
+#include <lug/System/Time.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Animation {
+
+/**
+ * @brief      Plays clips on a skeleton and evaluates the palette of its joints, for one character.
+ *
+ *             The animator only writes its own state, the skeleton and the clips are only read:
+ *             the animators of different characters can be updated in parallel.
+ */
+class LUG_GRAPHICS_API Animator {
+public:
+    /**
+     * @brief      A clip being played, blended over the previous layers.
+     */
+    struct Layer {
+        Resource::SharedPtr<Clip> clip{nullptr};
+
+        float time{0.0f};       ///< The time in the clip, in seconds.
+        float speed{1.0f};      ///< The factor of the elapsed time.
+        float weight{1.0f};     ///< 1 replaces the joints animated by the clip, 0 disables the layer.
+        bool loop{true};        ///< Whether the clip restarts once finished, otherwise it stays on its last keys.
+    };
+
+public:
+    explicit Animator(Resource::SharedPtr<Skeleton> skeleton);
+
+    Animator(const Animator&) = delete;
+    Animator(Animator&&) = default;
+
+    Animator& operator=(const Animator&) = delete;
+    Animator& operator=(Animator&&) = default;
+
+    ~Animator() = default;
+
+    /**
+     * @brief      Adds a layer playing a clip, from its start.
+     *
+     * @param[in]  clip    The clip, its joints are the ones of the skeleton.
+     * @param[in]  weight  The weight of the layer.
+     * @param[in]  loop    Whether the clip loops.
+     *
+     * @return     The index of the layer.
+     */
+    uint32_t addLayer(Resource::SharedPtr<Clip> clip, float weight = 1.0f, bool loop = true);
+
+    Layer& getLayer(uint32_t idx);
+    const Layer& getLayer(uint32_t idx) const;
+    size_t getLayersCount() const;
+
+    /**
+     * @brief      Sets whether the keys are interpolated with slerp instead of nlerp.
+     *
+     *             The keys of the clips are usually close enough for nlerp, which is the default.
+     *             The layers are always blended with nlerp.
+     */
+    void setSlerpEnabled(bool enabled);
+    bool isSlerpEnabled() const;
+
+    /**
+     * @brief      Advances the time of the layers, then evaluates the pose and the palette.
+     *
+     * @param[in]  elapsedTime  The elapsed time since the last update.
+     */
+    void update(const System::Time& elapsedTime);
+
+    /**
+     * @brief      Evaluates the pose and the palette at the current time of the layers.
+     */
+    void evaluate();
+
+    const Skeleton& getSkeleton() const;
+    const Pose& getPose() const;
+
+    /**
+     * @brief      Returns the matrices of the joints relative to the root of the skeleton.
+     */
+    const std::vector<Math::Mat4x4f>& getJointsMatrices() const;
+
+    /**
+     * @brief      Returns the skinning matrices, i.e. the matrices of the joints multiplied by
+     *             their inverse bind matrices, indexed by the JOINTS_0 attribute.
+     */
+    const std::vector<Math::Mat4x4f>& getPalette() const;
+
+private:
+    /**
+     * @brief      Index of the current key of each track of a layer.
+     *
+     *             The keys are searched forward from the previous ones, which is constant time on
+     *             average as the time of a layer usually moves by less than a key per update.
+     */
+    struct Cursor {
+        std::vector<uint32_t> keys[3];
+    };
+
+    void sample(const Layer& layer, Cursor& cursor, Pose& pose);
+    void sampleVectors(const std::vector<Clip::Track>& tracks, float time, float weight, std::vector<uint32_t>& keys, Math::Batch::Vec3Array& values);
+    void sampleRotations(const std::vector<Clip::Track>& tracks, float time, float weight, std::vector<uint32_t>& keys, Math::Batch::QuatArray& values);
+
+    /**
+     * @brief      Returns the interpolation factor of the track at this time and moves its key.
+     *
+     * @param[in]  track  The track.
+     * @param[in]  time   The time.
+     * @param      key    The key before the time, updated.
+     * @param      next   The key after the time.
+     */
+    static float seek(const Clip::Track& track, float time, uint32_t& key, uint32_t& next);
+
+private:
+    Resource::SharedPtr<Skeleton> _skeleton;
+
+    std::vector<Layer> _layers;
+    std::vector<Cursor> _cursors;
+
+    bool _slerpEnabled{false};
+
+    Pose _pose;
+
+    // Keys sampled for the kernels
+    Math::Batch::Vec3Array _vectors[2];
+    Math::Batch::QuatArray _rotations[2];
+    std::vector<float> _factors;
+
+    std::vector<Math::Mat4x4f> _jointsMatrices;
+    std::vector<Math::Mat4x4f> _palette;
+};
+
+#include <lug/Graphics/Animation/Animator.inl>
+
+} // Animation
+} // Graphics
+} // lug
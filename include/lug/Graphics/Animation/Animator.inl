@@ -0,0 +1,35 @@
+inline Animator::Layer& Animator::getLayer(uint32_t idx) {
+    return _layers[idx];
+}
+
+inline const Animator::Layer& Animator::getLayer(uint32_t idx) const {
+    return _layers[idx];
+}
+
+inline size_t Animator::getLayersCount() const {
+    return _layers.size();
+}
+
+inline void Animator::setSlerpEnabled(bool enabled) {
+    _slerpEnabled = enabled;
+}
+
+inline bool Animator::isSlerpEnabled() const {
+    return _slerpEnabled;
+}
+
+inline const Skeleton& Animator::getSkeleton() const {
+    return *_skeleton;
+}
+
+inline const Pose& Animator::getPose() const {
+    return _pose;
+}
+
+inline const std::vector<Math::Mat4x4f>& Animator::getJointsMatrices() const {
+    return _jointsMatrices;
+}
+
+inline const std::vector<Math::Mat4x4f>& Animator::getPalette() const {
+    return _palette;
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Resource.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Animation {
+
+/**
+ * @brief      Keyframes of the joints of a Skeleton, e.g. a glTF animation.
+ *
+ *             A clip is only read by the animators, it can be shared by many characters.
+ */
+class LUG_GRAPHICS_API Clip : public Resource {
+public:
+    /**
+     * @brief      Keyframes of one component of the transformation of a joint.
+     */
+    struct Track {
+        enum class Path : uint8_t {
+            Translation,    ///< VEC3
+            Rotation,       ///< Quaternion, normalized
+            Scale           ///< VEC3
+        };
+
+        enum class Interpolation : uint8_t {
+            Step,           ///< The value of the previous key
+            Linear          ///< Lerp for the vectors, nlerp or slerp for the rotations
+        };
+
+        uint32_t joint{0};
+        Path path{Path::Translation};
+        Interpolation interpolation{Interpolation::Linear};
+
+        std::vector<float> times;       ///< The times of the keys in seconds, ascending.
+        std::vector<float> values[4];   ///< The values of the keys, one array per component: {x, y, z} or {w, x, y, z} for the rotations.
+    };
+
+public:
+    explicit Clip(const std::string& name);
+
+    Clip(const Clip&) = delete;
+    Clip(Clip&&) = delete;
+
+    Clip& operator=(const Clip&) = delete;
+    Clip& operator=(Clip&&) = delete;
+
+    ~Clip() = default;
+
+    /**
+     * @brief      Adds a track to the clip, the duration of the clip is extended to its last key.
+     *
+     * @param[in]  track  The track.
+     *
+     * @return     False if the track has no key, if the times are not ascending or if the values
+     *             don't have one component per time.
+     */
+    bool addTrack(Track track);
+
+    /**
+     * @brief      Returns the tracks of one path, in the order they were added.
+     */
+    const std::vector<Track>& getTracks(Track::Path path) const;
+
+    float getDuration() const;
+
+private:
+    std::vector<Track> _tracks[3];
+    float _duration{0.0f};
+};
+
+#include <lug/Graphics/Animation/Clip.inl>
+
+} // Animation
+} // Graphics
+} // lug
@@ -0,0 +1,7 @@
+inline const std::vector<Clip::Track>& Clip::getTracks(Track::Path path) const {
+    return _tracks[static_cast<uint8_t>(path)];
+}
+
+inline float Clip::getDuration() const {
+    return _duration;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+
+#include <lug/Math/Batch.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Animation {
+
+/**
+ * @brief      Local transformations of the joints of a Skeleton, relative to their parents.
+ *
+ *             They are stored as one array per component, for the kernels of Math::Batch.
+ */
+struct Pose {
+    void resize(size_t size);
+    size_t size() const;
+
+    Math::Batch::Vec3Array translations;
+    Math::Batch::QuatArray rotations;
+    Math::Batch::Vec3Array scales;
+};
+
+#include <lug/Graphics/Animation/Pose.inl>
+
+} // Animation
+} // Graphics
+} // lug
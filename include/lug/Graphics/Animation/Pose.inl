@@ -0,0 +1,9 @@
+inline void Pose::resize(size_t size) {
+    translations.resize(size);
+    rotations.resize(size);
+    scales.resize(size);
+}
+
+inline size_t Pose::size() const {
+    return translations.size();
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <lug/Graphics/Animation/Pose.hpp>
+#include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Resource.hpp>
+#include <lug/Math/Matrix.hpp>
+#include <lug/Math/Quaternion.hpp>
+#include <lug/Math/Vector.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Animation {
+
+/**
+ * @brief      Hierarchy of joints deforming a skinned mesh, e.g. a glTF skin.
+ *
+ *             The index of a joint is its index in the palette, i.e. the one of the JOINTS_0 attribute.
+ *             A skeleton is only read by the animators, it can be shared by many characters.
+ */
+class LUG_GRAPHICS_API Skeleton : public Resource {
+public:
+    struct Joint {
+        std::string name;
+        int32_t parent{-1};     ///< The index of the parent joint, -1 for the roots.
+
+        Math::Mat4x4f inverseBindMatrix{Math::Mat4x4f::identity()};
+
+        // The rest pose, used for the joints which are not animated
+        Math::Vec3f translation{Math::Vec3f(0.0f)};
+        Math::Quatf rotation{Math::Quatf::identity()};
+        Math::Vec3f scale{Math::Vec3f(1.0f)};
+    };
+
+public:
+    explicit Skeleton(const std::string& name);
+
+    Skeleton(const Skeleton&) = delete;
+    Skeleton(Skeleton&&) = delete;
+
+    Skeleton& operator=(const Skeleton&) = delete;
+    Skeleton& operator=(Skeleton&&) = delete;
+
+    ~Skeleton() = default;
+
+    /**
+     * @brief      Sets the joints of the skeleton.
+     *
+     *             The parents can be after their children, the order of evaluation is computed here.
+     *
+     * @param[in]  joints  The joints.
+     *
+     * @return     False if a parent is out of range or if the hierarchy has a cycle.
+     */
+    bool setJoints(const std::vector<Joint>& joints);
+
+    size_t getJointsCount() const;
+    const std::vector<std::string>& getJointsNames() const;
+
+    /**
+     * @brief      Returns the index of the joint with this name, -1 if not found.
+     */
+    int32_t getJointIndex(const std::string& name) const;
+
+    const std::vector<int32_t>& getParents() const;
+    const std::vector<Math::Mat4x4f>& getInverseBindMatrices() const;
+    const Pose& getRestPose() const;
+
+    /**
+     * @brief      Returns the indices of the joints sorted so that the parents are before their children.
+     */
+    const std::vector<uint32_t>& getEvaluationOrder() const;
+
+private:
+    std::vector<std::string> _names;
+    std::vector<int32_t> _parents;
+    std::vector<Math::Mat4x4f> _inverseBindMatrices;
+    Pose _restPose;
+
+    std::vector<uint32_t> _evaluationOrder;
+};
+
+#include <lug/Graphics/Animation/Skeleton.inl>
+
+} // Animation
+} // Graphics
+} // lug
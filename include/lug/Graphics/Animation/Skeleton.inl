@@ -0,0 +1,23 @@
+inline size_t Skeleton::getJointsCount() const {
+    return _parents.size();
+}
+
+inline const std::vector<std::string>& Skeleton::getJointsNames() const {
+    return _names;
+}
+
+inline const std::vector<int32_t>& Skeleton::getParents() const {
+    return _parents;
+}
+
+inline const std::vector<Math::Mat4x4f>& Skeleton::getInverseBindMatrices() const {
+    return _inverseBindMatrices;
+}
+
+inline const Pose& Skeleton::getRestPose() const {
+    return _restPose;
+}
+
+inline const std::vector<uint32_t>& Skeleton::getEvaluationOrder() const {
+    return _evaluationOrder;
+}
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Resource.hpp>
+
+namespace lug {
+namespace Graphics {
+
+/**
+ * @brief      Class for asynchronous loading.
+ *             A load is split in two stages: the read stage (file access, parsing, decoding) runs
+ *             on a pool of loader threads, and the build stage (creation of the resources and GPU
+ *             upload) runs on the main thread when #integrate is called, usually once per frame.
+ *
+ *             The read stages are processed by order of priority, then by order of submission.
+ */
+class LUG_GRAPHICS_API AsyncLoader {
+public:
+    /**
+     * @brief      Ticket of a load, shared between the AsyncLoader and the user.
+     */
+    class LUG_GRAPHICS_API Ticket {
+        friend class AsyncLoader;
+
+    public:
+        enum class Status : uint8_t {
+            Queued,     ///< Waiting for a loader thread
+            Reading,    ///< The read stage is running
+            Read,       ///< Waiting for AsyncLoader::integrate
+            Completed,  ///< The resource is available
+            Failed,     ///< One of the stages failed
+            Cancelled   ///< The load has been cancelled
+        };
+
+    public:
+        Ticket(const std::string& name, int32_t priority);
+
+        Ticket(const Ticket&) = delete;
+        Ticket(Ticket&&) = delete;
+
+        Ticket& operator=(const Ticket&) = delete;
+        Ticket& operator=(Ticket&&) = delete;
+
+        ~Ticket() = default;
+
+        const std::string& getName() const;
+        int32_t getPriority() const;
+
+        Status getStatus() const;
+
+        /**
+         * @brief      Returns whether the load is finished, successfully or not.
+         */
+        bool isDone() const;
+
+        /**
+         * @brief      Returns the progress of the load, between 0 and 1.
+         */
+        float getProgress() const;
+
+        /**
+         * @brief      Sets the progress of the read stage, between 0 and 1.
+         *             To be called by the read stage only.
+         */
+        void setReadProgress(float progress);
+
+        /**
+         * @brief      Requests the cancellation of the load.
+         *             The read stage can poll #isCancelRequested to abort early,
+         *             the build stage is never started once the load is cancelled.
+         */
+        void cancel();
+        bool isCancelRequested() const;
+
+        /**
+         * @brief      Returns the loaded resource, only valid once the status is Status::Completed.
+         */
+        Resource::SharedPtr<Resource> getResource() const;
+
+    private:
+        std::string _name;
+        int32_t _priority;
+        uint64_t _sequence{0};
+
+        std::atomic<Status> _status{Status::Queued};
+        std::atomic<float> _progress{0.0f};
+        std::atomic<bool> _cancelRequested{false};
+
+        Resource::SharedPtr<Resource> _resource{nullptr};
+    };
+
+    struct Task {
+        std::function<bool(Ticket&)> read;                              ///< Called on a loader thread
+        std::function<Resource::SharedPtr<Resource>(Ticket&)> build;    ///< Called on the main thread
+    };
+
+public:
+    explicit AsyncLoader(uint32_t threadsCount);
+
+    AsyncLoader(const AsyncLoader&) = delete;
+    AsyncLoader(AsyncLoader&&) = delete;
+
+    AsyncLoader& operator=(const AsyncLoader&) = delete;
+    AsyncLoader& operator=(AsyncLoader&&) = delete;
+
+    /**
+     * @brief      Cancels the queued loads and joins the loader threads.
+     */
+    ~AsyncLoader();
+
+    /**
+     * @brief      Submits a load.
+     * @param[in]  name      The name of the load, usually the filename.
+     * @param[in]  priority  The priority, higher is loaded first.
+     * @param[in]  task      The stages of the load.
+     * @return     The ticket of the load.
+     */
+    std::shared_ptr<Ticket> enqueue(const std::string& name, int32_t priority, Task task);
+
+    /**
+     * @brief      Runs the build stage of the loads whose read stage is finished.
+     *             Must be called from the main thread.
+     * @param[in]  maxLoads  The maximum number of loads to integrate, 0 for no limit.
+     * @return     The number of loads integrated (completed or failed).
+     */
+    uint32_t integrate(uint32_t maxLoads = 0);
+
+    /**
+     * @brief      Blocks until the read stage of a load is finished.
+     */
+    void wait(const Ticket& ticket);
+
+    /**
+     * @brief      Returns the number of loads not integrated yet.
+     */
+    uint32_t getPendingCount() const;
+
+    uint32_t getThreadsCount() const;
+
+private:
+    struct Job {
+        std::shared_ptr<Ticket> ticket;
+        Task task;
+    };
+
+    void run();
+
+    static bool compareJobs(const Job& lhs, const Job& rhs);
+
+private:
+    std::vector<std::thread> _threads;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _queuedCondition;
+    std::condition_variable _readCondition;
+
+    bool _stop{false};
+    uint64_t _sequence{0};
+
+    std::vector<Job> _queued;   ///< Heap ordered by #compareJobs
+    std::vector<Job> _read;     ///< Heap ordered by #compareJobs
+    uint32_t _readingCount{0};
+};
+
+#include <lug/Graphics/AsyncLoader.inl>
+
+} // Graphics
+} // lug
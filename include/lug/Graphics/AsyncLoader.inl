@@ -0,0 +1,36 @@
+inline const std::string& AsyncLoader::Ticket::getName() const {
+    return _name;
+}
+
+inline int32_t AsyncLoader::Ticket::getPriority() const {
+    return _priority;
+}
+
+inline AsyncLoader::Ticket::Status AsyncLoader::Ticket::getStatus() const {
+    return _status.load();
+}
+
+inline bool AsyncLoader::Ticket::isDone() const {
+    const Status status = _status.load();
+    return status == Status::Completed || status == Status::Failed || status == Status::Cancelled;
+}
+
+inline float AsyncLoader::Ticket::getProgress() const {
+    return _progress.load();
+}
+
+inline void AsyncLoader::Ticket::cancel() {
+    _cancelRequested = true;
+}
+
+inline bool AsyncLoader::Ticket::isCancelRequested() const {
+    return _cancelRequested.load();
+}
+
+inline Resource::SharedPtr<Resource> AsyncLoader::Ticket::getResource() const {
+    return _status.load() == Status::Completed ? _resource : nullptr;
+}
+
+inline uint32_t AsyncLoader::getThreadsCount() const {
+    return static_cast<uint32_t>(_threads.size());
+}
@@ -20,6 +20,8 @@ class LUG_GRAPHICS_API Mesh {
 
 public:
     class LUG_GRAPHICS_API PrimitiveSet {
+        friend class Mesh;
+
     public:
         PrimitiveSet() = default;
 
@@ -43,6 +45,9 @@ public:
         Resource::SharedPtr<Render::Material> getMaterial() const;
         const std::vector<Render::Mesh::PrimitiveSet::Attribute>& getAttributes() const;
 
+    private:
+        void compressAttributes();
+
     private:
         Render::Mesh::PrimitiveSet::Mode _mode{Render::Mesh::PrimitiveSet::Mode::Triangles};
         Resource::SharedPtr<Render::Material> _material{nullptr};
@@ -69,6 +74,16 @@ public:
      */
     void setName(const std::string& name);
 
+    /**
+     * @brief      Stores the positions as half floats and the normals as oct16, disabled by default.
+     *
+     *             The vertices then take 12 bytes instead of 24. The halves keep 11 bits of precision,
+     *             i.e. 1 mm between 2 and 4 meters from the origin of the mesh.
+     *
+     * @param[in]  compressVertices  Whether to compress the vertices.
+     */
+    void setCompressVertices(bool compressVertices);
+
     /**
      * @brief      Adds a primitive set to the builder and returns it.
      */
@@ -81,6 +96,7 @@ protected:
 
     std::string _name;
     std::list<PrimitiveSet> _primitiveSets;
+    bool _compressVertices{false};
 };
 
 #include <lug/Graphics/Builder/Mesh.inl>
@@ -26,3 +26,7 @@ inline Mesh::PrimitiveSet* Mesh::addPrimitiveSet() {
 inline void Mesh::setName(const std::string& name) {
     _name = name;
 }
+
+inline void Mesh::setCompressVertices(bool compressVertices) {
+    _compressVertices = compressVertices;
+}
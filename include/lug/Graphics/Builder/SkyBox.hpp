@@ -53,6 +53,16 @@ public:
     void setWrapT(Render::Texture::WrappingMode wrapT);
     void setFaceFilename(Face face, const std::string& filename);
 
+    /**
+     * @brief      Enables the image-based lighting of the objects by the skybox.
+     *             The irradiance map, the specular map and the BRDF lookup table are generated
+     *             from the faces the first time, and written as KTX2 files to be loaded directly the next times.
+     *
+     * @param[in]  prefix  The prefix of the filenames of the cache, "_irradiance.ktx2",
+     *                     "_specular.ktx2" and "_brdf.ktx2" are appended to it.
+     */
+    void setEnvironmentCache(const std::string& prefix);
+
     Resource::SharedPtr<Render::SkyBox> build();
 
 protected:
@@ -69,6 +79,9 @@ protected:
 
     // Contains alls file names for faces
     std::array<std::string, 6> _faces;
+
+    // Empty if the skybox doesn't light the scene
+    std::string _environmentCache;
 };
 
 #include <lug/Graphics/Builder/SkyBox.inl>
@@ -25,3 +25,7 @@ inline void SkyBox::setWrapT(Render::Texture::WrappingMode wrapT) {
 inline void SkyBox::setFaceFilename(Face face, const std::string& filename) {
     _faces[static_cast<uint8_t>(face)] = filename;
 }
+
+inline void SkyBox::setEnvironmentCache(const std::string& prefix) {
+    _environmentCache = prefix;
+}
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <lug/Graphics/Resource.hpp>
@@ -53,8 +55,40 @@ public:
     void setWrapS(Render::Texture::WrappingMode wrapS);
     void setWrapT(Render::Texture::WrappingMode wrapT);
 
+    /**
+     * @brief      Sets the number of mipmap levels of the texture.
+     *
+     * @param[in]  mipLevels  The number of levels, 0 (the default) for the full chain down to 1x1.
+     */
+    void setMipLevels(uint32_t mipLevels);
+
+    /**
+     * @brief      Sets the color space of the texture, Linear by default.
+     *             The formats with an sRGB variant use it for the sRGB textures.
+     *
+     * @param[in]  colorSpace  The color space.
+     */
+    void setColorSpace(Render::Texture::ColorSpace colorSpace);
+
+    /**
+     * @brief      Sets whether the mip levels of the texture are streamed, false by default.
+     *             A streamed texture is loaded from its base level, the finer levels are loaded
+     *             when the objects using the texture are large enough on the screen.
+     *
+     * @param[in]  streaming  Whether the texture is streamed.
+     */
+    void setStreaming(bool streaming);
+
     void addLayer(const std::string& filename);
 
+    /**
+     * @brief      Sets the layers already decoded from the files added with #addLayer, to not decode them
+     *             on the main thread. The files are still read again when the texture is reloaded.
+     *
+     * @param[in]  image  The image returned by Vulkan::Builder::Texture::read, moved into the texture by #build.
+     */
+    void setImage(std::shared_ptr<lug::Graphics::Vulkan::Builder::Texture::Image> image);
+
     Resource::SharedPtr<Render::Texture> build();
 
 protected:
@@ -71,7 +105,13 @@ protected:
     Render::Texture::WrappingMode _wrapS{Render::Texture::WrappingMode::ClampToEdge};
     Render::Texture::WrappingMode _wrapT{Render::Texture::WrappingMode::ClampToEdge};
 
+    uint32_t _mipLevels{0};
+
+    Render::Texture::ColorSpace _colorSpace{Render::Texture::ColorSpace::Linear};
+    bool _streaming{false};
+
     std::vector<Layer> _layers;
+    std::shared_ptr<lug::Graphics::Vulkan::Builder::Texture::Image> _image{nullptr};
 };
 
 #include <lug/Graphics/Builder/Texture.inl>
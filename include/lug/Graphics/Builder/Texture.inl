@@ -26,6 +26,22 @@ inline void Texture::setWrapT(Render::Texture::WrappingMode wrapT) {
     _wrapT = wrapT;
 }
 
+inline void Texture::setMipLevels(uint32_t mipLevels) {
+    _mipLevels = mipLevels;
+}
+
+inline void Texture::setColorSpace(Render::Texture::ColorSpace colorSpace) {
+    _colorSpace = colorSpace;
+}
+
+inline void Texture::setStreaming(bool streaming) {
+    _streaming = streaming;
+}
+
 inline void Texture::addLayer(const std::string& filename) {
     _layers.push_back({filename});
 }
+
+inline void Texture::setImage(std::shared_ptr<lug::Graphics::Vulkan::Builder::Texture::Image> image) {
+    _image = std::move(image);
+}
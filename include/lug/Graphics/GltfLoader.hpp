@@ -29,6 +29,21 @@ public:
      * @return     SharedPtr to the resulting Resource
      */
     Resource::SharedPtr<Resource> loadFile(const std::string& filename) override final;
+
+    /**
+     * @brief      Parses a glTF file and decodes the images of its textures
+     * @param[in]  filename  The filename
+     * @return     The parsed asset
+     */
+    std::unique_ptr<Data> read(const std::string& filename) override final;
+
+    /**
+     * @brief      Creates the scene of a parsed glTF file
+     * @param[in]  filename  The filename
+     * @param[in]  data      The parsed asset returned by #read
+     * @return     SharedPtr to the resulting Resource
+     */
+    Resource::SharedPtr<Resource> build(const std::string& filename, Data& data) override final;
 };
 
 } // Graphics
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include <lug/Graphics/Export.hpp>
@@ -14,6 +15,14 @@ class Renderer;
  * @brief      Class for loading a type of file
  */
 class LUG_GRAPHICS_API Loader {
+public:
+    /**
+     * @brief      Data read from a file by #read, to build the resource from.
+     */
+    struct Data {
+        virtual ~Data() = default;
+    };
+
 public:
     Loader(Renderer& renderer);
 
@@ -32,6 +41,22 @@ public:
      */
     virtual Resource::SharedPtr<Resource> loadFile(const std::string& filename) = 0;
 
+    /**
+     * @brief      Reads a file without creating any resource, so it can be called from any thread.
+     *             The default implementation doesn't read anything and lets #build load the file.
+     * @param[in]  filename  The filename.
+     * @return     The data read, or nullptr on failure.
+     */
+    virtual std::unique_ptr<Data> read(const std::string& filename);
+
+    /**
+     * @brief      Creates a Resource from the data returned by #read. Must be called from the main thread.
+     * @param[in]  filename  The filename.
+     * @param[in]  data      The data read.
+     * @return     The resource.
+     */
+    virtual Resource::SharedPtr<Resource> build(const std::string& filename, Data& data);
+
 protected:
     Renderer& _renderer;
 };
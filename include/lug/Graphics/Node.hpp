@@ -34,6 +34,8 @@ public:
 
     const std::string& getName() const;
 
+    const std::vector<Node*>& getChildren() const;
+
     Node* getNode(const std::string& name);
     const Node* getNode(const std::string& name) const;
 
@@ -43,8 +45,20 @@ public:
 
     const Math::Mat4x4f& getTransform();
 
+    /**
+     * @brief      Attaches a child to this node, it is detached from its previous parent.
+     *
+     * @param      child  The child.
+     */
     void attachChild(Node& child);
 
+    /**
+     * @brief      Detaches a child from this node, it keeps its own children.
+     *
+     * @param      child  The child.
+     */
+    void detachChild(Node& child);
+
     void translate(const Math::Vec3f& direction, TransformSpace space = TransformSpace::Local);
     void rotate(float angle, const Math::Vec3f& axis, TransformSpace space = TransformSpace::Local);
     void rotate(const Math::Quatf& quat, TransformSpace space = TransformSpace::Local);
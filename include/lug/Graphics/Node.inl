@@ -11,6 +11,10 @@ inline const std::string& Node::getName() const {
     return _name;
 }
 
+inline const std::vector<Node*>& Node::getChildren() const {
+    return _children;
+}
+
 inline const Math::Vec3f& Node::getAbsolutePosition() {
     if (_needUpdate) {
         update();
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <lug/Graphics/Export.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+
+/**
+ * @brief      CPU encoding and decoding of the BC1 to BC5 block compressed formats.
+ *
+ *             The encoder is meant for offline conversion, it fits the endpoints of the blocks
+ *             on the principal axis of their colors. The decoder is used when the device doesn't
+ *             support the format of a compressed texture, which is then uploaded as RGBA8.
+ *
+ *             The images are RGBA8, the blocks are 4x4 texels stored row by row. The texels of
+ *             the partial blocks on the right and bottom edges are replicated from the edges.
+ */
+namespace BlockCompression {
+
+enum class Format : uint8_t {
+    BC1,    // RGB with 1 bit of alpha, 8 bytes per block
+    BC2,    // RGB with 4 bits of explicit alpha, 16 bytes per block
+    BC3,    // RGB with interpolated alpha, 16 bytes per block
+    BC4,    // Red, 8 bytes per block
+    BC5     // Red and green, 16 bytes per block
+};
+
+/**
+ * @brief      Returns the size of a block in bytes.
+ */
+LUG_GRAPHICS_API uint32_t getBlockSize(Format format);
+
+/**
+ * @brief      Returns the size of a compressed image in bytes.
+ */
+LUG_GRAPHICS_API size_t getCompressedSize(Format format, uint32_t width, uint32_t height);
+
+/**
+ * @brief      Compresses an RGBA8 image.
+ *
+ * @param[in]  format  The format of the blocks.
+ * @param[in]  src     The RGBA8 pixels.
+ * @param[in]  width   The width of the image.
+ * @param[in]  height  The height of the image.
+ * @param      dst     The blocks, of getCompressedSize(format, width, height) bytes.
+ */
+LUG_GRAPHICS_API void encode(Format format, const uint8_t* src, uint32_t width, uint32_t height, uint8_t* dst);
+
+/**
+ * @brief      Decompresses an image to RGBA8.
+ *             The missing channels are decoded as in Vulkan, 0 for the colors and 255 for the alpha.
+ *
+ * @param[in]  format  The format of the blocks.
+ * @param[in]  src     The blocks.
+ * @param[in]  width   The width of the image.
+ * @param[in]  height  The height of the image.
+ * @param      dst     The RGBA8 pixels.
+ */
+LUG_GRAPHICS_API void decode(Format format, const uint8_t* src, uint32_t width, uint32_t height, uint8_t* dst);
+
+} // BlockCompression
+
+} // Render
+} // Graphics
+} // lug
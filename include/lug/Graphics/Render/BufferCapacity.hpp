@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <lug/Graphics/Export.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+
+/**
+ * @brief      Chooses the capacity of a buffer whose content is rewritten every frame.
+ *
+ *             The capacity grows geometrically when a frame needs more than it, so that a slowly
+ *             growing content only causes a logarithmic number of reallocations. It only shrinks
+ *             when the frames needed less than a fraction of it for #getShrinkDelay frames in a row,
+ *             so that a content oscillating around a size never reallocates.
+ *
+ *             This class only computes the capacity, the buffer is owned by the user.
+ */
+class LUG_GRAPHICS_API BufferCapacity {
+public:
+    /**
+     * @brief      Constructs the policy.
+     *
+     * @param[in]  minCapacity   The minimum capacity, in bytes.
+     * @param[in]  alignment     The alignment of the capacity, must be a power of two.
+     * @param[in]  growthFactor  The factor applied to the capacity when it grows, must be greater than 1.
+     * @param[in]  shrinkDelay   The number of frames the needed size must stay low before shrinking.
+     */
+    BufferCapacity(size_t minCapacity = 0, size_t alignment = 1, float growthFactor = 2.0f, uint32_t shrinkDelay = 300);
+
+    BufferCapacity(const BufferCapacity&) = default;
+    BufferCapacity(BufferCapacity&&) = default;
+
+    BufferCapacity& operator=(const BufferCapacity&) = default;
+    BufferCapacity& operator=(BufferCapacity&&) = default;
+
+    ~BufferCapacity() = default;
+
+    /**
+     * @brief      Updates the capacity with the size needed by a frame.
+     *
+     * @param[in]  size  The size needed by the frame, in bytes.
+     *
+     * @return     Whether the capacity changed, i.e. the buffer must be reallocated.
+     */
+    bool update(size_t size);
+
+    /**
+     * @brief      Grows the capacity even if it is enough for @p size, e.g. when the buffer
+     *             is too fragmented to allocate it.
+     *
+     * @param[in]  size  The size needed by the frame, in bytes.
+     */
+    void grow(size_t size);
+
+    /**
+     * @brief      Returns @p size rounded up to the alignment.
+     */
+    size_t align(size_t size) const;
+
+    size_t getCapacity() const;
+    size_t getMinCapacity() const;
+    size_t getAlignment() const;
+    uint32_t getShrinkDelay() const;
+
+    /**
+     * @brief      Returns the number of times the capacity changed, including the first allocation.
+     */
+    uint32_t getReallocationsCount() const;
+
+private:
+    void resize(size_t capacity);
+
+private:
+    size_t _minCapacity;
+    size_t _alignment;
+    float _growthFactor;
+    uint32_t _shrinkDelay;
+
+    size_t _capacity{0};
+
+    // Frames in a row needing less than the shrink threshold, and the largest size they needed
+    uint32_t _lowFramesCount{0};
+    size_t _lowFramesMaxSize{0};
+
+    uint32_t _reallocationsCount{0};
+};
+
+#include <lug/Graphics/Render/BufferCapacity.inl>
+
+} // Render
+} // Graphics
+} // lug
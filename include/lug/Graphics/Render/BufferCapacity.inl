@@ -0,0 +1,19 @@
+inline size_t BufferCapacity::getCapacity() const {
+    return _capacity;
+}
+
+inline size_t BufferCapacity::getMinCapacity() const {
+    return _minCapacity;
+}
+
+inline size_t BufferCapacity::getAlignment() const {
+    return _alignment;
+}
+
+inline uint32_t BufferCapacity::getShrinkDelay() const {
+    return _shrinkDelay;
+}
+
+inline uint32_t BufferCapacity::getReallocationsCount() const {
+    return _reallocationsCount;
+}
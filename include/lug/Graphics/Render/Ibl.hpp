@@ -0,0 +1,117 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/Math/Vector.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+
+/**
+ * @brief      CPU generation of the image-based lighting of an environment cube map.
+ *
+ *             The lighting of the forward renderer is split in three textures:
+ *             - The irradiance map, the diffuse lighting of a white Lambertian surface for each normal,
+ *               projected on 9 spherical harmonics.
+ *             - The specular map, the environment prefiltered with the GGX distribution,
+ *               one level per roughness from 0 (first level) to 1 (last level).
+ *             - The BRDF lookup table, the split-sum scale and bias of F0 per NdotV (u) and roughness (v).
+ *
+ *             The roughness is the perceptual roughness of the materials, the GGX alpha is its square.
+ */
+namespace Ibl {
+
+/**
+ * @brief      Cube map of linear RGB texels.
+ *             The faces are in the order of the layers of a cube map: +X, -X, +Y, -Y, +Z, -Z.
+ */
+struct CubeMap {
+    uint32_t size;                                  ///< Width and height of the faces
+    std::array<std::vector<Math::Vec3f>, 6> faces;  ///< Texels of the faces, row by row
+};
+
+using SphericalHarmonics = std::array<Math::Vec3f, 9>;
+
+/**
+ * @brief      Returns the direction of a point of a face of a cube map.
+ *
+ * @param[in]  face  The face.
+ * @param[in]  u     The horizontal texture coordinate in the face, in [0, 1].
+ * @param[in]  v     The vertical texture coordinate in the face, in [0, 1].
+ *
+ * @return     The normalized direction.
+ */
+LUG_GRAPHICS_API Math::Vec3f getDirection(uint32_t face, float u, float v);
+
+/**
+ * @brief      Samples a cube map with a bilinear filter, the texels of the other faces are not used on the edges.
+ */
+LUG_GRAPHICS_API Math::Vec3f sample(const CubeMap& cubeMap, const Math::Vec3f& direction);
+
+/**
+ * @brief      Returns the cube map of half the size, each texel is the average of 2x2 texels.
+ */
+LUG_GRAPHICS_API CubeMap downsample(const CubeMap& cubeMap);
+
+/**
+ * @brief      Projects the irradiance of an environment on the spherical harmonics of the 3 first bands.
+ *             The irradiance is divided by pi: a constant environment of radiance L gives L.
+ */
+LUG_GRAPHICS_API SphericalHarmonics computeIrradiance(const CubeMap& environment);
+
+/**
+ * @brief      Evaluates the irradiance of a normal from its spherical harmonics.
+ */
+LUG_GRAPHICS_API Math::Vec3f getIrradiance(const SphericalHarmonics& irradiance, const Math::Vec3f& normal);
+
+/**
+ * @brief      Creates the irradiance map, the irradiance evaluated for the direction of each texel.
+ */
+LUG_GRAPHICS_API CubeMap createIrradianceMap(const SphericalHarmonics& irradiance, uint32_t size);
+
+/**
+ * @brief      Prefilters an environment with the GGX distribution, with the view direction along the normal.
+ *             The samples are importance sampled, and read from the mip level of their solid angle to
+ *             remove the aliasing of the small light sources.
+ *
+ * @param[in]  environment   The environment, the first level of the result.
+ * @param[in]  levelsCount   The number of levels, the level i has the roughness i / (levelsCount - 1).
+ * @param[in]  samplesCount  The number of samples per texel.
+ *
+ * @return     The levels, the level i has the size max(environment.size >> i, 1).
+ */
+LUG_GRAPHICS_API std::vector<CubeMap> prefilter(const CubeMap& environment, uint32_t levelsCount, uint32_t samplesCount);
+
+/**
+ * @brief      Integrates the specular BRDF over the hemisphere, for an environment of radiance 1.
+ *
+ * @return     The scale (x) and bias (y) of F0: the integral is F0 * x + y.
+ */
+LUG_GRAPHICS_API Math::Vec2f integrateBrdf(float NdotV, float roughness, uint32_t samplesCount);
+
+/**
+ * @brief      Creates the BRDF lookup table, the texel (x, y) is integrateBrdf((x + 0.5) / size, (y + 0.5) / size).
+ */
+LUG_GRAPHICS_API std::vector<Math::Vec2f> createBrdfLut(uint32_t size, uint32_t samplesCount);
+
+/**
+ * @brief      Writes the levels of a cube map in a KTX2 file, in R16G16B16A16Sfloat.
+ *
+ * @return     Whether the file has been written, false if the sizes of the levels are not a mip chain.
+ */
+LUG_GRAPHICS_API bool writeCubeMap(const std::vector<CubeMap>& levels, std::vector<uint8_t>& file);
+
+/**
+ * @brief      Writes a BRDF lookup table in a KTX2 file, in R16G16Sfloat.
+ */
+LUG_GRAPHICS_API bool writeBrdfLut(const std::vector<Math::Vec2f>& lut, uint32_t size, std::vector<uint8_t>& file);
+
+} // Ibl
+
+} // Render
+} // Graphics
+} // lug
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Render/BlockCompression.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+
+/**
+ * @brief      Reading and writing of KTX2 containers.
+ *
+ *             The format of a KTX2 file is a VkFormat, the values used here are the ones of Vulkan
+ *             so that this module doesn't depend on it. Only 2D textures, arrays and cube maps are read.
+ *             The supercompressed files (BasisLZ, Zstandard, ZLIB) are parsed but their levels
+ *             can't be used without a transcoder.
+ */
+namespace Ktx2 {
+
+enum class Format : uint32_t {
+    Undefined = 0,
+    R8G8B8A8Unorm = 37,
+    R8G8B8A8Srgb = 43,
+    R16G16Sfloat = 83,
+    R16G16B16A16Sfloat = 97,
+    BC1RgbUnorm = 131,
+    BC1RgbSrgb = 132,
+    BC1RgbaUnorm = 133,
+    BC1RgbaSrgb = 134,
+    BC2Unorm = 135,
+    BC2Srgb = 136,
+    BC3Unorm = 137,
+    BC3Srgb = 138,
+    BC4Unorm = 139,
+    BC4Snorm = 140,
+    BC5Unorm = 141,
+    BC5Snorm = 142,
+    BC6HUfloat = 143,
+    BC6HSfloat = 144,
+    BC7Unorm = 145,
+    BC7Srgb = 146,
+    ETC2R8G8B8Unorm = 147,  // The ETC2, EAC and ASTC formats are in [ETC2R8G8B8Unorm, ASTC12x12Srgb]
+    ASTC4x4Unorm = 157,
+    ASTC12x12Srgb = 184
+};
+
+enum class SupercompressionScheme : uint32_t {
+    None = 0,
+    BasisLZ = 1,
+    Zstandard = 2,
+    ZLIB = 3
+};
+
+enum class Result : uint8_t {
+    Success,
+    InvalidIdentifier,      // Not a KTX2 file
+    Truncated,              // A header, index or level is outside of the file
+    InvalidHeader,          // Inconsistent header, or level of an unexpected size
+    UnsupportedDimensions   // 1D or 3D texture
+};
+
+struct FormatInfo {
+    uint32_t blockWidth;
+    uint32_t blockHeight;
+    uint32_t blockSize;     ///< Size of a block in bytes, of a texel for the uncompressed formats
+    bool srgb;
+};
+
+struct Level {
+    size_t offset;          ///< Offset of the level in the file
+    size_t size;            ///< Size of the level in the file, all the layers and faces
+    size_t uncompressedSize;
+};
+
+struct Image {
+    Format format;
+    uint32_t width;
+    uint32_t height;
+    uint32_t layersCount;   ///< 1 for the textures which aren't arrays
+    uint32_t facesCount;    ///< 6 for the cube maps, 1 otherwise
+    bool generateMipmaps;   ///< The file only has the first level and asks the loader to generate the others
+
+    SupercompressionScheme supercompressionScheme;
+
+    std::vector<Level> levels;                                      ///< The first level is the largest
+    std::vector<std::pair<std::string, std::string>> keyValues;
+};
+
+/**
+ * @brief      Returns the block layout of a format.
+ *
+ * @return     Whether the format is known, the uncompressed formats other than RGBA8 and the half floats are not.
+ */
+LUG_GRAPHICS_API bool getFormatInfo(Format format, FormatInfo& info);
+
+/**
+ * @brief      Returns the block compression of a format that can be decoded on the CPU, see BlockCompression::decode.
+ *
+ * @param[in]  format             The compressed format.
+ * @param[out] blockFormat        The block compression of the format.
+ * @param[out] decodedFormat      The RGBA8 format of the decoded image.
+ *
+ * @return     Whether the format can be decoded.
+ */
+LUG_GRAPHICS_API bool getDecodedFormat(Format format, BlockCompression::Format& blockFormat, Format& decodedFormat);
+
+/**
+ * @brief      Returns the sRGB variant of a format.
+ *
+ * @return     The sRGB format, or the format itself if it is already sRGB or has no sRGB variant.
+ */
+LUG_GRAPHICS_API Format getSrgbFormat(Format format);
+
+/**
+ * @brief      Parses a KTX2 file, the data of the levels is not copied.
+ *
+ * @param[in]  data   The content of the file.
+ * @param[in]  size   The size of the file.
+ * @param[out] image  The description of the image.
+ */
+LUG_GRAPHICS_API Result read(const uint8_t* data, size_t size, Image& image);
+
+/**
+ * @brief      Writes a KTX2 file of a 2D texture or a cube map, without supercompression.
+ *
+ * @param[in]  format      The format of the levels, RGBA8, the half floats or BC1 to BC5.
+ * @param[in]  width       The width of the first level.
+ * @param[in]  height      The height of the first level.
+ * @param[in]  facesCount  6 for a cube map, 1 otherwise.
+ * @param[in]  levels      The data of the levels, the first level is the largest. The faces of a level are one after the other.
+ * @param[out] file        The content of the file.
+ *
+ * @return     Whether the file has been written, false if the format is not supported or a level has a wrong size.
+ */
+LUG_GRAPHICS_API bool write(Format format, uint32_t width, uint32_t height, uint32_t facesCount, const std::vector<std::vector<uint8_t>>& levels, std::vector<uint8_t>& file);
+
+/**
+ * @brief      Writes a KTX2 file of a 2D texture, see the function above.
+ */
+LUG_GRAPHICS_API bool write(Format format, uint32_t width, uint32_t height, const std::vector<std::vector<uint8_t>>& levels, std::vector<uint8_t>& file);
+
+/**
+ * @brief      Returns the size of one image (layer and face) of a level.
+ */
+LUG_GRAPHICS_API size_t getImageSize(const FormatInfo& info, uint32_t width, uint32_t height);
+
+LUG_GRAPHICS_API const char* toString(Result result);
+
+} // Ktx2
+
+} // Render
+} // Graphics
+} // lug
@@ -56,7 +56,12 @@ public:
 
     virtual ~Material() = default;
 
-    // TODO: Setters which call ::lug::Graphics::Render::DirtyObject::setDirty()
+    void setBaseColor(const Math::Vec4f& baseColor);
+    void setEmissive(const Math::Vec3f& emissive);
+    void setMetallic(float metallic);
+    void setRoughness(float roughness);
+    void setNormalTextureScale(float normalTextureScale);
+    void setOcclusionTextureStrength(float occlusionTextureStrength);
 
     const Constants& getConstants() const;
 
@@ -1,3 +1,33 @@
+inline void Material::setBaseColor(const Math::Vec4f& baseColor) {
+    ::lug::Graphics::Render::DirtyObject::setDirty();
+    _constants.baseColor = baseColor;
+}
+
+inline void Material::setEmissive(const Math::Vec3f& emissive) {
+    ::lug::Graphics::Render::DirtyObject::setDirty();
+    _constants.emissive = emissive;
+}
+
+inline void Material::setMetallic(float metallic) {
+    ::lug::Graphics::Render::DirtyObject::setDirty();
+    _constants.metallic = metallic;
+}
+
+inline void Material::setRoughness(float roughness) {
+    ::lug::Graphics::Render::DirtyObject::setDirty();
+    _constants.roughness = roughness;
+}
+
+inline void Material::setNormalTextureScale(float normalTextureScale) {
+    ::lug::Graphics::Render::DirtyObject::setDirty();
+    _constants.normalTextureScale = normalTextureScale;
+}
+
+inline void Material::setOcclusionTextureStrength(float occlusionTextureStrength) {
+    ::lug::Graphics::Render::DirtyObject::setDirty();
+    _constants.occlusionTextureStrength = occlusionTextureStrength;
+}
+
 inline const Material::Constants& Material::getConstants() const {
     return _constants;
 }
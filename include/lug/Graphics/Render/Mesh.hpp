@@ -39,8 +39,19 @@ public:
                 TexCoord,   ///< UV (VEC2<FLOAT>)
                 Tangent,    ///< Tangent (VEC4<FLOAT> w component is a sign value (-1 or +1) indicating handedness of the tangent basis)
                 Color,      ///< Color (VEC4<FLOAT>)
+                Joints,     ///< Indices of the joints of the skin (VEC4<UNSIGNED_SHORT>)
+                Weights,    ///< Weights of the joints of the skin (VEC4<FLOAT>)
             } type;
 
+            /**
+             * @brief      Storage of the components, see Builder::Mesh::setCompressVertices.
+             */
+            enum class Format : uint8_t {
+                Float,      ///< As described by the type
+                Half,       ///< Position (VEC4<HALF> w component is padding)
+                Oct16,      ///< Normal (VEC2<SNORM16>) @see Math::Packing::encodeOctahedral
+            } format{Format::Float};
+
             /**
              * @brief      Access to the data of the attribute.
              */
@@ -73,6 +84,8 @@ public:
         std::vector<Attribute*> texCoords{};
         std::vector<Attribute*> colors{};
         Attribute* tangent{nullptr};
+        Attribute* joints{nullptr};
+        Attribute* weights{nullptr};
 
         Resource::SharedPtr<Material> material{nullptr};
 
@@ -90,11 +103,26 @@ public:
 
     const std::vector<Mesh::PrimitiveSet>& getPrimitiveSets() const;
 
+    /**
+     * @brief      Returns the center of the bounding sphere of the positions, in the space of the mesh.
+     */
+    const Math::Vec3f& getBoundingCenter() const;
+    float getBoundingRadius() const;
+
 protected:
     explicit Mesh(const std::string& name);
 
+    /**
+     * @brief      Computes the bounding sphere of the positions of the primitive sets.
+     *             The center is the center of their bounding box.
+     */
+    void computeBoundingSphere();
+
 protected:
     std::vector<PrimitiveSet> _primitiveSets;
+
+    Math::Vec3f _boundingCenter{Math::Vec3f(0.0f)};
+    float _boundingRadius{0.0f};
 };
 
 #include <lug/Graphics/Render/Mesh.inl>
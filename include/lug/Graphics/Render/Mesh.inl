@@ -1,3 +1,11 @@
 inline const std::vector<Mesh::PrimitiveSet>& Mesh::getPrimitiveSets() const {
     return _primitiveSets;
 }
+
+inline const Math::Vec3f& Mesh::getBoundingCenter() const {
+    return _boundingCenter;
+}
+
+inline float Mesh::getBoundingRadius() const {
+    return _boundingRadius;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <lug/Graphics/Export.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+
+/**
+ * @brief      CPU generation of the mip chains of RGBA8 images.
+ *             Used when the GPU can't blit the texture format (or the queue can't blit at all).
+ *
+ *             The levels of a chain are tightly packed one after the other, starting with the
+ *             full resolution image, so that the whole chain can be uploaded with one copy.
+ */
+namespace Mipmap {
+
+enum class Filter : uint8_t {
+    Box,    // 2x2 average, vectorized with SSE2 when available. Odd sizes drop the last row/column.
+    Kaiser  // Kaiser windowed sinc, sharper and correct for odd sizes but slower
+};
+
+struct Level {
+    uint32_t width;
+    uint32_t height;
+    size_t offset;
+    size_t size;
+};
+
+/**
+ * @brief      Returns the number of levels of the full chain of an image (down to 1x1).
+ */
+LUG_GRAPHICS_API uint32_t getLevelsCount(uint32_t width, uint32_t height);
+
+/**
+ * @brief      Returns the layout of a chain of RGBA8 levels.
+ *
+ * @param[in]  width        The width of the first level.
+ * @param[in]  height       The height of the first level.
+ * @param[in]  levelsCount  The number of levels, 0 or a too high count means the full chain.
+ */
+LUG_GRAPHICS_API std::vector<Level> getLevels(uint32_t width, uint32_t height, uint32_t levelsCount = 0);
+
+/**
+ * @brief      Downsamples an RGBA8 image to the size of its next level, max(1, size / 2).
+ *
+ * @param[in]  src        The source pixels.
+ * @param[in]  srcWidth   The source width.
+ * @param[in]  srcHeight  The source height.
+ * @param      dst        The destination pixels, of the size of the next level.
+ * @param[in]  filter     The filter.
+ */
+LUG_GRAPHICS_API void downsample(const uint8_t* src, uint32_t srcWidth, uint32_t srcHeight, uint8_t* dst, Filter filter = Filter::Box);
+
+/**
+ * @brief      Generates the levels of a chain from its first level.
+ *
+ * @param      chain   The chain, the first level must be filled.
+ * @param[in]  levels  The layout of the chain, as returned by getLevels.
+ * @param[in]  filter  The filter.
+ */
+LUG_GRAPHICS_API void generate(uint8_t* chain, const std::vector<Level>& levels, Filter filter = Filter::Box);
+
+} // Mipmap
+
+} // Render
+} // Graphics
+} // lug
@@ -23,7 +23,13 @@ public:
 
     ~Queue() = default;
 
-    virtual void addMeshInstance(Scene::Node& node) = 0;
+    /**
+     * @brief      Adds the primitive sets of the mesh instance of a node.
+     *
+     * @param      node       The node.
+     * @param[in]  footprint  The size of the mesh instance on the screen, in pixels, used to stream its textures.
+     */
+    virtual void addMeshInstance(Scene::Node& node, float footprint) = 0;
     virtual void addLight(Scene::Node& node) = 0;
     virtual void addSkyBox(Resource::SharedPtr<Render::SkyBox> skyBox) = 0;
     virtual void clear() = 0;
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+#include <lug/Graphics/Export.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+
+/**
+ * @brief      Allocates the offsets of a ring buffer shared by the frames in flight.
+ *
+ *             The allocations of a frame are never freed individually: the whole frame is released
+ *             once the GPU is done with it (i.e. after waiting its fence). The frames may be released
+ *             in any order, but the space of a frame is only reused when all the frames recorded
+ *             before it are released too, so that the used space is always contiguous.
+ *
+ *             This class only manages the offsets, the memory is owned by the user.
+ */
+class LUG_GRAPHICS_API RingAllocator {
+public:
+    /**
+     * @brief      Constructs the allocator.
+     *
+     * @param[in]  size       The size of the ring, in bytes.
+     * @param[in]  alignment  The alignment of the offsets, must be a power of two.
+     */
+    RingAllocator(size_t size = 0, size_t alignment = 1);
+
+    RingAllocator(const RingAllocator&) = delete;
+    RingAllocator(RingAllocator&&) = default;
+
+    RingAllocator& operator=(const RingAllocator&) = delete;
+    RingAllocator& operator=(RingAllocator&&) = default;
+
+    ~RingAllocator() = default;
+
+    /**
+     * @brief      Allocates a contiguous range for the frame being recorded.
+     *
+     * @param[in]  size    The size of the range.
+     * @param      offset  The offset of the range.
+     *
+     * @return     Whether the allocation succeeded, it fails if the ring is full.
+     */
+    bool allocate(size_t size, size_t& offset);
+
+    /**
+     * @brief      Ends the frame being recorded, its allocations are in use until it is released.
+     *
+     * @param[in]  frameIndex  The index of the frame (e.g. the index of its swapchain image).
+     */
+    void endFrame(uint32_t frameIndex);
+
+    /**
+     * @brief      Releases the allocations of the ended frames with this index.
+     *             Must be called once the GPU is done with them.
+     *
+     * @param[in]  frameIndex  The index of the frame.
+     */
+    void releaseFrame(uint32_t frameIndex);
+
+    size_t getSize() const;
+    size_t getUsedSize() const;
+
+private:
+    struct Frame {
+        uint32_t index;
+        size_t usedSize;
+        bool released;
+    };
+
+private:
+    size_t _size;
+    size_t _alignment;
+
+    size_t _head{0};
+
+    // Including the padding and the end of the ring skipped when wrapping around
+    size_t _usedSize{0};
+    size_t _frameUsedSize{0};
+
+    // Ended frames in the order of recording
+    std::deque<Frame> _frames;
+};
+
+} // Render
+} // Graphics
+} // lug
@@ -30,8 +30,27 @@ public:
 
     const Resource::SharedPtr<lug::Graphics::Render::Texture> getTexture() const;
 
+    /**
+     * @brief      Returns the textures of the image-based lighting of the skybox.
+     *             They are null if the skybox doesn't light the scene.
+     *
+     * @see        lug::Graphics::Render::Ibl
+     */
+    const Resource::SharedPtr<lug::Graphics::Render::Texture> getIrradianceMap() const;
+    const Resource::SharedPtr<lug::Graphics::Render::Texture> getSpecularMap() const;
+    const Resource::SharedPtr<lug::Graphics::Render::Texture> getBrdfLut() const;
+
+    /**
+     * @brief      Returns whether the skybox has the textures of the image-based lighting.
+     */
+    bool hasEnvironment() const;
+
 protected:
     lug::Graphics::Resource::SharedPtr<lug::Graphics::Render::Texture> _texture;
+
+    lug::Graphics::Resource::SharedPtr<lug::Graphics::Render::Texture> _irradianceMap;
+    lug::Graphics::Resource::SharedPtr<lug::Graphics::Render::Texture> _specularMap;
+    lug::Graphics::Resource::SharedPtr<lug::Graphics::Render::Texture> _brdfLut;
 };
 
 #include <lug/Graphics/Render/SkyBox.inl>
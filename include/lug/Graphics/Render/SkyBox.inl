@@ -1,3 +1,19 @@
 inline const lug::Graphics::Resource::SharedPtr<lug::Graphics::Render::Texture> SkyBox::getTexture() const {
     return _texture;
 }
+
+inline const lug::Graphics::Resource::SharedPtr<lug::Graphics::Render::Texture> SkyBox::getIrradianceMap() const {
+    return _irradianceMap;
+}
+
+inline const lug::Graphics::Resource::SharedPtr<lug::Graphics::Render::Texture> SkyBox::getSpecularMap() const {
+    return _specularMap;
+}
+
+inline const lug::Graphics::Resource::SharedPtr<lug::Graphics::Render::Texture> SkyBox::getBrdfLut() const {
+    return _brdfLut;
+}
+
+inline bool SkyBox::hasEnvironment() const {
+    return _irradianceMap && _specularMap && _brdfLut;
+}
@@ -28,6 +28,15 @@ public:
         Repeat
     };
 
+    /**
+     * @brief      Encoding of the colors of the texture.
+     *             The sRGB textures are decoded to linear by the sampler.
+     */
+    enum class ColorSpace : uint8_t {
+        Linear, // Data (normals, metallic / roughness, occlusion, ...)
+        sRGB    // Colors (base color, emissive, ...)
+    };
+
 public:
     Texture(const std::string& name);
 
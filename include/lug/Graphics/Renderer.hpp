@@ -24,6 +24,11 @@ public:
     struct InitInfo {
         std::string shadersRoot;
         Render::Technique::Type renderTechnique;
+        uint64_t memoryBudget;      ///< GPU memory budget of the streamed resources in bytes, 0 to query it from the device
+        bool hotReload;             ///< Reload the shaders and the files of the resources when they are modified
+        bool bindless;              ///< Index the textures of the materials in a single array of descriptors if the device supports it
+        bool textureStreaming;      ///< Stream the mip levels of the textures of the loaded files from the size of the objects on the screen
+        uint32_t maxLoadsPerFrame;  ///< Maximum number of asynchronous loads whose resources are created in a frame, 0 for no limit
     };
 
 public:
@@ -46,6 +51,12 @@ public:
     virtual Render::Window* createWindow(Render::Window::InitInfo& initInfo) = 0;
     virtual Render::Window* getWindow() = 0;
 
+    /**
+     * @brief      Called by ResourceManager::remove before the resource is destroyed,
+     *             to release what the renderer keeps for it.
+     */
+    virtual void onResourceRemoved(const Resource& resource);
+
     const InitInfo& getInfo() const;
     Type getType() const;
 
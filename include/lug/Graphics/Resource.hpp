@@ -30,7 +30,9 @@ public:
         Texture,    ///< A texture
         Pipeline,   ///< A graphical pipeline
         Camera,     ///< A camera
-        SkyBox      ///< A skyBox
+        SkyBox,     ///< A skyBox
+        Skeleton,   ///< A skeleton, i.e. the joints of a skin
+        Clip        ///< An animation clip
     };
 
     /**
@@ -183,7 +185,7 @@ public:
     const std::string& getName() const;
 
     /**
-     * @brief      Sets the name of the Resource.
+     * @brief      Sets the name of the Resource, and updates the name index of its ResourceManager.
      *
      * @param[in]  name  The name
      */
@@ -194,6 +196,7 @@ protected:
 
 private:
     Handle _handle;
+    ResourceManager* _manager{nullptr};
 };
 
 #include <lug/Graphics/Resource.inl>
@@ -137,7 +137,3 @@ inline Resource::Handle Resource::getHandle() const {
 inline const std::string& Resource::getName() const {
     return _name;
 }
-
-inline void Resource::setName(const std::string &name) {
-    _name = name;
-}
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Resource.hpp>
+
+namespace lug {
+namespace Graphics {
+
+/**
+ * @brief      Class for resource budget.
+ *             The ResourceBudget keeps track of the GPU memory used by the resources it is given
+ *             and evicts the least recently used ones when the budget is exceeded. A resource
+ *             is only evicted if it has not been used for at least #getEvictionDelay frames,
+ *             and it is reloaded on demand the next time it is used.
+ *
+ *             The actual size, eviction and reloading of the resources are delegated to a
+ *             ResourceBudget::Provider, usually implemented by the Renderer.
+ */
+class LUG_GRAPHICS_API ResourceBudget {
+public:
+    /**
+     * @brief      Interface between the budget and the resources it tracks.
+     */
+    class LUG_GRAPHICS_API Provider {
+    public:
+        Provider() = default;
+
+        Provider(const Provider&) = delete;
+        Provider(Provider&&) = delete;
+
+        Provider& operator=(const Provider&) = delete;
+        Provider& operator=(Provider&&) = delete;
+
+        virtual ~Provider() = default;
+
+        /**
+         * @brief      Returns the size of a resource, in bytes.
+         * @param[in]  handle  The handle of the resource.
+         */
+        virtual uint64_t getResourceSize(Resource::Handle handle) const = 0;
+
+        /**
+         * @brief      Frees the GPU memory of a resource, keeping what is needed to reload it.
+         * @param[in]  handle  The handle of the resource.
+         * @return     @p true if the resource has been evicted.
+         */
+        virtual bool evictResource(Resource::Handle handle) = 0;
+
+        /**
+         * @brief      Reloads a resource previously evicted.
+         * @param[in]  handle  The handle of the resource.
+         * @return     @p true if the resource has been reloaded.
+         */
+        virtual bool reloadResource(Resource::Handle handle) = 0;
+    };
+
+    struct Stats {
+        uint64_t budget;                ///< The budget, in bytes (0 means unlimited).
+        uint64_t usage;                 ///< The size of the resident resources, in bytes.
+        uint32_t residentCount;         ///< The number of resident resources.
+        uint32_t evictedCount;          ///< The number of evicted resources.
+        uint64_t evictions;             ///< The number of evictions since the creation of the budget.
+        uint64_t reloads;               ///< The number of reloads since the creation of the budget.
+    };
+
+public:
+    ResourceBudget() = default;
+
+    ResourceBudget(const ResourceBudget&) = delete;
+    ResourceBudget(ResourceBudget&&) = delete;
+
+    ResourceBudget& operator=(const ResourceBudget&) = delete;
+    ResourceBudget& operator=(ResourceBudget&&) = delete;
+
+    ~ResourceBudget() = default;
+
+    /**
+     * @brief      Sets the provider. Nothing is tracked while there is no provider.
+     */
+    void setProvider(Provider* provider);
+    Provider* getProvider() const;
+
+    /**
+     * @brief      Sets the budget, in bytes. 0 disables the eviction.
+     */
+    void setBudget(uint64_t budget);
+    uint64_t getBudget() const;
+
+    /**
+     * @brief      Sets the number of frames a resource must stay unused before being evictable.
+     *             The Vulkan renderer sets it to its number of frames in flight each frame.
+     */
+    void setEvictionDelay(uint32_t frames);
+    uint32_t getEvictionDelay() const;
+
+    uint64_t getUsage() const;
+    uint64_t getFrame() const;
+    Stats getStats() const;
+
+    /**
+     * @brief      Starts tracking a resident resource. The size is queried from the provider.
+     * @param[in]  handle  The handle of the resource.
+     * @return     @p true if the resource is tracked.
+     */
+    bool track(Resource::Handle handle);
+
+    /**
+     * @brief      Stops tracking a resource, e.g. before destroying it.
+     * @param[in]  handle  The handle of the resource.
+     */
+    void untrack(Resource::Handle handle);
+
+    bool isTracked(Resource::Handle handle) const;
+    bool isResident(Resource::Handle handle) const;
+
+    /**
+     * @brief      Marks a resource as used by the current frame, reloading it if it was evicted.
+     *             Resources not tracked yet start being tracked.
+     * @param[in]  handle  The handle of the resource.
+     * @return     @p false if the resource was evicted and can't be reloaded.
+     */
+    bool use(Resource::Handle handle);
+
+    /**
+     * @brief      Ends the current frame and evicts the least recently used resources
+     *             until the usage fits in the budget.
+     * @return     @p false if the usage still exceeds the budget.
+     */
+    bool nextFrame();
+
+    /**
+     * @brief      Evicts the least recently used resources until the usage fits in the budget.
+     * @return     @p false if the usage still exceeds the budget.
+     */
+    bool enforce();
+
+private:
+    struct Entry {
+        uint64_t size;
+        uint64_t lastUsedFrame;
+        bool resident;
+        std::list<uint32_t>::iterator lruIt;  ///< Position in _lru, only valid if resident
+    };
+
+private:
+    Provider* _provider{nullptr};
+
+    uint64_t _budget{0};
+    uint64_t _usage{0};
+    uint32_t _evictionDelay{3};
+    uint64_t _frame{0};
+
+    uint64_t _evictions{0};
+    uint64_t _reloads{0};
+
+    std::unordered_map<uint32_t, Entry> _entries;
+
+    /**
+     * The resident resources, from the most recently used to the least recently used.
+     */
+    std::list<uint32_t> _lru;
+};
+
+#include <lug/Graphics/ResourceBudget.inl>
+
+} // Graphics
+} // lug
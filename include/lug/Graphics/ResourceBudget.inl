@@ -0,0 +1,40 @@
+inline void ResourceBudget::setProvider(Provider* provider) {
+    _provider = provider;
+}
+
+inline ResourceBudget::Provider* ResourceBudget::getProvider() const {
+    return _provider;
+}
+
+inline void ResourceBudget::setBudget(uint64_t budget) {
+    _budget = budget;
+}
+
+inline uint64_t ResourceBudget::getBudget() const {
+    return _budget;
+}
+
+inline void ResourceBudget::setEvictionDelay(uint32_t frames) {
+    _evictionDelay = frames;
+}
+
+inline uint32_t ResourceBudget::getEvictionDelay() const {
+    return _evictionDelay;
+}
+
+inline uint64_t ResourceBudget::getUsage() const {
+    return _usage;
+}
+
+inline uint64_t ResourceBudget::getFrame() const {
+    return _frame;
+}
+
+inline bool ResourceBudget::isTracked(Resource::Handle handle) const {
+    return _entries.find(handle.value) != _entries.end();
+}
+
+inline bool ResourceBudget::isResident(Resource::Handle handle) const {
+    const auto it = _entries.find(handle.value);
+    return it == _entries.end() || it->second.resident;
+}
@@ -1,12 +1,17 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
+#include <lug/Graphics/AsyncLoader.hpp>
 #include <lug/Graphics/Export.hpp>
 #include <lug/Graphics/Loader.hpp>
 #include <lug/Graphics/Resource.hpp>
+#include <lug/Graphics/ResourceBudget.hpp>
+#include <lug/Graphics/TextureStreamer.hpp>
+#include <lug/System/FileWatcher.hpp>
 
 namespace lug {
 namespace Graphics {
@@ -20,6 +25,8 @@ class Renderer;
  *             by the Graphics instance, and retrievable by #Graphics::getResourceManager()
  */
 class LUG_GRAPHICS_API ResourceManager {
+    friend class Resource;
+
 public:
     /**
      * @brief      Constructs a ResourceManager, from a Renderer instance.
@@ -45,6 +52,25 @@ public:
     template <typename T = Resource>
     Resource::SharedPtr<T> get(Resource::Handle handle);
 
+    /**
+     * @brief      Retrieve a resource from the ResourceManager by name.
+     *             The resources are indexed by name when they are added, and again when they are
+     *             renamed with Resource::setName.
+     * @param[in]  name  The name of the resource.
+     * @tparam     T     The type of the resource, the first resource of this name that is a T is returned.
+     * @return     The resource, nullptr if not found.
+     */
+    template <typename T = Resource>
+    Resource::SharedPtr<T> get(const std::string& name);
+
+    /**
+     * @brief      Retrieve a resource previously loaded from a file with #loadFile or #loadFileAsync.
+     *             If the file has been loaded several times, the first resource is returned.
+     * @param[in]  filename  The filename used to load the resource.
+     * @return     The resource, nullptr if this file has not been loaded.
+     */
+    Resource::SharedPtr<Resource> getFile(const std::string& filename);
+
     /**
      * @brief      Add a resource to the ResourceManager.
      * @param[in]  resource The resource to add resource.
@@ -55,6 +81,15 @@ public:
     template <typename T = Resource>
     Resource::SharedPtr<T> add(std::unique_ptr<Resource> resource);
 
+    /**
+     * @brief      Destroys a resource and removes it from the indexes. The handles are never reused,
+     *             so the ones of the removed resource stay invalid. The resource must not be used
+     *             anymore, by the device either.
+     *
+     * @param[in]  handle  The handle of the resource.
+     */
+    void remove(Resource::Handle handle);
+
     /**
      * @brief      Loads a resource from a file.
      *
@@ -65,16 +100,152 @@ public:
      */
     Resource::SharedPtr<Resource> loadFile(const std::string& filename);
 
+    /**
+     * @brief      Loads a resource from a file asynchronously.
+     *             The file is read by a loader thread, then the resource is created during the next
+     *             call to #integrateLoads.
+     *
+     * @param[in]  filename  The filename of the file to load the resource from. The used Loader
+     *             is determined by the extension of the file, so it must be present!
+     * @param[in]  priority  The priority of the load, higher is loaded first.
+     *
+     * @return     The ticket of the load, to poll its status or cancel it, nullptr on failure.
+     */
+    std::shared_ptr<AsyncLoader::Ticket> loadFileAsync(const std::string& filename, int32_t priority = 0);
+
+    /**
+     * @brief      Loads a file again asynchronously, to hot reload the resource loaded from it.
+     *             Unlike #loadFileAsync, the new resource doesn't replace the one returned by #getFile.
+     *
+     * @param[in]  filename        The filename of the file.
+     * @param[out] createdHandles  Filled with the handles of all the resources created by the load
+     *                             (e.g. the materials and textures of a scene), to #remove them.
+     *
+     * @return     The ticket of the load, to poll its status or cancel it, nullptr on failure.
+     */
+    std::shared_ptr<AsyncLoader::Ticket> reloadFileAsync(const std::string& filename, std::shared_ptr<std::vector<Resource::Handle>> createdHandles);
+
+    /**
+     * @brief      Creates the resources of the asynchronous loads read since the last call.
+     *             Must be called from the main thread, usually once per frame by the Renderer.
+     *
+     * @param[in]  maxLoads  The maximum number of loads to integrate, 0 for no limit.
+     *
+     * @return     The number of loads integrated.
+     */
+    uint32_t integrateLoads(uint32_t maxLoads = 0);
+
+    /**
+     * @brief      Returns the asynchronous loader, created on first use.
+     *             Can be used to run other tasks than file loads, like shader compilation.
+     *
+     * @return     The asynchronous loader.
+     */
+    AsyncLoader& getAsyncLoader();
+
+    /**
+     * @brief      Starts watching the files of the resources, to reload them when they are modified.
+     *             Only the files loaded after this call are watched.
+     *
+     * @return     Whether the files can be watched on this system.
+     */
+    bool enableHotReload();
+    bool isHotReloadEnabled() const;
+
+    /**
+     * @brief      Watches a file used to create a resource. Does nothing if hot reload is disabled.
+     *
+     * @param[in]  filename  The filename.
+     * @param[in]  handle    The handle of the resource to reload when the file is modified.
+     */
+    void watchFile(const std::string& filename, Resource::Handle handle);
+
+    /**
+     * @brief      Watches a directory, its modified files will be returned by #pollModifiedFiles
+     *             even if no resource depends on them. Does nothing if hot reload is disabled.
+     *
+     * @param[in]  directory  The directory.
+     */
+    void watchDirectory(const std::string& directory);
+
+    /**
+     * @brief      Returns the watched files modified since the last call.
+     *
+     * @return     The filenames.
+     */
+    std::vector<std::string> pollModifiedFiles();
+
+    /**
+     * @brief      Returns the resources to reload when a file is modified.
+     *
+     * @param[in]  filename  The filename.
+     *
+     * @return     The handles of the resources.
+     */
+    std::vector<Resource::Handle> getWatchingResources(const std::string& filename) const;
+
+    /**
+     * @brief      Returns the GPU memory budget of the streamed resources.
+     *
+     * @return     The budget.
+     */
+    ResourceBudget& getBudget();
+    const ResourceBudget& getBudget() const;
+
+    /**
+     * @brief      Returns the streamer of the mip levels of the streamed textures.
+     *
+     * @return     The texture streamer.
+     */
+    TextureStreamer& getTextureStreamer();
+    const TextureStreamer& getTextureStreamer() const;
+
 private:
     Renderer& _renderer;
     std::vector<std::unique_ptr<Resource>> _resources;
 
+    /**
+     * Index of the resources by name. Several resources can share the same name (e.g. a mesh
+     * and its material), so a name maps to all the corresponding handles, in order of addition.
+     */
+    std::unordered_map<std::string, std::vector<Resource::Handle>> _resourcesByName;
+
+    /**
+     * Index of the resources loaded from a file, by filename.
+     */
+    std::unordered_map<std::string, Resource::Handle> _resourcesByFilename;
+
+    ResourceBudget _budget;
+    TextureStreamer _textureStreamer;
+
     /**
      * The list of the available loaders. The string is the extension of the file, and the
      * pointer is the corresponding loader. The implementation will determine which loader to
      * call in loadFile thanks to this map.
      */
     std::unordered_map<std::string, std::unique_ptr<Loader>> _loaders;
+
+    /**
+     * Created on the first asynchronous load, it must be destroyed before the loaders.
+     */
+    std::unique_ptr<AsyncLoader> _asyncLoader{nullptr};
+
+    /**
+     * Only created when hot reload is enabled.
+     */
+    std::unique_ptr<System::FileWatcher> _fileWatcher{nullptr};
+    std::unordered_map<std::string, std::vector<Resource::Handle>> _watchingResources;
+
+private:
+    Loader* getLoader(const std::string& filename);
+    void addFile(const std::string& filename, Resource::Handle handle);
+
+    /**
+     * @brief      Moves a resource to its new name in the index, called by Resource::setName.
+     *             It is after the resources already having this name.
+     */
+    void rename(Resource& resource, const std::string& name);
+    void removeName(const std::string& name, Resource::Handle handle);
 };
 
 #include <lug/Graphics/ResourceManager.inl>
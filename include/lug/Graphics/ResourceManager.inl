@@ -5,7 +5,8 @@ Resource::SharedPtr<T> ResourceManager::get(Resource::Handle handle) {
         "T must inherit from Resource"
     );
 
-    if (_resources.size() <= handle.index) {
+    // The slots of the removed resources are empty
+    if (_resources.size() <= handle.index || !_resources[handle.index]) {
         return nullptr;
     }
 
@@ -16,6 +17,29 @@ Resource::SharedPtr<T> ResourceManager::get(Resource::Handle handle) {
     return nullptr;
 }
 
+template <typename T>
+Resource::SharedPtr<T> ResourceManager::get(const std::string& name) {
+    static_assert(
+        std::is_base_of<Resource, T>::value,
+        "T must inherit from Resource"
+    );
+
+    const auto it = _resourcesByName.find(name);
+    if (it == _resourcesByName.end()) {
+        return nullptr;
+    }
+
+    for (const Resource::Handle handle : it->second) {
+        T* resource = dynamic_cast<T*>(_resources[handle.index].get());
+
+        if (resource) {
+            return resource;
+        }
+    }
+
+    return nullptr;
+}
+
 template <typename T>
 Resource::SharedPtr<T> ResourceManager::add(std::unique_ptr<Resource> resource) {
     static_assert(
@@ -24,7 +48,29 @@ Resource::SharedPtr<T> ResourceManager::add(std::unique_ptr<Resource> resource)
     );
 
     resource->_handle.index = _resources.size();
+    resource->_manager = this;
+    _resourcesByName[resource->getName()].push_back(resource->_handle);
     _resources.push_back(std::move(resource));
 
     return dynamic_cast<T*>(_resources.back().get());
 }
+
+inline bool ResourceManager::isHotReloadEnabled() const {
+    return _fileWatcher != nullptr;
+}
+
+inline ResourceBudget& ResourceManager::getBudget() {
+    return _budget;
+}
+
+inline const ResourceBudget& ResourceManager::getBudget() const {
+    return _budget;
+}
+
+inline TextureStreamer& ResourceManager::getTextureStreamer() {
+    return _textureStreamer;
+}
+
+inline const TextureStreamer& ResourceManager::getTextureStreamer() const {
+    return _textureStreamer;
+}
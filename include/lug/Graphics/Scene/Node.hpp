@@ -3,6 +3,7 @@
 #include <memory>
 #include <vector>
 #include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Animation/Animator.hpp>
 #include <lug/Graphics/Node.hpp>
 #include <lug/Graphics/Render/Camera/Camera.hpp>
 #include <lug/Graphics/Render/DirtyObject.hpp>
@@ -44,6 +45,14 @@ public:
 
     virtual ~Node() = default;
 
+    /**
+     * @brief      Returns the node with the given name in the subtree of this node.
+     *             Uses the name index of the scene when this node is attached to the scene graph.
+     *
+     * @param[in]  name  The name of the node.
+     *
+     * @return     The node, nullptr if not found.
+     */
     Node* getNode(const std::string& name);
     const Node* getNode(const std::string& name) const;
     Scene& getScene();
@@ -51,10 +60,41 @@ public:
 
     Node* createSceneNode(const std::string& name);
 
+    /**
+     * @brief      Attaches a child to this node, it is detached from its previous parent.
+     *             If this node is attached to the scene graph, the child and its subtree are
+     *             indexed by name in the scene, otherwise they are removed from the index.
+     *
+     * @param      child  The child.
+     */
+    void attachChild(Node& child);
+
+    /**
+     * @brief      Detaches a child from this node.
+     *             The child and its subtree are removed from the name index of the scene.
+     *
+     * @param      child  The child.
+     */
+    void detachChild(Node& child);
+
+    /**
+     * @brief      Returns whether the node is attached to the scene graph, i.e. the root of the
+     *             scene is one of its ancestors.
+     */
+    bool isAttached() const;
+
     void attachLight(Resource::SharedPtr<Render::Light> light);
     void attachMeshInstance(Resource::SharedPtr<Render::Mesh> mesh, Resource::SharedPtr<Render::Material> material = nullptr);
     void attachCamera(Resource::SharedPtr<Render::Camera::Camera> camera);
 
+    /**
+     * @brief      Attaches the animator of the skin of the mesh instance.
+     *             The vertices are skinned by its palette, which replaces the transform of the joints nodes.
+     *
+     * @param[in]  animator  The animator, nullptr to detach it.
+     */
+    void attachAnimator(std::unique_ptr<Animation::Animator> animator);
+
     Render::Light* getLight();
     const Render::Light* getLight() const;
 
@@ -63,16 +103,38 @@ public:
     Render::Camera::Camera* getCamera();
     const Render::Camera::Camera* getCamera() const;
 
+    Animation::Animator* getAnimator();
+    const Animation::Animator* getAnimator() const;
+
+    /**
+     * @brief      Updates the animators of this node and of its subtree.
+     *
+     * @param[in]  elapsedTime  The time elapsed since the last update.
+     */
+    void updateAnimators(const System::Time& elapsedTime);
+
     void fetchVisibleObjects(const Render::View& renderView, const Render::Camera::Camera& camera, Render::Queue& renderQueue) const;
 
     virtual void needUpdate() override;
 
+private:
+    bool isDescendantOf(const Node& node) const;
+
+    /**
+     * @brief      Returns the size of the mesh instance on the screen, in pixels.
+     *             The mesh is approximated by its bounding sphere.
+     */
+    float getFootprint(const Render::View& renderView, const Render::Camera::Camera& camera) const;
+
 private:
     Scene &_scene;
 
+    bool _attached{false};
+
     Resource::SharedPtr<Render::Light> _light{nullptr};
     MeshInstance _meshInstance;
     Resource::SharedPtr<Render::Camera::Camera> _camera{nullptr};
+    std::unique_ptr<Animation::Animator> _animator{nullptr};
 };
 
 #include <lug/Graphics/Scene/Node.inl>
@@ -1,11 +1,3 @@
-inline Node* Node::getNode(const std::string& name) {
-    return static_cast<Node*>(::lug::Graphics::Node::getNode(name));
-}
-
-inline const Node* Node::getNode(const std::string& name) const {
-    return static_cast<const Node*>(::lug::Graphics::Node::getNode(name));
-}
-
 inline Scene& Node::getScene() {
     return _scene;
 }
@@ -14,6 +6,10 @@ inline const Scene& Node::getScene() const {
     return _scene;
 }
 
+inline bool Node::isAttached() const {
+    return _attached;
+}
+
 inline Render::Light* Node::getLight() {
     return _light.get();
 }
@@ -33,3 +29,11 @@ inline Render::Camera::Camera* Node::getCamera() {
 inline const Render::Camera::Camera* Node::getCamera() const {
     return _camera.get();
 }
+
+inline Animation::Animator* Node::getAnimator() {
+    return _animator.get();
+}
+
+inline const Animation::Animator* Node::getAnimator() const {
+    return _animator.get();
+}
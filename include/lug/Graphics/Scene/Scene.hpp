@@ -2,6 +2,8 @@
 
 #include <list>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <lug/Graphics/Export.hpp>
 #include <lug/Graphics/Render/Light.hpp>
@@ -29,6 +31,7 @@ namespace Scene {
 
 class LUG_GRAPHICS_API Scene : public Resource {
     friend class Builder::Scene;
+    friend class Node;
 
 public:
     Scene() = default;
@@ -48,21 +51,52 @@ public:
     Node& getRoot();
     const Node& getRoot() const;
 
+    /**
+     * @brief      Returns the node attached to the scene graph with the given name.
+     *             The nodes are indexed by name when they are attached to the graph and removed
+     *             from the index when they are detached, the lookup is constant time. If several
+     *             nodes have the same name, the first attached is returned.
+     *
+     * @param[in]  name  The name of the node.
+     *
+     * @return     The node, nullptr if there is no node of this name in the scene graph.
+     */
     Node* getSceneNode(const std::string& name);
     const Node* getSceneNode(const std::string& name) const;
     const Resource::SharedPtr<Render::SkyBox> getSkyBox() const;
 
+    /**
+     * @brief      Updates the animators of the nodes attached to the scene graph, see Node::attachAnimator.
+     *
+     * @param[in]  elapsedTime  The time elapsed since the last update.
+     */
+    void updateAnimators(const System::Time& elapsedTime);
+
     void fetchVisibleObjects(const Render::View& renderView, const Render::Camera::Camera& camera, Render::Queue& renderQueue) const;
 
 private:
     Scene(const std::string& name);
 
+    /**
+     * @brief      Indexes a node and its children, called when they are attached to the scene graph.
+     */
+    void registerNode(Node& node);
+
+    /**
+     * @brief      Removes a node and its children from the index, called when they are detached from the scene graph.
+     */
+    void unregisterNode(Node& node);
+
 private:
     Node _root;
 
     Resource::SharedPtr<Render::SkyBox> _skyBox{nullptr};
 
     std::list<Node> _nodes;
+
+
+    // Nodes attached to the scene graph by name, in order of attachment
+    std::unordered_map<std::string, std::vector<Node*>> _nodesByName;
 };
 
 #include <lug/Graphics/Scene/Scene.inl>
@@ -0,0 +1,229 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Resource.hpp>
+
+namespace lug {
+namespace Graphics {
+
+/**
+ * @brief      Class for texture streaming.
+ *             The TextureStreamer decides which mip levels of the streamed textures are resident.
+ *             A streamed texture is first loaded from its base level, the first level not larger
+ *             than #getBaseSize, and the finer levels are requested each frame from the size
+ *             of the objects using the texture on the screen, see #request.
+ *
+ *             At the end of each frame, the finest missing levels are streamed in, by order of
+ *             the number of missing levels, as long as the usage fits in the budget. The levels
+ *             not requested for #getReleaseDelay frames are released.
+ *
+ *             The levels are loaded asynchronously by a TextureStreamer::Provider, usually
+ *             implemented by the Renderer, which calls #finishStream once they are resident.
+ */
+class LUG_GRAPHICS_API TextureStreamer {
+public:
+    /**
+     * @brief      Interface between the streamer and the textures it streams.
+     */
+    class LUG_GRAPHICS_API Provider {
+    public:
+        Provider() = default;
+
+        Provider(const Provider&) = delete;
+        Provider(Provider&&) = delete;
+
+        Provider& operator=(const Provider&) = delete;
+        Provider& operator=(Provider&&) = delete;
+
+        virtual ~Provider() = default;
+
+        /**
+         * @brief      Returns the size of the levels of a texture from a level to the last one, in bytes.
+         * @param[in]  handle      The handle of the texture.
+         * @param[in]  firstLevel  The first level.
+         */
+        virtual uint64_t getLevelsSize(Resource::Handle handle, uint32_t firstLevel) const = 0;
+
+        /**
+         * @brief      Starts replacing the levels of a texture by the levels from @p firstLevel.
+         *             TextureStreamer::finishStream must be called when it is done, even on failure.
+         * @param[in]  handle      The handle of the texture.
+         * @param[in]  firstLevel  The first level.
+         * @return     @p true if the stream has been started.
+         */
+        virtual bool streamLevels(Resource::Handle handle, uint32_t firstLevel) = 0;
+    };
+
+    struct Stats {
+        uint64_t budget;                ///< The budget, in bytes (0 means unlimited).
+        uint64_t usage;                 ///< The size of the resident and streaming levels, in bytes.
+        uint32_t texturesCount;         ///< The number of streamed textures.
+        uint32_t streamingCount;        ///< The number of textures being streamed.
+        uint64_t upgrades;              ///< The number of streams of finer levels since the creation of the streamer.
+        uint64_t downgrades;            ///< The number of streams of coarser levels since the creation of the streamer.
+    };
+
+public:
+    TextureStreamer() = default;
+
+    TextureStreamer(const TextureStreamer&) = delete;
+    TextureStreamer(TextureStreamer&&) = delete;
+
+    TextureStreamer& operator=(const TextureStreamer&) = delete;
+    TextureStreamer& operator=(TextureStreamer&&) = delete;
+
+    ~TextureStreamer() = default;
+
+    /**
+     * @brief      Sets the provider. Nothing is streamed while there is no provider.
+     */
+    void setProvider(Provider* provider);
+    Provider* getProvider() const;
+
+    /**
+     * @brief      Sets the budget of the streamed levels, in bytes. 0 disables the limit.
+     *             The base levels are always resident, even if they exceed the budget.
+     */
+    void setBudget(uint64_t budget);
+    uint64_t getBudget() const;
+
+    /**
+     * @brief      Sets the size of the base levels, in texels. 64 by default.
+     */
+    void setBaseSize(uint32_t baseSize);
+    uint32_t getBaseSize() const;
+
+    /**
+     * @brief      Sets the number of frames a level must stay unrequested before being released.
+     *             It must be at least the number of frames in flight.
+     */
+    void setReleaseDelay(uint32_t frames);
+    uint32_t getReleaseDelay() const;
+
+    /**
+     * @brief      Sets the maximum number of textures streamed at the same time.
+     */
+    void setMaxStreamingCount(uint32_t count);
+    uint32_t getMaxStreamingCount() const;
+
+    uint64_t getUsage() const;
+    uint64_t getFrame() const;
+    Stats getStats() const;
+
+    /**
+     * @brief      Returns the level needed to draw a texture on a given number of pixels.
+     *             The texture is assumed to be mapped once on the object.
+     *
+     * @param[in]  width        The width of the first level.
+     * @param[in]  height       The height of the first level.
+     * @param[in]  levelsCount  The number of levels.
+     * @param[in]  footprint    The size of the object on the screen, in pixels.
+     *
+     * @return     The finest level needed, in [0, levelsCount - 1].
+     */
+    static uint32_t getRequiredLevel(uint32_t width, uint32_t height, uint32_t levelsCount, float footprint);
+
+    /**
+     * @brief      Returns the first level not larger than @p baseSize, the last level if there is none.
+     */
+    static uint32_t getBaseLevel(uint32_t width, uint32_t height, uint32_t levelsCount, uint32_t baseSize);
+
+    /**
+     * @brief      Returns the size on the screen of a sphere seen through a perspective projection.
+     *
+     * @param[in]  radius           The radius of the sphere.
+     * @param[in]  distance         The distance between the camera and the center of the sphere.
+     * @param[in]  projectionScale  The vertical scale of the projection, the element (1, 1) of the projection matrix.
+     * @param[in]  viewportHeight   The height of the viewport, in pixels.
+     *
+     * @return     The diameter of the sphere on the screen, in pixels. Infinite if the camera is inside the sphere.
+     */
+    static float getFootprint(float radius, float distance, float projectionScale, float viewportHeight);
+
+    /**
+     * @brief      Starts streaming a texture. The resident level is usually the base level.
+     * @param[in]  handle         The handle of the texture.
+     * @param[in]  width          The width of the first level.
+     * @param[in]  height         The height of the first level.
+     * @param[in]  levelsCount    The number of levels.
+     * @param[in]  residentLevel  The first resident level.
+     * @return     @p true if the texture is tracked.
+     */
+    bool track(Resource::Handle handle, uint32_t width, uint32_t height, uint32_t levelsCount, uint32_t residentLevel);
+
+    /**
+     * @brief      Stops streaming a texture, e.g. before destroying it.
+     * @param[in]  handle  The handle of the texture.
+     */
+    void untrack(Resource::Handle handle);
+
+    bool isTracked(Resource::Handle handle) const;
+    bool isStreaming(Resource::Handle handle) const;
+
+    /**
+     * @brief      Returns the first resident level of a texture, 0 if it is not tracked.
+     */
+    uint32_t getResidentLevel(Resource::Handle handle) const;
+
+    /**
+     * @brief      Requests the levels of a texture needed by an object of the current frame.
+     * @param[in]  handle     The handle of the texture.
+     * @param[in]  footprint  The size of the object on the screen, in pixels.
+     */
+    void request(Resource::Handle handle, float footprint);
+
+    /**
+     * @brief      Ends a stream started by Provider::streamLevels.
+     * @param[in]  handle    The handle of the texture.
+     * @param[in]  streamed  Whether the requested levels are now resident.
+     */
+    void finishStream(Resource::Handle handle, bool streamed);
+
+    /**
+     * @brief      Ends the current frame, releases the levels not requested anymore
+     *             and streams the missing ones that fit in the budget.
+     */
+    void nextFrame();
+
+private:
+    struct Entry {
+        uint32_t width;
+        uint32_t height;
+        uint32_t levelsCount;
+        uint32_t baseLevel;
+        uint32_t residentLevel;
+        uint32_t requiredLevel;     ///< Finest level requested during the current frame, levelsCount if none
+        uint32_t keptLevel;         ///< Finest level requested during the last #_releaseDelay frames
+        uint64_t keptFrame;
+        uint64_t size;              ///< Size of the resident levels
+        bool streaming;
+        uint32_t streamingLevel;
+        uint64_t reservedSize;      ///< Size reserved in the budget for the streamed levels
+    };
+
+    void updateKeptLevel(Entry& entry);
+
+private:
+    Provider* _provider{nullptr};
+
+    uint64_t _budget{0};
+    uint64_t _usage{0};
+    uint32_t _baseSize{64};
+    uint32_t _releaseDelay{3};
+    uint32_t _maxStreamingCount{4};
+    uint32_t _streamingCount{0};
+    uint64_t _frame{0};
+
+    uint64_t _upgrades{0};
+    uint64_t _downgrades{0};
+
+    std::unordered_map<uint32_t, Entry> _entries;
+};
+
+#include <lug/Graphics/TextureStreamer.inl>
+
+} // Graphics
+} // lug
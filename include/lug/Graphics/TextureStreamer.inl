@@ -0,0 +1,61 @@
+inline void TextureStreamer::setProvider(Provider* provider) {
+    _provider = provider;
+}
+
+inline TextureStreamer::Provider* TextureStreamer::getProvider() const {
+    return _provider;
+}
+
+inline void TextureStreamer::setBudget(uint64_t budget) {
+    _budget = budget;
+}
+
+inline uint64_t TextureStreamer::getBudget() const {
+    return _budget;
+}
+
+inline void TextureStreamer::setBaseSize(uint32_t baseSize) {
+    _baseSize = baseSize;
+}
+
+inline uint32_t TextureStreamer::getBaseSize() const {
+    return _baseSize;
+}
+
+inline void TextureStreamer::setReleaseDelay(uint32_t frames) {
+    _releaseDelay = frames;
+}
+
+inline uint32_t TextureStreamer::getReleaseDelay() const {
+    return _releaseDelay;
+}
+
+inline void TextureStreamer::setMaxStreamingCount(uint32_t count) {
+    _maxStreamingCount = count;
+}
+
+inline uint32_t TextureStreamer::getMaxStreamingCount() const {
+    return _maxStreamingCount;
+}
+
+inline uint64_t TextureStreamer::getUsage() const {
+    return _usage;
+}
+
+inline uint64_t TextureStreamer::getFrame() const {
+    return _frame;
+}
+
+inline bool TextureStreamer::isTracked(Resource::Handle handle) const {
+    return _entries.find(handle.value) != _entries.end();
+}
+
+inline bool TextureStreamer::isStreaming(Resource::Handle handle) const {
+    const auto it = _entries.find(handle.value);
+    return it != _entries.end() && it->second.streaming;
+}
+
+inline uint32_t TextureStreamer::getResidentLevel(Resource::Handle handle) const {
+    const auto it = _entries.find(handle.value);
+    return it == _entries.end() ? 0 : it->second.residentLevel;
+}
@@ -28,6 +28,16 @@ public:
 
     // Setters
     void setBindings(const std::vector<VkDescriptorSetLayoutBinding>& bindings);
+    void setFlags(VkDescriptorSetLayoutCreateFlags flags);
+
+#if defined(VK_EXT_descriptor_indexing)
+    /**
+     * @brief      Sets the flags of each binding, needs VK_EXT_descriptor_indexing.
+     *
+     * @param[in]  bindingFlags  The flags, in the same order as the bindings.
+     */
+    void setBindingFlags(const std::vector<VkDescriptorBindingFlagsEXT>& bindingFlags);
+#endif
 
     // Build methods
     bool build(API::DescriptorSetLayout& instance, VkResult* returnResult = nullptr);
@@ -37,6 +47,11 @@ private:
     const API::Device& _device;
 
     std::vector<VkDescriptorSetLayoutBinding> _bindings{};
+    VkDescriptorSetLayoutCreateFlags _flags{0};
+
+#if defined(VK_EXT_descriptor_indexing)
+    std::vector<VkDescriptorBindingFlagsEXT> _bindingFlags{};
+#endif
 };
 
 #include <lug/Graphics/Vulkan/API/Builder/DescriptorSetLayout.inl>
@@ -1,3 +1,13 @@
 inline void DescriptorSetLayout::setBindings(const std::vector<VkDescriptorSetLayoutBinding>& bindings) {
     _bindings = bindings;
 }
+
+inline void DescriptorSetLayout::setFlags(VkDescriptorSetLayoutCreateFlags flags) {
+    _flags = flags;
+}
+
+#if defined(VK_EXT_descriptor_indexing)
+inline void DescriptorSetLayout::setBindingFlags(const std::vector<VkDescriptorBindingFlagsEXT>& bindingFlags) {
+    _bindingFlags = bindingFlags;
+}
+#endif
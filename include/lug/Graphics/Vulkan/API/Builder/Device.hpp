@@ -40,6 +40,12 @@ public:
     void setExtensions(const std::vector<const char*>& extensions);
     void setFeatures(VkPhysicalDeviceFeatures features);
 
+    /**
+     * @brief      Sets the structures chained to the create info, e.g. to enable the features of extensions.
+     *             They must outlive the call to build.
+     */
+    void setNext(const void* next);
+
     uint8_t addQueues(VkQueueFlags queueFlags, const std::vector<std::string>& queuesNames);
 
     // Build methods
@@ -55,6 +61,7 @@ private:
     // We don't have layers because it's deprecated
     std::vector<const char*> _extensions;
     VkPhysicalDeviceFeatures _features{};
+    const void* _next{nullptr};
 
     std::vector<QueueFamily> _queueFamiliesInfos;
 };
@@ -5,3 +5,7 @@ inline void Device::setExtensions(const std::vector<const char*>& extensions) {
 inline void Device::setFeatures(VkPhysicalDeviceFeatures features) {
     _features = features;
 }
+
+inline void Device::setNext(const void* next) {
+    _next = next;
+}
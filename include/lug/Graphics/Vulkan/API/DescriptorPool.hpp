@@ -34,6 +34,14 @@ public:
         return _descriptorPool;
     }
 
+    /**
+     * @brief      Returns all the descriptor sets allocated from the pool to the pool.
+     *             The descriptor sets must not be used anymore.
+     *
+     * @return     Whether the reset succeeded.
+     */
+    bool reset() const;
+
     void destroy();
 
 private:
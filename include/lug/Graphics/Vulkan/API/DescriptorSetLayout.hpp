@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include <lug/Graphics/Export.hpp>
 #include <lug/Graphics/Vulkan/Vulkan.hpp>
@@ -41,14 +42,23 @@ public:
      */
     const Device* getDevice() const;
 
+    /**
+     * @brief      Gets the number of descriptors of each type of a descriptor set using this layout.
+     *
+     * @return     The descriptors counts, usable to size a descriptor pool.
+     */
+    const std::vector<VkDescriptorPoolSize>& getPoolSizes() const;
+
     void destroy();
 
 private:
-    explicit DescriptorSetLayout(VkDescriptorSetLayout DescriptorSetLayout, const Device* device);
+    explicit DescriptorSetLayout(VkDescriptorSetLayout DescriptorSetLayout, const Device* device, std::vector<VkDescriptorPoolSize> poolSizes = {});
 
 private:
     VkDescriptorSetLayout _descriptorSetLayout{VK_NULL_HANDLE};
     const Device* _device{nullptr};
+
+    std::vector<VkDescriptorPoolSize> _poolSizes;
 };
 
 #include <lug/Graphics/Vulkan/API/DescriptorSetLayout.inl>
@@ -1,3 +1,7 @@
 inline const Device* DescriptorSetLayout::getDevice() const {
     return _device;
 }
+
+inline const std::vector<VkDescriptorPoolSize>& DescriptorSetLayout::getPoolSizes() const {
+    return _poolSizes;
+}
@@ -42,16 +42,30 @@ public:
 
     void unmap() const;
 
+    /**
+     * @brief      Makes the host writes to a mapped range visible to the device.
+     *             Does nothing if the memory is host coherent. The range is extended to
+     *             the non coherent atom size of the device.
+     *
+     * @param[in]  offset  The offset of the range in the memory.
+     * @param[in]  size    The size of the range.
+     *
+     * @return     Whether the range has been flushed.
+     */
+    bool flush(VkDeviceSize offset, VkDeviceSize size) const;
+
     VkDeviceSize getSize() const;
+    VkMemoryPropertyFlags getPropertyFlags() const;
 
 private:
-    explicit DeviceMemory(VkDeviceMemory deviceMemory, const Device* device, VkDeviceSize size);
+    explicit DeviceMemory(VkDeviceMemory deviceMemory, const Device* device, VkDeviceSize size, VkMemoryPropertyFlags propertyFlags);
 
 private:
     VkDeviceMemory _deviceMemory{VK_NULL_HANDLE};
     const Device* _device{nullptr};
 
     VkDeviceSize _size{0};
+    VkMemoryPropertyFlags _propertyFlags{0};
 };
 
 #include <lug/Graphics/Vulkan/API/DeviceMemory.inl>
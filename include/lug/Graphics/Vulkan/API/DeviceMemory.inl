@@ -1,3 +1,7 @@
 inline VkDeviceSize DeviceMemory::getSize() const {
     return _size;
 }
+
+inline VkMemoryPropertyFlags DeviceMemory::getPropertyFlags() const {
+    return _propertyFlags;
+}
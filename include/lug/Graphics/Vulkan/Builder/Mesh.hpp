@@ -11,11 +11,29 @@ class Mesh;
 } // Builder
 
 namespace Vulkan {
+
+class Renderer;
+
+namespace Render {
+class Mesh;
+} // Render
+
 namespace Builder {
 namespace Mesh {
 
 Resource::SharedPtr<lug::Graphics::Render::Mesh> LUG_GRAPHICS_API build(const ::lug::Graphics::Builder::Mesh& builder);
 
+/**
+ * @brief      (Re)creates the buffers of a mesh from its attributes and uploads them.
+ */
+bool load(Renderer& renderer, Render::Mesh& mesh);
+
+/**
+ * @brief      Frees the buffers of a mesh, destroyed by the renderer once the frames in flight don't use them anymore.
+ *             It can be loaded back with load.
+ */
+void unload(Renderer& renderer, Render::Mesh& mesh);
+
 } // Mesh
 } // Builder
 } // Vulkan
@@ -1,5 +1,11 @@
 #pragma once
 
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <lug/Graphics/AsyncLoader.hpp>
 #include <lug/Graphics/Render/Texture.hpp>
 #include <lug/Graphics/Resource.hpp>
 
@@ -11,11 +17,59 @@ class Texture;
 } // Builder
 
 namespace Vulkan {
+
+class Renderer;
+
+namespace Render {
+class Texture;
+} // Render
+
 namespace Builder {
 namespace Texture {
 
+/**
+ * @brief      Layers of a texture decoded from its files, see #read.
+ */
+struct Image;
+
 Resource::SharedPtr<lug::Graphics::Render::Texture> build(const ::lug::Graphics::Builder::Texture& builder);
 
+/**
+ * @brief      (Re)creates the image of a texture from its sources and uploads it.
+ */
+bool load(Renderer& renderer, Render::Texture& texture);
+
+/**
+ * @brief      (Re)creates the image of a texture from layers already decoded by #read and uploads it.
+ *             The layers are moved into the image.
+ */
+bool load(Renderer& renderer, Render::Texture& texture, Image& image);
+
+/**
+ * @brief      Reads and decodes the files of a texture. It doesn't use the device, so it can be called
+ *             from a loader thread, the image is then given to Graphics::Builder::Texture::setImage.
+ *
+ * @param[in]  renderer    The renderer, to check the formats supported by the device.
+ * @param[in]  filenames   The files of the layers of the texture.
+ * @param[in]  colorSpace  The color space of the texture.
+ *
+ * @return     The decoded image, nullptr if one of the files can't be read.
+ */
+std::shared_ptr<Image> read(const Renderer& renderer, const std::vector<std::string>& filenames, ::lug::Graphics::Render::Texture::ColorSpace colorSpace);
+
+/**
+ * @brief      Frees the image of a texture, destroyed by the renderer once the frames in flight don't use it anymore.
+ *             It can be loaded back with load.
+ */
+void unload(Renderer& renderer, Render::Texture& texture);
+
+/**
+ * @brief      Creates the task replacing the image of a streamed texture by its levels from @p firstLevel.
+ *             The files are read by the read stage, the image is uploaded by the build stage and the previous
+ *             one is destroyed by the renderer once the frames in flight don't use it anymore.
+ */
+AsyncLoader::Task createStreamTask(Renderer& renderer, Resource::SharedPtr<Render::Texture> texture, uint32_t firstLevel);
+
 } // Texture
 } // Builder
 } // Vulkan
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <memory>
+
 #include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Render/BufferCapacity.hpp>
+#include <lug/Graphics/Render/RingAllocator.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/GraphicsPipeline.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/DescriptorPool.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/DeviceMemory.hpp>
@@ -40,20 +44,36 @@ private:
         lug::Math::Vec2f translate;
     };
 
+    // Persistently mapped buffer of the vertices and indices of the frames in flight
+    struct BufferRing {
+        BufferRing() = default;
+
+        BufferRing(const BufferRing&) = delete;
+        BufferRing(BufferRing&&) = delete;
+
+        BufferRing& operator=(const BufferRing&) = delete;
+        BufferRing& operator=(BufferRing&&) = delete;
+
+        ~BufferRing();
+
+        Vulkan::API::Buffer buffer;
+        Vulkan::API::DeviceMemory bufferMemory;
+        uint8_t* data{nullptr};
+
+        ::lug::Graphics::Render::RingAllocator allocator;
+    };
+
     struct FrameData {
         API::Framebuffer framebuffer;
         Vulkan::API::Semaphore semaphore;
         Vulkan::API::Fence fence;
         Vulkan::API::CommandBuffer commandBuffer;
 
-        Vulkan::API::DeviceMemory vertexMemory;
-        Vulkan::API::DeviceMemory indexMemory;
+        // Ring used by the frame, kept alive until the fence is waited even if the ring is reallocated
+        std::shared_ptr<BufferRing> bufferRing;
 
-        Vulkan::API::Buffer vertexBuffer;
-        Vulkan::API::Buffer indexBuffer;
-
-        void* vertexMemoryPtr{nullptr};
-        void* indexMemoryPtr{nullptr};
+        VkDeviceSize vertexOffset{0};
+        VkDeviceSize indexOffset{0};
     };
 
 public:
@@ -84,6 +104,7 @@ public:
 
 private:
     bool updateBuffers(uint32_t currentImageIndex);
+    bool initBufferRing();
     bool initFrameData();
 
 private:
@@ -108,6 +129,9 @@ private:
     API::GraphicsPipeline _pipeline;
 
     std::vector<FrameData> _framesData;
+
+    std::shared_ptr<BufferRing> _bufferRing;
+    ::lug::Graphics::Render::BufferCapacity _bufferCapacity;
 };
 
 } // Vulkan
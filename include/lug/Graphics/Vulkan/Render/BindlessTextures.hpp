@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Resource.hpp>
+#include <lug/Graphics/Vulkan/API/DescriptorPool.hpp>
+#include <lug/Graphics/Vulkan/API/DescriptorSet.hpp>
+#include <lug/Graphics/Vulkan/API/DescriptorSetLayout.hpp>
+#include <lug/Graphics/Vulkan/Vulkan.hpp>
+#include <lug/System/HashMap.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+
+namespace API {
+class Device;
+} // API
+
+namespace Render {
+
+class Texture;
+
+/**
+ * @brief      Array of the textures of the materials, used in bindless mode.
+ *
+ *             The textures are written once in a single descriptor set, bound for the whole frame,
+ *             and the materials refer to them by their index in the array. The set is created with
+ *             VK_EXT_descriptor_indexing so that the array can be partially bound and the new
+ *             textures can be written while the previous frames are still in flight.
+ *
+ *             A reloaded texture gets a new index, the index of its previous version is reused once
+ *             the frames in flight that can sample it are done. So is the index of a removed texture.
+ */
+class LUG_GRAPHICS_API BindlessTextures {
+public:
+    BindlessTextures() = default;
+
+    BindlessTextures(const BindlessTextures&) = delete;
+    BindlessTextures(BindlessTextures&&) = delete;
+
+    BindlessTextures& operator=(const BindlessTextures&) = delete;
+    BindlessTextures& operator=(BindlessTextures&&) = delete;
+
+    ~BindlessTextures();
+
+    /**
+     * @brief      Returns the size of the array of textures, bounded by the limits of the device.
+     */
+    static uint32_t getMaxTexturesCount(const PhysicalDeviceInfo& physicalDeviceInfo);
+
+    /**
+     * @brief      Builds the layout of the descriptor set of the textures.
+     *             The pipelines use it for their set 3 in bindless mode.
+     *
+     * @return     Whether the layout has been built.
+     */
+    static bool buildDescriptorSetLayout(const API::Device& device, API::DescriptorSetLayout& descriptorSetLayout, VkResult* returnResult = nullptr);
+
+    bool init(const API::Device& device);
+    void destroy();
+
+    /**
+     * @brief      Sets the frame being recorded, and frees the indices retired by the frames done with them.
+     *             It can be called by each view of the frame.
+     *
+     * @param[in]  frame        The frame, see Renderer::getFrame.
+     * @param[in]  retireDelay  The number of frames after which a retired index isn't used anymore, see Renderer::getRetireDelay.
+     */
+    void beginFrame(uint64_t frame, uint32_t retireDelay);
+
+    /**
+     * @brief      Returns the index of a texture in the array.
+     *             The descriptor of the texture is written in a new index the first time it is used and after
+     *             it has been reloaded, the index of the previous version is retired.
+     *
+     * @param[in]  texture  The texture.
+     * @param[out] index    The index of the texture.
+     *
+     * @return     Whether the texture has an index, false if the array is full.
+     */
+    bool getIndex(const Texture& texture, uint32_t& index);
+
+    /**
+     * @brief      Retires the index of a removed texture, it is reused once the frames in flight are done with it.
+     *
+     * @param[in]  handle  The handle of the texture.
+     */
+    void release(Resource::Handle handle);
+
+    const API::DescriptorSet& getDescriptorSet() const;
+
+private:
+    struct Slot {
+        uint32_t index;
+        uint32_t version;
+    };
+
+    struct RetiredIndex {
+        uint32_t index;
+        uint64_t frame;
+    };
+
+private:
+    API::DescriptorSetLayout _descriptorSetLayout;
+    API::DescriptorPool _descriptorPool;
+    API::DescriptorSet _descriptorSet;
+
+    uint32_t _maxTexturesCount{0};
+    uint32_t _indicesCount{0};
+
+    uint64_t _frame{0};
+
+    // Slots of the current version of the textures by handle
+    System::HashMap<Slot> _slots;
+
+    std::vector<RetiredIndex> _retiredIndices;
+    std::vector<uint32_t> _freeIndices;
+};
+
+#include <lug/Graphics/Vulkan/Render/BindlessTextures.inl>
+
+} // Render
+} // Vulkan
+} // Graphics
+} // lug
@@ -0,0 +1,3 @@
+inline const API::DescriptorSet& BindlessTextures::getDescriptorSet() const {
+    return _descriptorSet;
+}
@@ -1,11 +1,11 @@
 #pragma once
 
 #include <list>
-#include <map>
 #include <set>
 
 #include <lug/Graphics/Vulkan/Render/BufferPool/Chunk.hpp>
 #include <lug/Graphics/Vulkan/Render/BufferPool/SubBuffer.hpp>
+#include <lug/System/HashMap.hpp>
 
 namespace lug {
 namespace Graphics {
@@ -40,7 +40,10 @@ protected:
     std::set<uint32_t> _queueFamilyIndices;
 
     std::list<Chunk<subBufferPerChunk, subBufferSize>> _chunks;
-    std::map<size_t, SubBuffer*> _subBuffersInUse;
+    System::HashMap<SubBuffer*> _subBuffersInUse;
+
+    // Head of the list of the free sub buffers of all the chunks, linked through SubBuffer::_nextFree
+    SubBuffer* _freeSubBuffers{nullptr};
 };
 
 #include <lug/Graphics/Vulkan/Render/BufferPool/BufferPool.inl>
@@ -5,8 +5,8 @@ inline BufferPool<subBufferPerChunk, subBufferSize>::BufferPool(Renderer& render
 
 template <size_t subBufferPerChunk, size_t subBufferSize>
 inline std::tuple<bool, const SubBuffer*> BufferPool<subBufferPerChunk, subBufferSize>::allocate(size_t hash, bool dirty) {
-    auto it = _subBuffersInUse.find(hash);
-    if (it == _subBuffersInUse.end() || dirty) {
+    SubBuffer** subBufferInUse = _subBuffersInUse.find(hash);
+    if (!subBufferInUse || dirty) {
         SubBuffer* subBuffer = allocateNewBuffer();
 
         if (!subBuffer) {
@@ -19,8 +19,8 @@ inline std::tuple<bool, const SubBuffer*> BufferPool<subBufferPerChunk, subBuffe
         return std::make_tuple(true, subBuffer);
     }
 
-    it->second->_referenceCount += 1;
-    return std::make_tuple(false, it->second);
+    (*subBufferInUse)->_referenceCount += 1;
+    return std::make_tuple(false, *subBufferInUse);
 }
 
 template <size_t subBufferPerChunk, size_t subBufferSize>
@@ -29,35 +29,45 @@ inline void BufferPool<subBufferPerChunk, subBufferSize>::free(const SubBuffer*
         return;
     }
 
-    const_cast<SubBuffer*>(buffer)->_referenceCount -= 1;
+    SubBuffer* subBuffer = const_cast<SubBuffer*>(buffer);
+    subBuffer->_referenceCount -= 1;
 
-    const auto it = _subBuffersInUse.find(buffer->getHash());
-    if (buffer->_referenceCount == 0 && it != _subBuffersInUse.end() && it->second == buffer) {
-        _subBuffersInUse.erase(buffer->getHash());
+    if (subBuffer->_referenceCount == 0) {
+        // A dirty allocation may have replaced it for its hash
+        SubBuffer** subBufferInUse = _subBuffersInUse.find(subBuffer->getHash());
+        if (subBufferInUse && *subBufferInUse == subBuffer) {
+            _subBuffersInUse.erase(subBuffer->getHash());
+        }
+
+        subBuffer->_nextFree = _freeSubBuffers;
+        _freeSubBuffers = subBuffer;
     }
 }
 
 template <size_t subBufferPerChunk, size_t subBufferSize>
 inline SubBuffer* BufferPool<subBufferPerChunk, subBufferSize>::allocateNewBuffer() {
-    for (auto& chunk : _chunks) {
-        SubBuffer* subBuffer = chunk.getFreeSubBuffer();
-
-        if (subBuffer) {
-            subBuffer->_referenceCount += 1;
-            return subBuffer;
-        }
-    }
-
-    // Reallocate a new chunk
-    {
+    // Allocate a new chunk
+    if (!_freeSubBuffers) {
         _chunks.emplace_back();
 
-        if (_chunks.back().init(_renderer, _queueFamilyIndices)) {
-            return allocateNewBuffer();
+        if (!_chunks.back().init(_renderer, _queueFamilyIndices)) {
+            _chunks.pop_back();
+            return nullptr;
         }
 
-        _chunks.pop_back();
+        // In reverse order to use the beginning of the buffer first
+        auto& subBuffers = _chunks.back().getSubBuffers();
+        for (auto it = subBuffers.rbegin(); it != subBuffers.rend(); ++it) {
+            it->_nextFree = _freeSubBuffers;
+            _freeSubBuffers = &*it;
+        }
     }
 
-    return nullptr;
+    SubBuffer* subBuffer = _freeSubBuffers;
+    _freeSubBuffers = subBuffer->_nextFree;
+
+    subBuffer->_nextFree = nullptr;
+    subBuffer->_referenceCount += 1;
+
+    return subBuffer;
 }
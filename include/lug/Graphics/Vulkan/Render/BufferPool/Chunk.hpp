@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+
 #include <lug/Graphics/Export.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/Buffer.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/DeviceMemory.hpp>
@@ -27,7 +29,7 @@ public:
 
     bool init(Renderer& renderer, std::set<uint32_t> queueFamilyIndices);
 
-    SubBuffer* getFreeSubBuffer();
+    std::array<SubBuffer, subBufferPerChunk>& getSubBuffers();
 
 private:
     API::DeviceMemory _bufferMemory;
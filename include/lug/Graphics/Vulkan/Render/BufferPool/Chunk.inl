@@ -53,12 +53,6 @@ inline bool Chunk<subBufferPerChunk, subBufferSize>::init(Renderer& renderer, st
 }
 
 template <size_t subBufferPerChunk, size_t subBufferSize>
-inline SubBuffer* Chunk<subBufferPerChunk, subBufferSize>::getFreeSubBuffer() {
-    for (auto& subBuffer : _subBuffers) {
-        if (subBuffer._referenceCount == 0) {
-            return &subBuffer;
-        }
-    }
-
-    return nullptr;
+inline std::array<SubBuffer, subBufferPerChunk>& Chunk<subBufferPerChunk, subBufferSize>::getSubBuffers() {
+    return _subBuffers;
 }
@@ -55,6 +55,9 @@ private:
 
     size_t _hash{0};
     uint32_t _referenceCount{0};
+
+    // Next free sub buffer of the pool, when this one is free
+    SubBuffer* _nextFree{nullptr};
 };
 
 #include <lug/Graphics/Vulkan/Render/BufferPool/SubBuffer.inl>
@@ -1,15 +1,24 @@
 #pragma once
 
+#include <lug/Graphics/Vulkan/API/DescriptorSet.hpp>
 #include <lug/Graphics/Vulkan/Render/BufferPool/SubBuffer.hpp>
-#include <lug/Graphics/Vulkan/Render/DescriptorSetPool/DescriptorSetPool.hpp>
+#include <lug/Graphics/Vulkan/Render/DescriptorSetPool/DescriptorAllocator.hpp>
 
 namespace lug {
 namespace Graphics {
 namespace Vulkan {
+
+class Renderer;
+
 namespace Render {
 namespace DescriptorSetPool {
 
-class LUG_GRAPHICS_API Camera : public DescriptorSetPool<10> {
+/**
+ * @brief      Writes the descriptor sets of the camera buffers.
+ *             They are transient: allocated every frame from the allocator of the frame,
+ *             which is reset when the frame is rendered again instead of freeing them.
+ */
+class LUG_GRAPHICS_API Camera {
 public:
     Camera(Renderer& renderer);
 
@@ -21,7 +30,20 @@ public:
 
     ~Camera() = default;
 
-    const DescriptorSet* allocate(const BufferPool::SubBuffer& subBuffer);
+    /**
+     * @brief      Allocates and writes a descriptor set of the camera.
+     *
+     * @param      descriptorAllocator  The allocator of the frame.
+     * @param[in]  subBuffer            The range of the camera data.
+     * @param[in]  paletteSubBuffer     The range of the joints palette of a skinned node.
+     * @param      descriptorSet        The descriptor set.
+     *
+     * @return     Whether the allocation succeeded.
+     */
+    bool allocate(DescriptorAllocator& descriptorAllocator, const BufferPool::SubBuffer& subBuffer, const BufferPool::SubBuffer& paletteSubBuffer, API::DescriptorSet& descriptorSet) const;
+
+private:
+    Renderer& _renderer;
 };
 
 } // DescriptorSetPool
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Vulkan/API/DescriptorPool.hpp>
+#include <lug/Graphics/Vulkan/API/DescriptorSet.hpp>
+#include <lug/Graphics/Vulkan/API/DescriptorSetLayout.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+
+namespace API {
+class Device;
+} // API
+
+namespace Render {
+namespace DescriptorSetPool {
+
+/**
+ * @brief      Allocates descriptor sets from a chain of descriptor pools.
+ *
+ *             A new pool is added to the chain when the others are full, so the allocations
+ *             never fail because of an arbitrary limit. The sets are never freed individually:
+ *             the whole chain is reset at once (e.g. every frame for transient sets).
+ *
+ *             The pools are sized from the descriptors actually allocated: the descriptors
+ *             of each type are counted to get the average needs of a set, and after a reset
+ *             a chain of several pools is replaced by one pool large enough for the peak usage.
+ */
+class LUG_GRAPHICS_API DescriptorAllocator {
+public:
+    struct Statistics {
+        // Number of pools of the chain
+        uint32_t poolsCount{0};
+        // Number of pools added because the others were full
+        uint32_t growthsCount{0};
+
+        // Number of sets allocated since the last reset
+        uint32_t setsCount{0};
+        // Maximum number of sets allocated between two resets
+        uint32_t peakSetsCount{0};
+
+        // Number of sets and descriptors of each type allocated since the creation
+        uint64_t totalSetsCount{0};
+        std::map<VkDescriptorType, uint64_t> totalDescriptorsCount;
+    };
+
+public:
+    /**
+     * @brief      Constructs the allocator, the pools are created on the first allocation.
+     *
+     * @param[in]  device       The device.
+     * @param[in]  setsPerPool  The number of sets of the first pool, the next ones are twice larger.
+     */
+    DescriptorAllocator(const API::Device& device, uint32_t setsPerPool);
+
+    DescriptorAllocator(const DescriptorAllocator&) = delete;
+    DescriptorAllocator(DescriptorAllocator&&) = delete;
+
+    DescriptorAllocator& operator=(const DescriptorAllocator&) = delete;
+    DescriptorAllocator& operator=(DescriptorAllocator&&) = delete;
+
+    ~DescriptorAllocator() = default;
+
+    /**
+     * @brief      Allocates a descriptor set, growing the chain if needed.
+     *
+     * @param[in]  descriptorSetLayout  The layout of the descriptor set.
+     * @param      descriptorSet        The descriptor set.
+     *
+     * @return     Whether the allocation succeeded.
+     */
+    bool allocate(const API::DescriptorSetLayout& descriptorSetLayout, API::DescriptorSet& descriptorSet);
+
+    /**
+     * @brief      Returns all the descriptor sets to the pools.
+     *             The descriptor sets allocated before must not be used anymore.
+     *
+     * @return     Whether the reset succeeded.
+     */
+    bool reset();
+
+    void destroy();
+
+    const Statistics& getStatistics() const;
+
+private:
+    bool addPool(const API::DescriptorSetLayout& descriptorSetLayout, uint32_t maxSets);
+
+private:
+    const API::Device& _device;
+    uint32_t _setsPerPool;
+
+    // The pools must not be moved once sets are allocated from them, hence the unique_ptr
+    std::vector<std::unique_ptr<API::DescriptorPool>> _pools;
+    std::vector<uint32_t> _poolsMaxSets;
+    size_t _currentPool{0};
+
+    Statistics _statistics;
+};
+
+#include <lug/Graphics/Vulkan/Render/DescriptorSetPool/DescriptorAllocator.inl>
+
+} // DescriptorSetPool
+} // Render
+} // Vulkan
+} // Graphics
+} // lug
@@ -0,0 +1,3 @@
+inline const DescriptorAllocator::Statistics& DescriptorAllocator::getStatistics() const {
+    return _statistics;
+}
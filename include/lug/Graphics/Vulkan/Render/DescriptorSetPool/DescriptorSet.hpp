@@ -8,11 +8,9 @@ namespace Vulkan {
 namespace Render {
 namespace DescriptorSetPool {
 
-template <size_t maxSets>
 class DescriptorSetPool;
 
 class LUG_GRAPHICS_API DescriptorSet {
-    template <size_t maxSets>
     friend class DescriptorSetPool;
 
 public:
@@ -37,6 +35,9 @@ private:
 
     size_t _hash{0};
     uint32_t _referenceCount{0};
+
+    // Next free descriptor set of the pool, when this one is free
+    DescriptorSet* _nextFree{nullptr};
 };
 
 #include <lug/Graphics/Vulkan/Render/DescriptorSetPool/DescriptorSet.inl>
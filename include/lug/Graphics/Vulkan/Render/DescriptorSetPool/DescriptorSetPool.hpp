@@ -1,13 +1,13 @@
 #pragma once
 
-#include <map>
+#include <deque>
+#include <tuple>
 
-#include <lug/Graphics/Vulkan/API/Builder/DescriptorPool.hpp>
-#include <lug/Graphics/Vulkan/API/Builder/DescriptorSet.hpp>
-#include <lug/Graphics/Vulkan/API/DescriptorPool.hpp>
 #include <lug/Graphics/Vulkan/API/DescriptorSetLayout.hpp>
+#include <lug/Graphics/Vulkan/Render/DescriptorSetPool/DescriptorAllocator.hpp>
 #include <lug/Graphics/Vulkan/Render/DescriptorSetPool/DescriptorSet.hpp>
 #include <lug/Graphics/Vulkan/Renderer.hpp>
+#include <lug/System/HashMap.hpp>
 
 namespace lug {
 namespace Graphics {
@@ -18,13 +18,14 @@ class Renderer;
 namespace Render {
 namespace DescriptorSetPool {
 
-// TODO: Use another method than a global
-extern API::DescriptorPool descriptorPool;
-
-template <size_t maxSets>
+/**
+ * @brief      Cache of long-lived descriptor sets, identified by the hash of their content.
+ *             The sets are allocated from a DescriptorAllocator and never freed: the unused
+ *             ones are kept to be rewritten by the next allocations.
+ */
 class LUG_GRAPHICS_API DescriptorSetPool {
 public:
-    DescriptorSetPool(Renderer& renderer);
+    DescriptorSetPool(Renderer& renderer, DescriptorAllocator& descriptorAllocator);
 
     DescriptorSetPool(const DescriptorSetPool&) = delete;
     DescriptorSetPool(DescriptorSetPool&&) = delete;
@@ -32,9 +33,7 @@ public:
     DescriptorSetPool& operator=(const DescriptorSetPool&) = delete;
     DescriptorSetPool& operator=(DescriptorSetPool&&) = delete;
 
-    ~DescriptorSetPool();
-
-    bool init();
+    ~DescriptorSetPool() = default;
 
     std::tuple<bool, const DescriptorSet*> allocate(size_t hash, const API::DescriptorSetLayout& descriptorSetLayout);
     void free(const DescriptorSet* descriptorSet);
@@ -44,18 +43,17 @@ private:
 
 protected:
     Renderer& _renderer;
+    DescriptorAllocator& _descriptorAllocator;
 
-    size_t _descriptorSetsCount{0};
-    std::array<DescriptorSet, maxSets> _descriptorSets;
+    // Deque to keep the pointers to the descriptor sets valid when adding new ones
+    std::deque<DescriptorSet> _descriptorSets;
 
-    size_t _freeDescriptorSetsCount{0};
-    std::array<DescriptorSet*, maxSets> _freeDescriptorSets;
+    // Head of the list of the free descriptor sets, linked through DescriptorSet::_nextFree
+    DescriptorSet* _freeDescriptorSets{nullptr};
 
-    std::map<size_t, DescriptorSet*> _descriptorSetsInUse;
+    System::HashMap<DescriptorSet*> _descriptorSetsInUse;
 };
 
-#include <lug/Graphics/Vulkan/Render/DescriptorSetPool/DescriptorSetPool.inl>
-
 } // DescriptorSetPool
 } // Render
 } // Vulkan
@@ -1,15 +1,25 @@
 #pragma once
 
+#include <lug/Graphics/Render/SkyBox.hpp>
+#include <lug/Graphics/Vulkan/API/DescriptorSet.hpp>
 #include <lug/Graphics/Vulkan/Render/BufferPool/SubBuffer.hpp>
-#include <lug/Graphics/Vulkan/Render/DescriptorSetPool/DescriptorSetPool.hpp>
+#include <lug/Graphics/Vulkan/Render/DescriptorSetPool/DescriptorAllocator.hpp>
 
 namespace lug {
 namespace Graphics {
 namespace Vulkan {
+
+class Renderer;
+
 namespace Render {
 namespace DescriptorSetPool {
 
-class LUG_GRAPHICS_API Light : public DescriptorSetPool<10> {
+/**
+ * @brief      Writes the descriptor sets of the lights buffers.
+ *             They are transient: allocated every frame from the allocator of the frame,
+ *             which is reset when the frame is rendered again instead of freeing them.
+ */
+class LUG_GRAPHICS_API Light {
 public:
     Light(Renderer& renderer);
 
@@ -21,7 +31,20 @@ public:
 
     ~Light() = default;
 
-    const DescriptorSet* allocate(const BufferPool::SubBuffer& subBuffer);
+    /**
+     * @brief      Allocates a descriptor set and writes the lights buffer in it.
+     *
+     * @param[in]  descriptorAllocator  The allocator of the frame.
+     * @param[in]  subBuffer            The lights buffer.
+     * @param[out] descriptorSet        The descriptor set.
+     * @param[in]  skyBox               The skybox whose environment is also written, if it has one. Can be null.
+     *
+     * @return     Whether the descriptor set has been allocated.
+     */
+    bool allocate(DescriptorAllocator& descriptorAllocator, const BufferPool::SubBuffer& subBuffer, API::DescriptorSet& descriptorSet, const ::lug::Graphics::Render::SkyBox* skyBox = nullptr) const;
+
+private:
+    Renderer& _renderer;
 };
 
 } // DescriptorSetPool
@@ -9,9 +9,9 @@ namespace Vulkan {
 namespace Render {
 namespace DescriptorSetPool {
 
-class LUG_GRAPHICS_API Material : public DescriptorSetPool<10> {
+class LUG_GRAPHICS_API Material : public DescriptorSetPool {
 public:
-    Material(Renderer& renderer);
+    Material(Renderer& renderer, DescriptorAllocator& descriptorAllocator);
 
     Material(const Material&) = delete;
     Material(Material&&) = delete;
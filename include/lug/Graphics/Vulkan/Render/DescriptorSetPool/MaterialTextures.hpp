@@ -10,9 +10,9 @@ namespace Vulkan {
 namespace Render {
 namespace DescriptorSetPool {
 
-class LUG_GRAPHICS_API MaterialTextures : public DescriptorSetPool<10> {
+class LUG_GRAPHICS_API MaterialTextures : public DescriptorSetPool {
 public:
-    MaterialTextures(Renderer& renderer);
+    MaterialTextures(Renderer& renderer, DescriptorAllocator& descriptorAllocator);
 
     MaterialTextures(const MaterialTextures&) = delete;
     MaterialTextures(MaterialTextures&&) = delete;
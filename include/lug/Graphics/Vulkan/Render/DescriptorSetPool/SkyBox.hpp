@@ -10,9 +10,9 @@ namespace Vulkan {
 namespace Render {
 namespace DescriptorSetPool {
 
-class LUG_GRAPHICS_API SkyBox : public DescriptorSetPool<10> {
+class LUG_GRAPHICS_API SkyBox : public DescriptorSetPool {
 public:
-    SkyBox(Renderer& renderer);
+    SkyBox(Renderer& renderer, DescriptorAllocator& descriptorAllocator);
 
     SkyBox(const SkyBox&) = delete;
     SkyBox(SkyBox&&) = delete;
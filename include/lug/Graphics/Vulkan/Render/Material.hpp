@@ -18,6 +18,20 @@ namespace Render {
 class LUG_GRAPHICS_API Material final : public ::lug::Graphics::Render::Material {
     friend Resource::SharedPtr<lug::Graphics::Render::Material> Builder::Material::build(const ::lug::Graphics::Builder::Material&);
 
+public:
+    /**
+     * @brief      Row of the material in the MaterialTable,
+     *             with the std430 layout of the materialsBlock storage buffer.
+     */
+    struct Data {
+        Constants constants;
+        uint32_t padding;           ///< The Material struct of the shaders is aligned on 16 bytes
+        uint32_t textures[5];       ///< Index of the texture in the bindless array << 2 | texCoord, or noTexture. In the order of the getters. Only used in bindless mode.
+        uint32_t paddingRow[3];     ///< The rows of the table are aligned on 16 bytes
+    };
+
+    static constexpr uint32_t noTexture = 0xFFFFFFFF;
+
 public:
     Material(const Material&) = delete;
     Material(Material&&) = delete;
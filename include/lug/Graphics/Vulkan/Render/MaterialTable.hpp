@@ -0,0 +1,150 @@
+#pragma once
+
+#include <set>
+#include <vector>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Vulkan/API/Buffer.hpp>
+#include <lug/Graphics/Vulkan/API/DeviceMemory.hpp>
+#include <lug/Graphics/Vulkan/Render/Material.hpp>
+#include <lug/System/HashMap.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+
+namespace API {
+class CommandBuffer;
+class Device;
+} // API
+
+namespace Render {
+
+/**
+ * @brief      Storage buffer holding the data of all the materials, indexed by material.
+ *
+ *             Each material has a row in the table until it is released, when the material is removed
+ *             from the ResourceManager. The rows are written in a copy kept on the CPU and only the
+ *             modified ones are uploaded, with vkCmdUpdateBuffer, at the beginning of the frame. The
+ *             draws then only have to push the index of their material.
+ */
+class LUG_GRAPHICS_API MaterialTable {
+public:
+    /**
+     * @brief      Rows of the materials by handle. The released rows are reused by the next materials.
+     */
+    class LUG_GRAPHICS_API RowAllocator {
+    public:
+        void init(uint32_t maxRowsCount);
+        void clear();
+
+        /**
+         * @brief      Returns the row of a handle, allocated the first time.
+         *
+         * @param[in]  handle  The value of the handle.
+         * @param[out] index   The index of the row.
+         * @param[out] newRow  Whether the row has just been allocated.
+         *
+         * @return     Whether the handle has a row, false if all the rows are used.
+         */
+        bool getIndex(uint32_t handle, uint32_t& index, bool* newRow = nullptr);
+
+        /**
+         * @brief      Releases the row of a handle.
+         *
+         * @return     Whether the handle had a row.
+         */
+        bool release(uint32_t handle);
+
+        uint32_t getMaxRowsCount() const;
+
+    private:
+        uint32_t _maxRowsCount{0};
+        uint32_t _rowsCount{0};
+
+        // Index of the row of the handles
+        System::HashMap<uint32_t> _indices;
+
+        std::vector<uint32_t> _freeRows;
+    };
+
+public:
+    MaterialTable() = default;
+
+    MaterialTable(const MaterialTable&) = delete;
+    MaterialTable(MaterialTable&&) = delete;
+
+    MaterialTable& operator=(const MaterialTable&) = delete;
+    MaterialTable& operator=(MaterialTable&&) = delete;
+
+    ~MaterialTable();
+
+    /**
+     * @brief      Creates the buffer of the table.
+     *
+     * @param[in]  device              The device.
+     * @param[in]  queueFamilyIndices  The queue families using the buffer.
+     * @param[in]  maxMaterialsCount   The number of rows of the table.
+     *
+     * @return     Whether the initialization succeeded.
+     */
+    bool init(const API::Device& device, const std::set<uint32_t>& queueFamilyIndices, uint32_t maxMaterialsCount);
+    void destroy();
+
+    /**
+     * @brief      Returns the index of the row of a material, the row is allocated the first time.
+     *
+     * @param[in]  material  The material.
+     * @param[out] index     The index of the row.
+     * @param[out] newRow    Whether the row has just been allocated, and has to be written.
+     *
+     * @return     Whether the material has a row, false if the table is full.
+     */
+    bool getIndex(const ::lug::Graphics::Render::Material& material, uint32_t& index, bool* newRow = nullptr);
+
+    /**
+     * @brief      Releases the row of a removed material, to be reused by the next materials.
+     *
+     *             The frames in flight can still read the row, but its next write is uploaded by
+     *             flush after a barrier waiting for their draws.
+     *
+     * @param[in]  handle  The handle of the material.
+     */
+    void release(Resource::Handle handle);
+
+    /**
+     * @brief      Writes a row, it is uploaded by the next call to flush.
+     */
+    void write(uint32_t index, const Material::Data& data);
+
+    /**
+     * @brief      Returns a row as it was last written.
+     */
+    const Material::Data& getRow(uint32_t index) const;
+
+    /**
+     * @brief      Records the upload of the rows written since the last flush.
+     *             Must be called outside of a render pass.
+     *
+     * @param[in]  cmdBuffer  The command buffer of the frame, submitted to the queue of the draws.
+     */
+    void flush(const API::CommandBuffer& cmdBuffer);
+
+    const API::Buffer& getBuffer() const;
+
+private:
+    API::Buffer _buffer;
+    API::DeviceMemory _bufferMemory;
+
+    std::vector<Material::Data> _rows;
+    std::vector<uint32_t> _writtenRows;
+
+    RowAllocator _rowAllocator;
+};
+
+#include <lug/Graphics/Vulkan/Render/MaterialTable.inl>
+
+} // Render
+} // Vulkan
+} // Graphics
+} // lug
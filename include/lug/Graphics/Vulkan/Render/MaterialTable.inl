@@ -0,0 +1,11 @@
+inline uint32_t MaterialTable::RowAllocator::getMaxRowsCount() const {
+    return _maxRowsCount;
+}
+
+inline const API::Buffer& MaterialTable::getBuffer() const {
+    return _buffer;
+}
+
+inline const Material::Data& MaterialTable::getRow(uint32_t index) const {
+    return _rows[index];
+}
@@ -19,6 +19,8 @@ namespace Render {
 
 class LUG_GRAPHICS_API Mesh : public ::lug::Graphics::Render::Mesh {
     friend Resource::SharedPtr<lug::Graphics::Render::Mesh> Builder::Mesh::build(const ::lug::Graphics::Builder::Mesh&);
+    friend bool Builder::Mesh::load(Renderer&, Mesh&);
+    friend void Builder::Mesh::unload(Renderer&, Mesh&);
 
 public:
     struct PrimitiveSetData {
@@ -35,6 +37,19 @@ public:
 
     ~Mesh() override final;
 
+    const API::DeviceMemory& getDeviceMemory() const;
+
+    /**
+     * @brief      Frees the buffers of the mesh, it can be loaded back with Builder::Mesh::load.
+     */
+    void unload();
+
+    /**
+     * @brief      Exchanges the primitive sets and the buffers of two meshes, used to hot reload a mesh
+     *             without changing the resources referencing it. None of them must be in use by the device.
+     */
+    void swap(Mesh& other);
+
     void destroy();
 
 private:
@@ -0,0 +1,3 @@
+inline const API::DeviceMemory& Mesh::getDeviceMemory() const {
+    return _deviceMemory;
+}
@@ -9,6 +9,7 @@
 #include <lug/Graphics/Render/Technique/Type.hpp>
 #include <lug/Graphics/Resource.hpp>
 #include <lug/Graphics/Vulkan/API/GraphicsPipeline.hpp>
+#include <lug/Math/Matrix.hpp>
 
 namespace lug {
 namespace Graphics {
@@ -42,6 +43,9 @@ public:
                     uint32_t countTexCoord : 2;         ///< The number of texcoord (maximum 3).
                     uint32_t countColor : 2;            ///< The number of colors (maximum 3).
                     uint32_t primitiveMode : 3;         ///< The primitive mode. @see Mesh::PrimitiveSet::Mode.
+                    uint32_t halfPosition : 1;          ///< 1 if the positions are halves. @see Mesh::PrimitiveSet::Attribute::Format.
+                    uint32_t octahedralNormal : 1;      ///< 1 if the normals are oct16. @see Mesh::PrimitiveSet::Attribute::Format.
+                    uint32_t skinned : 1;               ///< 1 if the vertices are skinned by the joints of an Animation::Animator.
                 };
 
                 uint32_t value;
@@ -65,6 +69,25 @@ public:
                     uint32_t normalInfo : 2;                ///< 0b00 texture with UV0, 0b01 texture with UV1, 0b10 texture with UV2, 0b11 no texture.
                     uint32_t occlusionInfo : 2;             ///< 0b00 texture with UV0, 0b01 texture with UV1, 0b10 texture with UV2, 0b11 no texture.
                     uint32_t emissiveInfo : 2;              ///< 0b00 texture with UV0, 0b01 texture with UV1, 0b10 texture with UV2, 0b11 no texture.
+                    uint32_t bindless : 1;                  ///< 1 if the textures are indexed in the bindless array, the infos above are then all 0b11.
+                };
+
+                uint32_t value;
+            };
+
+            explicit operator uint32_t() {
+                return value;
+            }
+        };
+
+        /**
+         * @brief      Describes the pass of the objects, the lighting which doesn't
+         *             depend on the primitive nor the material.
+         */
+        struct PipelinePart {
+            union {
+                struct {
+                    uint32_t environment : 1;               ///< 1 if the image-based lighting of the skybox is added to the lights.
                 };
 
                 uint32_t value;
@@ -77,8 +100,9 @@ public:
 
         union {
             struct {
-                uint32_t primitivePart : 10;
-                uint32_t materialPart : 10;
+                uint32_t primitivePart : 13;
+                uint32_t materialPart : 11;
+                uint32_t pipelinePart : 1;
             };
 
             uint32_t value;
@@ -118,19 +142,27 @@ public:
             return tmp;
         }
 
+        PipelinePart getPipelinePart() {
+            PipelinePart tmp;
+            tmp.value = pipelinePart;
+            return tmp;
+        }
+
         /**
          * @brief      Create a pipeline id.
          *
          * @param[in]  primitivePart  The primitive part. It should be created manually beforehand.
          * @param[in]  materialPart   The material part. It should be created manually beforehand.
+         * @param[in]  pipelinePart   The pipeline part, without environment by default.
          *
          * @return     The created id.
          */
-        static Id create(PrimitivePart primitivePart, MaterialPart materialPart) {
+        static Id create(PrimitivePart primitivePart, MaterialPart materialPart, PipelinePart pipelinePart = PipelinePart()) {
             Id id;
 
             id.primitivePart = static_cast<uint32_t>(primitivePart);
             id.materialPart = static_cast<uint32_t>(materialPart);
+            id.pipelinePart = static_cast<uint32_t>(pipelinePart);
 
             return id;
         };
@@ -161,6 +193,12 @@ public:
         static std::vector<uint32_t> buildShaderFromString(std::string filename, std::string content, Type type, Pipeline::Id id);
     };
 
+    /**
+     * @brief      Size of the push constants of the pipelines: the model transform,
+     *             read by the vertex shader, followed by the index of the material in the MaterialTable.
+     */
+    static constexpr uint32_t pushConstantsSize = sizeof(Math::Mat4x4f) + sizeof(uint32_t);
+
 public:
     Pipeline(Renderer& renderer, Id id);
 
@@ -178,14 +216,43 @@ public:
      * @return     The id.
      */
     Id getId() const;
-    static inline Id getBaseId();
+
+    /**
+     * @brief      Returns the id of the pipeline without textures nor optional attributes.
+     *             Its layout is used for the descriptor sets shared by all the pipelines.
+     *
+     * @param[in]  bindless  Whether the pipelines use the bindless array of textures.
+     */
+    static inline Id getBaseId(bool bindless = false);
 
     const API::GraphicsPipeline& getPipelineAPI();
 
     static Resource::SharedPtr<Pipeline> create(Renderer& renderer, Id id);
 
+    /**
+     * @brief      Compiles the shaders of a pipeline.
+     *             Doesn't use the device, so it can be called from another thread.
+     *
+     * @param[in]  renderer            The renderer, for its shaders root and render technique.
+     * @param[in]  id                  The id of the pipeline.
+     * @param[out] vertexShaderCode    The SPIR-V code of the vertex shader.
+     * @param[out] fragmentShaderCode  The SPIR-V code of the fragment shader.
+     *
+     * @return     Whether the shaders have been compiled.
+     */
+    static bool buildShaders(const Renderer& renderer, Id id, std::vector<uint32_t>& vertexShaderCode, std::vector<uint32_t>& fragmentShaderCode);
+
+    /**
+     * @brief      Replaces the pipeline by a new one built with the given shaders.
+     *             The current pipeline is kept on failure. It must not be in use by the device.
+     *
+     * @return     Whether the pipeline has been replaced.
+     */
+    bool reload(const std::vector<uint32_t>& vertexShaderCode, const std::vector<uint32_t>& fragmentShaderCode);
+
 private:
     bool init();
+    bool build(const std::vector<uint32_t>& vertexShaderCode, const std::vector<uint32_t>& fragmentShaderCode, API::GraphicsPipeline& pipeline);
 
 private:
     Renderer& _renderer;
@@ -2,7 +2,7 @@ inline Pipeline::Id Pipeline::getId() const {
     return _id;
 }
 
-inline Pipeline::Id Pipeline::getBaseId() {
+inline Pipeline::Id Pipeline::getBaseId(bool bindless) {
     Pipeline::Id::PrimitivePart primitivePart;
     primitivePart.positionVertexData = 1;
     primitivePart.normalVertexData = 1;
@@ -10,6 +10,9 @@ inline Pipeline::Id Pipeline::getBaseId() {
     primitivePart.countTexCoord = 0;
     primitivePart.countColor = 0;
     primitivePart.primitiveMode = 4; // Triangles
+    primitivePart.halfPosition = 0;
+    primitivePart.octahedralNormal = 0;
+    primitivePart.skinned = 0;
 
     Pipeline::Id::MaterialPart materialPart;
     materialPart.baseColorInfo = 0b11; // No texture
@@ -17,6 +20,7 @@ inline Pipeline::Id Pipeline::getBaseId() {
     materialPart.normalInfo = 0b11; // No texture
     materialPart.occlusionInfo = 0b11; // No texture
     materialPart.emissiveInfo = 0b11; // No texture
+    materialPart.bindless = bindless;
 
     return Pipeline::Id::create(primitivePart, materialPart);
 }
@@ -20,6 +20,7 @@ public:
         Scene::Node* node;
         const Render::Mesh::PrimitiveSet* primitiveSet;
         Render::Material* material;
+        float footprint;    ///< Size of the node on the screen, in pixels
     };
 
 public:
@@ -33,7 +34,7 @@ public:
 
     ~Queue() = default;
 
-    void addMeshInstance(Scene::Node& node) override final;
+    void addMeshInstance(Scene::Node& node, float footprint) override final;
     void addLight(Scene::Node& node) override final;
     void addSkyBox(Resource::SharedPtr<::lug::Graphics::Render::SkyBox> skyBox) override final;
     void clear() override final;
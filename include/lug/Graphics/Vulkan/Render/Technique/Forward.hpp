@@ -1,23 +1,26 @@
 #pragma once
 
+#include <memory>
 #include <unordered_map>
 
 #include <lug/Graphics/Export.hpp>
 #include <lug/Graphics/Vulkan/API/CommandBuffer.hpp>
 #include <lug/Graphics/Vulkan/API/CommandPool.hpp>
+#include <lug/Graphics/Vulkan/API/DescriptorSet.hpp>
 #include <lug/Graphics/Vulkan/API/Fence.hpp>
 #include <lug/Graphics/Vulkan/API/Framebuffer.hpp>
 #include <lug/Graphics/Vulkan/API/Image.hpp>
 #include <lug/Graphics/Vulkan/API/ImageView.hpp>
-#include <lug/Graphics/Vulkan/Render/BufferPool/Camera.hpp>
-#include <lug/Graphics/Vulkan/Render/BufferPool/Light.hpp>
-#include <lug/Graphics/Vulkan/Render/BufferPool/Material.hpp>
+#include <lug/Graphics/Vulkan/Render/BindlessTextures.hpp>
 #include <lug/Graphics/Vulkan/Render/DescriptorSetPool/Camera.hpp>
+#include <lug/Graphics/Vulkan/Render/DescriptorSetPool/DescriptorAllocator.hpp>
 #include <lug/Graphics/Vulkan/Render/DescriptorSetPool/Light.hpp>
 #include <lug/Graphics/Vulkan/Render/DescriptorSetPool/Material.hpp>
 #include <lug/Graphics/Vulkan/Render/DescriptorSetPool/MaterialTextures.hpp>
 #include <lug/Graphics/Vulkan/Render/DescriptorSetPool/SkyBox.hpp>
+#include <lug/Graphics/Vulkan/Render/MaterialTable.hpp>
 #include <lug/Graphics/Vulkan/Render/Technique/Technique.hpp>
+#include <lug/Graphics/Vulkan/Render/UniformRing.hpp>
 
 namespace lug {
 namespace Graphics {
@@ -44,18 +47,13 @@ private:
         API::Fence renderFence;
         API::CommandBuffer renderCmdBuffer;
 
-        API::Fence transferFence;
-        API::CommandBuffer transferCmdBuffer;
-        API::Semaphore transferSemaphore;
+        // Transient descriptor sets, the allocator is reset at the beginning of the frame
+        std::unique_ptr<DescriptorSetPool::DescriptorAllocator> descriptorAllocator;
+        API::DescriptorSet cameraDescriptorSet;
+        API::DescriptorSet lightDescriptorSet;
 
-        const BufferPool::SubBuffer* cameraBuffer{nullptr};
-        std::vector<const BufferPool::SubBuffer*> lightBuffers;
-        std::vector<const BufferPool::SubBuffer*> materialBuffers;
-
-        const DescriptorSetPool::DescriptorSet* cameraDescriptorSet{nullptr};
         const DescriptorSetPool::DescriptorSet* skyBoxDescriptorSet{nullptr};
-        std::vector<const DescriptorSetPool::DescriptorSet*> lightDescriptorSets;
-        std::vector<const DescriptorSetPool::DescriptorSet*> materialDescriptorSets;
+        const DescriptorSetPool::DescriptorSet* materialTableDescriptorSet{nullptr};
         std::vector<const DescriptorSetPool::DescriptorSet*> materialTexturesDescriptorSets;
     };
 
@@ -83,6 +81,19 @@ public:
     bool initDepthBuffers(const std::vector<API::ImageView>& imageViews) override final;
     bool initFramebuffers(const std::vector<API::ImageView>& imageViews) override final;
 
+    /**
+     * @brief      Releases the row of a removed material in the material table shared by the views.
+     */
+    static void releaseMaterial(Resource::Handle handle);
+
+    /**
+     * @brief      Retires the index of a removed texture in the bindless textures shared by the views.
+     */
+    static void releaseTexture(Resource::Handle handle);
+
+    // Number of rows of the material table
+    static constexpr uint32_t maxMaterialsCount = 4096;
+
 private:
     API::DeviceMemory _depthBufferMemory;
 
@@ -91,14 +102,17 @@ private:
     const API::Queue* _graphicsQueue{nullptr};
     API::CommandPool _graphicsCommandPool;
 
-    const API::Queue* _transferQueue{nullptr};
-    API::CommandPool _transferCommandPool;
+    // Uniform data of the camera, lights and joints palettes of the frames in flight
+    static constexpr uint32_t uniformRingSize = 16 * 1024 * 1024;
+    UniformRing _uniformRing;
+
+    // Size of the range of the palette descriptor, the skins with more joints are not drawn
+    static constexpr uint32_t maxJointsCount = 256;
 
 private:
     // TODO: Use shared_ptr in the instance and static weak_ptr to avoid problem when we delete one forward renderer and not the others
-    static std::unique_ptr<BufferPool::Camera> _cameraBufferPool;
-    static std::unique_ptr<BufferPool::Light> _lightBufferPool;
-    static std::unique_ptr<BufferPool::Material> _materialBufferPool;
+    // Allocator of the long-lived descriptor sets of the pools
+    static std::unique_ptr<DescriptorSetPool::DescriptorAllocator> _descriptorAllocator;
 
     static std::unique_ptr<DescriptorSetPool::Camera> _cameraDescriptorSetPool;
     static std::unique_ptr<DescriptorSetPool::Light> _lightDescriptorSetPool;
@@ -106,6 +120,12 @@ private:
     static std::unique_ptr<DescriptorSetPool::MaterialTextures> _materialTexturesDescriptorSetPool;
     static std::unique_ptr<DescriptorSetPool::SkyBox> _skyBoxDescriptorSetPool;
 
+    // Data of all the materials, indexed with a push constant by the draws
+    static std::unique_ptr<MaterialTable> _materialTable;
+
+    // Textures of the materials in bindless mode, replaces the material textures descriptor sets
+    static std::unique_ptr<BindlessTextures> _bindlessTextures;
+
     static uint32_t _forwardCount;
 };
 
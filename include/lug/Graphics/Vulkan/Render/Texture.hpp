@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include <lug/Graphics/Export.hpp>
 #include <lug/Graphics/Render/Texture.hpp>
@@ -17,6 +18,10 @@ namespace Render {
 
 class LUG_GRAPHICS_API Texture final : public ::lug::Graphics::Render::Texture {
     friend Resource::SharedPtr<lug::Graphics::Render::Texture> Builder::Texture::build(const ::lug::Graphics::Builder::Texture&);
+    friend bool Builder::Texture::load(Renderer&, Texture&);
+    friend bool Builder::Texture::load(Renderer&, Texture&, Builder::Texture::Image&);
+    friend void Builder::Texture::unload(Renderer&, Texture&);
+    friend AsyncLoader::Task Builder::Texture::createStreamTask(Renderer&, Resource::SharedPtr<Texture>, uint32_t);
 
 public:
     Texture(const Texture&) = delete;
@@ -32,6 +37,41 @@ public:
     const API::ImageView& getImageView() const;
     const API::Sampler& getSampler() const;
 
+    /**
+     * @brief      Returns the number of times the texture has been loaded.
+     *             It changes when the image is reloaded, invalidating the descriptor sets using it.
+     */
+    uint32_t getVersion() const;
+
+    /**
+     * @brief      Whether the mip levels of the texture are streamed by the TextureStreamer.
+     */
+    bool isStreaming() const;
+
+    uint32_t getWidth() const;
+    uint32_t getHeight() const;
+
+    /**
+     * @brief      Returns the number of levels of the texture, resident or not.
+     */
+    uint32_t getLevelsCount() const;
+
+    /**
+     * @brief      Returns the first resident level, the first level of the image.
+     *             The image only contains the levels from this one, always 0 if the texture is not streamed.
+     */
+    uint32_t getFirstLevel() const;
+
+    /**
+     * @brief      Returns the size of the levels of the texture from a level to the last one, in bytes.
+     */
+    uint64_t getLevelsSize(uint32_t firstLevel) const;
+
+    /**
+     * @brief      Frees the image of the texture, it can be loaded back with Builder::Texture::load.
+     */
+    void unload();
+
     void destroy();
 
 private:
@@ -42,6 +82,21 @@ private:
     API::Image _image;
     API::ImageView _imageView;
     API::Sampler _sampler;
+
+    std::vector<std::string> _layersFilenames;
+    bool _cubeMap{false};
+    uint32_t _mipLevels{0};
+    ColorSpace _colorSpace{ColorSpace::Linear};
+    bool _streaming{false};
+
+    VkFormat _format{VK_FORMAT_UNDEFINED};
+    uint32_t _width{0};
+    uint32_t _height{0};
+    uint32_t _layersCount{0};
+    uint32_t _levelsCount{0};
+    uint32_t _firstLevel{0};
+
+    uint32_t _version{0};
 };
 
 #include <lug/Graphics/Vulkan/Render/Texture.inl>
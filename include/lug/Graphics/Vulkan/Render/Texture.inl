@@ -14,3 +14,27 @@ inline const API::Sampler& Texture::getSampler() const {
     return _sampler;
 }
 
+inline uint32_t Texture::getVersion() const {
+    return _version;
+}
+
+
+inline bool Texture::isStreaming() const {
+    return _streaming;
+}
+
+inline uint32_t Texture::getWidth() const {
+    return _width;
+}
+
+inline uint32_t Texture::getHeight() const {
+    return _height;
+}
+
+inline uint32_t Texture::getLevelsCount() const {
+    return _levelsCount;
+}
+
+inline uint32_t Texture::getFirstLevel() const {
+    return _firstLevel;
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <set>
+
+#include <lug/Graphics/Export.hpp>
+#include <lug/Graphics/Render/RingAllocator.hpp>
+#include <lug/Graphics/Vulkan/API/Buffer.hpp>
+#include <lug/Graphics/Vulkan/API/DeviceMemory.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+
+namespace API {
+class Device;
+} // API
+
+namespace Render {
+
+/**
+ * @brief      Persistently mapped uniform buffer shared by the frames in flight.
+ *
+ *             The uniform data of a frame (camera, lights, joints palettes) is copied into the ring
+ *             every frame and bound with dynamic offsets, so there is no transfer to record nor
+ *             to wait for. The space of a frame is reused once its fence has been waited.
+ */
+class LUG_GRAPHICS_API UniformRing {
+public:
+    UniformRing() = default;
+
+    UniformRing(const UniformRing&) = delete;
+    UniformRing(UniformRing&&) = delete;
+
+    UniformRing& operator=(const UniformRing&) = delete;
+    UniformRing& operator=(UniformRing&&) = delete;
+
+    ~UniformRing();
+
+    /**
+     * @brief      Creates and maps the buffer.
+     *
+     * @param[in]  device              The device.
+     * @param[in]  queueFamilyIndices  The queue families using the buffer.
+     * @param[in]  size                The size of the ring, in bytes.
+     * @param[in]  maxRangeSize        The size of the largest descriptor range bound in the ring. The buffer is larger than the ring by
+     *                                 this size so that a range bound at the end of the ring stays in the buffer, although less is written.
+     *
+     * @return     Whether the initialization succeeded.
+     */
+    bool init(const API::Device& device, const std::set<uint32_t>& queueFamilyIndices, uint32_t size, uint32_t maxRangeSize = 0);
+    void destroy();
+
+    /**
+     * @brief      Allocates a range of the frame being recorded.
+     *
+     * @param[in]  size    The size of the range.
+     * @param      offset  The offset of the range in the buffer, to use as dynamic offset.
+     *
+     * @return     The mapped memory of the range, nullptr if the ring is full.
+     */
+    void* allocate(uint32_t size, uint32_t& offset);
+
+    /**
+     * @brief      Allocates a range of the frame being recorded and copies data into it.
+     *
+     * @return     Whether the allocation succeeded.
+     */
+    bool write(const void* data, uint32_t size, uint32_t& offset);
+
+    /**
+     * @brief      Ends the frame being recorded, see RingAllocator::endFrame.
+     */
+    void endFrame(uint32_t frameIndex);
+
+    /**
+     * @brief      Releases the ranges of a frame, the fence of the frame must have been waited.
+     */
+    void releaseFrame(uint32_t frameIndex);
+
+    const API::Buffer& getBuffer() const;
+
+private:
+    API::Buffer _buffer;
+    API::DeviceMemory _bufferMemory;
+    uint8_t* _data{nullptr};
+
+    ::lug::Graphics::Render::RingAllocator _allocator;
+};
+
+#include <lug/Graphics/Vulkan/Render/UniformRing.inl>
+
+} // Render
+} // Vulkan
+} // Graphics
+} // lug
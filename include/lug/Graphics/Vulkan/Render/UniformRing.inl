@@ -0,0 +1,3 @@
+inline const API::Buffer& UniformRing::getBuffer() const {
+    return _buffer;
+}
@@ -1,12 +1,21 @@
 #pragma once
 
+#include <algorithm>
 #include <cstring>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include <lug/Graphics/Export.hpp>
 #include <lug/Graphics/Renderer.hpp>
+#include <lug/Graphics/ResourceBudget.hpp>
+#include <lug/Graphics/Scene/Scene.hpp>
+#include <lug/Graphics/TextureStreamer.hpp>
+#include <lug/Graphics/Vulkan/API/Buffer.hpp>
 #include <lug/Graphics/Vulkan/API/Device.hpp>
+#include <lug/Graphics/Vulkan/API/DeviceMemory.hpp>
+#include <lug/Graphics/Vulkan/API/Image.hpp>
+#include <lug/Graphics/Vulkan/API/ImageView.hpp>
 #include <lug/Graphics/Vulkan/API/Instance.hpp>
 #include <lug/Graphics/Vulkan/API/Loader.hpp>
 #include <lug/Graphics/Vulkan/Render/Mesh.hpp>
@@ -18,7 +27,7 @@ namespace lug {
 namespace Graphics {
 namespace Vulkan {
 
-class LUG_GRAPHICS_API Renderer final : public ::lug::Graphics::Renderer {
+class LUG_GRAPHICS_API Renderer final : public ::lug::Graphics::Renderer, public ResourceBudget::Provider, public TextureStreamer::Provider {
 public:
     struct Requirements {
         const std::vector<const char*> mandatoryInstanceExtensions;
@@ -65,9 +74,22 @@ public:
     bool isInstanceExtensionLoaded(const char* name) const;
     bool isDeviceExtensionLoaded(const char* name) const;
 
+    /**
+     * @brief      Returns the features enabled on the device, e.g. the texture compression formats.
+     */
+    const VkPhysicalDeviceFeatures& getLoadedDeviceFeatures() const;
+
+    /**
+     * @brief      Whether the textures of the materials are indexed in a single array of descriptors.
+     *             Enabled with Renderer::InitInfo::bindless if the device supports VK_EXT_descriptor_indexing.
+     */
+    bool isBindlessEnabled() const;
+
     ::lug::Graphics::Render::Window* createWindow(Render::Window::InitInfo& initInfo) override final;
     ::lug::Graphics::Render::Window* getWindow() override final;
 
+    void onResourceRemoved(const Resource& resource) override final;
+
     const API::Instance& getInstance() const;
     API::Device& getDevice();
     const API::Device& getDevice() const;
@@ -95,10 +117,55 @@ public:
     bool beginFrame(const lug::System::Time& elapsedTime) override final;
     bool endFrame() override final;
 
+    uint64_t getResourceSize(Resource::Handle handle) const override final;
+    bool evictResource(Resource::Handle handle) override final;
+    bool reloadResource(Resource::Handle handle) override final;
+
+    uint64_t getLevelsSize(Resource::Handle handle, uint32_t firstLevel) const override final;
+    bool streamLevels(Resource::Handle handle, uint32_t firstLevel) override final;
+
+    /**
+     * @brief      Returns the number of frames the device can be rendering at the same time,
+     *             one per image of the swapchain.
+     */
+    uint32_t getFramesInFlightCount() const;
+
+    /**
+     * @brief      Returns the number of frames ended since the initialization of the renderer.
+     */
+    uint64_t getFrame() const;
+
+    /**
+     * @brief      Returns the number of frames after which an object retired during a frame isn't used
+     *             by the device anymore, see destroyLater.
+     */
+    uint32_t getRetireDelay() const;
+
+    /**
+     * @brief      Destroys the image of a texture once the frames in flight don't use it anymore.
+     */
+    void destroyLater(API::Image image, API::ImageView imageView, API::DeviceMemory deviceMemory);
+
+    /**
+     * @brief      Destroys the buffers of a mesh once the frames in flight don't use them anymore.
+     */
+    void destroyLater(std::vector<API::Buffer> buffers, API::DeviceMemory deviceMemory);
+
 private:
     bool initInstance(const std::string& appName, const Core::Version& appVersion);
     bool initDevice();
 
+    uint64_t queryMemoryBudget() const;
+
+    void reloadModifiedFiles();
+    void reloadPipelines();
+    void replacePipelines();
+    void reloadTextures(const std::vector<Resource::Handle>& textures);
+    void replaceSceneMeshes(::lug::Graphics::Scene::Scene& scene, ::lug::Graphics::Scene::Scene& reloadedScene);
+    void removeReloadedResources(::lug::Graphics::Scene::Scene* scene, const std::vector<Resource::Handle>& createdHandles, const std::vector<Resource::Handle>& replacedHandles);
+    void updateTextureStreams();
+    void destroyRetiredObjects();
+
     bool checkRequirementsInstance(const std::set<Module::Type> &modulesToCheck);
     bool checkRequirementsDevice(const PhysicalDeviceInfo& physicalDeviceInfo, const std::set<Module::Type> &modulesToCheck, bool finalization, bool quiet);
 
@@ -126,6 +193,10 @@ private:
     std::vector<const char*> _loadedInstanceExtensions{};
     std::vector<const char*> _loadedDeviceExtensions{};
     VkPhysicalDeviceFeatures _loadedDeviceFeatures{};
+#if defined(VK_EXT_descriptor_indexing)
+    VkPhysicalDeviceDescriptorIndexingFeaturesEXT _loadedDescriptorIndexingFeatures{};
+#endif
+    bool _bindless{false};
     std::vector<Render::Mesh*> _attachedMeshes{};
 
     Preferences _preferences{
@@ -149,6 +220,46 @@ private:
 
     std::unordered_map<Render::Pipeline::Id, Resource::WeakPtr<Render::Pipeline>> _pipelines;
 
+    bool _budgetExceeded{false};
+
+    struct SceneReload {
+        Resource::Handle scene;
+        std::shared_ptr<std::vector<Resource::Handle>> createdHandles;
+        std::shared_ptr<AsyncLoader::Ticket> ticket;
+    };
+
+    std::vector<SceneReload> _sceneReloads;
+
+    // The shaders are compiled by the loader threads, the pipelines are replaced together once they are all compiled
+    struct PipelineReload {
+        Resource::SharedPtr<Render::Pipeline> pipeline;
+        std::vector<uint32_t> vertexShaderCode;
+        std::vector<uint32_t> fragmentShaderCode;
+        std::shared_ptr<AsyncLoader::Ticket> ticket;
+    };
+
+    std::vector<std::shared_ptr<PipelineReload>> _pipelineReloads;
+
+    struct TextureStream {
+        Resource::Handle texture;
+        std::shared_ptr<AsyncLoader::Ticket> ticket;
+    };
+
+    std::vector<TextureStream> _textureStreams;
+
+    uint64_t _frame{0};
+
+    // Destroyed in the reverse order, the memory last
+    struct RetiredObjects {
+        API::DeviceMemory deviceMemory;
+        API::Image image;
+        API::ImageView imageView;
+        std::vector<API::Buffer> buffers;
+        uint64_t frame;
+    };
+
+    std::vector<RetiredObjects> _retiredObjects;
+
 private:
     static const std::unordered_map<Module::Type, Requirements> modulesRequirements;
 };
@@ -22,6 +22,14 @@ inline bool Renderer::isDeviceExtensionLoaded(const char* name) const {
     return std::find_if(_loadedDeviceExtensions.cbegin(), _loadedDeviceExtensions.cend(), compareExtensions) != _loadedDeviceExtensions.cend();
 }
 
+inline const VkPhysicalDeviceFeatures& Renderer::getLoadedDeviceFeatures() const {
+    return _loadedDeviceFeatures;
+}
+
+inline bool Renderer::isBindlessEnabled() const {
+    return _bindless;
+}
+
 inline const API::Instance& Renderer::getInstance() const {
     return _instance;
 }
@@ -85,3 +93,17 @@ inline Resource::SharedPtr<Render::Pipeline> Renderer::getPipeline(Render::Pipel
 inline Render::Window* Renderer::getRenderWindow() const {
     return _window.get();
 }
+
+inline uint32_t Renderer::getFramesInFlightCount() const {
+    // Each image of the swapchain has its own command buffers, see Render::Technique::Forward
+    return _window ? std::max(static_cast<uint32_t>(_window->getSwapchain().getImages().size()), 1u) : 1;
+}
+
+inline uint64_t Renderer::getFrame() const {
+    return _frame;
+}
+
+inline uint32_t Renderer::getRetireDelay() const {
+    // The objects retired during a frame can be used by it and by the frames in flight before it
+    return getFramesInFlightCount() + 1;
+}
@@ -137,12 +137,14 @@
     macro(vkBindImageMemory)                            \
     macro(vkCreateSampler)                              \
     macro(vkCmdCopyBufferToImage)                       \
+    macro(vkCmdBlitImage)                               \
     macro(vkCreateDescriptorSetLayout)                  \
     macro(vkCreateDescriptorPool)                       \
     macro(vkAllocateDescriptorSets)                     \
     macro(vkUpdateDescriptorSets)                       \
     macro(vkCmdUpdateBuffer)                            \
     macro(vkCmdBindDescriptorSets)                      \
+    macro(vkResetDescriptorPool)                        \
     macro(vkDestroyDescriptorPool)                      \
     macro(vkDestroyDescriptorSetLayout)                 \
     macro(vkDestroySampler)                             \
@@ -179,6 +181,12 @@ struct PhysicalDeviceInfo {
     VkPhysicalDeviceProperties properties;
     VkPhysicalDeviceFeatures features;
 
+#if defined(VK_EXT_descriptor_indexing)
+    // Zeroed if the device doesn't support VK_EXT_descriptor_indexing
+    VkPhysicalDeviceDescriptorIndexingFeaturesEXT descriptorIndexingFeatures;
+    VkPhysicalDeviceDescriptorIndexingPropertiesEXT descriptorIndexingProperties;
+#endif
+
     VkPhysicalDeviceMemoryProperties memoryProperties;
 
     std::vector<VkQueueFamilyProperties> queueFamilies;
@@ -258,6 +266,14 @@ inline std::ostream& operator<<(std::ostream& ss, VkResult result) {
         case VK_ERROR_FORMAT_NOT_SUPPORTED:
             ss << "A requested format is not supported on this device";
             break;
+        case VK_ERROR_FRAGMENTED_POOL:
+            ss << "A pool allocation has failed due to fragmentation of the pool's memory";
+            break;
+#if defined(VK_KHR_maintenance1)
+        case VK_ERROR_OUT_OF_POOL_MEMORY_KHR:
+            ss << "A pool memory allocation has failed";
+            break;
+#endif
         case VK_ERROR_SURFACE_LOST_KHR:
             ss << "A surface is no longer available";
             break;
@@ -0,0 +1,321 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <lug/Math/Export.hpp>
+#include <lug/Math/Geometry/Frustum.hpp>
+#include <lug/Math/Geometry/Ray.hpp>
+#include <lug/Math/Geometry/Sphere.hpp>
+#include <lug/Math/Matrix.hpp>
+#include <lug/Math/Quaternion.hpp>
+#include <lug/Math/Vector.hpp>
+
+namespace lug {
+namespace Math {
+namespace Batch {
+
+/**
+ * @brief      Instruction sets of the kernels.
+ *
+ *             The best one supported by the CPU is selected the first time a kernel is called.
+ */
+enum class InstructionSet : uint8_t {
+    Scalar,
+    SSE2,
+    AVX2,   ///< With FMA and F16C
+    NEON
+};
+
+/**
+ * @brief      Returns the instruction set used by the kernels.
+ */
+LUG_MATH_API InstructionSet getInstructionSet();
+
+/**
+ * @brief      Forces the instruction set used by the kernels, e.g. to compare them.
+ *
+ * @param[in]  instructionSet  The instruction set.
+ *
+ * @return     Whether the instruction set is supported by the build and by the CPU.
+ */
+LUG_MATH_API bool setInstructionSet(InstructionSet instructionSet);
+
+/**
+ * @brief      Stream of 3D vectors stored as one array per component.
+ *
+ *             The stream doesn't own the arrays, see Vec3Array.
+ */
+struct Vec3Stream {
+    float* x;
+    float* y;
+    float* z;
+};
+
+struct ConstVec3Stream {
+    ConstVec3Stream(const float* x, const float* y, const float* z);
+    ConstVec3Stream(const Vec3Stream& stream);
+
+    const float* x;
+    const float* y;
+    const float* z;
+};
+
+/**
+ * @brief      Stream of quaternions stored as one array per component.
+ *
+ *             The stream doesn't own the arrays, see QuatArray.
+ */
+struct QuatStream {
+    float* w;
+    float* x;
+    float* y;
+    float* z;
+};
+
+struct ConstQuatStream {
+    ConstQuatStream(const float* w, const float* x, const float* y, const float* z);
+    ConstQuatStream(const QuatStream& stream);
+
+    const float* w;
+    const float* x;
+    const float* y;
+    const float* z;
+};
+
+/**
+ * @brief      Storage of the arrays of a Vec3Stream.
+ */
+class Vec3Array {
+public:
+    Vec3Array() = default;
+    explicit Vec3Array(size_t size);
+
+    Vec3Array(const Vec3Array&) = default;
+    Vec3Array(Vec3Array&&) = default;
+
+    Vec3Array& operator=(const Vec3Array&) = default;
+    Vec3Array& operator=(Vec3Array&&) = default;
+
+    ~Vec3Array() = default;
+
+    void resize(size_t size);
+    size_t size() const;
+
+    void set(size_t idx, const Vec3f& vector);
+    Vec3f get(size_t idx) const;
+
+    Vec3Stream getStream();
+    ConstVec3Stream getStream() const;
+
+private:
+    std::vector<float> _x;
+    std::vector<float> _y;
+    std::vector<float> _z;
+};
+
+/**
+ * @brief      Storage of the arrays of a QuatStream.
+ */
+class QuatArray {
+public:
+    QuatArray() = default;
+    explicit QuatArray(size_t size);
+
+    QuatArray(const QuatArray&) = default;
+    QuatArray(QuatArray&&) = default;
+
+    QuatArray& operator=(const QuatArray&) = default;
+    QuatArray& operator=(QuatArray&&) = default;
+
+    ~QuatArray() = default;
+
+    void resize(size_t size);
+    size_t size() const;
+
+    void set(size_t idx, const Quatf& quaternion);
+    Quatf get(size_t idx) const;
+
+    QuatStream getStream();
+    ConstQuatStream getStream() const;
+
+private:
+    std::vector<float> _w;
+    std::vector<float> _x;
+    std::vector<float> _y;
+    std::vector<float> _z;
+};
+
+/**
+ * @brief      Returns the number of words of a visibility mask of @p count elements.
+ *
+ *             The element i is the bit i % 32 of the word i / 32.
+ */
+size_t getMaskSize(size_t count);
+
+/**
+ * @brief      Transforms points, i.e. with a w component of 1. There is no perspective division.
+ *
+ *             @p out may be @p in.
+ */
+LUG_MATH_API void transformPoints(const Mat4x4f& matrix, ConstVec3Stream in, Vec3Stream out, size_t count);
+
+/**
+ * @brief      Transforms normals by the inverse transpose of the upper 3x3 part of @p matrix and normalizes them.
+ *
+ *             @p matrix is the one of the points, @p out may be @p in.
+ */
+LUG_MATH_API void transformNormals(const Mat4x4f& matrix, ConstVec3Stream in, Vec3Stream out, size_t count);
+
+/**
+ * @brief      Composes the matrices translation * rotation * scale, as Node does.
+ *
+ * @param[in]  translations  The translations.
+ * @param[in]  rotations     The rotations, normalized.
+ * @param[in]  scales        The scales.
+ * @param      out           The matrices.
+ * @param[in]  count         The number of transformations.
+ */
+LUG_MATH_API void composeTransforms(ConstVec3Stream translations, ConstQuatStream rotations, ConstVec3Stream scales, Mat4x4f* out, size_t count);
+
+/**
+ * @brief      Multiplies the matrices two by two, e.g. the parents by their children.
+ *
+ *             @p out may be @p lhs or @p rhs.
+ */
+LUG_MATH_API void multiply(const Mat4x4f* lhs, const Mat4x4f* rhs, Mat4x4f* out, size_t count);
+LUG_MATH_API void multiply(const Mat4x4f& lhs, const Mat4x4f* rhs, Mat4x4f* out, size_t count);
+
+/**
+ * @brief      Computes the axis aligned bounding boxes of the transformed boxes.
+ *
+ *             The outputs may be the inputs.
+ */
+LUG_MATH_API void transformAabbs(const Mat4x4f& matrix, ConstVec3Stream mins, ConstVec3Stream maxs, Vec3Stream outMins, Vec3Stream outMaxs, size_t count);
+
+/**
+ * @brief      Tests spheres against a convex volume, e.g. a frustum.
+ *
+ * @param[in]  planes        The planes of the volume, as {normal, distance}, the inside is where
+ *                           dot(normal, point) + distance >= 0.
+ * @param[in]  planesCount   The number of planes.
+ * @param[in]  centers       The centers of the spheres.
+ * @param[in]  radii         The radii of the spheres.
+ * @param      visibility    The visibility mask, of getMaskSize(count) words. The bit of a sphere is set if
+ *                           it intersects the volume. Spheres near a corner may be kept although outside.
+ * @param[in]  count         The number of spheres.
+ */
+LUG_MATH_API void cullSpheres(const Vec4f* planes, size_t planesCount, ConstVec3Stream centers, const float* radii, uint32_t* visibility, size_t count);
+
+/**
+ * @brief      Tests axis aligned bounding boxes against a convex volume, e.g. a frustum.
+ *
+ *             Same as cullSpheres.
+ */
+LUG_MATH_API void cullAabbs(const Vec4f* planes, size_t planesCount, ConstVec3Stream mins, ConstVec3Stream maxs, uint32_t* visibility, size_t count);
+
+/**
+ * @brief      Same as cullSpheres and cullAabbs with the planes of @p frustum.
+ */
+void cullSpheres(const Geometry::Frustumf& frustum, ConstVec3Stream centers, const float* radii, uint32_t* visibility, size_t count);
+void cullAabbs(const Geometry::Frustumf& frustum, ConstVec3Stream mins, ConstVec3Stream maxs, uint32_t* visibility, size_t count);
+
+/**
+ * @brief      Tests spheres against one sphere, e.g. the objects against the range of a light.
+ *
+ * @param[in]  sphere   The sphere.
+ * @param[in]  centers  The centers of the spheres.
+ * @param[in]  radii    The radii of the spheres.
+ * @param      hits     The mask of the spheres intersecting @p sphere, of getMaskSize(count) words.
+ * @param[in]  count    The number of spheres.
+ */
+LUG_MATH_API void intersectSpheres(const Geometry::Spheref& sphere, ConstVec3Stream centers, const float* radii, uint32_t* hits, size_t count);
+
+/**
+ * @brief      Tests axis aligned bounding boxes against a ray, e.g. to pick an object.
+ *
+ * @param[in]  ray        The ray.
+ * @param[in]  mins       The minimums of the boxes.
+ * @param[in]  maxs       The maximums of the boxes.
+ * @param      distances  The distances along the ray of the first intersections, only meaningful for the hits.
+ * @param      hits       The mask of the boxes intersecting the ray, of getMaskSize(count) words.
+ * @param[in]  count      The number of boxes.
+ */
+LUG_MATH_API void intersectRayAabbs(const Geometry::Rayf& ray, ConstVec3Stream mins, ConstVec3Stream maxs, float* distances, uint32_t* hits, size_t count);
+
+/**
+ * @brief      Tests triangles against a ray, from either side.
+ *
+ *             Same as intersectRayAabbs, the triangles are given by their three vertices.
+ */
+LUG_MATH_API void intersectRayTriangles(const Geometry::Rayf& ray, ConstVec3Stream v0, ConstVec3Stream v1, ConstVec3Stream v2, float* distances, uint32_t* hits, size_t count);
+
+/**
+ * @brief      Converts floats to half-precision floats, see Packing::packHalf.
+ */
+LUG_MATH_API void packHalf(const float* in, uint16_t* out, size_t count);
+LUG_MATH_API void unpackHalf(const uint16_t* in, float* out, size_t count);
+
+/**
+ * @brief      Converts floats to normalized integers, see Packing::packSnorm8.
+ */
+LUG_MATH_API void packSnorm8(const float* in, int8_t* out, size_t count);
+LUG_MATH_API void packUnorm8(const float* in, uint8_t* out, size_t count);
+LUG_MATH_API void packSnorm16(const float* in, int16_t* out, size_t count);
+LUG_MATH_API void packUnorm16(const float* in, uint16_t* out, size_t count);
+
+/**
+ * @brief      Encodes normals as two snorm16 (oct16), see Packing::encodeOctahedral.
+ *
+ * @param[in]  normals  The normals, they can't be null.
+ * @param      out      The encoded normals, of 2 * @p count values.
+ * @param[in]  count    The number of normals.
+ */
+LUG_MATH_API void encodeOctahedral(ConstVec3Stream normals, int16_t* out, size_t count);
+
+/**
+ * @brief      Encodes tangent frames as QTangents of four snorm16, see Packing::encodeQTangent.
+ *
+ * @param[in]  normals     The normals, normalized.
+ * @param[in]  tangents    The tangents.
+ * @param[in]  handedness  The handedness of the tangents, i.e. the w component of the glTF tangents.
+ * @param      out         The QTangents as {x, y, z, w}, of 4 * @p count values.
+ * @param[in]  count       The number of tangent frames.
+ */
+LUG_MATH_API void encodeQTangent(ConstVec3Stream normals, ConstVec3Stream tangents, const float* handedness, int16_t* out, size_t count);
+
+/**
+ * @brief      Interpolates vectors linearly, e.g. the translations of keyframes.
+ *
+ * @param[in]  lhs      The vectors at 0.
+ * @param[in]  rhs      The vectors at 1.
+ * @param[in]  factors  The interpolation factors, one per vector.
+ * @param      out      The interpolated vectors, may be @p lhs or @p rhs.
+ * @param[in]  count    The number of vectors.
+ */
+LUG_MATH_API void lerp(ConstVec3Stream lhs, ConstVec3Stream rhs, const float* factors, Vec3Stream out, size_t count);
+
+/**
+ * @brief      Interpolates rotations, see Math::nlerp.
+ *
+ *             Same parameters as lerp, the rotations are normalized.
+ */
+LUG_MATH_API void nlerp(ConstQuatStream lhs, ConstQuatStream rhs, const float* factors, QuatStream out, size_t count);
+
+/**
+ * @brief      Interpolates rotations with an approximation of Math::slerp.
+ *
+ *             The factors are corrected by a polynomial fitted on the angle between the rotations,
+ *             then the rotations are interpolated by nlerp. The error is below 0.001 radians, for the cost
+ *             of a nlerp instead of the trigonometric functions of slerp.
+ *
+ *             Same parameters as nlerp.
+ */
+LUG_MATH_API void slerp(ConstQuatStream lhs, ConstQuatStream rhs, const float* factors, QuatStream out, size_t count);
+
+#include <lug/Math/Batch.inl>
+
+} // Batch
+} // Math
+} // lug
@@ -0,0 +1,99 @@
+inline ConstVec3Stream::ConstVec3Stream(const float* x, const float* y, const float* z) : x(x), y(y), z(z) {}
+
+inline ConstVec3Stream::ConstVec3Stream(const Vec3Stream& stream) : x(stream.x), y(stream.y), z(stream.z) {}
+
+inline ConstQuatStream::ConstQuatStream(const float* w, const float* x, const float* y, const float* z) : w(w), x(x), y(y), z(z) {}
+
+inline ConstQuatStream::ConstQuatStream(const QuatStream& stream) : w(stream.w), x(stream.x), y(stream.y), z(stream.z) {}
+
+inline Vec3Array::Vec3Array(size_t size) : _x(size), _y(size), _z(size) {}
+
+inline void Vec3Array::resize(size_t size) {
+    _x.resize(size);
+    _y.resize(size);
+    _z.resize(size);
+}
+
+inline size_t Vec3Array::size() const {
+    return _x.size();
+}
+
+inline void Vec3Array::set(size_t idx, const Vec3f& vector) {
+    _x[idx] = vector.x();
+    _y[idx] = vector.y();
+    _z[idx] = vector.z();
+}
+
+inline Vec3f Vec3Array::get(size_t idx) const {
+    return {_x[idx], _y[idx], _z[idx]};
+}
+
+inline Vec3Stream Vec3Array::getStream() {
+    return {_x.data(), _y.data(), _z.data()};
+}
+
+inline ConstVec3Stream Vec3Array::getStream() const {
+    return {_x.data(), _y.data(), _z.data()};
+}
+
+inline QuatArray::QuatArray(size_t size) : _w(size), _x(size), _y(size), _z(size) {}
+
+inline void QuatArray::resize(size_t size) {
+    _w.resize(size);
+    _x.resize(size);
+    _y.resize(size);
+    _z.resize(size);
+}
+
+inline size_t QuatArray::size() const {
+    return _w.size();
+}
+
+inline void QuatArray::set(size_t idx, const Quatf& quaternion) {
+    _w[idx] = quaternion.w();
+    _x[idx] = quaternion.x();
+    _y[idx] = quaternion.y();
+    _z[idx] = quaternion.z();
+}
+
+inline Quatf QuatArray::get(size_t idx) const {
+    return {_w[idx], _x[idx], _y[idx], _z[idx]};
+}
+
+inline QuatStream QuatArray::getStream() {
+    return {_w.data(), _x.data(), _y.data(), _z.data()};
+}
+
+inline ConstQuatStream QuatArray::getStream() const {
+    return {_w.data(), _x.data(), _y.data(), _z.data()};
+}
+
+inline size_t getMaskSize(size_t count) {
+    return (count + 31) / 32;
+}
+
+inline void cullSpheres(const Geometry::Frustumf& frustum, ConstVec3Stream centers, const float* radii, uint32_t* visibility, size_t count) {
+    const Vec4f planes[6] = {
+        frustum.planes[0].getCoefficients(),
+        frustum.planes[1].getCoefficients(),
+        frustum.planes[2].getCoefficients(),
+        frustum.planes[3].getCoefficients(),
+        frustum.planes[4].getCoefficients(),
+        frustum.planes[5].getCoefficients()
+    };
+
+    cullSpheres(planes, 6, centers, radii, visibility, count);
+}
+
+inline void cullAabbs(const Geometry::Frustumf& frustum, ConstVec3Stream mins, ConstVec3Stream maxs, uint32_t* visibility, size_t count) {
+    const Vec4f planes[6] = {
+        frustum.planes[0].getCoefficients(),
+        frustum.planes[1].getCoefficients(),
+        frustum.planes[2].getCoefficients(),
+        frustum.planes[3].getCoefficients(),
+        frustum.planes[4].getCoefficients(),
+        frustum.planes[5].getCoefficients()
+    };
+
+    cullAabbs(planes, 6, mins, maxs, visibility, count);
+}
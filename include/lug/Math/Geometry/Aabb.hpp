@@ -0,0 +1,67 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+#include <lug/Math/Matrix.hpp>
+#include <lug/Math/Vector.hpp>
+
+namespace lug {
+namespace Math {
+namespace Geometry {
+
+/**
+ * @brief      Axis aligned bounding box.
+ */
+template <typename T = float>
+struct Aabb {
+    Aabb() = default;
+
+    constexpr Aabb(const Vector<3, T>& min, const Vector<3, T>& max);
+
+    Aabb(const Aabb<T>&) = default;
+    Aabb(Aabb<T>&&) = default;
+
+    Aabb<T>& operator=(const Aabb<T>&) = default;
+    Aabb<T>& operator=(Aabb<T>&&) = default;
+
+    ~Aabb() = default;
+
+    constexpr Vector<3, T> getCenter() const;
+
+    /**
+     * @brief      Returns the half size of the box.
+     */
+    constexpr Vector<3, T> getExtent() const;
+
+    constexpr bool contains(const Vector<3, T>& point) const;
+
+    /**
+     * @brief      Grows the box to contain @p point.
+     */
+    void extend(const Vector<3, T>& point);
+
+    /**
+     * @brief      Grows the box to contain @p aabb.
+     */
+    void extend(const Aabb<T>& aabb);
+
+    /**
+     * @brief      Returns the axis aligned bounding box of this box transformed by @p matrix.
+     *
+     *             Same as Batch::transformAabbs, for one box.
+     */
+    Aabb<T> transform(const Matrix<4, 4, T>& matrix) const;
+
+    Vector<3, T> min;
+    Vector<3, T> max;
+};
+
+using Aabbf = Aabb<float>;
+using Aabbd = Aabb<double>;
+
+#include <lug/Math/Geometry/Aabb.inl>
+
+} // Geometry
+} // Math
+} // lug
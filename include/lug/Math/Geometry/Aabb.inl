@@ -0,0 +1,56 @@
+template <typename T>
+inline constexpr Aabb<T>::Aabb(const Vector<3, T>& min, const Vector<3, T>& max) : min(min), max(max) {}
+
+template <typename T>
+inline constexpr Vector<3, T> Aabb<T>::getCenter() const {
+    return (min + max) * T(0.5);
+}
+
+template <typename T>
+inline constexpr Vector<3, T> Aabb<T>::getExtent() const {
+    return (max - min) * T(0.5);
+}
+
+template <typename T>
+inline constexpr bool Aabb<T>::contains(const Vector<3, T>& point) const {
+    return point.x() >= min.x() && point.x() <= max.x() &&
+        point.y() >= min.y() && point.y() <= max.y() &&
+        point.z() >= min.z() && point.z() <= max.z();
+}
+
+template <typename T>
+inline void Aabb<T>::extend(const Vector<3, T>& point) {
+    for (uint8_t axis = 0; axis < 3; ++axis) {
+        min(axis) = std::min(min(axis), point(axis));
+        max(axis) = std::max(max(axis), point(axis));
+    }
+}
+
+template <typename T>
+inline void Aabb<T>::extend(const Aabb<T>& aabb) {
+    for (uint8_t axis = 0; axis < 3; ++axis) {
+        min(axis) = std::min(min(axis), aabb.min(axis));
+        max(axis) = std::max(max(axis), aabb.max(axis));
+    }
+}
+
+template <typename T>
+inline Aabb<T> Aabb<T>::transform(const Matrix<4, 4, T>& matrix) const {
+    const Vector<3, T> center = getCenter();
+    const Vector<3, T> extent = getExtent();
+
+    // The extent of the transformed box is the extent multiplied by the absolute values of the matrix
+    Vector<3, T> newCenter;
+    Vector<3, T> newExtent;
+    for (uint8_t row = 0; row < 3; ++row) {
+        newCenter(row) = matrix(row, 3);
+        newExtent(row) = T(0);
+
+        for (uint8_t col = 0; col < 3; ++col) {
+            newCenter(row) += matrix(row, col) * center(col);
+            newExtent(row) += std::abs(matrix(row, col)) * extent(col);
+        }
+    }
+
+    return {newCenter - newExtent, newCenter + newExtent};
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <lug/Math/Geometry/Plane.hpp>
+#include <lug/Math/Matrix.hpp>
+#include <lug/Math/Vector.hpp>
+
+namespace lug {
+namespace Math {
+namespace Geometry {
+
+/**
+ * @brief      Frustum of a camera, as the planes facing its inside.
+ */
+template <typename T = float>
+struct Frustum {
+    enum class Side : uint8_t {
+        Left,
+        Right,
+        Bottom,
+        Top,
+        Near,
+        Far
+    };
+
+    Frustum() = default;
+
+    /**
+     * @brief      Extracts the frustum from the view-projection matrix of a camera.
+     *
+     *             The depth of the clip space is in [0, 1], as the one of Vulkan and of perspective().
+     *             The planes are in the space of the points transformed by @p viewProjection,
+     *             e.g. the world space.
+     */
+    explicit Frustum(const Matrix<4, 4, T>& viewProjection);
+
+    Frustum(const Frustum<T>&) = default;
+    Frustum(Frustum<T>&&) = default;
+
+    Frustum<T>& operator=(const Frustum<T>&) = default;
+    Frustum<T>& operator=(Frustum<T>&&) = default;
+
+    ~Frustum() = default;
+
+    const Plane<T>& getPlane(Side side) const;
+
+    bool contains(const Vector<3, T>& point) const;
+
+    Plane<T> planes[6];
+};
+
+using Frustumf = Frustum<float>;
+using Frustumd = Frustum<double>;
+
+#include <lug/Math/Geometry/Frustum.inl>
+
+} // Geometry
+} // Math
+} // lug
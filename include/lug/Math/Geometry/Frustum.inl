@@ -0,0 +1,36 @@
+template <typename T>
+inline Frustum<T>::Frustum(const Matrix<4, 4, T>& viewProjection) {
+    const Matrix<4, 4, T>& m = viewProjection;
+
+    // A point is inside if -w <= x <= w, -w <= y <= w and 0 <= z <= w in clip space, each inequality
+    // is a combination of the rows of the matrix (Gribb and Hartmann)
+    const Vector<4, T> rows[4] = {
+        {m(0, 0), m(0, 1), m(0, 2), m(0, 3)},
+        {m(1, 0), m(1, 1), m(1, 2), m(1, 3)},
+        {m(2, 0), m(2, 1), m(2, 2), m(2, 3)},
+        {m(3, 0), m(3, 1), m(3, 2), m(3, 3)}
+    };
+
+    planes[static_cast<uint8_t>(Side::Left)] = Plane<T>(Vector<4, T>(rows[3] + rows[0]));
+    planes[static_cast<uint8_t>(Side::Right)] = Plane<T>(Vector<4, T>(rows[3] - rows[0]));
+    planes[static_cast<uint8_t>(Side::Bottom)] = Plane<T>(Vector<4, T>(rows[3] + rows[1]));
+    planes[static_cast<uint8_t>(Side::Top)] = Plane<T>(Vector<4, T>(rows[3] - rows[1]));
+    planes[static_cast<uint8_t>(Side::Near)] = Plane<T>(rows[2]);
+    planes[static_cast<uint8_t>(Side::Far)] = Plane<T>(Vector<4, T>(rows[3] - rows[2]));
+}
+
+template <typename T>
+inline const Plane<T>& Frustum<T>::getPlane(Side side) const {
+    return planes[static_cast<uint8_t>(side)];
+}
+
+template <typename T>
+inline bool Frustum<T>::contains(const Vector<3, T>& point) const {
+    for (const Plane<T>& plane : planes) {
+        if (plane.getDistance(point) < T(0)) {
+            return false;
+        }
+    }
+
+    return true;
+}
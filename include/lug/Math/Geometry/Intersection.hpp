@@ -0,0 +1,87 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <lug/Math/Geometry/Aabb.hpp>
+#include <lug/Math/Geometry/Frustum.hpp>
+#include <lug/Math/Geometry/Obb.hpp>
+#include <lug/Math/Geometry/Plane.hpp>
+#include <lug/Math/Geometry/Ray.hpp>
+#include <lug/Math/Geometry/Sphere.hpp>
+#include <lug/Math/Vector.hpp>
+
+// The tests don't branch on the intermediate results, see Batch for the tests of many primitives at once
+
+namespace lug {
+namespace Math {
+namespace Geometry {
+
+/**
+ * @brief      Tests whether a volume intersects a frustum.
+ *
+ *             The test is conservative: volumes near a corner of the frustum may be kept although outside.
+ */
+template <typename T>
+bool intersects(const Frustum<T>& frustum, const Aabb<T>& aabb);
+
+template <typename T>
+bool intersects(const Frustum<T>& frustum, const Sphere<T>& sphere);
+
+template <typename T>
+bool intersects(const Frustum<T>& frustum, const Obb<T>& obb);
+
+template <typename T>
+constexpr bool intersects(const Sphere<T>& lhs, const Sphere<T>& rhs);
+
+template <typename T>
+constexpr bool intersects(const Aabb<T>& lhs, const Aabb<T>& rhs);
+
+template <typename T>
+bool intersects(const Sphere<T>& sphere, const Aabb<T>& aabb);
+
+/**
+ * @brief      Tests whether a ray intersects a volume.
+ *
+ * @param[in]  ray       The ray.
+ * @param[in]  aabb      The box.
+ * @param      distance  The distance along the ray of the first intersection, 0 if the origin is inside the volume.
+ *                       Only set on intersection.
+ *
+ * @return     Whether the ray intersects the volume.
+ */
+template <typename T>
+bool intersects(const Ray<T>& ray, const Aabb<T>& aabb, T& distance);
+
+template <typename T>
+bool intersects(const Ray<T>& ray, const Obb<T>& obb, T& distance);
+
+template <typename T>
+bool intersects(const Ray<T>& ray, const Sphere<T>& sphere, T& distance);
+
+/**
+ * @brief      Tests whether a ray intersects a plane, from either side.
+ */
+template <typename T>
+bool intersects(const Ray<T>& ray, const Plane<T>& plane, T& distance);
+
+/**
+ * @brief      Tests whether a ray intersects a triangle, from either side (Moller-Trumbore).
+ *
+ * @param[in]  ray          The ray.
+ * @param[in]  v0           The first vertex of the triangle.
+ * @param[in]  v1           The second vertex of the triangle.
+ * @param[in]  v2           The third vertex of the triangle.
+ * @param      distance     The distance along the ray of the intersection. Only set on intersection.
+ *
+ * @return     Whether the ray intersects the triangle.
+ */
+template <typename T>
+bool intersects(const Ray<T>& ray, const Vector<3, T>& v0, const Vector<3, T>& v1, const Vector<3, T>& v2, T& distance);
+
+#include <lug/Math/Geometry/Intersection.inl>
+
+} // Geometry
+} // Math
+} // lug
@@ -0,0 +1,163 @@
+template <typename T>
+inline bool intersects(const Frustum<T>& frustum, const Aabb<T>& aabb) {
+    const Vector<3, T> center = aabb.getCenter();
+    const Vector<3, T> extent = aabb.getExtent();
+
+    bool visible = true;
+    for (const Plane<T>& plane : frustum.planes) {
+        // Projection of the extent on the normal of the plane
+        const T radius = std::abs(plane.normal.x()) * extent.x() + std::abs(plane.normal.y()) * extent.y() + std::abs(plane.normal.z()) * extent.z();
+
+        visible &= plane.getDistance(center) + radius >= T(0);
+    }
+
+    return visible;
+}
+
+template <typename T>
+inline bool intersects(const Frustum<T>& frustum, const Sphere<T>& sphere) {
+    bool visible = true;
+    for (const Plane<T>& plane : frustum.planes) {
+        visible &= plane.getDistance(sphere.center) + sphere.radius >= T(0);
+    }
+
+    return visible;
+}
+
+template <typename T>
+inline bool intersects(const Frustum<T>& frustum, const Obb<T>& obb) {
+    bool visible = true;
+    for (const Plane<T>& plane : frustum.planes) {
+        const T radius = std::abs(dot(plane.normal, obb.axes[0])) * obb.extent.x() +
+            std::abs(dot(plane.normal, obb.axes[1])) * obb.extent.y() +
+            std::abs(dot(plane.normal, obb.axes[2])) * obb.extent.z();
+
+        visible &= plane.getDistance(obb.center) + radius >= T(0);
+    }
+
+    return visible;
+}
+
+template <typename T>
+inline constexpr bool intersects(const Sphere<T>& lhs, const Sphere<T>& rhs) {
+    return Vector<3, T>(lhs.center - rhs.center).squaredLength() <= (lhs.radius + rhs.radius) * (lhs.radius + rhs.radius);
+}
+
+template <typename T>
+inline constexpr bool intersects(const Aabb<T>& lhs, const Aabb<T>& rhs) {
+    return (lhs.min.x() <= rhs.max.x()) & (lhs.max.x() >= rhs.min.x()) &
+        (lhs.min.y() <= rhs.max.y()) & (lhs.max.y() >= rhs.min.y()) &
+        (lhs.min.z() <= rhs.max.z()) & (lhs.max.z() >= rhs.min.z());
+}
+
+template <typename T>
+inline bool intersects(const Sphere<T>& sphere, const Aabb<T>& aabb) {
+    // Distance from the center to the closest point of the box
+    T squaredDistance = T(0);
+    for (uint8_t axis = 0; axis < 3; ++axis) {
+        const T closest = std::max(aabb.min(axis), std::min(sphere.center(axis), aabb.max(axis)));
+        squaredDistance += (sphere.center(axis) - closest) * (sphere.center(axis) - closest);
+    }
+
+    return squaredDistance <= sphere.radius * sphere.radius;
+}
+
+template <typename T>
+inline bool intersects(const Ray<T>& ray, const Aabb<T>& aabb, T& distance) {
+    // Slab test, the infinite inverses of the null components give infinite distances
+    T near = T(0);
+    T far = std::numeric_limits<T>::infinity();
+
+    for (uint8_t axis = 0; axis < 3; ++axis) {
+        const T inverseDirection = T(1) / ray.direction(axis);
+        const T t1 = (aabb.min(axis) - ray.origin(axis)) * inverseDirection;
+        const T t2 = (aabb.max(axis) - ray.origin(axis)) * inverseDirection;
+
+        near = std::max(near, std::min(t1, t2));
+        far = std::min(far, std::max(t1, t2));
+    }
+
+    if (near > far) {
+        return false;
+    }
+
+    distance = near;
+    return true;
+}
+
+template <typename T>
+inline bool intersects(const Ray<T>& ray, const Obb<T>& obb, T& distance) {
+    // Same as the box in the space of the box
+    const Vector<3, T> offset = ray.origin - obb.center;
+
+    const Ray<T> localRay{
+        {dot(offset, obb.axes[0]), dot(offset, obb.axes[1]), dot(offset, obb.axes[2])},
+        {dot(ray.direction, obb.axes[0]), dot(ray.direction, obb.axes[1]), dot(ray.direction, obb.axes[2])}
+    };
+
+    return intersects(localRay, Aabb<T>(-obb.extent, obb.extent), distance);
+}
+
+template <typename T>
+inline bool intersects(const Ray<T>& ray, const Sphere<T>& sphere, T& distance) {
+    const Vector<3, T> offset = ray.origin - sphere.center;
+
+    // Roots of a * t^2 + 2 * b * t + c
+    const T a = ray.direction.squaredLength();
+    const T b = dot(offset, ray.direction);
+    const T c = offset.squaredLength() - sphere.radius * sphere.radius;
+    const T discriminant = b * b - a * c;
+
+    if (discriminant < T(0)) {
+        return false;
+    }
+
+    const T far = (-b + std::sqrt(discriminant)) / a;
+    if (far < T(0)) {
+        return false;
+    }
+
+    distance = std::max(T(0), (-b - std::sqrt(discriminant)) / a);
+    return true;
+}
+
+template <typename T>
+inline bool intersects(const Ray<T>& ray, const Plane<T>& plane, T& distance) {
+    const T denominator = dot(plane.normal, ray.direction);
+    const T t = -plane.getDistance(ray.origin) / denominator;
+
+    // Parallel rays give an infinite or a NaN distance
+    if (!(t >= T(0) && t < std::numeric_limits<T>::infinity())) {
+        return false;
+    }
+
+    distance = t;
+    return true;
+}
+
+template <typename T>
+inline bool intersects(const Ray<T>& ray, const Vector<3, T>& v0, const Vector<3, T>& v1, const Vector<3, T>& v2, T& distance) {
+    const Vector<3, T> edge1 = v1 - v0;
+    const Vector<3, T> edge2 = v2 - v0;
+
+    const Vector<3, T> p = cross(ray.direction, edge2);
+    const T det = dot(edge1, p);
+    const T inverseDet = T(1) / det;
+
+    const Vector<3, T> s = ray.origin - v0;
+    const T u = dot(s, p) * inverseDet;
+
+    const Vector<3, T> q = cross(s, edge1);
+    const T v = dot(ray.direction, q) * inverseDet;
+    const T t = dot(edge2, q) * inverseDet;
+
+    // The rays parallel to the triangle are rejected by the determinant
+    const bool hit = (std::abs(det) > std::numeric_limits<T>::epsilon()) & (u >= T(0)) & (v >= T(0)) & (u + v <= T(1)) & (t >= T(0));
+
+    if (!hit) {
+        return false;
+    }
+
+    distance = t;
+    return true;
+}
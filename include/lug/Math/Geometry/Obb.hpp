@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cmath>
+
+#include <lug/Math/Geometry/Aabb.hpp>
+#include <lug/Math/Matrix.hpp>
+#include <lug/Math/Vector.hpp>
+
+namespace lug {
+namespace Math {
+namespace Geometry {
+
+/**
+ * @brief      Oriented bounding box.
+ */
+template <typename T = float>
+struct Obb {
+    Obb() = default;
+
+    /**
+     * @brief      Constructs the box.
+     *
+     * @param[in]  center  The center.
+     * @param[in]  axes    The axes of the box, orthonormal.
+     * @param[in]  extent  The half size of the box along each axis.
+     */
+    Obb(const Vector<3, T>& center, const Vector<3, T> (&axes)[3], const Vector<3, T>& extent);
+
+    /**
+     * @brief      Constructs the box @p aabb transformed by @p matrix, which can't have a shear.
+     */
+    Obb(const Aabb<T>& aabb, const Matrix<4, 4, T>& matrix);
+
+    Obb(const Obb<T>&) = default;
+    Obb(Obb<T>&&) = default;
+
+    Obb<T>& operator=(const Obb<T>&) = default;
+    Obb<T>& operator=(Obb<T>&&) = default;
+
+    ~Obb() = default;
+
+    bool contains(const Vector<3, T>& point) const;
+
+    Vector<3, T> center;
+    Vector<3, T> axes[3];
+    Vector<3, T> extent;
+};
+
+using Obbf = Obb<float>;
+using Obbd = Obb<double>;
+
+#include <lug/Math/Geometry/Obb.inl>
+
+} // Geometry
+} // Math
+} // lug
@@ -0,0 +1,32 @@
+template <typename T>
+inline Obb<T>::Obb(const Vector<3, T>& center, const Vector<3, T> (&axes)[3], const Vector<3, T>& extent) :
+    center(center), axes{axes[0], axes[1], axes[2]}, extent(extent) {}
+
+template <typename T>
+inline Obb<T>::Obb(const Aabb<T>& aabb, const Matrix<4, 4, T>& matrix) {
+    const Vector<3, T> aabbCenter = aabb.getCenter();
+    const Vector<3, T> aabbExtent = aabb.getExtent();
+
+    for (uint8_t axis = 0; axis < 3; ++axis) {
+        // The scale of the matrix is moved from the axes to the extent
+        const Vector<3, T> column{matrix(0, axis), matrix(1, axis), matrix(2, axis)};
+        const T length = column.length();
+
+        axes[axis] = column / length;
+        extent(axis) = aabbExtent(axis) * length;
+        center(axis) = matrix(axis, 3) + matrix(axis, 0) * aabbCenter(0) + matrix(axis, 1) * aabbCenter(1) + matrix(axis, 2) * aabbCenter(2);
+    }
+}
+
+template <typename T>
+inline bool Obb<T>::contains(const Vector<3, T>& point) const {
+    const Vector<3, T> offset = point - center;
+
+    for (uint8_t axis = 0; axis < 3; ++axis) {
+        if (std::abs(dot(offset, axes[axis])) > extent(axis)) {
+            return false;
+        }
+    }
+
+    return true;
+}
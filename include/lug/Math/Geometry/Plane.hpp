@@ -0,0 +1,59 @@
+#pragma once
+
+#include <lug/Math/Vector.hpp>
+
+namespace lug {
+namespace Math {
+namespace Geometry {
+
+/**
+ * @brief      Plane of the points p where dot(normal, p) + distance == 0.
+ *
+ *             The positive side, e.g. the inside of a Frustum, is where dot(normal, p) + distance >= 0.
+ */
+template <typename T = float>
+struct Plane {
+    Plane() = default;
+
+    constexpr Plane(const Vector<3, T>& normal, T distance);
+
+    /**
+     * @brief      Constructs the plane of normal @p normal passing through @p point.
+     */
+    constexpr Plane(const Vector<3, T>& normal, const Vector<3, T>& point);
+
+    /**
+     * @brief      Constructs the plane from its coefficients {a, b, c, d} and normalizes it.
+     */
+    explicit Plane(const Vector<4, T>& coefficients);
+
+    Plane(const Plane<T>&) = default;
+    Plane(Plane<T>&&) = default;
+
+    Plane<T>& operator=(const Plane<T>&) = default;
+    Plane<T>& operator=(Plane<T>&&) = default;
+
+    ~Plane() = default;
+
+    /**
+     * @brief      Returns the signed distance of @p point to the plane, positive on the side of the normal.
+     */
+    constexpr T getDistance(const Vector<3, T>& point) const;
+
+    constexpr Vector<4, T> getCoefficients() const;
+
+    void normalize();
+
+    Vector<3, T> normal;
+    T distance;
+};
+
+using Planef = Plane<float>;
+
+using Planed = Plane<double>;
+
+#include <lug/Math/Geometry/Plane.inl>
+
+} // Geometry
+} // Math
+} // lug
@@ -0,0 +1,28 @@
+template <typename T>
+inline constexpr Plane<T>::Plane(const Vector<3, T>& normal, T distance) : normal(normal), distance(distance) {}
+
+template <typename T>
+inline constexpr Plane<T>::Plane(const Vector<3, T>& normal, const Vector<3, T>& point) : normal(normal), distance(-dot(normal, point)) {}
+
+template <typename T>
+inline Plane<T>::Plane(const Vector<4, T>& coefficients) : normal(Vector<3, T>(coefficients)), distance(coefficients.w()) {
+    normalize();
+}
+
+template <typename T>
+inline constexpr T Plane<T>::getDistance(const Vector<3, T>& point) const {
+    return dot(normal, point) + distance;
+}
+
+template <typename T>
+inline constexpr Vector<4, T> Plane<T>::getCoefficients() const {
+    return Vector<4, T>(normal, distance);
+}
+
+template <typename T>
+inline void Plane<T>::normalize() {
+    const T length = normal.length();
+
+    normal = normal / length;
+    distance /= length;
+}
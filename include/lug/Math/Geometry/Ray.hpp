@@ -0,0 +1,42 @@
+#pragma once
+
+#include <lug/Math/Vector.hpp>
+
+namespace lug {
+namespace Math {
+namespace Geometry {
+
+template <typename T = float>
+struct Ray {
+    Ray() = default;
+
+    /**
+     * @brief      Constructs the ray.
+     *
+     * @param[in]  origin     The origin.
+     * @param[in]  direction  The direction. The distances of the intersections are in multiples of its length.
+     */
+    constexpr Ray(const Vector<3, T>& origin, const Vector<3, T>& direction);
+
+    Ray(const Ray<T>&) = default;
+    Ray(Ray<T>&&) = default;
+
+    Ray<T>& operator=(const Ray<T>&) = default;
+    Ray<T>& operator=(Ray<T>&&) = default;
+
+    ~Ray() = default;
+
+    constexpr Vector<3, T> getPoint(T distance) const;
+
+    Vector<3, T> origin;
+    Vector<3, T> direction;
+};
+
+using Rayf = Ray<float>;
+using Rayd = Ray<double>;
+
+#include <lug/Math/Geometry/Ray.inl>
+
+} // Geometry
+} // Math
+} // lug
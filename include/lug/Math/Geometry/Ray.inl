@@ -0,0 +1,7 @@
+template <typename T>
+inline constexpr Ray<T>::Ray(const Vector<3, T>& origin, const Vector<3, T>& direction) : origin(origin), direction(direction) {}
+
+template <typename T>
+inline constexpr Vector<3, T> Ray<T>::getPoint(T distance) const {
+    return origin + direction * distance;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <lug/Math/Vector.hpp>
+
+namespace lug {
+namespace Math {
+namespace Geometry {
+
+template <typename T = float>
+struct Sphere {
+    Sphere() = default;
+
+    constexpr Sphere(const Vector<3, T>& center, T radius);
+
+    Sphere(const Sphere<T>&) = default;
+    Sphere(Sphere<T>&&) = default;
+
+    Sphere<T>& operator=(const Sphere<T>&) = default;
+    Sphere<T>& operator=(Sphere<T>&&) = default;
+
+    ~Sphere() = default;
+
+    constexpr bool contains(const Vector<3, T>& point) const;
+
+    Vector<3, T> center;
+    T radius;
+};
+
+using Spheref = Sphere<float>;
+using Sphered = Sphere<double>;
+
+#include <lug/Math/Geometry/Sphere.inl>
+
+} // Geometry
+} // Math
+} // lug
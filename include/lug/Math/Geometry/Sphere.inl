@@ -0,0 +1,7 @@
+template <typename T>
+inline constexpr Sphere<T>::Sphere(const Vector<3, T>& center, T radius) : center(center), radius(radius) {}
+
+template <typename T>
+inline constexpr bool Sphere<T>::contains(const Vector<3, T>& point) const {
+    return Vector<3, T>(point - center).squaredLength() <= radius * radius;
+}
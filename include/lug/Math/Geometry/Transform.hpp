@@ -2,6 +2,7 @@
 
 #include <lug/Math/Geometry/Trigonometry.hpp>
 #include <lug/Math/Matrix.hpp>
+#include <lug/Math/Quaternion.hpp>
 #include <lug/Math/Vector.hpp>
 
 namespace lug {
@@ -28,6 +29,35 @@ Matrix<4, 4, T> ortho(T left, T right, T bottom, T top, T zNear, T zFar);
 template <typename T>
 Matrix<4, 4, T> perspective(T fovy, T aspect, T zNear, T zFar);
 
+/**
+ * @brief      Inverts a matrix whose last row is (0, 0, 0, 1).
+ *
+ *             Only the upper 3x3 part is inverted, which is much cheaper than Matrix::inverse.
+ */
+template <typename T>
+constexpr Matrix<4, 4, T> affineInverse(const Matrix<4, 4, T>& matrix);
+
+/**
+ * @brief      Inverts a matrix made only of a rotation and a translation.
+ *
+ *             The rotation is inverted by transposing it.
+ */
+template <typename T>
+constexpr Matrix<4, 4, T> rigidInverse(const Matrix<4, 4, T>& matrix);
+
+/**
+ * @brief      Builds the inverse of translate(position) * rotation.transform() * scale(factors).
+ *
+ *             The inverse is composed directly as scale(1 / factors) * conjugate(rotation).transform() * translate(-position),
+ *             without building the matrix first.
+ *
+ * @param[in]  position  The translation.
+ * @param[in]  rotation  The rotation, must be normalized.
+ * @param[in]  factors   The scale, none of its components can be zero.
+ */
+template <typename T>
+constexpr Matrix<4, 4, T> inverseTransform(const Vector<3, T>& position, const Quaternion<T>& rotation, const Vector<3, T>& factors);
+
 #include <lug/Math/Geometry/Transform.inl>
 
 } // Geometry
@@ -105,3 +105,81 @@ inline Matrix<4, 4, T> perspective(T fovy, T aspect, T zNear, T zFar) {
 
     return matrix;
 }
+
+template <typename T>
+inline constexpr Matrix<4, 4, T> affineInverse(const Matrix<4, 4, T>& matrix) {
+    const T c00 = matrix(1, 1) * matrix(2, 2) - matrix(1, 2) * matrix(2, 1);
+    const T c01 = matrix(1, 2) * matrix(2, 0) - matrix(1, 0) * matrix(2, 2);
+    const T c02 = matrix(1, 0) * matrix(2, 1) - matrix(1, 1) * matrix(2, 0);
+
+    const T c10 = matrix(0, 2) * matrix(2, 1) - matrix(0, 1) * matrix(2, 2);
+    const T c11 = matrix(0, 0) * matrix(2, 2) - matrix(0, 2) * matrix(2, 0);
+    const T c12 = matrix(0, 1) * matrix(2, 0) - matrix(0, 0) * matrix(2, 1);
+
+    const T c20 = matrix(0, 1) * matrix(1, 2) - matrix(0, 2) * matrix(1, 1);
+    const T c21 = matrix(0, 2) * matrix(1, 0) - matrix(0, 0) * matrix(1, 2);
+    const T c22 = matrix(0, 0) * matrix(1, 1) - matrix(0, 1) * matrix(1, 0);
+
+    const T invDet = T(1) / (matrix(0, 0) * c00 + matrix(0, 1) * c01 + matrix(0, 2) * c02);
+
+    // The inverse of the 3x3 part is the transpose of the cofactors divided by the determinant
+    const T i00 = c00 * invDet, i01 = c10 * invDet, i02 = c20 * invDet;
+    const T i10 = c01 * invDet, i11 = c11 * invDet, i12 = c21 * invDet;
+    const T i20 = c02 * invDet, i21 = c12 * invDet, i22 = c22 * invDet;
+
+    const T tx = matrix(0, 3);
+    const T ty = matrix(1, 3);
+    const T tz = matrix(2, 3);
+
+    return Matrix<4, 4, T> {
+        i00, i01, i02, -(i00 * tx + i01 * ty + i02 * tz),
+        i10, i11, i12, -(i10 * tx + i11 * ty + i12 * tz),
+        i20, i21, i22, -(i20 * tx + i21 * ty + i22 * tz),
+        T(0), T(0), T(0), T(1)
+    };
+}
+
+template <typename T>
+inline constexpr Matrix<4, 4, T> rigidInverse(const Matrix<4, 4, T>& matrix) {
+    const T tx = matrix(0, 3);
+    const T ty = matrix(1, 3);
+    const T tz = matrix(2, 3);
+
+    return Matrix<4, 4, T> {
+        matrix(0, 0), matrix(1, 0), matrix(2, 0), -(matrix(0, 0) * tx + matrix(1, 0) * ty + matrix(2, 0) * tz),
+        matrix(0, 1), matrix(1, 1), matrix(2, 1), -(matrix(0, 1) * tx + matrix(1, 1) * ty + matrix(2, 1) * tz),
+        matrix(0, 2), matrix(1, 2), matrix(2, 2), -(matrix(0, 2) * tx + matrix(1, 2) * ty + matrix(2, 2) * tz),
+        T(0), T(0), T(0), T(1)
+    };
+}
+
+template <typename T>
+inline constexpr Matrix<4, 4, T> inverseTransform(const Vector<3, T>& position, const Quaternion<T>& rotation, const Vector<3, T>& factors) {
+    const T xx = rotation.x() * rotation.x();
+    const T xy = rotation.x() * rotation.y();
+    const T xz = rotation.x() * rotation.z();
+    const T wx = rotation.w() * rotation.x();
+
+    const T yy = rotation.y() * rotation.y();
+    const T yz = rotation.y() * rotation.z();
+    const T wy = rotation.w() * rotation.y();
+
+    const T zz = rotation.z() * rotation.z();
+    const T wz = rotation.w() * rotation.z();
+
+    const T invX = T(1) / factors.x();
+    const T invY = T(1) / factors.y();
+    const T invZ = T(1) / factors.z();
+
+    // Rows of the transposed rotation matrix (see Quaternion::transform), scaled by the inverse of the factors
+    const T i00 = (T(1) - T(2) * (yy + zz)) * invX, i01 = T(2) * (xy + wz) * invX, i02 = T(2) * (xz - wy) * invX;
+    const T i10 = T(2) * (xy - wz) * invY, i11 = (T(1) - T(2) * (xx + zz)) * invY, i12 = T(2) * (yz + wx) * invY;
+    const T i20 = T(2) * (xz + wy) * invZ, i21 = T(2) * (yz - wx) * invZ, i22 = (T(1) - T(2) * (xx + yy)) * invZ;
+
+    return Matrix<4, 4, T> {
+        i00, i01, i02, -(i00 * position.x() + i01 * position.y() + i02 * position.z()),
+        i10, i11, i12, -(i10 * position.x() + i11 * position.y() + i12 * position.z()),
+        i20, i21, i22, -(i20 * position.x() + i21 * position.y() + i22 * position.z()),
+        T(0), T(0), T(0), T(1)
+    };
+}
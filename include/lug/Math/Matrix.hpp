@@ -18,9 +18,13 @@ public:
 public:
     constexpr Matrix() = default;
 
-    explicit Matrix(T value);
-    Matrix(const Values& values);
-    Matrix(std::initializer_list<T> list);
+    explicit constexpr Matrix(T value);
+    constexpr Matrix(const Values& values);
+
+    /**
+     * @brief      Constructs the matrix from its values, row by row.
+     */
+    constexpr Matrix(std::initializer_list<T> list);
     Matrix(const Matrix<Rows, Columns, T>& matrix) = default;
     Matrix(Matrix<Rows, Columns, T>&& matrix) = default;
 
@@ -69,13 +73,13 @@ public:
 #if defined(LUG_COMPILER_MSVC)
 
     template <typename = typename std::enable_if<(Rows == 1)>::type>
-    Matrix<Rows, Columns, T> inverse() const;
+    constexpr Matrix<Rows, Columns, T> inverse() const;
 
     template <typename = typename std::enable_if<(Rows == 2)>::type, typename = void>
-    Matrix<Rows, Columns, T> inverse() const;
+    constexpr Matrix<Rows, Columns, T> inverse() const;
 
     template <typename = typename std::enable_if<(Rows == 3)>::type, typename = void, typename = void>
-    Matrix<Rows, Columns, T> inverse() const;
+    constexpr Matrix<Rows, Columns, T> inverse() const;
 
     template <typename = typename std::enable_if<(Rows == 4)>::type, typename = void, typename = void, typename = void>
     Matrix<Rows, Columns, T> inverse() const;
@@ -83,34 +87,34 @@ public:
 #else
 
     template <bool EnableBool = true>
-    typename std::enable_if<(Rows == 1) && EnableBool, Matrix<Rows, Columns, T>>::type inverse() const;
+    constexpr typename std::enable_if<(Rows == 1) && EnableBool, Matrix<Rows, Columns, T>>::type inverse() const;
 
     template <bool EnableBool = true>
-    typename std::enable_if<(Rows == 2) && EnableBool, Matrix<Rows, Columns, T>>::type inverse() const;
+    constexpr typename std::enable_if<(Rows == 2) && EnableBool, Matrix<Rows, Columns, T>>::type inverse() const;
 
     template <bool EnableBool = true>
-    typename std::enable_if<(Rows == 3) && EnableBool, Matrix<Rows, Columns, T>>::type inverse() const;
+    constexpr typename std::enable_if<(Rows == 3) && EnableBool, Matrix<Rows, Columns, T>>::type inverse() const;
 
     template <bool EnableBool = true>
     typename std::enable_if<(Rows == 4) && EnableBool, Matrix<Rows, Columns, T>>::type inverse() const;
 
 #endif
 
-    Matrix<Columns, Rows, T> transpose() const;
+    constexpr Matrix<Columns, Rows, T> transpose() const;
 
 #if defined(LUG_COMPILER_MSVC)
 
     template <typename = typename std::enable_if<(Rows == 1)>::type>
-    T det() const;
+    constexpr T det() const;
 
     template <typename = typename std::enable_if<(Rows == 2)>::type, typename = void>
-    T det() const;
+    constexpr T det() const;
 
     template <typename = typename std::enable_if<(Rows == 3)>::type, typename = void, typename = void>
-    T det() const;
+    constexpr T det() const;
 
     template <typename = typename std::enable_if<(Rows == 4)>::type, typename = void, typename = void, typename = void>
-    T det() const;
+    constexpr T det() const;
 
     template <typename = typename std::enable_if<(Rows > 4)>::type, typename = void, typename = void, typename = void, typename = void>
     T det() const;
@@ -118,16 +122,16 @@ public:
 #else
 
     template <bool EnableBool = true>
-    typename std::enable_if<(Rows == 1) && EnableBool, T>::type det() const;
+    constexpr typename std::enable_if<(Rows == 1) && EnableBool, T>::type det() const;
 
     template <bool EnableBool = true>
-    typename std::enable_if<(Rows == 2) && EnableBool, T>::type det() const;
+    constexpr typename std::enable_if<(Rows == 2) && EnableBool, T>::type det() const;
 
     template <bool EnableBool = true>
-    typename std::enable_if<(Rows == 3) && EnableBool, T>::type det() const;
+    constexpr typename std::enable_if<(Rows == 3) && EnableBool, T>::type det() const;
 
     template <bool EnableBool = true>
-    typename std::enable_if<(Rows == 4) && EnableBool, T>::type det() const;
+    constexpr typename std::enable_if<(Rows == 4) && EnableBool, T>::type det() const;
 
     template <bool EnableBool = true>
     typename std::enable_if<(Rows > 4) && EnableBool, T>::type det() const;
@@ -137,15 +141,28 @@ public:
 #if defined(LUG_COMPILER_MSVC)
 
     template <typename = typename std::enable_if<(Rows == Columns)>::type>
-    static Matrix<Rows, Columns, T> identity();
+    static constexpr Matrix<Rows, Columns, T> identity();
 
 #else
 
     template <bool EnableBool = true>
-    static typename std::enable_if<(Rows == Columns) && EnableBool, Matrix<Rows, Columns, T>>::type identity();
+    static constexpr typename std::enable_if<(Rows == Columns) && EnableBool, Matrix<Rows, Columns, T>>::type identity();
 
 #endif
 
+private:
+    // The values are built at once, see ValArray
+    template <size_t... Indices>
+    static constexpr Values fromRows(std::initializer_list<T> list, std::index_sequence<Indices...>);
+
+    template <size_t... Indices>
+    static constexpr Values identityValues(std::index_sequence<Indices...>);
+
+    template <size_t... Indices>
+    constexpr ValArray<Columns * Rows, T> transposeValues(std::index_sequence<Indices...>) const;
+
+    static void assertInitializerListSize(size_t size);
+
 protected:
     Values _values;
 };
@@ -180,39 +197,39 @@ DEFINE_LENGTH_MATRIX(4, 4)
 
 // Unary operations
 template <uint8_t Rows, uint8_t Columns, typename T>
-Matrix<Rows, Columns, T> operator-(const Matrix<Rows, Columns, T>& lhs);
+constexpr Matrix<Rows, Columns, T> operator-(const Matrix<Rows, Columns, T>& lhs);
 
 // Matrix/Scalar operations
 template <uint8_t Rows, uint8_t Columns, typename T>
-Matrix<Rows, Columns, T> operator+(const Matrix<Rows, Columns, T>& lhs, T rhs);
+constexpr Matrix<Rows, Columns, T> operator+(const Matrix<Rows, Columns, T>& lhs, T rhs);
 
 template <uint8_t Rows, uint8_t Columns, typename T>
-Matrix<Rows, Columns, T> operator-(const Matrix<Rows, Columns, T>& lhs, T rhs);
+constexpr Matrix<Rows, Columns, T> operator-(const Matrix<Rows, Columns, T>& lhs, T rhs);
 
 template <uint8_t Rows, uint8_t Columns, typename T>
-Matrix<Rows, Columns, T> operator*(const Matrix<Rows, Columns, T>& lhs, T rhs);
+constexpr Matrix<Rows, Columns, T> operator*(const Matrix<Rows, Columns, T>& lhs, T rhs);
 
 template <uint8_t Rows, uint8_t Columns, typename T>
-Matrix<Rows, Columns, T> operator/(const Matrix<Rows, Columns, T>& lhs, T rhs);
+constexpr Matrix<Rows, Columns, T> operator/(const Matrix<Rows, Columns, T>& lhs, T rhs);
 
 template <uint8_t Rows, uint8_t Columns, typename T>
-Matrix<Rows, Columns, T> operator+(T lhs, const Matrix<Rows, Columns, T>& rhs);
+constexpr Matrix<Rows, Columns, T> operator+(T lhs, const Matrix<Rows, Columns, T>& rhs);
 
 template <uint8_t Rows, uint8_t Columns, typename T>
-Matrix<Rows, Columns, T> operator-(T lhs, const Matrix<Rows, Columns, T>& rhs);
+constexpr Matrix<Rows, Columns, T> operator-(T lhs, const Matrix<Rows, Columns, T>& rhs);
 
 template <uint8_t Rows, uint8_t Columns, typename T>
-Matrix<Rows, Columns, T> operator*(T lhs, const Matrix<Rows, Columns, T>& rhs);
+constexpr Matrix<Rows, Columns, T> operator*(T lhs, const Matrix<Rows, Columns, T>& rhs);
 
 template <uint8_t Rows, uint8_t Columns, typename T>
-Matrix<Rows, Columns, T> operator/(T lhs, const Matrix<Rows, Columns, T>& rhs);
+constexpr Matrix<Rows, Columns, T> operator/(T lhs, const Matrix<Rows, Columns, T>& rhs);
 
 // Matrix/Matrix operation
 template <uint8_t Rows, uint8_t Columns, typename T>
-Matrix<Rows, Columns, T> operator+(const Matrix<Rows, Columns, T>& lhs, const Matrix<Rows, Columns, T>& rhs);
+constexpr Matrix<Rows, Columns, T> operator+(const Matrix<Rows, Columns, T>& lhs, const Matrix<Rows, Columns, T>& rhs);
 
 template <uint8_t Rows, uint8_t Columns, typename T>
-Matrix<Rows, Columns, T> operator-(const Matrix<Rows, Columns, T>& lhs, const Matrix<Rows, Columns, T>& rhs);
+constexpr Matrix<Rows, Columns, T> operator-(const Matrix<Rows, Columns, T>& lhs, const Matrix<Rows, Columns, T>& rhs);
 
 template <uint8_t RowsLeft, uint8_t ColumnsLeft, uint8_t RowsRight, uint8_t ColumnsRight, typename T>
 Matrix<RowsLeft, ColumnsRight, T> operator*(const Matrix<RowsLeft, ColumnsLeft, T>& lhs, const Matrix<RowsRight, ColumnsRight, T>& rhs);
@@ -222,10 +239,10 @@ Matrix<RowsLeft, ColumnsRight, T> operator/(const Matrix<RowsLeft, ColumnsLeft,
 
 // Comparaison operators
 template <uint8_t Rows, uint8_t Columns, typename T>
-bool operator==(const Matrix<Rows, Columns, T>& lhs, const Matrix<Rows, Columns, T>& rhs);
+constexpr bool operator==(const Matrix<Rows, Columns, T>& lhs, const Matrix<Rows, Columns, T>& rhs);
 
 template <uint8_t Rows, uint8_t Columns, typename T>
-bool operator!=(const Matrix<Rows, Columns, T>& lhs, const Matrix<Rows, Columns, T>& rhs);
+constexpr bool operator!=(const Matrix<Rows, Columns, T>& lhs, const Matrix<Rows, Columns, T>& rhs);
 
 template <uint8_t Rows, uint8_t Columns, typename T>
 std::ostream& operator<<(std::ostream& os, const Matrix<Rows, Columns, T>& matrix);
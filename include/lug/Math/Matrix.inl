@@ -1,32 +1,42 @@
 template <uint8_t Rows, uint8_t Columns, typename T>
-inline Matrix<Rows, Columns, T>::Matrix(T value) : _values(Rows * Columns) {
+inline constexpr Matrix<Rows, Columns, T>::Matrix(T value) : _values(value) {
     static_assert(std::is_arithmetic<T>::value, "Can't construct matrix with non integral type");
+}
 
-    for (uint8_t row = 0; row < Rows; ++row) {
-        for (uint8_t col = 0; col < Columns; ++col) {
-            (*this)(row, col) = value;
-        }
+template <uint8_t Rows, uint8_t Columns, typename T>
+inline constexpr Matrix<Rows, Columns, T>::Matrix(const Values& values) : _values{values} {}
+
+template <uint8_t Rows, uint8_t Columns, typename T>
+inline constexpr Matrix<Rows, Columns, T>::Matrix(std::initializer_list<T> list) : _values(fromRows(list, std::make_index_sequence<Rows * Columns>())) {
+    if (list.size() != Rows * Columns) {
+        assertInitializerListSize(list.size());
     }
 }
 
 template <uint8_t Rows, uint8_t Columns, typename T>
-inline Matrix<Rows, Columns, T>::Matrix(const Values& values) : _values{values} {
-    LUG_ASSERT(values.size() == Rows * Columns, "Matrix construct with bad size initializer list");
+template <size_t... Indices>
+inline constexpr typename Matrix<Rows, Columns, T>::Values Matrix<Rows, Columns, T>::fromRows(std::initializer_list<T> list, std::index_sequence<Indices...>) {
+    // The values are stored column by column
+    return {((Indices % Rows) * Columns + Indices / Rows < list.size() ? list.begin()[(Indices % Rows) * Columns + Indices / Rows] : T(0))...};
 }
 
 template <uint8_t Rows, uint8_t Columns, typename T>
-inline Matrix<Rows, Columns, T>::Matrix(std::initializer_list<T> list) {
-    LUG_ASSERT(list.size() == Rows * Columns, "Matrix construct with bad size initializer list");
+template <size_t... Indices>
+inline constexpr typename Matrix<Rows, Columns, T>::Values Matrix<Rows, Columns, T>::identityValues(std::index_sequence<Indices...>) {
+    return {(Indices % Rows == Indices / Rows ? T(1) : T(0))...};
+}
 
-    auto it = std::begin(list);
-    for (uint8_t row = 0; row < Rows; ++row) {
-        for (uint8_t col = 0; col < Columns; ++col) {
-            (*this)(row, col) = *it;
-            it++;
-        }
-    }
+template <uint8_t Rows, uint8_t Columns, typename T>
+template <size_t... Indices>
+inline constexpr ValArray<Columns * Rows, T> Matrix<Rows, Columns, T>::transposeValues(std::index_sequence<Indices...>) const {
+    return {_values[(Indices % Columns) * Rows + Indices / Columns]...};
 }
 
+template <uint8_t Rows, uint8_t Columns, typename T>
+inline void Matrix<Rows, Columns, T>::assertInitializerListSize(size_t size) {
+    LUG_ASSERT(size == Rows * Columns, "Matrix construct with bad size initializer list");
+    (void)size;
+}
 
 template <uint8_t Rows, uint8_t Columns, typename T>
 inline constexpr uint8_t Matrix<Rows, Columns, T>::getRows() const {
@@ -133,10 +143,10 @@ inline typename std::enable_if<(Rows == Columns) && EnableBool, Matrix<Rows, Col
 template <uint8_t Rows, uint8_t Columns, typename T>
 #if defined(LUG_COMPILER_MSVC)
 template <typename>
-inline Matrix<Rows, Columns, T> Matrix<Rows, Columns, T>::inverse() const
+inline constexpr Matrix<Rows, Columns, T> Matrix<Rows, Columns, T>::inverse() const
 #else
 template <bool EnableBool>
-inline typename std::enable_if<(Rows == 1) && EnableBool, Matrix<Rows, Columns, T>>::type Matrix<Rows, Columns, T>::inverse() const
+inline constexpr typename std::enable_if<(Rows == 1) && EnableBool, Matrix<Rows, Columns, T>>::type Matrix<Rows, Columns, T>::inverse() const
 #endif
 {
     static_assert(Rows == Columns, "The matrix has to be a square matrix to calculate the inverse");
@@ -146,10 +156,10 @@ inline typename std::enable_if<(Rows == 1) && EnableBool, Matrix<Rows, Columns,
 template <uint8_t Rows, uint8_t Columns, typename T>
 #if defined(LUG_COMPILER_MSVC)
 template <typename, typename>
-inline Matrix<Rows, Columns, T> Matrix<Rows, Columns, T>::inverse() const
+inline constexpr Matrix<Rows, Columns, T> Matrix<Rows, Columns, T>::inverse() const
 #else
 template <bool EnableBool>
-inline typename std::enable_if<(Rows == 2) && EnableBool, Matrix<Rows, Columns, T>>::type Matrix<Rows, Columns, T>::inverse() const
+inline constexpr typename std::enable_if<(Rows == 2) && EnableBool, Matrix<Rows, Columns, T>>::type Matrix<Rows, Columns, T>::inverse() const
 #endif
 {
     static_assert(Rows == Columns, "The matrix has to be a square matrix to calculate the inverse");
@@ -164,10 +174,10 @@ inline typename std::enable_if<(Rows == 2) && EnableBool, Matrix<Rows, Columns,
 template <uint8_t Rows, uint8_t Columns, typename T>
 #if defined(LUG_COMPILER_MSVC)
 template <typename, typename, typename>
-inline Matrix<Rows, Columns, T> Matrix<Rows, Columns, T>::inverse() const
+inline constexpr Matrix<Rows, Columns, T> Matrix<Rows, Columns, T>::inverse() const
 #else
 template <bool EnableBool>
-inline typename std::enable_if<(Rows == 3) && EnableBool, Matrix<Rows, Columns, T>>::type Matrix<Rows, Columns, T>::inverse() const
+inline constexpr typename std::enable_if<(Rows == 3) && EnableBool, Matrix<Rows, Columns, T>>::type Matrix<Rows, Columns, T>::inverse() const
 #endif
 {
     static_assert(Rows == Columns, "The matrix has to be a square matrix to calculate the inverse");
@@ -196,158 +206,69 @@ inline typename std::enable_if<(Rows == 4) && EnableBool, Matrix<Rows, Columns,
 #endif
 {
     static_assert(Rows == Columns, "The matrix has to be a square matrix to calculate the inverse");
-    return (1 / det()) * Matrix<Rows, Columns, T>{
-        // 11
-          (*this)(1, 1) * (*this)(2, 2) * (*this)(3, 3)
-        + (*this)(1, 2) * (*this)(2, 3) * (*this)(3, 1)
-        + (*this)(1, 3) * (*this)(2, 1) * (*this)(3, 2)
-        - (*this)(1, 1) * (*this)(2, 3) * (*this)(3, 2)
-        - (*this)(1, 2) * (*this)(2, 1) * (*this)(3, 3)
-        - (*this)(1, 3) * (*this)(2, 2) * (*this)(3, 1),
-
-        // 12
-          (*this)(0, 1) * (*this)(2, 3) * (*this)(3, 2)
-        + (*this)(0, 2) * (*this)(2, 1) * (*this)(3, 3)
-        + (*this)(0, 3) * (*this)(2, 2) * (*this)(3, 1)
-        - (*this)(0, 1) * (*this)(2, 2) * (*this)(3, 3)
-        - (*this)(0, 2) * (*this)(2, 3) * (*this)(3, 1)
-        - (*this)(0, 3) * (*this)(2, 1) * (*this)(3, 2),
-
-        // 13
-          (*this)(0, 1) * (*this)(1, 2) * (*this)(3, 3)
-        + (*this)(0, 2) * (*this)(1, 3) * (*this)(3, 1)
-        + (*this)(0, 3) * (*this)(1, 1) * (*this)(3, 2)
-        - (*this)(0, 1) * (*this)(1, 3) * (*this)(3, 2)
-        - (*this)(0, 2) * (*this)(1, 1) * (*this)(3, 3)
-        - (*this)(0, 3) * (*this)(1, 2) * (*this)(3, 1),
-
-        // 14
-          (*this)(0, 1) * (*this)(1, 3) * (*this)(2, 2)
-        + (*this)(0, 2) * (*this)(1, 1) * (*this)(2, 3)
-        + (*this)(0, 3) * (*this)(1, 2) * (*this)(2, 1)
-        - (*this)(0, 1) * (*this)(1, 2) * (*this)(2, 3)
-        - (*this)(0, 2) * (*this)(1, 3) * (*this)(2, 1)
-        - (*this)(0, 3) * (*this)(1, 1) * (*this)(2, 2),
-
-        // 21
-          (*this)(1, 0) * (*this)(2, 3) * (*this)(3, 2)
-        + (*this)(1, 2) * (*this)(2, 0) * (*this)(3, 3)
-        + (*this)(1, 3) * (*this)(2, 2) * (*this)(3, 0)
-        - (*this)(1, 0) * (*this)(2, 2) * (*this)(3, 3)
-        - (*this)(1, 2) * (*this)(2, 3) * (*this)(3, 0)
-        - (*this)(1, 3) * (*this)(2, 0) * (*this)(3, 2),
-
-        // 22
-          (*this)(0, 0) * (*this)(2, 2) * (*this)(3, 3)
-        + (*this)(0, 2) * (*this)(2, 3) * (*this)(3, 0)
-        + (*this)(0, 3) * (*this)(2, 0) * (*this)(3, 2)
-        - (*this)(0, 0) * (*this)(2, 3) * (*this)(3, 2)
-        - (*this)(0, 2) * (*this)(2, 0) * (*this)(3, 3)
-        - (*this)(0, 3) * (*this)(2, 2) * (*this)(3, 0),
-
-        // 23
-          (*this)(0, 0) * (*this)(1, 3) * (*this)(3, 2)
-        + (*this)(0, 2) * (*this)(1, 0) * (*this)(3, 3)
-        + (*this)(0, 3) * (*this)(1, 2) * (*this)(3, 0)
-        - (*this)(0, 0) * (*this)(1, 2) * (*this)(3, 3)
-        - (*this)(0, 2) * (*this)(1, 3) * (*this)(3, 0)
-        - (*this)(0, 3) * (*this)(1, 0) * (*this)(3, 2),
-
-        // 24
-          (*this)(0, 0) * (*this)(1, 2) * (*this)(2, 3)
-        + (*this)(0, 2) * (*this)(1, 3) * (*this)(2, 0)
-        + (*this)(0, 3) * (*this)(1, 0) * (*this)(2, 2)
-        - (*this)(0, 0) * (*this)(1, 3) * (*this)(2, 2)
-        - (*this)(0, 2) * (*this)(1, 0) * (*this)(2, 3)
-        - (*this)(0, 3) * (*this)(1, 2) * (*this)(2, 0),
-
-        // 31
-          (*this)(1, 0) * (*this)(2, 1) * (*this)(3, 3)
-        + (*this)(1, 1) * (*this)(2, 3) * (*this)(3, 0)
-        + (*this)(1, 3) * (*this)(2, 0) * (*this)(3, 1)
-        - (*this)(1, 0) * (*this)(2, 3) * (*this)(3, 1)
-        - (*this)(1, 1) * (*this)(2, 0) * (*this)(3, 3)
-        - (*this)(1, 3) * (*this)(2, 1) * (*this)(3, 0),
-
-        // 32
-          (*this)(0, 0) * (*this)(2, 3) * (*this)(3, 1)
-        + (*this)(0, 1) * (*this)(2, 0) * (*this)(3, 3)
-        + (*this)(0, 3) * (*this)(2, 1) * (*this)(3, 0)
-        - (*this)(0, 0) * (*this)(2, 1) * (*this)(3, 3)
-        - (*this)(0, 1) * (*this)(2, 3) * (*this)(3, 0)
-        - (*this)(0, 3) * (*this)(2, 0) * (*this)(3, 1),
-
-        // 33
-          (*this)(0, 0) * (*this)(1, 1) * (*this)(3, 3)
-        + (*this)(0, 1) * (*this)(1, 3) * (*this)(3, 0)
-        + (*this)(0, 3) * (*this)(1, 0) * (*this)(3, 1)
-        - (*this)(0, 0) * (*this)(1, 3) * (*this)(3, 1)
-        - (*this)(0, 1) * (*this)(1, 0) * (*this)(3, 3)
-        - (*this)(0, 3) * (*this)(1, 1) * (*this)(3, 0),
-
-        // 34
-          (*this)(0, 0) * (*this)(1, 3) * (*this)(2, 1)
-        + (*this)(0, 1) * (*this)(1, 0) * (*this)(2, 3)
-        + (*this)(0, 3) * (*this)(1, 1) * (*this)(2, 0)
-        - (*this)(0, 0) * (*this)(1, 1) * (*this)(2, 3)
-        - (*this)(0, 1) * (*this)(1, 3) * (*this)(2, 0)
-        - (*this)(0, 3) * (*this)(1, 0) * (*this)(2, 1),
-
-        // 41
-          (*this)(1, 0) * (*this)(2, 2) * (*this)(3, 1)
-        + (*this)(1, 1) * (*this)(2, 0) * (*this)(3, 2)
-        + (*this)(1, 2) * (*this)(2, 1) * (*this)(3, 0)
-        - (*this)(1, 0) * (*this)(2, 1) * (*this)(3, 2)
-        - (*this)(1, 1) * (*this)(2, 2) * (*this)(3, 0)
-        - (*this)(1, 2) * (*this)(2, 0) * (*this)(3, 1),
-
-        // 42
-          (*this)(0, 0) * (*this)(2, 1) * (*this)(3, 2)
-        + (*this)(0, 1) * (*this)(2, 2) * (*this)(3, 0)
-        + (*this)(0, 2) * (*this)(2, 0) * (*this)(3, 1)
-        - (*this)(0, 0) * (*this)(2, 2) * (*this)(3, 1)
-        - (*this)(0, 1) * (*this)(2, 0) * (*this)(3, 2)
-        - (*this)(0, 2) * (*this)(2, 1) * (*this)(3, 0),
-
-        // 43
-          (*this)(0, 0) * (*this)(1, 2) * (*this)(3, 1)
-        + (*this)(0, 1) * (*this)(1, 0) * (*this)(3, 2)
-        + (*this)(0, 2) * (*this)(1, 1) * (*this)(3, 0)
-        - (*this)(0, 0) * (*this)(1, 1) * (*this)(3, 2)
-        - (*this)(0, 1) * (*this)(1, 2) * (*this)(3, 0)
-        - (*this)(0, 2) * (*this)(1, 0) * (*this)(3, 1),
-
-        // 44
-          (*this)(0, 0) * (*this)(1, 1) * (*this)(2, 2)
-        + (*this)(0, 1) * (*this)(1, 2) * (*this)(2, 0)
-        + (*this)(0, 2) * (*this)(1, 0) * (*this)(2, 1)
-        - (*this)(0, 0) * (*this)(1, 2) * (*this)(2, 1)
-        - (*this)(0, 1) * (*this)(1, 0) * (*this)(2, 2)
-        - (*this)(0, 2) * (*this)(1, 1) * (*this)(2, 0)
-    };
-}
 
-template <uint8_t Rows, uint8_t Columns, typename T>
-inline Matrix<Columns, Rows, T> Matrix<Rows, Columns, T>::transpose() const {
-    Matrix<Columns, Rows, T> transposeMatrix(0);
+    Matrix<Rows, Columns, T> matrix;
 
-    for (uint8_t row = 0; row < Rows; ++row) {
-        for (uint8_t col = 0; col < Columns; ++col) {
-            transposeMatrix(col, row) = (*this)(row, col);
-        }
+    if (Simd::Kernels<T>::inverse) {
+        Simd::Kernels<T>::inverse4x4(_values.data().data(), matrix._values.data().data());
+        return matrix;
     }
 
-    return transposeMatrix;
+    const Matrix<Rows, Columns, T>& m = *this;
+
+    // 2x2 determinants of the two first rows and of the two last rows (Laplace expansion)
+    const T s0 = m(0, 0) * m(1, 1) - m(1, 0) * m(0, 1);
+    const T s1 = m(0, 0) * m(1, 2) - m(1, 0) * m(0, 2);
+    const T s2 = m(0, 0) * m(1, 3) - m(1, 0) * m(0, 3);
+    const T s3 = m(0, 1) * m(1, 2) - m(1, 1) * m(0, 2);
+    const T s4 = m(0, 1) * m(1, 3) - m(1, 1) * m(0, 3);
+    const T s5 = m(0, 2) * m(1, 3) - m(1, 2) * m(0, 3);
+
+    const T c0 = m(2, 0) * m(3, 1) - m(3, 0) * m(2, 1);
+    const T c1 = m(2, 0) * m(3, 2) - m(3, 0) * m(2, 2);
+    const T c2 = m(2, 0) * m(3, 3) - m(3, 0) * m(2, 3);
+    const T c3 = m(2, 1) * m(3, 2) - m(3, 1) * m(2, 2);
+    const T c4 = m(2, 1) * m(3, 3) - m(3, 1) * m(2, 3);
+    const T c5 = m(2, 2) * m(3, 3) - m(3, 2) * m(2, 3);
+
+    const T invDet = T(1) / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+
+    matrix(0, 0) = ( m(1, 1) * c5 - m(1, 2) * c4 + m(1, 3) * c3) * invDet;
+    matrix(0, 1) = (-m(0, 1) * c5 + m(0, 2) * c4 - m(0, 3) * c3) * invDet;
+    matrix(0, 2) = ( m(3, 1) * s5 - m(3, 2) * s4 + m(3, 3) * s3) * invDet;
+    matrix(0, 3) = (-m(2, 1) * s5 + m(2, 2) * s4 - m(2, 3) * s3) * invDet;
+
+    matrix(1, 0) = (-m(1, 0) * c5 + m(1, 2) * c2 - m(1, 3) * c1) * invDet;
+    matrix(1, 1) = ( m(0, 0) * c5 - m(0, 2) * c2 + m(0, 3) * c1) * invDet;
+    matrix(1, 2) = (-m(3, 0) * s5 + m(3, 2) * s2 - m(3, 3) * s1) * invDet;
+    matrix(1, 3) = ( m(2, 0) * s5 - m(2, 2) * s2 + m(2, 3) * s1) * invDet;
+
+    matrix(2, 0) = ( m(1, 0) * c4 - m(1, 1) * c2 + m(1, 3) * c0) * invDet;
+    matrix(2, 1) = (-m(0, 0) * c4 + m(0, 1) * c2 - m(0, 3) * c0) * invDet;
+    matrix(2, 2) = ( m(3, 0) * s4 - m(3, 1) * s2 + m(3, 3) * s0) * invDet;
+    matrix(2, 3) = (-m(2, 0) * s4 + m(2, 1) * s2 - m(2, 3) * s0) * invDet;
+
+    matrix(3, 0) = (-m(1, 0) * c3 + m(1, 1) * c1 - m(1, 2) * c0) * invDet;
+    matrix(3, 1) = ( m(0, 0) * c3 - m(0, 1) * c1 + m(0, 2) * c0) * invDet;
+    matrix(3, 2) = (-m(3, 0) * s3 + m(3, 1) * s1 - m(3, 2) * s0) * invDet;
+    matrix(3, 3) = ( m(2, 0) * s3 - m(2, 1) * s1 + m(2, 2) * s0) * invDet;
+
+    return matrix;
+}
+
+template <uint8_t Rows, uint8_t Columns, typename T>
+inline constexpr Matrix<Columns, Rows, T> Matrix<Rows, Columns, T>::transpose() const {
+    return Matrix<Columns, Rows, T>(transposeValues(std::make_index_sequence<Rows * Columns>()));
 }
 
 
 template <uint8_t Rows, uint8_t Columns, typename T>
 #if defined(LUG_COMPILER_MSVC)
 template <typename>
-inline T Matrix<Rows, Columns, T>::det() const
+inline constexpr T Matrix<Rows, Columns, T>::det() const
 #else
 template <bool EnableBool>
-inline typename std::enable_if<(Rows == 1) && EnableBool, T>::type Matrix<Rows, Columns, T>::det() const
+inline constexpr typename std::enable_if<(Rows == 1) && EnableBool, T>::type Matrix<Rows, Columns, T>::det() const
 #endif
 {
     static_assert(Rows == Columns, "The matrix has to be a square matrix to calculate the determinant");
@@ -357,10 +278,10 @@ inline typename std::enable_if<(Rows == 1) && EnableBool, T>::type Matrix<Rows,
 template <uint8_t Rows, uint8_t Columns, typename T>
 #if defined(LUG_COMPILER_MSVC)
 template <typename, typename>
-inline T Matrix<Rows, Columns, T>::det() const
+inline constexpr T Matrix<Rows, Columns, T>::det() const
 #else
 template <bool EnableBool>
-inline typename std::enable_if<(Rows == 2) && EnableBool, T>::type Matrix<Rows, Columns, T>::det() const
+inline constexpr typename std::enable_if<(Rows == 2) && EnableBool, T>::type Matrix<Rows, Columns, T>::det() const
 #endif
 {
     static_assert(Rows == Columns, "The matrix has to be a square matrix to calculate the determinant");
@@ -373,10 +294,10 @@ inline typename std::enable_if<(Rows == 2) && EnableBool, T>::type Matrix<Rows,
 template <uint8_t Rows, uint8_t Columns, typename T>
 #if defined(LUG_COMPILER_MSVC)
 template <typename, typename, typename>
-inline T Matrix<Rows, Columns, T>::det() const
+inline constexpr T Matrix<Rows, Columns, T>::det() const
 #else
 template <bool EnableBool>
-inline typename std::enable_if<(Rows == 3) && EnableBool, T>::type Matrix<Rows, Columns, T>::det() const
+inline constexpr typename std::enable_if<(Rows == 3) && EnableBool, T>::type Matrix<Rows, Columns, T>::det() const
 #endif
 {
     static_assert(Rows == Columns, "The matrix has to be a square matrix to calculate the determinant");
@@ -393,10 +314,10 @@ inline typename std::enable_if<(Rows == 3) && EnableBool, T>::type Matrix<Rows,
 template <uint8_t Rows, uint8_t Columns, typename T>
 #if defined(LUG_COMPILER_MSVC)
 template <typename, typename, typename, typename>
-inline T Matrix<Rows, Columns, T>::det() const
+inline constexpr T Matrix<Rows, Columns, T>::det() const
 #else
 template <bool EnableBool>
-inline typename std::enable_if<(Rows == 4) && EnableBool, T>::type Matrix<Rows, Columns, T>::det() const
+inline constexpr typename std::enable_if<(Rows == 4) && EnableBool, T>::type Matrix<Rows, Columns, T>::det() const
 #endif
 {
     static_assert(Rows == Columns, "The matrix has to be a square matrix to calculate the determinant");
@@ -477,100 +398,95 @@ typename std::enable_if<(Rows > 4) && EnableBool, T>::type Matrix<Rows, Columns,
 template <uint8_t Rows, uint8_t Columns, typename T>
 #if defined(LUG_COMPILER_MSVC)
 template <typename>
-inline Matrix<Rows, Columns, T> Matrix<Rows, Columns, T>::identity()
+inline constexpr Matrix<Rows, Columns, T> Matrix<Rows, Columns, T>::identity()
 #else
 template <bool EnableBool>
-inline typename std::enable_if<(Rows == Columns) && EnableBool, Matrix<Rows, Columns, T>>::type Matrix<Rows, Columns, T>::identity()
+inline constexpr typename std::enable_if<(Rows == Columns) && EnableBool, Matrix<Rows, Columns, T>>::type Matrix<Rows, Columns, T>::identity()
 #endif
 {
     static_assert(Rows == Columns, "The identity matrix has to be a square matrix");
-
-    Matrix<Rows, Columns, T> matrix(0);
-
-    for (uint8_t i = 0; i < Rows; ++i) {
-        matrix(i, i) = 1;
-    }
-
-    return matrix;
+    return Matrix<Rows, Columns, T>(identityValues(std::make_index_sequence<Rows * Columns>()));
 }
 
 // Unary operations
 template <uint8_t Rows, uint8_t Columns, typename T>
-Matrix<Rows, Columns, T> operator-(const Matrix<Rows, Columns, T>& lhs) {
+inline constexpr Matrix<Rows, Columns, T> operator-(const Matrix<Rows, Columns, T>& lhs) {
     return T(0) - lhs;
 }
 
 // Matrix/Scalar operations
 template <uint8_t Rows, uint8_t Columns, typename T>
-inline Matrix<Rows, Columns, T> operator+(const Matrix<Rows, Columns, T>& lhs, T rhs) {
+inline constexpr Matrix<Rows, Columns, T> operator+(const Matrix<Rows, Columns, T>& lhs, T rhs) {
     return Matrix<Rows, Columns, T>(lhs.getValues() + rhs);
 }
 
 template <uint8_t Rows, uint8_t Columns, typename T>
-inline Matrix<Rows, Columns, T> operator-(const Matrix<Rows, Columns, T>& lhs, T rhs) {
+inline constexpr Matrix<Rows, Columns, T> operator-(const Matrix<Rows, Columns, T>& lhs, T rhs) {
     return Matrix<Rows, Columns, T>(lhs.getValues() - rhs);
 }
 
 template <uint8_t Rows, uint8_t Columns, typename T>
-inline Matrix<Rows, Columns, T> operator*(const Matrix<Rows, Columns, T>& lhs, T rhs) {
+inline constexpr Matrix<Rows, Columns, T> operator*(const Matrix<Rows, Columns, T>& lhs, T rhs) {
     return Matrix<Rows, Columns, T>(lhs.getValues() * rhs);
 }
 
 template <uint8_t Rows, uint8_t Columns, typename T>
-inline  Matrix<Rows, Columns, T> operator/(const Matrix<Rows, Columns, T>& lhs, T rhs) {
+inline constexpr Matrix<Rows, Columns, T> operator/(const Matrix<Rows, Columns, T>& lhs, T rhs) {
     return Matrix<Rows, Columns, T>(lhs.getValues() / rhs);
 }
 
 template <uint8_t Rows, uint8_t Columns, typename T>
-inline Matrix<Rows, Columns, T> operator+(T lhs, const Matrix<Rows, Columns, T>& rhs) {
+inline constexpr Matrix<Rows, Columns, T> operator+(T lhs, const Matrix<Rows, Columns, T>& rhs) {
     return Matrix<Rows, Columns, T>(lhs + rhs.getValues());
 }
 
 template <uint8_t Rows, uint8_t Columns, typename T>
-inline Matrix<Rows, Columns, T> operator-(T lhs, const Matrix<Rows, Columns, T>& rhs) {
+inline constexpr Matrix<Rows, Columns, T> operator-(T lhs, const Matrix<Rows, Columns, T>& rhs) {
     return Matrix<Rows, Columns, T>(lhs - rhs.getValues());
 }
 
 template <uint8_t Rows, uint8_t Columns, typename T>
-inline Matrix<Rows, Columns, T> operator*(T lhs, const Matrix<Rows, Columns, T>& rhs) {
+inline constexpr Matrix<Rows, Columns, T> operator*(T lhs, const Matrix<Rows, Columns, T>& rhs) {
     return Matrix<Rows, Columns, T>(lhs * rhs.getValues());
 }
 
 template <uint8_t Rows, uint8_t Columns, typename T>
-inline Matrix<Rows, Columns, T> operator/(T lhs, const Matrix<Rows, Columns, T>& rhs) {
+inline constexpr Matrix<Rows, Columns, T> operator/(T lhs, const Matrix<Rows, Columns, T>& rhs) {
     return Matrix<Rows, Columns, T>(lhs / rhs.getValues());
 }
 
 // Matrix/Matrix operations
 template <uint8_t Rows, uint8_t Columns, typename T>
-inline Matrix<Rows, Columns, T> operator+(const Matrix<Rows, Columns, T>& lhs, const Matrix<Rows, Columns, T>& rhs) {
-    Matrix<Rows, Columns, T> matrix{lhs};
-
-    matrix += rhs;
-
-    return matrix;
+inline constexpr Matrix<Rows, Columns, T> operator+(const Matrix<Rows, Columns, T>& lhs, const Matrix<Rows, Columns, T>& rhs) {
+    return Matrix<Rows, Columns, T>(lhs.getValues() + rhs.getValues());
 }
 
 template <uint8_t Rows, uint8_t Columns, typename T>
-inline Matrix<Rows, Columns, T> operator-(const Matrix<Rows, Columns, T>& lhs, const Matrix<Rows, Columns, T>& rhs) {
-    Matrix<Rows, Columns, T> matrix{lhs};
-
-    matrix -= rhs;
-
-    return matrix;
+inline constexpr Matrix<Rows, Columns, T> operator-(const Matrix<Rows, Columns, T>& lhs, const Matrix<Rows, Columns, T>& rhs) {
+    return Matrix<Rows, Columns, T>(lhs.getValues() - rhs.getValues());
 }
 
 template <uint8_t RowsLeft, uint8_t ColumnsLeft, uint8_t RowsRight, uint8_t ColumnsRight, typename T>
 inline Matrix<RowsLeft, ColumnsRight, T> operator*(const Matrix<RowsLeft, ColumnsLeft, T>& lhs, const Matrix<RowsRight, ColumnsRight, T>& rhs) {
     static_assert(ColumnsLeft == RowsRight, "Columns of the right operand and Rows of the left operand must be of the same size to multiply matrices");
 
-    Matrix<RowsLeft, ColumnsRight, T> matrix(0);
+    Matrix<RowsLeft, ColumnsRight, T> matrix;
+
+    // Mat4x4 * Mat4x4 and Mat4x4 * Vec4
+    if (Simd::Kernels<T>::multiply && RowsLeft == 4 && ColumnsLeft == 4) {
+        Simd::Kernels<T>::mul4x4(lhs.getValues().data().data(), rhs.getValues().data().data(), matrix.getValues().data().data(), ColumnsRight);
+        return matrix;
+    }
 
     for (uint8_t i = 0; i < RowsLeft; ++i) {
         for (uint8_t j = 0; j < ColumnsRight; ++j) {
+            T value{0};
+
             for (uint8_t k = 0; k < RowsRight; ++k) {
-                matrix(i, j) += lhs(i, k) * rhs(k, j);
+                value += lhs(i, k) * rhs(k, j);
             }
+
+            matrix(i, j) = value;
         }
     }
 
@@ -589,12 +505,12 @@ inline Matrix<RowsLeft, ColumnsRight, T> operator/(const Matrix<RowsLeft, Column
 
 // Comparaison operators
 template <uint8_t Rows, uint8_t Columns, typename T>
-inline bool operator==(const Matrix<Rows, Columns, T>& lhs, const Matrix<Rows, Columns, T>& rhs) {
+inline constexpr bool operator==(const Matrix<Rows, Columns, T>& lhs, const Matrix<Rows, Columns, T>& rhs) {
     return (lhs.getValues() == rhs.getValues());
 }
 
 template <uint8_t Rows, uint8_t Columns, typename T>
-inline bool operator!=(const Matrix<Rows, Columns, T>& lhs, const Matrix<Rows, Columns, T>& rhs) {
+inline constexpr bool operator!=(const Matrix<Rows, Columns, T>& lhs, const Matrix<Rows, Columns, T>& rhs) {
     return (lhs.getValues() != rhs.getValues());
 }
 
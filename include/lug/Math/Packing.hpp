@@ -0,0 +1,80 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include <lug/Math/Quaternion.hpp>
+#include <lug/Math/Vector.hpp>
+
+namespace lug {
+namespace Math {
+namespace Packing {
+
+/**
+ * @brief      Converts a float to an IEEE 754 half-precision float, rounded to nearest even.
+ *
+ *             The values too large for a half become infinite, NaN stays NaN.
+ */
+uint16_t packHalf(float value);
+float unpackHalf(uint16_t value);
+
+/**
+ * @brief      Converts a float to a normalized integer, as read by the VK_FORMAT_*_SNORM and *_UNORM formats.
+ *
+ *             The value is clamped to [-1, 1] for the snorm and [0, 1] for the unorm, then rounded to nearest.
+ */
+int8_t packSnorm8(float value);
+uint8_t packUnorm8(float value);
+int16_t packSnorm16(float value);
+uint16_t packUnorm16(float value);
+
+constexpr float unpackSnorm8(int8_t value);
+constexpr float unpackUnorm8(uint8_t value);
+constexpr float unpackSnorm16(int16_t value);
+constexpr float unpackUnorm16(uint16_t value);
+
+/**
+ * @brief      Maps a unit vector to the [-1, 1] square of the octahedral encoding.
+ *
+ *             The result is usually stored as two snorm16 (oct16), whose error is below 0.005 degrees.
+ *
+ * @param[in]  normal  The vector, it doesn't need to be normalized but can't be null.
+ */
+template <typename T>
+Vector<2, T> encodeOctahedral(const Vector<3, T>& normal);
+
+/**
+ * @brief      Returns the normalized vector of an octahedral encoding.
+ */
+template <typename T>
+Vector<3, T> decodeOctahedral(const Vector<2, T>& value);
+
+/**
+ * @brief      Encodes a tangent frame as a quaternion (QTangent).
+ *
+ *             The bitangent is cross(normal, tangent) * tangent.w(), as in glTF. The handedness is stored
+ *             in the sign of w, which is kept away from zero so it survives the snorm16 packing.
+ *
+ * @param[in]  normal   The normal, normalized.
+ * @param[in]  tangent  The tangent and its handedness in w. It is orthogonalized against the normal.
+ */
+template <typename T>
+Quaternion<T> encodeQTangent(const Vector<3, T>& normal, const Vector<4, T>& tangent);
+
+/**
+ * @brief      Decodes a QTangent built by encodeQTangent.
+ *
+ * @param[in]  qTangent  The quaternion, normalized.
+ * @param      normal    The normal.
+ * @param      tangent   The tangent and its handedness in w.
+ */
+template <typename T>
+void decodeQTangent(const Quaternion<T>& qTangent, Vector<3, T>& normal, Vector<4, T>& tangent);
+
+#include <lug/Math/Packing.inl>
+
+} // Packing
+} // Math
+} // lug
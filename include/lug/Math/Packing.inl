@@ -0,0 +1,163 @@
+namespace priv {
+
+inline uint32_t floatToBits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+inline float bitsToFloat(uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// NaN is clamped to the minimum
+constexpr float clamp(float value, float min, float max) {
+    return value > min ? (value < max ? value : max) : min;
+}
+
+} // priv
+
+inline uint16_t packHalf(float value) {
+    uint32_t bits = priv::floatToBits(value);
+
+    const uint32_t sign = bits & 0x80000000u;
+    bits ^= sign;
+
+    uint32_t result;
+    if (bits >= (127u + 16u) << 23) {
+        // Too large for a half, NaN stays NaN
+        result = bits > 0x7f800000u ? 0x7e00 : 0x7c00;
+    } else if (bits < (127u - 14u) << 23) {
+        // Subnormal half, adding 0.5 aligns the 10 bits of the mantissa at the bottom and rounds them
+        result = priv::floatToBits(priv::bitsToFloat(bits) + 0.5f) - priv::floatToBits(0.5f);
+    } else {
+        // Rebias the exponent, the odd mantissas are rounded up on ties
+        result = (bits - ((127u - 15u) << 23) + 0xfff + ((bits >> 13) & 1)) >> 13;
+    }
+
+    return static_cast<uint16_t>(result | (sign >> 16));
+}
+
+inline float unpackHalf(uint16_t value) {
+    uint32_t bits = static_cast<uint32_t>(value & 0x7fff) << 13;
+    const uint32_t exponent = bits & (0x7c00u << 13);
+
+    bits += (127u - 15u) << 23;
+
+    if (exponent == 0x7c00u << 13) {
+        // Infinity or NaN
+        bits += (128u - 16u) << 23;
+    } else if (exponent == 0) {
+        // Zero or subnormal, renormalized by the float unit
+        bits = priv::floatToBits(priv::bitsToFloat(bits + (1u << 23)) - priv::bitsToFloat(113u << 23));
+    }
+
+    return priv::bitsToFloat(bits | static_cast<uint32_t>(value & 0x8000) << 16);
+}
+
+inline int8_t packSnorm8(float value) {
+    return static_cast<int8_t>(std::nearbyint(priv::clamp(value, -1.0f, 1.0f) * 127.0f));
+}
+
+inline uint8_t packUnorm8(float value) {
+    return static_cast<uint8_t>(std::nearbyint(priv::clamp(value, 0.0f, 1.0f) * 255.0f));
+}
+
+inline int16_t packSnorm16(float value) {
+    return static_cast<int16_t>(std::nearbyint(priv::clamp(value, -1.0f, 1.0f) * 32767.0f));
+}
+
+inline uint16_t packUnorm16(float value) {
+    return static_cast<uint16_t>(std::nearbyint(priv::clamp(value, 0.0f, 1.0f) * 65535.0f));
+}
+
+// -128 and -32768 are read as -1
+inline constexpr float unpackSnorm8(int8_t value) {
+    return value > -127 ? value / 127.0f : -1.0f;
+}
+
+inline constexpr float unpackUnorm8(uint8_t value) {
+    return value / 255.0f;
+}
+
+inline constexpr float unpackSnorm16(int16_t value) {
+    return value > -32767 ? value / 32767.0f : -1.0f;
+}
+
+inline constexpr float unpackUnorm16(uint16_t value) {
+    return value / 65535.0f;
+}
+
+template <typename T>
+inline Vector<2, T> encodeOctahedral(const Vector<3, T>& normal) {
+    const T factor = T(1) / (std::abs(normal.x()) + std::abs(normal.y()) + std::abs(normal.z()));
+
+    const T x = normal.x() * factor;
+    const T y = normal.y() * factor;
+
+    // The lower hemisphere is folded on the corners of the square
+    if (normal.z() < T(0)) {
+        return {std::copysign(T(1) - std::abs(y), x), std::copysign(T(1) - std::abs(x), y)};
+    }
+
+    return {x, y};
+}
+
+template <typename T>
+inline Vector<3, T> decodeOctahedral(const Vector<2, T>& value) {
+    Vector<3, T> normal{value.x(), value.y(), T(1) - std::abs(value.x()) - std::abs(value.y())};
+
+    // Unfold the corners, t is 0 in the upper hemisphere
+    const T t = std::max(-normal.z(), T(0));
+    normal.x() += normal.x() >= T(0) ? -t : t;
+    normal.y() += normal.y() >= T(0) ? -t : t;
+
+    return normalize(normal);
+}
+
+template <typename T>
+inline Quaternion<T> encodeQTangent(const Vector<3, T>& normal, const Vector<4, T>& tangent) {
+    const Vector<3, T> direction(tangent);
+    const Vector<3, T> orthogonal = normalize(Vector<3, T>(direction - normal * dot(normal, direction)));
+
+    // The frame is always right-handed, the handedness is stored separately
+    Quaternion<T> qTangent = Quaternion<T>::fromAxes(orthogonal, cross(normal, orthogonal), normal);
+
+    // q and -q are the same rotation
+    if (qTangent.w() < T(0)) {
+        qTangent = -qTangent;
+    }
+
+    // Smallest w whose sign survives the snorm16 packing
+    constexpr T bias = T(1) / T(32767);
+    if (qTangent.w() < bias) {
+        const T factor = std::sqrt(T(1) - bias * bias);
+        qTangent = Quaternion<T>(bias, qTangent.x() * factor, qTangent.y() * factor, qTangent.z() * factor);
+    }
+
+    return tangent.w() < T(0) ? -qTangent : qTangent;
+}
+
+template <typename T>
+inline void decodeQTangent(const Quaternion<T>& qTangent, Vector<3, T>& normal, Vector<4, T>& tangent) {
+    const T w = qTangent.w();
+    const T x = qTangent.x();
+    const T y = qTangent.y();
+    const T z = qTangent.z();
+
+    // Third and first columns of the rotation matrix, see Quaternion::transform
+    normal = Vector<3, T>{
+        T(2) * (x * z + w * y),
+        T(2) * (y * z - w * x),
+        T(1) - T(2) * (x * x + y * y)
+    };
+
+    tangent = Vector<4, T>{
+        T(1) - T(2) * (y * y + z * z),
+        T(2) * (x * y + w * z),
+        T(2) * (x * z - w * y),
+        w < T(0) ? T(-1) : T(1)
+    };
+}
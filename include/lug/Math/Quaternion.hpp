@@ -12,7 +12,7 @@ template <typename T = double>
 class Quaternion {
 public:
     Quaternion() = default;
-    Quaternion(T w, T x, T y, T z);
+    constexpr Quaternion(T w, T x, T y, T z);
     Quaternion(T data[4]);
     Quaternion(T angle, const Vector<3, T>& axis);
 
@@ -25,7 +25,7 @@ public:
     ~Quaternion() = default;
 
     T& operator[](std::size_t idx);
-    const T& operator[](std::size_t idx) const;
+    constexpr const T& operator[](std::size_t idx) const;
 
     void conjugate();
     void inverse();
@@ -40,7 +40,7 @@ public:
     Mat4x4<T> transform() const;
 
 #define DEFINE_QUATERNION_ACCESS(name, rows)    \
-    const T& name() const {                     \
+    constexpr const T& name() const {           \
         return (*this)[rows];                   \
     }                                           \
                                                 \
@@ -62,7 +62,7 @@ public:
 
 #undef DEFINE_QUATERNION_ACCESS
 
-    static Quaternion<T> identity();
+    static constexpr Quaternion<T> identity();
 
     static Quaternion<T> fromAxes(const Vector<3, T>& xAxis, const Vector<3, T>& yAxis, const Vector<3, T>& zAxis);
     static Quaternion<T> fromRotationMatrix(const Matrix<4, 4, T>& rotMatrix);
@@ -81,30 +81,50 @@ template <typename T>
 Quaternion<T> normalize(const Quaternion<T>& lhs);
 
 template <typename T>
-Quaternion<T> conjugate(const Quaternion<T>& lhs);
+constexpr Quaternion<T> conjugate(const Quaternion<T>& lhs);
 
 template <typename T>
 Quaternion<T> inverse(const Quaternion<T>& lhs);
 
 template <typename T>
-T dot(const Quaternion<T>& lhs, const Quaternion<T>& rhs);
+constexpr T dot(const Quaternion<T>& lhs, const Quaternion<T>& rhs);
 
 template <typename T>
 Quaternion<T> directionTo(const Vector<3, T>& original, const Vector<3, T>& expected);
 
+/**
+ * @brief      Interpolates linearly along the shortest path then normalizes.
+ *
+ *             Faster than slerp, but the angular velocity isn't constant.
+ *
+ * @param[in]  lhs   The rotation at 0, normalized.
+ * @param[in]  rhs   The rotation at 1, normalized.
+ * @param[in]  t     The interpolation factor.
+ */
+template <typename T>
+Quaternion<T> nlerp(const Quaternion<T>& lhs, const Quaternion<T>& rhs, T t);
+
+/**
+ * @brief      Spherical linear interpolation along the shortest path.
+ *
+ *             Same parameters as nlerp.
+ */
+template <typename T>
+Quaternion<T> slerp(const Quaternion<T>& lhs, const Quaternion<T>& rhs, T t);
+
 // TODO: Reflection / rotation
 
 // Quaternion operator
 
 template <typename T>
-Quaternion<T> operator-(const Quaternion<T>& lhs);
+constexpr Quaternion<T> operator-(const Quaternion<T>& lhs);
 
 // Quaternion/Quaternion operator
 template <typename T>
-Quaternion<T> operator+(const Quaternion<T>& lhs, const Quaternion<T>& rhs);
+constexpr Quaternion<T> operator+(const Quaternion<T>& lhs, const Quaternion<T>& rhs);
 
 template <typename T>
-Quaternion<T> operator-(const Quaternion<T>& lhs, const Quaternion<T>& rhs);
+constexpr Quaternion<T> operator-(const Quaternion<T>& lhs, const Quaternion<T>& rhs);
 
 template <typename T>
 Quaternion<T> operator*(const Quaternion<T>& lhs, const Quaternion<T>& rhs);
@@ -113,10 +133,10 @@ template <typename T>
 Quaternion<T> operator/(const Quaternion<T>& lhs, const Quaternion<T>& rhs);
 
 template <typename T>
-bool operator==(const Quaternion<T>& lhs, const Quaternion<T>& rhs);
+constexpr bool operator==(const Quaternion<T>& lhs, const Quaternion<T>& rhs);
 
 template <typename T>
-bool operator!=(const Quaternion<T>& lhs, const Quaternion<T>& rhs);
+constexpr bool operator!=(const Quaternion<T>& lhs, const Quaternion<T>& rhs);
 
 template <typename T>
 std::ostream& operator<<(std::ostream& os, const Quaternion<T>& quaternion);
@@ -1,5 +1,5 @@
 template <typename T>
-Quaternion<T>::Quaternion(T w, T x, T y, T z) : _data{w, x, y, z} {}
+inline constexpr Quaternion<T>::Quaternion(T w, T x, T y, T z) : _data{w, x, y, z} {}
 
 template <typename T>
 Quaternion<T>::Quaternion(T data[4]) {
@@ -30,7 +30,7 @@ inline T& Quaternion<T>::operator[](std::size_t idx) {
 }
 
 template <typename T>
-inline const T& Quaternion<T>::operator[](std::size_t idx) const {
+inline constexpr const T& Quaternion<T>::operator[](std::size_t idx) const {
     return _data[idx];
 }
 
@@ -76,6 +76,12 @@ inline Vector<3, T> Quaternion<T>::getAxis() const {
 
 template <typename T>
 inline Mat4x4<T> Quaternion<T>::transform() const {
+    if (Simd::Kernels<T>::rotation) {
+        Mat4x4<T> result;
+        Simd::Kernels<T>::quatToMat4x4(_data, result.getValues().data().data());
+        return result;
+    }
+
     Mat4x4<T> result{Mat4x4<T>::identity()};
 
     const T xx = _data[1] * _data[1];
@@ -106,7 +112,7 @@ inline Mat4x4<T> Quaternion<T>::transform() const {
 }
 
 template <typename T>
-inline Quaternion<T> Quaternion<T>::identity() {
+inline constexpr Quaternion<T> Quaternion<T>::identity() {
     return {T(1), T(0), T(0), T(0)};
 }
 
@@ -173,7 +179,7 @@ inline Quaternion<T> Quaternion<T>::fromRotationMatrix(const Matrix<4, 4, T>& ro
 }
 
 template <typename T>
-inline Quaternion<T> conjugate(const Quaternion<T>& lhs) {
+inline constexpr Quaternion<T> conjugate(const Quaternion<T>& lhs) {
     return {lhs.w(), -lhs.x(), -lhs.y(), -lhs.z()};
 }
 
@@ -202,7 +208,7 @@ inline Quaternion<T> inverse(const Quaternion<T>& lhs) {
 }
 
 template <typename T>
-inline T dot(const Quaternion<T>& lhs, const Quaternion<T>& rhs) {
+inline constexpr T dot(const Quaternion<T>& lhs, const Quaternion<T>& rhs) {
     return lhs[0] * rhs[0] + lhs[1] * rhs[1] + lhs[2] * rhs[2] + lhs[3] * rhs[3];
 }
 
@@ -247,22 +253,65 @@ Quaternion<T> directionTo(const Vector<3, T>& original, const Vector<3, T>& expe
 }
 
 template <typename T>
-inline Quaternion<T> operator-(const Quaternion<T>& lhs) {
+inline Quaternion<T> nlerp(const Quaternion<T>& lhs, const Quaternion<T>& rhs, T t) {
+    // q and -q are the same rotation, the closest one is used
+    const T factor = dot(lhs, rhs) < T(0) ? -t : t;
+
+    return normalize(Quaternion<T>(
+        lhs[0] * (T(1) - t) + rhs[0] * factor,
+        lhs[1] * (T(1) - t) + rhs[1] * factor,
+        lhs[2] * (T(1) - t) + rhs[2] * factor,
+        lhs[3] * (T(1) - t) + rhs[3] * factor
+    ));
+}
+
+template <typename T>
+inline Quaternion<T> slerp(const Quaternion<T>& lhs, const Quaternion<T>& rhs, T t) {
+    const T cosTheta = dot(lhs, rhs);
+    const T absCosTheta = std::abs(cosTheta);
+
+    // The sine is too small, the rotations are close enough for nlerp
+    if (absCosTheta > T(1) - T(1e-4)) {
+        return nlerp(lhs, rhs, t);
+    }
+
+    const T theta = std::acos(absCosTheta);
+    const T inverseSinTheta = T(1) / std::sin(theta);
+
+    const T lhsFactor = std::sin((T(1) - t) * theta) * inverseSinTheta;
+    const T rhsFactor = std::copysign(std::sin(t * theta) * inverseSinTheta, cosTheta);
+
+    return {
+        lhs[0] * lhsFactor + rhs[0] * rhsFactor,
+        lhs[1] * lhsFactor + rhs[1] * rhsFactor,
+        lhs[2] * lhsFactor + rhs[2] * rhsFactor,
+        lhs[3] * lhsFactor + rhs[3] * rhsFactor
+    };
+}
+
+template <typename T>
+inline constexpr Quaternion<T> operator-(const Quaternion<T>& lhs) {
     return {-lhs[0], -lhs[1], -lhs[2], -lhs[3]};
 }
 
 template <typename T>
-inline Quaternion<T> operator+(const Quaternion<T>& lhs, const Quaternion<T>& rhs) {
+inline constexpr Quaternion<T> operator+(const Quaternion<T>& lhs, const Quaternion<T>& rhs) {
     return {lhs[0] + rhs[0], lhs[1] + rhs[1], lhs[2] + rhs[2], lhs[3] + rhs[3]};
 }
 
 template <typename T>
-inline Quaternion<T> operator-(const Quaternion<T>& lhs, const Quaternion<T>& rhs) {
+inline constexpr Quaternion<T> operator-(const Quaternion<T>& lhs, const Quaternion<T>& rhs) {
     return {lhs[0] - rhs[0], lhs[1] - rhs[1], lhs[2] - rhs[2], lhs[3] - rhs[3]};
 }
 
 template <typename T>
 inline Quaternion<T> operator*(const Quaternion<T>& lhs, const Quaternion<T>& rhs) {
+    if (Simd::Kernels<T>::multiply) {
+        Quaternion<T> result;
+        Simd::Kernels<T>::mulQuat(&lhs[0], &rhs[0], &result[0]);
+        return result;
+    }
+
     return {
         lhs[0] * rhs[0] - lhs[1] * rhs[1] - lhs[2] * rhs[2] - lhs[3] * rhs[3],
         lhs[0] * rhs[1] + lhs[1] * rhs[0] + lhs[2] * rhs[3] - lhs[3] * rhs[2],
@@ -277,12 +326,12 @@ inline Quaternion<T> operator/(const Quaternion<T>& lhs, const Quaternion<T>& rh
 }
 
 template <typename T>
-inline bool operator==(const Quaternion<T>& lhs, const Quaternion<T>& rhs) {
+inline constexpr bool operator==(const Quaternion<T>& lhs, const Quaternion<T>& rhs) {
     return lhs[0] == rhs[0] && lhs[1] == rhs[1] && lhs[2] == rhs[2] && lhs[3] == rhs[3];
 }
 
 template <typename T>
-inline bool operator!=(const Quaternion<T>& lhs, const Quaternion<T>& rhs) {
+inline constexpr bool operator!=(const Quaternion<T>& lhs, const Quaternion<T>& rhs) {
     return lhs[0] != rhs[0] || lhs[1] != rhs[1] || lhs[2] != rhs[2] || lhs[3] != rhs[3];
 }
 
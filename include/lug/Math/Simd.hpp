@@ -0,0 +1,110 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// The instruction set is selected at compile time, define LUG_MATH_NO_SIMD to use the scalar code only
+#if !defined(LUG_MATH_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define LUG_MATH_SIMD_SSE
+        #include <emmintrin.h>
+
+        #if defined(__FMA__)
+            #define LUG_MATH_SIMD_FMA
+            #include <immintrin.h>
+        #endif
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #define LUG_MATH_SIMD_NEON
+        #include <arm_neon.h>
+    #endif
+#endif
+
+namespace lug {
+namespace Math {
+namespace Simd {
+
+/**
+ * @brief      Alignment of the storage of @p Size values of type @p T.
+ *
+ *             The 4x4 float matrices are aligned on 16 bytes whatever the instruction set, to not change
+ *             the layout of the structures between the builds. The other types keep their natural alignment,
+ *             e.g. the float vectors are part of the vertices and of the uniform blocks, so the kernels
+ *             use unaligned loads and stores.
+ */
+template <size_t Size, typename T>
+struct Alignment {
+    static constexpr size_t value = std::is_same<T, float>::value && Size == 16 ? 16 : alignof(std::array<T, Size>);
+};
+
+/**
+ * @brief      Vectorized kernels of the 4x4 matrices and of the quaternions, all column-major.
+ *
+ *             The generic version has none of them, the callers check the flags at compile time
+ *             and use their scalar code otherwise.
+ */
+template <typename T>
+struct Kernels {
+    static constexpr bool multiply = false;     ///< mul4x4 and mulQuat are vectorized
+    static constexpr bool inverse = false;      ///< inverse4x4 is vectorized
+    static constexpr bool rotation = false;     ///< quatToMat4x4 is vectorized
+
+    static void mul4x4(const T*, const T*, T*, uint8_t) {}
+    static void inverse4x4(const T*, T*) {}
+    static void mulQuat(const T*, const T*, T*) {}
+    static void quatToMat4x4(const T*, T*) {}
+};
+
+#if defined(LUG_MATH_SIMD_SSE)
+
+template <>
+struct Kernels<float> {
+    static constexpr bool multiply = true;
+    static constexpr bool inverse = true;
+    static constexpr bool rotation = true;
+
+    /**
+     * @brief      Multiplies a 4x4 matrix by a 4xN matrix.
+     *
+     * @param[in]  lhs      The 4x4 matrix.
+     * @param[in]  rhs      The 4xN matrix.
+     * @param      out      The 4xN result, must not overlap the operands.
+     * @param[in]  columns  The number of columns N of the right operand.
+     */
+    static void mul4x4(const float* lhs, const float* rhs, float* out, uint8_t columns);
+
+    static void inverse4x4(const float* in, float* out);
+
+    /**
+     * @brief      Multiplies two quaternions stored as {w, x, y, z}.
+     */
+    static void mulQuat(const float* lhs, const float* rhs, float* out);
+
+    /**
+     * @brief      Converts a quaternion stored as {w, x, y, z} to a 4x4 rotation matrix.
+     */
+    static void quatToMat4x4(const float* quat, float* out);
+};
+
+#elif defined(LUG_MATH_SIMD_NEON)
+
+template <>
+struct Kernels<float> {
+    static constexpr bool multiply = true;
+    static constexpr bool inverse = false;
+    static constexpr bool rotation = false;
+
+    static void mul4x4(const float* lhs, const float* rhs, float* out, uint8_t columns);
+    static void inverse4x4(const float*, float*) {}
+    static void mulQuat(const float* lhs, const float* rhs, float* out);
+    static void quatToMat4x4(const float*, float*) {}
+};
+
+#endif
+
+#include <lug/Math/Simd.inl>
+
+} // Simd
+} // Math
+} // lug
@@ -0,0 +1,184 @@
+#if defined(LUG_MATH_SIMD_SSE)
+
+namespace priv {
+
+inline __m128 multiplyAdd(__m128 a, __m128 b, __m128 c) {
+#if defined(LUG_MATH_SIMD_FMA)
+    return _mm_fmadd_ps(a, b, c);
+#else
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+}
+
+} // priv
+
+// Lanes of a vector in the order {lane0, lane1, lane2, lane3}
+#define LUG_MATH_SIMD_SHUFFLE(vector, lane0, lane1, lane2, lane3) \
+    _mm_shuffle_ps((vector), (vector), _MM_SHUFFLE((lane3), (lane2), (lane1), (lane0)))
+
+inline void Kernels<float>::mul4x4(const float* lhs, const float* rhs, float* out, uint8_t columns) {
+    const __m128 col0 = _mm_loadu_ps(lhs);
+    const __m128 col1 = _mm_loadu_ps(lhs + 4);
+    const __m128 col2 = _mm_loadu_ps(lhs + 8);
+    const __m128 col3 = _mm_loadu_ps(lhs + 12);
+
+    // Each column of the result is a linear combination of the columns of the left operand
+    for (uint8_t col = 0; col < columns; ++col) {
+        const float* values = rhs + col * 4;
+
+        __m128 result = _mm_mul_ps(col0, _mm_set1_ps(values[0]));
+        result = priv::multiplyAdd(col1, _mm_set1_ps(values[1]), result);
+        result = priv::multiplyAdd(col2, _mm_set1_ps(values[2]), result);
+        result = priv::multiplyAdd(col3, _mm_set1_ps(values[3]), result);
+
+        _mm_storeu_ps(out + col * 4, result);
+    }
+}
+
+inline void Kernels<float>::inverse4x4(const float* in, float* out) {
+    const __m128 col0 = _mm_loadu_ps(in);
+    const __m128 col1 = _mm_loadu_ps(in + 4);
+    const __m128 col2 = _mm_loadu_ps(in + 8);
+    const __m128 col3 = _mm_loadu_ps(in + 12);
+
+    // 2x2 determinants of the columns lhs and rhs, of the rows 0-1 in the lanes 2-3 and of the rows 2-3 in the lanes 0-1,
+    // as used by the rows of the adjugate
+    const auto det2x2 = [](__m128 lhs, __m128 rhs) {
+        const __m128 products = _mm_mul_ps(lhs, LUG_MATH_SIMD_SHUFFLE(rhs, 1, 0, 3, 2));
+        const __m128 dets = _mm_sub_ps(products, LUG_MATH_SIMD_SHUFFLE(products, 1, 0, 3, 2));
+
+        return LUG_MATH_SIMD_SHUFFLE(dets, 2, 2, 0, 0);
+    };
+
+    const __m128 det01 = det2x2(col0, col1);
+    const __m128 det02 = det2x2(col0, col2);
+    const __m128 det03 = det2x2(col0, col3);
+    const __m128 det12 = det2x2(col1, col2);
+    const __m128 det13 = det2x2(col1, col3);
+    const __m128 det23 = det2x2(col2, col3);
+
+    // Columns with the rows swapped by pairs
+    const __m128 swap0 = LUG_MATH_SIMD_SHUFFLE(col0, 1, 0, 3, 2);
+    const __m128 swap1 = LUG_MATH_SIMD_SHUFFLE(col1, 1, 0, 3, 2);
+    const __m128 swap2 = LUG_MATH_SIMD_SHUFFLE(col2, 1, 0, 3, 2);
+    const __m128 swap3 = LUG_MATH_SIMD_SHUFFLE(col3, 1, 0, 3, 2);
+
+    const __m128 signsEven = _mm_setr_ps(1.0f, -1.0f, 1.0f, -1.0f);
+    const __m128 signsOdd = _mm_setr_ps(-1.0f, 1.0f, -1.0f, 1.0f);
+
+    // Rows of the adjugate
+    __m128 row0 = _mm_mul_ps(signsEven, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(swap1, det23), _mm_mul_ps(swap2, det13)), _mm_mul_ps(swap3, det12)));
+    __m128 row1 = _mm_mul_ps(signsOdd, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(swap0, det23), _mm_mul_ps(swap2, det03)), _mm_mul_ps(swap3, det02)));
+    __m128 row2 = _mm_mul_ps(signsEven, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(swap0, det13), _mm_mul_ps(swap1, det03)), _mm_mul_ps(swap3, det01)));
+    __m128 row3 = _mm_mul_ps(signsOdd, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(swap0, det12), _mm_mul_ps(swap1, det02)), _mm_mul_ps(swap2, det01)));
+
+    // The first row of the adjugate times the first column is the determinant
+    __m128 det = _mm_mul_ps(row0, col0);
+    det = _mm_add_ps(det, LUG_MATH_SIMD_SHUFFLE(det, 1, 0, 3, 2));
+    det = _mm_add_ps(det, LUG_MATH_SIMD_SHUFFLE(det, 2, 3, 0, 1));
+
+    const __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), det);
+
+    row0 = _mm_mul_ps(row0, invDet);
+    row1 = _mm_mul_ps(row1, invDet);
+    row2 = _mm_mul_ps(row2, invDet);
+    row3 = _mm_mul_ps(row3, invDet);
+
+    // Store the rows as columns
+    _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+    _mm_storeu_ps(out, row0);
+    _mm_storeu_ps(out + 4, row1);
+    _mm_storeu_ps(out + 8, row2);
+    _mm_storeu_ps(out + 12, row3);
+}
+
+inline void Kernels<float>::mulQuat(const float* lhs, const float* rhs, float* out) {
+    const __m128 quat = _mm_loadu_ps(rhs);
+
+    __m128 result = _mm_mul_ps(_mm_set1_ps(lhs[0]), quat);
+    result = priv::multiplyAdd(_mm_set1_ps(lhs[1]), _mm_mul_ps(LUG_MATH_SIMD_SHUFFLE(quat, 1, 0, 3, 2), _mm_setr_ps(-1.0f, 1.0f, -1.0f, 1.0f)), result);
+    result = priv::multiplyAdd(_mm_set1_ps(lhs[2]), _mm_mul_ps(LUG_MATH_SIMD_SHUFFLE(quat, 2, 3, 0, 1), _mm_setr_ps(-1.0f, 1.0f, 1.0f, -1.0f)), result);
+    result = priv::multiplyAdd(_mm_set1_ps(lhs[3]), _mm_mul_ps(LUG_MATH_SIMD_SHUFFLE(quat, 3, 2, 1, 0), _mm_setr_ps(-1.0f, -1.0f, 1.0f, 1.0f)), result);
+
+    _mm_storeu_ps(out, result);
+}
+
+inline void Kernels<float>::quatToMat4x4(const float* quat, float* out) {
+    // {w, x, y, z}
+    const __m128 q = _mm_loadu_ps(quat);
+    const __m128 two = _mm_set1_ps(2.0f);
+
+    // Each column is the sum of two products of the components, the last row is multiplied by 0
+    const auto column = [&two](__m128 a, __m128 b, __m128 c, __m128 d, __m128 identity) {
+        return priv::multiplyAdd(two, priv::multiplyAdd(a, b, _mm_mul_ps(c, d)), identity);
+    };
+
+    const __m128 col0 = column(
+        _mm_mul_ps(LUG_MATH_SIMD_SHUFFLE(q, 2, 1, 1, 0), _mm_setr_ps(-1.0f, 1.0f, 1.0f, 0.0f)), LUG_MATH_SIMD_SHUFFLE(q, 2, 2, 3, 0),
+        _mm_mul_ps(LUG_MATH_SIMD_SHUFFLE(q, 3, 0, 0, 0), _mm_setr_ps(-1.0f, 1.0f, -1.0f, 0.0f)), LUG_MATH_SIMD_SHUFFLE(q, 3, 3, 2, 0),
+        _mm_setr_ps(1.0f, 0.0f, 0.0f, 0.0f)
+    );
+
+    const __m128 col1 = column(
+        _mm_mul_ps(LUG_MATH_SIMD_SHUFFLE(q, 1, 1, 2, 0), _mm_setr_ps(1.0f, -1.0f, 1.0f, 0.0f)), LUG_MATH_SIMD_SHUFFLE(q, 2, 1, 3, 0),
+        _mm_mul_ps(LUG_MATH_SIMD_SHUFFLE(q, 0, 3, 0, 0), _mm_setr_ps(-1.0f, -1.0f, 1.0f, 0.0f)), LUG_MATH_SIMD_SHUFFLE(q, 3, 3, 1, 0),
+        _mm_setr_ps(0.0f, 1.0f, 0.0f, 0.0f)
+    );
+
+    const __m128 col2 = column(
+        _mm_mul_ps(LUG_MATH_SIMD_SHUFFLE(q, 1, 2, 1, 0), _mm_setr_ps(1.0f, 1.0f, -1.0f, 0.0f)), LUG_MATH_SIMD_SHUFFLE(q, 3, 3, 1, 0),
+        _mm_mul_ps(LUG_MATH_SIMD_SHUFFLE(q, 0, 0, 2, 0), _mm_setr_ps(1.0f, -1.0f, -1.0f, 0.0f)), LUG_MATH_SIMD_SHUFFLE(q, 2, 1, 2, 0),
+        _mm_setr_ps(0.0f, 0.0f, 1.0f, 0.0f)
+    );
+
+    _mm_storeu_ps(out, col0);
+    _mm_storeu_ps(out + 4, col1);
+    _mm_storeu_ps(out + 8, col2);
+    _mm_storeu_ps(out + 12, _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
+}
+
+#undef LUG_MATH_SIMD_SHUFFLE
+
+#elif defined(LUG_MATH_SIMD_NEON)
+
+inline void Kernels<float>::mul4x4(const float* lhs, const float* rhs, float* out, uint8_t columns) {
+    const float32x4_t col0 = vld1q_f32(lhs);
+    const float32x4_t col1 = vld1q_f32(lhs + 4);
+    const float32x4_t col2 = vld1q_f32(lhs + 8);
+    const float32x4_t col3 = vld1q_f32(lhs + 12);
+
+    // Each column of the result is a linear combination of the columns of the left operand
+    for (uint8_t col = 0; col < columns; ++col) {
+        const float* values = rhs + col * 4;
+
+        float32x4_t result = vmulq_n_f32(col0, values[0]);
+        result = vmlaq_n_f32(result, col1, values[1]);
+        result = vmlaq_n_f32(result, col2, values[2]);
+        result = vmlaq_n_f32(result, col3, values[3]);
+
+        vst1q_f32(out + col * 4, result);
+    }
+}
+
+inline void Kernels<float>::mulQuat(const float* lhs, const float* rhs, float* out) {
+    static const float signs1[4] = {-1.0f, 1.0f, -1.0f, 1.0f};
+    static const float signs2[4] = {-1.0f, 1.0f, 1.0f, -1.0f};
+    static const float signs3[4] = {-1.0f, -1.0f, 1.0f, 1.0f};
+
+    const float32x4_t quat = vld1q_f32(rhs);
+
+    // {1, 0, 3, 2}, {2, 3, 0, 1} and {3, 2, 1, 0}
+    const float32x4_t quat1 = vrev64q_f32(quat);
+    const float32x4_t quat2 = vextq_f32(quat, quat, 2);
+    const float32x4_t quat3 = vrev64q_f32(quat2);
+
+    float32x4_t result = vmulq_n_f32(quat, lhs[0]);
+    result = vmlaq_n_f32(result, vmulq_f32(quat1, vld1q_f32(signs1)), lhs[1]);
+    result = vmlaq_n_f32(result, vmulq_f32(quat2, vld1q_f32(signs2)), lhs[2]);
+    result = vmlaq_n_f32(result, vmulq_f32(quat3, vld1q_f32(signs3)), lhs[3]);
+
+    vst1q_f32(out, result);
+}
+
+#endif
@@ -4,7 +4,11 @@
 #include <algorithm>
 #include <array>
 #include <cstring>
+#include <functional>
 #include <numeric>
+#include <utility>
+
+#include <lug/Math/Simd.hpp>
 
 namespace lug {
 namespace Math {
@@ -13,26 +17,26 @@ template <size_t Size, typename T = float>
 class ValArray {
 public:
     ValArray() = default;
-    explicit ValArray(const T& value);
-    explicit ValArray(const T* values);
+    explicit constexpr ValArray(const T& value);
+    explicit constexpr ValArray(const T* values);
     ValArray(const ValArray<Size, T>& rhs) = default;
     ValArray(ValArray<Size, T>&& rhs) = default;
-    ValArray(std::initializer_list<T> list);
+    constexpr ValArray(std::initializer_list<T> list);
 
     ValArray<Size, T>& operator=(const ValArray<Size, T>& rhs) = default;
     ValArray<Size, T>& operator=(ValArray<Size, T>&& rhs) = default;
 
     ~ValArray() = default;
 
-    const T& operator[](size_t pos) const;
+    constexpr const T& operator[](size_t pos) const;
     T& operator[](size_t pos);
 
-    const std::array<T, Size>& data() const;
+    constexpr const std::array<T, Size>& data() const;
     std::array<T, Size>& data();
 
     constexpr size_t size() const;
 
-    T sum() const;
+    constexpr T sum() const;
 
     // ValArray/Scalar operations
     ValArray<Size, T>& operator+=(const T& rhs);
@@ -47,52 +51,63 @@ public:
     ValArray<Size, T>& operator/=(const ValArray<Size, T>& rhs);
 
 private:
-    std::array<T, Size> _data;
+    // The elements are initialized in the constructors, std::array can't be modified in a constexpr function
+    template <size_t... Indices>
+    constexpr ValArray(const T& value, std::index_sequence<Indices...>);
+
+    template <size_t... Indices>
+    constexpr ValArray(const T* values, std::index_sequence<Indices...>);
+
+    template <size_t... Indices>
+    constexpr ValArray(std::initializer_list<T> list, std::index_sequence<Indices...>);
+
+private:
+    alignas(Simd::Alignment<Size, T>::value) std::array<T, Size> _data;
 };
 
 // ValArray/Scalar operations
 template <size_t Size, typename T = float>
-ValArray<Size, T> operator+(const ValArray<Size, T>& lhs, const T& rhs);
+constexpr ValArray<Size, T> operator+(const ValArray<Size, T>& lhs, const T& rhs);
 
 template <size_t Size, typename T = float>
-ValArray<Size, T> operator-(const ValArray<Size, T>& lhs, const T& rhs);
+constexpr ValArray<Size, T> operator-(const ValArray<Size, T>& lhs, const T& rhs);
 
 template <size_t Size, typename T = float>
-ValArray<Size, T> operator*(const ValArray<Size, T>& lhs, const T& rhs);
+constexpr ValArray<Size, T> operator*(const ValArray<Size, T>& lhs, const T& rhs);
 
 template <size_t Size, typename T = float>
-ValArray<Size, T> operator/(const ValArray<Size, T>& lhs, const T& rhs);
+constexpr ValArray<Size, T> operator/(const ValArray<Size, T>& lhs, const T& rhs);
 
 template <size_t Size, typename T = float>
-ValArray<Size, T> operator+(const T& lhs, const ValArray<Size, T>& rhs);
+constexpr ValArray<Size, T> operator+(const T& lhs, const ValArray<Size, T>& rhs);
 
 template <size_t Size, typename T = float>
-ValArray<Size, T> operator-(const T& lhs, const ValArray<Size, T>& rhs);
+constexpr ValArray<Size, T> operator-(const T& lhs, const ValArray<Size, T>& rhs);
 
 template <size_t Size, typename T = float>
-ValArray<Size, T> operator*(const T& lhs, const ValArray<Size, T>& rhs);
+constexpr ValArray<Size, T> operator*(const T& lhs, const ValArray<Size, T>& rhs);
 
 template <size_t Size, typename T = float>
-ValArray<Size, T> operator/(const T& lhs, const ValArray<Size, T>& rhs);
+constexpr ValArray<Size, T> operator/(const T& lhs, const ValArray<Size, T>& rhs);
 
 // ValArray/ValArray operations
 template <size_t Size, typename T = float>
-ValArray<Size, T> operator+(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs);
+constexpr ValArray<Size, T> operator+(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs);
 
 template <size_t Size, typename T = float>
-ValArray<Size, T> operator-(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs);
+constexpr ValArray<Size, T> operator-(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs);
 
 template <size_t Size, typename T = float>
-ValArray<Size, T> operator*(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs);
+constexpr ValArray<Size, T> operator*(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs);
 
 template <size_t Size, typename T = float>
-ValArray<Size, T> operator/(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs);
+constexpr ValArray<Size, T> operator/(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs);
 
 template <size_t Size, typename T = float>
-bool operator==(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs);
+constexpr bool operator==(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs);
 
 template <size_t Size, typename T = float>
-bool operator!=(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs);
+constexpr bool operator!=(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs);
 
 #include <lug/Math/ValArray.inl>
 
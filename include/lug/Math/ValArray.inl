@@ -1,20 +1,27 @@
 template <size_t Size, typename T>
-ValArray<Size, T>::ValArray(const T& value) {
-    _data.fill(value);
-}
+inline constexpr ValArray<Size, T>::ValArray(const T& value) : ValArray(value, std::make_index_sequence<Size>()) {}
 
 template <size_t Size, typename T>
-ValArray<Size, T>::ValArray(const T* values) {
-    std::memcpy(_data.data(), values, sizeof(T) * Size);
-}
+inline constexpr ValArray<Size, T>::ValArray(const T* values) : ValArray(values, std::make_index_sequence<Size>()) {}
 
 template <size_t Size, typename T>
-ValArray<Size, T>::ValArray(std::initializer_list<T> list) {
-    std::copy(std::begin(list), std::end(list), std::begin(_data));
-}
+inline constexpr ValArray<Size, T>::ValArray(std::initializer_list<T> list) : ValArray(list, std::make_index_sequence<Size>()) {}
+
+template <size_t Size, typename T>
+template <size_t... Indices>
+inline constexpr ValArray<Size, T>::ValArray(const T& value, std::index_sequence<Indices...>) : _data{{(static_cast<void>(Indices), value)...}} {}
+
+template <size_t Size, typename T>
+template <size_t... Indices>
+inline constexpr ValArray<Size, T>::ValArray(const T* values, std::index_sequence<Indices...>) : _data{{values[Indices]...}} {}
+
+template <size_t Size, typename T>
+template <size_t... Indices>
+inline constexpr ValArray<Size, T>::ValArray(std::initializer_list<T> list, std::index_sequence<Indices...>) :
+    _data{{(Indices < list.size() ? list.begin()[Indices] : T(0))...}} {}
 
 template <size_t Size, typename T>
-inline const T& ValArray<Size, T>::operator[](size_t pos) const {
+inline constexpr const T& ValArray<Size, T>::operator[](size_t pos) const {
     return _data[pos];
 }
 
@@ -24,7 +31,7 @@ inline T& ValArray<Size, T>::operator[](size_t pos) {
 }
 
 template <size_t Size, typename T>
-inline const std::array<T, Size>& ValArray<Size, T>::data() const {
+inline constexpr const std::array<T, Size>& ValArray<Size, T>::data() const {
     return _data;
 }
 
@@ -39,8 +46,14 @@ inline constexpr size_t ValArray<Size, T>::size() const {
 }
 
 template <size_t Size, typename T>
-inline T ValArray<Size, T>::sum() const {
-    return std::accumulate(std::begin(_data), std::end(_data), T(0));
+inline constexpr T ValArray<Size, T>::sum() const {
+    T sum{0};
+
+    for (size_t i = 0; i < Size; ++i) {
+        sum += _data[i];
+    }
+
+    return sum;
 }
 
 // ValArray/Scalar operations
@@ -117,146 +130,94 @@ inline ValArray<Size, T>& ValArray<Size, T>::operator/=(const ValArray<Size, T>&
     return *this;
 }
 
-// ValArray/Scalar operations
-template <size_t Size, typename T>
-inline ValArray<Size, T> operator+(const ValArray<Size, T>& lhs, const T& rhs) {
-    ValArray<Size, T> array{lhs};
+namespace priv {
 
-    for (size_t i = 0; i < Size; ++i) {
-        array[i] += rhs;
-    }
-
-    return array;
+template <size_t Size, typename T, typename Operation, size_t... Indices>
+inline constexpr ValArray<Size, T> apply(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs, Operation operation, std::index_sequence<Indices...>) {
+    return {operation(lhs[Indices], rhs[Indices])...};
 }
 
-template <size_t Size, typename T>
-inline ValArray<Size, T> operator-(const ValArray<Size, T>& lhs, const T& rhs) {
-    ValArray<Size, T> array{lhs};
+template <size_t Size, typename T, typename Operation>
+inline constexpr ValArray<Size, T> apply(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs, Operation operation) {
+    return apply(lhs, rhs, operation, std::make_index_sequence<Size>());
+}
 
-    for (size_t i = 0; i < Size; ++i) {
-        array[i] -= rhs;
-    }
+} // priv
 
-    return array;
+// ValArray/Scalar operations
+template <size_t Size, typename T>
+inline constexpr ValArray<Size, T> operator+(const ValArray<Size, T>& lhs, const T& rhs) {
+    return priv::apply(lhs, ValArray<Size, T>(rhs), std::plus<T>());
 }
 
 template <size_t Size, typename T>
-inline ValArray<Size, T> operator*(const ValArray<Size, T>& lhs, const T& rhs) {
-    ValArray<Size, T> array{lhs};
-
-    for (size_t i = 0; i < Size; ++i) {
-        array[i] *= rhs;
-    }
-
-    return array;
+inline constexpr ValArray<Size, T> operator-(const ValArray<Size, T>& lhs, const T& rhs) {
+    return priv::apply(lhs, ValArray<Size, T>(rhs), std::minus<T>());
 }
 
 template <size_t Size, typename T>
-inline ValArray<Size, T> operator/(const ValArray<Size, T>& lhs, const T& rhs) {
-    ValArray<Size, T> array{lhs};
-
-    for (size_t i = 0; i < Size; ++i) {
-        array[i] /= rhs;
-    }
-
-    return array;
+inline constexpr ValArray<Size, T> operator*(const ValArray<Size, T>& lhs, const T& rhs) {
+    return priv::apply(lhs, ValArray<Size, T>(rhs), std::multiplies<T>());
 }
 
 template <size_t Size, typename T>
-inline ValArray<Size, T> operator+(const T& lhs, const ValArray<Size, T>& rhs) {
-    ValArray<Size, T> array{rhs};
-
-    for (size_t i = 0; i < Size; ++i) {
-        array[i] = lhs + array[i];
-    }
-
-    return array;
+inline constexpr ValArray<Size, T> operator/(const ValArray<Size, T>& lhs, const T& rhs) {
+    return priv::apply(lhs, ValArray<Size, T>(rhs), std::divides<T>());
 }
 
 template <size_t Size, typename T>
-inline ValArray<Size, T> operator-(const T& lhs, const ValArray<Size, T>& rhs) {
-    ValArray<Size, T> array{rhs};
-
-    for (size_t i = 0; i < Size; ++i) {
-        array[i] = lhs - array[i];
-    }
-
-    return array;
+inline constexpr ValArray<Size, T> operator+(const T& lhs, const ValArray<Size, T>& rhs) {
+    return priv::apply(ValArray<Size, T>(lhs), rhs, std::plus<T>());
 }
 
 template <size_t Size, typename T>
-inline ValArray<Size, T> operator*(const T& lhs, const ValArray<Size, T>& rhs) {
-    ValArray<Size, T> array{rhs};
-
-    for (size_t i = 0; i < Size; ++i) {
-        array[i] = lhs * array[i];
-    }
-
-    return array;
+inline constexpr ValArray<Size, T> operator-(const T& lhs, const ValArray<Size, T>& rhs) {
+    return priv::apply(ValArray<Size, T>(lhs), rhs, std::minus<T>());
 }
 
 template <size_t Size, typename T>
-inline ValArray<Size, T> operator/(const T& lhs, const ValArray<Size, T>& rhs) {
-    ValArray<Size, T> array{rhs};
-
-    for (size_t i = 0; i < Size; ++i) {
-        array[i] = lhs / array[i];
-    }
+inline constexpr ValArray<Size, T> operator*(const T& lhs, const ValArray<Size, T>& rhs) {
+    return priv::apply(ValArray<Size, T>(lhs), rhs, std::multiplies<T>());
+}
 
-    return array;
+template <size_t Size, typename T>
+inline constexpr ValArray<Size, T> operator/(const T& lhs, const ValArray<Size, T>& rhs) {
+    return priv::apply(ValArray<Size, T>(lhs), rhs, std::divides<T>());
 }
 
 // ValArray/ValArray operations
 template <size_t Size, typename T>
-inline ValArray<Size, T> operator+(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs) {
-    ValArray<Size, T> array{lhs};
-
-    for (size_t i = 0; i < Size; ++i) {
-        array[i] += rhs[i];
-    }
-
-    return array;
+inline constexpr ValArray<Size, T> operator+(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs) {
+    return priv::apply(lhs, rhs, std::plus<T>());
 }
 
 template <size_t Size, typename T>
-inline ValArray<Size, T> operator-(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs) {
-    ValArray<Size, T> array{lhs};
-
-    for (size_t i = 0; i < Size; ++i) {
-        array[i] -= rhs[i];
-    }
-
-    return array;
+inline constexpr ValArray<Size, T> operator-(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs) {
+    return priv::apply(lhs, rhs, std::minus<T>());
 }
 
 template <size_t Size, typename T>
-inline ValArray<Size, T> operator*(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs) {
-    ValArray<Size, T> array{lhs};
-
-    for (size_t i = 0; i < Size; ++i) {
-        array[i] *= rhs[i];
-    }
-
-    return array;
+inline constexpr ValArray<Size, T> operator*(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs) {
+    return priv::apply(lhs, rhs, std::multiplies<T>());
 }
 
 template <size_t Size, typename T>
-inline ValArray<Size, T> operator/(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs) {
-    ValArray<Size, T> array{lhs};
+inline constexpr ValArray<Size, T> operator/(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs) {
+    return priv::apply(lhs, rhs, std::divides<T>());
+}
 
+template <size_t Size, typename T>
+inline constexpr bool operator==(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs) {
     for (size_t i = 0; i < Size; ++i) {
-        array[i] /= rhs[i];
+        if (lhs[i] != rhs[i]) {
+            return false;
+        }
     }
 
-    return array;
-}
-
-template <size_t Size, typename T>
-inline bool operator==(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs) {
-    return std::equal(std::begin(lhs.data()), std::end(lhs.data()), std::begin(rhs.data()), std::end(rhs.data()));
+    return true;
 }
 
 template <size_t Size, typename T>
-inline bool operator!=(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs) {
-    return !std::equal(std::begin(lhs.data()), std::end(lhs.data()), std::begin(rhs.data()), std::end(rhs.data()));
+inline constexpr bool operator!=(const ValArray<Size, T>& lhs, const ValArray<Size, T>& rhs) {
+    return !(lhs == rhs);
 }
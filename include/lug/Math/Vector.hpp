@@ -16,14 +16,14 @@ public:
     constexpr Vector() = default;
 
     explicit constexpr Vector(T value);
-    Vector(std::initializer_list<T> list);
+    constexpr Vector(std::initializer_list<T> list);
 
     // Convert from matrix (we want non explicit conversion)
-    Vector(const BaseMatrix& matrix);
-    Vector(BaseMatrix&& matrix);
+    constexpr Vector(const BaseMatrix& matrix);
+    constexpr Vector(BaseMatrix&& matrix);
 
-    Vector(const Vector<Rows - 1, T>& vector, T value = 0);
-    Vector(const Vector<Rows + 1, T>& vector);
+    constexpr Vector(const Vector<Rows - 1, T>& vector, T value = 0);
+    constexpr Vector(const Vector<Rows + 1, T>& vector);
 
     Vector(const Vector<Rows, T>& vector) = default;
     Vector(Vector<Rows, T>&& vector) = default;
@@ -40,7 +40,7 @@ public:
 
 #define DEFINE_ACCESS(name, minimum_rows)                                                                               \
     template <bool EnableBool = true, typename = typename std::enable_if<(Rows >= minimum_rows) && EnableBool>::type>   \
-    const T& name() const {                                                                                             \
+    constexpr const T& name() const {                                                                                   \
         return (*this)(minimum_rows - 1);                                                                               \
     }                                                                                                                   \
                                                                                                                         \
@@ -68,6 +68,13 @@ public:
     constexpr T length() const;
     constexpr T squaredLength() const;
     void normalize();
+
+private:
+    template <size_t... Indices>
+    static constexpr typename BaseMatrix::Values extend(const Vector<Rows - 1, T>& vector, T value, std::index_sequence<Indices...>);
+
+    template <size_t... Indices>
+    static constexpr typename BaseMatrix::Values truncate(const Vector<Rows + 1, T>& vector, std::index_sequence<Indices...>);
 };
 
 template <typename T>
@@ -105,10 +112,10 @@ DEFINE_LENGTH_VECTOR(4)
 #undef DEFINE_LENGTH_VECTOR
 
 template <uint8_t Rows, typename T>
-Vector<Rows, T> operator*(const Vector<Rows, T>& lhs, const Vector<Rows, T>& rhs);
+constexpr Vector<Rows, T> operator*(const Vector<Rows, T>& lhs, const Vector<Rows, T>& rhs);
 
 template <uint8_t Rows, typename T>
-Vector<Rows, T> operator/(const Vector<Rows, T>& lhs, const Vector<Rows, T>& rhs);
+constexpr Vector<Rows, T> operator/(const Vector<Rows, T>& lhs, const Vector<Rows, T>& rhs);
 
 template <uint8_t Rows, typename T>
 Vector<Rows, T> operator*(const Vector<Rows, T>& lhs, const Matrix<Rows, Rows, T>& rhs);
@@ -2,28 +2,32 @@ template <uint8_t Rows, typename T>
 inline constexpr Vector<Rows, T>::Vector(T value) : Matrix<Rows, 1, T>(value) {}
 
 template <uint8_t Rows, typename T>
-inline Vector<Rows, T>::Vector(std::initializer_list<T> list) : Matrix<Rows, 1, T>(list) {}
+inline constexpr Vector<Rows, T>::Vector(std::initializer_list<T> list) : Matrix<Rows, 1, T>(list) {}
 
 template <uint8_t Rows, typename T>
-inline Vector<Rows, T>::Vector(const typename Vector<Rows, T>::BaseMatrix& matrix) : Matrix<Rows, 1, T>(matrix) {}
+inline constexpr Vector<Rows, T>::Vector(const typename Vector<Rows, T>::BaseMatrix& matrix) : Matrix<Rows, 1, T>(matrix) {}
 
 template <uint8_t Rows, typename T>
-inline Vector<Rows, T>::Vector(typename Vector<Rows, T>::BaseMatrix&& matrix) : Matrix<Rows, 1, T>(std::move(matrix)) {}
+inline constexpr Vector<Rows, T>::Vector(typename Vector<Rows, T>::BaseMatrix&& matrix) : Matrix<Rows, 1, T>(std::move(matrix)) {}
 
 template <uint8_t Rows, typename T>
-inline Vector<Rows, T>::Vector(const Vector<Rows - 1, T>& vector, T value) {
-    for (uint8_t row = 0; row < Rows - 1; ++row) {
-        (*this)(row) = vector(row);
-    }
+inline constexpr Vector<Rows, T>::Vector(const Vector<Rows - 1, T>& vector, T value) :
+    Matrix<Rows, 1, T>(extend(vector, value, std::make_index_sequence<Rows>())) {}
+
+template <uint8_t Rows, typename T>
+inline constexpr Vector<Rows, T>::Vector(const Vector<Rows + 1, T>& vector) :
+    Matrix<Rows, 1, T>(truncate(vector, std::make_index_sequence<Rows>())) {}
 
-    (*this)(Rows - 1) = value;
+template <uint8_t Rows, typename T>
+template <size_t... Indices>
+inline constexpr typename Vector<Rows, T>::BaseMatrix::Values Vector<Rows, T>::extend(const Vector<Rows - 1, T>& vector, T value, std::index_sequence<Indices...>) {
+    return {(Indices < Rows - 1 ? vector.getValues()[Indices] : value)...};
 }
 
 template <uint8_t Rows, typename T>
-inline Vector<Rows, T>::Vector(const Vector<Rows + 1, T>& vector) {
-    for (uint8_t row = 0; row < Rows; ++row) {
-        (*this)(row) = vector(row);
-    }
+template <size_t... Indices>
+inline constexpr typename Vector<Rows, T>::BaseMatrix::Values Vector<Rows, T>::truncate(const Vector<Rows + 1, T>& vector, std::index_sequence<Indices...>) {
+    return {vector.getValues()[Indices]...};
 }
 
 template <uint8_t Rows, typename T>
@@ -93,12 +97,12 @@ inline constexpr Vector<Rows, T> normalize(const Vector<Rows, T>& lhs) {
 }
 
 template <uint8_t Rows, typename T>
-inline Vector<Rows, T> operator*(const Vector<Rows, T>& lhs, const Vector<Rows, T>& rhs) {
+inline constexpr Vector<Rows, T> operator*(const Vector<Rows, T>& lhs, const Vector<Rows, T>& rhs) {
     return {lhs.getValues() * rhs.getValues()};
 }
 
 template <uint8_t Rows, typename T>
-inline Vector<Rows, T> operator/(const Vector<Rows, T>& lhs, const Vector<Rows, T>& rhs) {
+inline constexpr Vector<Rows, T> operator/(const Vector<Rows, T>& lhs, const Vector<Rows, T>& rhs) {
     return {lhs.getValues() / rhs.getValues()};
 }
 
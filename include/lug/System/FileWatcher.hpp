@@ -0,0 +1,69 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <lug/System/Export.hpp>
+
+namespace lug {
+namespace System {
+
+/**
+ * @brief      Class for watching the modifications of files.
+ *             Directories are watched (not recursively), and #poll returns the files written in
+ *             them since the last call. The paths returned are the concatenation of the watched
+ *             directory and the name of the file, so they can be compared with the paths used to
+ *             load the files as long as they are written the same way.
+ *
+ *             Only implemented on Linux (with inotify), #init fails on the other systems.
+ */
+class LUG_SYSTEM_API FileWatcher {
+public:
+    FileWatcher() = default;
+
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher(FileWatcher&&) = delete;
+
+    FileWatcher& operator=(const FileWatcher&) = delete;
+    FileWatcher& operator=(FileWatcher&&) = delete;
+
+    ~FileWatcher();
+
+    bool init();
+
+    /**
+     * @brief      Watches the files of a directory.
+     *
+     * @param[in]  directory  The directory, watching it twice has no effect.
+     *
+     * @return     Whether the directory is watched.
+     */
+    bool watchDirectory(const std::string& directory);
+
+    /**
+     * @brief      Watches the directory containing a file.
+     *
+     * @param[in]  filename  The filename.
+     *
+     * @return     Whether the directory is watched.
+     */
+    bool watchFile(const std::string& filename);
+
+    /**
+     * @brief      Returns the files modified since the last call, without blocking.
+     *             Each file is returned once, even if it has been written several times.
+     *
+     * @return     The paths of the modified files.
+     */
+    std::vector<std::string> poll();
+
+private:
+    int _fd{-1};
+
+    std::unordered_map<std::string, int> _watchesByDirectory;
+    std::unordered_map<int, std::string> _directoriesByWatch;
+};
+
+} // System
+} // lug
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace lug {
+namespace System {
+
+/**
+ * @brief      Open addressing hash map from hashes to values.
+ *
+ *             The keys are already hashes (e.g. the hash of the content of a resource), they are only
+ *             mixed to spread them over the slots. The collisions are resolved by linear probing and
+ *             the erased slots are filled back by shifting the next entries, so there are no tombstones
+ *             and the lookups stay short after many insertions and erasures.
+ *
+ * @tparam     T     The type of the values, must be default constructible and movable.
+ */
+template <typename T>
+class HashMap {
+public:
+    HashMap() = default;
+
+    HashMap(const HashMap&) = default;
+    HashMap(HashMap&&) = default;
+
+    HashMap& operator=(const HashMap&) = default;
+    HashMap& operator=(HashMap&&) = default;
+
+    ~HashMap() = default;
+
+    /**
+     * @brief      Finds the value of a key.
+     *
+     * @param[in]  key   The key.
+     *
+     * @return     A pointer to the value, nullptr if the key is not in the map.
+     */
+    T* find(size_t key);
+    const T* find(size_t key) const;
+
+    /**
+     * @brief      Returns the value of a key, inserting a default constructed one if the key is not in the map.
+     *             The references to the other values are invalidated if the map grows.
+     */
+    T& operator[](size_t key);
+
+    /**
+     * @brief      Erases a key.
+     *
+     * @return     Whether the key was in the map.
+     */
+    bool erase(size_t key);
+
+    /**
+     * @brief      Grows the map to hold at least count entries without rehashing.
+     */
+    void reserve(size_t count);
+
+    void clear();
+
+    size_t size() const;
+    bool empty() const;
+
+private:
+    struct Slot {
+        size_t key{0};
+        T value{};
+        bool used{false};
+    };
+
+    size_t getIndex(size_t key) const;
+    size_t findSlot(size_t key) const;
+    void rehash(size_t capacity);
+
+private:
+    std::vector<Slot> _slots;
+    size_t _mask{0};
+    size_t _shift{0};
+    size_t _size{0};
+};
+
+#include <lug/System/HashMap.inl>
+
+} // System
+} // lug
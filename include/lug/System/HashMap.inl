@@ -0,0 +1,140 @@
+template <typename T>
+inline T* HashMap<T>::find(size_t key) {
+    const size_t index = findSlot(key);
+    return index == _slots.size() ? nullptr : &_slots[index].value;
+}
+
+template <typename T>
+inline const T* HashMap<T>::find(size_t key) const {
+    const size_t index = findSlot(key);
+    return index == _slots.size() ? nullptr : &_slots[index].value;
+}
+
+template <typename T>
+inline T& HashMap<T>::operator[](size_t key) {
+    // Keep the load factor under 3/4
+    if ((_size + 1) * 4 > _slots.size() * 3) {
+        rehash(_slots.empty() ? 16 : _slots.size() * 2);
+    }
+
+    size_t index = getIndex(key);
+    while (_slots[index].used) {
+        if (_slots[index].key == key) {
+            return _slots[index].value;
+        }
+
+        index = (index + 1) & _mask;
+    }
+
+    _slots[index].key = key;
+    _slots[index].used = true;
+    ++_size;
+
+    return _slots[index].value;
+}
+
+template <typename T>
+inline bool HashMap<T>::erase(size_t key) {
+    size_t index = findSlot(key);
+    if (index == _slots.size()) {
+        return false;
+    }
+
+    // Shift back the next entries of the cluster that can be closer to their ideal slot
+    for (size_t next = (index + 1) & _mask; _slots[next].used; next = (next + 1) & _mask) {
+        const size_t ideal = getIndex(_slots[next].key);
+
+        if (((next - ideal) & _mask) >= ((next - index) & _mask)) {
+            _slots[index].key = _slots[next].key;
+            _slots[index].value = std::move(_slots[next].value);
+            index = next;
+        }
+    }
+
+    _slots[index].value = T{};
+    _slots[index].used = false;
+    --_size;
+
+    return true;
+}
+
+template <typename T>
+inline void HashMap<T>::reserve(size_t count) {
+    size_t capacity = _slots.empty() ? 16 : _slots.size();
+    while (count * 4 > capacity * 3) {
+        capacity *= 2;
+    }
+
+    if (capacity != _slots.size()) {
+        rehash(capacity);
+    }
+}
+
+template <typename T>
+inline void HashMap<T>::clear() {
+    for (auto& slot : _slots) {
+        slot = Slot{};
+    }
+
+    _size = 0;
+}
+
+template <typename T>
+inline size_t HashMap<T>::size() const {
+    return _size;
+}
+
+template <typename T>
+inline bool HashMap<T>::empty() const {
+    return _size == 0;
+}
+
+template <typename T>
+inline size_t HashMap<T>::getIndex(size_t key) const {
+    // Fibonacci hashing, the high bits of the product are the best mixed
+    constexpr size_t multiplier = static_cast<size_t>(sizeof(size_t) == 8 ? 0x9E3779B97F4A7C15ull : 0x9E3779B9ull);
+    return (key * multiplier) >> _shift;
+}
+
+template <typename T>
+inline size_t HashMap<T>::findSlot(size_t key) const {
+    if (!_size) {
+        return _slots.size();
+    }
+
+    for (size_t index = getIndex(key); _slots[index].used; index = (index + 1) & _mask) {
+        if (_slots[index].key == key) {
+            return index;
+        }
+    }
+
+    return _slots.size();
+}
+
+template <typename T>
+inline void HashMap<T>::rehash(size_t capacity) {
+    std::vector<Slot> slots(capacity);
+    std::swap(_slots, slots);
+
+    _mask = capacity - 1;
+    _shift = sizeof(size_t) * 8;
+    while (capacity > 1) {
+        capacity >>= 1;
+        --_shift;
+    }
+
+    for (auto& slot : slots) {
+        if (!slot.used) {
+            continue;
+        }
+
+        size_t index = getIndex(slot.key);
+        while (_slots[index].used) {
+            index = (index + 1) & _mask;
+        }
+
+        _slots[index].key = slot.key;
+        _slots[index].value = std::move(slot.value);
+        _slots[index].used = true;
+    }
+}
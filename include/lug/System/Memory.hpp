@@ -7,15 +7,20 @@
 #include <functional>
 
 #include <lug/System/Memory/Arena.hpp>
+#include <lug/System/Memory/Location.hpp>
 #include <lug/System/Memory/Policies/Thread.hpp>
 #include <lug/System/Memory/Policies/BoundsChecker.hpp>
 #include <lug/System/Memory/Policies/MemoryMarker.hpp>
+#include <lug/System/Memory/Policies/MemoryTracker.hpp>
 
 
+// Location of the call site, a constant initialized static of each expansion, resolved once by the memory tracking
+#define LUG_MEMORY_LOCATION ([]() -> ::lug::System::Memory::Location& { static ::lug::System::Memory::Location location{__FILE__, __LINE__}; return location; }())
+
 // The variadic arguments are always "arena, args..." (args only work for non array allocation and array of non pod)
-#define LUG_NEW_ALIGN(T, alignment, ...) ::lug::System::Memory::new_one<T>(alignment, __FILE__, __LINE__, __VA_ARGS__)
+#define LUG_NEW_ALIGN(T, alignment, ...) ::lug::System::Memory::new_one<T>(alignment, LUG_MEMORY_LOCATION, __VA_ARGS__)
 #define LUG_NEW_ARRAY_ALIGN(T, alignment, ...) LUG_NEW_ARRAY_ALIGN_SIZE(typename std::remove_all_extents<T>::type, alignment, std::extent<T>::value, __VA_ARGS__)
-#define LUG_NEW_ARRAY_ALIGN_SIZE(T, alignment, size, ...) ::lug::System::Memory::new_array<typename std::remove_all_extents<T>::type>(alignment, size, __FILE__, __LINE__, __VA_ARGS__)
+#define LUG_NEW_ARRAY_ALIGN_SIZE(T, alignment, size, ...) ::lug::System::Memory::new_array<typename std::remove_all_extents<T>::type>(alignment, size, LUG_MEMORY_LOCATION, __VA_ARGS__)
 
 #define LUG_NEW(T, ...) LUG_NEW_ALIGN(T, alignof(T), __VA_ARGS__)
 #define LUG_DELETE(object, arena) ::lug::System::Memory::delete_one(object, arena)
@@ -32,12 +37,19 @@ namespace Memory {
 template <typename T, class Arena, class ...Args>
 T* new_one(size_t alignment, const char* file, size_t line, Arena& arena, Args&&... args);
 
+// The arenas without an allocate taking a Location get its file and line
+template <typename T, class Arena, class ...Args>
+T* new_one(size_t alignment, Location& location, Arena& arena, Args&&... args);
+
 template <typename T, class Arena>
 void delete_one(T* object, Arena& arena);
 
 template <typename T, class Arena, class ...Args, typename std::enable_if<!std::is_pod<T>::value, int>::type = 0>
 T* new_array(size_t alignment, size_t nb, const char* file, size_t line, Arena& arena, Args&&... args);
 
+template <typename T, class Arena, class ...Args, typename std::enable_if<!std::is_pod<T>::value, int>::type = 0>
+T* new_array(size_t alignment, size_t nb, Location& location, Arena& arena, Args&&... args);
+
 template <typename T, class Arena, typename std::enable_if<!std::is_pod<T>::value, int>::type = 0>
 void delete_array(T* ptr, Arena& arena);
 
@@ -47,6 +59,12 @@ T* new_array(size_t alignment, size_t nb, const char* file, size_t line, Arena&
 template <typename T, class Arena, class ...Args, typename std::enable_if<std::is_pod<T>::value, int>::type = 0>
 T* new_array(size_t alignment, size_t nb, const char* file, size_t line, Arena& arena, Args&&... args) = delete;
 
+template <typename T, class Arena, typename std::enable_if<std::is_pod<T>::value, int>::type = 0>
+T* new_array(size_t alignment, size_t nb, Location& location, Arena& arena);
+
+template <typename T, class Arena, class ...Args, typename std::enable_if<std::is_pod<T>::value, int>::type = 0>
+T* new_array(size_t alignment, size_t nb, Location& location, Arena& arena, Args&&... args) = delete;
+
 template <typename T, class Arena, typename std::enable_if<std::is_pod<T>::value, int>::type = 0>
 void delete_array(T* ptr, Arena& arena);
 
@@ -1,7 +1,20 @@
-template <typename T, class Arena, class ...Args>
-inline T* new_one(size_t alignment, const char* file, size_t line, Arena& arena, Args&&... args) {
-    void* ptr = arena.allocate(sizeof(T), alignment, 0, file, line);
+/**
+ * \cond HIDDEN_SYMBOLS
+ */
+namespace priv {
+
+template <class Arena>
+inline auto allocate(Arena& arena, size_t size, size_t alignment, size_t offset, Location& location, int) -> decltype(arena.allocate(size, alignment, offset, location)) {
+    return arena.allocate(size, alignment, offset, location);
+}
 
+template <class Arena>
+inline void* allocate(Arena& arena, size_t size, size_t alignment, size_t offset, Location& location, long) {
+    return arena.allocate(size, alignment, offset, location.file, location.line);
+}
+
+template <typename T, class ...Args>
+inline T* construct_one(void* ptr, Args&&... args) {
     if (!ptr) {
         return nullptr;
     }
@@ -9,6 +22,40 @@ inline T* new_one(size_t alignment, const char* file, size_t line, Arena& arena,
     return new (ptr) T{std::forward<Args>(args)...};
 }
 
+template <typename T, class ...Args>
+inline T* construct_array(void* ptr, size_t nb, Args&&... args) {
+    if (!ptr) {
+        return nullptr;
+    }
+
+    // Store the size of the array
+    size_t* size_ptr = static_cast<size_t*>(ptr);
+    *size_ptr = nb;
+
+    // Call the constructors
+    T* const user_ptr = reinterpret_cast<T*>(size_ptr + 1);
+    for (size_t i = 0; i < nb; ++i) {
+        new (&user_ptr[i]) T{std::forward<Args>(args)...};
+    }
+
+    return user_ptr;
+}
+
+} // namespace priv
+/**
+ * \endcond
+ */
+
+template <typename T, class Arena, class ...Args>
+inline T* new_one(size_t alignment, const char* file, size_t line, Arena& arena, Args&&... args) {
+    return priv::construct_one<T>(arena.allocate(sizeof(T), alignment, 0, file, line), std::forward<Args>(args)...);
+}
+
+template <typename T, class Arena, class ...Args>
+inline T* new_one(size_t alignment, Location& location, Arena& arena, Args&&... args) {
+    return priv::construct_one<T>(priv::allocate(arena, sizeof(T), alignment, 0, location, 0), std::forward<Args>(args)...);
+}
+
 template <typename T, class Arena>
 inline void delete_one(T* object, Arena& arena) {
     if (object) {
@@ -25,22 +72,17 @@ inline T* new_array(size_t alignment, size_t nb, const char* file, size_t line,
     }
 
     void* const ptr = arena.allocate(sizeof(T) * nb + sizeof(size_t), alignment, sizeof(size_t), file, line);
+    return priv::construct_array<T>(ptr, nb, std::forward<Args>(args)...);
+}
 
-    if (!ptr) {
+template <typename T, class Arena, class ...Args, typename std::enable_if<!std::is_pod<T>::value, int>::type>
+inline T* new_array(size_t alignment, size_t nb, Location& location, Arena& arena, Args&&... args) {
+    if (nb == 0) {
         return nullptr;
     }
 
-    // Store the size of the array
-    size_t* size_ptr = static_cast<size_t*>(ptr);
-    *size_ptr = nb;
-
-    // Call the constructors
-    T* const user_ptr = reinterpret_cast<T*>(size_ptr + 1);
-    for (size_t i = 0; i < nb; ++i) {
-        new (&user_ptr[i]) T{std::forward<Args>(args)...};
-    }
-
-    return user_ptr;
+    void* const ptr = priv::allocate(arena, sizeof(T) * nb + sizeof(size_t), alignment, sizeof(size_t), location, 0);
+    return priv::construct_array<T>(ptr, nb, std::forward<Args>(args)...);
 }
 
 template <typename T, class Arena, typename std::enable_if<!std::is_pod<T>::value, int>::type>
@@ -64,13 +106,12 @@ inline void delete_array(T* ptr, Arena& arena) {
 
 template <typename T, class Arena, typename std::enable_if<std::is_pod<T>::value, int>::type>
 inline T* new_array(size_t alignment, size_t nb, const char* file, size_t line, Arena& arena) {
-    void* ptr = arena.allocate(sizeof(T) * nb, alignment, 0, file, line);
-
-    if (!ptr) {
-        return nullptr;
-    }
+    return priv::construct_one<T>(arena.allocate(sizeof(T) * nb, alignment, 0, file, line));
+}
 
-    return new(ptr) T{};
+template <typename T, class Arena, typename std::enable_if<std::is_pod<T>::value, int>::type>
+inline T* new_array(size_t alignment, size_t nb, Location& location, Arena& arena) {
+    return priv::construct_one<T>(priv::allocate(arena, sizeof(T) * nb, alignment, 0, location, 0));
 }
 
 template <typename T, class Arena, typename std::enable_if<std::is_pod<T>::value, int>::type>
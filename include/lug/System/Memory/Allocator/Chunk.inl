@@ -34,5 +34,7 @@ void Chunk<MaxSize, MaxAlignment, Offset>::reset() {
 
 template <size_t MaxSize, size_t MaxAlignment, size_t Offset>
 size_t Chunk<MaxSize, MaxAlignment, Offset>::getSize(void* ptr) const {
-    return Chunk<MaxSize, MaxAlignment>::ChunkSize;
+    (void)(ptr);
+
+    return ChunkSize;
 }
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <lug/System/Debug.hpp>
+#include <lug/System/Export.hpp>
+#include <lug/System/Memory/Allocator/Chunk.hpp>
+#include <lug/System/Memory/Area/IArea.hpp>
+
+namespace lug {
+namespace System {
+namespace Memory {
+namespace Allocator {
+
+/**
+ * \cond HIDDEN_SYMBOLS
+ */
+namespace priv {
+
+constexpr size_t maxThreadCachesCount = 64;
+
+/**
+ * @brief      Gets the index of the cache of the current thread in the concurrent allocators.
+ *
+ *             The index is given back when the thread ends and reused by the next thread.
+ *
+ * @return     The index, maxThreadCachesCount if all the caches are already used.
+ */
+LUG_SYSTEM_API size_t getThreadCacheIndex();
+
+}
+/**
+ * \endcond
+ */
+
+/**
+ * @brief      Chunk allocator which can be used by several threads at the same time, without lock.
+ *
+ *             Each thread keeps the freed chunks in its own cache of two batches of BatchSize chunks.
+ *             The full batches are exchanged with a global depot, a lock-free stack, so the threads only
+ *             touch the shared state once every BatchSize allocations. Only the requests of new pages
+ *             to the area are serialized.
+ *
+ *             It must be used with Policies::SingleThreadPolicy, and reset() must not be called concurrently.
+ */
+template <size_t MaxSize, size_t MaxAlignment = MaxSize, size_t Offset = 0, size_t BatchSize = 32>
+class ConcurrentChunk {
+public:
+    ConcurrentChunk(lug::System::Memory::Area::IArea* area);
+    ConcurrentChunk(const ConcurrentChunk&) = delete;
+    ConcurrentChunk(ConcurrentChunk&&) = delete;
+
+    ConcurrentChunk& operator=(const ConcurrentChunk&) = delete;
+    ConcurrentChunk& operator=(ConcurrentChunk&&) = delete;
+
+    ~ConcurrentChunk() = default;
+
+    void* allocate(size_t size, size_t alignment, size_t offset);
+    void free(void* ptr);
+    void reset();
+
+    size_t getSize(void* ptr) const;
+
+private:
+    struct Element {
+        Element* next;
+    };
+
+    // The chunks hold at least the pointer of the free list
+    static constexpr size_t MinSize = MaxSize > sizeof(Element) ? MaxSize : sizeof(Element);
+    static constexpr size_t ChunkSize = (MaxAlignment <= 1 ? MinSize : priv::ceil(static_cast<float>(MinSize) / MaxAlignment) * MaxAlignment);
+
+    // The chunks are identified in the depot by the index of their page and their index in the page,
+    // so the head of the depot and its ABA tag fit in 64 bits
+    static constexpr uint32_t PageBits = 10;
+    static constexpr uint32_t ChunkBits = 22;
+    static constexpr size_t MaxPageCount = size_t{1} << PageBits;
+    static constexpr uint32_t NullHandle = UINT32_MAX;
+
+    // Link of a batch in the depot, stored after the chunks of the page and not in the chunks,
+    // which can be written by the thread owning them while another thread reads the depot
+    struct Link {
+        std::atomic<uint32_t> nextBatch;
+        uint32_t count;
+    };
+
+    struct Batch {
+        Element* head{nullptr};
+        uint32_t count{0};
+    };
+
+    struct Cache {
+        Batch loaded;
+        Batch previous;
+    };
+
+    // One cache line each, the caches of the threads are written at the same time
+    struct alignas(64) PaddedCache : public Cache {};
+
+    struct PageInfo {
+        char* start;
+        size_t count;
+
+        // One per chunk
+        Link* links;
+    };
+
+private:
+    Element* getChunk(uint32_t handle) const;
+    Link& getLink(uint32_t handle) const;
+    uint32_t getHandle(const Element* element) const;
+
+    void pushBatch(const Batch& batch);
+    Batch popBatch();
+    Batch grow();
+
+    bool addPage(const lug::System::Memory::Area::Page* page);
+
+private:
+    lug::System::Memory::Area::IArea* const _area;
+
+    // Handle of the first batch in the low 32 bits, ABA tag in the high 32 bits
+    std::atomic<uint64_t> _depot{NullHandle};
+
+    std::mutex _growMutex;
+    lug::System::Memory::Area::Page* _currentPage{nullptr};
+    lug::System::Memory::Area::Page* _firstPage{nullptr};
+
+    std::atomic<size_t> _pagesCount{0};
+    PageInfo _pages[MaxPageCount];
+
+    PaddedCache _caches[priv::maxThreadCachesCount];
+};
+
+#include <lug/System/Memory/Allocator/ConcurrentChunk.inl>
+
+} // Allocator
+} // Memory
+} // System
+} // lug
@@ -0,0 +1,298 @@
+template <size_t MaxSize, size_t MaxAlignment, size_t Offset, size_t BatchSize>
+ConcurrentChunk<MaxSize, MaxAlignment, Offset, BatchSize>::ConcurrentChunk(lug::System::Memory::Area::IArea* area) : _area{area} {}
+
+template <size_t MaxSize, size_t MaxAlignment, size_t Offset, size_t BatchSize>
+void* ConcurrentChunk<MaxSize, MaxAlignment, Offset, BatchSize>::allocate(size_t size, size_t alignment, size_t offset) {
+    // In release, LUG_ASSERT is discarded
+    (void)(size);
+    (void)(alignment);
+    (void)(offset);
+
+    LUG_ASSERT(offset == Offset, "Chunk allocator doesn't support multiple offset");
+    LUG_ASSERT(MaxSize >= size, "Size of the allocation is greater than the chunk's max size");
+    LUG_ASSERT(MaxAlignment >= alignment, "Alignment of the allocation is greater than the chunk's max alignment");
+
+    const size_t cacheIndex = priv::getThreadCacheIndex();
+
+    // Too many threads, this one doesn't have a cache and takes the chunks from the depot one by one
+    if (cacheIndex >= priv::maxThreadCachesCount) {
+        Batch batch = popBatch();
+
+        if (!batch.head) {
+            batch = grow();
+        }
+
+        if (!batch.head) {
+            return nullptr;
+        }
+
+        if (batch.count > 1) {
+            pushBatch({batch.head->next, batch.count - 1});
+        }
+
+        return batch.head;
+    }
+
+    Cache& cache = _caches[cacheIndex];
+
+    if (!cache.loaded.count) {
+        if (cache.previous.count) {
+            std::swap(cache.loaded, cache.previous);
+        } else {
+            cache.loaded = popBatch();
+
+            if (!cache.loaded.head) {
+                cache.loaded = grow();
+            }
+
+            if (!cache.loaded.head) {
+                return nullptr;
+            }
+        }
+    }
+
+    Element* const element = cache.loaded.head;
+
+    cache.loaded.head = element->next;
+    --cache.loaded.count;
+
+    return element;
+}
+
+template <size_t MaxSize, size_t MaxAlignment, size_t Offset, size_t BatchSize>
+void ConcurrentChunk<MaxSize, MaxAlignment, Offset, BatchSize>::free(void* ptr) {
+    if (!ptr) {
+        return;
+    }
+
+    Element* const element = static_cast<Element*>(ptr);
+    const size_t cacheIndex = priv::getThreadCacheIndex();
+
+    if (cacheIndex >= priv::maxThreadCachesCount) {
+        element->next = nullptr;
+        pushBatch({element, 1});
+        return;
+    }
+
+    Cache& cache = _caches[cacheIndex];
+
+    // The previous batch is either full or empty, only full batches are given back to the depot
+    if (cache.loaded.count == BatchSize) {
+        if (cache.previous.count) {
+            pushBatch(cache.previous);
+        }
+
+        cache.previous = cache.loaded;
+        cache.loaded = {};
+    }
+
+    element->next = cache.loaded.head;
+
+    cache.loaded.head = element;
+    ++cache.loaded.count;
+}
+
+template <size_t MaxSize, size_t MaxAlignment, size_t Offset, size_t BatchSize>
+void ConcurrentChunk<MaxSize, MaxAlignment, Offset, BatchSize>::reset() {
+    for (Cache& cache : _caches) {
+        cache = {};
+    }
+
+    _depot.store(NullHandle, std::memory_order_relaxed);
+
+    // The pages are split again when the allocator grows
+    _pagesCount.store(0, std::memory_order_relaxed);
+    _currentPage = nullptr;
+}
+
+template <size_t MaxSize, size_t MaxAlignment, size_t Offset, size_t BatchSize>
+size_t ConcurrentChunk<MaxSize, MaxAlignment, Offset, BatchSize>::getSize(void* ptr) const {
+    (void)(ptr);
+
+    return ChunkSize;
+}
+
+template <size_t MaxSize, size_t MaxAlignment, size_t Offset, size_t BatchSize>
+inline typename ConcurrentChunk<MaxSize, MaxAlignment, Offset, BatchSize>::Element* ConcurrentChunk<MaxSize, MaxAlignment, Offset, BatchSize>::getChunk(uint32_t handle) const {
+    const PageInfo& page = _pages[handle >> ChunkBits];
+
+    return reinterpret_cast<Element*>(page.start + (handle & ((uint32_t{1} << ChunkBits) - 1)) * ChunkSize);
+}
+
+template <size_t MaxSize, size_t MaxAlignment, size_t Offset, size_t BatchSize>
+inline typename ConcurrentChunk<MaxSize, MaxAlignment, Offset, BatchSize>::Link& ConcurrentChunk<MaxSize, MaxAlignment, Offset, BatchSize>::getLink(uint32_t handle) const {
+    return _pages[handle >> ChunkBits].links[handle & ((uint32_t{1} << ChunkBits) - 1)];
+}
+
+template <size_t MaxSize, size_t MaxAlignment, size_t Offset, size_t BatchSize>
+uint32_t ConcurrentChunk<MaxSize, MaxAlignment, Offset, BatchSize>::getHandle(const Element* element) const {
+    const char* const ptr = reinterpret_cast<const char*>(element);
+    const size_t pagesCount = _pagesCount.load(std::memory_order_acquire);
+
+    // Once per batch, there are few pages
+    for (size_t i = 0; i < pagesCount; ++i) {
+        const PageInfo& page = _pages[i];
+
+        if (ptr >= page.start && ptr < page.start + page.count * ChunkSize) {
+            return static_cast<uint32_t>((i << ChunkBits) | static_cast<size_t>(ptr - page.start) / ChunkSize);
+        }
+    }
+
+    LUG_ASSERT(false, "Deallocation of pointer from the wrong allocator");
+    return NullHandle;
+}
+
+template <size_t MaxSize, size_t MaxAlignment, size_t Offset, size_t BatchSize>
+void ConcurrentChunk<MaxSize, MaxAlignment, Offset, BatchSize>::pushBatch(const Batch& batch) {
+    const uint32_t handle = getHandle(batch.head);
+    Link& link = getLink(handle);
+
+    link.count = batch.count;
+
+    uint64_t depot = _depot.load(std::memory_order_relaxed);
+    uint64_t newDepot;
+
+    do {
+        link.nextBatch.store(static_cast<uint32_t>(depot), std::memory_order_relaxed);
+        newDepot = ((depot >> 32) + 1) << 32 | handle;
+    } while (!_depot.compare_exchange_weak(depot, newDepot, std::memory_order_release, std::memory_order_relaxed));
+}
+
+template <size_t MaxSize, size_t MaxAlignment, size_t Offset, size_t BatchSize>
+typename ConcurrentChunk<MaxSize, MaxAlignment, Offset, BatchSize>::Batch ConcurrentChunk<MaxSize, MaxAlignment, Offset, BatchSize>::popBatch() {
+    uint64_t depot = _depot.load(std::memory_order_acquire);
+    uint64_t newDepot;
+    uint32_t handle;
+
+    do {
+        handle = static_cast<uint32_t>(depot);
+
+        if (handle == NullHandle) {
+            return {};
+        }
+
+        // The batch can be popped by another thread in the meantime, then the tag has changed and the exchange fails
+        newDepot = ((depot >> 32) + 1) << 32 | getLink(handle).nextBatch.load(std::memory_order_relaxed);
+    } while (!_depot.compare_exchange_weak(depot, newDepot, std::memory_order_acquire, std::memory_order_acquire));
+
+    return {getChunk(handle), getLink(handle).count};
+}
+
+template <size_t MaxSize, size_t MaxAlignment, size_t Offset, size_t BatchSize>
+typename ConcurrentChunk<MaxSize, MaxAlignment, Offset, BatchSize>::Batch ConcurrentChunk<MaxSize, MaxAlignment, Offset, BatchSize>::grow() {
+    std::lock_guard<std::mutex> lock(_growMutex);
+
+    // Another thread could have grown the allocator while this one was waiting
+    {
+        const Batch batch = popBatch();
+
+        if (batch.head) {
+            return batch;
+        }
+    }
+
+    do {
+        if (_pagesCount.load(std::memory_order_relaxed) == MaxPageCount) {
+            return {};
+        }
+
+        // After a reset, the pages are used again from the first one
+        lug::System::Memory::Area::Page* page = _currentPage ? _currentPage->next : _firstPage;
+
+        if (!page) {
+            page = _area->requestNextPage();
+
+            if (!page) {
+                return {};
+            }
+
+            if (_currentPage) {
+                _currentPage->next = page;
+            } else {
+                _firstPage = page;
+            }
+        }
+
+        _currentPage = page;
+    } while (!addPage(_currentPage));
+
+    // Split the new page into batches, keep the first one for the calling thread
+    const size_t pageIndex = _pagesCount.load(std::memory_order_relaxed) - 1;
+    const PageInfo& page = _pages[pageIndex];
+
+    Batch result;
+
+    for (size_t first = 0; first < page.count; first += BatchSize) {
+        const size_t count = page.count - first < BatchSize ? page.count - first : BatchSize;
+
+        Element* const head = reinterpret_cast<Element*>(page.start + first * ChunkSize);
+        Element* it = head;
+
+        for (size_t i = 1; i < count; ++i) {
+            it->next = reinterpret_cast<Element*>(reinterpret_cast<char*>(it) + ChunkSize);
+            it = it->next;
+        }
+
+        it->next = nullptr;
+
+        if (first == 0) {
+            result = {head, static_cast<uint32_t>(count)};
+        } else {
+            pushBatch({head, static_cast<uint32_t>(count)});
+        }
+    }
+
+    return result;
+}
+
+template <size_t MaxSize, size_t MaxAlignment, size_t Offset, size_t BatchSize>
+bool ConcurrentChunk<MaxSize, MaxAlignment, Offset, BatchSize>::addPage(const lug::System::Memory::Area::Page* page) {
+    void* start = static_cast<char*>(page->start) + Offset;
+
+    if (start > page->end) {
+        return false;
+    }
+
+    size_t size = static_cast<char*>(page->end) - static_cast<char*>(start) + 1;
+
+    if (!std::align(MaxAlignment, ChunkSize - Offset, start, size)) {
+        return false;
+    }
+
+    start = static_cast<char*>(start) - Offset;
+    size = static_cast<char*>(page->end) - static_cast<char*>(start) + 1;
+
+    // The links after the chunks, aligned
+    if (size <= alignof(Link)) {
+        return false;
+    }
+
+    size_t count = (size - alignof(Link)) / (ChunkSize + sizeof(Link));
+
+    if (!count) {
+        return false;
+    }
+
+    if (count > (size_t{1} << ChunkBits)) {
+        count = size_t{1} << ChunkBits;
+    }
+
+    void* links = static_cast<char*>(start) + count * ChunkSize;
+    size_t linksSize = static_cast<char*>(page->end) - static_cast<char*>(links) + 1;
+
+    if (!std::align(alignof(Link), count * sizeof(Link), links, linksSize)) {
+        return false;
+    }
+
+    Link* const pageLinks = static_cast<Link*>(links);
+    for (size_t i = 0; i < count; ++i) {
+        new (&pageLinks[i]) Link{};
+    }
+
+    const size_t pagesCount = _pagesCount.load(std::memory_order_relaxed);
+
+    _pages[pagesCount] = {static_cast<char*>(start), count, pageLinks};
+    _pagesCount.store(pagesCount + 1, std::memory_order_release);
+
+    return true;
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <lug/System/Memory/Allocator/Chunk.hpp>
+#include <lug/System/Memory/Allocator/ConcurrentChunk.hpp>
 
 namespace lug {
 namespace System {
@@ -10,6 +11,9 @@ namespace Allocator {
 template <typename T, size_t Alignment = alignof(T), size_t Offset = 0>
 using Pool = Chunk<sizeof(T), Alignment, Offset>;
 
+template <typename T, size_t Alignment = alignof(T), size_t Offset = 0>
+using ConcurrentPool = ConcurrentChunk<sizeof(T), Alignment, Offset>;
+
 } // Allocator
 } // Memory
 } // System
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <lug/System/Export.hpp>
+#include <lug/System/Memory/Area/IArea.hpp>
+
+namespace lug {
+namespace System {
+namespace Memory {
+namespace Area {
+
+enum class HugePages : uint8_t {
+    None,           // Pages of the system, usually 4 KiB
+    Transparent,    // Hint to the system to back the pages with huge pages (Linux only)
+    Explicit        // Reserved huge pages of the system (MAP_HUGETLB), with a fallback to Transparent
+};
+
+/**
+ * \cond HIDDEN_SYMBOLS
+ */
+namespace priv {
+
+// Range of addresses reserved without any memory behind them
+struct LUG_SYSTEM_API VirtualRange {
+    void* base{nullptr};
+    size_t size{0};
+
+    // Aligned on the huge pages, in [base, base + size)
+    char* start{nullptr};
+};
+
+LUG_SYSTEM_API VirtualRange reserveVirtualMemory(size_t size, HugePages hugePages);
+LUG_SYSTEM_API void releaseVirtualMemory(const VirtualRange& range);
+
+LUG_SYSTEM_API bool commitVirtualMemory(void* ptr, size_t size, HugePages hugePages);
+LUG_SYSTEM_API void decommitVirtualMemory(void* ptr, size_t size);
+LUG_SYSTEM_API void discardVirtualMemory(void* ptr, size_t size);
+
+}
+/**
+ * \endcond
+ */
+
+/**
+ * @brief      Area reserving the addresses of all its pages at once and committing the memory of each page when it is requested.
+ *
+ *             The pages are contiguous, large arenas can grow up to PageSize * MaxPageCount bytes
+ *             without reserving physical memory for all of them. With huge pages (2 MiB), the pages
+ *             should be a multiple of 2 MiB.
+ */
+template <size_t PageSize = 2 * 1024 * 1024, size_t MaxPageCount = 512>
+class VirtualMemory : public IArea {
+public:
+    explicit VirtualMemory(HugePages hugePages = HugePages::Transparent);
+    VirtualMemory(const VirtualMemory&) = delete;
+    VirtualMemory(VirtualMemory&&) = delete;
+
+    VirtualMemory& operator=(const VirtualMemory&) = delete;
+    VirtualMemory& operator=(VirtualMemory&&) = delete;
+
+    ~VirtualMemory();
+
+    Page* requestNextPage() override;
+
+    /**
+     * @brief      Gives the physical memory of the committed pages back to the system.
+     *
+     *             The first page, kept by the allocator, stays valid but its content is lost.
+     *             The other pages are decommitted and requested again from the start of the range.
+     *             To call after the reset of the allocator using this area.
+     */
+    void reset();
+
+    bool isReserved() const;
+    size_t getCommittedSize() const;
+
+private:
+    static_assert(PageSize % 4096 == 0, "The size of the pages must be a multiple of the pages of the system");
+
+    priv::VirtualRange _range;
+    HugePages _hugePages;
+
+    size_t _current{0};
+    Page _pages[MaxPageCount];
+};
+
+#include <lug/System/Memory/Area/VirtualMemory.inl>
+
+} // Area
+} // Memory
+} // System
+} // lug
@@ -0,0 +1,58 @@
+template <size_t PageSize, size_t MaxPageCount>
+lug::System::Memory::Area::VirtualMemory<PageSize, MaxPageCount>::VirtualMemory(HugePages hugePages) :
+    _range(priv::reserveVirtualMemory(PageSize * MaxPageCount, hugePages)), _hugePages(hugePages) {}
+
+template <size_t PageSize, size_t MaxPageCount>
+lug::System::Memory::Area::VirtualMemory<PageSize, MaxPageCount>::~VirtualMemory() {
+    priv::releaseVirtualMemory(_range);
+}
+
+template <size_t PageSize, size_t MaxPageCount>
+inline Page* lug::System::Memory::Area::VirtualMemory<PageSize, MaxPageCount>::requestNextPage() {
+    if (!_range.start || _current >= MaxPageCount) {
+        return nullptr;
+    }
+
+    char* const start = _range.start + PageSize * _current;
+
+    if (!priv::commitVirtualMemory(start, PageSize, _hugePages)) {
+        return nullptr;
+    }
+
+    _pages[_current] = {
+        start,
+        start + PageSize - 1,
+        _current == 0 ? nullptr : &_pages[_current - 1],
+        nullptr
+    };
+
+    _current += 1;
+    return &_pages[_current - 1];
+}
+
+template <size_t PageSize, size_t MaxPageCount>
+inline void lug::System::Memory::Area::VirtualMemory<PageSize, MaxPageCount>::reset() {
+    if (!_current) {
+        return;
+    }
+
+    priv::discardVirtualMemory(_range.start, PageSize);
+
+    if (_current > 1) {
+        priv::decommitVirtualMemory(_range.start + PageSize, PageSize * (_current - 1));
+    }
+
+    // The allocator links the next page again when it requests it
+    _pages[0].next = nullptr;
+    _current = 1;
+}
+
+template <size_t PageSize, size_t MaxPageCount>
+inline bool lug::System::Memory::Area::VirtualMemory<PageSize, MaxPageCount>::isReserved() const {
+    return _range.start != nullptr;
+}
+
+template <size_t PageSize, size_t MaxPageCount>
+inline size_t lug::System::Memory::Area::VirtualMemory<PageSize, MaxPageCount>::getCommittedSize() const {
+    return PageSize * _current;
+}
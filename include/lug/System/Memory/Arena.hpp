@@ -1,8 +1,11 @@
 #pragma once
 
 #include <cstdlib>
+#include <utility>
 #include <lug/System/Export.hpp>
 #include <lug/System/Memory/Area/IArea.hpp>
+#include <lug/System/Memory/Location.hpp>
+#include <lug/System/Memory/Policies/MemoryTracker.hpp>
 
 namespace lug {
 namespace System {
@@ -12,7 +15,8 @@ template <
     class Allocator,
     class ThreadPolicy,
     class BoundsCheckingPolicy,
-    class MemoryMarkingPolicy
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy = Policies::NoMemoryTracking
 >
 class Arena {
 public:
@@ -28,17 +32,27 @@ public:
     ~Arena() = default;
 
     void* allocate(size_t size, size_t alignment, size_t offset, const char* file, size_t line);
+    void* allocate(size_t size, size_t alignment, size_t offset, Location& location);
     void free(void* ptr);
     void reset();
 
     Allocator& allocator();
     const Allocator& allocator() const;
 
+    MemoryTrackingPolicy& tracker();
+    const MemoryTrackingPolicy& tracker() const;
+
+private:
+    // The call site is given as is to the tracking policy
+    template <class ...CallSite>
+    void* allocateAt(size_t size, size_t alignment, size_t offset, CallSite&&... callSite);
+
 private:
     Allocator _allocator;
     ThreadPolicy _threadGuard;
     BoundsCheckingPolicy _boundsChecker;
     MemoryMarkingPolicy _memoryMarker;
+    MemoryTrackingPolicy _memoryTracker;
 };
 
 #include <lug/System/Memory/Arena.inl>
@@ -2,56 +2,98 @@ template <
     class Allocator,
     class ThreadPolicy,
     class BoundsCheckingPolicy,
-    class MemoryMarkingPolicy
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
 >
-Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy>::Arena(Area::IArea* area) : _allocator{area} {}
+Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::Arena(Area::IArea* area) : _allocator{area} {}
 
 template <
     class Allocator,
     class ThreadPolicy,
     class BoundsCheckingPolicy,
-    class MemoryMarkingPolicy
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
 >
-void* Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy>::allocate(size_t size, size_t alignment, size_t offset, const char* file, size_t line) {
-    // TODO: Use file and line
-    (void)(file);
-    (void)(line);
+void* Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::allocate(size_t size, size_t alignment, size_t offset, const char* file, size_t line) {
+    return allocateAt(size, alignment, offset, file, line);
+}
+
+template <
+    class Allocator,
+    class ThreadPolicy,
+    class BoundsCheckingPolicy,
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
+>
+void* Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::allocate(size_t size, size_t alignment, size_t offset, Location& location) {
+    return allocateAt(size, alignment, offset, location);
+}
+
+template <
+    class Allocator,
+    class ThreadPolicy,
+    class BoundsCheckingPolicy,
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
+>
+template <class ...CallSite>
+void* Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::allocateAt(size_t size, size_t alignment, size_t offset, CallSite&&... callSite) {
+    // The header of the tracking policy is before the front guard
+    constexpr size_t HeaderSize = MemoryTrackingPolicy::HeaderSize;
 
-    const size_t newSize = size + BoundsCheckingPolicy::SizeFront + BoundsCheckingPolicy::SizeBack;
+    const size_t newSize = size + HeaderSize + BoundsCheckingPolicy::SizeFront + BoundsCheckingPolicy::SizeBack;
 
     _threadGuard.enter();
 
-    char* const ptr = static_cast<char*>(_allocator.allocate(newSize, alignment, offset + BoundsCheckingPolicy::SizeFront));
+    char* const ptr = static_cast<char*>(_allocator.allocate(newSize, alignment, offset + HeaderSize + BoundsCheckingPolicy::SizeFront));
+
+    if (!ptr) {
+        _threadGuard.leave();
+        return nullptr;
+    }
+
     const size_t allocatedSize = _allocator.getSize(ptr);
 
-    _boundsChecker.guardFront(ptr, allocatedSize);
-    _memoryMarker.markAllocation(ptr + BoundsCheckingPolicy::SizeFront, allocatedSize - BoundsCheckingPolicy::SizeFront - BoundsCheckingPolicy::SizeBack);
-    _boundsChecker.guardBack(ptr, allocatedSize);
+    char* const guardedPtr = ptr + HeaderSize;
+    const size_t guardedSize = allocatedSize - HeaderSize;
+
+    _boundsChecker.guardFront(guardedPtr, guardedSize);
+    _memoryMarker.markAllocation(guardedPtr + BoundsCheckingPolicy::SizeFront, guardedSize - BoundsCheckingPolicy::SizeFront - BoundsCheckingPolicy::SizeBack);
+    _boundsChecker.guardBack(guardedPtr, guardedSize);
+
+    _memoryTracker.onAllocation(ptr, allocatedSize, std::forward<CallSite>(callSite)...);
 
     _threadGuard.leave();
 
-    return (ptr + BoundsCheckingPolicy::SizeFront);
+    return (guardedPtr + BoundsCheckingPolicy::SizeFront);
 }
 
 template <
     class Allocator,
     class ThreadPolicy,
     class BoundsCheckingPolicy,
-    class MemoryMarkingPolicy
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
 >
-void Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy>::free(void* ptr) {
+void Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::free(void* ptr) {
     if (!ptr) {
         return;
     }
 
-    char* const originalMemory = static_cast<char*>(ptr) - BoundsCheckingPolicy::SizeFront;
+    constexpr size_t HeaderSize = MemoryTrackingPolicy::HeaderSize;
+
+    char* const originalMemory = static_cast<char*>(ptr) - BoundsCheckingPolicy::SizeFront - HeaderSize;
     const size_t allocatedSize = _allocator.getSize(originalMemory);
 
+    char* const guardedPtr = originalMemory + HeaderSize;
+    const size_t guardedSize = allocatedSize - HeaderSize;
+
     _threadGuard.enter();
 
-    _boundsChecker.checkFront(originalMemory, allocatedSize);
-    _boundsChecker.checkBack(originalMemory, allocatedSize);
+    _boundsChecker.checkFront(guardedPtr, guardedSize);
+    _boundsChecker.checkBack(guardedPtr, guardedSize);
 
+    _memoryTracker.onDeallocation(originalMemory, allocatedSize);
     _memoryMarker.markDeallocation(originalMemory, allocatedSize);
 
     _allocator.free(originalMemory);
@@ -63,12 +105,13 @@ template <
     class Allocator,
     class ThreadPolicy,
     class BoundsCheckingPolicy,
-    class MemoryMarkingPolicy
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
 >
-void Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy>::reset() {
+void Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::reset() {
     _threadGuard.enter();
 
-    _boundsChecker.checkReset();
+    _memoryTracker.onReset();
     _allocator.reset();
 
     _threadGuard.leave();
@@ -78,9 +121,10 @@ template <
     class Allocator,
     class ThreadPolicy,
     class BoundsCheckingPolicy,
-    class MemoryMarkingPolicy
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
 >
-Allocator& Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy>::allocator() {
+Allocator& Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::allocator() {
     return _allocator;
 }
 
@@ -88,8 +132,31 @@ template <
     class Allocator,
     class ThreadPolicy,
     class BoundsCheckingPolicy,
-    class MemoryMarkingPolicy
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
 >
-const Allocator& Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy>::allocator() const {
+const Allocator& Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::allocator() const {
     return _allocator;
 }
+
+template <
+    class Allocator,
+    class ThreadPolicy,
+    class BoundsCheckingPolicy,
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
+>
+MemoryTrackingPolicy& Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::tracker() {
+    return _memoryTracker;
+}
+
+template <
+    class Allocator,
+    class ThreadPolicy,
+    class BoundsCheckingPolicy,
+    class MemoryMarkingPolicy,
+    class MemoryTrackingPolicy
+>
+const MemoryTrackingPolicy& Arena<Allocator, ThreadPolicy, BoundsCheckingPolicy, MemoryMarkingPolicy, MemoryTrackingPolicy>::tracker() const {
+    return _memoryTracker;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace lug {
+namespace System {
+namespace Memory {
+
+namespace Tracking {
+
+struct CallSite;
+
+} // Tracking
+
+/**
+ * @brief      Call site of an allocation, a static of each LUG_NEW (see LUG_MEMORY_LOCATION).
+ *
+ *             Constant initialized, the tracking resolves it once and keeps the result in it.
+ */
+struct Location {
+    constexpr Location(const char* file, size_t line) : file{file}, line{line} {}
+
+    const char* const file;
+    const size_t line;
+
+    // Set the first time an allocation of this call site is tracked, see Policies::SimpleMemoryTracking
+    std::atomic<Tracking::CallSite*> callSite{nullptr};
+};
+
+} // Memory
+} // System
+} // lug
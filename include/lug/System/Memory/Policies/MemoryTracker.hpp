@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <lug/System/Export.hpp>
+#include <lug/System/Memory/Tracking.hpp>
+
+namespace lug {
+namespace System {
+namespace Memory {
+namespace Policies {
+
+class NoMemoryTracking {
+public:
+    static constexpr size_t HeaderSize = 0;
+
+    void onAllocation(void* ptr, size_t size, const char* file, size_t line) const;
+    void onAllocation(void* ptr, size_t size, Location& location) const;
+    void onDeallocation(void* ptr, size_t size) const;
+    void onReset() const;
+};
+
+/**
+ * @brief      Counts the live allocations of the arena and of each call site of LUG_NEW, see Memory::Tracking.
+ *
+ *             Each allocation stores the counters of its call site in a header of HeaderSize bytes.
+ *             The counters are kept per thread, without atomic read-modify-write operations unless
+ *             the memory is freed by another thread. The call site of a Location is only looked up
+ *             the first time, the remaining cost is the thread index, see the Tracking.Overhead test.
+ */
+class SimpleMemoryTracking {
+public:
+    static constexpr size_t HeaderSize = sizeof(Tracking::Counters*);
+
+public:
+    SimpleMemoryTracking();
+    SimpleMemoryTracking(const SimpleMemoryTracking&) = delete;
+    SimpleMemoryTracking(SimpleMemoryTracking&& tracker);
+
+    SimpleMemoryTracking& operator=(const SimpleMemoryTracking&) = delete;
+    SimpleMemoryTracking& operator=(SimpleMemoryTracking&& tracker);
+
+    ~SimpleMemoryTracking();
+
+    void onAllocation(void* ptr, size_t size, const char* file, size_t line);
+    void onAllocation(void* ptr, size_t size, Location& location);
+    void onDeallocation(void* ptr, size_t size);
+
+    // The allocations released by the reset of the arena are still counted in their call sites
+    void onReset();
+
+    /**
+     * @brief      Sets the name of the arena in the dumps.
+     *
+     * @param[in]  name  The name, which must outlive the arena (e.g. a string literal).
+     */
+    void setName(const char* name);
+
+    Tracking::Stats getStats() const;
+
+private:
+    void onAllocation(void* ptr, size_t size, Tracking::Counters& callSite, uint32_t thread);
+
+private:
+    Tracking::TrackedArena* _arena;
+};
+
+#include <lug/System/Memory/Policies/MemoryTracker.inl>
+
+} // Policies
+} // Memory
+} // System
+} // lug
@@ -0,0 +1,76 @@
+inline void NoMemoryTracking::onAllocation(void*, size_t, const char*, size_t) const {}
+inline void NoMemoryTracking::onAllocation(void*, size_t, Location&) const {}
+inline void NoMemoryTracking::onDeallocation(void*, size_t) const {}
+inline void NoMemoryTracking::onReset() const {}
+
+inline SimpleMemoryTracking::SimpleMemoryTracking() : _arena(Tracking::registerArena()) {}
+
+inline SimpleMemoryTracking::SimpleMemoryTracking(SimpleMemoryTracking&& tracker) : _arena(tracker._arena) {
+    tracker._arena = nullptr;
+}
+
+inline SimpleMemoryTracking& SimpleMemoryTracking::operator=(SimpleMemoryTracking&& tracker) {
+    Tracking::unregisterArena(_arena);
+
+    _arena = tracker._arena;
+    tracker._arena = nullptr;
+
+    return *this;
+}
+
+inline SimpleMemoryTracking::~SimpleMemoryTracking() {
+    Tracking::unregisterArena(_arena);
+}
+
+inline void SimpleMemoryTracking::onAllocation(void* ptr, size_t size, const char* file, size_t line) {
+    const uint32_t thread = Tracking::getThreadIndex();
+    onAllocation(ptr, size, Tracking::getCallSiteCounters(file, line, thread), thread);
+}
+
+inline void SimpleMemoryTracking::onAllocation(void* ptr, size_t size, Location& location) {
+    const uint32_t thread = Tracking::getThreadIndex();
+    onAllocation(ptr, size, Tracking::getCallSiteCounters(location, thread), thread);
+}
+
+inline void SimpleMemoryTracking::onAllocation(void* ptr, size_t size, Tracking::Counters& callSite, uint32_t thread) {
+    Tracking::Counters* const callSitePtr = &callSite;
+
+    // The header is not aligned for a pointer if the alignment of the allocation is lower
+    std::memcpy(ptr, &callSitePtr, sizeof(callSitePtr));
+
+    callSite.add(size, thread);
+
+    // The owner of the call-site counters finds the arena counters again in onDeallocation
+    if (_arena) {
+        Tracking::getArenaCounters(*_arena, callSite.owner).add(size, thread);
+    }
+}
+
+inline void SimpleMemoryTracking::onDeallocation(void* ptr, size_t size) {
+    Tracking::Counters* callSite;
+    std::memcpy(&callSite, ptr, sizeof(callSite));
+
+    const uint32_t thread = Tracking::getThreadIndex();
+
+    callSite->remove(size, thread);
+
+    if (_arena) {
+        Tracking::getArenaCounters(*_arena, callSite->owner).remove(size, thread);
+    }
+}
+
+inline void SimpleMemoryTracking::onReset() {
+    if (_arena) {
+        Tracking::removeAll(*_arena);
+    }
+}
+
+inline void SimpleMemoryTracking::setName(const char* name) {
+    if (_arena) {
+        _arena->name.store(name, std::memory_order_relaxed);
+    }
+}
+
+inline Tracking::Stats SimpleMemoryTracking::getStats() const {
+    return _arena ? Tracking::getStats(*_arena) : Tracking::Stats{};
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <lug/System/Export.hpp>
+#include <lug/System/Memory/Allocator/Stack.hpp>
+#include <lug/System/Memory/Location.hpp>
+
+namespace lug {
+namespace System {
+namespace Memory {
+
+/**
+ * @brief      Temporary memory of the current thread, released when the scope ends.
+ *
+ *             Each thread has a stack of pages, requested the first time it allocates and kept for
+ *             the next scopes. A scope rewinds the stack to where it was when the scope was created,
+ *             so an allocation is a pointer bump and nothing is freed, e.g. for the arrays of a frame:
+ *
+ *                 ScratchScope scratch;
+ *                 float* factors = scratch.allocate<float>(count);
+ *
+ *             The scopes can be nested, only the innermost scope of the thread can allocate.
+ *             In debug, the allocations are guarded and marked, the guards are checked when the scope ends
+ *             (see Policies::SimpleBoundsChecking and Policies::SimpleMemoryMarking).
+ */
+class LUG_SYSTEM_API ScratchScope {
+public:
+    // A cache line, and the widest SIMD registers
+    static constexpr size_t defaultAlignment = 64;
+
+    static constexpr size_t pageSize = 1024 * 1024;
+    static constexpr size_t maxPageCount = 256;
+
+public:
+    ScratchScope();
+
+    ScratchScope(const ScratchScope&) = delete;
+    ScratchScope(ScratchScope&&) = delete;
+
+    ScratchScope& operator=(const ScratchScope&) = delete;
+    ScratchScope& operator=(ScratchScope&&) = delete;
+
+    ~ScratchScope();
+
+    /**
+     * @brief      Allocates memory which is valid until the end of the scope.
+     *
+     * @param[in]  size       The size, in bytes.
+     * @param[in]  alignment  The alignment, a power of two.
+     *
+     * @return     The memory, nullptr if it doesn't fit in a page or if the thread used all its pages.
+     */
+    void* allocate(size_t size, size_t alignment = defaultAlignment);
+
+    /**
+     * @brief      Allocates an uninitialized array. The destructors of the elements are never called.
+     *
+     * @param[in]  count  The number of elements.
+     */
+    template <typename T>
+    T* allocate(size_t count);
+
+    // Interface of the arenas, e.g. for LUG_NEW. The memory is only released at the end of the scope.
+    void* allocate(size_t size, size_t alignment, size_t offset, const char* file, size_t line);
+    void* allocate(size_t size, size_t alignment, size_t offset, Location& location);
+    void free(void* ptr);
+
+private:
+    struct Data;
+
+    static Data& getThreadData();
+
+    template <class ...CallSite>
+    void* allocateAt(size_t size, size_t alignment, size_t offset, CallSite&&... callSite);
+
+private:
+    Data& _data;
+    Allocator::Stack::Mark _mark;
+
+    ScratchScope* _parent{nullptr};
+    size_t _allocationsCount{0};
+};
+
+/**
+ * @brief      Allocator of the standard containers using a ScratchScope, e.g. for a temporary std::vector.
+ *
+ *             The containers must be destroyed before the scope.
+ */
+template <typename T>
+class ScratchAllocator {
+public:
+    using value_type = T;
+
+public:
+    explicit ScratchAllocator(ScratchScope& scope);
+
+    template <typename U>
+    ScratchAllocator(const ScratchAllocator<U>& other);
+
+    T* allocate(size_t count);
+    void deallocate(T* ptr, size_t count);
+
+    ScratchScope& getScope() const;
+
+private:
+    ScratchScope* _scope;
+};
+
+template <typename T, typename U>
+bool operator==(const ScratchAllocator<T>& lhs, const ScratchAllocator<U>& rhs);
+
+template <typename T, typename U>
+bool operator!=(const ScratchAllocator<T>& lhs, const ScratchAllocator<U>& rhs);
+
+#include <lug/System/Memory/Scratch.inl>
+
+} // Memory
+} // System
+} // lug
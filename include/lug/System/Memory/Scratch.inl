@@ -0,0 +1,40 @@
+template <typename T>
+inline T* ScratchScope::allocate(size_t count) {
+    return static_cast<T*>(allocate(count * sizeof(T), alignof(T) > defaultAlignment ? alignof(T) : defaultAlignment));
+}
+
+template <typename T>
+inline ScratchAllocator<T>::ScratchAllocator(ScratchScope& scope) : _scope(&scope) {}
+
+template <typename T>
+template <typename U>
+inline ScratchAllocator<T>::ScratchAllocator(const ScratchAllocator<U>& other) : _scope(&other.getScope()) {}
+
+template <typename T>
+inline T* ScratchAllocator<T>::allocate(size_t count) {
+    T* const ptr = _scope->allocate<T>(count);
+
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+
+    return ptr;
+}
+
+template <typename T>
+inline void ScratchAllocator<T>::deallocate(T*, size_t) {}
+
+template <typename T>
+inline ScratchScope& ScratchAllocator<T>::getScope() const {
+    return *_scope;
+}
+
+template <typename T, typename U>
+inline bool operator==(const ScratchAllocator<T>& lhs, const ScratchAllocator<U>& rhs) {
+    return &lhs.getScope() == &rhs.getScope();
+}
+
+template <typename T, typename U>
+inline bool operator!=(const ScratchAllocator<T>& lhs, const ScratchAllocator<U>& rhs) {
+    return !(lhs == rhs);
+}
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <lug/System/Export.hpp>
+#include <lug/System/Memory/Location.hpp>
+
+namespace lug {
+namespace System {
+namespace Memory {
+namespace Tracking {
+
+// Maximum number of threads with their own counters at the same time, the others share the same counters
+constexpr uint32_t maxThreadsCount = 64;
+
+/**
+ * @brief      Counters of the allocations made by one thread at a call site or in an arena.
+ *
+ *             The owner thread updates them without atomic read-modify-write operations,
+ *             the deallocations made by the other threads are counted apart.
+ *             The counters of the threads are added up by getCallSites() and getArenas().
+ */
+struct LUG_SYSTEM_API Counters {
+    // Index of the thread owning the counters, 0 if they are shared by several threads
+    uint32_t owner{0};
+
+    // Written by the owner only
+    std::atomic<size_t> totalCount{0};
+    std::atomic<size_t> count{0};
+    std::atomic<size_t> bytes{0};
+
+    // High-water marks of the live allocations
+    std::atomic<size_t> peakCount{0};
+    std::atomic<size_t> peakBytes{0};
+
+    // Deallocations made by the other threads, to subtract from count and bytes
+    std::atomic<size_t> remoteCount{0};
+    std::atomic<size_t> remoteBytes{0};
+
+    void add(size_t size, uint32_t thread);
+    void remove(size_t size, uint32_t thread);
+
+    // Removes all the live allocations, keeping the peaks
+    void removeAll();
+    void clear();
+};
+
+// Snapshot of Counters, or sum of the counters of all the threads
+//
+// The peaks of the threads are added up: they are exact when the allocations are made by
+// one thread at a time, and an upper bound otherwise
+struct Stats {
+    size_t count;
+    size_t bytes;
+    size_t peakCount;
+    size_t peakBytes;
+    size_t totalCount;
+};
+
+struct CallSiteStats {
+    const char* file;
+    size_t line;
+    Stats stats;
+};
+
+struct ArenaStats {
+    const char* name;
+    Stats stats;
+};
+
+/**
+ * @brief      Call site of the tracked allocations, a Location is resolved to it once.
+ */
+struct LUG_SYSTEM_API CallSite {
+    // Hash of the file and the line, 0 if the slot is free
+    std::atomic<uint64_t> key{0};
+
+    // Written once the slot is taken, the line before the file
+    std::atomic<const char*> file{nullptr};
+    size_t line{0};
+
+    // Counters of the threads without index, or of all the threads if there are no more counters available
+    Counters counters;
+
+    // Counters of each thread, created by the thread itself. The first one is counters.
+    std::atomic<Counters*> threadCounters[maxThreadsCount]{};
+};
+
+/**
+ * @brief      Arena registered by Policies::SimpleMemoryTracking.
+ */
+struct LUG_SYSTEM_API TrackedArena {
+    std::atomic<bool> used{false};
+    std::atomic<const char*> name{nullptr};
+
+    // Counters of the threads without index
+    Counters counters;
+
+    // Counters of each thread, created by the thread itself. The first one is counters.
+    std::atomic<Counters*> threadCounters[maxThreadsCount]{};
+};
+
+/**
+ * @brief      Gets the index of the calling thread in the counters of the call sites and of the arenas.
+ *
+ *             The index is released when the thread exits, to be reused by another thread.
+ *
+ * @return     The index, 0 if too many threads are using the tracking at the same time.
+ */
+LUG_SYSTEM_API uint32_t getThreadIndex();
+
+/**
+ * @brief      Gets the counters of a call site for a thread, created the first time.
+ *
+ * @param[in]  file    The file, e.g. __FILE__.
+ * @param[in]  line    The line, e.g. __LINE__.
+ * @param[in]  thread  The index of the calling thread.
+ *
+ * @return     The counters, shared by the threads without index and by all the call sites if there are too many.
+ */
+LUG_SYSTEM_API Counters& getCallSiteCounters(const char* file, size_t line, uint32_t thread);
+
+/**
+ * @brief      Gets the counters of a call site for a thread, without looking up the call site once it is resolved.
+ *
+ * @param[in]  location  The location of the call site, see LUG_MEMORY_LOCATION.
+ * @param[in]  thread    The index of the calling thread.
+ *
+ * @return     The counters, as getCallSiteCounters(location.file, location.line, thread).
+ */
+Counters& getCallSiteCounters(Location& location, uint32_t thread);
+LUG_SYSTEM_API Counters& createCallSiteCounters(Location& location, uint32_t thread);
+
+/**
+ * @brief      Gets the counters of an arena for a thread.
+ *
+ * @param[in]  arena   The arena.
+ * @param[in]  thread  The index of the calling thread, or of a thread which already allocated from the arena.
+ *
+ * @return     The counters, shared by the threads without index.
+ */
+Counters& getArenaCounters(TrackedArena& arena, uint32_t thread);
+LUG_SYSTEM_API Counters& createArenaCounters(TrackedArena& arena, uint32_t thread);
+
+/**
+ * @return     A free slot of arena, nullptr if there are too many arenas tracked.
+ */
+LUG_SYSTEM_API TrackedArena* registerArena();
+LUG_SYSTEM_API void unregisterArena(TrackedArena* arena);
+
+/**
+ * @brief      Gets the call sites with live allocations, the largest first.
+ *
+ *             The call sites of the same file and line in several libraries are merged.
+ */
+LUG_SYSTEM_API std::vector<CallSiteStats> getCallSites();
+
+/**
+ * @brief      Gets the tracked arenas, the largest first.
+ */
+LUG_SYSTEM_API std::vector<ArenaStats> getArenas();
+
+/**
+ * @brief      Logs the tracked arenas and the largest call sites.
+ *
+ * @param[in]  maxCallSitesCount  The maximum number of call sites to log.
+ */
+LUG_SYSTEM_API void dump(size_t maxCallSitesCount = 10);
+
+Stats getStats(const Counters& counters);
+
+/**
+ * @brief      Removes all the live allocations of an arena, keeping the peaks.
+ *
+ *             Must not be called while other threads allocate from the arena.
+ */
+LUG_SYSTEM_API void removeAll(TrackedArena& arena);
+
+/**
+ * @brief      Gets the sum of the counters of all the threads for an arena.
+ */
+LUG_SYSTEM_API Stats getStats(const TrackedArena& arena);
+
+#include <lug/System/Memory/Tracking.inl>
+
+} // Tracking
+} // Memory
+} // System
+} // lug
@@ -0,0 +1,95 @@
+inline void Counters::add(size_t size, uint32_t thread) {
+    size_t newCount;
+    size_t newBytes;
+
+    if (thread && thread == owner) {
+        // Only the owner writes these counters, plain loads and stores are enough
+        totalCount.store(totalCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+        newCount = count.load(std::memory_order_relaxed) + 1;
+        count.store(newCount, std::memory_order_relaxed);
+
+        newBytes = bytes.load(std::memory_order_relaxed) + size;
+        bytes.store(newBytes, std::memory_order_relaxed);
+    } else {
+        totalCount.fetch_add(1, std::memory_order_relaxed);
+        newCount = count.fetch_add(1, std::memory_order_relaxed) + 1;
+        newBytes = bytes.fetch_add(size, std::memory_order_relaxed) + size;
+    }
+
+    // The remote deallocations are of allocations already counted
+    const size_t currentRemoteCount = remoteCount.load(std::memory_order_relaxed);
+    const size_t currentRemoteBytes = remoteBytes.load(std::memory_order_relaxed);
+    const size_t liveCount = newCount > currentRemoteCount ? newCount - currentRemoteCount : 0;
+    const size_t liveBytes = newBytes > currentRemoteBytes ? newBytes - currentRemoteBytes : 0;
+
+    // The peaks are only written when they grow, which is rare once the application is running
+    if (thread && thread == owner) {
+        if (liveCount > peakCount.load(std::memory_order_relaxed)) {
+            peakCount.store(liveCount, std::memory_order_relaxed);
+        }
+
+        if (liveBytes > peakBytes.load(std::memory_order_relaxed)) {
+            peakBytes.store(liveBytes, std::memory_order_relaxed);
+        }
+    } else {
+        size_t peak = peakCount.load(std::memory_order_relaxed);
+        while (liveCount > peak && !peakCount.compare_exchange_weak(peak, liveCount, std::memory_order_relaxed)) {}
+
+        peak = peakBytes.load(std::memory_order_relaxed);
+        while (liveBytes > peak && !peakBytes.compare_exchange_weak(peak, liveBytes, std::memory_order_relaxed)) {}
+    }
+}
+
+inline void Counters::remove(size_t size, uint32_t thread) {
+    if (thread && thread == owner) {
+        count.store(count.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+        bytes.store(bytes.load(std::memory_order_relaxed) - size, std::memory_order_relaxed);
+    } else {
+        remoteCount.fetch_add(1, std::memory_order_relaxed);
+        remoteBytes.fetch_add(size, std::memory_order_relaxed);
+    }
+}
+
+inline void Counters::removeAll() {
+    remoteCount.store(count.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    remoteBytes.store(bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+inline void Counters::clear() {
+    totalCount.store(0, std::memory_order_relaxed);
+    count.store(0, std::memory_order_relaxed);
+    bytes.store(0, std::memory_order_relaxed);
+    peakCount.store(0, std::memory_order_relaxed);
+    peakBytes.store(0, std::memory_order_relaxed);
+    remoteCount.store(0, std::memory_order_relaxed);
+    remoteBytes.store(0, std::memory_order_relaxed);
+}
+
+inline Counters& getCallSiteCounters(Location& location, uint32_t thread) {
+    CallSite* const callSite = location.callSite.load(std::memory_order_acquire);
+    Counters* const counters = callSite ? callSite->threadCounters[thread].load(std::memory_order_acquire) : nullptr;
+
+    return counters ? *counters : createCallSiteCounters(location, thread);
+}
+
+inline Counters& getArenaCounters(TrackedArena& arena, uint32_t thread) {
+    Counters* const counters = arena.threadCounters[thread].load(std::memory_order_acquire);
+    return counters ? *counters : createArenaCounters(arena, thread);
+}
+
+inline Stats getStats(const Counters& counters) {
+    // The remote counts first, to not be greater than the counts
+    const size_t remoteCount = counters.remoteCount.load(std::memory_order_relaxed);
+    const size_t remoteBytes = counters.remoteBytes.load(std::memory_order_relaxed);
+    const size_t count = counters.count.load(std::memory_order_relaxed);
+    const size_t bytes = counters.bytes.load(std::memory_order_relaxed);
+
+    return {
+        count > remoteCount ? count - remoteCount : 0,          // count
+        bytes > remoteBytes ? bytes - remoteBytes : 0,          // bytes
+        counters.peakCount.load(std::memory_order_relaxed),     // peakCount
+        counters.peakBytes.load(std::memory_order_relaxed),     // peakBytes
+        counters.totalCount.load(std::memory_order_relaxed)     // totalCount
+    };
+}
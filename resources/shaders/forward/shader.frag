@@ -1,5 +1,9 @@
 #version 450
 
+#if BINDLESS
+#extension GL_EXT_nonuniform_qualifier : require
+#endif
+
 //////////////////////////////////////////////////////////////////////////////
 // CONSTANTS
 //////////////////////////////////////////////////////////////////////////////
@@ -42,10 +46,34 @@ layout(std140, set = 1, binding = 0) uniform lightDataBlock {
     uint lightsNb;
 };
 
-layout(std140, set = 2, binding = 0) uniform materialBlock {
+// Image-based lighting of the skybox, only added with the first batch of lights
+#if ENVIRONMENT
+layout (set = 1, binding = 1) uniform samplerCube irradianceMap;
+layout (set = 1, binding = 2) uniform samplerCube specularMap;
+layout (set = 1, binding = 3) uniform sampler2D brdfLut;
+#endif
+
+// The textures of the material are (index in the array of textures << 2 | texCoord), only used in bindless mode
+struct MaterialData {
     Material material;
+    uint textures[5];
+};
+
+layout(std430, set = 2, binding = 0) readonly buffer materialsBlock {
+    MaterialData materials[];
 };
 
+// The model transform, at offset 0, is only read by the vertex shader
+layout (push_constant) uniform objectBlock {
+    layout(offset = 64) uint materialIndex;
+} object;
+
+// Row of the material of the object, read at the beginning of main
+Material material;
+#if BINDLESS
+uint materialTextures[5];
+#endif
+
 layout (location = 0) in vec3 inPositionWorldSpace;
 layout (location = 1) in vec3 inNormalWorldSpace;
 
@@ -93,6 +121,10 @@ layout (set = 3, binding = TEXTURE_OCCLUSION_BINDING) uniform sampler2D textureO
 layout (set = 3, binding = TEXTURE_EMISSIVE_BINDING) uniform sampler2D textureEmissive;
 #endif
 
+#if BINDLESS
+layout (set = 3, binding = 0) uniform sampler2D textures[];
+#endif
+
 layout (location = IN_FREE_LOCATION) in vec3 inCameraPositionWorldSpace;
 
 //////////////////////////////////////////////////////////////////////////////
@@ -101,6 +133,82 @@ layout (location = IN_FREE_LOCATION) in vec3 inCameraPositionWorldSpace;
 
 layout (location = 0) out vec4 outColor;
 
+//////////////////////////////////////////////////////////////////////////////
+// BINDLESS FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+#if BINDLESS
+const uint NO_TEXTURE = 0xFFFFFFFFu;
+
+const uint SLOT_COLOR = 0u;
+const uint SLOT_METALLIC_ROUGHNESS = 1u;
+const uint SLOT_NORMAL = 2u;
+const uint SLOT_OCCLUSION = 3u;
+const uint SLOT_EMISSIVE = 4u;
+
+vec2 getTextureUV(uint slot) {
+    const uint texCoord = materialTextures[slot] & 3u;
+
+    #if IN_UV >= 3
+    if (texCoord == 2u) {
+        return inUV2;
+    }
+    #endif
+
+    #if IN_UV >= 2
+    if (texCoord == 1u) {
+        return inUV1;
+    }
+    #endif
+
+    #if IN_UV >= 1
+    return inUV0;
+    #else
+    return vec2(0.0);
+    #endif
+}
+
+vec4 sampleTexture(uint slot, vec4 defaultValue) {
+    if (materialTextures[slot] == NO_TEXTURE) {
+        return defaultValue;
+    }
+
+    return texture(textures[nonuniformEXT(materialTextures[slot] >> 2u)], getTextureUV(slot));
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// NORMAL MAPPING FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+#if TEXTURE_NORMAL || BINDLESS
+vec3 applyNormalTexture(vec3 textureValue, vec2 uv) {
+    // Get the normal from the texture in tangent space and scale it
+    vec3 normalTangentSpace = 2.0 * textureValue - 1.0;
+    normalTangentSpace = normalize(normalTangentSpace * vec3(material.normalTextureScale, material.normalTextureScale, 1.0));
+
+    // Compute the matrix to transform the normal from tangent space to world space
+    # if IN_TANGENT
+    const vec3 tangent = normalize(inTangent.xyz);
+    const vec3 bitangent = normalize(cross(inNormalWorldSpace, tangent) * inTangent.w);
+    # else
+    const vec3 deltaPosX = dFdx(inPositionWorldSpace);
+    const vec3 deltaPosY = dFdy(inPositionWorldSpace);
+    const vec2 deltaUvX = dFdx(uv);
+    const vec2 deltaUvY = dFdy(uv);
+
+    vec3 tangent = (deltaUvY.t * deltaPosX - deltaUvX.t * deltaPosY) / (deltaUvX.s * deltaUvY.t - deltaUvY.s * deltaUvX.t);
+    tangent = normalize(tangent - inNormalWorldSpace * dot(inNormalWorldSpace, tangent));
+    const vec3 bitangent = normalize(cross(inNormalWorldSpace, tangent));
+    # endif
+
+    const mat3 tbn = mat3(tangent, bitangent, inNormalWorldSpace);
+
+    // Transform the normal from tangent space to world space
+    return normalize(tbn * normalTangentSpace);
+}
+#endif
+
 //////////////////////////////////////////////////////////////////////////////
 // BRDF FUNCTIONS
 //////////////////////////////////////////////////////////////////////////////
@@ -109,6 +217,11 @@ vec3 fresnelSchlick(float cosTheta, vec3 F0) {
     return F0 + (1.0 - F0) * pow(1.0 - cosTheta, 5.0);
 }
 
+// Fresnel averaged over the lobe of a rough surface, for the lighting coming from all the directions
+vec3 fresnelSchlickRoughness(float cosTheta, vec3 F0, float roughness) {
+    return F0 + (max(vec3(1.0 - roughness), F0) - F0) * pow(1.0 - cosTheta, 5.0);
+}
+
 float DistributionGGX(float NdotH, float roughness) {
     const float a = roughness * roughness;
     const float a2 = a * a;
@@ -135,14 +248,22 @@ float GeometrySchlickGGX(float NdotV, float NdotL, float roughness) {
 //////////////////////////////////////////////////////////////////////////////
 
 void main() {
+    material = materials[object.materialIndex].material;
+    #if BINDLESS
+    materialTextures = materials[object.materialIndex].textures;
+    #endif
+
     //////////////////////////////////////////////////////////////////////
     // CALCULATE THE FINAL COLOR
     //////////////////////////////////////////////////////////////////////
 
+    // The color textures are sRGB, they are decoded to linear by the sampler
     vec4 albedo = material.color;
 
     #if TEXTURE_COLOR
-    albedo = albedo * pow(texture(textureColor, TEXTURE_COLOR_UV).rgba, vec4(2.2));
+    albedo = albedo * texture(textureColor, TEXTURE_COLOR_UV);
+    #elif BINDLESS
+    albedo = albedo * sampleTexture(SLOT_COLOR, vec4(1.0));
     #endif
 
     #if IN_COLOR >= 1
@@ -161,8 +282,12 @@ void main() {
     // CALCULATE THE FINAL METALLIC & ROUGHNESS
     //////////////////////////////////////////////////////////////////////
 
-    #if TEXTURE_METALLIC_ROUGHNESS
+    #if TEXTURE_METALLIC_ROUGHNESS || BINDLESS
+    # if BINDLESS
+    const vec3 textureValue = sampleTexture(SLOT_METALLIC_ROUGHNESS, vec4(1.0)).rgb;
+    # else
     const vec3 textureValue = texture(textureMetallicRoughness, TEXTURE_METALLIC_ROUGHNESS_UV).rgb;
+    # endif
 
     const float metallic = material.metallic * textureValue.b;
     const float roughness = max(material.roughness * textureValue.g, 0.05);
@@ -176,29 +301,10 @@ void main() {
     //////////////////////////////////////////////////////////////////////
 
     #if TEXTURE_NORMAL
-    // Get the normal from the texture in tangent space and scale it
-    vec3 normalTangentSpace = 2.0 * texture(textureNormal, TEXTURE_NORMAL_UV).rgb - 1.0;
-    normalTangentSpace = normalize(normalTangentSpace * vec3(material.normalTextureScale, material.normalTextureScale, 1.0));
-
-    // Compute the matrix to transform the normal from tangent space to world space
-    # if IN_TANGENT
-    const vec3 tangent = normalize(inTangent.xyz);
-    const vec3 bitangent = normalize(cross(inNormalWorldSpace, tangent) * inTangent.w);
-    # else
-    const vec3 deltaPosX = dFdx(inPositionWorldSpace);
-    const vec3 deltaPosY = dFdy(inPositionWorldSpace);
-    const vec2 deltaUvX = dFdx(TEXTURE_NORMAL_UV);
-    const vec2 deltaUvY = dFdy(TEXTURE_NORMAL_UV);
-
-    vec3 tangent = (deltaUvY.t * deltaPosX - deltaUvX.t * deltaPosY) / (deltaUvX.s * deltaUvY.t - deltaUvY.s * deltaUvX.t);
-    tangent = normalize(tangent - inNormalWorldSpace * dot(inNormalWorldSpace, tangent));
-    const vec3 bitangent = normalize(cross(inNormalWorldSpace, tangent));
-    # endif
-
-    const mat3 tbn = mat3(tangent, bitangent, inNormalWorldSpace);
-
-    // Transform the normal from tangent space to world space
-    const vec3 normalWorldSpace = normalize(tbn * normalTangentSpace);
+    const vec3 normalWorldSpace = applyNormalTexture(texture(textureNormal, TEXTURE_NORMAL_UV).rgb, TEXTURE_NORMAL_UV);
+    #elif BINDLESS
+    // The condition is the same for the whole draw, the derivatives stay defined
+    const vec3 normalWorldSpace = materialTextures[SLOT_NORMAL] != NO_TEXTURE ? applyNormalTexture(sampleTexture(SLOT_NORMAL, vec4(0.0)).rgb, getTextureUV(SLOT_NORMAL)) : inNormalWorldSpace;
     #else
     const vec3 normalWorldSpace = inNormalWorldSpace;
     #endif
@@ -209,6 +315,8 @@ void main() {
 
     #if TEXTURE_OCCLUSION
     const float occlusion = texture(textureOcclusion, TEXTURE_OCCLUSION_UV).r;
+    #elif BINDLESS
+    const float occlusion = sampleTexture(SLOT_OCCLUSION, vec4(1.0)).r;
     #else
     const float occlusion = 1.0;
     #endif
@@ -218,7 +326,9 @@ void main() {
     //////////////////////////////////////////////////////////////////////
 
     #if TEXTURE_EMISSIVE
-    const vec3 emissive = material.emissive * pow(texture(textureEmissive, TEXTURE_EMISSIVE_UV).rgb, vec3(2.2));
+    const vec3 emissive = material.emissive * texture(textureEmissive, TEXTURE_EMISSIVE_UV).rgb;
+    #elif BINDLESS
+    const vec3 emissive = material.emissive * sampleTexture(SLOT_EMISSIVE, vec4(1.0)).rgb;
     #else
     const vec3 emissive = material.emissive;
     #endif
@@ -296,6 +406,25 @@ void main() {
         }
     }
 
+    #if ENVIRONMENT
+    {
+        const float NdotV = clamp(dot(normalWorldSpace, viewDirection), 0.0, 1.0);
+
+        const vec3 F = fresnelSchlickRoughness(NdotV, F0, roughness);
+        const vec3 kD = (vec3(1.0) - F) * (1.0 - metallic);
+
+        // The irradiance map is already divided by PI
+        const vec3 diffuse = kD * texture(irradianceMap, normalWorldSpace).rgb * albedo.xyz;
+
+        // The levels of the specular map go from a roughness of 0 to 1, the BRDF gives the scale and bias of F0
+        const float lod = roughness * float(textureQueryLevels(specularMap) - 1);
+        const vec3 prefiltered = textureLod(specularMap, reflect(-viewDirection, normalWorldSpace), lod).rgb;
+        const vec2 brdf = texture(brdfLut, vec2(NdotV, roughness)).rg;
+
+        ambient += diffuse + prefiltered * (F0 * brdf.x + brdf.y);
+    }
+    #endif
+
     vec3 color = mix(ambient, ambient * occlusion, material.occlusionTextureStrength) + Lo;
 
     // Tone mapping
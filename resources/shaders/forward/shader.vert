@@ -14,7 +14,11 @@ layout(std140, set = 0, binding = 0) uniform cameraBlock {
 } camera;
 
 layout (location = 0) in vec3 inPosition;
+#if IN_NORMAL_OCTAHEDRAL
+layout (location = 1) in vec2 inNormalOctahedral;
+#else
 layout (location = 1) in vec3 inNormal;
+#endif
 
 //////////////////////////////////////////////////////////////////////////////
 // BLOCK OF DYNAMIC INPUTS
@@ -44,6 +48,16 @@ layout (location = IN_COLOR_1_LOCATION) in vec4 inColor1;
 layout (location = IN_COLOR_2_LOCATION) in vec4 inColor2;
 #endif
 
+#if IN_SKIN
+layout (location = IN_JOINTS_LOCATION) in uvec4 inJoints;
+layout (location = IN_WEIGHTS_LOCATION) in vec4 inWeights;
+
+// Joints matrices times their inverse bind matrices, see Animation::Animator::getPalette
+layout(std430, set = 0, binding = 1) readonly buffer jointsBlock {
+    mat4 joints[];
+} palette;
+#endif
+
 //////////////////////////////////////////////////////////////////////////////
 // BLOCK OF STATIC OUTPUTS
 //////////////////////////////////////////////////////////////////////////////
@@ -85,12 +99,42 @@ layout (location = IN_FREE_LOCATION) out vec3 outCameraPositionWorldSpace;
 // MAIN BLOCK
 //////////////////////////////////////////////////////////////////////////////
 
+#if IN_NORMAL_OCTAHEDRAL
+// See Math::Packing::decodeOctahedral
+vec3 decodeOctahedral(vec2 value) {
+    vec3 normal = vec3(value, 1.0 - abs(value.x) - abs(value.y));
+
+    const float t = max(-normal.z, 0.0);
+    normal.xy += mix(vec2(t), vec2(-t), greaterThanEqual(normal.xy, vec2(0.0)));
+
+    return normalize(normal);
+}
+#endif
+
 void main() {
+    //////////////////////////////////////////////////////////////////////
+    // SKINNING
+    //////////////////////////////////////////////////////////////////////
+
+    #if IN_SKIN
+    const mat4 skin =
+        inWeights.x * palette.joints[inJoints.x] +
+        inWeights.y * palette.joints[inJoints.y] +
+        inWeights.z * palette.joints[inJoints.z] +
+        inWeights.w * palette.joints[inJoints.w];
+    #else
+    const mat4 skin = mat4(1.0);
+    #endif
+
+    const mat4 transform = model.transform * skin;
+
     //////////////////////////////////////////////////////////////////////
     // TRANSFER DYNAMIC OUTPUT
     //////////////////////////////////////////////////////////////////////
 
-    #if IN_TANGENT
+    #if IN_TANGENT && IN_SKIN
+    outTangent = vec4(mat3(skin) * inTangent.xyz, inTangent.w);
+    #elif IN_TANGENT
     outTangent = inTangent;
     #endif
 
@@ -120,13 +164,17 @@ void main() {
     // TRANSFER STATIC OUTPUT
     //////////////////////////////////////////////////////////////////////
 
-    outPositionWorldSpace = vec3(model.transform * vec4(inPosition, 1.0));
-    outNormalWorldSpace = normalize(mat3(transpose(inverse(model.transform))) * inNormal);
+    outPositionWorldSpace = vec3(transform * vec4(inPosition, 1.0));
+    #if IN_NORMAL_OCTAHEDRAL
+    const vec3 inNormal = decodeOctahedral(inNormalOctahedral);
+    #endif
+
+    outNormalWorldSpace = normalize(mat3(transpose(inverse(transform))) * inNormal);
 
     //////////////////////////////////////////////////////////////////////
     // OUTPUT gl_Position
     //////////////////////////////////////////////////////////////////////
 
-    gl_Position = camera.proj * camera.view * model.transform * vec4(inPosition, 1.0);
+    gl_Position = camera.proj * camera.view * transform * vec4(inPosition, 1.0);
     gl_Position.y = -gl_Position.y;
 }
@@ -0,0 +1,137 @@
+#include <lug/Config.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#if defined(LUG_SYSTEM_WINDOWS)
+    #pragma warning(push)
+    #pragma warning(disable : 4244)
+    #pragma warning(disable : 4456)
+#endif
+// The implementation of the library is not exported
+#define STB_IMAGE_STATIC
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+#if defined(LUG_SYSTEM_WINDOWS)
+    #pragma warning(pop)
+#endif
+
+#include <lug/Graphics/Render/BlockCompression.hpp>
+#include <lug/Graphics/Render/Ktx2.hpp>
+#include <lug/Graphics/Render/Mipmap.hpp>
+#include <lug/System/Logger/Logger.hpp>
+#include <lug/System/Logger/OstreamHandler.hpp>
+
+namespace BlockCompression = lug::Graphics::Render::BlockCompression;
+namespace Ktx2 = lug::Graphics::Render::Ktx2;
+namespace Mipmap = lug::Graphics::Render::Mipmap;
+
+static bool parseFormat(const char* name, Ktx2::Format& format) {
+    if (!std::strcmp(name, "bc1")) {
+        format = Ktx2::Format::BC1RgbaUnorm;
+    } else if (!std::strcmp(name, "bc3")) {
+        format = Ktx2::Format::BC3Unorm;
+    } else if (!std::strcmp(name, "bc4")) {
+        format = Ktx2::Format::BC4Unorm;
+    } else if (!std::strcmp(name, "bc5")) {
+        format = Ktx2::Format::BC5Unorm;
+    } else if (!std::strcmp(name, "rgba8")) {
+        format = Ktx2::Format::R8G8B8A8Unorm;
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+int main(int argc, const char* argv[]) {
+    auto logger = lug::System::Logger::makeLogger("ktx2_encoder");
+    logger->addHandler(lug::System::Logger::makeHandler<lug::System::Logger::StdoutHandler>("Stdout"));
+
+    Ktx2::Format format = Ktx2::Format::Undefined;
+    bool mipmaps = true;
+    std::vector<const char*> filenames;
+
+    for (int i = 1; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "--format") && i + 1 < argc) {
+            if (!parseFormat(argv[++i], format)) {
+                logger->error("Unknown format \"{}\"", argv[i]);
+                return 1;
+            }
+        } else if (!std::strcmp(argv[i], "--no-mipmaps")) {
+            mipmaps = false;
+        } else {
+            filenames.push_back(argv[i]);
+        }
+    }
+
+    if (filenames.size() != 2) {
+        logger->info("Usage: {} [--format bc1|bc3|bc4|bc5|rgba8] [--no-mipmaps] input output.ktx2", argv[0]);
+        return 1;
+    }
+
+    int width{0};
+    int height{0};
+    int channels{0};
+
+    stbi_uc* pixels = stbi_load(filenames[0], &width, &height, &channels, STBI_rgb_alpha);
+    if (!pixels) {
+        logger->error("Can't load the image \"{}\": {}", filenames[0], stbi_failure_reason());
+        return 1;
+    }
+
+    const std::vector<Mipmap::Level> levels = Mipmap::getLevels(static_cast<uint32_t>(width), static_cast<uint32_t>(height), mipmaps ? 0 : 1);
+
+    std::vector<uint8_t> chain(levels.back().offset + levels.back().size);
+    std::memcpy(chain.data(), pixels, levels[0].size);
+    stbi_image_free(pixels);
+
+    // The images with transparent pixels need the interpolated alpha of BC3
+    if (format == Ktx2::Format::Undefined) {
+        format = Ktx2::Format::BC1RgbaUnorm;
+
+        for (size_t i = 3; i < levels[0].size; i += 4) {
+            if (chain[i] != 255) {
+                format = Ktx2::Format::BC3Unorm;
+                break;
+            }
+        }
+    }
+
+    Mipmap::generate(chain.data(), levels, Mipmap::Filter::Kaiser);
+
+    BlockCompression::Format blockFormat;
+    Ktx2::Format decodedFormat;
+    const bool compressed = Ktx2::getDecodedFormat(format, blockFormat, decodedFormat);
+
+    std::vector<std::vector<uint8_t>> ktx2Levels(levels.size());
+    for (size_t i = 0; i < levels.size(); ++i) {
+        const uint8_t* level = chain.data() + levels[i].offset;
+
+        if (!compressed) {
+            ktx2Levels[i].assign(level, level + levels[i].size);
+            continue;
+        }
+
+        ktx2Levels[i].resize(BlockCompression::getCompressedSize(blockFormat, levels[i].width, levels[i].height));
+        BlockCompression::encode(blockFormat, level, levels[i].width, levels[i].height, ktx2Levels[i].data());
+    }
+
+    std::vector<uint8_t> file;
+    if (!Ktx2::write(format, static_cast<uint32_t>(width), static_cast<uint32_t>(height), ktx2Levels, file)) {
+        logger->error("Can't encode the image \"{}\"", filenames[0]);
+        return 1;
+    }
+
+    std::ofstream output(filenames[1], std::ios::binary);
+    if (!output.good() || !output.write(reinterpret_cast<const char*>(file.data()), file.size())) {
+        logger->error("Can't write the file \"{}\"", filenames[1]);
+        return 1;
+    }
+
+    logger->info("{}: {}x{}, {} levels, {} bytes", filenames[1], width, height, levels.size(), file.size());
+
+    return 0;
+}
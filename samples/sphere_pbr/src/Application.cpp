@@ -1,10 +1,13 @@
 #include "Application.hpp"
 
+#include <cstring>
+
 #include <lug/Graphics/Builder/Camera.hpp>
 #include <lug/Graphics/Builder/Light.hpp>
 #include <lug/Graphics/Builder/Material.hpp>
 #include <lug/Graphics/Builder/Mesh.hpp>
 #include <lug/Graphics/Builder/Scene.hpp>
+#include <lug/Graphics/Builder/SkyBox.hpp>
 #include <lug/Graphics/Builder/Texture.hpp>
 #include <lug/Graphics/Renderer.hpp>
 #include <lug/Graphics/Vulkan/Renderer.hpp>
@@ -15,6 +18,13 @@ Application::Application() : lug::Core::Application::Application{{"sphere_pbr",
 }
 
 bool Application::init(int argc, char* argv[]) {
+    // The bindless mode is off by default, see README.md
+    for (int i = 1; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "--bindless")) {
+            getGraphicsInfo().rendererInitInfo.bindless = true;
+        }
+    }
+
     if (!lug::Core::Application::init(argc, argv)) {
         return false;
     }
@@ -44,6 +54,7 @@ bool Application::init(int argc, char* argv[]) {
         lug::Graphics::Builder::Texture textureBuilder(*renderer);
 
         textureBuilder.addLayer("textures/rustediron2_basecolor.jpg");
+        textureBuilder.setColorSpace(lug::Graphics::Render::Texture::ColorSpace::sRGB);
 
         baseColorTexture = textureBuilder.build();
         if (!baseColorTexture) {
@@ -163,6 +174,27 @@ bool Application::init(int argc, char* argv[]) {
         node->attachLight(light);
     }
 
+    // Attach the skyBox, which also lights the sphere
+    {
+        lug::Graphics::Builder::SkyBox skyBoxBuilder(*renderer);
+
+        skyBoxBuilder.setFaceFilename(lug::Graphics::Builder::SkyBox::Face::PositiveX, "textures/skybox/right.jpg");
+        skyBoxBuilder.setFaceFilename(lug::Graphics::Builder::SkyBox::Face::NegativeX, "textures/skybox/left.jpg");
+        skyBoxBuilder.setFaceFilename(lug::Graphics::Builder::SkyBox::Face::PositiveY, "textures/skybox/top.jpg");
+        skyBoxBuilder.setFaceFilename(lug::Graphics::Builder::SkyBox::Face::NegativeY, "textures/skybox/bottom.jpg");
+        skyBoxBuilder.setFaceFilename(lug::Graphics::Builder::SkyBox::Face::PositiveZ, "textures/skybox/back.jpg");
+        skyBoxBuilder.setFaceFilename(lug::Graphics::Builder::SkyBox::Face::NegativeZ, "textures/skybox/front.jpg");
+        skyBoxBuilder.setEnvironmentCache("textures/skybox/environment");
+
+        lug::Graphics::Resource::SharedPtr<lug::Graphics::Render::SkyBox> skyBox = skyBoxBuilder.build();
+        if (!skyBox) {
+            LUG_LOG.error("Application: Can't create the skyBox");
+            return false;
+        }
+
+        _scene->setSkyBox(skyBox);
+    }
+
     return true;
 }
 
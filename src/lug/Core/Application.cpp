@@ -2,6 +2,7 @@
 #include <lug/Core/Application.hpp>
 #include <lug/System/Clock.hpp>
 #include <lug/System/Logger/Logger.hpp>
+#include <lug/System/Memory/Tracking.hpp>
 
 namespace lug {
 namespace Core {
@@ -40,6 +41,7 @@ bool Application::finishInit() {
 
 bool Application::run() {
     float elapsed = 0;
+    float memoryDumpElapsed = 0;
     uint32_t frames = 0;
 
     System::Clock clock;
@@ -76,6 +78,15 @@ bool Application::run() {
             frames = 0;
             elapsed = 0;
         }
+
+        if (_memoryDumpPeriod > 0.0f) {
+            memoryDumpElapsed += elapsedTime.getSeconds<float>();
+
+            if (memoryDumpElapsed >= _memoryDumpPeriod) {
+                System::Memory::Tracking::dump();
+                memoryDumpElapsed = 0;
+            }
+        }
     }
 
     return true;
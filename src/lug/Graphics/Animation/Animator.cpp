@@ -0,0 +1,249 @@
+#include <lug/Graphics/Animation/Animator.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace lug {
+namespace Graphics {
+namespace Animation {
+
+Animator::Animator(Resource::SharedPtr<Skeleton> skeleton) : _skeleton(skeleton) {
+    const size_t count = _skeleton->getJointsCount();
+
+    _jointsMatrices.resize(count);
+    _palette.resize(count);
+
+    // The palette of the rest pose
+    evaluate();
+}
+
+uint32_t Animator::addLayer(Resource::SharedPtr<Clip> clip, float weight, bool loop) {
+    Layer layer;
+    layer.clip = clip;
+    layer.weight = weight;
+    layer.loop = loop;
+
+    _layers.push_back(std::move(layer));
+    _cursors.push_back(Cursor{});
+
+    return static_cast<uint32_t>(_layers.size() - 1);
+}
+
+void Animator::update(const System::Time& elapsedTime) {
+    const float seconds = elapsedTime.getSeconds<float>();
+
+    for (Layer& layer : _layers) {
+        if (!layer.clip) {
+            continue;
+        }
+
+        const float duration = layer.clip->getDuration();
+        layer.time += seconds * layer.speed;
+
+        if (layer.loop && duration > 0.0f) {
+            layer.time = std::fmod(layer.time, duration);
+
+            if (layer.time < 0.0f) {
+                layer.time += duration;
+            }
+        } else {
+            layer.time = std::min(std::max(layer.time, 0.0f), duration);
+        }
+    }
+
+    evaluate();
+}
+
+void Animator::evaluate() {
+    const Skeleton& skeleton = *_skeleton;
+    const size_t count = skeleton.getJointsCount();
+
+    // The joints which are not animated stay in the rest pose
+    _pose = skeleton.getRestPose();
+
+    for (size_t i = 0; i < _layers.size(); ++i) {
+        const Layer& layer = _layers[i];
+
+        if (!layer.clip || layer.weight <= 0.0f) {
+            continue;
+        }
+
+        sample(layer, _cursors[i], _pose);
+    }
+
+    Math::Batch::composeTransforms(_pose.translations.getStream(), _pose.rotations.getStream(), _pose.scales.getStream(), _jointsMatrices.data(), count);
+
+    // The parents are evaluated before their children, the matrices can be replaced in place
+    const std::vector<int32_t>& parents = skeleton.getParents();
+    for (uint32_t joint : skeleton.getEvaluationOrder()) {
+        if (parents[joint] != -1) {
+            _jointsMatrices[joint] = _jointsMatrices[parents[joint]] * _jointsMatrices[joint];
+        }
+    }
+
+    Math::Batch::multiply(_jointsMatrices.data(), skeleton.getInverseBindMatrices().data(), _palette.data(), count);
+}
+
+void Animator::sample(const Layer& layer, Cursor& cursor, Pose& pose) {
+    const Clip& clip = *layer.clip;
+
+    // The weight of the layer is applied to the animated joints only, the others are blended with themselves
+    const float weight = std::min(layer.weight, 1.0f);
+
+    sampleVectors(clip.getTracks(Clip::Track::Path::Translation), layer.time, weight, cursor.keys[0], pose.translations);
+    sampleRotations(clip.getTracks(Clip::Track::Path::Rotation), layer.time, weight, cursor.keys[1], pose.rotations);
+    sampleVectors(clip.getTracks(Clip::Track::Path::Scale), layer.time, weight, cursor.keys[2], pose.scales);
+}
+
+void Animator::sampleVectors(const std::vector<Clip::Track>& tracks, float time, float weight, std::vector<uint32_t>& keys, Math::Batch::Vec3Array& values) {
+    const size_t count = tracks.size();
+
+    // The clip of the layer has been replaced
+    if (keys.size() != count) {
+        keys.assign(count, 0);
+    }
+
+    _vectors[0].resize(count);
+    _vectors[1].resize(count);
+    _factors.resize(count);
+
+    // Gather the keys around the time, then interpolate them all at once
+    const Math::Batch::Vec3Stream lhs = _vectors[0].getStream();
+    const Math::Batch::Vec3Stream rhs = _vectors[1].getStream();
+
+    for (size_t i = 0; i < count; ++i) {
+        const Clip::Track& track = tracks[i];
+
+        uint32_t next;
+        _factors[i] = seek(track, time, keys[i], next);
+
+        lhs.x[i] = track.values[0][keys[i]];
+        lhs.y[i] = track.values[1][keys[i]];
+        lhs.z[i] = track.values[2][keys[i]];
+
+        rhs.x[i] = track.values[0][next];
+        rhs.y[i] = track.values[1][next];
+        rhs.z[i] = track.values[2][next];
+    }
+
+    Math::Batch::lerp(lhs, rhs, _factors.data(), lhs, count);
+
+    const Math::Batch::Vec3Stream out = values.getStream();
+
+    // Blend with the current values of the joints
+    if (weight < 1.0f && values.size() > 0) {
+        for (size_t i = 0; i < count; ++i) {
+            const uint32_t joint = std::min(tracks[i].joint, static_cast<uint32_t>(values.size() - 1));
+
+            rhs.x[i] = out.x[joint];
+            rhs.y[i] = out.y[joint];
+            rhs.z[i] = out.z[joint];
+        }
+
+        _factors.assign(count, weight);
+        Math::Batch::lerp(rhs, lhs, _factors.data(), lhs, count);
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        const uint32_t joint = tracks[i].joint;
+
+        if (joint < values.size()) {
+            out.x[joint] = lhs.x[i];
+            out.y[joint] = lhs.y[i];
+            out.z[joint] = lhs.z[i];
+        }
+    }
+}
+
+void Animator::sampleRotations(const std::vector<Clip::Track>& tracks, float time, float weight, std::vector<uint32_t>& keys, Math::Batch::QuatArray& values) {
+    const size_t count = tracks.size();
+
+    if (keys.size() != count) {
+        keys.assign(count, 0);
+    }
+
+    _rotations[0].resize(count);
+    _rotations[1].resize(count);
+    _factors.resize(count);
+
+    const Math::Batch::QuatStream lhs = _rotations[0].getStream();
+    const Math::Batch::QuatStream rhs = _rotations[1].getStream();
+
+    for (size_t i = 0; i < count; ++i) {
+        const Clip::Track& track = tracks[i];
+
+        uint32_t next;
+        _factors[i] = seek(track, time, keys[i], next);
+
+        lhs.w[i] = track.values[0][keys[i]];
+        lhs.x[i] = track.values[1][keys[i]];
+        lhs.y[i] = track.values[2][keys[i]];
+        lhs.z[i] = track.values[3][keys[i]];
+
+        rhs.w[i] = track.values[0][next];
+        rhs.x[i] = track.values[1][next];
+        rhs.y[i] = track.values[2][next];
+        rhs.z[i] = track.values[3][next];
+    }
+
+    if (_slerpEnabled) {
+        Math::Batch::slerp(lhs, rhs, _factors.data(), lhs, count);
+    } else {
+        Math::Batch::nlerp(lhs, rhs, _factors.data(), lhs, count);
+    }
+
+    const Math::Batch::QuatStream out = values.getStream();
+
+    if (weight < 1.0f && values.size() > 0) {
+        for (size_t i = 0; i < count; ++i) {
+            const uint32_t joint = std::min(tracks[i].joint, static_cast<uint32_t>(values.size() - 1));
+
+            rhs.w[i] = out.w[joint];
+            rhs.x[i] = out.x[joint];
+            rhs.y[i] = out.y[joint];
+            rhs.z[i] = out.z[joint];
+        }
+
+        _factors.assign(count, weight);
+        Math::Batch::nlerp(rhs, lhs, _factors.data(), lhs, count);
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        const uint32_t joint = tracks[i].joint;
+
+        if (joint < values.size()) {
+            out.w[joint] = lhs.w[i];
+            out.x[joint] = lhs.x[i];
+            out.y[joint] = lhs.y[i];
+            out.z[joint] = lhs.z[i];
+        }
+    }
+}
+
+float Animator::seek(const Clip::Track& track, float time, uint32_t& key, uint32_t& next) {
+    const std::vector<float>& times = track.times;
+    const uint32_t last = static_cast<uint32_t>(times.size() - 1);
+
+    // The time went backward, e.g. the clip looped
+    if (key > last || times[key] > time) {
+        key = 0;
+    }
+
+    while (key < last && times[key + 1] <= time) {
+        ++key;
+    }
+
+    next = std::min(key + 1, last);
+
+    // Before the first key, after the last one or between two steps
+    if (next == key || time <= times[key] || track.interpolation == Clip::Track::Interpolation::Step) {
+        return 0.0f;
+    }
+
+    return (time - times[key]) / (times[next] - times[key]);
+}
+
+} // Animation
+} // Graphics
+} // lug
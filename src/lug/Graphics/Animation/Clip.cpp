@@ -0,0 +1,32 @@
+#include <lug/Graphics/Animation/Clip.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace lug {
+namespace Graphics {
+namespace Animation {
+
+Clip::Clip(const std::string& name) : Resource(Resource::Type::Clip, name) {}
+
+bool Clip::addTrack(Track track) {
+    if (track.times.empty() || !std::is_sorted(track.times.begin(), track.times.end())) {
+        return false;
+    }
+
+    const uint8_t componentsCount = track.path == Track::Path::Rotation ? 4 : 3;
+    for (uint8_t component = 0; component < componentsCount; ++component) {
+        if (track.values[component].size() != track.times.size()) {
+            return false;
+        }
+    }
+
+    _duration = std::max(_duration, track.times.back());
+    _tracks[static_cast<uint8_t>(track.path)].push_back(std::move(track));
+
+    return true;
+}
+
+} // Animation
+} // Graphics
+} // lug
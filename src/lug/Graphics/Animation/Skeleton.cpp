@@ -0,0 +1,63 @@
+#include <lug/Graphics/Animation/Skeleton.hpp>
+
+#include <algorithm>
+
+namespace lug {
+namespace Graphics {
+namespace Animation {
+
+Skeleton::Skeleton(const std::string& name) : Resource(Resource::Type::Skeleton, name) {}
+
+bool Skeleton::setJoints(const std::vector<Joint>& joints) {
+    const size_t count = joints.size();
+
+    // The depth of the joints, a parent is always less deep than its children
+    std::vector<uint32_t> depths(count, 0);
+    for (size_t i = 0; i < count; ++i) {
+        int32_t parent = joints[i].parent;
+
+        while (parent != -1) {
+            if (parent < -1 || static_cast<size_t>(parent) >= count || depths[i] >= count) {
+                return false;
+            }
+
+            ++depths[i];
+            parent = joints[parent].parent;
+        }
+    }
+
+    _evaluationOrder.resize(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        _evaluationOrder[i] = i;
+    }
+
+    std::stable_sort(_evaluationOrder.begin(), _evaluationOrder.end(), [&depths](uint32_t lhs, uint32_t rhs) {
+        return depths[lhs] < depths[rhs];
+    });
+
+    _names.resize(count);
+    _parents.resize(count);
+    _inverseBindMatrices.resize(count);
+    _restPose.resize(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        _names[i] = joints[i].name;
+        _parents[i] = joints[i].parent;
+        _inverseBindMatrices[i] = joints[i].inverseBindMatrix;
+
+        _restPose.translations.set(i, joints[i].translation);
+        _restPose.rotations.set(i, joints[i].rotation);
+        _restPose.scales.set(i, joints[i].scale);
+    }
+
+    return true;
+}
+
+int32_t Skeleton::getJointIndex(const std::string& name) const {
+    const auto it = std::find(_names.begin(), _names.end(), name);
+    return it != _names.end() ? static_cast<int32_t>(it - _names.begin()) : -1;
+}
+
+} // Animation
+} // Graphics
+} // lug
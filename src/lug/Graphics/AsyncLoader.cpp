@@ -0,0 +1,189 @@
+#include <lug/Graphics/AsyncLoader.hpp>
+
+#include <algorithm>
+
+namespace lug {
+namespace Graphics {
+
+AsyncLoader::Ticket::Ticket(const std::string& name, int32_t priority) : _name(name), _priority(priority) {}
+
+void AsyncLoader::Ticket::setReadProgress(float progress) {
+    // The read stage is the first half of the load
+    _progress = std::min(std::max(progress, 0.0f), 1.0f) * 0.5f;
+}
+
+AsyncLoader::AsyncLoader(uint32_t threadsCount) {
+    for (uint32_t i = 0; i < threadsCount; ++i) {
+        _threads.emplace_back(&AsyncLoader::run, this);
+    }
+}
+
+AsyncLoader::~AsyncLoader() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        _stop = true;
+
+        for (auto& job : _queued) {
+            job.ticket->_status = Ticket::Status::Cancelled;
+        }
+
+        _queued.clear();
+    }
+
+    _queuedCondition.notify_all();
+
+    for (auto& thread : _threads) {
+        thread.join();
+    }
+
+    // The loads read but not integrated will never be
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        for (auto& job : _read) {
+            job.ticket->_status = Ticket::Status::Cancelled;
+        }
+
+        _read.clear();
+    }
+
+    _readCondition.notify_all();
+}
+
+std::shared_ptr<AsyncLoader::Ticket> AsyncLoader::enqueue(const std::string& name, int32_t priority, Task task) {
+    std::shared_ptr<Ticket> ticket = std::make_shared<Ticket>(name, priority);
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        ticket->_sequence = _sequence++;
+
+        _queued.push_back(Job{ticket, std::move(task)});
+        std::push_heap(_queued.begin(), _queued.end(), &AsyncLoader::compareJobs);
+    }
+
+    _queuedCondition.notify_one();
+
+    return ticket;
+}
+
+uint32_t AsyncLoader::integrate(uint32_t maxLoads) {
+    uint32_t integratedCount = 0;
+
+    while (!maxLoads || integratedCount < maxLoads) {
+        Job job;
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            if (_read.empty()) {
+                break;
+            }
+
+            std::pop_heap(_read.begin(), _read.end(), &AsyncLoader::compareJobs);
+            job = std::move(_read.back());
+            _read.pop_back();
+        }
+
+        Ticket& ticket = *job.ticket;
+
+        if (ticket.isCancelRequested()) {
+            ticket._status = Ticket::Status::Cancelled;
+            continue;
+        }
+
+        Resource::SharedPtr<Resource> resource = job.task.build ? job.task.build(ticket) : nullptr;
+
+        if (resource) {
+            ticket._resource = resource;
+            ticket._progress = 1.0f;
+            ticket._status = Ticket::Status::Completed;
+        } else {
+            ticket._status = Ticket::Status::Failed;
+        }
+
+        ++integratedCount;
+    }
+
+    return integratedCount;
+}
+
+void AsyncLoader::wait(const Ticket& ticket) {
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    _readCondition.wait(lock, [&ticket]() {
+        const Ticket::Status status = ticket.getStatus();
+        return status != Ticket::Status::Queued && status != Ticket::Status::Reading;
+    });
+}
+
+uint32_t AsyncLoader::getPendingCount() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    return static_cast<uint32_t>(_queued.size() + _read.size()) + _readingCount;
+}
+
+void AsyncLoader::run() {
+    for (;;) {
+        Job job;
+
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+
+            _queuedCondition.wait(lock, [this]() {
+                return _stop || !_queued.empty();
+            });
+
+            if (_stop) {
+                return;
+            }
+
+            std::pop_heap(_queued.begin(), _queued.end(), &AsyncLoader::compareJobs);
+            job = std::move(_queued.back());
+            _queued.pop_back();
+
+            ++_readingCount;
+        }
+
+        Ticket& ticket = *job.ticket;
+        bool success = false;
+
+        if (!ticket.isCancelRequested()) {
+            ticket._status = Ticket::Status::Reading;
+            success = !job.task.read || job.task.read(ticket);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            --_readingCount;
+
+            if (ticket.isCancelRequested()) {
+                ticket._status = Ticket::Status::Cancelled;
+            } else if (!success) {
+                ticket._status = Ticket::Status::Failed;
+            } else {
+                ticket._progress = 0.5f;
+                ticket._status = Ticket::Status::Read;
+
+                _read.push_back(std::move(job));
+                std::push_heap(_read.begin(), _read.end(), &AsyncLoader::compareJobs);
+            }
+        }
+
+        _readCondition.notify_all();
+    }
+}
+
+bool AsyncLoader::compareJobs(const Job& lhs, const Job& rhs) {
+    // The heaps are max-heaps: the job with the highest priority, then the lowest sequence, is on top
+    if (lhs.ticket->_priority != rhs.ticket->_priority) {
+        return lhs.ticket->_priority < rhs.ticket->_priority;
+    }
+
+    return lhs.ticket->_sequence > rhs.ticket->_sequence;
+}
+
+} // Graphics
+} // lug
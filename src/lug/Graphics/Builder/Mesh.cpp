@@ -1,6 +1,7 @@
 #include <lug/Graphics/Builder/Mesh.hpp>
 
 #include <lug/Graphics/Renderer.hpp>
+#include <lug/Math/Batch.hpp>
 
 namespace lug {
 namespace Graphics {
@@ -21,7 +22,60 @@ void Mesh::PrimitiveSet::addAttributeBuffer(const void* data, uint32_t elementSi
     _attributes.push_back(std::move(attribute));
 }
 
+void Mesh::PrimitiveSet::compressAttributes() {
+    for (auto& attribute : _attributes) {
+        const uint32_t count = attribute.buffer.elementsCount;
+
+        // Only the VEC3<FLOAT> are compressed
+        if (attribute.format != Render::Mesh::PrimitiveSet::Attribute::Format::Float || attribute.buffer.size != count * sizeof(Math::Vec3f)) {
+            continue;
+        }
+
+        const float* values = reinterpret_cast<const float*>(attribute.buffer.data);
+
+        char* data = nullptr;
+        uint32_t size = 0;
+
+        if (attribute.type == Render::Mesh::PrimitiveSet::Attribute::Type::Position) {
+            // VK_FORMAT_R16G16B16_SFLOAT is rarely supported for the vertex buffers, w is padding
+            std::vector<float> positions(count * 4, 1.0f);
+            for (uint32_t i = 0; i < count; ++i) {
+                std::memcpy(positions.data() + i * 4, values + i * 3, sizeof(Math::Vec3f));
+            }
+
+            size = count * 4 * sizeof(uint16_t);
+            data = new char[size];
+
+            Math::Batch::packHalf(positions.data(), reinterpret_cast<uint16_t*>(data), count * 4);
+            attribute.format = Render::Mesh::PrimitiveSet::Attribute::Format::Half;
+        } else if (attribute.type == Render::Mesh::PrimitiveSet::Attribute::Type::Normal) {
+            Math::Batch::Vec3Array normals(count);
+            for (uint32_t i = 0; i < count; ++i) {
+                normals.set(i, {values[i * 3], values[i * 3 + 1], values[i * 3 + 2]});
+            }
+
+            size = count * 2 * sizeof(int16_t);
+            data = new char[size];
+
+            Math::Batch::encodeOctahedral(normals.getStream(), reinterpret_cast<int16_t*>(data), count);
+            attribute.format = Render::Mesh::PrimitiveSet::Attribute::Format::Oct16;
+        } else {
+            continue;
+        }
+
+        delete[] attribute.buffer.data;
+        attribute.buffer.data = data;
+        attribute.buffer.size = size;
+    }
+}
+
 Resource::SharedPtr<Render::Mesh> Mesh::build() {
+    if (_compressVertices) {
+        for (auto& primitiveSet : _primitiveSets) {
+            primitiveSet.compressAttributes();
+        }
+    }
+
     switch (_renderer.getType()) {
         case Renderer::Type::Vulkan:
             return lug::Graphics::Vulkan::Builder::Mesh::build(*this);
@@ -7,15 +7,23 @@
     #include <lug/Window/Window.hpp>
 #endif
 
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <utility>
+
 #include <gltf2/glTF2.hpp>
 #include <gltf2/Exceptions.hpp>
 
 #include <lug/System/Logger/Logger.hpp>
+#include <lug/Graphics/Animation/Animator.hpp>
 #include <lug/Graphics/Builder/Scene.hpp>
 #include <lug/Graphics/Builder/Material.hpp>
 #include <lug/Graphics/Builder/Mesh.hpp>
 #include <lug/Graphics/Builder/Texture.hpp>
 #include <lug/Graphics/Scene/Scene.hpp>
+#include <lug/Graphics/Vulkan/Renderer.hpp>
+#include <lug/Math/Packing.hpp>
 
 namespace lug {
 namespace Graphics {
@@ -79,13 +87,115 @@ static uint32_t getAttributeSize(const gltf2::Accessor& accessor) {
     return componentSize;
 }
 
-static Resource::SharedPtr<Render::Texture> createTexture(Renderer& renderer, const gltf2::Asset& asset, const gltf2::Texture& gltfTexture) {
-    // TODO: Check if the texture is already created
+// Reads the components of an accessor as floats, the integers are normalized (weights and keyframes)
+static bool readFloats(const gltf2::Asset& asset, const gltf2::Accessor& accessor, std::vector<float>& values) {
+    const void* data = getBufferViewData(asset, accessor);
+    if (!data) {
+        return false;
+    }
+
+    const uint32_t size = getAttributeSize(accessor) * accessor.count;
+
+    switch (accessor.componentType) {
+        case gltf2::Accessor::ComponentType::Float:
+            values.assign(static_cast<const float*>(data), static_cast<const float*>(data) + size / sizeof(float));
+            return true;
+        case gltf2::Accessor::ComponentType::Byte:
+            values.resize(size);
+            for (uint32_t i = 0; i < size; ++i) {
+                values[i] = Math::Packing::unpackSnorm8(static_cast<const int8_t*>(data)[i]);
+            }
+            return true;
+        case gltf2::Accessor::ComponentType::UnsignedByte:
+            values.resize(size);
+            for (uint32_t i = 0; i < size; ++i) {
+                values[i] = Math::Packing::unpackUnorm8(static_cast<const uint8_t*>(data)[i]);
+            }
+            return true;
+        case gltf2::Accessor::ComponentType::Short:
+            values.resize(size / sizeof(int16_t));
+            for (uint32_t i = 0; i < values.size(); ++i) {
+                values[i] = Math::Packing::unpackSnorm16(static_cast<const int16_t*>(data)[i]);
+            }
+            return true;
+        case gltf2::Accessor::ComponentType::UnsignedShort:
+            values.resize(size / sizeof(uint16_t));
+            for (uint32_t i = 0; i < values.size(); ++i) {
+                values[i] = Math::Packing::unpackUnorm16(static_cast<const uint16_t*>(data)[i]);
+            }
+            return true;
+        case gltf2::Accessor::ComponentType::UnsignedInt:
+            break;
+    }
+
+    LUG_LOG.error("GltfLoader::readFloats Unsupported component type");
+    return false;
+}
+
+// Reads the indices of the joints as VEC4<UNSIGNED_SHORT>, they can be unsigned bytes
+static bool readJoints(const gltf2::Asset& asset, const gltf2::Accessor& accessor, std::vector<uint16_t>& joints) {
+    const void* data = getBufferViewData(asset, accessor);
+    if (!data) {
+        return false;
+    }
+
+    const uint32_t count = accessor.count * 4;
+
+    if (accessor.componentType == gltf2::Accessor::ComponentType::UnsignedShort) {
+        joints.assign(static_cast<const uint16_t*>(data), static_cast<const uint16_t*>(data) + count);
+    } else if (accessor.componentType == gltf2::Accessor::ComponentType::UnsignedByte) {
+        joints.assign(static_cast<const uint8_t*>(data), static_cast<const uint8_t*>(data) + count);
+    } else {
+        LUG_LOG.error("GltfLoader::readJoints Unsupported component type");
+        return false;
+    }
+
+    return true;
+}
+
+namespace {
+
+// Key of the textures of the asset, by glTF texture and color space.
+// An image used both as a color and as data is loaded once in each color space.
+using TextureKey = std::pair<int32_t, Render::Texture::ColorSpace>;
+
+// Images decoded by GltfLoader::read on the loader thread, and textures already created for the asset
+struct LoadedTextures {
+    std::map<TextureKey, std::shared_ptr<Vulkan::Builder::Texture::Image>> images;
+    std::map<TextureKey, Resource::SharedPtr<Render::Texture>> textures;
+};
+
+// Skeletons and clips already created for the asset, by glTF skin.
+// The clip is the first animation of the skin, it is nullptr if the skin isn't animated.
+struct LoadedSkin {
+    Resource::SharedPtr<Animation::Skeleton> skeleton{nullptr};
+    Resource::SharedPtr<Animation::Clip> clip{nullptr};
+};
+
+using LoadedSkins = std::map<int32_t, LoadedSkin>;
+
+} // anonymous
+
+static Resource::SharedPtr<Render::Texture> createTexture(Renderer& renderer, const gltf2::Asset& asset, int32_t textureIndex, Render::Texture::ColorSpace colorSpace, LoadedTextures& loadedTextures) {
+    const auto loadedTexture = loadedTextures.textures.find({textureIndex, colorSpace});
+    if (loadedTexture != loadedTextures.textures.end()) {
+        return loadedTexture->second;
+    }
+
+    const gltf2::Texture& gltfTexture = asset.textures[textureIndex];
+
     Builder::Texture textureBuilder(renderer);
+    textureBuilder.setColorSpace(colorSpace);
+    textureBuilder.setStreaming(renderer.getInfo().textureStreaming);
 
     if (gltfTexture.source != -1) {
         // TODO: Handle correctly the load with bufferView / uri data
         textureBuilder.addLayer(asset.images[gltfTexture.source].uri);
+
+        const auto image = loadedTextures.images.find({textureIndex, colorSpace});
+        if (image != loadedTextures.images.end()) {
+            textureBuilder.setImage(std::move(image->second));
+        }
     }
 
     if (gltfTexture.sampler != -1) {
@@ -154,10 +264,15 @@ static Resource::SharedPtr<Render::Texture> createTexture(Renderer& renderer, co
         }
     }
 
-    return textureBuilder.build();
+    Resource::SharedPtr<Render::Texture> texture = textureBuilder.build();
+    if (texture) {
+        loadedTextures.textures[{textureIndex, colorSpace}] = texture;
+    }
+
+    return texture;
 }
 
-static Resource::SharedPtr<Render::Material> createMaterial(Renderer& renderer, const gltf2::Asset& asset, const gltf2::Material& gltfMaterial) {
+static Resource::SharedPtr<Render::Material> createMaterial(Renderer& renderer, const gltf2::Asset& asset, const gltf2::Material& gltfMaterial, LoadedTextures& loadedTextures) {
     // TODO: Check if the material is already created
     Builder::Material materialBuilder(renderer);
 
@@ -171,7 +286,7 @@ static Resource::SharedPtr<Render::Material> createMaterial(Renderer& renderer,
     });
 
     if (gltfMaterial.pbr.baseColorTexture.index != -1) {
-        Resource::SharedPtr<Render::Texture> texture = createTexture(renderer, asset, asset.textures[gltfMaterial.pbr.baseColorTexture.index]);
+        Resource::SharedPtr<Render::Texture> texture = createTexture(renderer, asset, gltfMaterial.pbr.baseColorTexture.index, Render::Texture::ColorSpace::sRGB, loadedTextures);
         if (!texture) {
             LUG_LOG.error("GltfLoader::createMaterial Can't create the texture resource");
             return nullptr;
@@ -184,7 +299,7 @@ static Resource::SharedPtr<Render::Material> createMaterial(Renderer& renderer,
     materialBuilder.setRoughnessFactor(gltfMaterial.pbr.roughnessFactor);
 
     if (gltfMaterial.pbr.metallicRoughnessTexture.index != -1) {
-        Resource::SharedPtr<Render::Texture> texture = createTexture(renderer, asset, asset.textures[gltfMaterial.pbr.metallicRoughnessTexture.index]);
+        Resource::SharedPtr<Render::Texture> texture = createTexture(renderer, asset, gltfMaterial.pbr.metallicRoughnessTexture.index, Render::Texture::ColorSpace::Linear, loadedTextures);
         if (!texture) {
             LUG_LOG.error("GltfLoader::createMaterial Can't create the texture resource");
             return nullptr;
@@ -194,7 +309,7 @@ static Resource::SharedPtr<Render::Material> createMaterial(Renderer& renderer,
     }
 
     if (gltfMaterial.normalTexture.index != -1) {
-        Resource::SharedPtr<Render::Texture> texture = createTexture(renderer, asset, asset.textures[gltfMaterial.normalTexture.index]);
+        Resource::SharedPtr<Render::Texture> texture = createTexture(renderer, asset, gltfMaterial.normalTexture.index, Render::Texture::ColorSpace::Linear, loadedTextures);
         if (!texture) {
             LUG_LOG.error("GltfLoader::createMaterial Can't create the texture resource");
             return nullptr;
@@ -204,7 +319,7 @@ static Resource::SharedPtr<Render::Material> createMaterial(Renderer& renderer,
     }
 
     if (gltfMaterial.occlusionTexture.index != -1) {
-        Resource::SharedPtr<Render::Texture> texture = createTexture(renderer, asset, asset.textures[gltfMaterial.occlusionTexture.index]);
+        Resource::SharedPtr<Render::Texture> texture = createTexture(renderer, asset, gltfMaterial.occlusionTexture.index, Render::Texture::ColorSpace::Linear, loadedTextures);
         if (!texture) {
             LUG_LOG.error("GltfLoader::createMaterial Can't create the texture resource");
             return nullptr;
@@ -214,7 +329,7 @@ static Resource::SharedPtr<Render::Material> createMaterial(Renderer& renderer,
     }
 
     if (gltfMaterial.emissiveTexture.index != -1) {
-        Resource::SharedPtr<Render::Texture> texture = createTexture(renderer, asset, asset.textures[gltfMaterial.emissiveTexture.index]);
+        Resource::SharedPtr<Render::Texture> texture = createTexture(renderer, asset, gltfMaterial.emissiveTexture.index, Render::Texture::ColorSpace::sRGB, loadedTextures);
         if (!texture) {
             LUG_LOG.error("GltfLoader::createMaterial Can't create the texture resource");
             return nullptr;
@@ -256,7 +371,7 @@ static void* generateNormals(float* positions, uint32_t accessorCount) {
     return data;
 }
 
-static Resource::SharedPtr<Render::Mesh> createMesh(Renderer& renderer, const gltf2::Asset& asset, const gltf2::Mesh& gltfMesh) {
+static Resource::SharedPtr<Render::Mesh> createMesh(Renderer& renderer, const gltf2::Asset& asset, const gltf2::Mesh& gltfMesh, LoadedTextures& loadedTextures) {
     // TODO: Check if the mesh is already created
     Builder::Mesh meshBuilder(renderer);
     meshBuilder.setName(gltfMesh.name);
@@ -326,6 +441,28 @@ static Resource::SharedPtr<Render::Mesh> createMesh(Renderer& renderer, const gl
                 type = Render::Mesh::PrimitiveSet::Attribute::Type::TexCoord;
             } else if (attribute.first.find("COLOR_") != std::string::npos) {
                 type = Render::Mesh::PrimitiveSet::Attribute::Type::Color;
+            } else if (attribute.first == "JOINTS_0") {
+                std::vector<uint16_t> joints;
+                if (!readJoints(asset, asset.accessors[attribute.second], joints)) {
+                    return nullptr;
+                }
+
+                primitiveSet->addAttributeBuffer(
+                    joints.data(), 4 * sizeof(uint16_t), asset.accessors[attribute.second].count,
+                    Render::Mesh::PrimitiveSet::Attribute::Type::Joints
+                );
+                continue;
+            } else if (attribute.first == "WEIGHTS_0") {
+                std::vector<float> weights;
+                if (!readFloats(asset, asset.accessors[attribute.second], weights)) {
+                    return nullptr;
+                }
+
+                primitiveSet->addAttributeBuffer(
+                    weights.data(), sizeof(Math::Vec4f), asset.accessors[attribute.second].count,
+                    Render::Mesh::PrimitiveSet::Attribute::Type::Weights
+                );
+                continue;
             } else {
                 LUG_LOG.warn("GltfLoader::createMesh Unsupported attribute {}", attribute.first);
                 continue;
@@ -359,7 +496,7 @@ static Resource::SharedPtr<Render::Mesh> createMesh(Renderer& renderer, const gl
         }
 
         // Material
-        Resource::SharedPtr<Render::Material> material = gltfPrimitive.material != -1 ? createMaterial(renderer, asset, asset.materials[gltfPrimitive.material]) : createDefaultMaterial(renderer);
+        Resource::SharedPtr<Render::Material> material = gltfPrimitive.material != -1 ? createMaterial(renderer, asset, asset.materials[gltfPrimitive.material], loadedTextures) : createDefaultMaterial(renderer);
         if (!material) {
             LUG_LOG.error("GltfLoader::createMesh Can't create the material resource");
             return nullptr;
@@ -373,17 +510,198 @@ static Resource::SharedPtr<Render::Mesh> createMesh(Renderer& renderer, const gl
     return meshBuilder.build();
 }
 
-static bool createNode(Renderer& renderer, const gltf2::Asset& asset, const gltf2::Node& gltfNode, Scene::Node& parent) {
+static Resource::SharedPtr<Animation::Clip> createClip(Renderer& renderer, const gltf2::Asset& asset, const gltf2::Animation& gltfAnimation, const gltf2::Skin& gltfSkin) {
+    std::unique_ptr<Resource> resource{new Animation::Clip(gltfAnimation.name)};
+    Animation::Clip* clip = static_cast<Animation::Clip*>(resource.get());
+
+    for (const gltf2::Animation::Channel& channel : gltfAnimation.channels) {
+        const auto joint = std::find(gltfSkin.joints.begin(), gltfSkin.joints.end(), static_cast<uint32_t>(channel.target.node));
+
+        // The channel doesn't animate this skin
+        if (joint == gltfSkin.joints.end()) {
+            continue;
+        }
+
+        Animation::Clip::Track track;
+        track.joint = static_cast<uint32_t>(joint - gltfSkin.joints.begin());
+
+        uint32_t componentsCount = 3;
+        switch (channel.target.path) {
+            case gltf2::Animation::Channel::Target::Path::Translation:
+                track.path = Animation::Clip::Track::Path::Translation;
+                break;
+            case gltf2::Animation::Channel::Target::Path::Rotation:
+                track.path = Animation::Clip::Track::Path::Rotation;
+                componentsCount = 4;
+                break;
+            case gltf2::Animation::Channel::Target::Path::Scale:
+                track.path = Animation::Clip::Track::Path::Scale;
+                break;
+            case gltf2::Animation::Channel::Target::Path::Weights:
+                LUG_LOG.warn("GltfLoader::createClip Unsupported morph targets weights");
+                continue;
+        }
+
+        const gltf2::Animation::Sampler& sampler = gltfAnimation.samplers[channel.sampler];
+
+        // The cubic splines are interpolated linearly between their values, without the tangents
+        uint32_t valuesPerKey = 1;
+        switch (sampler.interpolation) {
+            case gltf2::Animation::Sampler::Interpolation::Linear:
+                track.interpolation = Animation::Clip::Track::Interpolation::Linear;
+                break;
+            case gltf2::Animation::Sampler::Interpolation::Step:
+                track.interpolation = Animation::Clip::Track::Interpolation::Step;
+                break;
+            case gltf2::Animation::Sampler::Interpolation::CubicSpline:
+                track.interpolation = Animation::Clip::Track::Interpolation::Linear;
+                valuesPerKey = 3;
+                break;
+        }
+
+        std::vector<float> values;
+        if (!readFloats(asset, asset.accessors[sampler.input], track.times) || !readFloats(asset, asset.accessors[sampler.output], values)) {
+            return nullptr;
+        }
+
+        const size_t keysCount = values.size() / (componentsCount * valuesPerKey);
+        for (uint32_t component = 0; component < componentsCount; ++component) {
+            track.values[component].resize(keysCount);
+        }
+
+        for (size_t key = 0; key < keysCount; ++key) {
+            // The in-tangent is before the value of a cubic spline
+            const float* value = values.data() + (key * valuesPerKey + valuesPerKey / 2) * componentsCount;
+
+            if (track.path == Animation::Clip::Track::Path::Rotation) {
+                // {x, y, z, w} in glTF
+                track.values[0][key] = value[3];
+                track.values[1][key] = value[0];
+                track.values[2][key] = value[1];
+                track.values[3][key] = value[2];
+            } else {
+                for (uint32_t component = 0; component < componentsCount; ++component) {
+                    track.values[component][key] = value[component];
+                }
+            }
+        }
+
+        if (!clip->addTrack(std::move(track))) {
+            LUG_LOG.error("GltfLoader::createClip Invalid sampler {}", channel.sampler);
+            return nullptr;
+        }
+    }
+
+    return renderer.getResourceManager()->add<Animation::Clip>(std::move(resource));
+}
+
+static bool createSkin(Renderer& renderer, const gltf2::Asset& asset, int32_t skinIndex, LoadedSkins& loadedSkins) {
+    if (loadedSkins.find(skinIndex) != loadedSkins.end()) {
+        return true;
+    }
+
+    const gltf2::Skin& gltfSkin = asset.skins[skinIndex];
+
+    // The parents of the nodes, the joints are children of other joints or roots of the skeleton
+    std::vector<int32_t> parents(asset.nodes.size(), -1);
+    for (uint32_t i = 0; i < asset.nodes.size(); ++i) {
+        for (uint32_t child : asset.nodes[i].children) {
+            parents[child] = i;
+        }
+    }
+
+    std::vector<float> inverseBindMatrices;
+    if (gltfSkin.inverseBindMatrices != -1 && !readFloats(asset, asset.accessors[gltfSkin.inverseBindMatrices], inverseBindMatrices)) {
+        return false;
+    }
+
+    std::vector<Animation::Skeleton::Joint> joints(gltfSkin.joints.size());
+    for (uint32_t i = 0; i < joints.size(); ++i) {
+        const gltf2::Node& gltfNode = asset.nodes[gltfSkin.joints[i]];
+        Animation::Skeleton::Joint& joint = joints[i];
+
+        joint.name = gltfNode.name;
+
+        // The nearest ancestor in the skin, the nodes between the joints are ignored
+        for (int32_t node = parents[gltfSkin.joints[i]]; node != -1 && joint.parent == -1; node = parents[node]) {
+            const auto parent = std::find(gltfSkin.joints.begin(), gltfSkin.joints.end(), static_cast<uint32_t>(node));
+
+            if (parent != gltfSkin.joints.end()) {
+                joint.parent = static_cast<int32_t>(parent - gltfSkin.joints.begin());
+            }
+        }
+
+        // Column-major in glTF and in Math::Mat4x4f
+        if ((i + 1) * 16 <= inverseBindMatrices.size()) {
+            for (uint32_t column = 0; column < 4; ++column) {
+                for (uint32_t row = 0; row < 4; ++row) {
+                    joint.inverseBindMatrix(row, column) = inverseBindMatrices[i * 16 + column * 4 + row];
+                }
+            }
+        }
+
+        joint.translation = {gltfNode.translation[0], gltfNode.translation[1], gltfNode.translation[2]};
+        joint.rotation = Math::Quatf{gltfNode.rotation[3], gltfNode.rotation[0], gltfNode.rotation[1], gltfNode.rotation[2]};
+        joint.scale = {gltfNode.scale[0], gltfNode.scale[1], gltfNode.scale[2]};
+    }
+
+    std::unique_ptr<Resource> resource{new Animation::Skeleton(gltfSkin.name)};
+    if (!static_cast<Animation::Skeleton*>(resource.get())->setJoints(joints)) {
+        LUG_LOG.error("GltfLoader::createSkin Invalid joints hierarchy of the skin {}", skinIndex);
+        return false;
+    }
+
+    LoadedSkin& loadedSkin = loadedSkins[skinIndex];
+    loadedSkin.skeleton = renderer.getResourceManager()->add<Animation::Skeleton>(std::move(resource));
+
+    // Play the first animation of the skin
+    for (const gltf2::Animation& gltfAnimation : asset.animations) {
+        const bool animatesSkin = std::any_of(gltfAnimation.channels.begin(), gltfAnimation.channels.end(), [&gltfSkin](const gltf2::Animation::Channel& channel) {
+            return std::find(gltfSkin.joints.begin(), gltfSkin.joints.end(), static_cast<uint32_t>(channel.target.node)) != gltfSkin.joints.end();
+        });
+
+        if (animatesSkin) {
+            loadedSkin.clip = createClip(renderer, asset, gltfAnimation, gltfSkin);
+            if (!loadedSkin.clip) {
+                LUG_LOG.error("GltfLoader::createSkin Can't create the clip resource");
+                return false;
+            }
+
+            break;
+        }
+    }
+
+    return true;
+}
+
+static bool createNode(Renderer& renderer, const gltf2::Asset& asset, const gltf2::Node& gltfNode, Scene::Node& parent, LoadedTextures& loadedTextures, LoadedSkins& loadedSkins) {
     Scene::Node* node = parent.createSceneNode(gltfNode.name);
     parent.attachChild(*node);
 
     if (gltfNode.mesh != -1) {
-        Resource::SharedPtr<Render::Mesh> mesh = createMesh(renderer, asset, asset.meshes[gltfNode.mesh]);
+        Resource::SharedPtr<Render::Mesh> mesh = createMesh(renderer, asset, asset.meshes[gltfNode.mesh], loadedTextures);
         if (!mesh) {
             LUG_LOG.error("GltfLoader::createNode Can't create the mesh resource");
             return false;
         }
         node->attachMeshInstance(mesh);
+
+        // The joints nodes are not moved by the animator, its palette is relative to the parent of the skeleton
+        if (gltfNode.skin != -1) {
+            if (!createSkin(renderer, asset, gltfNode.skin, loadedSkins)) {
+                LUG_LOG.error("GltfLoader::createNode Can't create the skin");
+                return false;
+            }
+
+            const LoadedSkin& loadedSkin = loadedSkins[gltfNode.skin];
+
+            std::unique_ptr<Animation::Animator> animator = std::make_unique<Animation::Animator>(loadedSkin.skeleton);
+            if (loadedSkin.clip) {
+                animator->addLayer(loadedSkin.clip);
+            }
+
+            node->attachAnimator(std::move(animator));
+        }
     }
 
     node->setPosition({
@@ -407,7 +725,7 @@ static bool createNode(Renderer& renderer, const gltf2::Asset& asset, const gltf
 
     for (uint32_t nodeIdx : gltfNode.children) {
         const gltf2::Node& childrenGltfNode = asset.nodes[nodeIdx];
-        if (!createNode(renderer, asset, childrenGltfNode, *node)) {
+        if (!createNode(renderer, asset, childrenGltfNode, *node, loadedTextures, loadedSkins)) {
             return false;
         }
     }
@@ -415,21 +733,82 @@ static bool createNode(Renderer& renderer, const gltf2::Asset& asset, const gltf
     return true;
 }
 
-Resource::SharedPtr<Resource> GltfLoader::loadFile(const std::string& filename) {
+namespace {
+
+struct GltfData : public Loader::Data {
     gltf2::Asset asset;
+    LoadedTextures textures;
+};
+
+} // anonymous
+
+// Decodes the images of the textures used by the materials, so only their upload is left to the main thread
+static void readTextures(const Renderer& renderer, const gltf2::Asset& asset, LoadedTextures& loadedTextures) {
+    if (renderer.getType() != Renderer::Type::Vulkan) {
+        return;
+    }
+
+    const auto& readTexture = [&renderer, &asset, &loadedTextures](int32_t textureIndex, Render::Texture::ColorSpace colorSpace) {
+        if (textureIndex == -1 || asset.textures[textureIndex].source == -1 || loadedTextures.images.count({textureIndex, colorSpace})) {
+            return;
+        }
+
+        const gltf2::Texture& gltfTexture = asset.textures[textureIndex];
+
+        // On failure the image is read again by the build, which logs the error
+        std::shared_ptr<Vulkan::Builder::Texture::Image> image = Vulkan::Builder::Texture::read(
+            static_cast<const Vulkan::Renderer&>(renderer),
+            {asset.images[gltfTexture.source].uri},
+            colorSpace
+        );
+
+        if (image) {
+            loadedTextures.images[{textureIndex, colorSpace}] = std::move(image);
+        }
+    };
+
+    for (const gltf2::Material& gltfMaterial : asset.materials) {
+        readTexture(gltfMaterial.pbr.baseColorTexture.index, Render::Texture::ColorSpace::sRGB);
+        readTexture(gltfMaterial.pbr.metallicRoughnessTexture.index, Render::Texture::ColorSpace::Linear);
+        readTexture(gltfMaterial.normalTexture.index, Render::Texture::ColorSpace::Linear);
+        readTexture(gltfMaterial.occlusionTexture.index, Render::Texture::ColorSpace::Linear);
+        readTexture(gltfMaterial.emissiveTexture.index, Render::Texture::ColorSpace::sRGB);
+    }
+}
+
+Resource::SharedPtr<Resource> GltfLoader::loadFile(const std::string& filename) {
+    std::unique_ptr<Data> data = read(filename);
+    if (!data) {
+        return nullptr;
+    }
+
+    return build(filename, *data);
+}
+
+std::unique_ptr<Loader::Data> GltfLoader::read(const std::string& filename) {
+    std::unique_ptr<GltfData> data = std::make_unique<GltfData>();
     try {
 #if defined(LUG_SYSTEM_ANDROID)
-        asset = gltf2::load(filename, (lug::Window::priv::WindowImpl::activity)->assetManager);
+        data->asset = gltf2::load(filename, (lug::Window::priv::WindowImpl::activity)->assetManager);
 #else
-        asset = gltf2::load(filename);
+        data->asset = gltf2::load(filename);
 #endif
         // TODO(nokitoo): Format the asset if not already done
         // Should we store the version of format in asset.extensions or asset.copyright/asset.version ?
     } catch (gltf2::MisformattedException& e) {
-        LUG_LOG.error("GltfLoader::loadFile Can't load the file \"{}\": {}", filename, e.what());
+        LUG_LOG.error("GltfLoader::read Can't load the file \"{}\": {}", filename, e.what());
         return nullptr;
     }
 
+    readTextures(_renderer, data->asset, data->textures);
+
+    return std::unique_ptr<Data>(std::move(data));
+}
+
+Resource::SharedPtr<Resource> GltfLoader::build(const std::string& /*filename*/, Data& data) {
+    GltfData& gltfData = static_cast<GltfData&>(data);
+    const gltf2::Asset& asset = gltfData.asset;
+
     if (asset.scene == -1) { // No scene to load
         return nullptr;
     }
@@ -440,13 +819,15 @@ Resource::SharedPtr<Resource> GltfLoader::loadFile(const std::string& filename)
 
     Resource::SharedPtr<lug::Graphics::Scene::Scene> scene = sceneBuilder.build();
     if (!scene) {
-        LUG_LOG.error("GltfLoader::loadFile Can't create the scene resource");
+        LUG_LOG.error("GltfLoader::build Can't create the scene resource");
         return nullptr;
     }
 
+    LoadedTextures& loadedTextures = gltfData.textures;
+    LoadedSkins loadedSkins;
     for (uint32_t nodeIdx : gltfScene.nodes) {
         const gltf2::Node& gltfNode = asset.nodes[nodeIdx];
-        if (!createNode(_renderer, asset, gltfNode, scene->getRoot())) {
+        if (!createNode(_renderer, asset, gltfNode, scene->getRoot(), loadedTextures, loadedSkins)) {
             return nullptr;
         }
     }
@@ -6,5 +6,13 @@ namespace Graphics {
 
 Loader::Loader(Renderer& renderer): _renderer(renderer) {}
 
+std::unique_ptr<Loader::Data> Loader::read(const std::string& /*filename*/) {
+    return std::make_unique<Data>();
+}
+
+Resource::SharedPtr<Resource> Loader::build(const std::string& filename, Data& /*data*/) {
+    return loadFile(filename);
+}
+
 } // Graphics
 } // lug
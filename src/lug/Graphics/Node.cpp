@@ -1,4 +1,7 @@
 #include <lug/Graphics/Node.hpp>
+
+#include <algorithm>
+
 #include <lug/Math/Geometry/Transform.hpp>
 
 namespace lug {
@@ -39,10 +42,24 @@ const Node* Node::getNode(const std::string& name) const {
 }
 
 void Node::attachChild(Node& child) {
+    // The absolute transform of a re-parented child changes with its parent
+    if (child._parent) {
+        child._parent->detachChild(child);
+        child.needUpdate();
+    }
+
     child._parent = this;
     _children.push_back(&child);
 }
 
+void Node::detachChild(Node& child) {
+    _children.erase(std::remove(_children.begin(), _children.end(), &child), _children.end());
+
+    if (child._parent == this) {
+        child._parent = nullptr;
+    }
+}
+
 void Node::translate(const Math::Vec3f& direction, TransformSpace space) {
     if (space == TransformSpace::Local) {
         _position += _rotation.transform() * direction;
@@ -0,0 +1,461 @@
+#include <lug/Graphics/Render/BlockCompression.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+namespace BlockCompression {
+
+namespace {
+
+void fetchBlock(const uint8_t* src, uint32_t width, uint32_t height, uint32_t blockX, uint32_t blockY, uint8_t block[16][4]) {
+    for (uint32_t y = 0; y < 4; ++y) {
+        const uint32_t srcY = std::min(blockY * 4 + y, height - 1);
+
+        for (uint32_t x = 0; x < 4; ++x) {
+            const uint32_t srcX = std::min(blockX * 4 + x, width - 1);
+            std::memcpy(block[y * 4 + x], src + (static_cast<size_t>(srcY) * width + srcX) * 4, 4);
+        }
+    }
+}
+
+void storeBlock(const uint8_t block[16][4], uint32_t width, uint32_t height, uint32_t blockX, uint32_t blockY, uint8_t* dst) {
+    for (uint32_t y = 0; y < 4 && blockY * 4 + y < height; ++y) {
+        for (uint32_t x = 0; x < 4 && blockX * 4 + x < width; ++x) {
+            std::memcpy(dst + (static_cast<size_t>(blockY * 4 + y) * width + blockX * 4 + x) * 4, block[y * 4 + x], 4);
+        }
+    }
+}
+
+uint64_t readLE(const uint8_t* src, uint32_t bytesCount) {
+    uint64_t value = 0;
+
+    for (uint32_t i = 0; i < bytesCount; ++i) {
+        value |= static_cast<uint64_t>(src[i]) << (i * 8);
+    }
+
+    return value;
+}
+
+void writeLE(uint8_t* dst, uint64_t value, uint32_t bytesCount) {
+    for (uint32_t i = 0; i < bytesCount; ++i) {
+        dst[i] = static_cast<uint8_t>(value >> (i * 8));
+    }
+}
+
+uint16_t packColor(const uint8_t color[4]) {
+    const uint32_t r = (color[0] * 31u + 127u) / 255u;
+    const uint32_t g = (color[1] * 63u + 127u) / 255u;
+    const uint32_t b = (color[2] * 31u + 127u) / 255u;
+
+    return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+}
+
+void unpackColor(uint16_t packed, uint8_t color[4]) {
+    const uint32_t r = (packed >> 11) & 0x1F;
+    const uint32_t g = (packed >> 5) & 0x3F;
+    const uint32_t b = packed & 0x1F;
+
+    color[0] = static_cast<uint8_t>((r << 3) | (r >> 2));
+    color[1] = static_cast<uint8_t>((g << 2) | (g >> 4));
+    color[2] = static_cast<uint8_t>((b << 3) | (b >> 2));
+    color[3] = 255;
+}
+
+// The color blocks of BC2 and BC3 always use 4 colors, the ones of BC1 use 3 colors
+// and a transparent black when the first endpoint isn't greater than the second
+void getColorPalette(uint16_t color0, uint16_t color1, bool fourColorsOnly, uint8_t palette[4][4]) {
+    unpackColor(color0, palette[0]);
+    unpackColor(color1, palette[1]);
+
+    if (fourColorsOnly || color0 > color1) {
+        for (uint32_t c = 0; c < 3; ++c) {
+            palette[2][c] = static_cast<uint8_t>((2 * palette[0][c] + palette[1][c] + 1) / 3);
+            palette[3][c] = static_cast<uint8_t>((palette[0][c] + 2 * palette[1][c] + 1) / 3);
+        }
+
+        palette[2][3] = 255;
+        palette[3][3] = 255;
+    } else {
+        for (uint32_t c = 0; c < 3; ++c) {
+            palette[2][c] = static_cast<uint8_t>((palette[0][c] + palette[1][c] + 1) / 2);
+        }
+
+        palette[2][3] = 255;
+        std::memset(palette[3], 0, 4);
+    }
+}
+
+uint32_t getDistance(const uint8_t a[4], const uint8_t b[4]) {
+    uint32_t distance = 0;
+
+    for (uint32_t c = 0; c < 3; ++c) {
+        const int32_t difference = static_cast<int32_t>(a[c]) - static_cast<int32_t>(b[c]);
+        distance += static_cast<uint32_t>(difference * difference);
+    }
+
+    return distance;
+}
+
+// The endpoints are the texels at both ends of the principal axis of the colors,
+// which is found with a few iterations of the power method on their covariance matrix
+void encodeColorBlock(const uint8_t block[16][4], bool punchThrough, uint8_t* dst) {
+    bool transparent[16];
+    uint32_t opaqueCount = 0;
+
+    for (uint32_t i = 0; i < 16; ++i) {
+        transparent[i] = punchThrough && block[i][3] < 128;
+        opaqueCount += transparent[i] ? 0 : 1;
+    }
+
+    if (opaqueCount == 0) {
+        writeLE(dst, 0, 4);
+        writeLE(dst + 4, 0xFFFFFFFF, 4);
+        return;
+    }
+
+    float mean[3] = {0.0f, 0.0f, 0.0f};
+    uint8_t minColor[3] = {255, 255, 255};
+    uint8_t maxColor[3] = {0, 0, 0};
+
+    for (uint32_t i = 0; i < 16; ++i) {
+        if (transparent[i]) {
+            continue;
+        }
+
+        for (uint32_t c = 0; c < 3; ++c) {
+            mean[c] += block[i][c];
+            minColor[c] = std::min(minColor[c], block[i][c]);
+            maxColor[c] = std::max(maxColor[c], block[i][c]);
+        }
+    }
+
+    for (uint32_t c = 0; c < 3; ++c) {
+        mean[c] /= static_cast<float>(opaqueCount);
+    }
+
+    float covariance[3][3] = {};
+
+    for (uint32_t i = 0; i < 16; ++i) {
+        if (transparent[i]) {
+            continue;
+        }
+
+        const float d[3] = {block[i][0] - mean[0], block[i][1] - mean[1], block[i][2] - mean[2]};
+
+        for (uint32_t row = 0; row < 3; ++row) {
+            for (uint32_t column = 0; column < 3; ++column) {
+                covariance[row][column] += d[row] * d[column];
+            }
+        }
+    }
+
+    float axis[3] = {
+        static_cast<float>(maxColor[0] - minColor[0]),
+        static_cast<float>(maxColor[1] - minColor[1]),
+        static_cast<float>(maxColor[2] - minColor[2])
+    };
+
+    for (uint32_t iteration = 0; iteration < 8; ++iteration) {
+        const float next[3] = {
+            covariance[0][0] * axis[0] + covariance[0][1] * axis[1] + covariance[0][2] * axis[2],
+            covariance[1][0] * axis[0] + covariance[1][1] * axis[1] + covariance[1][2] * axis[2],
+            covariance[2][0] * axis[0] + covariance[2][1] * axis[1] + covariance[2][2] * axis[2]
+        };
+
+        const float norm = std::max(std::fabs(next[0]), std::max(std::fabs(next[1]), std::fabs(next[2])));
+        if (norm < 1e-6f) {
+            break;
+        }
+
+        for (uint32_t c = 0; c < 3; ++c) {
+            axis[c] = next[c] / norm;
+        }
+    }
+
+    uint32_t minIndex = 0;
+    uint32_t maxIndex = 0;
+    float minProjection = 0.0f;
+    float maxProjection = 0.0f;
+    bool first = true;
+
+    for (uint32_t i = 0; i < 16; ++i) {
+        if (transparent[i]) {
+            continue;
+        }
+
+        const float projection = (block[i][0] - mean[0]) * axis[0] + (block[i][1] - mean[1]) * axis[1] + (block[i][2] - mean[2]) * axis[2];
+
+        if (first || projection < minProjection) {
+            minProjection = projection;
+            minIndex = i;
+        }
+
+        if (first || projection > maxProjection) {
+            maxProjection = projection;
+            maxIndex = i;
+        }
+
+        first = false;
+    }
+
+    uint16_t color0 = packColor(block[maxIndex]);
+    uint16_t color1 = packColor(block[minIndex]);
+
+    // The order of the endpoints selects the mode of BC1, 3 colors are needed for the transparent texels
+    const bool threeColors = opaqueCount < 16;
+    if (threeColors ? color0 > color1 : color0 < color1) {
+        std::swap(color0, color1);
+    }
+
+    uint8_t palette[4][4];
+    getColorPalette(color0, color1, !punchThrough, palette);
+
+    // Equal endpoints of BC1 are decoded with 3 colors, the last one is transparent
+    const uint32_t paletteSize = threeColors || (punchThrough && color0 == color1) ? 3 : 4;
+
+    uint32_t indices = 0;
+
+    for (uint32_t i = 0; i < 16; ++i) {
+        uint32_t bestIndex = 3;
+
+        if (!transparent[i]) {
+            uint32_t bestDistance = 0xFFFFFFFF;
+            bestIndex = 0;
+
+            for (uint32_t index = 0; index < paletteSize; ++index) {
+                const uint32_t distance = getDistance(block[i], palette[index]);
+
+                if (distance < bestDistance) {
+                    bestDistance = distance;
+                    bestIndex = index;
+                }
+            }
+        }
+
+        indices |= bestIndex << (i * 2);
+    }
+
+    writeLE(dst, color0, 2);
+    writeLE(dst + 2, color1, 2);
+    writeLE(dst + 4, indices, 4);
+}
+
+void decodeColorBlock(const uint8_t* src, bool fourColorsOnly, uint8_t block[16][4]) {
+    uint8_t palette[4][4];
+    getColorPalette(static_cast<uint16_t>(readLE(src, 2)), static_cast<uint16_t>(readLE(src + 2, 2)), fourColorsOnly, palette);
+
+    const uint32_t indices = static_cast<uint32_t>(readLE(src + 4, 4));
+
+    for (uint32_t i = 0; i < 16; ++i) {
+        std::memcpy(block[i], palette[(indices >> (i * 2)) & 0x3], 4);
+    }
+}
+
+void getAlphaPalette(uint8_t alpha0, uint8_t alpha1, uint8_t palette[8]) {
+    palette[0] = alpha0;
+    palette[1] = alpha1;
+
+    if (alpha0 > alpha1) {
+        for (uint32_t i = 1; i < 7; ++i) {
+            palette[i + 1] = static_cast<uint8_t>(((7 - i) * alpha0 + i * alpha1 + 3) / 7);
+        }
+    } else {
+        for (uint32_t i = 1; i < 5; ++i) {
+            palette[i + 1] = static_cast<uint8_t>(((5 - i) * alpha0 + i * alpha1 + 2) / 5);
+        }
+
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+}
+
+// Used for the alpha of BC3 and the channels of BC4 and BC5
+void encodeAlphaBlock(const uint8_t values[16], uint8_t* dst) {
+    const uint8_t alpha0 = *std::max_element(values, values + 16);
+    const uint8_t alpha1 = *std::min_element(values, values + 16);
+
+    uint8_t palette[8];
+    getAlphaPalette(alpha0, alpha1, palette);
+
+    uint64_t indices = 0;
+
+    for (uint32_t i = 0; i < 16 && alpha0 != alpha1; ++i) {
+        uint32_t bestIndex = 0;
+        uint32_t bestDistance = 256;
+
+        for (uint32_t index = 0; index < 8; ++index) {
+            const uint32_t distance = static_cast<uint32_t>(std::abs(static_cast<int32_t>(values[i]) - static_cast<int32_t>(palette[index])));
+
+            if (distance < bestDistance) {
+                bestDistance = distance;
+                bestIndex = index;
+            }
+        }
+
+        indices |= static_cast<uint64_t>(bestIndex) << (i * 3);
+    }
+
+    dst[0] = alpha0;
+    dst[1] = alpha1;
+    writeLE(dst + 2, indices, 6);
+}
+
+void decodeAlphaBlock(const uint8_t* src, uint8_t values[16]) {
+    uint8_t palette[8];
+    getAlphaPalette(src[0], src[1], palette);
+
+    const uint64_t indices = readLE(src + 2, 6);
+
+    for (uint32_t i = 0; i < 16; ++i) {
+        values[i] = palette[(indices >> (i * 3)) & 0x7];
+    }
+}
+
+void encodeExplicitAlphaBlock(const uint8_t block[16][4], uint8_t* dst) {
+    uint64_t alphas = 0;
+
+    for (uint32_t i = 0; i < 16; ++i) {
+        alphas |= static_cast<uint64_t>((block[i][3] * 15u + 127u) / 255u) << (i * 4);
+    }
+
+    writeLE(dst, alphas, 8);
+}
+
+void decodeExplicitAlphaBlock(const uint8_t* src, uint8_t block[16][4]) {
+    const uint64_t alphas = readLE(src, 8);
+
+    for (uint32_t i = 0; i < 16; ++i) {
+        block[i][3] = static_cast<uint8_t>(((alphas >> (i * 4)) & 0xF) * 17);
+    }
+}
+
+void getChannel(const uint8_t block[16][4], uint32_t channel, uint8_t values[16]) {
+    for (uint32_t i = 0; i < 16; ++i) {
+        values[i] = block[i][channel];
+    }
+}
+
+void setChannel(const uint8_t values[16], uint32_t channel, uint8_t block[16][4]) {
+    for (uint32_t i = 0; i < 16; ++i) {
+        block[i][channel] = values[i];
+    }
+}
+
+} // anonymous
+
+uint32_t getBlockSize(Format format) {
+    switch (format) {
+        case Format::BC1:
+        case Format::BC4:
+            return 8;
+        case Format::BC2:
+        case Format::BC3:
+        case Format::BC5:
+            return 16;
+    }
+
+    return 0;
+}
+
+size_t getCompressedSize(Format format, uint32_t width, uint32_t height) {
+    return static_cast<size_t>((width + 3) / 4) * ((height + 3) / 4) * getBlockSize(format);
+}
+
+void encode(Format format, const uint8_t* src, uint32_t width, uint32_t height, uint8_t* dst) {
+    const uint32_t blocksX = (width + 3) / 4;
+    const uint32_t blocksY = (height + 3) / 4;
+    const uint32_t blockSize = getBlockSize(format);
+
+    for (uint32_t blockY = 0; blockY < blocksY; ++blockY) {
+        for (uint32_t blockX = 0; blockX < blocksX; ++blockX) {
+            uint8_t block[16][4];
+            fetchBlock(src, width, height, blockX, blockY, block);
+
+            uint8_t* blockDst = dst + (static_cast<size_t>(blockY) * blocksX + blockX) * blockSize;
+            uint8_t values[16];
+
+            switch (format) {
+                case Format::BC1:
+                    encodeColorBlock(block, true, blockDst);
+                    break;
+                case Format::BC2:
+                    encodeExplicitAlphaBlock(block, blockDst);
+                    encodeColorBlock(block, false, blockDst + 8);
+                    break;
+                case Format::BC3:
+                    getChannel(block, 3, values);
+                    encodeAlphaBlock(values, blockDst);
+                    encodeColorBlock(block, false, blockDst + 8);
+                    break;
+                case Format::BC4:
+                    getChannel(block, 0, values);
+                    encodeAlphaBlock(values, blockDst);
+                    break;
+                case Format::BC5:
+                    getChannel(block, 0, values);
+                    encodeAlphaBlock(values, blockDst);
+                    getChannel(block, 1, values);
+                    encodeAlphaBlock(values, blockDst + 8);
+                    break;
+            }
+        }
+    }
+}
+
+void decode(Format format, const uint8_t* src, uint32_t width, uint32_t height, uint8_t* dst) {
+    const uint32_t blocksX = (width + 3) / 4;
+    const uint32_t blocksY = (height + 3) / 4;
+    const uint32_t blockSize = getBlockSize(format);
+
+    for (uint32_t blockY = 0; blockY < blocksY; ++blockY) {
+        for (uint32_t blockX = 0; blockX < blocksX; ++blockX) {
+            const uint8_t* blockSrc = src + (static_cast<size_t>(blockY) * blocksX + blockX) * blockSize;
+
+            uint8_t block[16][4];
+            uint8_t values[16];
+
+            switch (format) {
+                case Format::BC1:
+                    decodeColorBlock(blockSrc, false, block);
+                    break;
+                case Format::BC2:
+                    decodeColorBlock(blockSrc + 8, true, block);
+                    decodeExplicitAlphaBlock(blockSrc, block);
+                    break;
+                case Format::BC3:
+                    decodeColorBlock(blockSrc + 8, true, block);
+                    decodeAlphaBlock(blockSrc, values);
+                    setChannel(values, 3, block);
+                    break;
+                case Format::BC4:
+                    std::memset(block, 0, sizeof(block));
+                    decodeAlphaBlock(blockSrc, values);
+                    setChannel(values, 0, block);
+                    std::memset(values, 255, sizeof(values));
+                    setChannel(values, 3, block);
+                    break;
+                case Format::BC5:
+                    std::memset(block, 0, sizeof(block));
+                    decodeAlphaBlock(blockSrc, values);
+                    setChannel(values, 0, block);
+                    decodeAlphaBlock(blockSrc + 8, values);
+                    setChannel(values, 1, block);
+                    std::memset(values, 255, sizeof(values));
+                    setChannel(values, 3, block);
+                    break;
+            }
+
+            storeBlock(block, width, height, blockX, blockY, dst);
+        }
+    }
+}
+
+} // BlockCompression
+} // Render
+} // Graphics
+} // lug
@@ -0,0 +1,67 @@
+#include <lug/Graphics/Render/BufferCapacity.hpp>
+
+#include <algorithm>
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+
+BufferCapacity::BufferCapacity(size_t minCapacity, size_t alignment, float growthFactor, uint32_t shrinkDelay) :
+    _minCapacity(minCapacity), _alignment(alignment), _growthFactor(growthFactor), _shrinkDelay(shrinkDelay) {
+    _minCapacity = align(_minCapacity);
+}
+
+bool BufferCapacity::update(size_t size) {
+    if (size > _capacity) {
+        grow(size);
+        return true;
+    }
+
+    // Only shrink if the needed size would still fit after growing twice, to not shrink and grow back
+    const size_t grownSize = static_cast<size_t>(static_cast<float>(size) * _growthFactor * _growthFactor);
+    if (_capacity <= _minCapacity || grownSize > _capacity) {
+        _lowFramesCount = 0;
+        _lowFramesMaxSize = 0;
+        return false;
+    }
+
+    ++_lowFramesCount;
+    _lowFramesMaxSize = std::max(_lowFramesMaxSize, size);
+
+    if (_lowFramesCount < _shrinkDelay) {
+        return false;
+    }
+
+    const size_t capacity = std::max(_minCapacity, align(static_cast<size_t>(static_cast<float>(_lowFramesMaxSize) * _growthFactor)));
+    if (capacity >= _capacity) {
+        _lowFramesCount = 0;
+        _lowFramesMaxSize = 0;
+        return false;
+    }
+
+    resize(capacity);
+    return true;
+}
+
+void BufferCapacity::grow(size_t size) {
+    const size_t grownCapacity = align(static_cast<size_t>(static_cast<float>(_capacity) * _growthFactor));
+
+    resize(std::max({_minCapacity, align(size), grownCapacity}));
+}
+
+size_t BufferCapacity::align(size_t size) const {
+    return (size + _alignment - 1) & ~(_alignment - 1);
+}
+
+void BufferCapacity::resize(size_t capacity) {
+    _capacity = capacity;
+
+    _lowFramesCount = 0;
+    _lowFramesMaxSize = 0;
+
+    ++_reallocationsCount;
+}
+
+} // Render
+} // Graphics
+} // lug
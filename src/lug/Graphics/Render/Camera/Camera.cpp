@@ -2,6 +2,7 @@
 
 #include <lug/Graphics/Render/View.hpp>
 #include <lug/Graphics/Scene/Scene.hpp>
+#include <lug/Math/Geometry/Transform.hpp>
 #include <lug/System/Logger/Logger.hpp>
 
 namespace lug {
@@ -26,7 +27,12 @@ void Camera::update(const ::lug::Graphics::Render::View& renderView, Queue& rend
 }
 
 void Camera::updateView() {
-    _viewMatrix = _parent->getTransform().inverse();
+    // Compose the inverse from the transform of the node rather than inverting its matrix
+    _viewMatrix = Math::Geometry::inverseTransform(
+        _parent->getAbsolutePosition(),
+        _parent->getAbsoluteRotation(),
+        _parent->getAbsoluteScale()
+    );
     _needUpdateView = false;
 }
 
@@ -0,0 +1,557 @@
+#include <lug/Graphics/Render/Ibl.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <lug/Graphics/Render/Ktx2.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+namespace Ibl {
+
+namespace {
+
+constexpr float pi = 3.14159265358979f;
+
+// Ratio of the convolution of each band with the clamped cosine (pi, 2pi/3 and pi/4) and of pi
+constexpr float bandFactors[9] = {1.0f, 2.0f / 3.0f, 2.0f / 3.0f, 2.0f / 3.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.25f};
+
+// A sample of the GGX lobe around the normal (0, 0, 1), the view direction being the normal
+struct LobeSample {
+    float x;
+    float y;
+    float z;
+    float weight;   // NdotL
+    float lod;
+};
+
+// Face and texture coordinates of a direction, see the cube map faces of the Vulkan specification
+void getFaceCoordinates(float x, float y, float z, uint32_t& face, float& u, float& v) {
+    const float ax = std::abs(x);
+    const float ay = std::abs(y);
+    const float az = std::abs(z);
+
+    float sc;
+    float tc;
+    float ma;
+
+    if (ax >= ay && ax >= az) {
+        face = x >= 0.0f ? 0 : 1;
+        sc = x >= 0.0f ? -z : z;
+        tc = -y;
+        ma = ax;
+    } else if (ay >= az) {
+        face = y >= 0.0f ? 2 : 3;
+        sc = x;
+        tc = y >= 0.0f ? z : -z;
+        ma = ay;
+    } else {
+        face = z >= 0.0f ? 4 : 5;
+        sc = z >= 0.0f ? x : -x;
+        tc = -y;
+        ma = az;
+    }
+
+    u = 0.5f * (sc / ma + 1.0f);
+    v = 0.5f * (tc / ma + 1.0f);
+}
+
+void sampleFace(const std::vector<Math::Vec3f>& texels, uint32_t size, float u, float v, float color[3]) {
+    const float fx = std::min(std::max(u * size - 0.5f, 0.0f), static_cast<float>(size - 1));
+    const float fy = std::min(std::max(v * size - 0.5f, 0.0f), static_cast<float>(size - 1));
+
+    const uint32_t x0 = static_cast<uint32_t>(fx);
+    const uint32_t y0 = static_cast<uint32_t>(fy);
+    const uint32_t x1 = std::min(x0 + 1, size - 1);
+    const uint32_t y1 = std::min(y0 + 1, size - 1);
+
+    const float wx = fx - x0;
+    const float wy = fy - y0;
+
+    const Math::Vec3f& t00 = texels[y0 * size + x0];
+    const Math::Vec3f& t10 = texels[y0 * size + x1];
+    const Math::Vec3f& t01 = texels[y1 * size + x0];
+    const Math::Vec3f& t11 = texels[y1 * size + x1];
+
+    for (uint8_t i = 0; i < 3; ++i) {
+        const float top = t00(i) + (t10(i) - t00(i)) * wx;
+        const float bottom = t01(i) + (t11(i) - t01(i)) * wx;
+
+        color[i] = top + (bottom - top) * wy;
+    }
+}
+
+void sampleCubeMap(const CubeMap& cubeMap, float x, float y, float z, float color[3]) {
+    uint32_t face;
+    float u;
+    float v;
+
+    getFaceCoordinates(x, y, z, face, u, v);
+    sampleFace(cubeMap.faces[face], cubeMap.size, u, v, color);
+}
+
+// Trilinear sample of a mip chain
+void sampleChain(const std::vector<CubeMap>& chain, float x, float y, float z, float lod, float color[3]) {
+    const uint32_t level = static_cast<uint32_t>(lod);
+    const float weight = lod - level;
+
+    sampleCubeMap(chain[level], x, y, z, color);
+
+    if (weight > 0.0f && level + 1 < chain.size()) {
+        float next[3];
+        sampleCubeMap(chain[level + 1], x, y, z, next);
+
+        for (uint8_t i = 0; i < 3; ++i) {
+            color[i] += (next[i] - color[i]) * weight;
+        }
+    }
+}
+
+float getAreaElement(float x, float y) {
+    return std::atan2(x * y, std::sqrt(x * x + y * y + 1.0f));
+}
+
+// Solid angle of a texel of a face
+float getTexelSolidAngle(uint32_t x, uint32_t y, uint32_t size) {
+    const float texelSize = 2.0f / size;
+
+    const float x0 = x * texelSize - 1.0f;
+    const float y0 = y * texelSize - 1.0f;
+    const float x1 = x0 + texelSize;
+    const float y1 = y0 + texelSize;
+
+    return getAreaElement(x0, y0) - getAreaElement(x0, y1) - getAreaElement(x1, y0) + getAreaElement(x1, y1);
+}
+
+void evaluateBasis(float x, float y, float z, float basis[9]) {
+    basis[0] = 0.282095f;
+    basis[1] = 0.488603f * y;
+    basis[2] = 0.488603f * z;
+    basis[3] = 0.488603f * x;
+    basis[4] = 1.092548f * x * y;
+    basis[5] = 1.092548f * y * z;
+    basis[6] = 0.315392f * (3.0f * z * z - 1.0f);
+    basis[7] = 1.092548f * x * z;
+    basis[8] = 0.546274f * (x * x - y * y);
+}
+
+// Van der Corput sequence, the second coordinate of the Hammersley points
+float radicalInverse(uint32_t bits) {
+    bits = (bits << 16) | (bits >> 16);
+    bits = ((bits & 0x55555555) << 1) | ((bits & 0xAAAAAAAA) >> 1);
+    bits = ((bits & 0x33333333) << 2) | ((bits & 0xCCCCCCCC) >> 2);
+    bits = ((bits & 0x0F0F0F0F) << 4) | ((bits & 0xF0F0F0F0) >> 4);
+    bits = ((bits & 0x00FF00FF) << 8) | ((bits & 0xFF00FF00) >> 8);
+
+    return static_cast<float>(bits) * 2.3283064365386963e-10f;
+}
+
+// Half vector of the i-th sample of the GGX distribution, around (0, 0, 1)
+void sampleGgx(uint32_t i, uint32_t samplesCount, float alpha, float h[3]) {
+    const float phi = 2.0f * pi * static_cast<float>(i) / static_cast<float>(samplesCount);
+    const float e = radicalInverse(i);
+
+    const float cosTheta = std::sqrt((1.0f - e) / (1.0f + (alpha * alpha - 1.0f) * e));
+    const float sinTheta = std::sqrt(std::max(1.0f - cosTheta * cosTheta, 0.0f));
+
+    h[0] = sinTheta * std::cos(phi);
+    h[1] = sinTheta * std::sin(phi);
+    h[2] = cosTheta;
+}
+
+float getGgxDistribution(float NdotH, float alpha) {
+    const float alpha2 = alpha * alpha;
+    const float denominator = NdotH * NdotH * (alpha2 - 1.0f) + 1.0f;
+
+    return alpha2 / (pi * denominator * denominator);
+}
+
+uint16_t toHalf(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const uint32_t sign = (bits >> 16) & 0x8000;
+    const uint32_t exponent = (bits >> 23) & 0xFF;
+    uint32_t mantissa = bits & 0x7FFFFF;
+
+    if (exponent == 0xFF) {
+        return static_cast<uint16_t>(sign | 0x7C00 | (mantissa ? 0x200 : 0));
+    }
+
+    const int32_t halfExponent = static_cast<int32_t>(exponent) - 127 + 15;
+
+    // The values too large for a half are clamped to the largest one, not infinity
+    if (halfExponent >= 31) {
+        return static_cast<uint16_t>(sign | 0x7BFF);
+    }
+
+    if (halfExponent <= 0) {
+        if (halfExponent < -10) {
+            return static_cast<uint16_t>(sign);
+        }
+
+        // Subnormal half, rounded to nearest even
+        mantissa |= 0x800000;
+
+        const uint32_t shift = static_cast<uint32_t>(14 - halfExponent);
+        const uint32_t halfway = 1u << (shift - 1);
+        const uint32_t rest = mantissa & ((1u << shift) - 1);
+
+        uint32_t half = mantissa >> shift;
+        if (rest > halfway || (rest == halfway && (half & 1))) {
+            ++half;
+        }
+
+        return static_cast<uint16_t>(sign | half);
+    }
+
+    uint32_t half = (static_cast<uint32_t>(halfExponent) << 10) | (mantissa >> 13);
+    const uint32_t rest = mantissa & 0x1FFF;
+
+    if (rest > 0x1000 || (rest == 0x1000 && (half & 1))) {
+        ++half;
+    }
+
+    return static_cast<uint16_t>(sign | std::min(half, 0x7BFFu));
+}
+
+void appendHalf(std::vector<uint8_t>& data, float value) {
+    const uint16_t half = toHalf(value);
+
+    data.push_back(static_cast<uint8_t>(half));
+    data.push_back(static_cast<uint8_t>(half >> 8));
+}
+
+} // anonymous
+
+Math::Vec3f getDirection(uint32_t face, float u, float v) {
+    const float s = 2.0f * u - 1.0f;
+    const float t = 2.0f * v - 1.0f;
+
+    switch (face) {
+        case 0:
+            return Math::normalize(Math::Vec3f{1.0f, -t, -s});
+        case 1:
+            return Math::normalize(Math::Vec3f{-1.0f, -t, s});
+        case 2:
+            return Math::normalize(Math::Vec3f{s, 1.0f, t});
+        case 3:
+            return Math::normalize(Math::Vec3f{s, -1.0f, -t});
+        case 4:
+            return Math::normalize(Math::Vec3f{s, -t, 1.0f});
+        default:
+            return Math::normalize(Math::Vec3f{-s, -t, -1.0f});
+    }
+}
+
+Math::Vec3f sample(const CubeMap& cubeMap, const Math::Vec3f& direction) {
+    float color[3];
+    sampleCubeMap(cubeMap, direction.x(), direction.y(), direction.z(), color);
+
+    return {color[0], color[1], color[2]};
+}
+
+CubeMap downsample(const CubeMap& cubeMap) {
+    CubeMap result;
+    result.size = std::max(cubeMap.size / 2, 1u);
+
+    for (uint32_t face = 0; face < 6; ++face) {
+        const std::vector<Math::Vec3f>& src = cubeMap.faces[face];
+        std::vector<Math::Vec3f>& dst = result.faces[face];
+
+        dst.resize(result.size * result.size);
+
+        for (uint32_t y = 0; y < result.size; ++y) {
+            const uint32_t y0 = std::min(y * 2, cubeMap.size - 1);
+            const uint32_t y1 = std::min(y * 2 + 1, cubeMap.size - 1);
+
+            for (uint32_t x = 0; x < result.size; ++x) {
+                const uint32_t x0 = std::min(x * 2, cubeMap.size - 1);
+                const uint32_t x1 = std::min(x * 2 + 1, cubeMap.size - 1);
+
+                Math::Vec3f& texel = dst[y * result.size + x];
+                for (uint8_t i = 0; i < 3; ++i) {
+                    texel(i) = (src[y0 * cubeMap.size + x0](i) + src[y0 * cubeMap.size + x1](i) + src[y1 * cubeMap.size + x0](i) + src[y1 * cubeMap.size + x1](i)) * 0.25f;
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+SphericalHarmonics computeIrradiance(const CubeMap& environment) {
+    // The sums of the large environments need the precision of the doubles
+    double coefficients[9][3] = {};
+
+    for (uint32_t face = 0; face < 6; ++face) {
+        for (uint32_t y = 0; y < environment.size; ++y) {
+            for (uint32_t x = 0; x < environment.size; ++x) {
+                const Math::Vec3f direction = getDirection(face, (x + 0.5f) / environment.size, (y + 0.5f) / environment.size);
+                const Math::Vec3f& radiance = environment.faces[face][y * environment.size + x];
+                const float solidAngle = getTexelSolidAngle(x, y, environment.size);
+
+                float basis[9];
+                evaluateBasis(direction.x(), direction.y(), direction.z(), basis);
+
+                for (uint8_t i = 0; i < 9; ++i) {
+                    for (uint8_t j = 0; j < 3; ++j) {
+                        coefficients[i][j] += static_cast<double>(radiance(j) * basis[i] * solidAngle);
+                    }
+                }
+            }
+        }
+    }
+
+    SphericalHarmonics irradiance;
+    for (uint8_t i = 0; i < 9; ++i) {
+        for (uint8_t j = 0; j < 3; ++j) {
+            irradiance[i](j) = static_cast<float>(coefficients[i][j]) * bandFactors[i];
+        }
+    }
+
+    return irradiance;
+}
+
+Math::Vec3f getIrradiance(const SphericalHarmonics& irradiance, const Math::Vec3f& normal) {
+    float basis[9];
+    evaluateBasis(normal.x(), normal.y(), normal.z(), basis);
+
+    Math::Vec3f result{0.0f, 0.0f, 0.0f};
+    for (uint8_t i = 0; i < 9; ++i) {
+        for (uint8_t j = 0; j < 3; ++j) {
+            result(j) += irradiance[i](j) * basis[i];
+        }
+    }
+
+    // The ringing of the harmonics can give negative values around the strong lights
+    for (uint8_t j = 0; j < 3; ++j) {
+        result(j) = std::max(result(j), 0.0f);
+    }
+
+    return result;
+}
+
+CubeMap createIrradianceMap(const SphericalHarmonics& irradiance, uint32_t size) {
+    CubeMap irradianceMap;
+    irradianceMap.size = size;
+
+    for (uint32_t face = 0; face < 6; ++face) {
+        irradianceMap.faces[face].resize(size * size);
+
+        for (uint32_t y = 0; y < size; ++y) {
+            for (uint32_t x = 0; x < size; ++x) {
+                irradianceMap.faces[face][y * size + x] = getIrradiance(irradiance, getDirection(face, (x + 0.5f) / size, (y + 0.5f) / size));
+            }
+        }
+    }
+
+    return irradianceMap;
+}
+
+std::vector<CubeMap> prefilter(const CubeMap& environment, uint32_t levelsCount, uint32_t samplesCount) {
+    // Mip chain of the environment, read by the samples according to their solid angle
+    std::vector<CubeMap> chain{environment};
+    while (chain.back().size > 1) {
+        chain.push_back(downsample(chain.back()));
+    }
+
+    levelsCount = std::min(std::max(levelsCount, 1u), static_cast<uint32_t>(chain.size()));
+    samplesCount = std::max(samplesCount, 1u);
+
+    // The first level is the environment itself, a roughness of 0 reflects only one direction
+    std::vector<CubeMap> levels{environment};
+
+    const float texelSolidAngle = 4.0f * pi / (6.0f * environment.size * environment.size);
+    const float maxLod = static_cast<float>(chain.size() - 1);
+
+    std::vector<LobeSample> lobe;
+    lobe.reserve(samplesCount);
+
+    for (uint32_t level = 1; level < levelsCount; ++level) {
+        const float roughness = static_cast<float>(level) / static_cast<float>(levelsCount - 1);
+        const float alpha = roughness * roughness;
+
+        // The lobe is the same for all the texels, only its orientation changes
+        lobe.clear();
+        for (uint32_t i = 0; i < samplesCount; ++i) {
+            float h[3];
+            sampleGgx(i, samplesCount, alpha, h);
+
+            // Reflection of the view direction (0, 0, 1) around h
+            const LobeSample lobeSample{
+                2.0f * h[2] * h[0],
+                2.0f * h[2] * h[1],
+                2.0f * h[2] * h[2] - 1.0f,
+                2.0f * h[2] * h[2] - 1.0f,
+                0.0f
+            };
+
+            if (lobeSample.weight <= 0.0f) {
+                continue;
+            }
+
+            // With the view direction along the normal, the pdf of the reflected direction is D / 4
+            const float pdf = getGgxDistribution(h[2], alpha) * 0.25f;
+            const float sampleSolidAngle = 1.0f / (static_cast<float>(samplesCount) * pdf + 1e-6f);
+
+            lobe.push_back(lobeSample);
+            lobe.back().lod = std::min(std::max(0.5f * std::log2(sampleSolidAngle / texelSolidAngle) + 1.0f, 0.0f), maxLod);
+        }
+
+        CubeMap result;
+        result.size = chain[level].size;
+
+        for (uint32_t face = 0; face < 6; ++face) {
+            result.faces[face].resize(result.size * result.size);
+
+            for (uint32_t y = 0; y < result.size; ++y) {
+                for (uint32_t x = 0; x < result.size; ++x) {
+                    const Math::Vec3f n = getDirection(face, (x + 0.5f) / result.size, (y + 0.5f) / result.size);
+
+                    // Tangent basis of the normal
+                    const Math::Vec3f up = std::abs(n.z()) < 0.999f ? Math::Vec3f{0.0f, 0.0f, 1.0f} : Math::Vec3f{1.0f, 0.0f, 0.0f};
+                    const Math::Vec3f t = Math::normalize(Math::cross(up, n));
+                    const Math::Vec3f b = Math::cross(n, t);
+
+                    float sum[3] = {0.0f, 0.0f, 0.0f};
+                    float weight = 0.0f;
+
+                    for (const LobeSample& lobeSample : lobe) {
+                        const float lx = t.x() * lobeSample.x + b.x() * lobeSample.y + n.x() * lobeSample.z;
+                        const float ly = t.y() * lobeSample.x + b.y() * lobeSample.y + n.y() * lobeSample.z;
+                        const float lz = t.z() * lobeSample.x + b.z() * lobeSample.y + n.z() * lobeSample.z;
+
+                        float color[3];
+                        sampleChain(chain, lx, ly, lz, lobeSample.lod, color);
+
+                        for (uint8_t i = 0; i < 3; ++i) {
+                            sum[i] += color[i] * lobeSample.weight;
+                        }
+
+                        weight += lobeSample.weight;
+                    }
+
+                    Math::Vec3f& texel = result.faces[face][y * result.size + x];
+                    for (uint8_t i = 0; i < 3; ++i) {
+                        texel(i) = weight > 0.0f ? sum[i] / weight : 0.0f;
+                    }
+                }
+            }
+        }
+
+        levels.push_back(std::move(result));
+    }
+
+    return levels;
+}
+
+Math::Vec2f integrateBrdf(float NdotV, float roughness, uint32_t samplesCount) {
+    NdotV = std::min(std::max(NdotV, 1e-4f), 1.0f);
+    samplesCount = std::max(samplesCount, 1u);
+
+    const float alpha = roughness * roughness;
+
+    // Geometry term of Smith with the Schlick approximation, with the k of the image-based lighting
+    const float k = alpha * 0.5f;
+    const float gv = NdotV / (NdotV * (1.0f - k) + k);
+
+    // The view direction in the tangent space of the normal (0, 0, 1)
+    const float vx = std::sqrt(1.0f - NdotV * NdotV);
+    const float vz = NdotV;
+
+    float scale = 0.0f;
+    float bias = 0.0f;
+
+    for (uint32_t i = 0; i < samplesCount; ++i) {
+        float h[3];
+        sampleGgx(i, samplesCount, alpha, h);
+
+        const float VdotH = vx * h[0] + vz * h[2];
+        const float NdotL = 2.0f * VdotH * h[2] - vz;
+
+        if (NdotL <= 0.0f || VdotH <= 0.0f) {
+            continue;
+        }
+
+        const float NdotH = h[2];
+        const float g = gv * NdotL / (NdotL * (1.0f - k) + k);
+
+        // The BRDF times NdotL divided by the pdf of the sample
+        const float visibility = g * VdotH / (NdotH * NdotV);
+        const float fresnel = std::pow(1.0f - VdotH, 5.0f);
+
+        scale += (1.0f - fresnel) * visibility;
+        bias += fresnel * visibility;
+    }
+
+    return {scale / samplesCount, bias / samplesCount};
+}
+
+std::vector<Math::Vec2f> createBrdfLut(uint32_t size, uint32_t samplesCount) {
+    std::vector<Math::Vec2f> lut(size * size);
+
+    for (uint32_t y = 0; y < size; ++y) {
+        for (uint32_t x = 0; x < size; ++x) {
+            lut[y * size + x] = integrateBrdf((x + 0.5f) / size, (y + 0.5f) / size, samplesCount);
+        }
+    }
+
+    return lut;
+}
+
+bool writeCubeMap(const std::vector<CubeMap>& levels, std::vector<uint8_t>& file) {
+    if (levels.empty()) {
+        return false;
+    }
+
+    std::vector<std::vector<uint8_t>> data(levels.size());
+
+    for (size_t level = 0; level < levels.size(); ++level) {
+        const uint32_t size = levels[level].size;
+
+        if (size != std::max(levels[0].size >> level, 1u)) {
+            return false;
+        }
+
+        data[level].reserve(static_cast<size_t>(size) * size * 6 * 8);
+
+        for (const auto& face : levels[level].faces) {
+            if (face.size() != static_cast<size_t>(size) * size) {
+                return false;
+            }
+
+            for (const auto& texel : face) {
+                appendHalf(data[level], texel.x());
+                appendHalf(data[level], texel.y());
+                appendHalf(data[level], texel.z());
+                appendHalf(data[level], 1.0f);
+            }
+        }
+    }
+
+    return Ktx2::write(Ktx2::Format::R16G16B16A16Sfloat, levels[0].size, levels[0].size, 6, data, file);
+}
+
+bool writeBrdfLut(const std::vector<Math::Vec2f>& lut, uint32_t size, std::vector<uint8_t>& file) {
+    if (lut.size() != static_cast<size_t>(size) * size) {
+        return false;
+    }
+
+    std::vector<std::vector<uint8_t>> data(1);
+    data[0].reserve(lut.size() * 4);
+
+    for (const auto& texel : lut) {
+        appendHalf(data[0], texel.x());
+        appendHalf(data[0], texel.y());
+    }
+
+    return Ktx2::write(Ktx2::Format::R16G16Sfloat, size, size, data, file);
+}
+
+} // Ibl
+} // Render
+} // Graphics
+} // lug
@@ -0,0 +1,515 @@
+#include <lug/Graphics/Render/Ktx2.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#include <lug/Graphics/Render/Mipmap.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+namespace Ktx2 {
+
+namespace {
+
+constexpr uint8_t identifier[12] = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+
+constexpr size_t headerSize = 80;
+constexpr size_t levelIndexEntrySize = 24;
+
+// Data Format Descriptor (Khronos Data Format Specification 1.3)
+constexpr uint32_t dfdVersion = 2;
+constexpr uint32_t dfdBlockHeaderSize = 24;
+constexpr uint32_t dfdSampleSize = 16;
+
+constexpr uint8_t dfdModelRGBSDA = 1;
+constexpr uint8_t dfdModelBC1A = 128;
+constexpr uint8_t dfdModelBC2 = 129;
+constexpr uint8_t dfdModelBC3 = 130;
+constexpr uint8_t dfdModelBC4 = 131;
+constexpr uint8_t dfdModelBC5 = 132;
+
+constexpr uint8_t dfdPrimariesBT709 = 1;
+constexpr uint8_t dfdTransferLinear = 1;
+constexpr uint8_t dfdTransferSRGB = 2;
+
+constexpr uint8_t dfdChannelLinear = 0x10;
+constexpr uint8_t dfdChannelSigned = 0x40;
+constexpr uint8_t dfdChannelFloat = 0x80;
+
+// The bounds of the float samples are the floats -1.0 and 1.0
+constexpr uint32_t dfdFloatLower = 0xBF800000;
+constexpr uint32_t dfdFloatUpper = 0x3F800000;
+
+struct DfdSample {
+    uint32_t bitOffset;
+    uint32_t bitLength;
+    uint8_t channel;
+    uint32_t upper;
+    uint32_t lower = 0;
+};
+
+uint32_t readU32(const uint8_t* src) {
+    return static_cast<uint32_t>(src[0]) | (static_cast<uint32_t>(src[1]) << 8) | (static_cast<uint32_t>(src[2]) << 16) | (static_cast<uint32_t>(src[3]) << 24);
+}
+
+uint64_t readU64(const uint8_t* src) {
+    return static_cast<uint64_t>(readU32(src)) | (static_cast<uint64_t>(readU32(src + 4)) << 32);
+}
+
+void writeU32(std::vector<uint8_t>& dst, size_t offset, uint32_t value) {
+    for (uint32_t i = 0; i < 4; ++i) {
+        dst[offset + i] = static_cast<uint8_t>(value >> (i * 8));
+    }
+}
+
+void writeU64(std::vector<uint8_t>& dst, size_t offset, uint64_t value) {
+    writeU32(dst, offset, static_cast<uint32_t>(value));
+    writeU32(dst, offset + 4, static_cast<uint32_t>(value >> 32));
+}
+
+void appendU32(std::vector<uint8_t>& dst, uint32_t value) {
+    dst.resize(dst.size() + 4);
+    writeU32(dst, dst.size() - 4, value);
+}
+
+size_t align(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// Whether [offset, offset + length) is inside of a file of fileSize bytes, without overflowing
+bool isInside(uint64_t offset, uint64_t length, size_t fileSize) {
+    return offset <= fileSize && length <= fileSize - offset;
+}
+
+bool getDfdSamples(Format format, uint8_t& model, std::vector<DfdSample>& samples) {
+    switch (format) {
+        case Format::R8G8B8A8Unorm:
+        case Format::R8G8B8A8Srgb:
+            model = dfdModelRGBSDA;
+            samples = {
+                {0, 8, 0, 255},
+                {8, 8, 1, 255},
+                {16, 8, 2, 255},
+                // The alpha of the sRGB formats is linear
+                {24, 8, static_cast<uint8_t>(format == Format::R8G8B8A8Srgb ? 15 | dfdChannelLinear : 15), 255}
+            };
+            return true;
+        case Format::R16G16Sfloat:
+            model = dfdModelRGBSDA;
+            samples = {
+                {0, 16, dfdChannelFloat | dfdChannelSigned | 0, dfdFloatUpper, dfdFloatLower},
+                {16, 16, dfdChannelFloat | dfdChannelSigned | 1, dfdFloatUpper, dfdFloatLower}
+            };
+            return true;
+        case Format::R16G16B16A16Sfloat:
+            model = dfdModelRGBSDA;
+            samples = {
+                {0, 16, dfdChannelFloat | dfdChannelSigned | 0, dfdFloatUpper, dfdFloatLower},
+                {16, 16, dfdChannelFloat | dfdChannelSigned | 1, dfdFloatUpper, dfdFloatLower},
+                {32, 16, dfdChannelFloat | dfdChannelSigned | 2, dfdFloatUpper, dfdFloatLower},
+                {48, 16, dfdChannelFloat | dfdChannelSigned | 15, dfdFloatUpper, dfdFloatLower}
+            };
+            return true;
+        case Format::BC1RgbUnorm:
+        case Format::BC1RgbSrgb:
+            model = dfdModelBC1A;
+            samples = {{0, 64, 0, 0xFFFFFFFF}};
+            return true;
+        case Format::BC1RgbaUnorm:
+        case Format::BC1RgbaSrgb:
+            model = dfdModelBC1A;
+            samples = {{0, 64, 1, 0xFFFFFFFF}};
+            return true;
+        case Format::BC2Unorm:
+        case Format::BC2Srgb:
+            model = dfdModelBC2;
+            samples = {{0, 64, 15, 0xFFFFFFFF}, {64, 64, 0, 0xFFFFFFFF}};
+            return true;
+        case Format::BC3Unorm:
+        case Format::BC3Srgb:
+            model = dfdModelBC3;
+            samples = {{0, 64, 15, 0xFFFFFFFF}, {64, 64, 0, 0xFFFFFFFF}};
+            return true;
+        case Format::BC4Unorm:
+            model = dfdModelBC4;
+            samples = {{0, 64, 0, 0xFFFFFFFF}};
+            return true;
+        case Format::BC5Unorm:
+            model = dfdModelBC5;
+            samples = {{0, 64, 0, 0xFFFFFFFF}, {64, 64, 1, 0xFFFFFFFF}};
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool readKeyValues(const uint8_t* data, size_t size, std::vector<std::pair<std::string, std::string>>& keyValues) {
+    size_t offset = 0;
+
+    while (offset + 4 <= size) {
+        const uint32_t length = readU32(data + offset);
+        offset += 4;
+
+        if (length > size - offset) {
+            return false;
+        }
+
+        const char* entry = reinterpret_cast<const char*>(data + offset);
+        const char* keyEnd = static_cast<const char*>(std::memchr(entry, '\0', length));
+        if (!keyEnd) {
+            return false;
+        }
+
+        const size_t keyLength = keyEnd - entry;
+        size_t valueLength = length - keyLength - 1;
+
+        // The values which are strings are usually terminated by a NUL
+        if (valueLength > 0 && keyEnd[valueLength] == '\0') {
+            --valueLength;
+        }
+
+        keyValues.emplace_back(std::string(entry, keyLength), std::string(keyEnd + 1, valueLength));
+
+        offset = align(offset + length, 4);
+    }
+
+    return true;
+}
+
+} // anonymous
+
+bool getFormatInfo(Format format, FormatInfo& info) {
+    const uint32_t value = static_cast<uint32_t>(format);
+
+    switch (format) {
+        case Format::R8G8B8A8Unorm:
+        case Format::R8G8B8A8Srgb:
+            info = {1, 1, 4, format == Format::R8G8B8A8Srgb};
+            return true;
+        case Format::R16G16Sfloat:
+            info = {1, 1, 4, false};
+            return true;
+        case Format::R16G16B16A16Sfloat:
+            info = {1, 1, 8, false};
+            return true;
+        case Format::BC1RgbUnorm:
+        case Format::BC1RgbaUnorm:
+        case Format::BC4Unorm:
+        case Format::BC4Snorm:
+            info = {4, 4, 8, false};
+            return true;
+        case Format::BC1RgbSrgb:
+        case Format::BC1RgbaSrgb:
+            info = {4, 4, 8, true};
+            return true;
+        case Format::BC2Unorm:
+        case Format::BC3Unorm:
+        case Format::BC5Unorm:
+        case Format::BC5Snorm:
+        case Format::BC6HUfloat:
+        case Format::BC6HSfloat:
+        case Format::BC7Unorm:
+            info = {4, 4, 16, false};
+            return true;
+        case Format::BC2Srgb:
+        case Format::BC3Srgb:
+        case Format::BC7Srgb:
+            info = {4, 4, 16, true};
+            return true;
+        default:
+            break;
+    }
+
+    // ETC2 RGB8, RGB8A1 and RGBA8 (unorm and srgb), then EAC R11 and RG11 (unorm and snorm)
+    if (value >= 147 && value <= 156) {
+        static constexpr uint32_t blockSizes[10] = {8, 8, 8, 8, 16, 16, 8, 8, 16, 16};
+
+        info = {4, 4, blockSizes[value - 147], value <= 152 && (value - 147) % 2 == 1};
+        return true;
+    }
+
+    // ASTC, an unorm and an srgb format per block size
+    if (value >= static_cast<uint32_t>(Format::ASTC4x4Unorm) && value <= static_cast<uint32_t>(Format::ASTC12x12Srgb)) {
+        static constexpr uint8_t blockSizes[14][2] = {
+            {4, 4}, {5, 4}, {5, 5}, {6, 5}, {6, 6}, {8, 5}, {8, 6},
+            {8, 8}, {10, 5}, {10, 6}, {10, 8}, {10, 10}, {12, 10}, {12, 12}
+        };
+
+        const uint32_t index = value - static_cast<uint32_t>(Format::ASTC4x4Unorm);
+
+        info = {blockSizes[index / 2][0], blockSizes[index / 2][1], 16, index % 2 == 1};
+        return true;
+    }
+
+    return false;
+}
+
+bool getDecodedFormat(Format format, BlockCompression::Format& blockFormat, Format& decodedFormat) {
+    switch (format) {
+        case Format::BC1RgbUnorm:
+        case Format::BC1RgbaUnorm:
+        case Format::BC1RgbSrgb:
+        case Format::BC1RgbaSrgb:
+            blockFormat = BlockCompression::Format::BC1;
+            break;
+        case Format::BC2Unorm:
+        case Format::BC2Srgb:
+            blockFormat = BlockCompression::Format::BC2;
+            break;
+        case Format::BC3Unorm:
+        case Format::BC3Srgb:
+            blockFormat = BlockCompression::Format::BC3;
+            break;
+        case Format::BC4Unorm:
+            blockFormat = BlockCompression::Format::BC4;
+            break;
+        case Format::BC5Unorm:
+            blockFormat = BlockCompression::Format::BC5;
+            break;
+        default:
+            return false;
+    }
+
+    FormatInfo info;
+    getFormatInfo(format, info);
+
+    decodedFormat = info.srgb ? Format::R8G8B8A8Srgb : Format::R8G8B8A8Unorm;
+    return true;
+}
+
+Format getSrgbFormat(Format format) {
+    FormatInfo info;
+
+    if (!getFormatInfo(format, info) || info.srgb) {
+        return format;
+    }
+
+    switch (format) {
+        case Format::R8G8B8A8Unorm:
+            return Format::R8G8B8A8Srgb;
+        case Format::BC1RgbUnorm:
+        case Format::BC1RgbaUnorm:
+        case Format::BC2Unorm:
+        case Format::BC3Unorm:
+        case Format::BC7Unorm:
+            break;
+        default: {
+            // The ETC2 and ASTC formats are followed by their sRGB variant, the EAC ones have none
+            const uint32_t value = static_cast<uint32_t>(format);
+
+            if ((value < static_cast<uint32_t>(Format::ETC2R8G8B8Unorm) || value > 152) && value < static_cast<uint32_t>(Format::ASTC4x4Unorm)) {
+                return format;
+            }
+        }
+    }
+
+    return static_cast<Format>(static_cast<uint32_t>(format) + 1);
+}
+
+size_t getImageSize(const FormatInfo& info, uint32_t width, uint32_t height) {
+    const size_t blocksX = (width + info.blockWidth - 1) / info.blockWidth;
+    const size_t blocksY = (height + info.blockHeight - 1) / info.blockHeight;
+
+    return blocksX * blocksY * info.blockSize;
+}
+
+Result read(const uint8_t* data, size_t size, Image& image) {
+    if (size < sizeof(identifier) || std::memcmp(data, identifier, sizeof(identifier)) != 0) {
+        return Result::InvalidIdentifier;
+    }
+
+    if (size < headerSize) {
+        return Result::Truncated;
+    }
+
+    image.format = static_cast<Format>(readU32(data + 12));
+    image.width = readU32(data + 20);
+    image.height = readU32(data + 24);
+    image.layersCount = std::max(readU32(data + 32), 1u);
+    image.facesCount = readU32(data + 36);
+    image.supercompressionScheme = static_cast<SupercompressionScheme>(readU32(data + 44));
+
+    const uint32_t depth = readU32(data + 28);
+    const uint32_t levelsCount = readU32(data + 40);
+    const uint32_t kvdOffset = readU32(data + 56);
+    const uint32_t kvdLength = readU32(data + 60);
+
+    if (image.height == 0 || depth != 0) {
+        return Result::UnsupportedDimensions;
+    }
+
+    if (image.width == 0 || (image.facesCount != 1 && image.facesCount != 6) || levelsCount > Mipmap::getLevelsCount(image.width, image.height)) {
+        return Result::InvalidHeader;
+    }
+
+    // A levels count of 0 asks the loader to generate the mipmaps from the first level
+    image.generateMipmaps = levelsCount == 0;
+
+    const uint32_t levelsInFile = std::max(levelsCount, 1u);
+    if (!isInside(headerSize, levelsInFile * levelIndexEntrySize, size)) {
+        return Result::Truncated;
+    }
+
+    FormatInfo info;
+    const bool checkSizes = image.supercompressionScheme == SupercompressionScheme::None && getFormatInfo(image.format, info);
+
+    image.levels.resize(levelsInFile);
+    for (uint32_t i = 0; i < levelsInFile; ++i) {
+        const uint8_t* entry = data + headerSize + i * levelIndexEntrySize;
+
+        const uint64_t offset = readU64(entry);
+        const uint64_t length = readU64(entry + 8);
+        const uint64_t uncompressedLength = readU64(entry + 16);
+
+        if (!isInside(offset, length, size)) {
+            return Result::Truncated;
+        }
+
+        if (checkSizes) {
+            const size_t expectedSize = getImageSize(info, std::max(image.width >> i, 1u), std::max(image.height >> i, 1u)) * image.layersCount * image.facesCount;
+
+            if (length != expectedSize) {
+                return Result::InvalidHeader;
+            }
+        }
+
+        image.levels[i] = {static_cast<size_t>(offset), static_cast<size_t>(length), static_cast<size_t>(uncompressedLength)};
+    }
+
+    image.keyValues.clear();
+    if (kvdLength > 0) {
+        if (!isInside(kvdOffset, kvdLength, size)) {
+            return Result::Truncated;
+        }
+
+        if (!readKeyValues(data + kvdOffset, kvdLength, image.keyValues)) {
+            return Result::InvalidHeader;
+        }
+    }
+
+    return Result::Success;
+}
+
+bool write(Format format, uint32_t width, uint32_t height, uint32_t facesCount, const std::vector<std::vector<uint8_t>>& levels, std::vector<uint8_t>& file) {
+    uint8_t model;
+    std::vector<DfdSample> samples;
+    FormatInfo info;
+
+    if (!getDfdSamples(format, model, samples) || !getFormatInfo(format, info)) {
+        return false;
+    }
+
+    if (width == 0 || height == 0 || (facesCount != 1 && facesCount != 6) || levels.empty() || levels.size() > Mipmap::getLevelsCount(width, height)) {
+        return false;
+    }
+
+    // The faces of a cube map are square
+    if (facesCount == 6 && width != height) {
+        return false;
+    }
+
+    for (size_t i = 0; i < levels.size(); ++i) {
+        if (levels[i].size() != getImageSize(info, std::max(width >> i, 1u), std::max(height >> i, 1u)) * facesCount) {
+            return false;
+        }
+    }
+
+    const uint32_t levelsCount = static_cast<uint32_t>(levels.size());
+
+    file.assign(headerSize + levelsCount * levelIndexEntrySize, 0);
+
+    // Data format descriptor
+    const size_t dfdOffset = file.size();
+    {
+        const uint32_t blockSize = dfdBlockHeaderSize + dfdSampleSize * static_cast<uint32_t>(samples.size());
+
+        appendU32(file, 4 + blockSize);
+        appendU32(file, 0); // Khronos vendor, basic descriptor type
+        appendU32(file, dfdVersion | (blockSize << 16));
+        appendU32(file, model | (dfdPrimariesBT709 << 8) | ((info.srgb ? dfdTransferSRGB : dfdTransferLinear) << 16));
+        appendU32(file, (info.blockWidth - 1) | ((info.blockHeight - 1) << 8));
+        appendU32(file, info.blockSize);
+        appendU32(file, 0);
+
+        for (const auto& sample : samples) {
+            appendU32(file, sample.bitOffset | ((sample.bitLength - 1) << 16) | (static_cast<uint32_t>(sample.channel) << 24));
+            appendU32(file, 0);
+            appendU32(file, sample.lower);
+            appendU32(file, sample.upper);
+        }
+    }
+    const size_t dfdLength = file.size() - dfdOffset;
+
+    // Key/value data
+    const size_t kvdOffset = file.size();
+    {
+        static constexpr char key[] = "KTXwriter";
+        static constexpr char value[] = "Lugdunum";
+
+        appendU32(file, sizeof(key) + sizeof(value));
+        file.insert(file.end(), key, key + sizeof(key));
+        file.insert(file.end(), value, value + sizeof(value));
+        file.resize(align(file.size(), 4), 0);
+    }
+    const size_t kvdLength = file.size() - kvdOffset;
+
+    // The levels are stored from the smallest to the largest
+    const size_t levelAlignment = info.blockSize % 4 == 0 ? info.blockSize : info.blockSize * 4;
+
+    for (uint32_t i = levelsCount; i-- > 0;) {
+        file.resize(align(file.size(), levelAlignment), 0);
+
+        const size_t offset = file.size();
+        file.insert(file.end(), levels[i].begin(), levels[i].end());
+
+        writeU64(file, headerSize + i * levelIndexEntrySize, offset);
+        writeU64(file, headerSize + i * levelIndexEntrySize + 8, levels[i].size());
+        writeU64(file, headerSize + i * levelIndexEntrySize + 16, levels[i].size());
+    }
+
+    std::memcpy(file.data(), identifier, sizeof(identifier));
+    writeU32(file, 12, static_cast<uint32_t>(format));
+    writeU32(file, 16, format == Format::R16G16Sfloat || format == Format::R16G16B16A16Sfloat ? 2 : 1); // Type size, for the endianness
+    writeU32(file, 20, width);
+    writeU32(file, 24, height);
+    writeU32(file, 28, 0);
+    writeU32(file, 32, 0);
+    writeU32(file, 36, facesCount);
+    writeU32(file, 40, levelsCount);
+    writeU32(file, 44, static_cast<uint32_t>(SupercompressionScheme::None));
+    writeU32(file, 48, static_cast<uint32_t>(dfdOffset));
+    writeU32(file, 52, static_cast<uint32_t>(dfdLength));
+    writeU32(file, 56, static_cast<uint32_t>(kvdOffset));
+    writeU32(file, 60, static_cast<uint32_t>(kvdLength));
+    writeU64(file, 64, 0);
+    writeU64(file, 72, 0);
+
+    return true;
+}
+
+bool write(Format format, uint32_t width, uint32_t height, const std::vector<std::vector<uint8_t>>& levels, std::vector<uint8_t>& file) {
+    return write(format, width, height, 1, levels, file);
+}
+
+const char* toString(Result result) {
+    switch (result) {
+        case Result::Success:
+            return "Success";
+        case Result::InvalidIdentifier:
+            return "Invalid identifier";
+        case Result::Truncated:
+            return "Truncated file";
+        case Result::InvalidHeader:
+            return "Invalid header";
+        case Result::UnsupportedDimensions:
+            return "Unsupported dimensions";
+    }
+
+    return "Unknown";
+}
+
+} // Ktx2
+} // Render
+} // Graphics
+} // lug
@@ -1,5 +1,11 @@
 #include <lug/Graphics/Render/Mesh.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <lug/Math/Packing.hpp>
+
 namespace lug {
 namespace Graphics {
 namespace Render {
@@ -15,6 +21,57 @@ Mesh::~Mesh() {
     }
 }
 
+static Math::Vec3f getPosition(const Mesh::PrimitiveSet::Attribute& attribute, uint32_t idx) {
+    if (attribute.format == Mesh::PrimitiveSet::Attribute::Format::Half) {
+        const uint16_t* halves = reinterpret_cast<const uint16_t*>(attribute.buffer.data) + idx * 4;
+        return {Math::Packing::unpackHalf(halves[0]), Math::Packing::unpackHalf(halves[1]), Math::Packing::unpackHalf(halves[2])};
+    }
+
+    return reinterpret_cast<const Math::Vec3f*>(attribute.buffer.data)[idx];
+}
+
+void Mesh::computeBoundingSphere() {
+    Math::Vec3f min(std::numeric_limits<float>::max());
+    Math::Vec3f max(std::numeric_limits<float>::lowest());
+    bool empty = true;
+
+    for (const auto& primitiveSet : _primitiveSets) {
+        if (!primitiveSet.position) {
+            continue;
+        }
+
+        for (uint32_t i = 0; i < primitiveSet.position->buffer.elementsCount; ++i) {
+            const Math::Vec3f position = getPosition(*primitiveSet.position, i);
+
+            for (uint8_t axis = 0; axis < 3; ++axis) {
+                min(axis) = std::min(min(axis), position(axis));
+                max(axis) = std::max(max(axis), position(axis));
+            }
+
+            empty = false;
+        }
+    }
+
+    if (empty) {
+        _boundingCenter = Math::Vec3f(0.0f);
+        _boundingRadius = 0.0f;
+        return;
+    }
+
+    _boundingCenter = (min + max) / 2.0f;
+    _boundingRadius = 0.0f;
+
+    for (const auto& primitiveSet : _primitiveSets) {
+        if (!primitiveSet.position) {
+            continue;
+        }
+
+        for (uint32_t i = 0; i < primitiveSet.position->buffer.elementsCount; ++i) {
+            _boundingRadius = std::max(_boundingRadius, Math::Vec3f(getPosition(*primitiveSet.position, i) - _boundingCenter).length());
+        }
+    }
+}
+
 } // Render
 } // Graphics
 } // lug
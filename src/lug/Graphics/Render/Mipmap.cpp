@@ -0,0 +1,260 @@
+#include <lug/Graphics/Render/Mipmap.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define LUG_MIPMAP_SSE2
+    #include <emmintrin.h>
+#endif
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+namespace Mipmap {
+
+namespace {
+
+// Half width of the Kaiser filter, in pixels of the destination
+constexpr float kaiserRadius = 2.0f;
+constexpr float kaiserBeta = 4.0f;
+
+// Zeroth order modified Bessel function of the first kind
+float besselI0(float x) {
+    float sum = 1.0f;
+    float term = 1.0f;
+    const float halfX = x * 0.5f;
+
+    for (uint32_t k = 1; k < 32; ++k) {
+        term *= halfX / static_cast<float>(k);
+        sum += term * term;
+
+        if (term * term < sum * 1e-8f) {
+            break;
+        }
+    }
+
+    return sum;
+}
+
+float kaiser(float x) {
+    const float t = x / kaiserRadius;
+    if (t <= -1.0f || t >= 1.0f) {
+        return 0.0f;
+    }
+
+    return besselI0(kaiserBeta * std::sqrt(1.0f - t * t)) / besselI0(kaiserBeta);
+}
+
+float sinc(float x) {
+    if (std::fabs(x) < 1e-5f) {
+        return 1.0f;
+    }
+
+    const float piX = 3.14159265358979323846f * x;
+    return std::sin(piX) / piX;
+}
+
+// Normalized weights of the source pixels contributing to each destination pixel of one dimension
+struct Taps {
+    std::vector<uint32_t> offsets;  // First tap of each destination pixel, with a last one to get the count
+    std::vector<uint32_t> indices;
+    std::vector<float> weights;
+};
+
+Taps computeKaiserTaps(uint32_t srcSize, uint32_t dstSize) {
+    Taps taps;
+    taps.offsets.reserve(dstSize + 1);
+
+    const float scale = static_cast<float>(srcSize) / static_cast<float>(dstSize);
+    const float support = kaiserRadius * scale;
+
+    for (uint32_t i = 0; i < dstSize; ++i) {
+        taps.offsets.push_back(static_cast<uint32_t>(taps.indices.size()));
+
+        const float center = (static_cast<float>(i) + 0.5f) * scale;
+        const int32_t first = static_cast<int32_t>(std::floor(center - support));
+        const int32_t last = static_cast<int32_t>(std::ceil(center + support));
+
+        const size_t firstTap = taps.weights.size();
+        float total = 0.0f;
+
+        for (int32_t j = first; j <= last; ++j) {
+            const float x = (static_cast<float>(j) + 0.5f - center) / scale;
+            const float weight = sinc(x) * kaiser(x);
+            if (weight == 0.0f) {
+                continue;
+            }
+
+            // Clamp to edge
+            const int32_t index = std::min(std::max(j, 0), static_cast<int32_t>(srcSize) - 1);
+
+            taps.indices.push_back(static_cast<uint32_t>(index));
+            taps.weights.push_back(weight);
+            total += weight;
+        }
+
+        for (size_t j = firstTap; j < taps.weights.size(); ++j) {
+            taps.weights[j] /= total;
+        }
+    }
+
+    taps.offsets.push_back(static_cast<uint32_t>(taps.indices.size()));
+
+    return taps;
+}
+
+void downsampleKaiser(const uint8_t* src, uint32_t srcWidth, uint32_t srcHeight, uint8_t* dst, uint32_t dstWidth, uint32_t dstHeight) {
+    const Taps horizontalTaps = computeKaiserTaps(srcWidth, dstWidth);
+    const Taps verticalTaps = computeKaiserTaps(srcHeight, dstHeight);
+
+    // Horizontal pass, for each source row
+    std::vector<float> horizontal(static_cast<size_t>(dstWidth) * srcHeight * 4);
+
+    for (uint32_t y = 0; y < srcHeight; ++y) {
+        const uint8_t* srcRow = src + static_cast<size_t>(y) * srcWidth * 4;
+        float* row = horizontal.data() + static_cast<size_t>(y) * dstWidth * 4;
+
+        for (uint32_t x = 0; x < dstWidth; ++x) {
+            float sum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+
+            for (uint32_t tap = horizontalTaps.offsets[x]; tap < horizontalTaps.offsets[x + 1]; ++tap) {
+                const uint8_t* pixel = srcRow + horizontalTaps.indices[tap] * 4;
+                const float weight = horizontalTaps.weights[tap];
+
+                for (uint32_t c = 0; c < 4; ++c) {
+                    sum[c] += pixel[c] * weight;
+                }
+            }
+
+            std::copy(sum, sum + 4, row + x * 4);
+        }
+    }
+
+    // Vertical pass
+    for (uint32_t y = 0; y < dstHeight; ++y) {
+        uint8_t* dstRow = dst + static_cast<size_t>(y) * dstWidth * 4;
+
+        for (uint32_t x = 0; x < dstWidth * 4; ++x) {
+            float sum = 0.0f;
+
+            for (uint32_t tap = verticalTaps.offsets[y]; tap < verticalTaps.offsets[y + 1]; ++tap) {
+                sum += horizontal[static_cast<size_t>(verticalTaps.indices[tap]) * dstWidth * 4 + x] * verticalTaps.weights[tap];
+            }
+
+            // The negative lobes of the filter can overshoot
+            dstRow[x] = static_cast<uint8_t>(std::min(std::max(sum + 0.5f, 0.0f), 255.0f));
+        }
+    }
+}
+
+void downsampleBox(const uint8_t* src, uint32_t srcWidth, uint32_t srcHeight, uint8_t* dst, uint32_t dstWidth, uint32_t dstHeight) {
+    for (uint32_t y = 0; y < dstHeight; ++y) {
+        const uint8_t* row0 = src + static_cast<size_t>(y * 2) * srcWidth * 4;
+        const uint8_t* row1 = src + static_cast<size_t>(std::min(y * 2 + 1, srcHeight - 1)) * srcWidth * 4;
+        uint8_t* dstRow = dst + static_cast<size_t>(y) * dstWidth * 4;
+
+        uint32_t x = 0;
+
+#if defined(LUG_MIPMAP_SSE2)
+        // 4 destination pixels from 8 pixels of each source row, the 2 source columns always exist when srcWidth >= 2
+        if (srcWidth >= 2) {
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i rounding = _mm_set1_epi16(2);
+
+            // Sums of the 2 pixels of each half of a vector of 4 pixels of 16-bit channels
+            const auto sumPairs = [&zero](__m128i top, __m128i bottom) {
+                const __m128i low = _mm_add_epi16(_mm_unpacklo_epi8(top, zero), _mm_unpacklo_epi8(bottom, zero));
+                const __m128i high = _mm_add_epi16(_mm_unpackhi_epi8(top, zero), _mm_unpackhi_epi8(bottom, zero));
+
+                return _mm_unpacklo_epi64(
+                    _mm_add_epi16(low, _mm_srli_si128(low, 8)),
+                    _mm_add_epi16(high, _mm_srli_si128(high, 8))
+                );
+            };
+
+            for (; x + 4 <= dstWidth; x += 4) {
+                const __m128i top0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + x * 8));
+                const __m128i top1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + x * 8 + 16));
+                const __m128i bottom0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + x * 8));
+                const __m128i bottom1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + x * 8 + 16));
+
+                const __m128i sum0 = _mm_srli_epi16(_mm_add_epi16(sumPairs(top0, bottom0), rounding), 2);
+                const __m128i sum1 = _mm_srli_epi16(_mm_add_epi16(sumPairs(top1, bottom1), rounding), 2);
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dstRow + x * 4), _mm_packus_epi16(sum0, sum1));
+            }
+        }
+#endif
+
+        for (; x < dstWidth; ++x) {
+            const uint32_t x0 = x * 2;
+            const uint32_t x1 = std::min(x * 2 + 1, srcWidth - 1);
+
+            for (uint32_t c = 0; c < 4; ++c) {
+                const uint32_t sum = row0[x0 * 4 + c] + row0[x1 * 4 + c] + row1[x0 * 4 + c] + row1[x1 * 4 + c];
+                dstRow[x * 4 + c] = static_cast<uint8_t>((sum + 2) >> 2);
+            }
+        }
+    }
+}
+
+} // anonymous
+
+uint32_t getLevelsCount(uint32_t width, uint32_t height) {
+    uint32_t size = std::max(width, height);
+    uint32_t levelsCount = 1;
+
+    while (size > 1) {
+        size >>= 1;
+        ++levelsCount;
+    }
+
+    return levelsCount;
+}
+
+std::vector<Level> getLevels(uint32_t width, uint32_t height, uint32_t levelsCount) {
+    const uint32_t maxLevelsCount = getLevelsCount(width, height);
+    if (!levelsCount || levelsCount > maxLevelsCount) {
+        levelsCount = maxLevelsCount;
+    }
+
+    std::vector<Level> levels(levelsCount);
+    size_t offset = 0;
+
+    for (uint32_t i = 0; i < levelsCount; ++i) {
+        levels[i].width = std::max(width >> i, 1u);
+        levels[i].height = std::max(height >> i, 1u);
+        levels[i].offset = offset;
+        levels[i].size = static_cast<size_t>(levels[i].width) * levels[i].height * 4;
+
+        offset += levels[i].size;
+    }
+
+    return levels;
+}
+
+void downsample(const uint8_t* src, uint32_t srcWidth, uint32_t srcHeight, uint8_t* dst, Filter filter) {
+    const uint32_t dstWidth = std::max(srcWidth / 2, 1u);
+    const uint32_t dstHeight = std::max(srcHeight / 2, 1u);
+
+    switch (filter) {
+        case Filter::Box:
+            downsampleBox(src, srcWidth, srcHeight, dst, dstWidth, dstHeight);
+            break;
+        case Filter::Kaiser:
+            downsampleKaiser(src, srcWidth, srcHeight, dst, dstWidth, dstHeight);
+            break;
+    }
+}
+
+void generate(uint8_t* chain, const std::vector<Level>& levels, Filter filter) {
+    for (size_t i = 1; i < levels.size(); ++i) {
+        downsample(chain + levels[i - 1].offset, levels[i - 1].width, levels[i - 1].height, chain + levels[i].offset, filter);
+    }
+}
+
+} // Mipmap
+} // Render
+} // Graphics
+} // lug
@@ -0,0 +1,82 @@
+#include <lug/Graphics/Render/RingAllocator.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+
+RingAllocator::RingAllocator(size_t size, size_t alignment) : _size(size), _alignment(alignment) {}
+
+bool RingAllocator::allocate(size_t size, size_t& offset) {
+    if (size > _size || !_size) {
+        return false;
+    }
+
+    if (_usedSize == 0) {
+        // Start again from the beginning to have the largest contiguous space
+        _head = 0;
+    } else if (_usedSize >= _size) {
+        return false;
+    }
+
+    // The used space goes from the tail to the head, wrapping around the end of the ring
+    const size_t tail = (_head + _size - _usedSize) % _size;
+    const size_t alignedHead = (_head + _alignment - 1) & ~(_alignment - 1);
+
+    size_t allocatedSize;
+
+    if (_usedSize == 0 || _head > tail) {
+        if (alignedHead + size <= _size) {
+            offset = alignedHead;
+            allocatedSize = alignedHead - _head + size;
+        } else if (size <= tail) {
+            // Skip the end of the ring
+            offset = 0;
+            allocatedSize = _size - _head + size;
+        } else {
+            return false;
+        }
+    } else {
+        if (alignedHead + size > tail) {
+            return false;
+        }
+
+        offset = alignedHead;
+        allocatedSize = alignedHead - _head + size;
+    }
+
+    _usedSize += allocatedSize;
+    _frameUsedSize += allocatedSize;
+    _head = (offset + size) % _size;
+
+    return true;
+}
+
+void RingAllocator::endFrame(uint32_t frameIndex) {
+    _frames.push_back({frameIndex, _frameUsedSize, false});
+    _frameUsedSize = 0;
+}
+
+void RingAllocator::releaseFrame(uint32_t frameIndex) {
+    for (auto& frame : _frames) {
+        if (frame.index == frameIndex) {
+            frame.released = true;
+        }
+    }
+
+    while (!_frames.empty() && _frames.front().released) {
+        _usedSize -= _frames.front().usedSize;
+        _frames.pop_front();
+    }
+}
+
+size_t RingAllocator::getSize() const {
+    return _size;
+}
+
+size_t RingAllocator::getUsedSize() const {
+    return _usedSize;
+}
+
+} // Render
+} // Graphics
+} // lug
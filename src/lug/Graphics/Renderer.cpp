@@ -5,5 +5,7 @@ namespace Graphics {
 
 Renderer::Renderer(Graphics& graphics, Renderer::Type type) : _graphics{graphics}, _type{type} {}
 
+void Renderer::onResourceRemoved(const Resource&) {}
+
 } // Graphics
 } // lug
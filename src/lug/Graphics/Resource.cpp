@@ -1,5 +1,7 @@
 #include <lug/Graphics/Resource.hpp>
 
+#include <lug/Graphics/ResourceManager.hpp>
+
 namespace lug {
 namespace Graphics {
 
@@ -9,5 +11,13 @@ Resource::Resource(Resource::Type type, const std::string& name) {
     _name = name;
 }
 
+void Resource::setName(const std::string &name) {
+    if (_manager) {
+        _manager->rename(*this, name);
+    }
+
+    _name = name;
+}
+
 } // Graphics
 } // lug
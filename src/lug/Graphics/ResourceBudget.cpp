@@ -0,0 +1,130 @@
+#include <lug/Graphics/ResourceBudget.hpp>
+
+namespace lug {
+namespace Graphics {
+
+ResourceBudget::Stats ResourceBudget::getStats() const {
+    Stats stats{
+        /* stats.budget */ _budget,
+        /* stats.usage */ _usage,
+        /* stats.residentCount */ static_cast<uint32_t>(_lru.size()),
+        /* stats.evictedCount */ static_cast<uint32_t>(_entries.size() - _lru.size()),
+        /* stats.evictions */ _evictions,
+        /* stats.reloads */ _reloads
+    };
+
+    return stats;
+}
+
+bool ResourceBudget::track(Resource::Handle handle) {
+    if (!_provider) {
+        return false;
+    }
+
+    auto it = _entries.find(handle.value);
+    if (it != _entries.end()) {
+        return true;
+    }
+
+    Entry& entry = _entries[handle.value];
+
+    entry.size = _provider->getResourceSize(handle);
+    entry.lastUsedFrame = _frame;
+    entry.resident = true;
+    entry.lruIt = _lru.insert(_lru.begin(), handle.value);
+
+    _usage += entry.size;
+
+    return true;
+}
+
+void ResourceBudget::untrack(Resource::Handle handle) {
+    auto it = _entries.find(handle.value);
+    if (it == _entries.end()) {
+        return;
+    }
+
+    if (it->second.resident) {
+        _usage -= it->second.size;
+        _lru.erase(it->second.lruIt);
+    }
+
+    _entries.erase(it);
+}
+
+bool ResourceBudget::use(Resource::Handle handle) {
+    auto it = _entries.find(handle.value);
+    if (it == _entries.end()) {
+        return !_provider || track(handle);
+    }
+
+    Entry& entry = it->second;
+    entry.lastUsedFrame = _frame;
+
+    if (entry.resident) {
+        // Move to the front of the LRU list
+        _lru.splice(_lru.begin(), _lru, entry.lruIt);
+        return true;
+    }
+
+    if (!_provider || !_provider->reloadResource(handle)) {
+        return false;
+    }
+
+    ++_reloads;
+
+    // The size can change between two loads (e.g. the file has been modified)
+    entry.size = _provider->getResourceSize(handle);
+    entry.resident = true;
+    entry.lruIt = _lru.insert(_lru.begin(), handle.value);
+
+    _usage += entry.size;
+
+    return true;
+}
+
+bool ResourceBudget::nextFrame() {
+    const bool result = enforce();
+
+    ++_frame;
+
+    return result;
+}
+
+bool ResourceBudget::enforce() {
+    if (!_budget || !_provider) {
+        return true;
+    }
+
+    // The LRU list is sorted by last use, so we can stop at the first resource that is still in use
+    size_t candidates = _lru.size();
+    while (_usage > _budget && candidates--) {
+        const uint32_t value = _lru.back();
+        Entry& entry = _entries[value];
+
+        if (entry.lastUsedFrame + _evictionDelay > _frame) {
+            break;
+        }
+
+        Resource::Handle handle;
+        handle.value = value;
+
+        if (!_provider->evictResource(handle)) {
+            // Don't try to evict it again until it is used
+            entry.lastUsedFrame = _frame;
+            _lru.splice(_lru.begin(), _lru, entry.lruIt);
+            continue;
+        }
+
+        ++_evictions;
+
+        _usage -= entry.size;
+        entry.resident = false;
+        _lru.pop_back();
+    }
+
+    return _usage <= _budget;
+}
+
+} // Graphics
+} // lug
@@ -1,5 +1,8 @@
 #include <lug/Graphics/ResourceManager.hpp>
 
+#include <algorithm>
+#include <thread>
+
 #include <lug/Graphics/GltfLoader.hpp>
 #include <lug/Graphics/Renderer.hpp>
 #include <lug/System/Logger/Logger.hpp>
@@ -15,6 +18,217 @@ ResourceManager::ResourceManager(Renderer& renderer) : _renderer(renderer) {
 }
 
 Resource::SharedPtr<Resource> ResourceManager::loadFile(const std::string& filename) {
+    Loader* loader = getLoader(filename);
+    if (!loader) {
+        return nullptr;
+    }
+
+    Resource::SharedPtr<Resource> resource = loader->loadFile(filename);
+    if (resource) {
+        addFile(filename, resource->getHandle());
+    }
+
+    return resource;
+}
+
+std::shared_ptr<AsyncLoader::Ticket> ResourceManager::loadFileAsync(const std::string& filename, int32_t priority) {
+    Loader* loader = getLoader(filename);
+    if (!loader) {
+        return nullptr;
+    }
+
+    // Shared between the two stages of the load
+    std::shared_ptr<std::unique_ptr<Loader::Data>> data = std::make_shared<std::unique_ptr<Loader::Data>>();
+
+    AsyncLoader::Task task{
+        /* task.read */ [loader, filename, data](AsyncLoader::Ticket&) {
+            *data = loader->read(filename);
+            return *data != nullptr;
+        },
+        /* task.build */ [this, loader, filename, data](AsyncLoader::Ticket&) {
+            Resource::SharedPtr<Resource> resource = loader->build(filename, **data);
+            data->reset();
+
+            if (resource) {
+                addFile(filename, resource->getHandle());
+            }
+
+            return resource;
+        }
+    };
+
+    return getAsyncLoader().enqueue(filename, priority, std::move(task));
+}
+
+std::shared_ptr<AsyncLoader::Ticket> ResourceManager::reloadFileAsync(const std::string& filename, std::shared_ptr<std::vector<Resource::Handle>> createdHandles) {
+    Loader* loader = getLoader(filename);
+    if (!loader) {
+        return nullptr;
+    }
+
+    // Shared between the two stages of the load
+    std::shared_ptr<std::unique_ptr<Loader::Data>> data = std::make_shared<std::unique_ptr<Loader::Data>>();
+
+    AsyncLoader::Task task{
+        /* task.read */ [loader, filename, data](AsyncLoader::Ticket&) {
+            *data = loader->read(filename);
+            return *data != nullptr;
+        },
+        /* task.build */ [this, loader, filename, data, createdHandles](AsyncLoader::Ticket&) {
+            // The resources are only added by the main thread, the ones of the load follow the existing ones
+            const size_t firstIndex = _resources.size();
+
+            Resource::SharedPtr<Resource> resource = loader->build(filename, **data);
+            data->reset();
+
+            for (size_t i = firstIndex; i < _resources.size(); ++i) {
+                createdHandles->push_back(_resources[i]->getHandle());
+            }
+
+            return resource;
+        }
+    };
+
+    return getAsyncLoader().enqueue(filename, 0, std::move(task));
+}
+
+void ResourceManager::remove(Resource::Handle handle) {
+    Resource::SharedPtr<Resource> resource = get<Resource>(handle);
+    if (!resource) {
+        return;
+    }
+
+    _budget.untrack(handle);
+    _textureStreamer.untrack(handle);
+    _renderer.onResourceRemoved(*resource);
+
+    removeName(resource->getName(), handle);
+
+    for (auto it = _resourcesByFilename.begin(); it != _resourcesByFilename.end();) {
+        if (it->second == handle) {
+            it = _resourcesByFilename.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    for (auto& watchingResources : _watchingResources) {
+        std::vector<Resource::Handle>& handles = watchingResources.second;
+        handles.erase(std::remove(handles.begin(), handles.end(), handle), handles.end());
+    }
+
+    // The slot stays empty, the index of the other resources must not change
+    _resources[handle.index].reset();
+}
+
+Resource::SharedPtr<Resource> ResourceManager::getFile(const std::string& filename) {
+    const auto it = _resourcesByFilename.find(filename);
+    if (it == _resourcesByFilename.end()) {
+        return nullptr;
+    }
+
+    return get<Resource>(it->second);
+}
+
+uint32_t ResourceManager::integrateLoads(uint32_t maxLoads) {
+    if (!_asyncLoader) {
+        return 0;
+    }
+
+    return _asyncLoader->integrate(maxLoads);
+}
+
+AsyncLoader& ResourceManager::getAsyncLoader() {
+    if (!_asyncLoader) {
+        // Keep a thread for the main loop
+        const uint32_t threadsCount = std::max(1u, std::thread::hardware_concurrency() / 2);
+        _asyncLoader = std::make_unique<AsyncLoader>(threadsCount);
+    }
+
+    return *_asyncLoader;
+}
+
+bool ResourceManager::enableHotReload() {
+    if (_fileWatcher) {
+        return true;
+    }
+
+    std::unique_ptr<System::FileWatcher> fileWatcher = std::make_unique<System::FileWatcher>();
+    if (!fileWatcher->init()) {
+        LUG_LOG.warn("ResourceManager: Hot reload is not supported on this system");
+        return false;
+    }
+
+    _fileWatcher = std::move(fileWatcher);
+
+    return true;
+}
+
+void ResourceManager::watchFile(const std::string& filename, Resource::Handle handle) {
+    if (!_fileWatcher) {
+        return;
+    }
+
+    if (!_fileWatcher->watchFile(filename)) {
+        LUG_LOG.warn("ResourceManager: Can't watch the file {}", filename);
+        return;
+    }
+
+    std::vector<Resource::Handle>& handles = _watchingResources[filename];
+    if (std::find(handles.begin(), handles.end(), handle) == handles.end()) {
+        handles.push_back(handle);
+    }
+}
+
+void ResourceManager::watchDirectory(const std::string& directory) {
+    if (_fileWatcher && !_fileWatcher->watchDirectory(directory)) {
+        LUG_LOG.warn("ResourceManager: Can't watch the directory {}", directory);
+    }
+}
+
+std::vector<std::string> ResourceManager::pollModifiedFiles() {
+    if (!_fileWatcher) {
+        return {};
+    }
+
+    return _fileWatcher->poll();
+}
+
+std::vector<Resource::Handle> ResourceManager::getWatchingResources(const std::string& filename) const {
+    const auto it = _watchingResources.find(filename);
+    if (it == _watchingResources.end()) {
+        return {};
+    }
+
+    return it->second;
+}
+
+void ResourceManager::rename(Resource& resource, const std::string& name) {
+    removeName(resource.getName(), resource.getHandle());
+    _resourcesByName[name].push_back(resource.getHandle());
+}
+
+void ResourceManager::removeName(const std::string& name, Resource::Handle handle) {
+    const auto it = _resourcesByName.find(name);
+    if (it == _resourcesByName.end()) {
+        return;
+    }
+
+    it->second.erase(std::remove(it->second.begin(), it->second.end(), handle), it->second.end());
+
+    if (it->second.empty()) {
+        _resourcesByName.erase(it);
+    }
+}
+
+void ResourceManager::addFile(const std::string& filename, Resource::Handle handle) {
+    // The first resource loaded from a file stays the one returned by getFile, and the one hot reloaded
+    if (_resourcesByFilename.emplace(filename, handle).second) {
+        watchFile(filename, handle);
+    }
+}
+
+Loader* ResourceManager::getLoader(const std::string& filename) {
     std::string::size_type extensionPos = filename.find_last_of(".");
     if (extensionPos == std::string::npos) {
         LUG_LOG.error("ResourceManager: Can't find extension of the filename {}", filename);
@@ -29,7 +243,7 @@ Resource::SharedPtr<Resource> ResourceManager::loadFile(const std::string& filen
         return nullptr;
     }
 
-    return loader->second->loadFile(filename);
+    return loader->second.get();
 }
 
 } // Graphics
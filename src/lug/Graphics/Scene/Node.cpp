@@ -1,6 +1,12 @@
 #include <lug/Graphics/Scene/Node.hpp>
+
+#include <algorithm>
+#include <cmath>
+
 #include <lug/Graphics/Scene/Scene.hpp>
 #include <lug/Graphics/Render/Queue.hpp>
+#include <lug/Graphics/Render/View.hpp>
+#include <lug/Graphics/TextureStreamer.hpp>
 
 namespace lug {
 namespace Graphics {
@@ -8,10 +14,55 @@ namespace Scene {
 
 Node::Node(Scene& scene, const std::string& name) : ::lug::Graphics::Node(name), _scene(scene) {}
 
+Node* Node::getNode(const std::string& name) {
+    return const_cast<Node*>(static_cast<const Node*>(this)->getNode(name));
+}
+
+const Node* Node::getNode(const std::string& name) const {
+    if (!_attached) {
+        return static_cast<const Node*>(::lug::Graphics::Node::getNode(name));
+    }
+
+    // The whole subtree is indexed, one of the nodes with this name may be in it
+    const auto it = _scene._nodesByName.find(name);
+    if (it == _scene._nodesByName.end()) {
+        return nullptr;
+    }
+
+    for (const Node* node : it->second) {
+        if (node->isDescendantOf(*this)) {
+            return node;
+        }
+    }
+
+    return nullptr;
+}
+
 Node* Node::createSceneNode(const std::string& name) {
     return _scene.createSceneNode(name);
 }
 
+void Node::attachChild(Node& child) {
+    // A child re-parented out of the scene graph leaves the index
+    if (child._attached && !_attached) {
+        _scene.unregisterNode(child);
+    }
+
+    ::lug::Graphics::Node::attachChild(child);
+
+    if (_attached && !child._attached) {
+        _scene.registerNode(child);
+    }
+}
+
+void Node::detachChild(Node& child) {
+    ::lug::Graphics::Node::detachChild(child);
+
+    if (child._attached) {
+        _scene.unregisterNode(child);
+    }
+}
+
 void Node::attachLight(Resource::SharedPtr<Render::Light> light) {
     _light = light;
 }
@@ -35,13 +86,27 @@ void Node::attachCamera(Resource::SharedPtr<Render::Camera::Camera> camera) {
     _camera = std::move(camera);
 }
 
+void Node::attachAnimator(std::unique_ptr<Animation::Animator> animator) {
+    _animator = std::move(animator);
+}
+
+void Node::updateAnimators(const System::Time& elapsedTime) {
+    for (const auto& child : _children) {
+        static_cast<Node*>(child)->updateAnimators(elapsedTime);
+    }
+
+    if (_animator) {
+        _animator->update(elapsedTime);
+    }
+}
+
 void Node::fetchVisibleObjects(const Render::View& renderView, const Render::Camera::Camera& camera, Render::Queue& renderQueue) const {
     for (const auto& child : _children) {
         static_cast<const Node*>(child)->fetchVisibleObjects(renderView, camera, renderQueue);
     }
 
     if (_meshInstance.mesh) {
-        renderQueue.addMeshInstance(*const_cast<Node*>(this));
+        renderQueue.addMeshInstance(*const_cast<Node*>(this), getFootprint(renderView, camera));
     }
 
     // Check the distance with the light
@@ -50,6 +115,36 @@ void Node::fetchVisibleObjects(const Render::View& renderView, const Render::Cam
     }
 }
 
+bool Node::isDescendantOf(const Node& node) const {
+    for (const ::lug::Graphics::Node* current = this; current; current = current->getParent()) {
+        if (current == &node) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+float Node::getFootprint(const Render::View& renderView, const Render::Camera::Camera& camera) const {
+    Node* node = const_cast<Node*>(this);
+    Render::Camera::Camera& mutableCamera = const_cast<Render::Camera::Camera&>(camera);
+
+    const Math::Vec3f& scale = node->getAbsoluteScale();
+    const float radius = _meshInstance.mesh->getBoundingRadius() * std::max({std::fabs(scale.x()), std::fabs(scale.y()), std::fabs(scale.z())});
+
+    const Math::Mat4x4f& projection = mutableCamera.getProjectionMatrix();
+    const float viewportHeight = renderView.getViewport().extent.height;
+
+    // The size doesn't depend on the distance with an orthographic projection
+    if (projection(3, 3) != 0.0f) {
+        return radius * std::fabs(projection(1, 1)) * viewportHeight;
+    }
+
+    const Math::Vec4f center = mutableCamera.getViewMatrix() * node->getTransform() * Math::Vec4f(_meshInstance.mesh->getBoundingCenter(), 1.0f);
+
+    return TextureStreamer::getFootprint(radius, Math::Vec3f(center).length(), projection(1, 1), viewportHeight);
+}
+
 void Node::needUpdate() {
     ::lug::Graphics::Node::needUpdate();
     ::lug::Graphics::Render::DirtyObject::setDirty();
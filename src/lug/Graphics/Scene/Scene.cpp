@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include <lug/Graphics/Render/Light.hpp>
 #include <lug/Graphics/Scene/Scene.hpp>
 #include <lug/System/Logger/Logger.hpp>
@@ -6,7 +8,9 @@ namespace lug {
 namespace Graphics {
 namespace Scene {
 
-Scene::Scene(const std::string& name) : Resource(Resource::Type::Scene, name), _root{*this, "root"} {}
+Scene::Scene(const std::string& name) : Resource(Resource::Type::Scene, name), _root{*this, "root"} {
+    registerNode(_root);
+}
 
 Node* Scene::createSceneNode(const std::string& name) {
     _nodes.emplace_back(*this, name);
@@ -17,11 +21,46 @@ Node* Scene::createSceneNode(const std::string& name) {
 }
 
 Node* Scene::getSceneNode(const std::string& name) {
-    return _root.getNode(name);
+    const auto it = _nodesByName.find(name);
+    return it != _nodesByName.end() ? it->second.front() : nullptr;
 }
 
 const Node* Scene::getSceneNode(const std::string& name) const {
-    return _root.getNode(name);
+    const auto it = _nodesByName.find(name);
+    return it != _nodesByName.end() ? it->second.front() : nullptr;
+}
+
+void Scene::registerNode(Node& node) {
+    node._attached = true;
+
+    // The first node attached with this name is returned, as the previous depth-first search would mostly do
+    _nodesByName[node.getName()].push_back(&node);
+
+    for (auto& child : node._children) {
+        registerNode(*static_cast<Node*>(child));
+    }
+}
+
+void Scene::unregisterNode(Node& node) {
+    node._attached = false;
+
+    const auto it = _nodesByName.find(node.getName());
+    if (it != _nodesByName.end()) {
+        std::vector<Node*>& nodes = it->second;
+        nodes.erase(std::remove(nodes.begin(), nodes.end(), &node), nodes.end());
+
+        if (nodes.empty()) {
+            _nodesByName.erase(it);
+        }
+    }
+
+    for (auto& child : node._children) {
+        unregisterNode(*static_cast<Node*>(child));
+    }
+}
+
+void Scene::updateAnimators(const System::Time& elapsedTime) {
+    _root.updateAnimators(elapsedTime);
 }
 
 void Scene::fetchVisibleObjects(const Render::View& renderView, const Render::Camera::Camera& camera, Render::Queue& renderQueue) const {
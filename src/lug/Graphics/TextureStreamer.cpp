@@ -0,0 +1,267 @@
+#include <lug/Graphics/TextureStreamer.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace lug {
+namespace Graphics {
+
+TextureStreamer::Stats TextureStreamer::getStats() const {
+    Stats stats{
+        /* stats.budget */ _budget,
+        /* stats.usage */ _usage,
+        /* stats.texturesCount */ static_cast<uint32_t>(_entries.size()),
+        /* stats.streamingCount */ _streamingCount,
+        /* stats.upgrades */ _upgrades,
+        /* stats.downgrades */ _downgrades
+    };
+
+    return stats;
+}
+
+uint32_t TextureStreamer::getRequiredLevel(uint32_t width, uint32_t height, uint32_t levelsCount, float footprint) {
+    if (!levelsCount) {
+        return 0;
+    }
+
+    if (!(footprint > 0.0f)) {
+        return levelsCount - 1;
+    }
+
+    // One texel of the level per pixel
+    const float level = std::floor(std::log2(static_cast<float>(std::max(width, height)) / footprint));
+
+    if (!(level > 0.0f)) {
+        return 0;
+    }
+
+    return std::min(static_cast<uint32_t>(std::min(level, 32.0f)), levelsCount - 1);
+}
+
+uint32_t TextureStreamer::getBaseLevel(uint32_t width, uint32_t height, uint32_t levelsCount, uint32_t baseSize) {
+    for (uint32_t level = 0; level < levelsCount; ++level) {
+        if (std::max(std::max(width >> level, 1u), std::max(height >> level, 1u)) <= baseSize) {
+            return level;
+        }
+    }
+
+    return levelsCount ? levelsCount - 1 : 0;
+}
+
+float TextureStreamer::getFootprint(float radius, float distance, float projectionScale, float viewportHeight) {
+    if (distance <= radius) {
+        return std::numeric_limits<float>::infinity();
+    }
+
+    // Tangent of the half angle of the cone containing the sphere
+    const float tangent = radius / std::sqrt(distance * distance - radius * radius);
+
+    return tangent * std::abs(projectionScale) * viewportHeight;
+}
+
+bool TextureStreamer::track(Resource::Handle handle, uint32_t width, uint32_t height, uint32_t levelsCount, uint32_t residentLevel) {
+    if (!_provider || !levelsCount) {
+        return false;
+    }
+
+    auto it = _entries.find(handle.value);
+    if (it != _entries.end()) {
+        return true;
+    }
+
+    Entry& entry = _entries[handle.value];
+
+    entry.width = width;
+    entry.height = height;
+    entry.levelsCount = levelsCount;
+    entry.baseLevel = getBaseLevel(width, height, levelsCount, _baseSize);
+    entry.residentLevel = std::min(residentLevel, levelsCount - 1);
+    entry.requiredLevel = levelsCount;
+    entry.keptLevel = entry.residentLevel;
+    entry.keptFrame = _frame;
+    entry.size = _provider->getLevelsSize(handle, entry.residentLevel);
+    entry.streaming = false;
+    entry.streamingLevel = entry.residentLevel;
+    entry.reservedSize = 0;
+
+    _usage += entry.size;
+
+    return true;
+}
+
+void TextureStreamer::untrack(Resource::Handle handle) {
+    auto it = _entries.find(handle.value);
+    if (it == _entries.end()) {
+        return;
+    }
+
+    _usage -= it->second.size + it->second.reservedSize;
+
+    if (it->second.streaming) {
+        --_streamingCount;
+    }
+
+    _entries.erase(it);
+}
+
+void TextureStreamer::request(Resource::Handle handle, float footprint) {
+    auto it = _entries.find(handle.value);
+    if (it == _entries.end()) {
+        return;
+    }
+
+    Entry& entry = it->second;
+    entry.requiredLevel = std::min(entry.requiredLevel, getRequiredLevel(entry.width, entry.height, entry.levelsCount, footprint));
+}
+
+void TextureStreamer::finishStream(Resource::Handle handle, bool streamed) {
+    auto it = _entries.find(handle.value);
+    if (it == _entries.end() || !it->second.streaming) {
+        return;
+    }
+
+    Entry& entry = it->second;
+
+    entry.streaming = false;
+    --_streamingCount;
+
+    _usage -= entry.reservedSize;
+    entry.reservedSize = 0;
+
+    if (!streamed || !_provider) {
+        return;
+    }
+
+    _usage -= entry.size;
+
+    entry.residentLevel = entry.streamingLevel;
+    entry.size = _provider->getLevelsSize(handle, entry.residentLevel);
+
+    _usage += entry.size;
+}
+
+void TextureStreamer::updateKeptLevel(Entry& entry) {
+    // The base level is kept even if the texture is not requested anymore
+    const uint32_t level = std::min(entry.requiredLevel, entry.baseLevel);
+
+    // A finer level is kept immediately, a coarser one only once the finer levels have not been requested for a while
+    if (level <= entry.keptLevel || entry.keptFrame + _releaseDelay <= _frame) {
+        entry.keptLevel = level;
+        entry.keptFrame = _frame;
+    }
+
+    entry.requiredLevel = entry.levelsCount;
+}
+
+void TextureStreamer::nextFrame() {
+    std::vector<uint32_t> upgrades;
+    std::vector<uint32_t> downgrades;
+
+    for (auto& it : _entries) {
+        Entry& entry = it.second;
+
+        updateKeptLevel(entry);
+
+        if (entry.streaming) {
+            continue;
+        }
+
+        if (entry.keptLevel < entry.residentLevel) {
+            upgrades.push_back(it.first);
+        } else if (entry.keptLevel > entry.residentLevel) {
+            downgrades.push_back(it.first);
+        }
+    }
+
+    ++_frame;
+
+    if (!_provider) {
+        return;
+    }
+
+    // Stream the textures missing the most levels first
+    std::sort(upgrades.begin(), upgrades.end(), [this](uint32_t lhs, uint32_t rhs) {
+        const Entry& lhsEntry = _entries[lhs];
+        const Entry& rhsEntry = _entries[rhs];
+
+        const uint32_t lhsMissing = lhsEntry.residentLevel - lhsEntry.keptLevel;
+        const uint32_t rhsMissing = rhsEntry.residentLevel - rhsEntry.keptLevel;
+
+        return lhsMissing > rhsMissing || (lhsMissing == rhsMissing && lhs < rhs);
+    });
+
+    const auto& startStream = [this](uint32_t value, Entry& entry, uint32_t level, uint64_t reservedSize) {
+        Resource::Handle handle;
+        handle.value = value;
+
+        // The provider can finish the stream before returning
+        entry.streaming = true;
+        entry.streamingLevel = level;
+        entry.reservedSize = reservedSize;
+
+        ++_streamingCount;
+        _usage += reservedSize;
+
+        if (!_provider->streamLevels(handle, level)) {
+            entry.streaming = false;
+            entry.reservedSize = 0;
+
+            --_streamingCount;
+            _usage -= reservedSize;
+
+            return false;
+        }
+
+        return true;
+    };
+
+    // The released levels free the budget for the others
+    for (const uint32_t value : downgrades) {
+        if (_streamingCount >= _maxStreamingCount) {
+            return;
+        }
+
+        Entry& entry = _entries[value];
+
+        if (startStream(value, entry, entry.keptLevel, 0)) {
+            ++_downgrades;
+        }
+    }
+
+    for (const uint32_t value : upgrades) {
+        if (_streamingCount >= _maxStreamingCount) {
+            return;
+        }
+
+        Entry& entry = _entries[value];
+
+        Resource::Handle handle;
+        handle.value = value;
+
+        // Stream the finest levels that fit in the budget
+        uint32_t level = entry.keptLevel;
+        uint64_t reservedSize = 0;
+
+        for (; level < entry.residentLevel; ++level) {
+            const uint64_t size = _provider->getLevelsSize(handle, level);
+            reservedSize = size > entry.size ? size - entry.size : 0;
+
+            if (!_budget || _usage + reservedSize <= _budget) {
+                break;
+            }
+        }
+
+        if (level == entry.residentLevel) {
+            continue;
+        }
+
+        if (startStream(value, entry, level, reservedSize)) {
+            ++_upgrades;
+        }
+    }
+}
+
+} // Graphics
+} // lug
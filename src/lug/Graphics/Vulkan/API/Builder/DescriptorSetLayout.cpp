@@ -1,5 +1,7 @@
 #include <lug/Graphics/Vulkan/API/Builder/DescriptorSetLayout.hpp>
 
+#include <algorithm>
+
 #include <lug/Graphics/Vulkan/API/Device.hpp>
 
 namespace lug {
@@ -11,11 +13,26 @@ namespace Builder {
 DescriptorSetLayout::DescriptorSetLayout(const API::Device& device) : _device{device} {}
 
 bool DescriptorSetLayout::build(API::DescriptorSetLayout& descriptorSetLayout, VkResult* returnResult) {
+    const void* next = nullptr;
+
+#if defined(VK_EXT_descriptor_indexing)
+    const VkDescriptorSetLayoutBindingFlagsCreateInfoEXT bindingFlagsInfo{
+        /* bindingFlagsInfo.sType */ VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT,
+        /* bindingFlagsInfo.pNext */ nullptr,
+        /* bindingFlagsInfo.bindingCount */ static_cast<uint32_t>(_bindingFlags.size()),
+        /* bindingFlagsInfo.pBindingFlags */ _bindingFlags.data()
+    };
+
+    if (!_bindingFlags.empty()) {
+        next = &bindingFlagsInfo;
+    }
+#endif
+
     // Create the descriptorSetLayout creation information for vkCreateDescriptorSetLayout
     const VkDescriptorSetLayoutCreateInfo createInfo{
         /* createInfo.sType */ VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
-        /* createInfo.pNext */ nullptr,
-        /* createInfo.flags */ 0,
+        /* createInfo.pNext */ next,
+        /* createInfo.flags */ _flags,
         /* createInfo.bindingCount */ static_cast<uint32_t>(_bindings.size()),
         /* createInfo.pBindings */ _bindings.data(),
     };
@@ -32,7 +49,22 @@ bool DescriptorSetLayout::build(API::DescriptorSetLayout& descriptorSetLayout, V
         return false;
     }
 
-    descriptorSetLayout = API::DescriptorSetLayout(vkDescriptorSetLayout, &_device);
+    // Count the descriptors of each type, to size the pools allocating sets of this layout
+    std::vector<VkDescriptorPoolSize> poolSizes;
+    for (const auto& binding : _bindings) {
+        auto poolSize = std::find_if(poolSizes.begin(), poolSizes.end(), [&binding](const VkDescriptorPoolSize& poolSize) {
+            return poolSize.type == binding.descriptorType;
+        });
+
+        if (poolSize == poolSizes.end()) {
+            poolSizes.push_back({binding.descriptorType, 0});
+            poolSize = poolSizes.end() - 1;
+        }
+
+        poolSize->descriptorCount += binding.descriptorCount;
+    }
+
+    descriptorSetLayout = API::DescriptorSetLayout(vkDescriptorSetLayout, &_device, std::move(poolSizes));
 
     return true;
 }
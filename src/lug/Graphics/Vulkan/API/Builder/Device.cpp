@@ -70,7 +70,7 @@ bool Device::build(API::Device& device, VkResult* returnResult) {
     // Create the device creation information for vkCreateDevice
     const VkDeviceCreateInfo createInfo{
         /* createInfo.sType */ VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
-        /* createInfo.pNext */ nullptr,
+        /* createInfo.pNext */ _next,
         /* createInfo.flags */ 0,
         /* createInfo.queueCreateInfoCount */ static_cast<uint32_t>(queueCreateInfos.size()),
         /* createInfo.pQueueCreateInfos */ queueCreateInfos.data(),
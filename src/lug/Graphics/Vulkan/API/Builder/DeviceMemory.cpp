@@ -64,7 +64,12 @@ bool DeviceMemory::build(API::DeviceMemory& deviceMemory, VkResult* returnResult
         return false;
     }
 
-    deviceMemory = API::DeviceMemory(vkDeviceMemory, &_device, size);
+    deviceMemory = API::DeviceMemory(
+        vkDeviceMemory,
+        &_device,
+        size,
+        _device.getPhysicalDeviceInfo()->memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags
+    );
 
     // Bind all the buffers into the memory
     for (uint32_t i = 0; i < _buffers.size(); ++i) {
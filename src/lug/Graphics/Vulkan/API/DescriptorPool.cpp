@@ -1,6 +1,7 @@
 #include <lug/Graphics/Vulkan/API/DescriptorPool.hpp>
 
 #include <lug/Graphics/Vulkan/API/Device.hpp>
+#include <lug/System/Logger/Logger.hpp>
 
 namespace lug {
 namespace Graphics {
@@ -33,6 +34,17 @@ DescriptorPool::~DescriptorPool() {
     destroy();
 }
 
+bool DescriptorPool::reset() const {
+    VkResult result = vkResetDescriptorPool(static_cast<VkDevice>(*_device), _descriptorPool, 0);
+
+    if (result != VK_SUCCESS) {
+        LUG_LOG.error("DescriptorPool: Can't reset the pool: {}", result);
+        return false;
+    }
+
+    return true;
+}
+
 void DescriptorPool::destroy() {
     if (_descriptorPool != VK_NULL_HANDLE) {
         vkDestroyDescriptorPool(static_cast<VkDevice>(*_device), _descriptorPool, nullptr);
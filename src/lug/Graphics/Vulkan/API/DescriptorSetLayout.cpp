@@ -8,11 +8,13 @@ namespace Graphics {
 namespace Vulkan {
 namespace API {
 
-DescriptorSetLayout::DescriptorSetLayout(VkDescriptorSetLayout descriptorSetLayout, const Device* device) : _descriptorSetLayout(descriptorSetLayout), _device(device) {}
+DescriptorSetLayout::DescriptorSetLayout(VkDescriptorSetLayout descriptorSetLayout, const Device* device, std::vector<VkDescriptorPoolSize> poolSizes) :
+    _descriptorSetLayout(descriptorSetLayout), _device(device), _poolSizes(std::move(poolSizes)) {}
 
 DescriptorSetLayout::DescriptorSetLayout(DescriptorSetLayout&& descriptorSetLayout) {
     _descriptorSetLayout = descriptorSetLayout._descriptorSetLayout;
     _device = descriptorSetLayout._device;
+    _poolSizes = std::move(descriptorSetLayout._poolSizes);
     descriptorSetLayout._descriptorSetLayout = VK_NULL_HANDLE;
     descriptorSetLayout._device = nullptr;
 }
@@ -22,6 +24,7 @@ DescriptorSetLayout& DescriptorSetLayout::operator=(DescriptorSetLayout&& descri
 
     _descriptorSetLayout = descriptorSetLayout._descriptorSetLayout;
     _device = descriptorSetLayout._device;
+    _poolSizes = std::move(descriptorSetLayout._poolSizes);
     descriptorSetLayout._descriptorSetLayout = VK_NULL_HANDLE;
     descriptorSetLayout._device = nullptr;
 
@@ -38,6 +41,7 @@ void DescriptorSetLayout::destroy() {
         _descriptorSetLayout = VK_NULL_HANDLE;
     }
     _device = nullptr;
+    _poolSizes.clear();
 }
 
 } // API
@@ -1,5 +1,7 @@
 #include <lug/Graphics/Vulkan/API/DeviceMemory.hpp>
 
+#include <algorithm>
+
 #include <lug/Graphics/Vulkan/API/Buffer.hpp>
 #include <lug/Graphics/Vulkan/API/Device.hpp>
 #include <lug/Graphics/Vulkan/API/Image.hpp>
@@ -10,15 +12,18 @@ namespace Graphics {
 namespace Vulkan {
 namespace API {
 
-DeviceMemory::DeviceMemory(VkDeviceMemory deviceMemory, const Device* device, VkDeviceSize size) : _deviceMemory(deviceMemory), _device(device), _size(size) {}
+DeviceMemory::DeviceMemory(VkDeviceMemory deviceMemory, const Device* device, VkDeviceSize size, VkMemoryPropertyFlags propertyFlags) :
+    _deviceMemory(deviceMemory), _device(device), _size(size), _propertyFlags(propertyFlags) {}
 
 DeviceMemory::DeviceMemory(DeviceMemory&& deviceMemory) {
     _deviceMemory = deviceMemory._deviceMemory;
     _device = deviceMemory._device;
     _size = deviceMemory._size;
+    _propertyFlags = deviceMemory._propertyFlags;
     deviceMemory._deviceMemory = VK_NULL_HANDLE;
     deviceMemory._device = nullptr;
     deviceMemory._size = 0;
+    deviceMemory._propertyFlags = 0;
 }
 
 DeviceMemory& DeviceMemory::operator=(DeviceMemory&& deviceMemory) {
@@ -27,9 +32,11 @@ DeviceMemory& DeviceMemory::operator=(DeviceMemory&& deviceMemory) {
     _deviceMemory = deviceMemory._deviceMemory;
     _device = deviceMemory._device;
     _size = deviceMemory._size;
+    _propertyFlags = deviceMemory._propertyFlags;
     deviceMemory._deviceMemory = VK_NULL_HANDLE;
     deviceMemory._device = nullptr;
     deviceMemory._size = 0;
+    deviceMemory._propertyFlags = 0;
 
     return *this;
 }
@@ -112,6 +119,34 @@ void DeviceMemory::unmap() const {
     vkUnmapMemory(static_cast<VkDevice>(*_device), _deviceMemory);
 }
 
+bool DeviceMemory::flush(VkDeviceSize offset, VkDeviceSize size) const {
+    if (_propertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) {
+        return true;
+    }
+
+    // The range must be aligned to the atom size, or end at the end of the memory
+    const VkDeviceSize atomSize = _device->getPhysicalDeviceInfo()->properties.limits.nonCoherentAtomSize;
+    const VkDeviceSize begin = offset - offset % atomSize;
+    const VkDeviceSize end = std::min(offset + size + (atomSize - (offset + size) % atomSize) % atomSize, _size);
+
+    const VkMappedMemoryRange range{
+        /* range.sType */ VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
+        /* range.pNext */ nullptr,
+        /* range.memory */ _deviceMemory,
+        /* range.offset */ begin,
+        /* range.size */ end == _size ? VK_WHOLE_SIZE : end - begin
+    };
+
+    VkResult result = vkFlushMappedMemoryRanges(static_cast<VkDevice>(*_device), 1, &range);
+
+    if (result != VK_SUCCESS) {
+        LUG_LOG.error("DeviceMemory: Can't flush mapped memory range: {}", result);
+        return false;
+    }
+
+    return true;
+}
+
 } // API
 } // Vulkan
 } // Graphics
@@ -24,11 +24,22 @@ Resource::SharedPtr<::lug::Graphics::Render::Material> build(const ::lug::Graphi
     material->_occlusionTexture = builder._occlusionTexture;
     material->_emissiveTexture = builder._emissiveTexture;
 
-    material->_pipelineIdMaterialPart.baseColorInfo = material->_baseColorTexture.texture ? material->_baseColorTexture.texCoord : 0b11;
-    material->_pipelineIdMaterialPart.metallicRoughnessInfo = material->_metallicRoughnessTexture.texture ? material->_metallicRoughnessTexture.texCoord : 0b11;
-    material->_pipelineIdMaterialPart.normalInfo = material->_normalTexture.texture ? material->_normalTexture.texCoord : 0b11;
-    material->_pipelineIdMaterialPart.occlusionInfo = material->_occlusionTexture.texture ? material->_occlusionTexture.texCoord : 0b11;
-    material->_pipelineIdMaterialPart.emissiveInfo = material->_emissiveTexture.texture ? material->_emissiveTexture.texCoord : 0b11;
+    if (static_cast<Vulkan::Renderer&>(builder._renderer).isBindlessEnabled()) {
+        // The textures are read from the bindless array, all the materials share the same pipelines
+        material->_pipelineIdMaterialPart.baseColorInfo = 0b11;
+        material->_pipelineIdMaterialPart.metallicRoughnessInfo = 0b11;
+        material->_pipelineIdMaterialPart.normalInfo = 0b11;
+        material->_pipelineIdMaterialPart.occlusionInfo = 0b11;
+        material->_pipelineIdMaterialPart.emissiveInfo = 0b11;
+        material->_pipelineIdMaterialPart.bindless = 1;
+    } else {
+        material->_pipelineIdMaterialPart.baseColorInfo = material->_baseColorTexture.texture ? material->_baseColorTexture.texCoord : 0b11;
+        material->_pipelineIdMaterialPart.metallicRoughnessInfo = material->_metallicRoughnessTexture.texture ? material->_metallicRoughnessTexture.texCoord : 0b11;
+        material->_pipelineIdMaterialPart.normalInfo = material->_normalTexture.texture ? material->_normalTexture.texCoord : 0b11;
+        material->_pipelineIdMaterialPart.occlusionInfo = material->_occlusionTexture.texture ? material->_occlusionTexture.texCoord : 0b11;
+        material->_pipelineIdMaterialPart.emissiveInfo = material->_emissiveTexture.texture ? material->_emissiveTexture.texCoord : 0b11;
+        material->_pipelineIdMaterialPart.bindless = 0;
+    }
 
     return builder._renderer.getResourceManager()->add<::lug::Graphics::Render::Material>(std::move(resource));
 }
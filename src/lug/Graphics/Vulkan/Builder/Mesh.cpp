@@ -15,6 +15,97 @@ namespace Vulkan {
 namespace Builder {
 namespace Mesh {
 
+bool load(Renderer& renderer, Render::Mesh& mesh) {
+    const API::Queue* graphicsQueue = renderer.getDevice().getQueue("queue_graphics");
+    if (!graphicsQueue) {
+        LUG_LOG.error("Vulkan::Mesh::load: Can't find graphics queue");
+        return false;
+    }
+
+    // Create the attributes buffers
+    for (auto& primitiveSet : mesh._primitiveSets) {
+        for (auto& attribute : primitiveSet.attributes) {
+            // Attributes ignored by the build don't have a buffer
+            if (!attribute._data) {
+                continue;
+            }
+
+            API::Builder::Buffer bufferBuilder(renderer.getDevice());
+
+            bufferBuilder.setQueueFamilyIndices({graphicsQueue->getQueueFamily()->getIdx()});
+            bufferBuilder.setSize(attribute.buffer.size);
+
+            if (attribute.type == lug::Graphics::Render::Mesh::PrimitiveSet::Attribute::Type::Indice) {
+                bufferBuilder.setUsage(VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
+            } else {
+                bufferBuilder.setUsage(VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+            }
+
+            VkResult result{VK_SUCCESS};
+            if (!bufferBuilder.build(*static_cast<API::Buffer*>(attribute._data), &result)) {
+                LUG_LOG.error("Vulkan::Mesh::load: Can't create buffer: {}", result);
+                return false;
+            }
+        }
+    }
+
+    // Bind attributes buffers to mesh device memory
+    {
+        API::Builder::DeviceMemory deviceMemoryBuilder(renderer.getDevice());
+        // TODO(nokitoo): use memory flag VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+        deviceMemoryBuilder.setMemoryFlags(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+
+        // Add buffers to memory
+        for (auto& primitiveSet : mesh._primitiveSets) {
+            for (auto& attribute : primitiveSet.attributes) {
+                if (attribute._data && !deviceMemoryBuilder.addBuffer(*static_cast<API::Buffer*>(attribute._data))) {
+                    LUG_LOG.error("Vulkan::Mesh::load: Can't add buffer to device memory");
+                    return false;
+                }
+            }
+        }
+
+        VkResult result{VK_SUCCESS};
+        if (!deviceMemoryBuilder.build(mesh._deviceMemory, &result)) {
+            LUG_LOG.error("Vulkan::Mesh::load: Can't create device memory: {}", result);
+            return false;
+        }
+
+        // Update buffers data
+        for (auto& primitiveSet : mesh._primitiveSets) {
+            for (auto& attribute : primitiveSet.attributes) {
+                if (attribute._data) {
+                    static_cast<API::Buffer*>(attribute._data)->updateData(
+                        attribute.buffer.data,
+                        attribute.buffer.size
+                    );
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+void unload(Renderer& renderer, Render::Mesh& mesh) {
+    std::vector<API::Buffer> buffers;
+
+    // The buffers stay in the primitive sets, destroyed, to be rebuilt by load
+    for (auto& primitiveSet : mesh._primitiveSets) {
+        if (!primitiveSet._data) {
+            continue;
+        }
+
+        Render::Mesh::PrimitiveSetData* primitiveSetData = static_cast<Render::Mesh::PrimitiveSetData*>(primitiveSet._data);
+
+        for (auto& buffer : primitiveSetData->buffers) {
+            buffers.push_back(std::move(buffer));
+        }
+    }
+
+    renderer.destroyLater(std::move(buffers), std::move(mesh._deviceMemory));
+}
+
 Resource::SharedPtr<::lug::Graphics::Render::Mesh> build(const ::lug::Graphics::Builder::Mesh& builder) {
     // Constructor of Mesh is private, we can't use std::make_unique
     std::unique_ptr<Resource> resource{new Vulkan::Render::Mesh(builder._name)};
@@ -63,35 +154,15 @@ Resource::SharedPtr<::lug::Graphics::Render::Mesh> build(const ::lug::Graphics::
                 case lug::Graphics::Render::Mesh::PrimitiveSet::Attribute::Type::Tangent:
                     targetPrimitiveSet.tangent = &targetPrimitiveSet.attributes[i];
                     break;
+                case lug::Graphics::Render::Mesh::PrimitiveSet::Attribute::Type::Joints:
+                    targetPrimitiveSet.joints = &targetPrimitiveSet.attributes[i];
+                    break;
+                case lug::Graphics::Render::Mesh::PrimitiveSet::Attribute::Type::Weights:
+                    targetPrimitiveSet.weights = &targetPrimitiveSet.attributes[i];
+                    break;
             }
 
-            {
-                API::Buffer buffer;
-                API::Builder::Buffer bufferBuilder(renderer.getDevice());
-
-                const API::Queue* graphicsQueue = renderer.getDevice().getQueue("queue_graphics");
-                if (!graphicsQueue) {
-                    LUG_LOG.error("Vulkan::Mesh::build: Can't find graphics queue");
-                    return nullptr;
-                }
-
-                bufferBuilder.setQueueFamilyIndices({graphicsQueue->getQueueFamily()->getIdx()});
-                bufferBuilder.setSize(targetPrimitiveSet.attributes[i].buffer.size);
-
-                if (targetPrimitiveSet.attributes[i].type == lug::Graphics::Render::Mesh::PrimitiveSet::Attribute::Type::Indice) {
-                    bufferBuilder.setUsage(VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
-                } else {
-                    bufferBuilder.setUsage(VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
-                }
-
-                VkResult result{VK_SUCCESS};
-                if (!bufferBuilder.build(primitiveSetData->buffers[i], &result)) {
-                    LUG_LOG.error("Vulkan::Mesh::build: Can't create buffer: {}", result);
-                    return nullptr;
-                }
-
-                targetPrimitiveSet.attributes[i]._data = static_cast<void*>(&primitiveSetData->buffers[i]);
-            }
+            targetPrimitiveSet.attributes[i]._data = static_cast<void*>(&primitiveSetData->buffers[i]);
         }
 
         primitiveSetData->pipelineIdPrimitivePart.positionVertexData = targetPrimitiveSet.position != nullptr;
@@ -100,48 +171,22 @@ Resource::SharedPtr<::lug::Graphics::Render::Mesh> build(const ::lug::Graphics::
         primitiveSetData->pipelineIdPrimitivePart.countTexCoord = targetPrimitiveSet.texCoords.size();
         primitiveSetData->pipelineIdPrimitivePart.countColor = targetPrimitiveSet.colors.size();
         primitiveSetData->pipelineIdPrimitivePart.primitiveMode = static_cast<uint32_t>(targetPrimitiveSet.mode);
+        primitiveSetData->pipelineIdPrimitivePart.halfPosition = targetPrimitiveSet.position &&
+            targetPrimitiveSet.position->format == lug::Graphics::Render::Mesh::PrimitiveSet::Attribute::Format::Half;
+        primitiveSetData->pipelineIdPrimitivePart.octahedralNormal = targetPrimitiveSet.normal &&
+            targetPrimitiveSet.normal->format == lug::Graphics::Render::Mesh::PrimitiveSet::Attribute::Format::Oct16;
+        primitiveSetData->pipelineIdPrimitivePart.skinned = targetPrimitiveSet.joints && targetPrimitiveSet.weights;
 
         targetPrimitiveSet._data = static_cast<void*>(primitiveSetData);
         mesh->_primitiveSets.push_back(std::move(targetPrimitiveSet));
     }
 
-    // Bind attributes buffers to mesh device memory
-    {
-        API::Builder::DeviceMemory deviceMemoryBuilder(renderer.getDevice());
-        // TODO(nokitoo): use memory flag VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
-        deviceMemoryBuilder.setMemoryFlags(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
-
-        for (auto& primitiveSet : mesh->_primitiveSets) {
-            Render::Mesh::PrimitiveSetData* primitiveSetData = static_cast<Render::Mesh::PrimitiveSetData*>(primitiveSet._data);
-
-            // Add buffers to memory
-            for (auto& buffer : primitiveSetData->buffers) {
-                if (!deviceMemoryBuilder.addBuffer(buffer)) {
-                    LUG_LOG.error("Vulkan::Mesh::build: Can't add buffer to device memory");
-                    return nullptr;
-                }
-            }
-        }
+    // Used to compute the size of the mesh on the screen
+    mesh->computeBoundingSphere();
 
-        VkResult result{VK_SUCCESS};
-        if (!deviceMemoryBuilder.build(mesh->_deviceMemory, &result)) {
-            LUG_LOG.error("Vulkan::Mesh::build: Can't create device memory: {}", result);
-            return nullptr;
-        }
-
-        // Update buffers data
-        for (auto& primitiveSet : mesh->_primitiveSets) {
-            Render::Mesh::PrimitiveSetData* primitiveSetData = static_cast<Render::Mesh::PrimitiveSetData*>(primitiveSet._data);
-
-            uint32_t attributesNb = static_cast<uint32_t>(primitiveSet.attributes.size());
-
-            for (uint32_t i = 0; i < attributesNb; ++i) {
-                primitiveSetData->buffers[i].updateData(
-                    primitiveSet.attributes[i].buffer.data,
-                    primitiveSet.attributes[i].buffer.size
-                );
-            }
-        }
+    if (!load(renderer, *mesh)) {
+        LUG_LOG.error("Vulkan::Mesh::build: Can't load the mesh");
+        return nullptr;
     }
 
     return builder._renderer.getResourceManager()->add<::lug::Graphics::Render::Mesh>(std::move(resource));
@@ -1,5 +1,10 @@
 #include <lug/Graphics/Vulkan/Builder/SkyBox.hpp>
 
+#include <array>
+#include <fstream>
+
+#include <stb_image.h>
+
 #include <lug/Graphics/Builder/Mesh.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/DescriptorSetLayout.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/GraphicsPipeline.hpp>
@@ -7,6 +12,7 @@
 #include <lug/Graphics/Vulkan/API/Builder/RenderPass.hpp>
 #include <lug/Graphics/Builder/SkyBox.hpp>
 #include <lug/Graphics/Builder/Texture.hpp>
+#include <lug/Graphics/Render/Ibl.hpp>
 #include <lug/Graphics/Renderer.hpp>
 #include <lug/Graphics/Vulkan/Renderer.hpp>
 #include <lug/Graphics/Vulkan/Render/SkyBox.hpp>
@@ -17,6 +23,16 @@ namespace Vulkan {
 namespace Builder {
 namespace SkyBox {
 
+namespace Ibl = ::lug::Graphics::Render::Ibl;
+
+// The faces are downsampled to this size before being prefiltered, the specular map has this size
+constexpr uint32_t environmentMaxSize = 128;
+constexpr uint32_t irradianceMapSize = 32;
+constexpr uint32_t specularLevelsCount = 6;
+constexpr uint32_t specularSamplesCount = 256;
+constexpr uint32_t brdfLutSize = 128;
+constexpr uint32_t brdfLutSamplesCount = 512;
+
 static bool initPipeline(Renderer& renderer, API::GraphicsPipeline& skyBoxPipeline) {
     API::Builder::GraphicsPipeline graphicsPipelineBuilder(renderer.getDevice());
 
@@ -91,15 +107,25 @@ static bool initPipeline(Renderer& renderer, API::GraphicsPipeline& skyBoxPipeli
             // Camera uniform buffer
             // We only need it in the vertex shader, but we still use VK_SHADER_STAGE_FRAGMENT_BIT
             // because it needs to be compatible with the objects pipeline layout to use the same camera descriptor set
-            const VkDescriptorSetLayoutBinding binding{
-                /* binding.binding */ 0,
-                /* binding.descriptorType */ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC,
-                /* binding.descriptorCount */ 1,
-                /* binding.stageFlags */ VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
-                /* binding.pImmutableSamplers */ nullptr
+            // The joints palette isn't read by the skybox, it is there for the same reason
+            const std::vector<VkDescriptorSetLayoutBinding> bindings{
+                {
+                    /* binding.binding */ 0,
+                    /* binding.descriptorType */ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC,
+                    /* binding.descriptorCount */ 1,
+                    /* binding.stageFlags */ VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+                    /* binding.pImmutableSamplers */ nullptr
+                },
+                {
+                    /* binding.binding */ 1,
+                    /* binding.descriptorType */ VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC,
+                    /* binding.descriptorCount */ 1,
+                    /* binding.stageFlags */ VK_SHADER_STAGE_VERTEX_BIT,
+                    /* binding.pImmutableSamplers */ nullptr
+                }
             };
 
-            descriptorSetLayoutBuilder.setBindings({binding});
+            descriptorSetLayoutBuilder.setBindings(bindings);
             VkResult result{VK_SUCCESS};
             if (!descriptorSetLayoutBuilder.build(descriptorSetLayouts[0], &result)) {
                 LUG_LOG.error("initPipeline: Can't create pipeline descriptor sets layout 0: {}", result);
@@ -313,6 +339,112 @@ static bool initMesh(Renderer& renderer, lug::Graphics::Resource::SharedPtr<lug:
     return true;
 }
 
+static bool writeFile(const std::string& filename, const std::vector<uint8_t>& data) {
+    std::ofstream file(filename, std::ios::binary);
+
+    if (!file.good()) {
+        LUG_LOG.error("writeFile: Can't open file \"{}\"", filename);
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(data.data()), data.size());
+
+    return file.good();
+}
+
+// Loads the faces as linear colors, stb_image converts the LDR images from sRGB
+static bool loadEnvironment(const std::array<std::string, 6>& faces, Ibl::CubeMap& environment) {
+    for (uint32_t face = 0; face < 6; ++face) {
+        int width{0};
+        int height{0};
+        int channels{0};
+
+        float* pixels = stbi_loadf(faces[face].c_str(), &width, &height, &channels, STBI_rgb);
+
+        if (!pixels) {
+            LUG_LOG.error("loadEnvironment: Failed to load the face \"{}\"", faces[face]);
+            return false;
+        }
+
+        if (width != height || (face != 0 && static_cast<uint32_t>(width) != environment.size)) {
+            LUG_LOG.error("loadEnvironment: The face \"{}\" is not square or doesn't have the size of the other faces", faces[face]);
+            stbi_image_free(pixels);
+            return false;
+        }
+
+        environment.size = static_cast<uint32_t>(width);
+        environment.faces[face].resize(environment.size * environment.size);
+
+        for (size_t i = 0; i < environment.faces[face].size(); ++i) {
+            environment.faces[face][i] = Math::Vec3f{pixels[i * 3], pixels[i * 3 + 1], pixels[i * 3 + 2]};
+        }
+
+        stbi_image_free(pixels);
+    }
+
+    while (environment.size > environmentMaxSize) {
+        environment = Ibl::downsample(environment);
+    }
+
+    return true;
+}
+
+// Generates the files of the cache which don't exist yet
+static bool initEnvironmentCache(const std::array<std::string, 6>& faces, const std::string& irradianceFilename, const std::string& specularFilename, const std::string& brdfLutFilename) {
+    const bool hasIrradiance = std::ifstream(irradianceFilename).good();
+    const bool hasSpecular = std::ifstream(specularFilename).good();
+
+    std::vector<uint8_t> file;
+
+    if (!hasIrradiance || !hasSpecular) {
+        LUG_LOG.info("initEnvironmentCache: Generating the environment of \"{}\"", faces[0]);
+
+        Ibl::CubeMap environment;
+        if (!loadEnvironment(faces, environment)) {
+            return false;
+        }
+
+        if (!hasIrradiance) {
+            const Ibl::CubeMap irradianceMap = Ibl::createIrradianceMap(Ibl::computeIrradiance(environment), irradianceMapSize);
+
+            if (!Ibl::writeCubeMap({irradianceMap}, file) || !writeFile(irradianceFilename, file)) {
+                LUG_LOG.error("initEnvironmentCache: Can't write the irradiance map \"{}\"", irradianceFilename);
+                return false;
+            }
+        }
+
+        if (!hasSpecular) {
+            if (!Ibl::writeCubeMap(Ibl::prefilter(environment, specularLevelsCount, specularSamplesCount), file) || !writeFile(specularFilename, file)) {
+                LUG_LOG.error("initEnvironmentCache: Can't write the specular map \"{}\"", specularFilename);
+                return false;
+            }
+        }
+    }
+
+    // The lookup table doesn't depend on the environment
+    if (!std::ifstream(brdfLutFilename).good()) {
+        if (!Ibl::writeBrdfLut(Ibl::createBrdfLut(brdfLutSize, brdfLutSamplesCount), brdfLutSize, file) || !writeFile(brdfLutFilename, file)) {
+            LUG_LOG.error("initEnvironmentCache: Can't write the BRDF lookup table \"{}\"", brdfLutFilename);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static Resource::SharedPtr<::lug::Graphics::Render::Texture> buildEnvironmentTexture(::lug::Graphics::Renderer& renderer, const std::string& filename, lug::Graphics::Builder::Texture::Type type) {
+    lug::Graphics::Builder::Texture textureBuilder(renderer);
+
+    // The levels of the specular map are sampled between them for the intermediate roughnesses
+    textureBuilder.setType(type);
+    textureBuilder.setMagFilter(::lug::Graphics::Render::Texture::Filter::Linear);
+    textureBuilder.setMinFilter(::lug::Graphics::Render::Texture::Filter::Linear);
+    textureBuilder.setMipMapFilter(::lug::Graphics::Render::Texture::Filter::Linear);
+    textureBuilder.addLayer(filename);
+
+    return textureBuilder.build();
+}
+
 Resource::SharedPtr<::lug::Graphics::Render::SkyBox> build(const ::lug::Graphics::Builder::SkyBox& builder) {
     // Constructor of SkyBox is private, we can't use std::make_unique
     std::unique_ptr<Resource> resource{new Vulkan::Render::SkyBox(builder._name)};
@@ -341,6 +473,26 @@ Resource::SharedPtr<::lug::Graphics::Render::SkyBox> build(const ::lug::Graphics
         return nullptr;
     }
 
+    if (!builder._environmentCache.empty()) {
+        const std::string irradianceFilename = builder._environmentCache + "_irradiance.ktx2";
+        const std::string specularFilename = builder._environmentCache + "_specular.ktx2";
+        const std::string brdfLutFilename = builder._environmentCache + "_brdf.ktx2";
+
+        if (!initEnvironmentCache(builder._faces, irradianceFilename, specularFilename, brdfLutFilename)) {
+            LUG_LOG.error("Resource::SharedPtr<::lug::Graphics::Render::SkyBox>::build Can't create the environment cache");
+            return nullptr;
+        }
+
+        skyBox->_irradianceMap = buildEnvironmentTexture(builder._renderer, irradianceFilename, lug::Graphics::Builder::Texture::Type::CubeMap);
+        skyBox->_specularMap = buildEnvironmentTexture(builder._renderer, specularFilename, lug::Graphics::Builder::Texture::Type::CubeMap);
+        skyBox->_brdfLut = buildEnvironmentTexture(builder._renderer, brdfLutFilename, lug::Graphics::Builder::Texture::Type::Texture2D);
+
+        if (!skyBox->hasEnvironment()) {
+            LUG_LOG.error("Resource::SharedPtr<::lug::Graphics::Render::SkyBox>::build Can't create the environment textures");
+            return nullptr;
+        }
+    }
+
     // Init the skyBox pipeline and mesh only one time
     if (!Render::SkyBox::_skyBoxCount) {
         if (!initPipeline(renderer, Render::SkyBox::_pipeline) || !initMesh(renderer, Render::SkyBox::_mesh)) {
@@ -1,5 +1,9 @@
 #include <lug/Graphics/Vulkan/Builder/Texture.hpp>
 
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
 #if defined(LUG_SYSTEM_WINDOWS)
     #pragma warning(push)
     #pragma warning(disable : 4244)
@@ -20,7 +24,11 @@
 #endif
 
 #include <lug/Graphics/Builder/Texture.hpp>
+#include <lug/Graphics/Render/BlockCompression.hpp>
+#include <lug/Graphics/Render/Ktx2.hpp>
+#include <lug/Graphics/Render/Mipmap.hpp>
 #include <lug/Graphics/Renderer.hpp>
+#include <lug/Graphics/TextureStreamer.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/CommandBuffer.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/Fence.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/Sampler.hpp>
@@ -33,23 +41,272 @@ namespace Vulkan {
 namespace Builder {
 namespace Texture {
 
-static void freePixels(std::vector<stbi_uc*> layersPixels) {
-    for (auto& pixels: layersPixels) {
-        stbi_image_free(pixels);
+namespace BlockCompression = ::lug::Graphics::Render::BlockCompression;
+namespace Ktx2 = ::lug::Graphics::Render::Ktx2;
+namespace Mipmap = ::lug::Graphics::Render::Mipmap;
+
+// Layers loaded from the files of the texture
+struct Image {
+    VkFormat format;
+    uint32_t width;
+    uint32_t height;
+    uint32_t levelsCount;                       // Levels in the file, the others are generated if generateMipmaps is set
+    bool generateMipmaps;
+    std::vector<std::vector<uint8_t>> layers;   // Levels of each layer, packed one after the other
+
+    // Set by selectLevels, the image can start at a level of the texture for the streamed textures
+    uint32_t textureWidth;
+    uint32_t textureHeight;
+    uint32_t textureLevelsCount;
+    uint32_t firstLevel;
+};
+
+static bool readFile(const std::string& filename, std::vector<uint8_t>& data) {
+#if defined(LUG_SYSTEM_ANDROID)
+    // Load image from compressed asset
+    AAsset* asset = AAssetManager_open((lug::Window::priv::WindowImpl::activity)->assetManager, filename.c_str(), AASSET_MODE_STREAMING);
+
+    if (!asset) {
+        LUG_LOG.error("Vulkan::Texture::load: Can't open Android asset \"{}\"", filename);
+        return false;
+    }
+
+    const off_t size = AAsset_getLength(asset);
+
+    if (size <= 0) {
+        LUG_LOG.error("Vulkan::Texture::load: Android asset \"{}\" is empty", filename);
+        AAsset_close(asset);
+        return false;
     }
+
+    data.resize(static_cast<size_t>(size));
+
+    AAsset_read(asset, reinterpret_cast<char*>(data.data()), data.size());
+    AAsset_close(asset);
+#else
+    std::ifstream file(filename, std::ios::binary);
+
+    if (!file.good()) {
+        LUG_LOG.error("Vulkan::Texture::load: Can't open file \"{}\"", filename);
+        return false;
+    }
+
+    file.seekg(0, file.end);
+    data.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0, file.beg);
+
+    file.read(reinterpret_cast<char*>(data.data()), data.size());
+#endif
+
+    return true;
 }
 
-Resource::SharedPtr<::lug::Graphics::Render::Texture> build(const ::lug::Graphics::Builder::Texture& builder) {
-    // Constructor of Texture is private, we can't use std::make_unique
-    std::unique_ptr<Resource> resource{new Vulkan::Render::Texture(builder._name)};
-    Vulkan::Render::Texture* texture = static_cast<Vulkan::Render::Texture*>(resource.get());
+// The compressed formats need their feature to be enabled on the device
+static bool isFormatSupported(const Renderer& renderer, VkFormat format) {
+    const VkPhysicalDeviceFeatures& features = renderer.getLoadedDeviceFeatures();
 
-    if (!builder._layers.size()) {
-        LUG_LOG.error("Vulkan::Texture::build: Not layers added");
-        return nullptr;
+    if ((format >= VK_FORMAT_BC1_RGB_UNORM_BLOCK && format <= VK_FORMAT_BC7_SRGB_BLOCK && !features.textureCompressionBC) ||
+        (format >= VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK && format <= VK_FORMAT_EAC_R11G11_SNORM_BLOCK && !features.textureCompressionETC2) ||
+        (format >= VK_FORMAT_ASTC_4x4_UNORM_BLOCK && format <= VK_FORMAT_ASTC_12x12_SRGB_BLOCK && !features.textureCompressionASTC_LDR)) {
+        return false;
     }
 
-    Vulkan::Renderer& renderer = static_cast<Vulkan::Renderer&>(builder._renderer);
+    const auto& formatsProperties = renderer.getPhysicalDeviceInfo()->formatProperties;
+    const auto formatProperties = formatsProperties.find(format);
+
+    return formatProperties != formatsProperties.end() && (formatProperties->second.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT);
+}
+
+static bool loadKtx2(const Renderer& renderer, const std::string& filename, const std::vector<uint8_t>& data, const Ktx2::Image& ktx2, bool srgb, Image& image) {
+    if (ktx2.supercompressionScheme != Ktx2::SupercompressionScheme::None) {
+        LUG_LOG.error("Vulkan::Texture::load: The supercompression scheme {} of \"{}\" is not supported", static_cast<uint32_t>(ktx2.supercompressionScheme), filename);
+        return false;
+    }
+
+    Ktx2::FormatInfo info;
+    if (!Ktx2::getFormatInfo(ktx2.format, info)) {
+        LUG_LOG.error("Vulkan::Texture::load: The format {} of \"{}\" is not supported", static_cast<uint32_t>(ktx2.format), filename);
+        return false;
+    }
+
+    // The colors are decoded from sRGB by the sampler, the files which are already sRGB stay sRGB
+    const Ktx2::Format sourceFormat = srgb ? Ktx2::getSrgbFormat(ktx2.format) : ktx2.format;
+
+    // The blocks are decoded on the CPU when the device can't sample them
+    BlockCompression::Format blockFormat{};
+    Ktx2::Format format = sourceFormat;
+    bool decode = false;
+
+    if (!isFormatSupported(renderer, static_cast<VkFormat>(sourceFormat))) {
+        if (!Ktx2::getDecodedFormat(sourceFormat, blockFormat, format)) {
+            LUG_LOG.error("Vulkan::Texture::load: The format {} of \"{}\" is not supported by the device", static_cast<uint32_t>(ktx2.format), filename);
+            return false;
+        }
+
+        decode = true;
+    }
+
+    image.format = static_cast<VkFormat>(format);
+    image.width = ktx2.width;
+    image.height = ktx2.height;
+    image.levelsCount = static_cast<uint32_t>(ktx2.levels.size());
+    image.generateMipmaps = ktx2.generateMipmaps;
+
+    // The images of a level are sorted by layer then by face, each face is a layer of the texture
+    image.layers.resize(ktx2.layersCount * ktx2.facesCount);
+
+    for (uint32_t level = 0; level < image.levelsCount; ++level) {
+        const uint32_t width = std::max(ktx2.width >> level, 1u);
+        const uint32_t height = std::max(ktx2.height >> level, 1u);
+        const size_t imageSize = Ktx2::getImageSize(info, width, height);
+
+        for (size_t layer = 0; layer < image.layers.size(); ++layer) {
+            const uint8_t* src = data.data() + ktx2.levels[level].offset + layer * imageSize;
+            std::vector<uint8_t>& dst = image.layers[layer];
+
+            if (!decode) {
+                dst.insert(dst.end(), src, src + imageSize);
+                continue;
+            }
+
+            const size_t offset = dst.size();
+            dst.resize(offset + static_cast<size_t>(width) * height * 4);
+            BlockCompression::decode(blockFormat, src, width, height, dst.data() + offset);
+
+            // The formats of BC1 without alpha decode the transparent texels as opaque black
+            if (ktx2.format == Ktx2::Format::BC1RgbUnorm || ktx2.format == Ktx2::Format::BC1RgbSrgb) {
+                for (size_t i = offset + 3; i < dst.size(); i += 4) {
+                    dst[i] = 255;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+static bool loadImage(const std::string& filename, const std::vector<uint8_t>& data, bool srgb, Image& image) {
+    int width{0};
+    int height{0};
+    int channels{0};
+
+    stbi_uc* pixels = stbi_load_from_memory(data.data(), static_cast<int>(data.size()), &width, &height, &channels, STBI_rgb_alpha);
+
+    if (!pixels) {
+        LUG_LOG.error("Vulkan::Texture::load: Failed to load the image \"{}\"", filename);
+        return false;
+    }
+
+    image.format = srgb ? VK_FORMAT_R8G8B8A8_SRGB : VK_FORMAT_R8G8B8A8_UNORM;
+    image.width = static_cast<uint32_t>(width);
+    image.height = static_cast<uint32_t>(height);
+    image.levelsCount = 1;
+    image.generateMipmaps = true;
+    image.layers.emplace_back(pixels, pixels + static_cast<size_t>(width) * height * 4);
+
+    stbi_image_free(pixels);
+
+    return true;
+}
+
+// Layout of a chain of levels of any format, the blocks of the levels are packed one after the other
+static std::vector<Mipmap::Level> getLevels(VkFormat format, uint32_t width, uint32_t height, uint32_t levelsCount) {
+    Ktx2::FormatInfo info;
+    Ktx2::getFormatInfo(static_cast<Ktx2::Format>(format), info);
+
+    std::vector<Mipmap::Level> levels(levelsCount);
+    size_t offset = 0;
+
+    for (uint32_t level = 0; level < levelsCount; ++level) {
+        levels[level].width = std::max(width >> level, 1u);
+        levels[level].height = std::max(height >> level, 1u);
+        levels[level].offset = offset;
+        levels[level].size = Ktx2::getImageSize(info, levels[level].width, levels[level].height);
+
+        offset += levels[level].size;
+    }
+
+    return levels;
+}
+
+// Reads the layers of a texture from its files, doesn't use the device so it can be called from a loader thread
+static bool readImage(const Renderer& renderer, const std::vector<std::string>& filenames, bool srgb, Image& image) {
+    for (const auto& filename: filenames) {
+        std::vector<uint8_t> data;
+        if (!readFile(filename, data)) {
+            return false;
+        }
+
+        Image fileImage;
+
+        // The KTX2 files are recognized by their identifier, the others are decoded by stb_image
+        Ktx2::Image ktx2;
+        const Ktx2::Result result = Ktx2::read(data.data(), data.size(), ktx2);
+
+        if (result == Ktx2::Result::InvalidIdentifier) {
+            if (!loadImage(filename, data, srgb, fileImage)) {
+                return false;
+            }
+        } else if (result != Ktx2::Result::Success) {
+            LUG_LOG.error("Vulkan::Texture::load: Can't read the KTX2 file \"{}\": {}", filename, Ktx2::toString(result));
+            return false;
+        } else if (!loadKtx2(renderer, filename, data, ktx2, srgb, fileImage)) {
+            return false;
+        }
+
+        if (image.layers.empty()) {
+            image = std::move(fileImage);
+            continue;
+        }
+
+        if (fileImage.format != image.format || fileImage.width != image.width || fileImage.height != image.height || fileImage.levelsCount != image.levelsCount) {
+            LUG_LOG.error("Vulkan::Texture::load: The image \"{}\" doesn't have the size or format of the previous layers", filename);
+            return false;
+        }
+
+        std::move(fileImage.layers.begin(), fileImage.layers.end(), std::back_inserter(image.layers));
+    }
+
+    return true;
+}
+
+// Only the RGBA8 images can have their levels generated, the compressed ones keep the levels of their file
+static uint32_t getTextureLevelsCount(const Image& image, uint32_t mipLevels) {
+    const bool uncompressed = image.format == VK_FORMAT_R8G8B8A8_UNORM || image.format == VK_FORMAT_R8G8B8A8_SRGB;
+
+    return image.generateMipmaps && uncompressed ? static_cast<uint32_t>(Mipmap::getLevels(image.width, image.height, mipLevels).size()) : image.levelsCount;
+}
+
+// Removes the levels before firstLevel, the levels missing from the files are then generated on the CPU
+static void selectLevels(Image& image, uint32_t levelsCount, uint32_t firstLevel) {
+    image.textureWidth = image.width;
+    image.textureHeight = image.height;
+    image.textureLevelsCount = levelsCount;
+    image.firstLevel = std::min(firstLevel, levelsCount - 1);
+
+    if (!image.firstLevel) {
+        return;
+    }
+
+    const std::vector<Mipmap::Level> levels = getLevels(image.format, image.width, image.height, levelsCount);
+
+    for (auto& layer: image.layers) {
+        if (image.levelsCount < levelsCount) {
+            layer.resize(static_cast<size_t>(levels.back().offset + levels.back().size));
+            Mipmap::generate(layer.data(), levels);
+        }
+
+        layer.erase(layer.begin(), layer.begin() + static_cast<size_t>(levels[image.firstLevel].offset));
+    }
+
+    image.width = levels[image.firstLevel].width;
+    image.height = levels[image.firstLevel].height;
+    image.levelsCount = levelsCount - image.firstLevel;
+    image.generateMipmaps = false;
+}
+
+// Creates an image with the levels of the loaded image and uploads them
+static bool upload(Renderer& renderer, const Image& image, bool cubeMap, API::Image& textureImage, API::DeviceMemory& textureDeviceMemory, API::ImageView& textureImageView) {
     API::Device &device = renderer.getDevice();
 
     // Get transfer queue family and retrieve the first queue
@@ -57,8 +314,8 @@ Resource::SharedPtr<::lug::Graphics::Render::Texture> build(const ::lug::Graphic
     {
         transferQueue = device.getQueue("queue_transfer");
         if (!transferQueue) {
-            LUG_LOG.error("Vulkan::Texture::build: Can't find transfer queue");
-            return nullptr;
+            LUG_LOG.error("Vulkan::Texture::load: Can't find transfer queue");
+            return false;
         }
     }
 
@@ -68,127 +325,100 @@ Resource::SharedPtr<::lug::Graphics::Render::Texture> build(const ::lug::Graphic
         VkResult result{VK_SUCCESS};
         API::Builder::CommandPool commandPoolBuilder(device, *transferQueue->getQueueFamily());
         if (!commandPoolBuilder.build(transferQueueCommandPool, &result)) {
-            LUG_LOG.error("Vulkan::Texture::build: Can't create a command pool: {}", result);
-            return nullptr;
+            LUG_LOG.error("Vulkan::Texture::load: Can't create a command pool: {}", result);
+            return false;
         }
     }
 
-    int texWidth{0};
-    int texHeight{0};
-    int texChannels{0};
-    std::vector<stbi_uc*> layersPixels;
-    for (auto& layer: builder._layers) {
-#if defined(LUG_SYSTEM_ANDROID)
-        // Load shader from compressed asset
-        AAsset* asset = AAssetManager_open((lug::Window::priv::WindowImpl::activity)->assetManager, layer.filename.c_str(), AASSET_MODE_STREAMING);
-
-        if (!asset) {
-            LUG_LOG.error("Vulkan::Texture::build: Can't open Android asset \"{}\"", layer.filename);
-            freePixels(layersPixels);
-            return nullptr;
-        }
-
-        uint32_t size = AAsset_getLength(asset);
-
-        if (size <= 0) {
-            LUG_LOG.error("Vulkan::Texture::build: Android asset \"{}\" is empty", layer.filename);
-            freePixels(layersPixels);
-            return nullptr;
-        }
-
-        unsigned char* data = new unsigned char[size];
-
-        AAsset_read(asset, reinterpret_cast<char*>(data), size);
-        AAsset_close(asset);
-
-        stbi_uc* pixels = stbi_load_from_memory(data, size, &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
+    const uint32_t layersCount = static_cast<uint32_t>(image.layers.size());
+    const std::vector<Mipmap::Level> levels = getLevels(image.format, image.width, image.height, image.textureLevelsCount - image.firstLevel);
+    const uint32_t levelsCount = static_cast<uint32_t>(levels.size());
 
-        delete[] data;
-#else
-        stbi_uc* pixels = stbi_load(layer.filename.c_str(), &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
-#endif
-
-        if (!pixels) {
-            LUG_LOG.error("Vulkan::Texture::build: Failed to load the image \"{}\"", layer.filename);
-            freePixels(layersPixels);
-            return nullptr;
-        }
+    // The levels are generated by blits when possible, blits require a graphics queue
+    // and the format to support linear filtering. Otherwise they are generated on the CPU
+    // and the whole chain is uploaded.
+    bool generateWithBlits = false;
+    if (levelsCount > image.levelsCount && (transferQueue->getQueueFamily()->getFlags() & VK_QUEUE_GRAPHICS_BIT)) {
+        const VkFormatFeatureFlags blitFeatures = VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT | VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
+        const auto& formatsProperties = device.getPhysicalDeviceInfo()->formatProperties;
+        const auto formatProperties = formatsProperties.find(image.format);
 
-        layersPixels.push_back(pixels);
+        generateWithBlits = formatProperties != formatsProperties.end() && (formatProperties->second.optimalTilingFeatures & blitFeatures) == blitFeatures;
     }
 
+    const uint32_t uploadedLevelsCount = generateWithBlits ? image.levelsCount : levelsCount;
+    const VkDeviceSize layerSize = levels[uploadedLevelsCount - 1].offset + levels[uploadedLevelsCount - 1].size;
+
     // Create the API::Image
     {
         API::Builder::Image imageBuilder(device);
 
-        imageBuilder.setUsage(VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT);
-        imageBuilder.setPreferedFormats({ VK_FORMAT_R8G8B8A8_UNORM });
+        imageBuilder.setUsage(VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT | (generateWithBlits ? VK_IMAGE_USAGE_TRANSFER_SRC_BIT : 0));
+        imageBuilder.setPreferedFormats({ image.format });
         imageBuilder.setFeatureFlags(VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT);
         imageBuilder.setQueueFamilyIndices({ transferQueue->getQueueFamily()->getIdx() });
         imageBuilder.setTiling(VK_IMAGE_TILING_OPTIMAL);
-        imageBuilder.setArrayLayers(static_cast<uint32_t>(layersPixels.size()));
+        imageBuilder.setArrayLayers(layersCount);
+        imageBuilder.setMipLevels(levelsCount);
 
         API::Builder::DeviceMemory deviceMemoryBuilder(device);
         deviceMemoryBuilder.setMemoryFlags(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
 
         VkExtent3D extent{
-            /* extent.width */ static_cast<uint32_t>(texWidth),
-            /* extent.height */ static_cast<uint32_t>(texHeight),
+            /* extent.width */ image.width,
+            /* extent.height */ image.height,
             /* extent.depth */ 1
         };
 
         imageBuilder.setExtent(extent);
 
-        if (builder._type == ::lug::Graphics::Builder::Texture::Type::CubeMap) {
+        if (cubeMap) {
             imageBuilder.setCreateFlags(VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT);
         }
 
         {
             VkResult result{VK_SUCCESS};
-            if (!imageBuilder.build(texture->_image, &result)) {
-                LUG_LOG.error("Vulkan::Texture::build: Can't create the image: {}", result);
-                freePixels(layersPixels);
-                return nullptr;
+            if (!imageBuilder.build(textureImage, &result)) {
+                LUG_LOG.error("Vulkan::Texture::load: Can't create the image: {}", result);
+                return false;
             }
 
-            if (!deviceMemoryBuilder.addImage(texture->_image)) {
-                LUG_LOG.error("Vulkan::Texture::build: Can't add image to device memory");
-                freePixels(layersPixels);
-                return nullptr;
+            if (!deviceMemoryBuilder.addImage(textureImage)) {
+                LUG_LOG.error("Vulkan::Texture::load: Can't add image to device memory");
+                return false;
             }
 
             result = VK_SUCCESS;
-            if (!deviceMemoryBuilder.build(texture->_deviceMemory, &result)) {
-                LUG_LOG.error("Vulkan::Texture::build: Can't create buffer device memory: {}", result);
-                freePixels(layersPixels);
-                return nullptr;
+            if (!deviceMemoryBuilder.build(textureDeviceMemory, &result)) {
+                LUG_LOG.error("Vulkan::Texture::load: Can't create buffer device memory: {}", result);
+                return false;
             }
         }
     }
 
     // Create image view
     {
-        API::Builder::ImageView imageViewBuilder(device, texture->_image);
+        API::Builder::ImageView imageViewBuilder(device, textureImage);
 
-        imageViewBuilder.setFormat(texture->_image.getFormat());
+        imageViewBuilder.setFormat(textureImage.getFormat());
         imageViewBuilder.setAspectFlags(VK_IMAGE_ASPECT_COLOR_BIT);
-        imageViewBuilder.setLayerCount(static_cast<uint32_t>(layersPixels.size()));
+        imageViewBuilder.setLayerCount(layersCount);
+        imageViewBuilder.setLevelCount(levelsCount);
 
-        if (builder._type == ::lug::Graphics::Builder::Texture::Type::CubeMap) {
+        if (cubeMap) {
             imageViewBuilder.setViewType(VK_IMAGE_VIEW_TYPE_CUBE);
         }
 
         VkResult result{VK_SUCCESS};
-        if (!imageViewBuilder.build(texture->_imageView, &result)) {
-            LUG_LOG.error("Vulkan::Texture::build: Can't create image view: {}", result);
-            freePixels(layersPixels);
-            return nullptr;
+        if (!imageViewBuilder.build(textureImageView, &result)) {
+            LUG_LOG.error("Vulkan::Texture::load: Can't create image view: {}", result);
+            return false;
         }
     }
 
     // Create staging buffers for image upload
     {
-        VkDeviceSize imageSize = texWidth * texHeight * 4 * layersPixels.size();
+        VkDeviceSize imageSize = layerSize * layersCount;
 
         API::Buffer stagingBuffer;
         API::DeviceMemory stagingBufferMemory;
@@ -204,9 +434,8 @@ Resource::SharedPtr<::lug::Graphics::Render::Texture> build(const ::lug::Graphic
 
             VkResult result{VK_SUCCESS};
             if (!bufferBuilder.build(stagingBuffer, &result)) {
-                LUG_LOG.error("Vulkan::Texture::build: Can't create staging buffer: {}", result);
-                freePixels(layersPixels);
-                return nullptr;
+                LUG_LOG.error("Vulkan::Texture::load: Can't create staging buffer: {}", result);
+                return false;
             }
         }
 
@@ -218,23 +447,33 @@ Resource::SharedPtr<::lug::Graphics::Render::Texture> build(const ::lug::Graphic
 
             VkResult result{VK_SUCCESS};
             if (!deviceMemoryBuilder.build(stagingBufferMemory, &result)) {
-                LUG_LOG.error("Vulkan::Texture::build: Can't create staging buffer device memory: {}", result);
-                freePixels(layersPixels);
-                return nullptr;
+                LUG_LOG.error("Vulkan::Texture::load: Can't create staging buffer device memory: {}", result);
+                return false;
             }
         }
 
         // Update buffer data
-        VkDeviceSize layerSize{imageSize / layersPixels.size()};
         {
             VkDeviceSize pixelsOffset{0};
-            for (stbi_uc* pixels: layersPixels) {
-                stagingBuffer.updateData(pixels, layerSize, pixelsOffset);
-                pixelsOffset += layerSize;
+
+            if (uploadedLevelsCount == image.levelsCount) {
+                for (const auto& layer: image.layers) {
+                    stagingBuffer.updateData(layer.data(), layerSize, pixelsOffset);
+                    pixelsOffset += layerSize;
+                }
+            } else {
+                std::vector<uint8_t> chain(static_cast<size_t>(layerSize));
+
+                for (const auto& layer: image.layers) {
+                    std::copy(layer.begin(), layer.end(), chain.begin());
+                    Mipmap::generate(chain.data(), levels);
+
+                    stagingBuffer.updateData(chain.data(), layerSize, pixelsOffset);
+                    pixelsOffset += layerSize;
+                }
             }
         }
 
-
         // Copy buffer data to font image
         {
             VkResult result{VK_SUCCESS};
@@ -244,9 +483,8 @@ Resource::SharedPtr<::lug::Graphics::Render::Texture> build(const ::lug::Graphic
             commandBufferBuilder.setLevel(VK_COMMAND_BUFFER_LEVEL_PRIMARY);
 
             if (!commandBufferBuilder.build(commandBuffer, &result)) {
-                LUG_LOG.error("Gui::init: Can't create the command buffer: {}", result);
-                freePixels(layersPixels);
-                return nullptr;
+                LUG_LOG.error("Vulkan::Texture::load: Can't create the command buffer: {}", result);
+                return false;
             }
 
             // Create fence
@@ -255,9 +493,8 @@ Resource::SharedPtr<::lug::Graphics::Render::Texture> build(const ::lug::Graphic
                 API::Builder::Fence fenceBuilder(device);
 
                 if (!fenceBuilder.build(fence, &result)) {
-                    LUG_LOG.error("Vulkan::Texture::build: Can't create swapchain fence: {}", result);
-                    freePixels(layersPixels);
-                    return nullptr;
+                    LUG_LOG.error("Vulkan::Texture::load: Can't create swapchain fence: {}", result);
+                    return false;
                 }
             }
 
@@ -271,40 +508,43 @@ Resource::SharedPtr<::lug::Graphics::Render::Texture> build(const ::lug::Graphic
                 pipelineBarrier.imageMemoryBarriers[0].dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
                 pipelineBarrier.imageMemoryBarriers[0].oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
                 pipelineBarrier.imageMemoryBarriers[0].newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-                pipelineBarrier.imageMemoryBarriers[0].image = &texture->_image;
-                pipelineBarrier.imageMemoryBarriers[0].subresourceRange.layerCount = static_cast<uint32_t>(layersPixels.size());
+                pipelineBarrier.imageMemoryBarriers[0].image = &textureImage;
+                pipelineBarrier.imageMemoryBarriers[0].subresourceRange.levelCount = levelsCount;
+                pipelineBarrier.imageMemoryBarriers[0].subresourceRange.layerCount = layersCount;
 
                 commandBuffer.pipelineBarrier(pipelineBarrier);
             }
 
-            std::vector<VkBufferImageCopy> bufferCopyRegions(layersPixels.size());
-            VkDeviceSize pixelsOffset{0};
-            for (uint32_t i = 0; i < layersPixels.size(); ++i) {
-                // Copy
-                VkBufferImageCopy bufferCopyRegion{
-                    /* bufferCopyRegion.bufferOffset */ pixelsOffset,
-                    /* bufferCopyRegion.bufferRowLength */ 0,
-                    /* bufferCopyRegion.bufferImageHeight */ 0,
-                    {
-                        /* bufferCopyRegion.imageSubresource.aspectMask */ VK_IMAGE_ASPECT_COLOR_BIT,
-                        /* bufferCopyRegion.imageSubresource.mipLevel */ 0,
-                        /* bufferCopyRegion.imageSubresource.baseArrayLayer */ i,
-                        /* bufferCopyRegion.imageSubresource.layerCount */ 1
-                    },
-                    {
-                        /* bufferCopyRegion.imageOffset.x */ 0,
-                        /* bufferCopyRegion.imageOffset.y */ 0,
-                        /* bufferCopyRegion.imageOffset.z */ 0,
-                    },
-                    {
-                        /* bufferCopyRegion.imageExtent.width */ static_cast<uint32_t>(texWidth),
-                        /* bufferCopyRegion.imageExtent.height */ static_cast<uint32_t>(texHeight),
-                        /* bufferCopyRegion.imageExtent.depth */ 1
-                    }
-                };
-
-                bufferCopyRegions[i] = bufferCopyRegion;
-                pixelsOffset += layerSize;
+            // All the uploaded levels of all the layers are copied at once
+            std::vector<VkBufferImageCopy> bufferCopyRegions;
+            bufferCopyRegions.reserve(layersCount * uploadedLevelsCount);
+            for (uint32_t i = 0; i < layersCount; ++i) {
+                for (uint32_t level = 0; level < uploadedLevelsCount; ++level) {
+                    // Copy
+                    VkBufferImageCopy bufferCopyRegion{
+                        /* bufferCopyRegion.bufferOffset */ layerSize * i + levels[level].offset,
+                        /* bufferCopyRegion.bufferRowLength */ 0,
+                        /* bufferCopyRegion.bufferImageHeight */ 0,
+                        {
+                            /* bufferCopyRegion.imageSubresource.aspectMask */ VK_IMAGE_ASPECT_COLOR_BIT,
+                            /* bufferCopyRegion.imageSubresource.mipLevel */ level,
+                            /* bufferCopyRegion.imageSubresource.baseArrayLayer */ i,
+                            /* bufferCopyRegion.imageSubresource.layerCount */ 1
+                        },
+                        {
+                            /* bufferCopyRegion.imageOffset.x */ 0,
+                            /* bufferCopyRegion.imageOffset.y */ 0,
+                            /* bufferCopyRegion.imageOffset.z */ 0,
+                        },
+                        {
+                            /* bufferCopyRegion.imageExtent.width */ levels[level].width,
+                            /* bufferCopyRegion.imageExtent.height */ levels[level].height,
+                            /* bufferCopyRegion.imageExtent.depth */ 1
+                        }
+                    };
+
+                    bufferCopyRegions.push_back(bufferCopyRegion);
+                }
             }
 
 
@@ -313,12 +553,63 @@ Resource::SharedPtr<::lug::Graphics::Render::Texture> build(const ::lug::Graphic
             vkCmdCopyBufferToImage(
                 static_cast<VkCommandBuffer>(commandBuffer),
                 static_cast<VkBuffer>(stagingBuffer),
-                static_cast<VkImage>(texture->_image),
+                static_cast<VkImage>(textureImage),
                 VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
                 static_cast<uint32_t>(bufferCopyRegions.size()),
                 bufferCopyRegions.data()
             );
 
+            // Each level is blitted from the previous one, which becomes a transfer source
+            for (uint32_t level = 1; generateWithBlits && level < levelsCount; ++level) {
+                {
+                    API::CommandBuffer::CmdPipelineBarrier pipelineBarrier;
+                    pipelineBarrier.imageMemoryBarriers.resize(1);
+                    pipelineBarrier.imageMemoryBarriers[0].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                    pipelineBarrier.imageMemoryBarriers[0].dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+                    pipelineBarrier.imageMemoryBarriers[0].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+                    pipelineBarrier.imageMemoryBarriers[0].newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+                    pipelineBarrier.imageMemoryBarriers[0].image = &textureImage;
+                    pipelineBarrier.imageMemoryBarriers[0].subresourceRange.baseMipLevel = level - 1;
+                    pipelineBarrier.imageMemoryBarriers[0].subresourceRange.layerCount = layersCount;
+
+                    commandBuffer.pipelineBarrier(pipelineBarrier, 0, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+                }
+
+                const VkImageBlit imageBlit{
+                    {
+                        /* imageBlit.srcSubresource.aspectMask */ VK_IMAGE_ASPECT_COLOR_BIT,
+                        /* imageBlit.srcSubresource.mipLevel */ level - 1,
+                        /* imageBlit.srcSubresource.baseArrayLayer */ 0,
+                        /* imageBlit.srcSubresource.layerCount */ layersCount
+                    },
+                    {
+                        {0, 0, 0},
+                        {static_cast<int32_t>(levels[level - 1].width), static_cast<int32_t>(levels[level - 1].height), 1}
+                    },
+                    {
+                        /* imageBlit.dstSubresource.aspectMask */ VK_IMAGE_ASPECT_COLOR_BIT,
+                        /* imageBlit.dstSubresource.mipLevel */ level,
+                        /* imageBlit.dstSubresource.baseArrayLayer */ 0,
+                        /* imageBlit.dstSubresource.layerCount */ layersCount
+                    },
+                    {
+                        {0, 0, 0},
+                        {static_cast<int32_t>(levels[level].width), static_cast<int32_t>(levels[level].height), 1}
+                    }
+                };
+
+                vkCmdBlitImage(
+                    static_cast<VkCommandBuffer>(commandBuffer),
+                    static_cast<VkImage>(textureImage),
+                    VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                    static_cast<VkImage>(textureImage),
+                    VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                    1,
+                    &imageBlit,
+                    VK_FILTER_LINEAR
+                );
+            }
+
             // Prepare for shader read
             {
                 API::CommandBuffer::CmdPipelineBarrier pipelineBarrier;
@@ -327,28 +618,39 @@ Resource::SharedPtr<::lug::Graphics::Render::Texture> build(const ::lug::Graphic
                 pipelineBarrier.imageMemoryBarriers[0].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
                 pipelineBarrier.imageMemoryBarriers[0].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
                 pipelineBarrier.imageMemoryBarriers[0].newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-                pipelineBarrier.imageMemoryBarriers[0].image = &texture->_image;
+                pipelineBarrier.imageMemoryBarriers[0].image = &textureImage;
+                pipelineBarrier.imageMemoryBarriers[0].subresourceRange.layerCount = layersCount;
+
+                if (generateWithBlits) {
+                    // Only the last level is still a transfer destination
+                    pipelineBarrier.imageMemoryBarriers[0].subresourceRange.baseMipLevel = levelsCount - 1;
+
+                    pipelineBarrier.imageMemoryBarriers.push_back(pipelineBarrier.imageMemoryBarriers[0]);
+                    pipelineBarrier.imageMemoryBarriers[1].srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+                    pipelineBarrier.imageMemoryBarriers[1].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+                    pipelineBarrier.imageMemoryBarriers[1].subresourceRange.baseMipLevel = 0;
+                    pipelineBarrier.imageMemoryBarriers[1].subresourceRange.levelCount = levelsCount - 1;
+                } else {
+                    pipelineBarrier.imageMemoryBarriers[0].subresourceRange.levelCount = levelsCount;
+                }
 
                 commandBuffer.pipelineBarrier(pipelineBarrier);
             }
 
             if (commandBuffer.end() == false) {
-                LUG_LOG.error("Vulkan::Texture::build: Failed to end commandBuffer");
-                freePixels(layersPixels);
-                return nullptr;
+                LUG_LOG.error("Vulkan::Texture::load: Failed to end commandBuffer");
+                return false;
             }
 
             if (transferQueue->submit(commandBuffer, {}, {}, {}, static_cast<VkFence>(fence)) == false) {
-                LUG_LOG.error("Vulkan::Texture::build: Can't submit commandBuffer");
-                freePixels(layersPixels);
-                return nullptr;
+                LUG_LOG.error("Vulkan::Texture::load: Can't submit commandBuffer");
+                return false;
             }
 
             // TODO(saveman71): set a define for the fence timeout
             if (!fence.wait()) {
-                LUG_LOG.error("Vulkan::Texture::build: Can't vkWaitForFences");
-                freePixels(layersPixels);
-                return nullptr;
+                LUG_LOG.error("Vulkan::Texture::load: Can't vkWaitForFences");
+                return false;
             }
 
             // Properly destroy everything in the right order
@@ -356,10 +658,152 @@ Resource::SharedPtr<::lug::Graphics::Render::Texture> build(const ::lug::Graphic
             stagingBufferMemory.destroy();
             stagingBuffer.destroy();
             commandBuffer.destroy();
+        }
+    }
+
+    return true;
+}
+
+bool load(Renderer& renderer, Render::Texture& texture) {
+    const bool srgb = texture._colorSpace == ::lug::Graphics::Render::Texture::ColorSpace::sRGB;
+
+    Image image{};
+    if (!readImage(renderer, texture._layersFilenames, srgb, image)) {
+        return false;
+    }
+
+    return load(renderer, texture, image);
+}
+
+bool load(Renderer& renderer, Render::Texture& texture, Image& image) {
+    const uint32_t levelsCount = getTextureLevelsCount(image, texture._mipLevels);
+
+    // The streamed textures are loaded from their base level the first time, then from their resident level
+    uint32_t firstLevel = texture._firstLevel;
+    if (texture._streaming && !texture._levelsCount) {
+        firstLevel = TextureStreamer::getBaseLevel(image.width, image.height, levelsCount, renderer.getResourceManager()->getTextureStreamer().getBaseSize());
+    }
+
+    selectLevels(image, levelsCount, firstLevel);
+
+    if (!upload(renderer, image, texture._cubeMap, texture._image, texture._deviceMemory, texture._imageView)) {
+        return false;
+    }
+
+    texture._format = image.format;
+    texture._width = image.textureWidth;
+    texture._height = image.textureHeight;
+    texture._layersCount = static_cast<uint32_t>(image.layers.size());
+    texture._levelsCount = image.textureLevelsCount;
+    texture._firstLevel = image.firstLevel;
+
+    ++texture._version;
+
+    return true;
+}
+
+std::shared_ptr<Image> read(const Renderer& renderer, const std::vector<std::string>& filenames, ::lug::Graphics::Render::Texture::ColorSpace colorSpace) {
+    std::shared_ptr<Image> image = std::make_shared<Image>();
+
+    if (!readImage(renderer, filenames, colorSpace == ::lug::Graphics::Render::Texture::ColorSpace::sRGB, *image)) {
+        return nullptr;
+    }
+
+    return image;
+}
+
+void unload(Renderer& renderer, Render::Texture& texture) {
+    renderer.destroyLater(std::move(texture._image), std::move(texture._imageView), std::move(texture._deviceMemory));
+}
+
+AsyncLoader::Task createStreamTask(Renderer& renderer, Resource::SharedPtr<Render::Texture> texture, uint32_t firstLevel) {
+    // Shared between the two stages of the stream
+    std::shared_ptr<Image> image = std::make_shared<Image>();
+
+    // The texture can be removed while its files are read, the read stage only uses copies
+    const Resource::Handle handle = texture->getHandle();
+    const std::vector<std::string> layersFilenames = texture->_layersFilenames;
+    const bool srgb = texture->_colorSpace == ::lug::Graphics::Render::Texture::ColorSpace::sRGB;
+    const uint32_t mipLevels = texture->_mipLevels;
+
+    AsyncLoader::Task task{
+        /* task.read */ [&renderer, layersFilenames, srgb, mipLevels, firstLevel, image](AsyncLoader::Ticket&) {
+            if (!readImage(renderer, layersFilenames, srgb, *image)) {
+                return false;
+            }
+
+            selectLevels(*image, getTextureLevelsCount(*image, mipLevels), firstLevel);
+
+            return true;
+        },
+        /* task.build */ [&renderer, handle, image](AsyncLoader::Ticket&) -> Resource::SharedPtr<Resource> {
+            // The texture is looked up again, it may have been removed since the stream was requested
+            Resource::SharedPtr<Render::Texture> texture = renderer.getResourceManager()->get<Render::Texture>(handle);
+            if (!texture) {
+                return nullptr;
+            }
+
+            // The previous image can still be used by the frames in flight
+            API::Image previousImage = std::move(texture->_image);
+            API::ImageView previousImageView = std::move(texture->_imageView);
+            API::DeviceMemory previousDeviceMemory = std::move(texture->_deviceMemory);
+
+            if (!upload(renderer, *image, texture->_cubeMap, texture->_image, texture->_deviceMemory, texture->_imageView)) {
+                texture->unload();
+
+                texture->_image = std::move(previousImage);
+                texture->_imageView = std::move(previousImageView);
+                texture->_deviceMemory = std::move(previousDeviceMemory);
+
+                return nullptr;
+            }
+
+            renderer.destroyLater(std::move(previousImage), std::move(previousImageView), std::move(previousDeviceMemory));
 
-            // Free the data
-            freePixels(layersPixels);
+            // The size of the texture can change if its files have been modified
+            texture->_format = image->format;
+            texture->_width = image->textureWidth;
+            texture->_height = image->textureHeight;
+            texture->_layersCount = static_cast<uint32_t>(image->layers.size());
+            texture->_levelsCount = image->textureLevelsCount;
+            texture->_firstLevel = image->firstLevel;
+
+            ++texture->_version;
+
+            return Resource::SharedPtr<Resource>(texture.get());
         }
+    };
+
+    return task;
+}
+
+Resource::SharedPtr<::lug::Graphics::Render::Texture> build(const ::lug::Graphics::Builder::Texture& builder) {
+    // Constructor of Texture is private, we can't use std::make_unique
+    std::unique_ptr<Resource> resource{new Vulkan::Render::Texture(builder._name)};
+    Vulkan::Render::Texture* texture = static_cast<Vulkan::Render::Texture*>(resource.get());
+
+    if (!builder._layers.size()) {
+        LUG_LOG.error("Vulkan::Texture::build: Not layers added");
+        return nullptr;
+    }
+
+    // Keep the sources of the texture to be able to reload it
+    for (const auto& layer: builder._layers) {
+        texture->_layersFilenames.push_back(layer.filename);
+    }
+
+    texture->_cubeMap = builder._type == ::lug::Graphics::Builder::Texture::Type::CubeMap;
+    texture->_mipLevels = builder._mipLevels;
+    texture->_colorSpace = builder._colorSpace;
+    texture->_streaming = builder._streaming;
+
+    Vulkan::Renderer& renderer = static_cast<Vulkan::Renderer&>(builder._renderer);
+    API::Device &device = renderer.getDevice();
+
+    // The files may have already been decoded by a loader thread
+    if (!(builder._image ? load(renderer, *texture, *builder._image) : load(renderer, *texture))) {
+        LUG_LOG.error("Vulkan::Texture::build: Can't load the texture");
+        return nullptr;
     }
 
     // Create Sampler
@@ -407,6 +851,9 @@ Resource::SharedPtr<::lug::Graphics::Render::Texture> build(const ::lug::Graphic
             return VkSamplerMipmapMode{};
         }(builder._mipMapFilter));
 
+        // The number of levels can change when the texture is reloaded
+        samplerBuilder.setMaxLod(VK_LOD_CLAMP_NONE);
+
         VkResult result{VK_SUCCESS};
         if (!samplerBuilder.build(texture->_sampler, &result)) {
             LUG_LOG.error("Gui::initFontsTexture: Can't create image view: {}", result);
@@ -414,7 +861,19 @@ Resource::SharedPtr<::lug::Graphics::Render::Texture> build(const ::lug::Graphic
         }
     }
 
-    return builder._renderer.getResourceManager()->add<::lug::Graphics::Render::Texture>(std::move(resource));
+    Resource::SharedPtr<::lug::Graphics::Render::Texture> sharedPtrTexture = builder._renderer.getResourceManager()->add<::lug::Graphics::Render::Texture>(std::move(resource));
+
+    // Reload the texture when one of its layers is modified
+    for (const auto& filename : texture->_layersFilenames) {
+        builder._renderer.getResourceManager()->watchFile(filename, sharedPtrTexture->getHandle());
+    }
+
+    // Only the base level is resident, the others are streamed when needed
+    if (texture->_streaming) {
+        builder._renderer.getResourceManager()->getTextureStreamer().track(sharedPtrTexture->getHandle(), texture->_width, texture->_height, texture->_levelsCount, texture->_firstLevel);
+    }
+
+    return sharedPtrTexture;
 }
 
 } // Texture
@@ -20,6 +20,12 @@ namespace Vulkan {
 Gui::Gui(lug::Graphics::Vulkan::Renderer& renderer, lug::Graphics::Vulkan::Render::Window& window) : _renderer(renderer), _window(window) {
 }
 
+Gui::BufferRing::~BufferRing() {
+    if (data) {
+        bufferMemory.unmap();
+    }
+}
+
 Gui::~Gui() {
     destroy();
 }
@@ -34,17 +40,8 @@ void Gui::destroy() {
 
     _pipeline.destroy();
 
-    for (const auto& frameData: _framesData) {
-        if (frameData.vertexMemoryPtr) {
-            frameData.vertexMemory.unmap();
-        }
-
-        if (frameData.indexMemoryPtr) {
-            frameData.indexMemory.unmap();
-        }
-    }
-
     _framesData.clear();
+    _bufferRing.reset();
 
     _graphicQueueCommandPool.destroy();
     _transferQueueCommandPool.destroy();
@@ -105,6 +102,12 @@ bool Gui::init(const std::vector<API::ImageView>& imageViews) {
     }
     commandBuffers.clear(); // clear the array
 
+    // The vertices and the indices are allocated aligned to the atom size to flush them separately
+    {
+        const VkDeviceSize atomSize = device.getPhysicalDeviceInfo()->properties.limits.nonCoherentAtomSize;
+        _bufferCapacity = ::lug::Graphics::Render::BufferCapacity(64 * 1024, static_cast<size_t>(std::max(atomSize, VkDeviceSize(4))));
+    }
+
     return initFontsTexture() && initPipeline() && initFramebuffers(imageViews);
 }
 
@@ -647,6 +650,13 @@ bool Gui::endFrame(const std::vector<VkSemaphore>& waitSemaphores, uint32_t curr
         return false;
     }
     frameData.fence.reset();
+
+    // The GPU is done with the vertices and the indices of the frame
+    frameData.bufferRing.reset();
+    if (_bufferRing) {
+        _bufferRing->allocator.releaseFrame(currentImageIndex);
+    }
+
     if (updateBuffers(currentImageIndex) == false) {
         LUG_LOG.error("Gui::endFrame: Failed to update buffers");
         return false;
@@ -697,12 +707,9 @@ bool Gui::endFrame(const std::vector<VkSemaphore>& waitSemaphores, uint32_t curr
     frameData.commandBuffer.bindDescriptorSets(cmdDescriptorSet);
     frameData.commandBuffer.bindPipeline(_pipeline);
 
-    if (static_cast<VkBuffer>(frameData.vertexBuffer) != VK_NULL_HANDLE) {
-        frameData.commandBuffer.bindVertexBuffers({&frameData.vertexBuffer}, {0});
-    }
-
-    if (static_cast<VkBuffer>(frameData.indexBuffer) != VK_NULL_HANDLE) {
-        frameData.commandBuffer.bindIndexBuffer(frameData.indexBuffer, VK_INDEX_TYPE_UINT16);
+    if (frameData.bufferRing) {
+        frameData.commandBuffer.bindVertexBuffers({&frameData.bufferRing->buffer}, {frameData.vertexOffset});
+        frameData.commandBuffer.bindIndexBuffer(frameData.bufferRing->buffer, VK_INDEX_TYPE_UINT16, frameData.indexOffset);
     }
 
     // UI scale and translate via push constants
@@ -803,94 +810,56 @@ bool Gui::updateBuffers(uint32_t currentImageIndex) {
         return false;
     }
 
-    if (imDrawData->TotalVtxCount == 0 || imDrawData->TotalIdxCount == 0) {
-        return true;
-    }
-
-    API::Device &device = _renderer.getDevice();
     FrameData& frameData = _framesData[currentImageIndex];
 
-    // Note: Alignment is done inside buffer creation
-    const VkDeviceSize vertexBufferSize = imDrawData->TotalVtxCount * sizeof(ImDrawVert);
-    const VkDeviceSize indexBufferSize = imDrawData->TotalIdxCount * sizeof(ImDrawIdx);
-
-    // Update buffers only if vertex or index count has been changed compared to current buffer size
-    {
-        // Vertex buffer
-        if ((static_cast<VkBuffer>(frameData.vertexBuffer) == VK_NULL_HANDLE) || (vertexBufferSize > frameData.vertexBuffer.getRequirements().size)) {
-            {
-                // Create Vertex buffer
-                {
-                    API::Builder::Buffer bufferBuilder(device);
-                    bufferBuilder.setQueueFamilyIndices({ _transferQueue->getQueueFamily()->getIdx() });
-                    bufferBuilder.setSize(vertexBufferSize);
-                    bufferBuilder.setUsage(VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
-
-                    VkResult result{VK_SUCCESS};
-                    if (!bufferBuilder.build(frameData.vertexBuffer, &result)) {
-                        LUG_LOG.error("Gui::updateBuffers: Can't create staging buffer: {}", result);
-                        return false;
-                    }
-                }
-
-                if (frameData.vertexMemoryPtr) {
-                    frameData.vertexMemory.unmap();
-                }
+    const size_t vertexSize = imDrawData->TotalVtxCount * sizeof(ImDrawVert);
+    const size_t indexSize = imDrawData->TotalIdxCount * sizeof(ImDrawIdx);
 
-                API::Builder::DeviceMemory deviceMemoryBuilder(device);
-                deviceMemoryBuilder.setMemoryFlags(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-                deviceMemoryBuilder.addBuffer(frameData.vertexBuffer);
+    // The frames with nothing to draw count too, for the capacity to shrink
+    const bool empty = imDrawData->TotalVtxCount == 0 || imDrawData->TotalIdxCount == 0;
+    const size_t frameSize = empty ? 0 : _bufferCapacity.align(vertexSize) + _bufferCapacity.align(indexSize);
 
-                VkResult result{VK_SUCCESS};
-                if (!deviceMemoryBuilder.build(frameData.vertexMemory, &result)) {
-                    LUG_LOG.error("Gui::updateBuffers: Can't create staging buffer device memory: {}", result);
-                    return false;
-                }
+    if (_bufferCapacity.update(frameSize) || (!_bufferRing && _bufferCapacity.getCapacity())) {
+        if (!initBufferRing()) {
+            return false;
+        }
+    }
 
-                frameData.vertexMemoryPtr = frameData.vertexMemory.mapBuffer(frameData.vertexBuffer);
-            }
+    if (empty) {
+        if (_bufferRing) {
+            _bufferRing->allocator.endFrame(currentImageIndex);
         }
 
-        // IndexBuffer
-        if ((static_cast<VkBuffer>(frameData.indexBuffer) == VK_NULL_HANDLE) || (indexBufferSize > frameData.indexBuffer.getRequirements().size)) {
-            {
-                // Create Index buffer
-                {
-                    API::Builder::Buffer bufferBuilder(device);
-                    bufferBuilder.setQueueFamilyIndices({ _transferQueue->getQueueFamily()->getIdx() });
-                    bufferBuilder.setSize(indexBufferSize);
-                    bufferBuilder.setUsage(VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-
-                    VkResult result{VK_SUCCESS};
-                    if (!bufferBuilder.build(frameData.indexBuffer, &result)) {
-                        LUG_LOG.error("Gui::updateBuffers: Can't create staging buffer: {}", result);
-                        return false;
-                    }
-                }
+        return true;
+    }
 
-                if (frameData.indexMemoryPtr) {
-                    frameData.indexMemory.unmap();
-                }
+    // Allocate the ranges of the frame, growing the ring if it is too fragmented
+    size_t vertexOffset;
+    size_t indexOffset;
 
-                API::Builder::DeviceMemory deviceMemoryBuilder(device);
-                deviceMemoryBuilder.setMemoryFlags(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
-                deviceMemoryBuilder.addBuffer(frameData.indexBuffer);
+    if (!_bufferRing->allocator.allocate(vertexSize, vertexOffset) || !_bufferRing->allocator.allocate(indexSize, indexOffset)) {
+        _bufferCapacity.grow(frameSize);
 
-                VkResult result{VK_SUCCESS};
-                if (!deviceMemoryBuilder.build(frameData.indexMemory, &result)) {
-                    LUG_LOG.error("Gui::updateBuffers: Can't create staging buffer device memory: {}", result);
-                    return false;
-                }
+        if (!initBufferRing()) {
+            return false;
+        }
 
-                frameData.indexMemoryPtr = frameData.indexMemory.mapBuffer(frameData.indexBuffer);
-            }
+        if (!_bufferRing->allocator.allocate(vertexSize, vertexOffset) || !_bufferRing->allocator.allocate(indexSize, indexOffset)) {
+            LUG_LOG.error("Gui::updateBuffers: Can't allocate {} bytes in the buffer ring", frameSize);
+            return false;
         }
     }
 
+    _bufferRing->allocator.endFrame(currentImageIndex);
+
+    frameData.bufferRing = _bufferRing;
+    frameData.vertexOffset = vertexOffset;
+    frameData.indexOffset = indexOffset;
+
     // Upload data
     {
-        ImDrawVert* vertexMemoryPtr = static_cast<ImDrawVert*>(frameData.vertexMemoryPtr);
-        ImDrawIdx* indexMemoryPtr = static_cast<ImDrawIdx*>(frameData.indexMemoryPtr);
+        ImDrawVert* vertexMemoryPtr = reinterpret_cast<ImDrawVert*>(_bufferRing->data + vertexOffset);
+        ImDrawIdx* indexMemoryPtr = reinterpret_cast<ImDrawIdx*>(_bufferRing->data + indexOffset);
 
         for (int n = 0; n < imDrawData->CmdListsCount; n++) {
             const ImDrawList* cmd_list = imDrawData->CmdLists[n];
@@ -901,6 +870,70 @@ bool Gui::updateBuffers(uint32_t currentImageIndex) {
         }
     }
 
+    // Flush only the ranges written, if the memory is not coherent
+    {
+        const VkDeviceSize memoryOffset = _bufferRing->buffer.getDeviceMemoryOffset();
+
+        if (!_bufferRing->bufferMemory.flush(memoryOffset + vertexOffset, vertexSize) ||
+            !_bufferRing->bufferMemory.flush(memoryOffset + indexOffset, indexSize)) {
+            LUG_LOG.error("Gui::updateBuffers: Can't flush the buffer ring");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool Gui::initBufferRing() {
+    API::Device& device = _renderer.getDevice();
+
+    // The previous ring is destroyed once the frames using it are done
+    std::shared_ptr<BufferRing> bufferRing = std::make_shared<BufferRing>();
+
+    // Enough space for all the frames in flight, and one more for the end of the ring skipped when wrapping around
+    const size_t size = _bufferCapacity.getCapacity() * (_framesData.size() + 1);
+
+    // Create buffer
+    {
+        API::Builder::Buffer bufferBuilder(device);
+        bufferBuilder.setQueueFamilyIndices({ _graphicQueue->getQueueFamily()->getIdx() });
+        bufferBuilder.setSize(size);
+        bufferBuilder.setUsage(VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
+
+        VkResult result{VK_SUCCESS};
+        if (!bufferBuilder.build(bufferRing->buffer, &result)) {
+            LUG_LOG.error("Gui::initBufferRing: Can't create buffer: {}", result);
+            return false;
+        }
+    }
+
+    // Create buffer memory, not necessarily coherent as the ranges written are flushed
+    {
+        API::Builder::DeviceMemory deviceMemoryBuilder(device);
+        deviceMemoryBuilder.setMemoryFlags(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+
+        if (!deviceMemoryBuilder.addBuffer(bufferRing->buffer)) {
+            LUG_LOG.error("Gui::initBufferRing: Can't add buffer to device memory");
+            return false;
+        }
+
+        VkResult result{VK_SUCCESS};
+        if (!deviceMemoryBuilder.build(bufferRing->bufferMemory, &result)) {
+            LUG_LOG.error("Gui::initBufferRing: Can't create device memory: {}", result);
+            return false;
+        }
+    }
+
+    bufferRing->data = static_cast<uint8_t*>(bufferRing->bufferMemory.mapBuffer(bufferRing->buffer));
+    if (!bufferRing->data) {
+        LUG_LOG.error("Gui::initBufferRing: Can't map the buffer");
+        return false;
+    }
+
+    bufferRing->allocator = ::lug::Graphics::Render::RingAllocator(size, _bufferCapacity.getAlignment());
+
+    _bufferRing = std::move(bufferRing);
+
     return true;
 }
 
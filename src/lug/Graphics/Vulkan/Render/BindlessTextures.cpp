@@ -0,0 +1,196 @@
+#include <lug/Graphics/Vulkan/Render/BindlessTextures.hpp>
+
+#include <algorithm>
+
+#include <lug/Graphics/Vulkan/API/Builder/DescriptorPool.hpp>
+#include <lug/Graphics/Vulkan/API/Builder/DescriptorSet.hpp>
+#include <lug/Graphics/Vulkan/API/Builder/DescriptorSetLayout.hpp>
+#include <lug/Graphics/Vulkan/API/Device.hpp>
+#include <lug/Graphics/Vulkan/Render/Texture.hpp>
+#include <lug/System/Logger/Logger.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+namespace Render {
+
+BindlessTextures::~BindlessTextures() {
+    destroy();
+}
+
+uint32_t BindlessTextures::getMaxTexturesCount(const PhysicalDeviceInfo& physicalDeviceInfo) {
+#if defined(VK_EXT_descriptor_indexing)
+    // Large enough for the scenes we load, the descriptors are not all written
+    const uint32_t maxTexturesCount = 4096;
+
+    const auto& properties = physicalDeviceInfo.descriptorIndexingProperties;
+    return std::min({
+        maxTexturesCount,
+        properties.maxDescriptorSetUpdateAfterBindSampledImages,
+        properties.maxPerStageDescriptorUpdateAfterBindSampledImages,
+        properties.maxPerStageUpdateAfterBindResources
+    });
+#else
+    (void)physicalDeviceInfo;
+    return 0;
+#endif
+}
+
+bool BindlessTextures::buildDescriptorSetLayout(const API::Device& device, API::DescriptorSetLayout& descriptorSetLayout, VkResult* returnResult) {
+#if defined(VK_EXT_descriptor_indexing)
+    const VkDescriptorSetLayoutBinding binding{
+        /* binding.binding */ 0,
+        /* binding.descriptorType */ VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+        /* binding.descriptorCount */ getMaxTexturesCount(*device.getPhysicalDeviceInfo()),
+        /* binding.stageFlags */ VK_SHADER_STAGE_FRAGMENT_BIT,
+        /* binding.pImmutableSamplers */ nullptr
+    };
+
+    API::Builder::DescriptorSetLayout descriptorSetLayoutBuilder(device);
+
+    descriptorSetLayoutBuilder.setBindings({binding});
+    descriptorSetLayoutBuilder.setFlags(VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT);
+    descriptorSetLayoutBuilder.setBindingFlags({
+        VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT |
+        VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT |
+        VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT
+    });
+
+    return descriptorSetLayoutBuilder.build(descriptorSetLayout, returnResult);
+#else
+    (void)device;
+    (void)descriptorSetLayout;
+
+    if (returnResult) {
+        *returnResult = VK_ERROR_FEATURE_NOT_PRESENT;
+    }
+
+    return false;
+#endif
+}
+
+bool BindlessTextures::init(const API::Device& device) {
+    VkResult result{VK_SUCCESS};
+
+    _maxTexturesCount = getMaxTexturesCount(*device.getPhysicalDeviceInfo());
+
+    if (!buildDescriptorSetLayout(device, _descriptorSetLayout, &result)) {
+        LUG_LOG.error("BindlessTextures::init: Can't create the descriptor set layout: {}", result);
+        return false;
+    }
+
+#if defined(VK_EXT_descriptor_indexing)
+    // Create the descriptor pool
+    {
+        API::Builder::DescriptorPool descriptorPoolBuilder(device);
+
+        descriptorPoolBuilder.setFlags(VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT);
+        descriptorPoolBuilder.setMaxSets(1);
+        descriptorPoolBuilder.setPoolSizes(_descriptorSetLayout.getPoolSizes());
+
+        if (!descriptorPoolBuilder.build(_descriptorPool, &result)) {
+            LUG_LOG.error("BindlessTextures::init: Can't create the descriptor pool: {}", result);
+            return false;
+        }
+    }
+#endif
+
+    // Create the descriptor set
+    {
+        API::Builder::DescriptorSet descriptorSetBuilder(device, _descriptorPool);
+        descriptorSetBuilder.setDescriptorSetLayouts({static_cast<VkDescriptorSetLayout>(_descriptorSetLayout)});
+
+        if (!descriptorSetBuilder.build(_descriptorSet, &result)) {
+            LUG_LOG.error("BindlessTextures::init: Can't create the descriptor set: {}", result);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void BindlessTextures::destroy() {
+    _slots.clear();
+    _retiredIndices.clear();
+    _freeIndices.clear();
+    _indicesCount = 0;
+
+    _descriptorSet.destroy();
+    _descriptorPool.destroy();
+    _descriptorSetLayout.destroy();
+}
+
+void BindlessTextures::beginFrame(uint64_t frame, uint32_t retireDelay) {
+    _frame = frame;
+
+    const auto it = std::remove_if(_retiredIndices.begin(), _retiredIndices.end(), [this, frame, retireDelay](const RetiredIndex& retiredIndex) {
+        if (retiredIndex.frame + retireDelay > frame) {
+            return false;
+        }
+
+        _freeIndices.push_back(retiredIndex.index);
+        return true;
+    });
+
+    _retiredIndices.erase(it, _retiredIndices.end());
+}
+
+bool BindlessTextures::getIndex(const Texture& texture, uint32_t& index) {
+    Slot* slot = _slots.find(texture.getHandle().value);
+
+    if (slot && slot->version == texture.getVersion()) {
+        index = slot->index;
+        return true;
+    }
+
+    // The descriptor of the previous version can still be sampled by the frames in flight, it is not rewritten
+    uint32_t newIndex;
+    if (!_freeIndices.empty()) {
+        newIndex = _freeIndices.back();
+        _freeIndices.pop_back();
+    } else if (_indicesCount < _maxTexturesCount) {
+        newIndex = _indicesCount++;
+    } else {
+        LUG_LOG.error("BindlessTextures::getIndex: The array is full ({} textures)", _maxTexturesCount);
+        return false;
+    }
+
+    if (slot) {
+        _retiredIndices.push_back({slot->index, _frame});
+    } else {
+        slot = &_slots[texture.getHandle().value];
+    }
+
+    slot->index = newIndex;
+
+    // Write the descriptor of the new or reloaded texture
+    const VkDescriptorImageInfo imageInfo{
+        /* imageInfo.sampler */ static_cast<VkSampler>(texture.getSampler()),
+        /* imageInfo.imageView */ static_cast<VkImageView>(texture.getImageView()),
+        /* imageInfo.imageLayout */ VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+    };
+
+    _descriptorSet.updateImages(0, slot->index, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, {imageInfo});
+
+    slot->version = texture.getVersion();
+    index = slot->index;
+
+    return true;
+}
+
+void BindlessTextures::release(Resource::Handle handle) {
+    const Slot* slot = _slots.find(handle.value);
+
+    if (!slot) {
+        return;
+    }
+
+    // The frames recorded up to _frame can still sample it
+    _retiredIndices.push_back({slot->index, _frame});
+    _slots.erase(handle.value);
+}
+
+} // Render
+} // Vulkan
+} // Graphics
+} // lug
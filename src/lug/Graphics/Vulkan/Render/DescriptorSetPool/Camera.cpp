@@ -9,30 +9,43 @@ namespace Vulkan {
 namespace Render {
 namespace DescriptorSetPool {
 
-Camera::Camera(Renderer& renderer) : DescriptorSetPool(renderer) {}
+Camera::Camera(Renderer& renderer) : _renderer(renderer) {}
 
-const DescriptorSet* Camera::allocate(const BufferPool::SubBuffer& subBuffer) {
-    const auto& result = DescriptorSetPool::allocate(
-        reinterpret_cast<size_t>(static_cast<VkBuffer>(*subBuffer.getBuffer())),
-        _renderer.getPipeline(Pipeline::getBaseId())->getPipelineAPI().getLayout()->getDescriptorSetLayouts()[0]
+bool Camera::allocate(DescriptorAllocator& descriptorAllocator, const BufferPool::SubBuffer& subBuffer, const BufferPool::SubBuffer& paletteSubBuffer, API::DescriptorSet& descriptorSet) const {
+    if (!descriptorAllocator.allocate(
+        _renderer.getPipeline(Pipeline::getBaseId(_renderer.isBindlessEnabled()))->getPipelineAPI().getLayout()->getDescriptorSetLayouts()[0],
+        descriptorSet
+    )) {
+        return false;
+    }
+
+    descriptorSet.updateBuffers(
+        0,
+        0,
+        VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC,
+        {
+            {
+                static_cast<VkBuffer>(*subBuffer.getBuffer()),
+                0,
+                subBuffer.getSize()
+            }
+        }
     );
 
-    if (std::get<0>(result) && std::get<1>(result)) {
-        std::get<1>(result)->getDescriptorSet().updateBuffers(
-            0,
-            0,
-            VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC,
+    descriptorSet.updateBuffers(
+        1,
+        0,
+        VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC,
+        {
             {
-                {
-                    static_cast<VkBuffer>(*subBuffer.getBuffer()),
-                    0,
-                    subBuffer.getSize()
-                }
+                static_cast<VkBuffer>(*paletteSubBuffer.getBuffer()),
+                0,
+                paletteSubBuffer.getSize()
             }
-        );
-    }
+        }
+    );
 
-    return std::get<1>(result);
+    return true;
 }
 
 } // DescriptorSetPool
@@ -0,0 +1,162 @@
+#include <lug/Graphics/Vulkan/Render/DescriptorSetPool/DescriptorAllocator.hpp>
+
+#include <algorithm>
+
+#include <lug/Graphics/Vulkan/API/Builder/DescriptorPool.hpp>
+#include <lug/Graphics/Vulkan/API/Builder/DescriptorSet.hpp>
+#include <lug/Graphics/Vulkan/API/Device.hpp>
+#include <lug/System/Logger/Logger.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+namespace Render {
+namespace DescriptorSetPool {
+
+DescriptorAllocator::DescriptorAllocator(const API::Device& device, uint32_t setsPerPool) : _device(device), _setsPerPool(std::max(setsPerPool, 1u)) {}
+
+bool DescriptorAllocator::allocate(const API::DescriptorSetLayout& descriptorSetLayout, API::DescriptorSet& descriptorSet) {
+    // Whether the current pool has been created for this allocation, if it fails the set can't be allocated at all
+    bool newPool = false;
+
+    if (_pools.empty()) {
+        if (!addPool(descriptorSetLayout, _setsPerPool)) {
+            return false;
+        }
+
+        newPool = true;
+    }
+
+    for (;;) {
+        API::Builder::DescriptorSet descriptorSetBuilder(_device, *_pools[_currentPool]);
+        descriptorSetBuilder.setDescriptorSetLayouts({static_cast<VkDescriptorSetLayout>(descriptorSetLayout)});
+
+        VkResult result{VK_SUCCESS};
+        if (descriptorSetBuilder.build(descriptorSet, &result)) {
+            break;
+        }
+
+        // Before VK_KHR_maintenance1, the drivers report a full pool as an out of memory error
+        const bool poolFull = result == VK_ERROR_FRAGMENTED_POOL
+#if defined(VK_KHR_maintenance1)
+            || result == VK_ERROR_OUT_OF_POOL_MEMORY_KHR
+#endif
+            || result == VK_ERROR_OUT_OF_HOST_MEMORY
+            || result == VK_ERROR_OUT_OF_DEVICE_MEMORY;
+
+        if (newPool || !poolFull) {
+            LUG_LOG.error("DescriptorAllocator: Can't allocate the descriptor set: {}", result);
+            return false;
+        }
+
+        // Use the next pool of the chain (kept after a reset) or add a larger one
+        if (_currentPool + 1 < _pools.size()) {
+            ++_currentPool;
+            continue;
+        }
+
+        if (!addPool(descriptorSetLayout, _poolsMaxSets.back() * 2)) {
+            return false;
+        }
+
+        ++_statistics.growthsCount;
+        newPool = true;
+    }
+
+    ++_statistics.setsCount;
+    _statistics.peakSetsCount = std::max(_statistics.peakSetsCount, _statistics.setsCount);
+
+    ++_statistics.totalSetsCount;
+    for (const auto& poolSize : descriptorSetLayout.getPoolSizes()) {
+        _statistics.totalDescriptorsCount[poolSize.type] += poolSize.descriptorCount;
+    }
+
+    return true;
+}
+
+bool DescriptorAllocator::reset() {
+    if (_pools.size() > 1) {
+        // Replace the chain by one pool for the peak usage, created on the next allocation
+        _setsPerPool = std::max(_setsPerPool, _statistics.peakSetsCount + _statistics.peakSetsCount / 2);
+
+        _pools.clear();
+        _poolsMaxSets.clear();
+    } else if (!_pools.empty() && !_pools[0]->reset()) {
+        return false;
+    }
+
+    _currentPool = 0;
+
+    _statistics.poolsCount = static_cast<uint32_t>(_pools.size());
+    _statistics.setsCount = 0;
+
+    return true;
+}
+
+void DescriptorAllocator::destroy() {
+    _pools.clear();
+    _poolsMaxSets.clear();
+    _currentPool = 0;
+
+    _statistics.poolsCount = 0;
+    _statistics.setsCount = 0;
+}
+
+bool DescriptorAllocator::addPool(const API::DescriptorSetLayout& descriptorSetLayout, uint32_t maxSets) {
+    // Average number of descriptors of each type of the sets allocated until now,
+    // and at least enough descriptors for sets of the requested layout
+    std::map<VkDescriptorType, uint32_t> descriptorsPerSet;
+
+    if (_statistics.totalSetsCount) {
+        for (const auto& it : _statistics.totalDescriptorsCount) {
+            descriptorsPerSet[it.first] = static_cast<uint32_t>((it.second + _statistics.totalSetsCount - 1) / _statistics.totalSetsCount);
+        }
+    }
+
+    for (const auto& poolSize : descriptorSetLayout.getPoolSizes()) {
+        descriptorsPerSet[poolSize.type] = std::max(descriptorsPerSet[poolSize.type], poolSize.descriptorCount);
+    }
+
+    std::vector<VkDescriptorPoolSize> poolSizes;
+    for (const auto& it : descriptorsPerSet) {
+        if (it.second) {
+            poolSizes.push_back({
+                /* poolSize.type            */ it.first,
+                /* poolSize.descriptorCount */ it.second * maxSets
+            });
+        }
+    }
+
+    if (poolSizes.empty()) {
+        LUG_LOG.error("DescriptorAllocator: Can't create a descriptor pool without descriptors");
+        return false;
+    }
+
+    API::Builder::DescriptorPool descriptorPoolBuilder(_device);
+
+    // The sets are not freed individually, the pools are reset
+    descriptorPoolBuilder.setFlags(0);
+    descriptorPoolBuilder.setMaxSets(maxSets);
+    descriptorPoolBuilder.setPoolSizes(poolSizes);
+
+    VkResult result{VK_SUCCESS};
+    std::unique_ptr<API::DescriptorPool> descriptorPool = descriptorPoolBuilder.build(&result);
+    if (!descriptorPool) {
+        LUG_LOG.error("DescriptorAllocator: Can't create the descriptor pool: {}", result);
+        return false;
+    }
+
+    _pools.push_back(std::move(descriptorPool));
+    _poolsMaxSets.push_back(maxSets);
+    _currentPool = _pools.size() - 1;
+
+    _statistics.poolsCount = static_cast<uint32_t>(_pools.size());
+
+    return true;
+}
+
+} // DescriptorSetPool
+} // Render
+} // Vulkan
+} // Graphics
+} // lug
@@ -1,12 +1,75 @@
 #include <lug/Graphics/Vulkan/Render/DescriptorSetPool/DescriptorSetPool.hpp>
 
+#include <lug/System/Logger/Logger.hpp>
+
 namespace lug {
 namespace Graphics {
 namespace Vulkan {
 namespace Render {
 namespace DescriptorSetPool {
 
-API::DescriptorPool descriptorPool;
+DescriptorSetPool::DescriptorSetPool(Renderer& renderer, DescriptorAllocator& descriptorAllocator) : _renderer(renderer), _descriptorAllocator(descriptorAllocator) {}
+
+std::tuple<bool, const DescriptorSet*> DescriptorSetPool::allocate(size_t hash, const API::DescriptorSetLayout& descriptorSetLayout) {
+    DescriptorSet** descriptorSetInUse = _descriptorSetsInUse.find(hash);
+    if (!descriptorSetInUse) {
+        DescriptorSet* descriptorSet = allocateNewDescriptorSet(descriptorSetLayout);
+
+        if (!descriptorSet) {
+            return std::make_tuple(false, nullptr);
+        }
+
+        descriptorSet->setHash(hash);
+        descriptorSet->_referenceCount += 1;
+
+        _descriptorSetsInUse[hash] = descriptorSet;
+
+        return std::make_tuple(true, descriptorSet);
+    }
+
+    (*descriptorSetInUse)->_referenceCount += 1;
+    return std::make_tuple(false, *descriptorSetInUse);
+}
+
+void DescriptorSetPool::free(const DescriptorSet* descriptorSet) {
+    if (!descriptorSet) {
+        return;
+    }
+
+    DescriptorSet* freeDescriptorSet = const_cast<DescriptorSet*>(descriptorSet);
+    freeDescriptorSet->_referenceCount -= 1;
+
+    if (freeDescriptorSet->_referenceCount == 0) {
+        DescriptorSet** descriptorSetInUse = _descriptorSetsInUse.find(freeDescriptorSet->getHash());
+        if (descriptorSetInUse && *descriptorSetInUse == freeDescriptorSet) {
+            _descriptorSetsInUse.erase(freeDescriptorSet->getHash());
+        }
+
+        freeDescriptorSet->_nextFree = _freeDescriptorSets;
+        _freeDescriptorSets = freeDescriptorSet;
+    }
+}
+
+DescriptorSet* DescriptorSetPool::allocateNewDescriptorSet(const API::DescriptorSetLayout& descriptorSetLayout) {
+    if (_freeDescriptorSets) {
+        DescriptorSet* descriptorSet = _freeDescriptorSets;
+
+        _freeDescriptorSets = descriptorSet->_nextFree;
+        descriptorSet->_nextFree = nullptr;
+
+        return descriptorSet;
+    }
+
+    _descriptorSets.emplace_back();
+
+    if (!_descriptorAllocator.allocate(descriptorSetLayout, _descriptorSets.back()._descriptorSet)) {
+        LUG_LOG.error("DescriptorSetPool: Can't create descriptor set");
+        _descriptorSets.pop_back();
+        return nullptr;
+    }
+
+    return &_descriptorSets.back();
+}
 
 } // DescriptorSetPool
 } // Render
@@ -1,6 +1,7 @@
 #include <lug/Graphics/Vulkan/Render/DescriptorSetPool/Light.hpp>
 
 #include <lug/Graphics/Vulkan/API/Buffer.hpp>
+#include <lug/Graphics/Vulkan/Render/Texture.hpp>
 #include <lug/Graphics/Vulkan/Renderer.hpp>
 
 namespace lug {
@@ -9,30 +10,55 @@ namespace Vulkan {
 namespace Render {
 namespace DescriptorSetPool {
 
-Light::Light(Renderer& renderer) : DescriptorSetPool(renderer) {}
+Light::Light(Renderer& renderer) : _renderer(renderer) {}
 
-const DescriptorSet* Light::allocate(const BufferPool::SubBuffer& subBuffer) {
-    const auto& result = DescriptorSetPool::allocate(
-        reinterpret_cast<size_t>(static_cast<VkBuffer>(*subBuffer.getBuffer())),
-        _renderer.getPipeline(Pipeline::getBaseId())->getPipelineAPI().getLayout()->getDescriptorSetLayouts()[1]
+bool Light::allocate(DescriptorAllocator& descriptorAllocator, const BufferPool::SubBuffer& subBuffer, API::DescriptorSet& descriptorSet, const ::lug::Graphics::Render::SkyBox* skyBox) const {
+    if (!descriptorAllocator.allocate(
+        _renderer.getPipeline(Pipeline::getBaseId(_renderer.isBindlessEnabled()))->getPipelineAPI().getLayout()->getDescriptorSetLayouts()[1],
+        descriptorSet
+    )) {
+        return false;
+    }
+
+    descriptorSet.updateBuffers(
+        0,
+        0,
+        VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC,
+        {
+            {
+                static_cast<VkBuffer>(*subBuffer.getBuffer()),
+                0,
+                subBuffer.getSize()
+            }
+        }
     );
 
-    if (std::get<0>(result) && std::get<1>(result)) {
-        std::get<1>(result)->getDescriptorSet().updateBuffers(
-            0,
+    if (!skyBox || !skyBox->hasEnvironment()) {
+        return true;
+    }
+
+    const Render::Texture* textures[] = {
+        static_cast<const Render::Texture*>(skyBox->getIrradianceMap().get()),
+        static_cast<const Render::Texture*>(skyBox->getSpecularMap().get()),
+        static_cast<const Render::Texture*>(skyBox->getBrdfLut().get())
+    };
+
+    for (uint32_t i = 0; i < 3; ++i) {
+        descriptorSet.updateImages(
+            i + 1,
             0,
-            VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC,
+            VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
             {
                 {
-                    static_cast<VkBuffer>(*subBuffer.getBuffer()),
-                    0,
-                    subBuffer.getSize()
+                    /* sampler       */ static_cast<VkSampler>(textures[i]->getSampler()),
+                    /* imageView     */ static_cast<VkImageView>(textures[i]->getImageView()),
+                    /* imageLayout   */ VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
                 }
             }
         );
     }
 
-    return std::get<1>(result);
+    return true;
 }
 
 } // DescriptorSetPool
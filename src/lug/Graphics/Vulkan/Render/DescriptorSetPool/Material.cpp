@@ -9,19 +9,19 @@ namespace Vulkan {
 namespace Render {
 namespace DescriptorSetPool {
 
-Material::Material(Renderer& renderer) : DescriptorSetPool(renderer) {}
+Material::Material(Renderer& renderer, DescriptorAllocator& descriptorAllocator) : DescriptorSetPool(renderer, descriptorAllocator) {}
 
 const DescriptorSet* Material::allocate(const BufferPool::SubBuffer& subBuffer) {
     const auto& result = DescriptorSetPool::allocate(
         reinterpret_cast<size_t>(static_cast<VkBuffer>(*subBuffer.getBuffer())),
-        _renderer.getPipeline(Pipeline::getBaseId())->getPipelineAPI().getLayout()->getDescriptorSetLayouts()[2]
+        _renderer.getPipeline(Pipeline::getBaseId(_renderer.isBindlessEnabled()))->getPipelineAPI().getLayout()->getDescriptorSetLayouts()[2]
     );
 
     if (std::get<0>(result) && std::get<1>(result)) {
         std::get<1>(result)->getDescriptorSet().updateBuffers(
             0,
             0,
-            VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC,
+            VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
             {
                 {
                     static_cast<VkBuffer>(*subBuffer.getBuffer()),
@@ -8,13 +8,16 @@ namespace Vulkan {
 namespace Render {
 namespace DescriptorSetPool {
 
-MaterialTextures::MaterialTextures(Renderer& renderer) : DescriptorSetPool(renderer) {}
+MaterialTextures::MaterialTextures(Renderer& renderer, DescriptorAllocator& descriptorAllocator) : DescriptorSetPool(renderer, descriptorAllocator) {}
 
 const DescriptorSet* MaterialTextures::allocate(const API::GraphicsPipeline& pipeline, const std::vector<const ::lug::Graphics::Vulkan::Render::Texture*> textures) {
     // Generate hash
     size_t hash = textures.size();
     for (uint32_t i = 0; i < textures.size(); ++i) {
         hash ^= textures[i]->getHandle().value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+
+        // Don't reuse a descriptor set written before the texture was reloaded
+        hash ^= textures[i]->getVersion() + 0x9e3779b9 + (hash << 6) + (hash >> 2);
     }
 
     const auto& result = DescriptorSetPool::allocate(
@@ -10,7 +10,7 @@ namespace Vulkan {
 namespace Render {
 namespace DescriptorSetPool {
 
-SkyBox::SkyBox(Renderer& renderer) : DescriptorSetPool(renderer) {}
+SkyBox::SkyBox(Renderer& renderer, DescriptorAllocator& descriptorAllocator) : DescriptorSetPool(renderer, descriptorAllocator) {}
 
 const DescriptorSet* SkyBox::allocate(const ::lug::Graphics::Vulkan::Render::Texture* skyBox) {
     const auto& result = DescriptorSetPool::allocate(
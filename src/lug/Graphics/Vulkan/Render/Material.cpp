@@ -6,6 +6,10 @@ namespace Graphics {
 namespace Vulkan {
 namespace Render {
 
+constexpr uint32_t Material::noTexture;
+
+static_assert(sizeof(Material::Data) == 80, "Material::Data must match the std430 layout of the shaders");
+
 Material::Material(const std::string& name) : ::lug::Graphics::Render::Material(name) {
 
 }
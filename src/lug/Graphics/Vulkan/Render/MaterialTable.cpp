@@ -0,0 +1,188 @@
+#include <lug/Graphics/Vulkan/Render/MaterialTable.hpp>
+
+#include <algorithm>
+
+#include <lug/Graphics/Vulkan/API/Builder/Buffer.hpp>
+#include <lug/Graphics/Vulkan/API/Builder/DeviceMemory.hpp>
+#include <lug/Graphics/Vulkan/API/CommandBuffer.hpp>
+#include <lug/Graphics/Vulkan/API/Device.hpp>
+#include <lug/System/Logger/Logger.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+namespace Render {
+
+// vkCmdUpdateBuffer can't upload more than 65536 bytes at once
+static constexpr uint32_t maxRowsPerUpdate = 65536 / sizeof(Material::Data);
+
+void MaterialTable::RowAllocator::init(uint32_t maxRowsCount) {
+    clear();
+
+    _maxRowsCount = maxRowsCount;
+    _indices.reserve(maxRowsCount);
+}
+
+void MaterialTable::RowAllocator::clear() {
+    _maxRowsCount = 0;
+    _rowsCount = 0;
+
+    _indices.clear();
+    _freeRows.clear();
+}
+
+bool MaterialTable::RowAllocator::getIndex(uint32_t handle, uint32_t& index, bool* newRow) {
+    const uint32_t* rowIndex = _indices.find(handle);
+
+    if (rowIndex) {
+        index = *rowIndex;
+
+        if (newRow) {
+            *newRow = false;
+        }
+
+        return true;
+    }
+
+    if (!_freeRows.empty()) {
+        index = _freeRows.back();
+        _freeRows.pop_back();
+    } else if (_rowsCount < _maxRowsCount) {
+        index = _rowsCount++;
+    } else {
+        return false;
+    }
+
+    _indices[handle] = index;
+
+    if (newRow) {
+        *newRow = true;
+    }
+
+    return true;
+}
+
+bool MaterialTable::RowAllocator::release(uint32_t handle) {
+    const uint32_t* rowIndex = _indices.find(handle);
+
+    if (!rowIndex) {
+        return false;
+    }
+
+    _freeRows.push_back(*rowIndex);
+    _indices.erase(handle);
+
+    return true;
+}
+
+MaterialTable::~MaterialTable() {
+    destroy();
+}
+
+bool MaterialTable::init(const API::Device& device, const std::set<uint32_t>& queueFamilyIndices, uint32_t maxMaterialsCount) {
+    // Create buffer
+    {
+        API::Builder::Buffer bufferBuilder(device);
+
+        bufferBuilder.setQueueFamilyIndices(queueFamilyIndices);
+        bufferBuilder.setSize(maxMaterialsCount * sizeof(Material::Data));
+        bufferBuilder.setUsage(VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+        VkResult result{VK_SUCCESS};
+        if (!bufferBuilder.build(_buffer, &result)) {
+            LUG_LOG.error("MaterialTable::init: Can't create buffer: {}", result);
+            return false;
+        }
+    }
+
+    // Create buffer memory
+    {
+        API::Builder::DeviceMemory deviceMemoryBuilder(device);
+        deviceMemoryBuilder.setMemoryFlags(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+        if (!deviceMemoryBuilder.addBuffer(_buffer)) {
+            LUG_LOG.error("MaterialTable::init: Can't add buffer to device memory");
+            return false;
+        }
+
+        VkResult result{VK_SUCCESS};
+        if (!deviceMemoryBuilder.build(_bufferMemory, &result)) {
+            LUG_LOG.error("MaterialTable::init: Can't create device memory: {}", result);
+            return false;
+        }
+    }
+
+    _rows.resize(maxMaterialsCount);
+    _rowAllocator.init(maxMaterialsCount);
+
+    return true;
+}
+
+void MaterialTable::destroy() {
+    _buffer.destroy();
+    _bufferMemory.destroy();
+
+    _rows.clear();
+    _writtenRows.clear();
+    _rowAllocator.clear();
+}
+
+bool MaterialTable::getIndex(const ::lug::Graphics::Render::Material& material, uint32_t& index, bool* newRow) {
+    if (!_rowAllocator.getIndex(material.getHandle().value, index, newRow)) {
+        LUG_LOG.error("MaterialTable::getIndex: The table is full ({} materials)", _rowAllocator.getMaxRowsCount());
+        return false;
+    }
+
+    return true;
+}
+
+void MaterialTable::release(Resource::Handle handle) {
+    _rowAllocator.release(handle.value);
+}
+
+void MaterialTable::write(uint32_t index, const Material::Data& data) {
+    _rows[index] = data;
+    _writtenRows.push_back(index);
+}
+
+void MaterialTable::flush(const API::CommandBuffer& cmdBuffer) {
+    if (_writtenRows.empty()) {
+        return;
+    }
+
+    std::sort(_writtenRows.begin(), _writtenRows.end());
+    _writtenRows.erase(std::unique(_writtenRows.begin(), _writtenRows.end()), _writtenRows.end());
+
+    API::CommandBuffer::CmdPipelineBarrier pipelineBarrier;
+    pipelineBarrier.bufferMemoryBarriers.resize(1);
+    pipelineBarrier.bufferMemoryBarriers[0].buffer = &_buffer;
+
+    // The draws of the previous frames must be done reading the table before it is written
+    pipelineBarrier.bufferMemoryBarriers[0].srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    pipelineBarrier.bufferMemoryBarriers[0].dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    cmdBuffer.pipelineBarrier(pipelineBarrier, 0, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+    // Upload the contiguous rows together, the new materials are usually next to each other
+    for (size_t i = 0; i < _writtenRows.size();) {
+        const uint32_t first = _writtenRows[i];
+        uint32_t count = 1;
+
+        while (i + count < _writtenRows.size() && _writtenRows[i + count] == first + count && count < maxRowsPerUpdate) {
+            ++count;
+        }
+
+        cmdBuffer.updateBuffer(_buffer, &_rows[first], count * sizeof(Material::Data), first * sizeof(Material::Data));
+        i += count;
+    }
+
+    pipelineBarrier.bufferMemoryBarriers[0].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    pipelineBarrier.bufferMemoryBarriers[0].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    cmdBuffer.pipelineBarrier(pipelineBarrier, 0, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+
+    _writtenRows.clear();
+}
+
+} // Render
+} // Vulkan
+} // Graphics
+} // lug
@@ -1,4 +1,7 @@
 #include <lug/Graphics/Vulkan/Render/Mesh.hpp>
+
+#include <utility>
+
 #include <lug/Graphics/Vulkan/API/Builder/Buffer.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/DeviceMemory.hpp>
 #include <lug/Graphics/Vulkan/API/Device.hpp>
@@ -15,6 +18,27 @@ Mesh::~Mesh() {
     destroy();
 }
 
+void Mesh::unload() {
+    for (auto& primitiveSet : _primitiveSets) {
+        if (!primitiveSet._data) {
+            continue;
+        }
+
+        PrimitiveSetData* primitiveSetData = static_cast<PrimitiveSetData*>(primitiveSet._data);
+
+        for (auto& buffer : primitiveSetData->buffers) {
+            buffer.destroy();
+        }
+    }
+
+    _deviceMemory.destroy();
+}
+
+void Mesh::swap(Mesh& other) {
+    std::swap(_primitiveSets, other._primitiveSets);
+    std::swap(_deviceMemory, other._deviceMemory);
+}
+
 void Mesh::destroy() {
     for (auto& primitiveSet : _primitiveSets) {
         if (!primitiveSet._data) {
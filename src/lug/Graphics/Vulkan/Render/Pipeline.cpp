@@ -8,6 +8,7 @@
 #include <lug/Graphics/Vulkan/API/Builder/PipelineLayout.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/RenderPass.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/ShaderModule.hpp>
+#include <lug/Graphics/Vulkan/Render/BindlessTextures.hpp>
 #include <lug/Graphics/Vulkan/Renderer.hpp>
 #include <lug/System/Exception.hpp>
 
@@ -16,9 +17,57 @@ namespace Graphics {
 namespace Vulkan {
 namespace Render {
 
+constexpr uint32_t Pipeline::pushConstantsSize;
+
 Pipeline::Pipeline(Renderer& renderer, Id id) : Resource(Resource::Type::Pipeline, "Pipeline"), _renderer(renderer), _id(id) {}
 
+bool Pipeline::buildShaders(const Renderer& renderer, Id id, std::vector<uint32_t>& vertexShaderCode, std::vector<uint32_t>& fragmentShaderCode) {
+    try {
+        vertexShaderCode = Pipeline::ShaderBuilder::buildShader(
+            renderer.getInfo().shadersRoot,
+            renderer.getInfo().renderTechnique,
+            Pipeline::ShaderBuilder::Type::Vertex,
+            id
+        );
+
+        fragmentShaderCode = Pipeline::ShaderBuilder::buildShader(
+            renderer.getInfo().shadersRoot,
+            renderer.getInfo().renderTechnique,
+            Pipeline::ShaderBuilder::Type::Fragment,
+            id
+        );
+    } catch(const System::Exception& e) {
+        LUG_LOG.error("{}", e.what());
+        return false;
+    }
+
+    return true;
+}
+
+bool Pipeline::reload(const std::vector<uint32_t>& vertexShaderCode, const std::vector<uint32_t>& fragmentShaderCode) {
+    // Keep the current pipeline if the new one can't be built
+    API::GraphicsPipeline pipeline;
+    if (!build(vertexShaderCode, fragmentShaderCode, pipeline)) {
+        return false;
+    }
+
+    _pipeline = std::move(pipeline);
+
+    return true;
+}
+
 bool Pipeline::init() {
+    std::vector<uint32_t> vertexShaderCode{};
+    std::vector<uint32_t> fragmentShaderCode{};
+
+    if (!buildShaders(_renderer, _id, vertexShaderCode, fragmentShaderCode)) {
+        return false;
+    }
+
+    return build(vertexShaderCode, fragmentShaderCode, _pipeline);
+}
+
+bool Pipeline::build(const std::vector<uint32_t>& vertexShaderCode, const std::vector<uint32_t>& fragmentShaderCode, API::GraphicsPipeline& pipeline) {
     Pipeline::Id::PrimitivePart primitivePart = _id.getPrimitivePart();
     Pipeline::Id::MaterialPart materialPart = _id.getMaterialPart();
 
@@ -26,60 +75,36 @@ bool Pipeline::init() {
 
     // Set shaders state
     {
-        // Vertex shader
-        {
-            std::vector<uint32_t> shaderCode{};
-
-            try {
-                shaderCode = Pipeline::ShaderBuilder::buildShader(
-                    _renderer.getInfo().shadersRoot,
-                    _renderer.getInfo().renderTechnique,
-                    Pipeline::ShaderBuilder::Type::Vertex,
-                    _id
-                );
-            } catch(const System::Exception& e) {
-                LUG_LOG.error("{}", e.what());
-                return false;
-            }
-
-            if (!graphicsPipelineBuilder.setShaderFromData(VK_SHADER_STAGE_VERTEX_BIT, "main", shaderCode)) {
-                LUG_LOG.error("Vulkan::Render::Pipeline: Can't create vertex shader.");
-                return false;
-            }
+        if (!graphicsPipelineBuilder.setShaderFromData(VK_SHADER_STAGE_VERTEX_BIT, "main", vertexShaderCode)) {
+            LUG_LOG.error("Vulkan::Render::Pipeline: Can't create vertex shader.");
+            return false;
         }
 
-        // Frament shader
-        {
-            std::vector<uint32_t> shaderCode{};
-
-            try {
-                shaderCode = Pipeline::ShaderBuilder::buildShader(
-                    _renderer.getInfo().shadersRoot,
-                    _renderer.getInfo().renderTechnique,
-                    Pipeline::ShaderBuilder::Type::Fragment,
-                    _id
-                );
-            } catch(const System::Exception& e) {
-                LUG_LOG.error("{}", e.what());
-                return false;
-            }
-
-            if (!graphicsPipelineBuilder.setShaderFromData(VK_SHADER_STAGE_FRAGMENT_BIT, "main", shaderCode)) {
-                LUG_LOG.error("Vulkan::Render::Pipeline: Can't create fragment shader.");
-                return false;
-            }
+        if (!graphicsPipelineBuilder.setShaderFromData(VK_SHADER_STAGE_FRAGMENT_BIT, "main", fragmentShaderCode)) {
+            LUG_LOG.error("Vulkan::Render::Pipeline: Can't create fragment shader.");
+            return false;
         }
     }
 
     // Set vertex input state
     {
-        // We always have position
-        auto positionBinding = graphicsPipelineBuilder.addInputBinding(sizeof(Math::Vec3f), VK_VERTEX_INPUT_RATE_VERTEX);
-        positionBinding.addAttributes(VK_FORMAT_R32G32B32_SFLOAT, 0);
+        // We always have position, the halves have a fourth component for padding
+        if (primitivePart.halfPosition) {
+            auto positionBinding = graphicsPipelineBuilder.addInputBinding(4 * sizeof(uint16_t), VK_VERTEX_INPUT_RATE_VERTEX);
+            positionBinding.addAttributes(VK_FORMAT_R16G16B16A16_SFLOAT, 0);
+        } else {
+            auto positionBinding = graphicsPipelineBuilder.addInputBinding(sizeof(Math::Vec3f), VK_VERTEX_INPUT_RATE_VERTEX);
+            positionBinding.addAttributes(VK_FORMAT_R32G32B32_SFLOAT, 0);
+        }
 
-        // We always have normal
-        auto normalBinding = graphicsPipelineBuilder.addInputBinding(sizeof(Math::Vec3f), VK_VERTEX_INPUT_RATE_VERTEX);
-        normalBinding.addAttributes(VK_FORMAT_R32G32B32_SFLOAT, 0);
+        // We always have normal, the oct16 are decoded by the vertex shader
+        if (primitivePart.octahedralNormal) {
+            auto normalBinding = graphicsPipelineBuilder.addInputBinding(2 * sizeof(int16_t), VK_VERTEX_INPUT_RATE_VERTEX);
+            normalBinding.addAttributes(VK_FORMAT_R16G16_SNORM, 0);
+        } else {
+            auto normalBinding = graphicsPipelineBuilder.addInputBinding(sizeof(Math::Vec3f), VK_VERTEX_INPUT_RATE_VERTEX);
+            normalBinding.addAttributes(VK_FORMAT_R32G32B32_SFLOAT, 0);
+        }
 
         // Set vertex data attributes for dynamic attributes
         if (primitivePart.tangentVertexData) {
@@ -96,6 +121,14 @@ bool Pipeline::init() {
             auto uvBinding = graphicsPipelineBuilder.addInputBinding(sizeof(Math::Vec4f), VK_VERTEX_INPUT_RATE_VERTEX);
             uvBinding.addAttributes(VK_FORMAT_R32G32B32A32_SFLOAT, 0);
         }
+
+        if (primitivePart.skinned) {
+            auto jointsBinding = graphicsPipelineBuilder.addInputBinding(4 * sizeof(uint16_t), VK_VERTEX_INPUT_RATE_VERTEX);
+            jointsBinding.addAttributes(VK_FORMAT_R16G16B16A16_UINT, 0);
+
+            auto weightsBinding = graphicsPipelineBuilder.addInputBinding(sizeof(Math::Vec4f), VK_VERTEX_INPUT_RATE_VERTEX);
+            weightsBinding.addAttributes(VK_FORMAT_R32G32B32A32_SFLOAT, 0);
+        }
     }
 
     // Set input assembly state
@@ -172,25 +205,38 @@ bool Pipeline::init() {
         std::vector<API::DescriptorSetLayout> descriptorSetLayouts(3);
         API::Builder::DescriptorSetLayout descriptorSetLayoutBuilder(_renderer.getDevice());
 
-        // Bindings set 0 : Camera uniform buffer (V/F)
+        // Bindings set 0 : Camera uniform buffer (V/F) and joints palette storage buffer (V)
+        // The palette is in the layout of all the pipelines to keep the layouts compatible, it is only read by the skinned pipelines
         {
-            // Camera uniform buffer
-            const VkDescriptorSetLayoutBinding binding{
-                /* binding.binding */ 0,
-                /* binding.descriptorType */ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC,
-                /* binding.descriptorCount */ 1,
-                /* binding.stageFlags */ VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
-                /* binding.pImmutableSamplers */ nullptr
+            const std::vector<VkDescriptorSetLayoutBinding> bindings{
+                // Camera uniform buffer
+                {
+                    /* binding.binding */ 0,
+                    /* binding.descriptorType */ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC,
+                    /* binding.descriptorCount */ 1,
+                    /* binding.stageFlags */ VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+                    /* binding.pImmutableSamplers */ nullptr
+                },
+                // Joints palette, at the dynamic offset of the skinned node
+                {
+                    /* binding.binding */ 1,
+                    /* binding.descriptorType */ VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC,
+                    /* binding.descriptorCount */ 1,
+                    /* binding.stageFlags */ VK_SHADER_STAGE_VERTEX_BIT,
+                    /* binding.pImmutableSamplers */ nullptr
+                }
             };
 
-            descriptorSetLayoutBuilder.setBindings({binding});
+            descriptorSetLayoutBuilder.setBindings(bindings);
             if (!descriptorSetLayoutBuilder.build(descriptorSetLayouts[0], &result)) {
                 LUG_LOG.error("Vulkan::Render::Pipeline: Can't create pipeline descriptor sets layout 0: {}", result);
                 return false;
             }
         }
 
-        // Bindings set 1 : Light uniform buffer (F)
+        // Bindings set 1 : Light uniform buffer and environment samplers (F)
+        // The environment bindings are in the layout of all the pipelines to keep the layouts compatible,
+        // they are only written when the skybox has an environment and only read by the pipelines with the environment part
         {
             const std::vector<VkDescriptorSetLayoutBinding> bindings{
                 // Light array uniform buffer
@@ -200,6 +246,30 @@ bool Pipeline::init() {
                     /* binding.descriptorCount */ 1,
                     /* binding.stageFlags */ VK_SHADER_STAGE_FRAGMENT_BIT,
                     /* binding.pImmutableSamplers */ nullptr
+                },
+                // Irradiance map
+                {
+                    /* binding.binding */ 1,
+                    /* binding.descriptorType */ VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                    /* binding.descriptorCount */ 1,
+                    /* binding.stageFlags */ VK_SHADER_STAGE_FRAGMENT_BIT,
+                    /* binding.pImmutableSamplers */ nullptr
+                },
+                // Specular map
+                {
+                    /* binding.binding */ 2,
+                    /* binding.descriptorType */ VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                    /* binding.descriptorCount */ 1,
+                    /* binding.stageFlags */ VK_SHADER_STAGE_FRAGMENT_BIT,
+                    /* binding.pImmutableSamplers */ nullptr
+                },
+                // BRDF lookup table
+                {
+                    /* binding.binding */ 3,
+                    /* binding.descriptorType */ VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                    /* binding.descriptorCount */ 1,
+                    /* binding.stageFlags */ VK_SHADER_STAGE_FRAGMENT_BIT,
+                    /* binding.pImmutableSamplers */ nullptr
                 }
             };
 
@@ -210,11 +280,11 @@ bool Pipeline::init() {
             }
         }
 
-        // Bindings set 2 : Material uniform buffer (F)
+        // Bindings set 2 : Material table storage buffer (F), indexed with the push constants
         {
             const VkDescriptorSetLayoutBinding materialBinding{
                 /* materialBinding.binding */ 0,
-                /* materialBinding.descriptorType */ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC,
+                /* materialBinding.descriptorType */ VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
                 /* materialBinding.descriptorCount */ 1,
                 /* materialBinding.stageFlags */ VK_SHADER_STAGE_FRAGMENT_BIT,
                 /* materialBinding.pImmutableSamplers */ nullptr
@@ -227,8 +297,15 @@ bool Pipeline::init() {
             }
         }
 
-        // Binding set 3 : Material Samplers (F)
-        {
+        // Binding set 3 : Material Samplers (F), array of all the textures in bindless mode
+        if (materialPart.bindless) {
+            descriptorSetLayouts.resize(4);
+
+            if (!BindlessTextures::buildDescriptorSetLayout(_renderer.getDevice(), descriptorSetLayouts[3], &result)) {
+                LUG_LOG.error("Vulkan::Render::Pipeline: Can't create pipeline descriptor sets layout 3: {}", result);
+                return false;
+            }
+        } else {
             std::vector<VkDescriptorSetLayoutBinding> bindings = {};
 
             // Set binding for samples of the material
@@ -305,11 +382,11 @@ bool Pipeline::init() {
             }
         }
 
-        // Model transformation
+        // Model transformation and index of the material
         const VkPushConstantRange pushConstant{
-            /* pushConstant.stageFlags */ VK_SHADER_STAGE_VERTEX_BIT,
+            /* pushConstant.stageFlags */ VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
             /* pushConstant.offset */ 0,
-            /* pushConstant.size */ sizeof(Math::Mat4x4f)
+            /* pushConstant.size */ pushConstantsSize
         };
 
         API::Builder::PipelineLayout pipelineLayoutBuilder(_renderer.getDevice());
@@ -387,7 +464,7 @@ bool Pipeline::init() {
     }
 
     VkResult result{VK_SUCCESS};
-    if (!graphicsPipelineBuilder.build(_pipeline, &result)) {
+    if (!graphicsPipelineBuilder.build(pipeline, &result)) {
         LUG_LOG.error("Vulkan::Render::Pipeline: Can't create pipeline: {}", result);
         return false;
     }
@@ -79,14 +79,17 @@ std::vector<uint32_t> Pipeline::ShaderBuilder::buildShaderFromString(std::string
     {
         Pipeline::Id::PrimitivePart primitivePart = id.getPrimitivePart();
         Pipeline::Id::MaterialPart materialPart = id.getMaterialPart();
+        Pipeline::Id::PipelinePart pipelinePart = id.getPipelinePart();
 
         // Primitive part
         {
             options.AddMacroDefinition("IN_POSITION", std::to_string(primitivePart.positionVertexData));
             options.AddMacroDefinition("IN_NORMAL", std::to_string(primitivePart.normalVertexData));
+            options.AddMacroDefinition("IN_NORMAL_OCTAHEDRAL", std::to_string(primitivePart.octahedralNormal));
             options.AddMacroDefinition("IN_TANGENT", std::to_string(primitivePart.tangentVertexData));
             options.AddMacroDefinition("IN_UV", std::to_string(primitivePart.countTexCoord));
             options.AddMacroDefinition("IN_COLOR", std::to_string(primitivePart.countColor));
+            options.AddMacroDefinition("IN_SKIN", std::to_string(primitivePart.skinned));
         }
 
         // Material Part
@@ -105,6 +108,14 @@ std::vector<uint32_t> Pipeline::ShaderBuilder::buildShaderFromString(std::string
 
             options.AddMacroDefinition("TEXTURE_EMISSIVE", materialPart.emissiveInfo != 0b11 ? "1" : "0");
             options.AddMacroDefinition("TEXTURE_EMISSIVE_UV", "inUV" + std::to_string(materialPart.emissiveInfo));
+
+            // The textures are then read from the bindless array, with the indices stored in the material
+            options.AddMacroDefinition("BINDLESS", materialPart.bindless ? "1" : "0");
+        }
+
+        // Pipeline part
+        {
+            options.AddMacroDefinition("ENVIRONMENT", pipelinePart.environment ? "1" : "0");
         }
 
         // Set location
@@ -123,6 +134,11 @@ std::vector<uint32_t> Pipeline::ShaderBuilder::buildShaderFromString(std::string
                 options.AddMacroDefinition("IN_COLOR_" + std::to_string(i) + "_LOCATION", std::to_string(location++));
             }
 
+            if (primitivePart.skinned) {
+                options.AddMacroDefinition("IN_JOINTS_LOCATION", std::to_string(location++));
+                options.AddMacroDefinition("IN_WEIGHTS_LOCATION", std::to_string(location++));
+            }
+
             options.AddMacroDefinition("IN_FREE_LOCATION", std::to_string(location++));
         }
 
@@ -8,7 +8,7 @@ namespace Graphics {
 namespace Vulkan {
 namespace Render {
 
-void Queue::addMeshInstance(Scene::Node& node) {
+void Queue::addMeshInstance(Scene::Node& node, float footprint) {
     auto meshInstance = node.getMeshInstance();
 
     uint32_t i = 0;
@@ -26,6 +26,11 @@ void Queue::addMeshInstance(Scene::Node& node) {
             Pipeline::Id::PrimitivePart pipelineIdPrimitivePart = primitiveSetData->pipelineIdPrimitivePart;
             Pipeline::Id::MaterialPart pipelineIdMaterialPart = material->getPipelineId();
 
+            // Without animator the skinned primitive sets are drawn in their bind pose
+            if (!node.getAnimator()) {
+                pipelineIdPrimitivePart.skinned = 0;
+            }
+
             pipelineId = Pipeline::Id::create(pipelineIdPrimitivePart, pipelineIdMaterialPart);
         }
 
@@ -33,7 +38,8 @@ void Queue::addMeshInstance(Scene::Node& node) {
         _primitiveSets[pipelineId].push_back(Queue::PrimitiveSetInstance{
             /* node */ &node,
             /* primitiveSet */ &primitiveSet,
-            /* material */ material.get()
+            /* material */ material.get(),
+            /* footprint */ footprint
         });
 
         ++i;
@@ -1,10 +1,14 @@
 #include <lug/Graphics/Vulkan/Render/Technique/Forward.hpp>
 
 #include <algorithm>
+#include <cstring>
+#include <unordered_map>
 
 #include <lug/Config.hpp>
+#include <lug/Graphics/Render/Camera/Camera.hpp>
 #include <lug/Graphics/Render/Light.hpp>
 #include <lug/Graphics/Scene/Node.hpp>
+#include <lug/Graphics/TextureStreamer.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/CommandBuffer.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/CommandPool.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/DescriptorSetLayout.hpp>
@@ -16,11 +20,11 @@
 #include <lug/Graphics/Vulkan/API/Builder/ImageView.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/PipelineLayout.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/RenderPass.hpp>
-#include <lug/Graphics/Vulkan/API/Builder/Semaphore.hpp>
 #include <lug/Graphics/Vulkan/Render/Material.hpp>
 #include <lug/Graphics/Vulkan/Render/Mesh.hpp>
 #include <lug/Graphics/Vulkan/Render/Queue.hpp>
 #include <lug/Graphics/Vulkan/Render/SkyBox.hpp>
+#include <lug/Graphics/Vulkan/Render/Texture.hpp>
 #include <lug/Graphics/Vulkan/Render/View.hpp>
 #include <lug/Graphics/Vulkan/Renderer.hpp>
 #include <lug/Math/Geometry/Transform.hpp>
@@ -34,9 +38,9 @@ namespace Vulkan {
 namespace Render {
 namespace Technique {
 
-std::unique_ptr<BufferPool::Camera> Forward::_cameraBufferPool = nullptr;
-std::unique_ptr<BufferPool::Light> Forward::_lightBufferPool = nullptr;
-std::unique_ptr<BufferPool::Material> Forward::_materialBufferPool = nullptr;
+constexpr uint32_t Forward::maxJointsCount;
+
+std::unique_ptr<DescriptorSetPool::DescriptorAllocator> Forward::_descriptorAllocator = nullptr;
 
 std::unique_ptr<DescriptorSetPool::Camera> Forward::_cameraDescriptorSetPool = nullptr;
 std::unique_ptr<DescriptorSetPool::Light> Forward::_lightDescriptorSetPool = nullptr;
@@ -44,6 +48,10 @@ std::unique_ptr<DescriptorSetPool::Material> Forward::_materialDescriptorSetPool
 std::unique_ptr<DescriptorSetPool::MaterialTextures> Forward::_materialTexturesDescriptorSetPool = nullptr;
 std::unique_ptr<DescriptorSetPool::SkyBox> Forward::_skyBoxDescriptorSetPool = nullptr;
 
+std::unique_ptr<MaterialTable> Forward::_materialTable = nullptr;
+
+std::unique_ptr<BindlessTextures> Forward::_bindlessTextures = nullptr;
+
 uint32_t Forward::_forwardCount = 0;
 
 Forward::Forward(Renderer& renderer, const Render::View& renderView) : Technique(renderer, renderView) {
@@ -62,37 +70,124 @@ bool Forward::render(
 ) {
     FrameData& frameData = _framesData[currentImageIndex];
 
-    frameData.transferFence.wait();
-    frameData.transferFence.reset();
+    // Mark the meshes and textures of the render queue as used, reloading the evicted ones,
+    // and request the levels of the streamed textures from the size of the nodes on the screen
+    {
+        ResourceBudget& budget = _renderer.getResourceManager()->getBudget();
+        TextureStreamer& streamer = _renderer.getResourceManager()->getTextureStreamer();
+
+        for (const auto& it : renderQueue.getPrimitiveSets()) {
+            for (const auto& primitiveSetInstance : it.second) {
+                const auto& material = *primitiveSetInstance.material;
+
+                bool resident = budget.use(primitiveSetInstance.node->getMeshInstance()->mesh->getHandle());
+
+                for (const auto* textureInfo : {
+                    &material.getBaseColorTexture(),
+                    &material.getMetallicRoughnessTexture(),
+                    &material.getNormalTexture(),
+                    &material.getOcclusionTexture(),
+                    &material.getEmissiveTexture()
+                }) {
+                    if (!textureInfo->texture) {
+                        continue;
+                    }
 
-    if (!frameData.transferCmdBuffer.reset() || !frameData.transferCmdBuffer.begin()) {
-        return false;
-    }
+                    // The base level of the streamed textures is always resident
+                    if (static_cast<const Render::Texture*>(textureInfo->texture.get())->isStreaming()) {
+                        streamer.request(textureInfo->texture->getHandle(), primitiveSetInstance.footprint);
+                        continue;
+                    }
 
-    // Get the new (or old) camera buffer
-    {
-        const BufferPool::SubBuffer* cameraBuffer = _cameraBufferPool->allocate(frameData.transferCmdBuffer, *_renderView.getCamera());
+                    resident = budget.use(textureInfo->texture->getHandle()) && resident;
+                }
 
-        if (!cameraBuffer) {
-            LUG_LOG.error("Forward::render: Can't allocate camera buffer");
-            return false;
+                if (!resident) {
+                    LUG_LOG.error("Forward::render: Can't reload the resources of the node {}", primitiveSetInstance.node->getName());
+                    return false;
+                }
+            }
         }
+    }
 
-        _cameraBufferPool->free(frameData.cameraBuffer);
-        frameData.cameraBuffer = cameraBuffer;
+    if (_bindlessTextures) {
+        _bindlessTextures->beginFrame(_renderer.getFrame(), _renderer.getRetireDelay());
+    }
+
+    // Write the rows of the new and modified materials, they are uploaded at the beginning of the command buffer
+    for (const auto& it : renderQueue.getPrimitiveSets()) {
+        for (const auto& primitiveSetInstance : it.second) {
+            auto& material = *primitiveSetInstance.material;
+
+            uint32_t index;
+            bool newRow;
+            if (!_materialTable->getIndex(material, index, &newRow)) {
+                LUG_LOG.error("Forward::render: Can't get the index of the material {}", material.getName());
+                return false;
+            }
+
+            Render::Material::Data data{};
+
+            // The textures are looked up even if the row is up to date, the reloaded ones get a new index
+            if (_bindlessTextures) {
+                uint32_t i = 0;
+                for (const auto* textureInfo : {
+                    &material.getBaseColorTexture(),
+                    &material.getMetallicRoughnessTexture(),
+                    &material.getNormalTexture(),
+                    &material.getOcclusionTexture(),
+                    &material.getEmissiveTexture()
+                }) {
+                    uint32_t textureIndex;
+
+                    if (!textureInfo->texture) {
+                        data.textures[i++] = Render::Material::noTexture;
+                    } else if (_bindlessTextures->getIndex(*static_cast<const Render::Texture*>(textureInfo->texture.get()), textureIndex)) {
+                        data.textures[i++] = (textureIndex << 2) | textureInfo->texCoord;
+                    } else {
+                        LUG_LOG.error("Forward::render: Can't get the index of the texture {}", textureInfo->texture->getName());
+                        return false;
+                    }
+                }
+            }
+
+            const bool texturesChanged = _bindlessTextures && std::memcmp(data.textures, _materialTable->getRow(index).textures, sizeof(data.textures)) != 0;
+
+            if (newRow || material.isDirty() || texturesChanged) {
+                data.constants = material.getConstants();
+                _materialTable->write(index, data);
+
+                // The table is shared by all the views, the row only has to be written once
+                material.clearDirty();
+            }
+        }
     }
 
     frameData.renderFence.wait();
     frameData.renderFence.reset();
 
+    // The previous rendering of the frame is done, its uniform data and transient descriptor sets can be reused
+    _uniformRing.releaseFrame(currentImageIndex);
+
+    frameData.cameraDescriptorSet.destroy();
+    frameData.lightDescriptorSet.destroy();
+
+    if (!frameData.descriptorAllocator->reset()) {
+        LUG_LOG.error("Forward::render: Can't reset the descriptor allocator");
+        return false;
+    }
+
     if (!frameData.renderCmdBuffer.reset() || !frameData.renderCmdBuffer.begin()) {
         return false;
     }
 
+    // The transfers can't be recorded in the render pass
+    _materialTable->flush(frameData.renderCmdBuffer);
+
     // Begin of the render pass
     {
         // All the pipelines have the same renderPass
-        const API::RenderPass* renderPass = _renderer.getPipeline(Pipeline::getBaseId())->getPipelineAPI().getRenderPass();
+        const API::RenderPass* renderPass = _renderer.getPipeline(Pipeline::getBaseId(_renderer.isBindlessEnabled()))->getPipelineAPI().getRenderPass();
 
         API::CommandBuffer::CmdBeginRenderPass beginRenderPass{
             /* beginRenderPass.framebuffer  */ frameData.framebuffer,
@@ -134,46 +229,65 @@ bool Forward::render(
         frameData.renderCmdBuffer.setScissor({scissor});
     }
 
-    // Get the new (or old) camera descriptor set
+    // The uniform data is bound with dynamic offsets in the ring, the descriptor sets only need the size of the data
+    const BufferPool::SubBuffer cameraBuffer(&_uniformRing.getBuffer(), 0, sizeof(Math::Mat4x4f) * 2);
+    const BufferPool::SubBuffer lightBuffer(&_uniformRing.getBuffer(), 0, ::lug::Graphics::Render::Light::strideShader * 50 + sizeof(uint32_t));
+    const BufferPool::SubBuffer paletteBuffer(&_uniformRing.getBuffer(), 0, maxJointsCount * sizeof(Math::Mat4x4f));
+    const BufferPool::SubBuffer materialTableBuffer(&_materialTable->getBuffer(), 0, maxMaterialsCount * sizeof(Render::Material::Data));
+
+    // Write the camera data
+    uint32_t cameraOffset;
     {
-        const DescriptorSetPool::DescriptorSet* cameraDescriptorSet = _cameraDescriptorSetPool->allocate(*frameData.cameraBuffer);
+        auto& camera = *_renderView.getCamera();
 
-        if (!cameraDescriptorSet) {
-            LUG_LOG.error("Forward::render: Can't allocate camera descriptor set");
+        const Math::Mat4x4f cameraData[] = {
+            camera.getViewMatrix(),
+            camera.getProjectionMatrix()
+        };
+
+        if (!_uniformRing.write(cameraData, sizeof(cameraData), cameraOffset)) {
+            LUG_LOG.error("Forward::render: Can't allocate camera buffer");
             return false;
         }
+    }
 
-        _cameraDescriptorSetPool->free(frameData.cameraDescriptorSet);
-        frameData.cameraDescriptorSet = cameraDescriptorSet;
+    // Get the camera and light descriptor sets
+    if (!_cameraDescriptorSetPool->allocate(*frameData.descriptorAllocator, cameraBuffer, paletteBuffer, frameData.cameraDescriptorSet)) {
+        LUG_LOG.error("Forward::render: Can't allocate camera descriptor set");
+        return false;
+    }
+
+    // The environment of the skybox lights the objects with the first batch of lights
+    Resource::SharedPtr<Render::SkyBox> skyBox = renderQueue.getSkyBox();
+    const bool hasEnvironment = skyBox && skyBox->hasEnvironment();
+
+    if (!_lightDescriptorSetPool->allocate(*frameData.descriptorAllocator, lightBuffer, frameData.lightDescriptorSet, skyBox.get())) {
+        LUG_LOG.error("Forward::render: Can't allocate light descriptor set");
+        return false;
     }
 
     // Bind descriptor set of the camera
     {
         const API::CommandBuffer::CmdBindDescriptors cameraBind{
-            /* cameraBind.pipelineLayout    */ *_renderer.getPipeline(Pipeline::getBaseId())->getPipelineAPI().getLayout(),
+            /* cameraBind.pipelineLayout    */ *_renderer.getPipeline(Pipeline::getBaseId(_renderer.isBindlessEnabled()))->getPipelineAPI().getLayout(),
             /* cameraBind.pipelineBindPoint  */ VK_PIPELINE_BIND_POINT_GRAPHICS,
             /* cameraBind.firstSet           */ 0,
-            /* cameraBind.descriptorSets     */ {&frameData.cameraDescriptorSet->getDescriptorSet()},
-            /* cameraBind.dynamicOffsets     */ {frameData.cameraBuffer->getOffset()},
+            /* cameraBind.descriptorSets     */ {&frameData.cameraDescriptorSet},
+            /* cameraBind.dynamicOffsets     */ {cameraOffset, 0},
         };
 
         frameData.renderCmdBuffer.bindDescriptorSets(cameraBind);
     }
 
-    // Temporary array of light and material buffers use to render this frame
-    // they will replace frameData.lightBuffers and frameData.materialBuffers atfer the rendering
-    std::vector<const BufferPool::SubBuffer*> lightBuffers;
-    std::vector<const BufferPool::SubBuffer*> materialBuffers;
+    // Offsets of the palettes of the skinned nodes, written once per frame
+    std::unordered_map<const Scene::Node*, uint32_t> paletteOffsets;
 
-    // Temporary array of light and material descriptor sets use to render this frame
-    // they will replace frameData.lightDescriptorSets and frameData.materialDescriptorSets atfer the rendering
-    std::vector<const DescriptorSetPool::DescriptorSet*> lightDescriptorSets;
-    std::vector<const DescriptorSetPool::DescriptorSet*> materialDescriptorSets;
+    // Temporary array of material textures descriptor sets use to render this frame
+    // they will replace frameData.materialTexturesDescriptorSets atfer the rendering
     std::vector<const DescriptorSetPool::DescriptorSet*> materialTexturesDescriptorSets;
 
     // Render skybox
     {
-        Resource::SharedPtr<Render::SkyBox> skyBox = renderQueue.getSkyBox();
         if (skyBox) {
             Resource::SharedPtr<Render::Texture> skyBoxTexture =  Resource::SharedPtr<Render::Texture>::cast(skyBox->getTexture());
             // Get the new (or old) skyBox descriptor set
@@ -224,6 +338,39 @@ bool Forward::render(
 
     // Render objects
     {
+        // Get the new (or old) material table descriptor set
+        {
+            const DescriptorSetPool::DescriptorSet* materialTableDescriptorSet = _materialDescriptorSetPool->allocate(materialTableBuffer);
+
+            if (!materialTableDescriptorSet) {
+                LUG_LOG.error("Forward::render: Can't allocate material table descriptor set");
+                return false;
+            }
+
+            _materialDescriptorSetPool->free(frameData.materialTableDescriptorSet);
+            frameData.materialTableDescriptorSet = materialTableDescriptorSet;
+        }
+
+        // Bind the material table, and the array of textures in bindless mode, after the skybox which uses another layout for the set 1
+        // The layouts of the other pipelines are compatible so they stay bound for all the objects
+        {
+            std::vector<const API::DescriptorSet*> materialTableBind{&frameData.materialTableDescriptorSet->getDescriptorSet()};
+
+            if (_bindlessTextures) {
+                materialTableBind.push_back(&_bindlessTextures->getDescriptorSet());
+            }
+
+            const API::CommandBuffer::CmdBindDescriptors materialBind{
+                /* materialBind.pipelineLayout     */ *_renderer.getPipeline(Pipeline::getBaseId(_renderer.isBindlessEnabled()))->getPipelineAPI().getLayout(),
+                /* materialBind.pipelineBindPoint  */ VK_PIPELINE_BIND_POINT_GRAPHICS,
+                /* materialBind.firstSet           */ 2,
+                /* materialBind.descriptorSets     */ materialTableBind,
+                /* materialBind.dynamicOffsets     */ {},
+            };
+
+            frameData.renderCmdBuffer.bindDescriptorSets(materialBind);
+        }
+
         // Blend constants are used as dst blend factor
         // We set them to 0 so that there is no blending
         {
@@ -231,38 +378,40 @@ bool Forward::render(
             frameData.renderCmdBuffer.setBlendConstants(blendConstants);
         }
 
+        // With an environment, the objects are drawn once even without lights
         auto& lights = renderQueue.getLights();
-        for (uint32_t i = 0; i < renderQueue.getLightsCount(); i += 50) {
-            // Get the new (or old) light buffer
-            const BufferPool::SubBuffer* lightBuffer = _lightBufferPool->allocate(
-                currentImageIndex,
-                frameData.transferCmdBuffer,
-                {lights.begin() + i, i + 50 > renderQueue.getLightsCount() ? lights.begin() + renderQueue.getLightsCount() : lights.begin() + i + 50}
-            );
-            lightBuffers.push_back(lightBuffer);
+        for (uint32_t i = 0; i < renderQueue.getLightsCount() || (i == 0 && hasEnvironment); i += 50) {
+            // Write the data of the batch of lights
+            uint32_t lightOffset;
+            {
+                uint8_t* lightData = static_cast<uint8_t*>(_uniformRing.allocate(lightBuffer.getSize(), lightOffset));
 
-            if (!lightBuffer) {
-                LUG_LOG.error("Forward::render: Can't allocate light buffer");
-                return false;
-            }
+                if (!lightData) {
+                    LUG_LOG.error("Forward::render: Can't allocate light buffer");
+                    return false;
+                }
 
-            // Get the new (or old) light descriptor set
-            const DescriptorSetPool::DescriptorSet* lightDescriptorSet = _lightDescriptorSetPool->allocate(*lightBuffer);
-            lightDescriptorSets.push_back(lightDescriptorSet);
+                const uint32_t lightsNb = static_cast<uint32_t>(std::min<size_t>(renderQueue.getLightsCount() - i, 50));
+                for (uint32_t j = 0; j < lightsNb; ++j) {
+                    auto& node = *lights[i + j];
 
-            if (!lightDescriptorSet) {
-                LUG_LOG.error("Forward::render: Can't allocate light descriptor set");
-                return false;
+                    ::lug::Graphics::Render::Light::Data data;
+                    node.getLight()->getData(data, node);
+
+                    std::memcpy(lightData + ::lug::Graphics::Render::Light::strideShader * j, &data, sizeof(data));
+                }
+
+                std::memcpy(lightData + ::lug::Graphics::Render::Light::strideShader * 50, &lightsNb, sizeof(uint32_t));
             }
 
             // Bind descriptor set of the light
             {
                 const API::CommandBuffer::CmdBindDescriptors lightBind{
-                    /* lightBind.pipelineLayout     */ *_renderer.getPipeline(Pipeline::getBaseId())->getPipelineAPI().getLayout(),
+                    /* lightBind.pipelineLayout     */ *_renderer.getPipeline(Pipeline::getBaseId(_renderer.isBindlessEnabled()))->getPipelineAPI().getLayout(),
                     /* lightBind.pipelineBindPoint  */ VK_PIPELINE_BIND_POINT_GRAPHICS,
                     /* lightBind.firstSet           */ 1,
-                    /* lightBind.descriptorSets     */ {&lightDescriptorSet->getDescriptorSet()},
-                    /* lightBind.dynamicOffsets     */ {lightBuffer->getOffset()},
+                    /* lightBind.descriptorSets     */ {&frameData.lightDescriptorSet},
+                    /* lightBind.dynamicOffsets     */ {lightOffset},
                 };
 
                 frameData.renderCmdBuffer.bindDescriptorSets(lightBind);
@@ -275,8 +424,11 @@ bool Forward::render(
             }
 
             for (const auto it : renderQueue.getPrimitiveSets()) {
-                // Bind pipeline
-                Resource::SharedPtr<Render::Pipeline> pipeline = _renderer.getPipeline(it.first);
+                // Bind pipeline, the environment is only added once
+                Pipeline::Id pipelineId = it.first;
+                pipelineId.pipelinePart = hasEnvironment && i == 0;
+
+                Resource::SharedPtr<Render::Pipeline> pipeline = _renderer.getPipeline(pipelineId);
                 frameData.renderCmdBuffer.bindPipeline(pipeline->getPipelineAPI());
 
                 // Display primitive set by primitive set
@@ -285,40 +437,59 @@ bool Forward::render(
                     const auto& primitiveSet = *primitiveSetInstance.primitiveSet;
                     auto& material = *primitiveSetInstance.material;
 
-                    const Math::Mat4x4f pushConstants[] = {
-                        node.getTransform()
+                    uint32_t materialIndex;
+                    _materialTable->getIndex(material, materialIndex);
+
+                    // The transform is read by the vertex shader and the index of the material by the fragment shader
+                    const struct {
+                        Math::Mat4x4f transform;
+                        uint32_t materialIndex;
+                    } pushConstants{
+                        node.getTransform(),
+                        materialIndex
                     };
 
                     const API::CommandBuffer::CmdPushConstants cmdPushConstants{
                         /* cmdPushConstants.layout      */ static_cast<VkPipelineLayout>(*pipeline->getPipelineAPI().getLayout()),
-                        /* cmdPushConstants.stageFlags  */ VK_SHADER_STAGE_VERTEX_BIT,
+                        /* cmdPushConstants.stageFlags  */ VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
                         /* cmdPushConstants.offset      */ 0,
-                        /* cmdPushConstants.size        */ sizeof(pushConstants),
-                        /* cmdPushConstants.values      */ pushConstants
+                        /* cmdPushConstants.size        */ Pipeline::pushConstantsSize,
+                        /* cmdPushConstants.values      */ &pushConstants
                     };
                     frameData.renderCmdBuffer.pushConstants(cmdPushConstants);
 
-                    // Get the new (or old) material buffer
-                    const BufferPool::SubBuffer* materialBuffer = _materialBufferPool->allocate(frameData.transferCmdBuffer, material);
-                    materialBuffers.push_back(materialBuffer);
+                    // Bind the palette of the node with the camera, the set 0 stays compatible with all the layouts
+                    if (pipelineId.getPrimitivePart().skinned) {
+                        const std::vector<Math::Mat4x4f>& palette = node.getAnimator()->getPalette();
 
-                    if (!materialBuffer) {
-                        LUG_LOG.error("Forward::render: Can't allocate material buffer");
-                        return false;
-                    }
+                        if (palette.size() > maxJointsCount) {
+                            LUG_LOG.warn("Forward::render: Skin with more than {} joints, it is not drawn", maxJointsCount);
+                            continue;
+                        }
 
-                    // Get the new (or old) material descriptor set
-                    const DescriptorSetPool::DescriptorSet* materialDescriptorSet = _materialDescriptorSetPool->allocate(*materialBuffer);
-                    materialDescriptorSets.push_back(materialDescriptorSet);
+                        auto paletteOffset = paletteOffsets.find(&node);
+                        if (paletteOffset == paletteOffsets.end()) {
+                            uint32_t offset;
+                            if (!_uniformRing.write(palette.data(), static_cast<uint32_t>(palette.size() * sizeof(Math::Mat4x4f)), offset)) {
+                                LUG_LOG.error("Forward::render: Can't allocate palette buffer");
+                                return false;
+                            }
 
-                    if (!materialDescriptorSet) {
-                        LUG_LOG.error("Forward::render: Can't allocate material descriptor set");
-                        return false;
-                    }
+                            paletteOffset = paletteOffsets.emplace(&node, offset).first;
+                        }
+
+                        const API::CommandBuffer::CmdBindDescriptors paletteBind{
+                            /* paletteBind.pipelineLayout     */ *pipeline->getPipelineAPI().getLayout(),
+                            /* paletteBind.pipelineBindPoint  */ VK_PIPELINE_BIND_POINT_GRAPHICS,
+                            /* paletteBind.firstSet           */ 0,
+                            /* paletteBind.descriptorSets     */ {&frameData.cameraDescriptorSet},
+                            /* paletteBind.dynamicOffsets     */ {cameraOffset, paletteOffset->second},
+                        };
 
-                    std::vector<const API::DescriptorSet*> materialDescriptorSetsBind{&materialDescriptorSet->getDescriptorSet()};
+                        frameData.renderCmdBuffer.bindDescriptorSets(paletteBind);
+                    }
 
-                    if (pipeline->getPipelineAPI().getLayout()->getDescriptorSetLayouts().size() > 3) {
+                    if (!_bindlessTextures && pipeline->getPipelineAPI().getLayout()->getDescriptorSetLayouts().size() > 3) {
                         // Get the new (or old) material descriptor set
                         const DescriptorSetPool::DescriptorSet* materialTexturesDescriptorSet = _materialTexturesDescriptorSetPool->allocate(
                             pipeline->getPipelineAPI(),
@@ -356,20 +527,17 @@ bool Forward::render(
                         }
 
                         materialTexturesDescriptorSets.push_back(materialTexturesDescriptorSet);
-                        materialDescriptorSetsBind.push_back(&materialTexturesDescriptorSet->getDescriptorSet());
-                    }
 
-                    // Bind descriptor set of the material
-                    {
-                        const API::CommandBuffer::CmdBindDescriptors materialBind{
-                            /* materialBind.pipelineLayout     */ *pipeline->getPipelineAPI().getLayout(),
-                            /* materialBind.pipelineBindPoint  */ VK_PIPELINE_BIND_POINT_GRAPHICS,
-                            /* materialBind.firstSet           */ 2,
-                            /* materialBind.descriptorSets     */ materialDescriptorSetsBind,
-                            /* materialBind.dynamicOffsets     */ {materialBuffer->getOffset()},
+                        // Bind descriptor set of the material textures
+                        const API::CommandBuffer::CmdBindDescriptors materialTexturesBind{
+                            /* materialTexturesBind.pipelineLayout     */ *pipeline->getPipelineAPI().getLayout(),
+                            /* materialTexturesBind.pipelineBindPoint  */ VK_PIPELINE_BIND_POINT_GRAPHICS,
+                            /* materialTexturesBind.firstSet           */ 3,
+                            /* materialTexturesBind.descriptorSets     */ {&materialTexturesDescriptorSet->getDescriptorSet()},
+                            /* materialTexturesBind.dynamicOffsets     */ {},
                         };
 
-                        frameData.renderCmdBuffer.bindDescriptorSets(materialBind);
+                        frameData.renderCmdBuffer.bindDescriptorSets(materialTexturesBind);
                     }
 
                     if (!primitiveSet.position || !primitiveSet.normal) {
@@ -394,6 +562,11 @@ bool Forward::render(
                         vertexBuffers.push_back(static_cast<API::Buffer*>(color->_data));
                     }
 
+                    if (pipelineId.getPrimitivePart().skinned) {
+                        vertexBuffers.push_back(static_cast<API::Buffer*>(primitiveSet.joints->_data));
+                        vertexBuffers.push_back(static_cast<API::Buffer*>(primitiveSet.weights->_data));
+                    }
+
                     const std::vector<VkDeviceSize> offsets(vertexBuffers.size());
                     frameData.renderCmdBuffer.bindVertexBuffers(vertexBuffers, offsets);
 
@@ -419,42 +592,6 @@ bool Forward::render(
         }
     }
 
-    // Free and replace previous lightBuffers
-    {
-        for (const auto& subBuffer : frameData.lightBuffers) {
-            _lightBufferPool->free(subBuffer);
-        }
-
-        frameData.lightBuffers = lightBuffers;
-    }
-
-    // Free and replace previous materialBuffers
-    {
-        for (const auto& subBuffer : frameData.materialBuffers) {
-            _lightBufferPool->free(subBuffer);
-        }
-
-        frameData.materialBuffers = materialBuffers;
-    }
-
-    // Free and replace previous lightDescriptorSets
-    {
-        for (const auto& descriptorSet : frameData.lightDescriptorSets) {
-            _lightDescriptorSetPool->free(descriptorSet);
-        }
-
-        frameData.lightDescriptorSets = lightDescriptorSets;
-    }
-
-    // Free and replace previous materialDescriptorSets
-    {
-        for (const auto& descriptorSet : frameData.materialDescriptorSets) {
-            _materialDescriptorSetPool->free(descriptorSet);
-        }
-
-        frameData.materialDescriptorSets = materialDescriptorSets;
-    }
-
     // Free and replace previous materialTexturesDescriptorSets
     {
         for (const auto& descriptorSet : frameData.materialTexturesDescriptorSets) {
@@ -467,21 +604,18 @@ bool Forward::render(
     // End of the render pass
     frameData.renderCmdBuffer.endRenderPass();
 
-    if (!frameData.renderCmdBuffer.end() || !frameData.transferCmdBuffer.end()) {
+    // The uniform data of the frame is in use until the render fence is signaled
+    _uniformRing.endFrame(currentImageIndex);
+
+    if (!frameData.renderCmdBuffer.end()) {
         return false;
     }
 
-    return _transferQueue->submit(
-        frameData.transferCmdBuffer,
-        {static_cast<VkSemaphore>(frameData.transferSemaphore)},
-        {},
-        {},
-        static_cast<VkFence>(frameData.transferFence)
-    ) && _graphicsQueue->submit(
+    return _graphicsQueue->submit(
         frameData.renderCmdBuffer,
         {static_cast<VkSemaphore>(drawCompleteSemaphore)},
-        {static_cast<VkSemaphore>(frameData.transferSemaphore), static_cast<VkSemaphore>(imageReadySemaphore)},
-        {VK_PIPELINE_STAGE_VERTEX_SHADER_BIT, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT},
+        {static_cast<VkSemaphore>(imageReadySemaphore)},
+        {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT},
         static_cast<VkFence>(frameData.renderFence)
     );
 }
@@ -504,19 +638,10 @@ bool Forward::init(const std::vector<API::ImageView>& imageViews) {
         }
     }
 
-    // Init transfer queue
-    {
-        _transferQueue = _renderer.getDevice().getQueue("queue_transfer");
-        if (!_transferQueue) {
-            LUG_LOG.error("Forward::init: Can't find queue with name queue_transfer");
-            return false;
-        }
-
-        API::Builder::CommandPool commandPoolBuilder(_renderer.getDevice(), *_transferQueue->getQueueFamily());
-        if (!commandPoolBuilder.build(_transferCommandPool, &result)) {
-            LUG_LOG.error("Forward::init: Can't create the transfer command pool: {}", result);
-            return false;
-        }
+    // Init uniform ring
+    if (!_uniformRing.init(_renderer.getDevice(), {_graphicsQueue->getQueueFamily()->getIdx()}, uniformRingSize, maxJointsCount * sizeof(Math::Mat4x4f))) {
+        LUG_LOG.error("Forward::init: Can't create the uniform ring");
+        return false;
     }
 
     API::Builder::Fence fenceBuilder(_renderer.getDevice());
@@ -525,11 +650,6 @@ bool Forward::init(const std::vector<API::ImageView>& imageViews) {
     API::Builder::CommandBuffer graphicsCommandBufferBuilder(_renderer.getDevice(), _graphicsCommandPool);
     graphicsCommandBufferBuilder.setLevel(VK_COMMAND_BUFFER_LEVEL_PRIMARY);
 
-    API::Builder::CommandBuffer transferCommandBufferBuilder(_renderer.getDevice(), _transferCommandPool);
-    transferCommandBufferBuilder.setLevel(VK_COMMAND_BUFFER_LEVEL_PRIMARY);
-
-    API::Builder::Semaphore semaphoreBuilder(_renderer.getDevice());
-
     _framesData.resize(imageViews.size());
     for (uint32_t i = 0; i < _framesData.size(); ++i) {
         // Create the render fence
@@ -538,73 +658,54 @@ bool Forward::init(const std::vector<API::ImageView>& imageViews) {
             return false;
         }
 
-        // Create the transfer fence
-        if (!fenceBuilder.build(_framesData[i].transferFence, &result)) {
-            LUG_LOG.error("Forward::init: Can't create transfer fence: {}", result);
-            return false;
-        }
-
         // Create the render command buffer
         if (!graphicsCommandBufferBuilder.build(_framesData[i].renderCmdBuffer, &result)) {
             LUG_LOG.error("Forward::init: Can't create the render command buffer: {}", result);
             return false;
         }
 
-        // Create the transfer command buffer
-        if (!transferCommandBufferBuilder.build(_framesData[i].transferCmdBuffer, &result)) {
-            LUG_LOG.error("Forward::init: Can't create the transfer command buffer: {}", result);
-            return false;
-        }
-
-        if (!semaphoreBuilder.build(_framesData[i].transferSemaphore, &result)) {
-            LUG_LOG.error("Forward::init: Can't create the transfer semaphore: {}", result);
-            return false;
-        }
-    }
-
-    if (!_cameraBufferPool) {
-        _cameraBufferPool = std::make_unique<BufferPool::Camera>(_renderer);
-    }
-
-    if (!_lightBufferPool) {
-        _lightBufferPool = std::make_unique<BufferPool::Light>(_renderer);
+        // One camera and a few batches of lights per frame, it grows if needed
+        _framesData[i].descriptorAllocator = std::make_unique<DescriptorSetPool::DescriptorAllocator>(_renderer.getDevice(), 8);
     }
 
-    if (!_materialBufferPool) {
-        _materialBufferPool = std::make_unique<BufferPool::Material>(_renderer);
+    if (!_descriptorAllocator) {
+        _descriptorAllocator = std::make_unique<DescriptorSetPool::DescriptorAllocator>(_renderer.getDevice(), 64);
     }
 
     if (!_cameraDescriptorSetPool) {
         _cameraDescriptorSetPool = std::make_unique<DescriptorSetPool::Camera>(_renderer);
-        if (!_cameraDescriptorSetPool->init()) {
-            return false;
-        }
     }
 
     if (!_lightDescriptorSetPool) {
         _lightDescriptorSetPool = std::make_unique<DescriptorSetPool::Light>(_renderer);
-        if (!_lightDescriptorSetPool->init()) {
-            return false;
-        }
     }
 
     if (!_materialDescriptorSetPool) {
-        _materialDescriptorSetPool = std::make_unique<DescriptorSetPool::Material>(_renderer);
-        if (!_materialDescriptorSetPool->init()) {
-            return false;
-        }
+        _materialDescriptorSetPool = std::make_unique<DescriptorSetPool::Material>(_renderer, *_descriptorAllocator);
     }
 
     if (!_materialTexturesDescriptorSetPool) {
-        _materialTexturesDescriptorSetPool = std::make_unique<DescriptorSetPool::MaterialTextures>(_renderer);
-        if (!_materialTexturesDescriptorSetPool->init()) {
+        _materialTexturesDescriptorSetPool = std::make_unique<DescriptorSetPool::MaterialTextures>(_renderer, *_descriptorAllocator);
+    }
+
+    if (!_skyBoxDescriptorSetPool) {
+        _skyBoxDescriptorSetPool = std::make_unique<DescriptorSetPool::SkyBox>(_renderer, *_descriptorAllocator);
+    }
+
+    if (!_materialTable) {
+        _materialTable = std::make_unique<MaterialTable>();
+
+        if (!_materialTable->init(_renderer.getDevice(), {_graphicsQueue->getQueueFamily()->getIdx()}, maxMaterialsCount)) {
+            LUG_LOG.error("Forward::init: Can't create the material table");
             return false;
         }
     }
 
-    if (!_skyBoxDescriptorSetPool) {
-        _skyBoxDescriptorSetPool = std::make_unique<DescriptorSetPool::SkyBox>(_renderer);
-        if (!_skyBoxDescriptorSetPool->init()) {
+    if (!_bindlessTextures && _renderer.isBindlessEnabled()) {
+        _bindlessTextures = std::make_unique<BindlessTextures>();
+
+        if (!_bindlessTextures->init(_renderer.getDevice())) {
+            LUG_LOG.error("Forward::init: Can't create the array of textures");
             return false;
         }
     }
@@ -616,54 +717,47 @@ void Forward::destroy() {
     --_forwardCount;
 
     _graphicsQueue->waitIdle();
-    _transferQueue->waitIdle();
 
     for (auto& frameData : _framesData) {
-        _cameraBufferPool->free(frameData.cameraBuffer);
-
-        for (const auto& subBuffer : frameData.lightBuffers) {
-            _lightBufferPool->free(subBuffer);
-        }
-
-        for (const auto& subBuffer : frameData.materialBuffers) {
-            _lightBufferPool->free(subBuffer);
-        }
-
-        _cameraDescriptorSetPool->free(frameData.cameraDescriptorSet);
-
-        for (const auto& descriptorSet : frameData.lightDescriptorSets) {
-            _lightDescriptorSetPool->free(descriptorSet);
-        }
-
-        for (const auto& descriptorSet : frameData.materialDescriptorSets) {
-            _materialDescriptorSetPool->free(descriptorSet);
-        }
-
         for (const auto& descriptorSet : frameData.materialTexturesDescriptorSets) {
             _materialTexturesDescriptorSetPool->free(descriptorSet);
         }
 
         _skyBoxDescriptorSetPool->free(frameData.skyBoxDescriptorSet);
+        _materialDescriptorSetPool->free(frameData.materialTableDescriptorSet);
     }
 
     _framesData.clear();
 
     _depthBufferMemory.destroy();
+    _uniformRing.destroy();
 
     if (_forwardCount == 0) {
-        _cameraBufferPool.reset();
-        _lightBufferPool.reset();
-        _materialBufferPool.reset();
-
         _cameraDescriptorSetPool.reset();
         _lightDescriptorSetPool.reset();
         _materialDescriptorSetPool.reset();
         _materialTexturesDescriptorSetPool.reset();
         _skyBoxDescriptorSetPool.reset();
+        _materialTable.reset();
+        _bindlessTextures.reset();
+
+        _descriptorAllocator.reset();
     }
 
     _graphicsCommandPool.destroy();
-    _transferCommandPool.destroy();
+}
+
+void Forward::releaseMaterial(Resource::Handle handle) {
+    // The table doesn't exist before the first view and after the last one
+    if (_materialTable) {
+        _materialTable->release(handle);
+    }
+}
+
+void Forward::releaseTexture(Resource::Handle handle) {
+    if (_bindlessTextures) {
+        _bindlessTextures->release(handle);
+    }
 }
 
 bool Forward::initDepthBuffers(const std::vector<API::ImageView>& imageViews) {
@@ -733,7 +827,7 @@ bool Forward::initDepthBuffers(const std::vector<API::ImageView>& imageViews) {
 
 bool Forward::initFramebuffers(const std::vector<API::ImageView>& imageViews) {
     // The lights pipelines renderpass are compatible, so we don't need to create different frame buffers for each pipeline
-    const auto& basePipeline = _renderer.getPipeline(Pipeline::getBaseId());
+    const auto& basePipeline = _renderer.getPipeline(Pipeline::getBaseId(_renderer.isBindlessEnabled()));
 
     if (!basePipeline) {
         return false;
@@ -1,4 +1,8 @@
 #include <lug/Graphics/Vulkan/Render/Texture.hpp>
+
+#include <algorithm>
+
+#include <lug/Graphics/Render/Ktx2.hpp>
 #include <lug/System/Logger/Logger.hpp>
 
 namespace lug {
@@ -12,6 +16,26 @@ Texture::~Texture() {
     destroy();
 }
 
+uint64_t Texture::getLevelsSize(uint32_t firstLevel) const {
+    ::lug::Graphics::Render::Ktx2::FormatInfo info;
+    if (!::lug::Graphics::Render::Ktx2::getFormatInfo(static_cast<::lug::Graphics::Render::Ktx2::Format>(_format), info)) {
+        return 0;
+    }
+
+    uint64_t size = 0;
+    for (uint32_t level = firstLevel; level < _levelsCount; ++level) {
+        size += ::lug::Graphics::Render::Ktx2::getImageSize(info, std::max(_width >> level, 1u), std::max(_height >> level, 1u));
+    }
+
+    return size * _layersCount;
+}
+
+void Texture::unload() {
+    _imageView.destroy();
+    _image.destroy();
+    _deviceMemory.destroy();
+}
+
 void Texture::destroy() {
     _sampler.destroy();
     _imageView.destroy();
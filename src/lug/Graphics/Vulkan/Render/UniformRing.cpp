@@ -0,0 +1,111 @@
+#include <lug/Graphics/Vulkan/Render/UniformRing.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#include <lug/Graphics/Vulkan/API/Builder/Buffer.hpp>
+#include <lug/Graphics/Vulkan/API/Builder/DeviceMemory.hpp>
+#include <lug/Graphics/Vulkan/API/Device.hpp>
+#include <lug/System/Logger/Logger.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Vulkan {
+namespace Render {
+
+UniformRing::~UniformRing() {
+    destroy();
+}
+
+bool UniformRing::init(const API::Device& device, const std::set<uint32_t>& queueFamilyIndices, uint32_t size, uint32_t maxRangeSize) {
+    // Create buffer
+    {
+        API::Builder::Buffer bufferBuilder(device);
+
+        bufferBuilder.setQueueFamilyIndices(queueFamilyIndices);
+        bufferBuilder.setSize(size + maxRangeSize);
+        // The joints palettes are storage buffers, a uniform buffer would limit their size
+        bufferBuilder.setUsage(VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+
+        VkResult result{VK_SUCCESS};
+        if (!bufferBuilder.build(_buffer, &result)) {
+            LUG_LOG.error("UniformRing::init: Can't create buffer: {}", result);
+            return false;
+        }
+    }
+
+    // Create buffer memory, coherent to not have to flush the ranges written
+    {
+        API::Builder::DeviceMemory deviceMemoryBuilder(device);
+        deviceMemoryBuilder.setMemoryFlags(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+        if (!deviceMemoryBuilder.addBuffer(_buffer)) {
+            LUG_LOG.error("UniformRing::init: Can't add buffer to device memory");
+            return false;
+        }
+
+        VkResult result{VK_SUCCESS};
+        if (!deviceMemoryBuilder.build(_bufferMemory, &result)) {
+            LUG_LOG.error("UniformRing::init: Can't create device memory: {}", result);
+            return false;
+        }
+    }
+
+    _data = static_cast<uint8_t*>(_bufferMemory.mapBuffer(_buffer));
+    if (!_data) {
+        LUG_LOG.error("UniformRing::init: Can't map the buffer");
+        return false;
+    }
+
+    const VkPhysicalDeviceLimits& limits = device.getPhysicalDeviceInfo()->properties.limits;
+    const VkDeviceSize alignment = std::max(limits.minUniformBufferOffsetAlignment, limits.minStorageBufferOffsetAlignment);
+    _allocator = ::lug::Graphics::Render::RingAllocator(size, static_cast<size_t>(alignment));
+
+    return true;
+}
+
+void UniformRing::destroy() {
+    if (_data) {
+        _bufferMemory.unmap();
+        _data = nullptr;
+    }
+
+    _buffer.destroy();
+    _bufferMemory.destroy();
+
+    _allocator = ::lug::Graphics::Render::RingAllocator();
+}
+
+void* UniformRing::allocate(uint32_t size, uint32_t& offset) {
+    size_t rangeOffset;
+    if (!_allocator.allocate(size, rangeOffset)) {
+        LUG_LOG.error("UniformRing::allocate: The ring is full ({} bytes used)", _allocator.getUsedSize());
+        return nullptr;
+    }
+
+    offset = static_cast<uint32_t>(rangeOffset);
+    return _data + rangeOffset;
+}
+
+bool UniformRing::write(const void* data, uint32_t size, uint32_t& offset) {
+    void* range = allocate(size, offset);
+    if (!range) {
+        return false;
+    }
+
+    std::memcpy(range, data, size);
+    return true;
+}
+
+void UniformRing::endFrame(uint32_t frameIndex) {
+    _allocator.endFrame(frameIndex);
+}
+
+void UniformRing::releaseFrame(uint32_t frameIndex) {
+    _allocator.releaseFrame(frameIndex);
+}
+
+} // Render
+} // Vulkan
+} // Graphics
+} // lug
@@ -1,11 +1,19 @@
 #include <lug/Graphics/Vulkan/Renderer.hpp>
 
+#include <algorithm>
+
 #include <lug/Graphics/Graphics.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/Device.hpp>
 #include <lug/Graphics/Vulkan/API/Builder/Instance.hpp>
 #include <lug/Graphics/Vulkan/API/RTTI/Enum.hpp>
+#include <lug/Graphics/Vulkan/Builder/Mesh.hpp>
+#include <lug/Graphics/Vulkan/Builder/Texture.hpp>
 #include <lug/Graphics/Vulkan/Requirements/Core.hpp>
 #include <lug/Graphics/Vulkan/Requirements/Requirements.hpp>
+#include <lug/Graphics/Vulkan/Render/Mesh.hpp>
+#include <lug/Graphics/Vulkan/Render/Pipeline.hpp>
+#include <lug/Graphics/Vulkan/Render/Technique/Forward.hpp>
+#include <lug/Graphics/Vulkan/Render/Texture.hpp>
 #include <lug/Graphics/Vulkan/Render/Window.hpp>
 #include <lug/System/Logger/Logger.hpp>
 #include <lug/Math/Geometry/Transform.hpp>
@@ -53,6 +61,49 @@ static VKAPI_ATTR VkBool32 VKAPI_CALL debugReportCallback(
     return VK_FALSE;
 }
 
+// The materials and textures used by the nodes of a scene
+static std::vector<Resource::Handle> getMaterialsAndTextures(const ::lug::Graphics::Scene::Scene* scene) {
+    std::vector<Resource::Handle> handles;
+
+    std::vector<const ::lug::Graphics::Node*> nodes;
+    if (scene) {
+        nodes.push_back(&scene->getRoot());
+    }
+
+    while (!nodes.empty()) {
+        const ::lug::Graphics::Scene::Node* node = static_cast<const ::lug::Graphics::Scene::Node*>(nodes.back());
+        nodes.pop_back();
+
+        nodes.insert(nodes.end(), node->getChildren().begin(), node->getChildren().end());
+
+        if (!node->getMeshInstance()) {
+            continue;
+        }
+
+        for (const auto& material : node->getMeshInstance()->materials) {
+            if (!material) {
+                continue;
+            }
+
+            handles.push_back(material->getHandle());
+
+            for (const ::lug::Graphics::Render::Material::TextureInfo* textureInfo : {
+                &material->getBaseColorTexture(),
+                &material->getMetallicRoughnessTexture(),
+                &material->getNormalTexture(),
+                &material->getOcclusionTexture(),
+                &material->getEmissiveTexture()
+            }) {
+                if (textureInfo->texture) {
+                    handles.push_back(textureInfo->texture->getHandle());
+                }
+            }
+        }
+    }
+
+    return handles;
+}
+
 Renderer::Renderer(Graphics& graphics) : ::lug::Graphics::Renderer(graphics, Renderer::Type::Vulkan) {}
 
 Renderer::~Renderer() {
@@ -65,6 +116,10 @@ void Renderer::destroy() {
 
     _resourceManager.reset();
     _pipelines.clear();
+    _pipelineReloads.clear();
+    _sceneReloads.clear();
+    _textureStreams.clear();
+    _retiredObjects.clear();
 
     _device.destroy();
 
@@ -106,6 +161,10 @@ bool Renderer::finishInit() {
 
         _resourceManager.reset();
         _pipelines.clear();
+        _pipelineReloads.clear();
+        _sceneReloads.clear();
+        _textureStreams.clear();
+        _retiredObjects.clear();
 
         _device.destroy();
     }
@@ -121,9 +180,437 @@ bool Renderer::finishInit() {
 
     _resourceManager = std::make_unique<::lug::Graphics::ResourceManager>(*this);
 
+    // Textures and meshes used by the render queue are evicted when the budget is exceeded
+    {
+        ResourceBudget& budget = _resourceManager->getBudget();
+
+        budget.setProvider(this);
+        budget.setBudget(queryMemoryBudget());
+
+#if defined(LUG_DEBUG)
+        LUG_LOG.info("RendererVulkan: Use a memory budget of {} bytes", budget.getBudget());
+#endif
+    }
+
+    // The levels of the streamed textures are loaded with the memory left by the other resources, see endFrame
+    {
+        TextureStreamer& streamer = _resourceManager->getTextureStreamer();
+
+        streamer.setProvider(this);
+    }
+
+    // The files of the resources are watched by the resource manager once enabled
+    if (_initInfo.hotReload && _resourceManager->enableHotReload()) {
+        _resourceManager->watchDirectory(_initInfo.shadersRoot + "forward/");
+    }
+
     return true;
 }
 
+uint64_t Renderer::queryMemoryBudget() const {
+    if (_initInfo.memoryBudget) {
+        return _initInfo.memoryBudget;
+    }
+
+#if defined(VK_EXT_memory_budget)
+    if (isDeviceExtensionLoaded(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME)) {
+        auto vkGetPhysicalDeviceMemoryProperties2KHR = _instance.getProcAddr<PFN_vkGetPhysicalDeviceMemoryProperties2KHR>("vkGetPhysicalDeviceMemoryProperties2KHR");
+
+        if (vkGetPhysicalDeviceMemoryProperties2KHR) {
+            VkPhysicalDeviceMemoryBudgetPropertiesEXT memoryBudgetProperties{};
+            memoryBudgetProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+
+            VkPhysicalDeviceMemoryProperties2KHR memoryProperties{};
+            memoryProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2_KHR;
+            memoryProperties.pNext = &memoryBudgetProperties;
+
+            vkGetPhysicalDeviceMemoryProperties2KHR(_physicalDeviceInfo->handle, &memoryProperties);
+
+            uint64_t budget{0};
+            for (uint32_t i = 0; i < memoryProperties.memoryProperties.memoryHeapCount; ++i) {
+                if (memoryProperties.memoryProperties.memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) {
+                    budget += memoryBudgetProperties.heapBudget[i];
+                }
+            }
+
+            return budget;
+        }
+    }
+#endif
+
+    // No budget, nothing will be evicted
+    return 0;
+}
+
+uint64_t Renderer::getResourceSize(Resource::Handle handle) const {
+    Resource* resource = _resourceManager->get(handle).get();
+    if (!resource) {
+        return 0;
+    }
+
+    switch (resource->getType()) {
+        case Resource::Type::Texture:
+            return static_cast<Render::Texture*>(resource)->getDeviceMemory().getSize();
+        case Resource::Type::Mesh:
+            return static_cast<Render::Mesh*>(resource)->getDeviceMemory().getSize();
+        default:
+            return 0;
+    }
+}
+
+bool Renderer::evictResource(Resource::Handle handle) {
+    Resource* resource = _resourceManager->get(handle).get();
+    if (!resource) {
+        return false;
+    }
+
+    // The frames in flight can still use the resource, it is destroyed later
+    switch (resource->getType()) {
+        case Resource::Type::Texture:
+            Builder::Texture::unload(*this, *static_cast<Render::Texture*>(resource));
+            return true;
+        case Resource::Type::Mesh:
+            Builder::Mesh::unload(*this, *static_cast<Render::Mesh*>(resource));
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool Renderer::reloadResource(Resource::Handle handle) {
+    Resource* resource = _resourceManager->get(handle).get();
+    if (!resource) {
+        return false;
+    }
+
+    switch (resource->getType()) {
+        case Resource::Type::Texture:
+            return Builder::Texture::load(*this, *static_cast<Render::Texture*>(resource));
+        case Resource::Type::Mesh:
+            return Builder::Mesh::load(*this, *static_cast<Render::Mesh*>(resource));
+        default:
+            return false;
+    }
+}
+
+uint64_t Renderer::getLevelsSize(Resource::Handle handle, uint32_t firstLevel) const {
+    Resource::SharedPtr<Render::Texture> texture = _resourceManager->get<Render::Texture>(handle);
+    return texture ? texture->getLevelsSize(firstLevel) : 0;
+}
+
+bool Renderer::streamLevels(Resource::Handle handle, uint32_t firstLevel) {
+    Resource::SharedPtr<Render::Texture> texture = _resourceManager->get<Render::Texture>(handle);
+    if (!texture || !texture->isStreaming()) {
+        return false;
+    }
+
+    // The textures missing the most levels are read first, the released levels last
+    const int32_t priority = static_cast<int32_t>(texture->getFirstLevel()) - static_cast<int32_t>(firstLevel);
+
+    std::shared_ptr<AsyncLoader::Ticket> ticket = _resourceManager->getAsyncLoader().enqueue(texture->getName(), priority, Builder::Texture::createStreamTask(*this, texture, firstLevel));
+    if (!ticket) {
+        return false;
+    }
+
+    _textureStreams.push_back({handle, ticket});
+
+    return true;
+}
+
+void Renderer::onResourceRemoved(const Resource& resource) {
+    switch (resource.getType()) {
+        case Resource::Type::Material:
+            Render::Technique::Forward::releaseMaterial(resource.getHandle());
+            break;
+        case Resource::Type::Texture:
+        {
+            // The streams not integrated yet are dropped, the build stage of the others doesn't find the texture anymore
+            const auto it = std::remove_if(_textureStreams.begin(), _textureStreams.end(), [&resource](const TextureStream& textureStream) {
+                if (!(textureStream.texture == resource.getHandle())) {
+                    return false;
+                }
+
+                textureStream.ticket->cancel();
+                return true;
+            });
+
+            _textureStreams.erase(it, _textureStreams.end());
+
+            Render::Technique::Forward::releaseTexture(resource.getHandle());
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void Renderer::destroyLater(API::Image image, API::ImageView imageView, API::DeviceMemory deviceMemory) {
+    _retiredObjects.push_back({
+        std::move(deviceMemory),
+        std::move(image),
+        std::move(imageView),
+        {},
+        _frame
+    });
+}
+
+void Renderer::destroyLater(std::vector<API::Buffer> buffers, API::DeviceMemory deviceMemory) {
+    _retiredObjects.push_back({
+        std::move(deviceMemory),
+        {},
+        {},
+        std::move(buffers),
+        _frame
+    });
+}
+
+void Renderer::destroyRetiredObjects() {
+    const uint64_t retireDelay = getRetireDelay();
+
+    _retiredObjects.erase(std::remove_if(_retiredObjects.begin(), _retiredObjects.end(), [this, retireDelay](const RetiredObjects& retiredObjects) {
+        return retiredObjects.frame + retireDelay <= _frame;
+    }), _retiredObjects.end());
+}
+
+void Renderer::updateTextureStreams() {
+    TextureStreamer& streamer = _resourceManager->getTextureStreamer();
+
+    for (auto it = _textureStreams.begin(); it != _textureStreams.end();) {
+        if (!it->ticket->isDone()) {
+            ++it;
+            continue;
+        }
+
+        const bool streamed = it->ticket->getStatus() == AsyncLoader::Ticket::Status::Completed;
+        if (!streamed) {
+            LUG_LOG.error("RendererVulkan: Can't stream the levels of the texture {}", it->ticket->getName());
+        }
+
+        streamer.finishStream(it->texture, streamed);
+        it = _textureStreams.erase(it);
+    }
+}
+
+void Renderer::reloadModifiedFiles() {
+    const std::string shadersDirectory = _initInfo.shadersRoot + "forward/";
+
+    bool shadersModified = false;
+    std::vector<Resource::Handle> textures;
+
+    for (const auto& filename : _resourceManager->pollModifiedFiles()) {
+        // All the pipelines are built from the same shaders, with different macros
+        if (filename.compare(0, shadersDirectory.size(), shadersDirectory) == 0) {
+            shadersModified = true;
+            continue;
+        }
+
+        for (const Resource::Handle handle : _resourceManager->getWatchingResources(filename)) {
+            switch (static_cast<Resource::Type>(handle.type)) {
+                case Resource::Type::Texture:
+                    if (std::find(textures.begin(), textures.end(), handle) == textures.end()) {
+                        textures.push_back(handle);
+                    }
+                    break;
+                case Resource::Type::Scene:
+                {
+                    // The meshes are replaced once the file is loaded again
+                    std::shared_ptr<std::vector<Resource::Handle>> createdHandles = std::make_shared<std::vector<Resource::Handle>>();
+                    std::shared_ptr<AsyncLoader::Ticket> ticket = _resourceManager->reloadFileAsync(filename, createdHandles);
+                    if (ticket) {
+                        _sceneReloads.push_back({handle, createdHandles, ticket});
+                    }
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+    }
+
+    if (shadersModified) {
+        reloadPipelines();
+    }
+
+    replacePipelines();
+
+    if (!textures.empty()) {
+        reloadTextures(textures);
+    }
+
+    for (auto it = _sceneReloads.begin(); it != _sceneReloads.end();) {
+        if (!it->ticket->isDone()) {
+            ++it;
+            continue;
+        }
+
+        Resource::SharedPtr<::lug::Graphics::Scene::Scene> scene = _resourceManager->get<::lug::Graphics::Scene::Scene>(it->scene);
+
+        // The materials and textures used before the replacement of the meshes
+        std::vector<Resource::Handle> replacedHandles;
+
+        if (it->ticket->getStatus() == AsyncLoader::Ticket::Status::Completed) {
+            Resource::SharedPtr<::lug::Graphics::Scene::Scene> reloadedScene = Resource::SharedPtr<::lug::Graphics::Scene::Scene>::cast(it->ticket->getResource());
+
+            if (scene && reloadedScene) {
+                replacedHandles = getMaterialsAndTextures(scene.get());
+
+                _device.waitIdle();
+                replaceSceneMeshes(*scene, *reloadedScene);
+            }
+        } else {
+            LUG_LOG.error("RendererVulkan: Can't reload the file {}", it->ticket->getName());
+        }
+
+        // Only the meshes are kept, with the materials and textures they now use
+        removeReloadedResources(scene.get(), *it->createdHandles, replacedHandles);
+
+        it = _sceneReloads.erase(it);
+    }
+}
+
+void Renderer::reloadPipelines() {
+    for (const auto& it : _pipelines) {
+        Resource::SharedPtr<Render::Pipeline> pipeline = it.second.lock();
+        if (!pipeline) {
+            continue;
+        }
+
+        std::shared_ptr<PipelineReload> pipelineReload = std::make_shared<PipelineReload>();
+        pipelineReload->pipeline = pipeline;
+
+        const Render::Pipeline::Id id = it.first;
+
+        // The build stage only ends the load, the pipelines are replaced by replacePipelines
+        AsyncLoader::Task task{
+            /* task.read */ [this, id, pipelineReload](AsyncLoader::Ticket&) {
+                return Render::Pipeline::buildShaders(*this, id, pipelineReload->vertexShaderCode, pipelineReload->fragmentShaderCode);
+            },
+            /* task.build */ [pipeline](AsyncLoader::Ticket&) -> Resource::SharedPtr<Resource> {
+                return Resource::SharedPtr<Resource>(pipeline.get());
+            }
+        };
+
+        pipelineReload->ticket = _resourceManager->getAsyncLoader().enqueue("pipeline", 0, std::move(task));
+
+        if (pipelineReload->ticket) {
+            _pipelineReloads.push_back(std::move(pipelineReload));
+        }
+    }
+}
+
+void Renderer::replacePipelines() {
+    if (_pipelineReloads.empty()) {
+        return;
+    }
+
+    for (const auto& pipelineReload : _pipelineReloads) {
+        if (!pipelineReload->ticket->isDone()) {
+            return;
+        }
+    }
+
+    // Wait once for all the pipelines
+    _device.waitIdle();
+
+    for (const auto& pipelineReload : _pipelineReloads) {
+        Render::Pipeline& pipeline = *pipelineReload->pipeline;
+
+        if (pipelineReload->ticket->getStatus() != AsyncLoader::Ticket::Status::Completed) {
+            LUG_LOG.error("RendererVulkan: Can't compile the shaders of the pipeline {}", static_cast<uint32_t>(pipeline.getId()));
+            continue;
+        }
+
+        if (!pipeline.reload(pipelineReload->vertexShaderCode, pipelineReload->fragmentShaderCode)) {
+            LUG_LOG.error("RendererVulkan: Can't reload the pipeline {}", static_cast<uint32_t>(pipeline.getId()));
+        }
+    }
+
+    _pipelineReloads.clear();
+}
+
+void Renderer::reloadTextures(const std::vector<Resource::Handle>& textures) {
+    ResourceBudget& budget = _resourceManager->getBudget();
+    TextureStreamer& streamer = _resourceManager->getTextureStreamer();
+
+    _device.waitIdle();
+
+    for (const Resource::Handle handle : textures) {
+        // An evicted texture is read from its files when it is used again
+        if (budget.isTracked(handle) && !budget.isResident(handle)) {
+            continue;
+        }
+
+        Resource::SharedPtr<Render::Texture> texture = _resourceManager->get<Render::Texture>(handle);
+        if (!texture) {
+            continue;
+        }
+
+        texture->unload();
+
+        if (!Builder::Texture::load(*this, *texture)) {
+            LUG_LOG.error("RendererVulkan: Can't reload the texture {}", texture->getName());
+        }
+
+        // Its size may have changed
+        budget.untrack(handle);
+
+        if (texture->isStreaming()) {
+            streamer.untrack(handle);
+            streamer.track(handle, texture->getWidth(), texture->getHeight(), texture->getLevelsCount(), texture->getFirstLevel());
+        }
+    }
+}
+
+void Renderer::replaceSceneMeshes(::lug::Graphics::Scene::Scene& scene, ::lug::Graphics::Scene::Scene& reloadedScene) {
+    ResourceBudget& budget = _resourceManager->getBudget();
+    std::vector<Render::Mesh*> replacedMeshes;
+
+    std::vector<const ::lug::Graphics::Node*> nodes{&reloadedScene.getRoot()};
+
+    while (!nodes.empty()) {
+        const ::lug::Graphics::Scene::Node* reloadedNode = static_cast<const ::lug::Graphics::Scene::Node*>(nodes.back());
+        nodes.pop_back();
+
+        nodes.insert(nodes.end(), reloadedNode->getChildren().begin(), reloadedNode->getChildren().end());
+
+        // The nodes are matched by name
+        ::lug::Graphics::Scene::Node* node = scene.getSceneNode(reloadedNode->getName());
+        if (!node || !node->getMeshInstance() || !reloadedNode->getMeshInstance()) {
+            continue;
+        }
+
+        Render::Mesh* mesh = static_cast<Render::Mesh*>(node->getMeshInstance()->mesh.get());
+        Render::Mesh* reloadedMesh = static_cast<Render::Mesh*>(reloadedNode->getMeshInstance()->mesh.get());
+
+        // A mesh can be shared by several nodes
+        if (std::find(replacedMeshes.begin(), replacedMeshes.end(), reloadedMesh) == replacedMeshes.end()) {
+            // The reloaded mesh now holds the previous buffers, destroyed with it by removeReloadedResources
+            mesh->swap(*reloadedMesh);
+            budget.untrack(mesh->getHandle());
+
+            replacedMeshes.push_back(reloadedMesh);
+        }
+
+        // Use the materials of the new primitive sets
+        node->attachMeshInstance(node->getMeshInstance()->mesh);
+    }
+}
+
+void Renderer::removeReloadedResources(::lug::Graphics::Scene::Scene* scene, const std::vector<Resource::Handle>& createdHandles, const std::vector<Resource::Handle>& replacedHandles) {
+    // The materials and textures used by the nodes of the scene after the replacement of its meshes
+    const std::vector<Resource::Handle> usedHandles = getMaterialsAndTextures(scene);
+
+    // The reloaded meshes hold the previous buffers, the device is idle since the replacement.
+    // The previous materials and textures are only kept if a node didn't get a new mesh.
+    for (const std::vector<Resource::Handle>* handles : {&createdHandles, &replacedHandles}) {
+        for (const Resource::Handle handle : *handles) {
+            if (std::find(usedHandles.begin(), usedHandles.end(), handle) == usedHandles.end()) {
+                _resourceManager->remove(handle);
+            }
+        }
+    }
+}
+
 bool Renderer::initInstance(const std::string& appName, const Core::Version& appVersion) {
     VkResult result{VK_SUCCESS};
 
@@ -292,6 +779,39 @@ bool Renderer::initInstance(const std::string& appName, const Core::Version& app
 #undef LUG_LOAD_IMAGE_FORMAT_PROPERTIES
             }
 
+#if defined(VK_EXT_descriptor_indexing)
+            // Load descriptor indexing features and properties, used by the bindless mode
+            if (isInstanceExtensionLoaded(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME) &&
+                _physicalDeviceInfos[idx].containsExtension(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME)) {
+                auto vkGetPhysicalDeviceFeatures2KHR = _instance.getProcAddr<PFN_vkGetPhysicalDeviceFeatures2KHR>("vkGetPhysicalDeviceFeatures2KHR");
+                auto vkGetPhysicalDeviceProperties2KHR = _instance.getProcAddr<PFN_vkGetPhysicalDeviceProperties2KHR>("vkGetPhysicalDeviceProperties2KHR");
+
+                if (vkGetPhysicalDeviceFeatures2KHR && vkGetPhysicalDeviceProperties2KHR) {
+                    auto& descriptorIndexingFeatures = _physicalDeviceInfos[idx].descriptorIndexingFeatures;
+                    descriptorIndexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+
+                    VkPhysicalDeviceFeatures2KHR features{};
+                    features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR;
+                    features.pNext = &descriptorIndexingFeatures;
+
+                    vkGetPhysicalDeviceFeatures2KHR(physicalDevices[idx], &features);
+
+                    auto& descriptorIndexingProperties = _physicalDeviceInfos[idx].descriptorIndexingProperties;
+                    descriptorIndexingProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES_EXT;
+
+                    VkPhysicalDeviceProperties2KHR properties{};
+                    properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2_KHR;
+                    properties.pNext = &descriptorIndexingProperties;
+
+                    vkGetPhysicalDeviceProperties2KHR(physicalDevices[idx], &properties);
+
+                    // The structures are copied with the PhysicalDeviceInfo, don't keep the chain
+                    descriptorIndexingFeatures.pNext = nullptr;
+                    descriptorIndexingProperties.pNext = nullptr;
+                }
+            }
+#endif
+
             // TODO: Get additional informations (images properties, etc)
         }
     }
@@ -363,6 +883,35 @@ bool Renderer::initDevice() {
         deviceBuilder.setExtensions(_loadedDeviceExtensions);
         deviceBuilder.setFeatures(_loadedDeviceFeatures);
 
+#if defined(VK_EXT_descriptor_indexing)
+        // The bindless mode needs a partially bound array of textures, updated while the previous frames are in flight
+        if (_initInfo.bindless && isDeviceExtensionLoaded(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME)) {
+            const auto& features = _physicalDeviceInfo->descriptorIndexingFeatures;
+
+            if (features.runtimeDescriptorArray &&
+                features.descriptorBindingPartiallyBound &&
+                features.descriptorBindingUpdateUnusedWhilePending &&
+                features.descriptorBindingSampledImageUpdateAfterBind &&
+                features.shaderSampledImageArrayNonUniformIndexing) {
+                _loadedDescriptorIndexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+                _loadedDescriptorIndexingFeatures.runtimeDescriptorArray = VK_TRUE;
+                _loadedDescriptorIndexingFeatures.descriptorBindingPartiallyBound = VK_TRUE;
+                _loadedDescriptorIndexingFeatures.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+                _loadedDescriptorIndexingFeatures.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+                _loadedDescriptorIndexingFeatures.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+
+                deviceBuilder.setNext(&_loadedDescriptorIndexingFeatures);
+                _bindless = true;
+            }
+        }
+
+        if (_initInfo.bindless && !_bindless) {
+            LUG_LOG.info("RendererVulkan: Descriptor indexing is not supported, the bindless mode is disabled");
+        } else if (_bindless) {
+            LUG_LOG.info("RendererVulkan: The bindless mode is enabled");
+        }
+#endif
+
         if (!deviceBuilder.addQueues(VK_QUEUE_GRAPHICS_BIT, {"queue_graphics"}) ||
             !deviceBuilder.addQueues(VK_QUEUE_TRANSFER_BIT, {"queue_transfer"})) {
             return false;
@@ -575,6 +1124,21 @@ inline std::vector<const char*> Renderer::checkRequirementsExtensions(const Info
 }
 
 bool Renderer::beginFrame(const lug::System::Time& elapsedTime) {
+    // The number of frames in flight changes with the swapchain
+    {
+        const uint32_t framesInFlightCount = getFramesInFlightCount();
+
+        _resourceManager->getBudget().setEvictionDelay(framesInFlightCount);
+        _resourceManager->getTextureStreamer().setReleaseDelay(framesInFlightCount);
+    }
+
+    // Create the resources loaded asynchronously, the others are created by the next frames
+    _resourceManager->integrateLoads(_initInfo.maxLoadsPerFrame);
+
+    if (_resourceManager->isHotReloadEnabled()) {
+        reloadModifiedFiles();
+    }
+
     return _window->beginFrame(elapsedTime);
 }
 
@@ -589,6 +1153,36 @@ bool Renderer::endFrame() {
         }
     }
 
+    // Only warn once each time the budget is exceeded
+    {
+        ResourceBudget& budget = _resourceManager->getBudget();
+        const bool budgetExceeded = !budget.nextFrame();
+
+        if (budgetExceeded && !_budgetExceeded) {
+            LUG_LOG.warn("RendererVulkan: The resources in use exceed the memory budget ({} / {} bytes)", budget.getUsage(), budget.getBudget());
+        }
+
+        _budgetExceeded = budgetExceeded;
+    }
+
+    // The streamed levels use the memory left by the other resources
+    {
+        const ResourceBudget& budget = _resourceManager->getBudget();
+        TextureStreamer& streamer = _resourceManager->getTextureStreamer();
+
+        updateTextureStreams();
+
+        if (budget.getBudget()) {
+            // A budget of 0 would disable the limit
+            streamer.setBudget(budget.getBudget() > budget.getUsage() ? budget.getBudget() - budget.getUsage() : 1);
+        }
+
+        streamer.nextFrame();
+    }
+
+    ++_frame;
+    destroyRetiredObjects();
+
     return _window->endFrame();
 }
 
@@ -26,7 +26,10 @@ const Renderer::Requirements requirements{
     // optionalInstanceExtensions
     {
 #if defined(LUG_DEBUG)
-        VK_EXT_DEBUG_REPORT_EXTENSION_NAME
+        VK_EXT_DEBUG_REPORT_EXTENSION_NAME,
+#endif
+#if defined(VK_KHR_get_physical_device_properties2)
+        VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME, // Needed by VK_EXT_memory_budget and VK_EXT_descriptor_indexing
 #endif
     },
 
@@ -38,7 +41,15 @@ const Renderer::Requirements requirements{
     },
 
     // optionalDeviceExtensions
-    {},
+    {
+#if defined(VK_EXT_memory_budget)
+        VK_EXT_MEMORY_BUDGET_EXTENSION_NAME,
+#endif
+#if defined(VK_EXT_descriptor_indexing)
+        VK_KHR_MAINTENANCE3_EXTENSION_NAME, // Needed by VK_EXT_descriptor_indexing
+        VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME,
+#endif
+    },
 
     // mandatoryFeatures
     {
@@ -121,9 +132,9 @@ const Renderer::Requirements requirements{
         VK_FALSE, // alphaToOne
         VK_FALSE, // multiViewport
         VK_FALSE, // samplerAnisotropy
-        VK_FALSE, // textureCompressionETC2
-        VK_FALSE, // textureCompressionASTC_LDR
-        VK_FALSE, // textureCompressionBC
+        VK_TRUE, // textureCompressionETC2
+        VK_TRUE, // textureCompressionASTC_LDR
+        VK_TRUE, // textureCompressionBC
         VK_FALSE, // occlusionQueryPrecise
         VK_FALSE, // pipelineStatisticsQuery
         VK_FALSE, // vertexPipelineStoresAndAtomics
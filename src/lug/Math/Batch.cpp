@@ -0,0 +1,288 @@
+#include <lug/Math/Batch.hpp>
+
+#include <algorithm>
+#include <atomic>
+
+#include <lug/Math/Batch/Kernels.hpp>
+
+#if defined(LUG_COMPILER_MSVC) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #include <immintrin.h>
+#endif
+
+namespace lug {
+namespace Math {
+namespace Batch {
+
+// The kernels read the matrices and the planes as arrays of floats
+static_assert(sizeof(Mat4x4f) == 16 * sizeof(float), "Mat4x4f must be an array of 16 floats");
+static_assert(sizeof(Vec4f) == 4 * sizeof(float), "Vec4f must be an array of 4 floats");
+
+namespace {
+
+bool isAvx2Supported() {
+#if defined(LUG_COMPILER_MSVC) && (defined(_M_X64) || defined(_M_IX86))
+    int info[4];
+
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+
+    // FMA, F16C and the support of the AVX registers by the OS
+    __cpuid(info, 1);
+    if (!(info[2] & (1 << 12)) || !(info[2] & (1 << 29)) || !(info[2] & (1 << 27)) || (_xgetbv(0) & 6) != 6) {
+        return false;
+    }
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#elif (defined(LUG_COMPILER_GCC) || defined(LUG_COMPILER_CLANG)) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") && __builtin_cpu_supports("f16c");
+#else
+    return false;
+#endif
+}
+
+const priv::Kernels* getKernels(InstructionSet instructionSet) {
+    switch (instructionSet) {
+        case InstructionSet::Scalar:
+            return priv::getScalarKernels();
+        case InstructionSet::SSE2:
+            return priv::getSse2Kernels();
+        case InstructionSet::AVX2:
+            return isAvx2Supported() ? priv::getAvx2Kernels() : nullptr;
+        case InstructionSet::NEON:
+            return priv::getNeonKernels();
+    }
+
+    return nullptr;
+}
+
+InstructionSet selectInstructionSet() {
+    for (InstructionSet instructionSet : {InstructionSet::AVX2, InstructionSet::SSE2, InstructionSet::NEON}) {
+        if (getKernels(instructionSet)) {
+            return instructionSet;
+        }
+    }
+
+    return InstructionSet::Scalar;
+}
+
+struct Selection {
+    std::atomic<InstructionSet> instructionSet;
+    std::atomic<const priv::Kernels*> kernels;
+};
+
+Selection& getSelection() {
+    static const InstructionSet best = selectInstructionSet();
+    static Selection selection{{best}, {getKernels(best)}};
+    return selection;
+}
+
+const priv::Kernels& getKernels() {
+    return *getSelection().kernels.load(std::memory_order_relaxed);
+}
+
+} // anonymous
+
+InstructionSet getInstructionSet() {
+    return getSelection().instructionSet.load(std::memory_order_relaxed);
+}
+
+bool setInstructionSet(InstructionSet instructionSet) {
+    const priv::Kernels* kernels = getKernels(instructionSet);
+
+    if (!kernels) {
+        return false;
+    }
+
+    getSelection().kernels.store(kernels, std::memory_order_relaxed);
+    getSelection().instructionSet.store(instructionSet, std::memory_order_relaxed);
+
+    return true;
+}
+
+void transformPoints(const Mat4x4f& matrix, ConstVec3Stream in, Vec3Stream out, size_t count) {
+    const float* const inArrays[3] = {in.x, in.y, in.z};
+    float* const outArrays[3] = {out.x, out.y, out.z};
+
+    getKernels().transformPoints(matrix.getValues().data().data(), inArrays, outArrays, count);
+}
+
+void transformNormals(const Mat4x4f& matrix, ConstVec3Stream in, Vec3Stream out, size_t count) {
+    // The inverse transpose is the cofactor matrix divided by the determinant, the kernel
+    // normalizes the result so only the sign of the determinant is needed
+    const float cofactors[3][3] = {
+        {
+            matrix(1, 1) * matrix(2, 2) - matrix(1, 2) * matrix(2, 1),
+            matrix(1, 2) * matrix(2, 0) - matrix(1, 0) * matrix(2, 2),
+            matrix(1, 0) * matrix(2, 1) - matrix(1, 1) * matrix(2, 0)
+        },
+        {
+            matrix(0, 2) * matrix(2, 1) - matrix(0, 1) * matrix(2, 2),
+            matrix(0, 0) * matrix(2, 2) - matrix(0, 2) * matrix(2, 0),
+            matrix(0, 1) * matrix(2, 0) - matrix(0, 0) * matrix(2, 1)
+        },
+        {
+            matrix(0, 1) * matrix(1, 2) - matrix(0, 2) * matrix(1, 1),
+            matrix(0, 2) * matrix(1, 0) - matrix(0, 0) * matrix(1, 2),
+            matrix(0, 0) * matrix(1, 1) - matrix(0, 1) * matrix(1, 0)
+        }
+    };
+
+    const float det = matrix(0, 0) * cofactors[0][0] + matrix(0, 1) * cofactors[0][1] + matrix(0, 2) * cofactors[0][2];
+    const float sign = det < 0.0f ? -1.0f : 1.0f;
+
+    float normalMatrix[9];
+    for (uint8_t row = 0; row < 3; ++row) {
+        for (uint8_t col = 0; col < 3; ++col) {
+            normalMatrix[col * 3 + row] = cofactors[row][col] * sign;
+        }
+    }
+
+    const float* const inArrays[3] = {in.x, in.y, in.z};
+    float* const outArrays[3] = {out.x, out.y, out.z};
+
+    getKernels().transformNormals(normalMatrix, inArrays, outArrays, count);
+}
+
+void composeTransforms(ConstVec3Stream translations, ConstQuatStream rotations, ConstVec3Stream scales, Mat4x4f* out, size_t count) {
+    const float* const translationsArrays[3] = {translations.x, translations.y, translations.z};
+    const float* const rotationsArrays[4] = {rotations.w, rotations.x, rotations.y, rotations.z};
+    const float* const scalesArrays[3] = {scales.x, scales.y, scales.z};
+
+    getKernels().composeTransforms(translationsArrays, rotationsArrays, scalesArrays, reinterpret_cast<float*>(out), count);
+}
+
+void multiply(const Mat4x4f* lhs, const Mat4x4f* rhs, Mat4x4f* out, size_t count) {
+    // The product of two matrices is already vectorized, see Simd
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = lhs[i] * rhs[i];
+    }
+}
+
+void multiply(const Mat4x4f& lhs, const Mat4x4f* rhs, Mat4x4f* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = lhs * rhs[i];
+    }
+}
+
+void transformAabbs(const Mat4x4f& matrix, ConstVec3Stream mins, ConstVec3Stream maxs, Vec3Stream outMins, Vec3Stream outMaxs, size_t count) {
+    const float* const minsArrays[3] = {mins.x, mins.y, mins.z};
+    const float* const maxsArrays[3] = {maxs.x, maxs.y, maxs.z};
+    float* const outMinsArrays[3] = {outMins.x, outMins.y, outMins.z};
+    float* const outMaxsArrays[3] = {outMaxs.x, outMaxs.y, outMaxs.z};
+
+    getKernels().transformAabbs(matrix.getValues().data().data(), minsArrays, maxsArrays, outMinsArrays, outMaxsArrays, count);
+}
+
+void cullSpheres(const Vec4f* planes, size_t planesCount, ConstVec3Stream centers, const float* radii, uint32_t* visibility, size_t count) {
+    const float* const centersArrays[3] = {centers.x, centers.y, centers.z};
+
+    std::fill(visibility, visibility + getMaskSize(count), 0);
+    getKernels().cullSpheres(reinterpret_cast<const float*>(planes), planesCount, centersArrays, radii, visibility, count);
+}
+
+void cullAabbs(const Vec4f* planes, size_t planesCount, ConstVec3Stream mins, ConstVec3Stream maxs, uint32_t* visibility, size_t count) {
+    const float* const minsArrays[3] = {mins.x, mins.y, mins.z};
+    const float* const maxsArrays[3] = {maxs.x, maxs.y, maxs.z};
+
+    std::fill(visibility, visibility + getMaskSize(count), 0);
+    getKernels().cullAabbs(reinterpret_cast<const float*>(planes), planesCount, minsArrays, maxsArrays, visibility, count);
+}
+
+void intersectSpheres(const Geometry::Spheref& sphere, ConstVec3Stream centers, const float* radii, uint32_t* hits, size_t count) {
+    const float center[3] = {sphere.center.x(), sphere.center.y(), sphere.center.z()};
+    const float* const centersArrays[3] = {centers.x, centers.y, centers.z};
+
+    std::fill(hits, hits + getMaskSize(count), 0);
+    getKernels().intersectSpheres(center, sphere.radius, centersArrays, radii, hits, count);
+}
+
+void intersectRayAabbs(const Geometry::Rayf& ray, ConstVec3Stream mins, ConstVec3Stream maxs, float* distances, uint32_t* hits, size_t count) {
+    const float origin[3] = {ray.origin.x(), ray.origin.y(), ray.origin.z()};
+    const float inverseDirection[3] = {1.0f / ray.direction.x(), 1.0f / ray.direction.y(), 1.0f / ray.direction.z()};
+    const float* const minsArrays[3] = {mins.x, mins.y, mins.z};
+    const float* const maxsArrays[3] = {maxs.x, maxs.y, maxs.z};
+
+    std::fill(hits, hits + getMaskSize(count), 0);
+    getKernels().intersectRayAabbs(origin, inverseDirection, minsArrays, maxsArrays, distances, hits, count);
+}
+
+void intersectRayTriangles(const Geometry::Rayf& ray, ConstVec3Stream v0, ConstVec3Stream v1, ConstVec3Stream v2, float* distances, uint32_t* hits, size_t count) {
+    const float origin[3] = {ray.origin.x(), ray.origin.y(), ray.origin.z()};
+    const float direction[3] = {ray.direction.x(), ray.direction.y(), ray.direction.z()};
+    const float* const v0Arrays[3] = {v0.x, v0.y, v0.z};
+    const float* const v1Arrays[3] = {v1.x, v1.y, v1.z};
+    const float* const v2Arrays[3] = {v2.x, v2.y, v2.z};
+
+    std::fill(hits, hits + getMaskSize(count), 0);
+    getKernels().intersectRayTriangles(origin, direction, v0Arrays, v1Arrays, v2Arrays, distances, hits, count);
+}
+
+void packHalf(const float* in, uint16_t* out, size_t count) {
+    getKernels().packHalf(in, out, count);
+}
+
+void unpackHalf(const uint16_t* in, float* out, size_t count) {
+    getKernels().unpackHalf(in, out, count);
+}
+
+void packSnorm8(const float* in, int8_t* out, size_t count) {
+    getKernels().packSnorm8(in, out, count);
+}
+
+void packUnorm8(const float* in, uint8_t* out, size_t count) {
+    getKernels().packUnorm8(in, out, count);
+}
+
+void packSnorm16(const float* in, int16_t* out, size_t count) {
+    getKernels().packSnorm16(in, out, count);
+}
+
+void packUnorm16(const float* in, uint16_t* out, size_t count) {
+    getKernels().packUnorm16(in, out, count);
+}
+
+void encodeOctahedral(ConstVec3Stream normals, int16_t* out, size_t count) {
+    const float* const normalsArrays[3] = {normals.x, normals.y, normals.z};
+
+    getKernels().encodeOctahedral(normalsArrays, out, count);
+}
+
+void encodeQTangent(ConstVec3Stream normals, ConstVec3Stream tangents, const float* handedness, int16_t* out, size_t count) {
+    const float* const normalsArrays[3] = {normals.x, normals.y, normals.z};
+    const float* const tangentsArrays[3] = {tangents.x, tangents.y, tangents.z};
+
+    getKernels().encodeQTangent(normalsArrays, tangentsArrays, handedness, out, count);
+}
+
+void lerp(ConstVec3Stream lhs, ConstVec3Stream rhs, const float* factors, Vec3Stream out, size_t count) {
+    const float* const lhsArrays[3] = {lhs.x, lhs.y, lhs.z};
+    const float* const rhsArrays[3] = {rhs.x, rhs.y, rhs.z};
+    float* const outArrays[3] = {out.x, out.y, out.z};
+
+    getKernels().lerp(lhsArrays, rhsArrays, factors, outArrays, count);
+}
+
+void nlerp(ConstQuatStream lhs, ConstQuatStream rhs, const float* factors, QuatStream out, size_t count) {
+    const float* const lhsArrays[4] = {lhs.w, lhs.x, lhs.y, lhs.z};
+    const float* const rhsArrays[4] = {rhs.w, rhs.x, rhs.y, rhs.z};
+    float* const outArrays[4] = {out.w, out.x, out.y, out.z};
+
+    getKernels().nlerp(lhsArrays, rhsArrays, factors, outArrays, count);
+}
+
+void slerp(ConstQuatStream lhs, ConstQuatStream rhs, const float* factors, QuatStream out, size_t count) {
+    const float* const lhsArrays[4] = {lhs.w, lhs.x, lhs.y, lhs.z};
+    const float* const rhsArrays[4] = {rhs.w, rhs.x, rhs.y, rhs.z};
+    float* const outArrays[4] = {out.w, out.x, out.y, out.z};
+
+    getKernels().slerp(lhsArrays, rhsArrays, factors, outArrays, count);
+}
+
+} // Batch
+} // Math
+} // lug
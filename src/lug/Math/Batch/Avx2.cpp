@@ -0,0 +1,88 @@
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include <lug/Math/Batch/Kernels.hpp>
+
+// This file is compiled with the AVX2, FMA and F16C instructions enabled, see the CMakeLists.txt.
+// The kernels are only called when the CPU supports them, so this file must not include
+// the headers of the library, whose inline functions could be shared with the other files.
+#if defined(__AVX2__) && !defined(LUG_MATH_NO_SIMD)
+    #define LUG_MATH_BATCH_AVX2
+    #include <immintrin.h>
+#endif
+
+namespace lug {
+namespace Math {
+namespace Batch {
+namespace priv {
+
+#if defined(LUG_MATH_BATCH_AVX2)
+
+namespace {
+
+#include <lug/Math/Batch/Kernels.inl>
+
+struct Avx2Pack {
+    using Type = __m256;
+    static constexpr size_t width = 8;
+
+    static __m256 set(float value) { return _mm256_set1_ps(value); }
+    static __m256 load(const float* values) { return _mm256_loadu_ps(values); }
+    static void store(float* values, __m256 value) { _mm256_storeu_ps(values, value); }
+
+    static __m256 add(__m256 lhs, __m256 rhs) { return _mm256_add_ps(lhs, rhs); }
+    static __m256 sub(__m256 lhs, __m256 rhs) { return _mm256_sub_ps(lhs, rhs); }
+    static __m256 mul(__m256 lhs, __m256 rhs) { return _mm256_mul_ps(lhs, rhs); }
+    static __m256 multiplyAdd(__m256 a, __m256 b, __m256 c) { return _mm256_fmadd_ps(a, b, c); }
+    static __m256 min(__m256 lhs, __m256 rhs) { return _mm256_min_ps(lhs, rhs); }
+    static __m256 max(__m256 lhs, __m256 rhs) { return _mm256_max_ps(lhs, rhs); }
+    static __m256 abs(__m256 value) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), value); }
+    static __m256 reciprocal(__m256 value) { return _mm256_div_ps(_mm256_set1_ps(1.0f), value); }
+    static __m256 inverseSqrt(__m256 value) { return _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(value)); }
+
+    static uint32_t greaterEqual(__m256 lhs, __m256 rhs) {
+        return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(lhs, rhs, _CMP_GE_OQ)));
+    }
+
+    static __m256 copySign(__m256 magnitude, __m256 sign) {
+        const __m256 mask = _mm256_set1_ps(-0.0f);
+        return _mm256_or_ps(_mm256_andnot_ps(mask, magnitude), _mm256_and_ps(mask, sign));
+    }
+
+    static __m256 select(__m256 condition, __m256 ifNegative, __m256 otherwise) {
+        return _mm256_blendv_ps(otherwise, ifNegative, condition);
+    }
+
+    static void storeInt32(int32_t* values, __m256 value) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(values), _mm256_cvtps_epi32(value));
+    }
+
+    static void storeHalf(uint16_t* values, __m256 value) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(values), _mm256_cvtps_ph(value, _MM_FROUND_TO_NEAREST_INT));
+    }
+
+    static __m256 loadHalf(const uint16_t* values) {
+        return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values)));
+    }
+};
+
+} // anonymous
+
+const Kernels* getAvx2Kernels() {
+    static const Kernels kernels = makeKernels<Avx2Pack>();
+    return &kernels;
+}
+
+#else
+
+const Kernels* getAvx2Kernels() {
+    return nullptr;
+}
+
+#endif
+
+} // priv
+} // Batch
+} // Math
+} // lug
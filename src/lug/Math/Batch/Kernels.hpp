@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace lug {
+namespace Math {
+namespace Batch {
+namespace priv {
+
+/**
+ * @brief      Kernels of one instruction set.
+ *
+ *             They only take raw arrays: the translation units of the instruction sets are compiled
+ *             with their own flags and must not instantiate any template shared with the others.
+ *             The matrices are column-major, the streams are arrays of components, e.g. {x, y, z}.
+ */
+struct Kernels {
+    void (*transformPoints)(const float* matrix, const float* const* in, float* const* out, size_t count);
+    void (*transformNormals)(const float* normalMatrix, const float* const* in, float* const* out, size_t count);
+    void (*composeTransforms)(const float* const* translations, const float* const* rotations, const float* const* scales, float* out, size_t count);
+    void (*transformAabbs)(const float* matrix, const float* const* mins, const float* const* maxs, float* const* outMins, float* const* outMaxs, size_t count);
+    void (*cullSpheres)(const float* planes, size_t planesCount, const float* const* centers, const float* radii, uint32_t* visibility, size_t count);
+    void (*cullAabbs)(const float* planes, size_t planesCount, const float* const* mins, const float* const* maxs, uint32_t* visibility, size_t count);
+    void (*intersectSpheres)(const float* center, float radius, const float* const* centers, const float* radii, uint32_t* hits, size_t count);
+    void (*intersectRayAabbs)(const float* origin, const float* inverseDirection, const float* const* mins, const float* const* maxs, float* distances, uint32_t* hits, size_t count);
+    void (*intersectRayTriangles)(const float* origin, const float* direction, const float* const* v0, const float* const* v1, const float* const* v2,
+                                  float* distances, uint32_t* hits, size_t count);
+    void (*packHalf)(const float* in, uint16_t* out, size_t count);
+    void (*unpackHalf)(const uint16_t* in, float* out, size_t count);
+    void (*packSnorm8)(const float* in, int8_t* out, size_t count);
+    void (*packUnorm8)(const float* in, uint8_t* out, size_t count);
+    void (*packSnorm16)(const float* in, int16_t* out, size_t count);
+    void (*packUnorm16)(const float* in, uint16_t* out, size_t count);
+    void (*encodeOctahedral)(const float* const* normals, int16_t* out, size_t count);
+    void (*encodeQTangent)(const float* const* normals, const float* const* tangents, const float* handedness, int16_t* out, size_t count);
+    void (*lerp)(const float* const* lhs, const float* const* rhs, const float* factors, float* const* out, size_t count);
+    void (*nlerp)(const float* const* lhs, const float* const* rhs, const float* factors, float* const* out, size_t count);
+    void (*slerp)(const float* const* lhs, const float* const* rhs, const float* factors, float* const* out, size_t count);
+};
+
+// The kernels not compiled in this build are nullptr
+const Kernels* getScalarKernels();
+const Kernels* getSse2Kernels();
+const Kernels* getAvx2Kernels();
+const Kernels* getNeonKernels();
+
+} // priv
+} // Batch
+} // Math
+} // lug
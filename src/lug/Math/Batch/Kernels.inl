@@ -0,0 +1,680 @@
+// Implementation of the kernels, included by the translation unit of each instruction set
+// in an anonymous namespace, with the pack of the instruction set providing:
+//     Type, width, set, load, store, add, sub, mul, multiplyAdd, min, max, abs, reciprocal, inverseSqrt,
+//     greaterEqual, which returns the bits of the lanes where lhs >= rhs,
+//     copySign, select, which picks ifNegative in the lanes where the sign bit of condition is set,
+//     storeInt32, which rounds to nearest, and storeHalf and loadHalf.
+
+// Same as Packing::packHalf and Packing::unpackHalf, which can't be included here, see Avx2.cpp
+inline uint16_t floatToHalf(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const uint32_t sign = bits & 0x80000000u;
+    bits ^= sign;
+
+    uint32_t result;
+    if (bits >= (127u + 16u) << 23) {
+        result = bits > 0x7f800000u ? 0x7e00 : 0x7c00;
+    } else if (bits < (127u - 14u) << 23) {
+        float aligned;
+        std::memcpy(&aligned, &bits, sizeof(aligned));
+        aligned += 0.5f;
+
+        std::memcpy(&result, &aligned, sizeof(result));
+        result -= 0x3f000000u;
+    } else {
+        result = (bits - ((127u - 15u) << 23) + 0xfff + ((bits >> 13) & 1)) >> 13;
+    }
+
+    return static_cast<uint16_t>(result | (sign >> 16));
+}
+
+inline float halfToFloat(uint16_t value) {
+    uint32_t bits = static_cast<uint32_t>(value & 0x7fff) << 13;
+    const uint32_t exponent = bits & (0x7c00u << 13);
+
+    bits += (127u - 15u) << 23;
+
+    float result;
+    if (exponent == 0x7c00u << 13) {
+        bits += (128u - 16u) << 23;
+    } else if (exponent == 0) {
+        bits += 1u << 23;
+        std::memcpy(&result, &bits, sizeof(result));
+        result -= 6.103515625e-05f;
+        std::memcpy(&bits, &result, sizeof(bits));
+    }
+
+    bits |= static_cast<uint32_t>(value & 0x8000) << 16;
+    std::memcpy(&result, &bits, sizeof(result));
+
+    return result;
+}
+
+struct ScalarPack {
+    using Type = float;
+    static constexpr size_t width = 1;
+
+    static float set(float value) { return value; }
+    static float load(const float* values) { return *values; }
+    static void store(float* values, float value) { *values = value; }
+
+    static float add(float lhs, float rhs) { return lhs + rhs; }
+    static float sub(float lhs, float rhs) { return lhs - rhs; }
+    static float mul(float lhs, float rhs) { return lhs * rhs; }
+    static float multiplyAdd(float a, float b, float c) { return a * b + c; }
+    static float min(float lhs, float rhs) { return lhs < rhs ? lhs : rhs; }
+    static float max(float lhs, float rhs) { return lhs > rhs ? lhs : rhs; }
+    static float abs(float value) { return value < 0.0f ? -value : value; }
+    static float reciprocal(float value) { return 1.0f / value; }
+    static float inverseSqrt(float value) { return 1.0f / std::sqrt(value); }
+
+    static uint32_t greaterEqual(float lhs, float rhs) { return lhs >= rhs ? 1 : 0; }
+
+    static float copySign(float magnitude, float sign) { return std::copysign(magnitude, sign); }
+    static float select(float condition, float ifNegative, float otherwise) { return std::signbit(condition) ? ifNegative : otherwise; }
+
+    static void storeInt32(int32_t* values, float value) { *values = static_cast<int32_t>(std::nearbyint(value)); }
+    static void storeHalf(uint16_t* values, float value) { *values = floatToHalf(value); }
+    static float loadHalf(const uint16_t* values) { return halfToFloat(*values); }
+};
+
+/**
+ * @brief      Calls @p function with a Pack for the full packs of elements, then with a ScalarPack for the remaining ones.
+ */
+template <typename Pack, typename Function>
+inline void forEach(size_t count, Function function) {
+    size_t i = 0;
+
+    for (; i + Pack::width <= count; i += Pack::width) {
+        function(Pack{}, i);
+    }
+
+    for (; i < count; ++i) {
+        function(ScalarPack{}, i);
+    }
+}
+
+template <typename Pack>
+struct Implementation {
+    static void transformPoints(const float* matrix, const float* const* in, float* const* out, size_t count) {
+        forEach<Pack>(count, [&](auto pack, size_t i) {
+            using P = decltype(pack);
+
+            const typename P::Type x = P::load(in[0] + i);
+            const typename P::Type y = P::load(in[1] + i);
+            const typename P::Type z = P::load(in[2] + i);
+
+            for (uint8_t row = 0; row < 3; ++row) {
+                typename P::Type result = P::multiplyAdd(P::set(matrix[8 + row]), z, P::set(matrix[12 + row]));
+                result = P::multiplyAdd(P::set(matrix[4 + row]), y, result);
+                result = P::multiplyAdd(P::set(matrix[row]), x, result);
+
+                P::store(out[row] + i, result);
+            }
+        });
+    }
+
+    static void transformNormals(const float* normalMatrix, const float* const* in, float* const* out, size_t count) {
+        forEach<Pack>(count, [&](auto pack, size_t i) {
+            using P = decltype(pack);
+
+            const typename P::Type x = P::load(in[0] + i);
+            const typename P::Type y = P::load(in[1] + i);
+            const typename P::Type z = P::load(in[2] + i);
+
+            typename P::Type result[3];
+            for (uint8_t row = 0; row < 3; ++row) {
+                result[row] = P::mul(P::set(normalMatrix[6 + row]), z);
+                result[row] = P::multiplyAdd(P::set(normalMatrix[3 + row]), y, result[row]);
+                result[row] = P::multiplyAdd(P::set(normalMatrix[row]), x, result[row]);
+            }
+
+            typename P::Type squaredLength = P::mul(result[0], result[0]);
+            squaredLength = P::multiplyAdd(result[1], result[1], squaredLength);
+            squaredLength = P::multiplyAdd(result[2], result[2], squaredLength);
+
+            // Null normals stay null
+            const typename P::Type factor = P::inverseSqrt(P::max(squaredLength, P::set(1e-30f)));
+
+            for (uint8_t row = 0; row < 3; ++row) {
+                P::store(out[row] + i, P::mul(result[row], factor));
+            }
+        });
+    }
+
+    static void composeTransforms(const float* const* translations, const float* const* rotations, const float* const* scales, float* out, size_t count) {
+        forEach<Pack>(count, [&](auto pack, size_t i) {
+            using P = decltype(pack);
+
+            const typename P::Type w = P::load(rotations[0] + i);
+            const typename P::Type x = P::load(rotations[1] + i);
+            const typename P::Type y = P::load(rotations[2] + i);
+            const typename P::Type z = P::load(rotations[3] + i);
+
+            const typename P::Type two = P::set(2.0f);
+            const typename P::Type one = P::set(1.0f);
+            const typename P::Type zero = P::set(0.0f);
+
+            const typename P::Type xx = P::mul(x, x);
+            const typename P::Type xy = P::mul(x, y);
+            const typename P::Type xz = P::mul(x, z);
+            const typename P::Type wx = P::mul(w, x);
+
+            const typename P::Type yy = P::mul(y, y);
+            const typename P::Type yz = P::mul(y, z);
+            const typename P::Type wy = P::mul(w, y);
+
+            const typename P::Type zz = P::mul(z, z);
+            const typename P::Type wz = P::mul(w, z);
+
+            const typename P::Type scaleX = P::load(scales[0] + i);
+            const typename P::Type scaleY = P::load(scales[1] + i);
+            const typename P::Type scaleZ = P::load(scales[2] + i);
+
+            // Same as Quaternion::transform, with the columns multiplied by the scale
+            const typename P::Type values[16] = {
+                P::mul(P::sub(one, P::mul(two, P::add(yy, zz))), scaleX),
+                P::mul(P::mul(two, P::add(xy, wz)), scaleX),
+                P::mul(P::mul(two, P::sub(xz, wy)), scaleX),
+                zero,
+
+                P::mul(P::mul(two, P::sub(xy, wz)), scaleY),
+                P::mul(P::sub(one, P::mul(two, P::add(xx, zz))), scaleY),
+                P::mul(P::mul(two, P::add(yz, wx)), scaleY),
+                zero,
+
+                P::mul(P::mul(two, P::add(xz, wy)), scaleZ),
+                P::mul(P::mul(two, P::sub(yz, wx)), scaleZ),
+                P::mul(P::sub(one, P::mul(two, P::add(xx, yy))), scaleZ),
+                zero,
+
+                P::load(translations[0] + i),
+                P::load(translations[1] + i),
+                P::load(translations[2] + i),
+                one
+            };
+
+            // Transpose the packs to the matrices
+            float lanes[16][P::width];
+            for (uint8_t value = 0; value < 16; ++value) {
+                P::store(lanes[value], values[value]);
+            }
+
+            for (size_t lane = 0; lane < P::width; ++lane) {
+                float* matrix = out + (i + lane) * 16;
+
+                for (uint8_t value = 0; value < 16; ++value) {
+                    matrix[value] = lanes[value][lane];
+                }
+            }
+        });
+    }
+
+    static void transformAabbs(const float* matrix, const float* const* mins, const float* const* maxs, float* const* outMins, float* const* outMaxs, size_t count) {
+        forEach<Pack>(count, [&](auto pack, size_t i) {
+            using P = decltype(pack);
+
+            const typename P::Type half = P::set(0.5f);
+
+            typename P::Type center[3];
+            typename P::Type extent[3];
+            for (uint8_t axis = 0; axis < 3; ++axis) {
+                const typename P::Type min = P::load(mins[axis] + i);
+                const typename P::Type max = P::load(maxs[axis] + i);
+
+                center[axis] = P::mul(P::add(min, max), half);
+                extent[axis] = P::mul(P::sub(max, min), half);
+            }
+
+            // The extent of the transformed box is the extent multiplied by the absolute values of the matrix
+            typename P::Type newCenter[3];
+            typename P::Type newExtent[3];
+            for (uint8_t row = 0; row < 3; ++row) {
+                newCenter[row] = P::set(matrix[12 + row]);
+                newExtent[row] = P::set(0.0f);
+
+                for (uint8_t col = 0; col < 3; ++col) {
+                    newCenter[row] = P::multiplyAdd(P::set(matrix[col * 4 + row]), center[col], newCenter[row]);
+                    newExtent[row] = P::multiplyAdd(P::set(ScalarPack::abs(matrix[col * 4 + row])), extent[col], newExtent[row]);
+                }
+            }
+
+            for (uint8_t row = 0; row < 3; ++row) {
+                P::store(outMins[row] + i, P::sub(newCenter[row], newExtent[row]));
+                P::store(outMaxs[row] + i, P::add(newCenter[row], newExtent[row]));
+            }
+        });
+    }
+
+    static void cullSpheres(const float* planes, size_t planesCount, const float* const* centers, const float* radii, uint32_t* visibility, size_t count) {
+        forEach<Pack>(count, [&](auto pack, size_t i) {
+            using P = decltype(pack);
+
+            const typename P::Type x = P::load(centers[0] + i);
+            const typename P::Type y = P::load(centers[1] + i);
+            const typename P::Type z = P::load(centers[2] + i);
+            const typename P::Type minDistance = P::sub(P::set(0.0f), P::load(radii + i));
+
+            uint32_t bits = (1u << P::width) - 1;
+            for (size_t idx = 0; idx < planesCount && bits; ++idx) {
+                const float* plane = planes + idx * 4;
+
+                typename P::Type distance = P::multiplyAdd(P::set(plane[2]), z, P::set(plane[3]));
+                distance = P::multiplyAdd(P::set(plane[1]), y, distance);
+                distance = P::multiplyAdd(P::set(plane[0]), x, distance);
+
+                bits &= P::greaterEqual(distance, minDistance);
+            }
+
+            visibility[i / 32] |= bits << (i % 32);
+        });
+    }
+
+    static void cullAabbs(const float* planes, size_t planesCount, const float* const* mins, const float* const* maxs, uint32_t* visibility, size_t count) {
+        forEach<Pack>(count, [&](auto pack, size_t i) {
+            using P = decltype(pack);
+
+            const typename P::Type zero = P::set(0.0f);
+
+            uint32_t bits = (1u << P::width) - 1;
+            for (size_t idx = 0; idx < planesCount && bits; ++idx) {
+                const float* plane = planes + idx * 4;
+
+                // The corner of the box the furthest along the normal
+                typename P::Type distance = P::set(plane[3]);
+                for (uint8_t axis = 0; axis < 3; ++axis) {
+                    const float* corner = plane[axis] >= 0.0f ? maxs[axis] : mins[axis];
+                    distance = P::multiplyAdd(P::set(plane[axis]), P::load(corner + i), distance);
+                }
+
+                bits &= P::greaterEqual(distance, zero);
+            }
+
+            visibility[i / 32] |= bits << (i % 32);
+        });
+    }
+
+    static void intersectSpheres(const float* center, float radius, const float* const* centers, const float* radii, uint32_t* hits, size_t count) {
+        forEach<Pack>(count, [&](auto pack, size_t i) {
+            using P = decltype(pack);
+
+            const typename P::Type x = P::sub(P::load(centers[0] + i), P::set(center[0]));
+            const typename P::Type y = P::sub(P::load(centers[1] + i), P::set(center[1]));
+            const typename P::Type z = P::sub(P::load(centers[2] + i), P::set(center[2]));
+            const typename P::Type radiiSum = P::add(P::load(radii + i), P::set(radius));
+
+            typename P::Type squaredDistance = P::mul(x, x);
+            squaredDistance = P::multiplyAdd(y, y, squaredDistance);
+            squaredDistance = P::multiplyAdd(z, z, squaredDistance);
+
+            hits[i / 32] |= P::greaterEqual(P::mul(radiiSum, radiiSum), squaredDistance) << (i % 32);
+        });
+    }
+
+    static void intersectRayAabbs(const float* origin, const float* inverseDirection, const float* const* mins, const float* const* maxs, float* distances, uint32_t* hits, size_t count) {
+        forEach<Pack>(count, [&](auto pack, size_t i) {
+            using P = decltype(pack);
+
+            // Slab test, the infinite inverses of the null components give infinite distances
+            typename P::Type near = P::set(0.0f);
+            typename P::Type far = P::set(std::numeric_limits<float>::infinity());
+
+            for (uint8_t axis = 0; axis < 3; ++axis) {
+                const typename P::Type t1 = P::mul(P::sub(P::load(mins[axis] + i), P::set(origin[axis])), P::set(inverseDirection[axis]));
+                const typename P::Type t2 = P::mul(P::sub(P::load(maxs[axis] + i), P::set(origin[axis])), P::set(inverseDirection[axis]));
+
+                near = P::max(near, P::min(t1, t2));
+                far = P::min(far, P::max(t1, t2));
+            }
+
+            P::store(distances + i, near);
+            hits[i / 32] |= P::greaterEqual(far, near) << (i % 32);
+        });
+    }
+
+    static void intersectRayTriangles(const float* origin, const float* direction, const float* const* v0, const float* const* v1, const float* const* v2,
+                                      float* distances, uint32_t* hits, size_t count) {
+        forEach<Pack>(count, [&](auto pack, size_t i) {
+            using P = decltype(pack);
+
+            typename P::Type edge1[3];
+            typename P::Type edge2[3];
+            typename P::Type s[3];
+            for (uint8_t axis = 0; axis < 3; ++axis) {
+                const typename P::Type vertex = P::load(v0[axis] + i);
+
+                edge1[axis] = P::sub(P::load(v1[axis] + i), vertex);
+                edge2[axis] = P::sub(P::load(v2[axis] + i), vertex);
+                s[axis] = P::sub(P::set(origin[axis]), vertex);
+            }
+
+            const typename P::Type d[3] = {P::set(direction[0]), P::set(direction[1]), P::set(direction[2])};
+
+            // Moller-Trumbore, see Geometry::intersects
+            const typename P::Type p[3] = {
+                P::sub(P::mul(d[1], edge2[2]), P::mul(d[2], edge2[1])),
+                P::sub(P::mul(d[2], edge2[0]), P::mul(d[0], edge2[2])),
+                P::sub(P::mul(d[0], edge2[1]), P::mul(d[1], edge2[0]))
+            };
+
+            const typename P::Type q[3] = {
+                P::sub(P::mul(s[1], edge1[2]), P::mul(s[2], edge1[1])),
+                P::sub(P::mul(s[2], edge1[0]), P::mul(s[0], edge1[2])),
+                P::sub(P::mul(s[0], edge1[1]), P::mul(s[1], edge1[0]))
+            };
+
+            const typename P::Type det = P::multiplyAdd(edge1[2], p[2], P::multiplyAdd(edge1[1], p[1], P::mul(edge1[0], p[0])));
+            const typename P::Type inverseDet = P::reciprocal(det);
+
+            const typename P::Type u = P::mul(P::multiplyAdd(s[2], p[2], P::multiplyAdd(s[1], p[1], P::mul(s[0], p[0]))), inverseDet);
+            const typename P::Type v = P::mul(P::multiplyAdd(d[2], q[2], P::multiplyAdd(d[1], q[1], P::mul(d[0], q[0]))), inverseDet);
+            const typename P::Type t = P::mul(P::multiplyAdd(edge2[2], q[2], P::multiplyAdd(edge2[1], q[1], P::mul(edge2[0], q[0]))), inverseDet);
+
+            const typename P::Type zero = P::set(0.0f);
+
+            // The rays parallel to the triangle are rejected by the determinant
+            const uint32_t bits = P::greaterEqual(P::abs(det), P::set(std::numeric_limits<float>::epsilon())) &
+                P::greaterEqual(u, zero) &
+                P::greaterEqual(v, zero) &
+                P::greaterEqual(P::set(1.0f), P::add(u, v)) &
+                P::greaterEqual(t, zero);
+
+            P::store(distances + i, t);
+            hits[i / 32] |= bits << (i % 32);
+        });
+    }
+
+    static void packHalf(const float* in, uint16_t* out, size_t count) {
+        forEach<Pack>(count, [&](auto pack, size_t i) {
+            using P = decltype(pack);
+
+            P::storeHalf(out + i, P::load(in + i));
+        });
+    }
+
+    static void unpackHalf(const uint16_t* in, float* out, size_t count) {
+        forEach<Pack>(count, [&](auto pack, size_t i) {
+            using P = decltype(pack);
+
+            P::store(out + i, P::loadHalf(in + i));
+        });
+    }
+
+    template <typename Integer>
+    static void quantize(const float* in, float min, float max, float scale, Integer* out, size_t count) {
+        forEach<Pack>(count, [&](auto pack, size_t i) {
+            using P = decltype(pack);
+
+            int32_t values[P::width];
+            P::storeInt32(values, P::mul(P::min(P::max(P::load(in + i), P::set(min)), P::set(max)), P::set(scale)));
+
+            for (size_t lane = 0; lane < P::width; ++lane) {
+                out[i + lane] = static_cast<Integer>(values[lane]);
+            }
+        });
+    }
+
+    static void packSnorm8(const float* in, int8_t* out, size_t count) {
+        quantize(in, -1.0f, 1.0f, 127.0f, out, count);
+    }
+
+    static void packUnorm8(const float* in, uint8_t* out, size_t count) {
+        quantize(in, 0.0f, 1.0f, 255.0f, out, count);
+    }
+
+    static void packSnorm16(const float* in, int16_t* out, size_t count) {
+        quantize(in, -1.0f, 1.0f, 32767.0f, out, count);
+    }
+
+    static void packUnorm16(const float* in, uint16_t* out, size_t count) {
+        quantize(in, 0.0f, 1.0f, 65535.0f, out, count);
+    }
+
+    static void encodeOctahedral(const float* const* normals, int16_t* out, size_t count) {
+        forEach<Pack>(count, [&](auto pack, size_t i) {
+            using P = decltype(pack);
+
+            const typename P::Type x = P::load(normals[0] + i);
+            const typename P::Type y = P::load(normals[1] + i);
+            const typename P::Type z = P::load(normals[2] + i);
+
+            const typename P::Type one = P::set(1.0f);
+            const typename P::Type factor = P::reciprocal(P::add(P::add(P::abs(x), P::abs(y)), P::abs(z)));
+
+            const typename P::Type octX = P::mul(x, factor);
+            const typename P::Type octY = P::mul(y, factor);
+
+            // The lower hemisphere is folded on the corners of the square, see Packing::encodeOctahedral
+            const typename P::Type values[2] = {
+                P::select(z, P::copySign(P::sub(one, P::abs(octY)), octX), octX),
+                P::select(z, P::copySign(P::sub(one, P::abs(octX)), octY), octY)
+            };
+
+            int32_t lanes[2][P::width];
+            for (uint8_t component = 0; component < 2; ++component) {
+                P::storeInt32(lanes[component], P::mul(P::min(P::max(values[component], P::set(-1.0f)), one), P::set(32767.0f)));
+            }
+
+            for (size_t lane = 0; lane < P::width; ++lane) {
+                out[(i + lane) * 2] = static_cast<int16_t>(lanes[0][lane]);
+                out[(i + lane) * 2 + 1] = static_cast<int16_t>(lanes[1][lane]);
+            }
+        });
+    }
+
+    static void encodeQTangent(const float* const* normals, const float* const* tangents, const float* handedness, int16_t* out, size_t count) {
+        forEach<Pack>(count, [&](auto pack, size_t i) {
+            using P = decltype(pack);
+
+            const typename P::Type zero = P::set(0.0f);
+            const typename P::Type one = P::set(1.0f);
+            const typename P::Type half = P::set(0.5f);
+            const typename P::Type tiny = P::set(1e-30f);
+
+            const typename P::Type n[3] = {P::load(normals[0] + i), P::load(normals[1] + i), P::load(normals[2] + i)};
+            typename P::Type t[3] = {P::load(tangents[0] + i), P::load(tangents[1] + i), P::load(tangents[2] + i)};
+
+            // Orthogonalize the tangent against the normal, see Packing::encodeQTangent
+            const typename P::Type projection = P::multiplyAdd(n[2], t[2], P::multiplyAdd(n[1], t[1], P::mul(n[0], t[0])));
+            for (uint8_t axis = 0; axis < 3; ++axis) {
+                t[axis] = P::sub(t[axis], P::mul(n[axis], projection));
+            }
+
+            const typename P::Type factor = P::inverseSqrt(P::max(P::multiplyAdd(t[2], t[2], P::multiplyAdd(t[1], t[1], P::mul(t[0], t[0]))), tiny));
+            for (uint8_t axis = 0; axis < 3; ++axis) {
+                t[axis] = P::mul(t[axis], factor);
+            }
+
+            const typename P::Type b[3] = {
+                P::sub(P::mul(n[1], t[2]), P::mul(n[2], t[1])),
+                P::sub(P::mul(n[2], t[0]), P::mul(n[0], t[2])),
+                P::sub(P::mul(n[0], t[1]), P::mul(n[1], t[0]))
+            };
+
+            // Quaternion::fromRotationMatrix of the columns {t, b, n}, the four cases are computed then selected
+            const typename P::Type trace = P::add(P::add(t[0], b[1]), n[2]);
+            const typename P::Type diagonals[4] = {
+                P::add(one, trace),
+                P::sub(P::add(one, t[0]), P::add(b[1], n[2])),
+                P::sub(P::add(one, b[1]), P::add(t[0], n[2])),
+                P::sub(P::add(one, n[2]), P::add(t[0], b[1]))
+            };
+
+            const typename P::Type wx = P::sub(b[2], n[1]);
+            const typename P::Type wy = P::sub(n[0], t[2]);
+            const typename P::Type wz = P::sub(t[1], b[0]);
+            const typename P::Type xy = P::add(b[0], t[1]);
+            const typename P::Type xz = P::add(n[0], t[2]);
+            const typename P::Type yz = P::add(n[1], b[2]);
+
+            typename P::Type cases[4][4] = {
+                {diagonals[0], wx, wy, wz},
+                {wx, diagonals[1], xy, xz},
+                {wy, xy, diagonals[2], yz},
+                {wz, xz, yz, diagonals[3]}
+            };
+
+            for (uint8_t idx = 0; idx < 4; ++idx) {
+                const typename P::Type inverse = P::mul(half, P::inverseSqrt(P::max(diagonals[idx], tiny)));
+
+                for (uint8_t component = 0; component < 4; ++component) {
+                    cases[idx][component] = P::mul(cases[idx][component], inverse);
+                }
+            }
+
+            const typename P::Type firstCase = P::sub(zero, trace);
+            const typename P::Type secondCase = P::min(P::sub(b[1], t[0]), P::sub(n[2], t[0]));
+            const typename P::Type thirdCase = P::sub(n[2], b[1]);
+
+            typename P::Type q[4];
+            for (uint8_t component = 0; component < 4; ++component) {
+                q[component] = P::select(firstCase, cases[0][component],
+                    P::select(secondCase, cases[1][component],
+                        P::select(thirdCase, cases[2][component], cases[3][component])));
+            }
+
+            // w is made positive and kept away from zero, then takes the sign of the handedness
+            const typename P::Type handednessSign = P::copySign(one, P::load(handedness + i));
+            const typename P::Type sign = P::mul(P::copySign(one, q[0]), handednessSign);
+
+            q[0] = P::mul(P::max(P::abs(q[0]), P::set(1.0f / 32767.0f)), handednessSign);
+            for (uint8_t component = 1; component < 4; ++component) {
+                q[component] = P::mul(q[component], sign);
+            }
+
+            int32_t lanes[4][P::width];
+            for (uint8_t component = 0; component < 4; ++component) {
+                P::storeInt32(lanes[component], P::mul(P::min(P::max(q[component], P::set(-1.0f)), one), P::set(32767.0f)));
+            }
+
+            // Stored as {x, y, z, w}
+            for (size_t lane = 0; lane < P::width; ++lane) {
+                int16_t* qTangent = out + (i + lane) * 4;
+
+                qTangent[0] = static_cast<int16_t>(lanes[1][lane]);
+                qTangent[1] = static_cast<int16_t>(lanes[2][lane]);
+                qTangent[2] = static_cast<int16_t>(lanes[3][lane]);
+                qTangent[3] = static_cast<int16_t>(lanes[0][lane]);
+            }
+        });
+    }
+
+    static void lerp(const float* const* lhs, const float* const* rhs, const float* factors, float* const* out, size_t count) {
+        forEach<Pack>(count, [&](auto pack, size_t i) {
+            using P = decltype(pack);
+
+            const typename P::Type t = P::load(factors + i);
+
+            for (uint8_t component = 0; component < 3; ++component) {
+                const typename P::Type a = P::load(lhs[component] + i);
+                const typename P::Type b = P::load(rhs[component] + i);
+
+                P::store(out[component] + i, P::multiplyAdd(P::sub(b, a), t, a));
+            }
+        });
+    }
+
+    // Interpolates the quaternions with the factor t then normalizes them, dot is the one of the two quaternions
+    template <typename P>
+    static void interpolateRotations(const typename P::Type (&a)[4], const typename P::Type (&b)[4], typename P::Type dot, typename P::Type t, float* const* out, size_t i) {
+        // The closest of rhs and -rhs is used
+        const typename P::Type rhsFactor = P::copySign(t, dot);
+        const typename P::Type lhsFactor = P::sub(P::set(1.0f), t);
+
+        typename P::Type result[4];
+        for (uint8_t component = 0; component < 4; ++component) {
+            result[component] = P::multiplyAdd(b[component], rhsFactor, P::mul(a[component], lhsFactor));
+        }
+
+        typename P::Type squaredLength = P::mul(result[0], result[0]);
+        for (uint8_t component = 1; component < 4; ++component) {
+            squaredLength = P::multiplyAdd(result[component], result[component], squaredLength);
+        }
+
+        const typename P::Type factor = P::inverseSqrt(squaredLength);
+        for (uint8_t component = 0; component < 4; ++component) {
+            P::store(out[component] + i, P::mul(result[component], factor));
+        }
+    }
+
+    static void nlerp(const float* const* lhs, const float* const* rhs, const float* factors, float* const* out, size_t count) {
+        forEach<Pack>(count, [&](auto pack, size_t i) {
+            using P = decltype(pack);
+
+            typename P::Type a[4];
+            typename P::Type b[4];
+            for (uint8_t component = 0; component < 4; ++component) {
+                a[component] = P::load(lhs[component] + i);
+                b[component] = P::load(rhs[component] + i);
+            }
+
+            typename P::Type dot = P::mul(a[0], b[0]);
+            for (uint8_t component = 1; component < 4; ++component) {
+                dot = P::multiplyAdd(a[component], b[component], dot);
+            }
+
+            interpolateRotations<P>(a, b, dot, P::load(factors + i), out, i);
+        });
+    }
+
+    static void slerp(const float* const* lhs, const float* const* rhs, const float* factors, float* const* out, size_t count) {
+        forEach<Pack>(count, [&](auto pack, size_t i) {
+            using P = decltype(pack);
+
+            typename P::Type a[4];
+            typename P::Type b[4];
+            for (uint8_t component = 0; component < 4; ++component) {
+                a[component] = P::load(lhs[component] + i);
+                b[component] = P::load(rhs[component] + i);
+            }
+
+            typename P::Type dot = P::mul(a[0], b[0]);
+            for (uint8_t component = 1; component < 4; ++component) {
+                dot = P::multiplyAdd(a[component], b[component], dot);
+            }
+
+            // Correction of the factor, the polynomials are fitted on the cosine of the angle
+            // See "Approximating slerp" by Arseny Kapoulkine
+            const typename P::Type d = P::abs(dot);
+            const typename P::Type t = P::load(factors + i);
+            const typename P::Type half = P::set(0.5f);
+
+            const typename P::Type A = P::multiplyAdd(d, P::multiplyAdd(d, P::multiplyAdd(d, P::set(-1.43519f), P::set(3.55645f)), P::set(-3.2452f)), P::set(1.0904f));
+            const typename P::Type B = P::multiplyAdd(d, P::multiplyAdd(d, P::set(0.215638f), P::set(-1.06021f)), P::set(0.848013f));
+
+            const typename P::Type centered = P::sub(t, half);
+            const typename P::Type k = P::multiplyAdd(A, P::mul(centered, centered), B);
+            const typename P::Type corrected = P::multiplyAdd(P::mul(P::mul(t, centered), P::sub(t, P::set(1.0f))), k, t);
+
+            interpolateRotations<P>(a, b, dot, corrected, out, i);
+        });
+    }
+};
+
+template <typename Pack>
+inline Kernels makeKernels() {
+    return {
+        /* transformPoints */ Implementation<Pack>::transformPoints,
+        /* transformNormals */ Implementation<Pack>::transformNormals,
+        /* composeTransforms */ Implementation<Pack>::composeTransforms,
+        /* transformAabbs */ Implementation<Pack>::transformAabbs,
+        /* cullSpheres */ Implementation<Pack>::cullSpheres,
+        /* cullAabbs */ Implementation<Pack>::cullAabbs,
+        /* intersectSpheres */ Implementation<Pack>::intersectSpheres,
+        /* intersectRayAabbs */ Implementation<Pack>::intersectRayAabbs,
+        /* intersectRayTriangles */ Implementation<Pack>::intersectRayTriangles,
+        /* packHalf */ Implementation<Pack>::packHalf,
+        /* unpackHalf */ Implementation<Pack>::unpackHalf,
+        /* packSnorm8 */ Implementation<Pack>::packSnorm8,
+        /* packUnorm8 */ Implementation<Pack>::packUnorm8,
+        /* packSnorm16 */ Implementation<Pack>::packSnorm16,
+        /* packUnorm16 */ Implementation<Pack>::packUnorm16,
+        /* encodeOctahedral */ Implementation<Pack>::encodeOctahedral,
+        /* encodeQTangent */ Implementation<Pack>::encodeQTangent,
+        /* lerp */ Implementation<Pack>::lerp,
+        /* nlerp */ Implementation<Pack>::nlerp,
+        /* slerp */ Implementation<Pack>::slerp
+    };
+}
@@ -0,0 +1,120 @@
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include <lug/Math/Batch/Kernels.hpp>
+#include <lug/Math/Simd.hpp>
+
+namespace lug {
+namespace Math {
+namespace Batch {
+namespace priv {
+
+#if defined(LUG_MATH_SIMD_NEON)
+
+namespace {
+
+#include <lug/Math/Batch/Kernels.inl>
+
+struct NeonPack {
+    using Type = float32x4_t;
+    static constexpr size_t width = 4;
+
+    static float32x4_t set(float value) { return vdupq_n_f32(value); }
+    static float32x4_t load(const float* values) { return vld1q_f32(values); }
+    static void store(float* values, float32x4_t value) { vst1q_f32(values, value); }
+
+    static float32x4_t add(float32x4_t lhs, float32x4_t rhs) { return vaddq_f32(lhs, rhs); }
+    static float32x4_t sub(float32x4_t lhs, float32x4_t rhs) { return vsubq_f32(lhs, rhs); }
+    static float32x4_t mul(float32x4_t lhs, float32x4_t rhs) { return vmulq_f32(lhs, rhs); }
+    static float32x4_t multiplyAdd(float32x4_t a, float32x4_t b, float32x4_t c) { return vmlaq_f32(c, a, b); }
+    static float32x4_t min(float32x4_t lhs, float32x4_t rhs) { return vminq_f32(lhs, rhs); }
+    static float32x4_t max(float32x4_t lhs, float32x4_t rhs) { return vmaxq_f32(lhs, rhs); }
+    static float32x4_t abs(float32x4_t value) { return vabsq_f32(value); }
+
+    static float32x4_t reciprocal(float32x4_t value) {
+        // Estimate refined by two Newton-Raphson steps, ARMv7 has no division
+        float32x4_t result = vrecpeq_f32(value);
+        result = vmulq_f32(result, vrecpsq_f32(value, result));
+        result = vmulq_f32(result, vrecpsq_f32(value, result));
+        return result;
+    }
+
+    static float32x4_t inverseSqrt(float32x4_t value) {
+        // Estimate refined by two Newton-Raphson steps, ARMv7 has no square root
+        float32x4_t result = vrsqrteq_f32(value);
+        result = vmulq_f32(result, vrsqrtsq_f32(vmulq_f32(value, result), result));
+        result = vmulq_f32(result, vrsqrtsq_f32(vmulq_f32(value, result), result));
+        return result;
+    }
+
+    static uint32_t greaterEqual(float32x4_t lhs, float32x4_t rhs) {
+        static const uint32_t lanes[4] = {1, 2, 4, 8};
+
+        const uint32x4_t bits = vandq_u32(vcgeq_f32(lhs, rhs), vld1q_u32(lanes));
+        const uint32x2_t halves = vorr_u32(vget_low_u32(bits), vget_high_u32(bits));
+
+        return vget_lane_u32(halves, 0) | vget_lane_u32(halves, 1);
+    }
+
+    static float32x4_t copySign(float32x4_t magnitude, float32x4_t sign) {
+        return vbslq_f32(vdupq_n_u32(0x80000000u), sign, magnitude);
+    }
+
+    static float32x4_t select(float32x4_t condition, float32x4_t ifNegative, float32x4_t otherwise) {
+        const uint32x4_t mask = vreinterpretq_u32_s32(vshrq_n_s32(vreinterpretq_s32_f32(condition), 31));
+        return vbslq_f32(mask, ifNegative, otherwise);
+    }
+
+    static void storeInt32(int32_t* values, float32x4_t value) {
+#if defined(__aarch64__) || defined(_M_ARM64)
+        vst1q_s32(values, vcvtnq_s32_f32(value));
+#else
+        // ARMv7 only converts toward zero, the ties are rounded away from zero
+        vst1q_s32(values, vcvtq_s32_f32(vaddq_f32(value, copySign(vdupq_n_f32(0.5f), value))));
+#endif
+    }
+
+    static void storeHalf(uint16_t* values, float32x4_t value) {
+#if defined(__aarch64__) || defined(_M_ARM64)
+        vst1_u16(values, vreinterpret_u16_f16(vcvt_f16_f32(value)));
+#else
+        // The conversions are optional on ARMv7
+        float lanes[4];
+        vst1q_f32(lanes, value);
+
+        for (size_t lane = 0; lane < 4; ++lane) {
+            values[lane] = floatToHalf(lanes[lane]);
+        }
+#endif
+    }
+
+    static float32x4_t loadHalf(const uint16_t* values) {
+#if defined(__aarch64__) || defined(_M_ARM64)
+        return vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(values)));
+#else
+        const float lanes[4] = {halfToFloat(values[0]), halfToFloat(values[1]), halfToFloat(values[2]), halfToFloat(values[3])};
+        return vld1q_f32(lanes);
+#endif
+    }
+};
+
+} // anonymous
+
+const Kernels* getNeonKernels() {
+    static const Kernels kernels = makeKernels<NeonPack>();
+    return &kernels;
+}
+
+#else
+
+const Kernels* getNeonKernels() {
+    return nullptr;
+}
+
+#endif
+
+} // priv
+} // Batch
+} // Math
+} // lug
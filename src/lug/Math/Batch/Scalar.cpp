@@ -0,0 +1,26 @@
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include <lug/Math/Batch/Kernels.hpp>
+
+namespace lug {
+namespace Math {
+namespace Batch {
+namespace priv {
+
+namespace {
+
+#include <lug/Math/Batch/Kernels.inl>
+
+} // anonymous
+
+const Kernels* getScalarKernels() {
+    static const Kernels kernels = makeKernels<ScalarPack>();
+    return &kernels;
+}
+
+} // priv
+} // Batch
+} // Math
+} // lug
@@ -0,0 +1,113 @@
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include <lug/Math/Batch/Kernels.hpp>
+#include <lug/Math/Simd.hpp>
+
+namespace lug {
+namespace Math {
+namespace Batch {
+namespace priv {
+
+#if defined(LUG_MATH_SIMD_SSE)
+
+namespace {
+
+#include <lug/Math/Batch/Kernels.inl>
+
+struct Sse2Pack {
+    using Type = __m128;
+    static constexpr size_t width = 4;
+
+    static __m128 set(float value) { return _mm_set1_ps(value); }
+    static __m128 load(const float* values) { return _mm_loadu_ps(values); }
+    static void store(float* values, __m128 value) { _mm_storeu_ps(values, value); }
+
+    static __m128 add(__m128 lhs, __m128 rhs) { return _mm_add_ps(lhs, rhs); }
+    static __m128 sub(__m128 lhs, __m128 rhs) { return _mm_sub_ps(lhs, rhs); }
+    static __m128 mul(__m128 lhs, __m128 rhs) { return _mm_mul_ps(lhs, rhs); }
+    static __m128 multiplyAdd(__m128 a, __m128 b, __m128 c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    static __m128 min(__m128 lhs, __m128 rhs) { return _mm_min_ps(lhs, rhs); }
+    static __m128 max(__m128 lhs, __m128 rhs) { return _mm_max_ps(lhs, rhs); }
+    static __m128 abs(__m128 value) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), value); }
+    static __m128 reciprocal(__m128 value) { return _mm_div_ps(_mm_set1_ps(1.0f), value); }
+    static __m128 inverseSqrt(__m128 value) { return _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(value)); }
+
+    static uint32_t greaterEqual(__m128 lhs, __m128 rhs) {
+        return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmpge_ps(lhs, rhs)));
+    }
+
+    static __m128 copySign(__m128 magnitude, __m128 sign) {
+        const __m128 mask = _mm_set1_ps(-0.0f);
+        return _mm_or_ps(_mm_andnot_ps(mask, magnitude), _mm_and_ps(mask, sign));
+    }
+
+    static __m128 select(__m128 condition, __m128 ifNegative, __m128 otherwise) {
+        const __m128 mask = _mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(condition), 31));
+        return _mm_or_ps(_mm_and_ps(mask, ifNegative), _mm_andnot_ps(mask, otherwise));
+    }
+
+    static void storeInt32(int32_t* values, __m128 value) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(values), _mm_cvtps_epi32(value));
+    }
+
+    static void storeHalf(uint16_t* values, __m128 value) {
+        // Same as floatToHalf with the three cases computed then selected
+        const __m128 sign = _mm_and_ps(value, _mm_set1_ps(-0.0f));
+        const __m128 absolute = _mm_xor_ps(value, sign);
+        const __m128i bits = _mm_castps_si128(absolute);
+
+        const __m128i isRegular = _mm_cmpgt_epi32(_mm_set1_epi32((127 + 16) << 23), bits);
+        const __m128i isSubnormal = _mm_cmpgt_epi32(_mm_set1_epi32((127 - 14) << 23), bits);
+        const __m128i isNan = _mm_castps_si128(_mm_cmpunord_ps(absolute, absolute));
+        const __m128i special = _mm_or_si128(_mm_and_si128(isNan, _mm_set1_epi32(0x200)), _mm_set1_epi32(0x7c00));
+
+        const __m128i subnormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(absolute, _mm_set1_ps(0.5f))), _mm_set1_epi32(0x3f000000));
+
+        // The odd mantissas are rounded up on ties
+        const __m128i odd = _mm_srai_epi32(_mm_slli_epi32(bits, 31 - 13), 31);
+        const __m128i normal = _mm_srli_epi32(_mm_sub_epi32(_mm_add_epi32(bits, _mm_set1_epi32(0xfff - ((127 - 15) << 23))), odd), 13);
+
+        const __m128i finite = _mm_or_si128(_mm_and_si128(isSubnormal, subnormal), _mm_andnot_si128(isSubnormal, normal));
+        const __m128i result = _mm_or_si128(_mm_and_si128(isRegular, finite), _mm_andnot_si128(isRegular, special));
+
+        // The sign is extended to the upper bits so the signed saturation keeps the 16 lower bits
+        const __m128i halves = _mm_or_si128(result, _mm_srai_epi32(_mm_castps_si128(sign), 16));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(values), _mm_packs_epi32(halves, halves));
+    }
+
+    static __m128 loadHalf(const uint16_t* values) {
+        const __m128i halves = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(values)), _mm_setzero_si128());
+        const __m128i bits = _mm_and_si128(halves, _mm_set1_epi32(0x7fff));
+
+        // The multiplication rebiases the exponent and renormalizes the subnormals
+        const __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(bits, 13)), _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23)));
+
+        const __m128i isSpecial = _mm_cmpgt_epi32(bits, _mm_set1_epi32(0x7bff));
+        const __m128i sign = _mm_slli_epi32(_mm_xor_si128(halves, bits), 16);
+        const __m128i exponent = _mm_and_si128(isSpecial, _mm_set1_epi32(255 << 23));
+
+        return _mm_or_ps(scaled, _mm_castsi128_ps(_mm_or_si128(sign, exponent)));
+    }
+};
+
+} // anonymous
+
+const Kernels* getSse2Kernels() {
+    static const Kernels kernels = makeKernels<Sse2Pack>();
+    return &kernels;
+}
+
+#else
+
+const Kernels* getSse2Kernels() {
+    return nullptr;
+}
+
+#endif
+
+} // priv
+} // Batch
+} // Math
+} // lug
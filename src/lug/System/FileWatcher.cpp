@@ -0,0 +1,120 @@
+#include <lug/System/FileWatcher.hpp>
+
+#include <algorithm>
+
+#if defined(LUG_SYSTEM_LINUX)
+    #include <sys/inotify.h>
+    #include <unistd.h>
+#endif
+
+namespace lug {
+namespace System {
+
+FileWatcher::~FileWatcher() {
+#if defined(LUG_SYSTEM_LINUX)
+    if (_fd != -1) {
+        // Closing the file descriptor removes the watches
+        close(_fd);
+        _fd = -1;
+    }
+#endif
+}
+
+bool FileWatcher::init() {
+#if defined(LUG_SYSTEM_LINUX)
+    if (_fd == -1) {
+        _fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    }
+
+    return _fd != -1;
+#else
+    return false;
+#endif
+}
+
+bool FileWatcher::watchDirectory(const std::string& directory) {
+#if defined(LUG_SYSTEM_LINUX)
+    if (_fd == -1) {
+        return false;
+    }
+
+    // Normalize the directory without the trailing slash, to build the paths in poll()
+    std::string path = directory.empty() ? "." : directory;
+    while (path.size() > 1 && path.back() == '/') {
+        path.pop_back();
+    }
+
+    if (_watchesByDirectory.find(path) != _watchesByDirectory.end()) {
+        return true;
+    }
+
+    // Editors usually save to a temporary file then rename it, hence IN_MOVED_TO
+    const int wd = inotify_add_watch(_fd, path.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+    if (wd == -1) {
+        return false;
+    }
+
+    _watchesByDirectory[path] = wd;
+    _directoriesByWatch[wd] = path;
+
+    return true;
+#else
+    (void)directory;
+    return false;
+#endif
+}
+
+bool FileWatcher::watchFile(const std::string& filename) {
+    const std::string::size_type separatorPos = filename.find_last_of('/');
+    if (separatorPos == std::string::npos) {
+        return watchDirectory(".");
+    }
+
+    return watchDirectory(filename.substr(0, separatorPos + 1));
+}
+
+std::vector<std::string> FileWatcher::poll() {
+    std::vector<std::string> filenames;
+
+#if defined(LUG_SYSTEM_LINUX)
+    if (_fd == -1) {
+        return filenames;
+    }
+
+    alignas(inotify_event) char buffer[4096];
+
+    for (;;) {
+        const ssize_t size = read(_fd, buffer, sizeof(buffer));
+
+        // Nothing more to read (EAGAIN) or error
+        if (size <= 0) {
+            break;
+        }
+
+        for (ssize_t offset = 0; offset < size;) {
+            const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+            offset += sizeof(inotify_event) + event->len;
+
+            if (!event->len || (event->mask & IN_ISDIR)) {
+                continue;
+            }
+
+            const auto it = _directoriesByWatch.find(event->wd);
+            if (it == _directoriesByWatch.end()) {
+                continue;
+            }
+
+            const std::string filename = it->second == "." ? std::string(event->name) : it->second + "/" + event->name;
+
+            if (std::find(filenames.begin(), filenames.end(), filename) == filenames.end()) {
+                filenames.push_back(filename);
+            }
+        }
+    }
+#endif
+
+    return filenames;
+}
+
+} // System
+} // lug
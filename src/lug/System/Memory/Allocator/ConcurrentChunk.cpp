@@ -0,0 +1,67 @@
+#include <lug/System/Memory/Allocator/ConcurrentChunk.hpp>
+#include <vector>
+
+namespace lug {
+namespace System {
+namespace Memory {
+namespace Allocator {
+namespace priv {
+
+namespace {
+
+class ThreadCacheIndices {
+public:
+    size_t acquire() {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        if (!_freeIndices.empty()) {
+            const size_t index = _freeIndices.back();
+            _freeIndices.pop_back();
+            return index;
+        }
+
+        return _nextIndex < maxThreadCachesCount ? _nextIndex++ : maxThreadCachesCount;
+    }
+
+    void release(size_t index) {
+        if (index >= maxThreadCachesCount) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _freeIndices.push_back(index);
+    }
+
+private:
+    std::mutex _mutex;
+    std::vector<size_t> _freeIndices;
+    size_t _nextIndex{0};
+};
+
+ThreadCacheIndices& getThreadCacheIndices() {
+    static ThreadCacheIndices indices;
+    return indices;
+}
+
+// Gives the index back when the thread ends, the chunks left in its caches are used by the next thread
+struct ThreadCacheIndex {
+    ThreadCacheIndex() : index(getThreadCacheIndices().acquire()) {}
+    ~ThreadCacheIndex() {
+        getThreadCacheIndices().release(index);
+    }
+
+    const size_t index;
+};
+
+} // anonymous
+
+size_t getThreadCacheIndex() {
+    static thread_local ThreadCacheIndex threadIndex;
+    return threadIndex.index;
+}
+
+} // priv
+} // Allocator
+} // Memory
+} // System
+} // lug
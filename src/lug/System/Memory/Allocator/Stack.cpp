@@ -1,5 +1,6 @@
 #include <lug/System/Memory/Allocator/Stack.hpp>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <lug/System/Debug.hpp>
 
@@ -33,9 +34,9 @@ void* Stack::allocate(size_t size, size_t alignment, size_t offset) {
             if (std::align(alignment, newSize - newOffset, _current, sizeLeft)) {
                 _current = static_cast<char*>(_current) + newSize - newOffset;
 
-                // Store the size and the current pointer
-                *static_cast<size_t*>(static_cast<void*>(static_cast<char*>(_current) - newSize + sizeof(void*))) = size;
-                *reinterpret_cast<void**>(static_cast<char*>(_current) - newSize) = oldCurrent;
+                // Store the size and the current pointer, not aligned if the offset isn't a multiple of their alignment
+                std::memcpy(static_cast<char*>(_current) - newSize + sizeof(void*), &size, sizeof(size));
+                std::memcpy(static_cast<char*>(_current) - newSize, &oldCurrent, sizeof(oldCurrent));
 
                 return static_cast<char*>(_current) - size;
             }
@@ -52,7 +53,8 @@ void* Stack::allocate(size_t size, size_t alignment, size_t offset) {
 void Stack::free(void* ptr) {
     LUG_ASSERT(static_cast<char*>(ptr) + getSize(ptr) == _current, "Deallocation with stack allocator not in LIFO order");
 
-    void* const oldCurrent = reinterpret_cast<void**>(static_cast<char*>(ptr) - sizeof(size_t))[-1];
+    void* oldCurrent;
+    std::memcpy(&oldCurrent, static_cast<char*>(ptr) - sizeof(size_t) - sizeof(void*), sizeof(oldCurrent));
 
     // We need to find the correct page from which this pointer come from
     while (_currentPage && (_currentPage->start > oldCurrent || _currentPage->end < oldCurrent)) {
@@ -82,7 +84,10 @@ void Stack::rewind(const Stack::Mark& mark) {
 }
 
 size_t Stack::getSize(void* ptr) const {
-    return static_cast<size_t*>(ptr)[-1];
+    size_t size;
+    std::memcpy(&size, static_cast<char*>(ptr) - sizeof(size_t), sizeof(size));
+
+    return size;
 }
 
 } // Allocator
@@ -0,0 +1,139 @@
+#include <lug/System/Memory/Area/VirtualMemory.hpp>
+
+#if defined(LUG_SYSTEM_WINDOWS)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <Windows.h>
+#else
+    #include <sys/mman.h>
+#endif
+
+namespace lug {
+namespace System {
+namespace Memory {
+namespace Area {
+namespace priv {
+
+namespace {
+
+// Size of the huge pages on x86-64 and arm64
+constexpr size_t hugePageSize = 2 * 1024 * 1024;
+
+} // anonymous
+
+VirtualRange reserveVirtualMemory(size_t size, HugePages hugePages) {
+    VirtualRange range;
+
+#if defined(LUG_SYSTEM_WINDOWS)
+    // The large pages of Windows can't be committed on demand
+    (void)(hugePages);
+
+    range.base = VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+
+    if (!range.base) {
+        return {};
+    }
+
+    range.size = size;
+    range.start = static_cast<char*>(range.base);
+#else
+    // Reserve one more huge page to align the start of the pages on the huge pages
+    const size_t alignment = hugePages == HugePages::None ? 0 : hugePageSize;
+
+    range.base = mmap(nullptr, size + alignment, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+    if (range.base == MAP_FAILED) {
+        return {};
+    }
+
+    range.size = size + alignment;
+    range.start = static_cast<char*>(range.base);
+
+    if (alignment) {
+        const uintptr_t address = reinterpret_cast<uintptr_t>(range.base);
+        range.start += (alignment - address % alignment) % alignment;
+    }
+#endif
+
+    return range;
+}
+
+void releaseVirtualMemory(const VirtualRange& range) {
+    if (!range.base) {
+        return;
+    }
+
+#if defined(LUG_SYSTEM_WINDOWS)
+    VirtualFree(range.base, 0, MEM_RELEASE);
+#else
+    munmap(range.base, range.size);
+#endif
+}
+
+bool commitVirtualMemory(void* ptr, size_t size, HugePages hugePages) {
+#if defined(LUG_SYSTEM_WINDOWS)
+    (void)(hugePages);
+
+    return VirtualAlloc(ptr, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+    bool committed = false;
+
+#if defined(MAP_HUGETLB)
+    // The length of a huge pages mapping is rounded up to the huge pages, and a failing MAP_FIXED
+    // unmaps it first, so only whole huge pages of the range are mapped
+    const bool hugePagesAligned = reinterpret_cast<uintptr_t>(ptr) % hugePageSize == 0 && size % hugePageSize == 0;
+
+    if (hugePages == HugePages::Explicit && hugePagesAligned) {
+        if (mmap(ptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED | MAP_HUGETLB, -1, 0) != MAP_FAILED) {
+            return true;
+        }
+
+        // Not enough huge pages reserved in the system, the failure may have unmapped the range
+        if (mmap(ptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED | MAP_NORESERVE, -1, 0) == MAP_FAILED) {
+            return false;
+        }
+
+        committed = true;
+    }
+#endif
+
+    if (!committed && mprotect(ptr, size, PROT_READ | PROT_WRITE) != 0) {
+        return false;
+    }
+
+#if defined(MADV_HUGEPAGE)
+    if (hugePages != HugePages::None) {
+        madvise(ptr, size, MADV_HUGEPAGE);
+    }
+#endif
+
+    return true;
+#endif
+}
+
+void decommitVirtualMemory(void* ptr, size_t size) {
+#if defined(LUG_SYSTEM_WINDOWS)
+    VirtualFree(ptr, size, MEM_DECOMMIT);
+#else
+    madvise(ptr, size, MADV_DONTNEED);
+    mprotect(ptr, size, PROT_NONE);
+#endif
+}
+
+void discardVirtualMemory(void* ptr, size_t size) {
+#if defined(LUG_SYSTEM_WINDOWS)
+    VirtualAlloc(ptr, size, MEM_RESET, PAGE_READWRITE);
+#else
+    madvise(ptr, size, MADV_DONTNEED);
+#endif
+}
+
+} // priv
+} // Area
+} // Memory
+} // System
+} // lug
@@ -0,0 +1,117 @@
+#include <lug/System/Memory/Scratch.hpp>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <lug/System/Debug.hpp>
+#include <lug/System/Memory/Arena.hpp>
+#include <lug/System/Memory/Area/GrowingHeap.hpp>
+#include <lug/System/Memory/Policies/BoundsChecker.hpp>
+#include <lug/System/Memory/Policies/MemoryMarker.hpp>
+#include <lug/System/Memory/Policies/Thread.hpp>
+
+namespace lug {
+namespace System {
+namespace Memory {
+
+constexpr size_t ScratchScope::defaultAlignment;
+constexpr size_t ScratchScope::pageSize;
+constexpr size_t ScratchScope::maxPageCount;
+
+namespace {
+
+#if defined(LUG_DEBUG)
+using ScratchArena = Arena<Allocator::Stack, Policies::SingleThreadPolicy, Policies::SimpleBoundsChecking, Policies::SimpleMemoryMarking>;
+using ScratchBoundsChecking = Policies::SimpleBoundsChecking;
+#else
+using ScratchArena = Arena<Allocator::Stack, Policies::SingleThreadPolicy, Policies::NoBoundsChecking, Policies::NoMemoryMarking>;
+using ScratchBoundsChecking = Policies::NoBoundsChecking;
+#endif
+
+} // anonymous
+
+struct ScratchScope::Data {
+    Data() : arena(&area) {}
+
+    Area::GrowingHeap<ScratchScope::pageSize, ScratchScope::maxPageCount> area;
+    ScratchArena arena;
+
+    ScratchScope* innermost{nullptr};
+
+#if defined(LUG_DEBUG)
+    // Freed in reverse order at the end of their scope to check the guards
+    std::vector<void*> allocations;
+#endif
+};
+
+// Defined here and not in the header, so each thread has only one scratch even across the shared libraries
+ScratchScope::Data& ScratchScope::getThreadData() {
+    static thread_local ScratchScope::Data data;
+    return data;
+}
+
+ScratchScope::ScratchScope() : _data(getThreadData()), _mark(_data.arena.allocator().getMark()), _parent(_data.innermost) {
+    _data.innermost = this;
+
+#if defined(LUG_DEBUG)
+    _allocationsCount = _data.allocations.size();
+#endif
+}
+
+ScratchScope::~ScratchScope() {
+    LUG_ASSERT(_data.innermost == this, "The scratch scopes must be destroyed in the reverse order of their creation");
+
+#if defined(LUG_DEBUG)
+    while (_data.allocations.size() > _allocationsCount) {
+        _data.arena.free(_data.allocations.back());
+        _data.allocations.pop_back();
+    }
+#endif
+
+    _data.innermost = _parent;
+    _data.arena.allocator().rewind(_mark);
+}
+
+void* ScratchScope::allocate(size_t size, size_t alignment) {
+    static Location location{__FILE__, __LINE__};
+    return allocateAt(size, alignment, 0, location);
+}
+
+void* ScratchScope::allocate(size_t size, size_t alignment, size_t offset, const char* file, size_t line) {
+    return allocateAt(size, alignment, offset, file, line);
+}
+
+void* ScratchScope::allocate(size_t size, size_t alignment, size_t offset, Location& location) {
+    return allocateAt(size, alignment, offset, location);
+}
+
+template <class ...CallSite>
+void* ScratchScope::allocateAt(size_t size, size_t alignment, size_t offset, CallSite&&... callSite) {
+    LUG_ASSERT(_data.innermost == this, "Only the innermost scratch scope of the thread can allocate");
+
+    // The stack allocator stores its size and pointer before the block, aligned with it
+    if (alignment < alignof(std::max_align_t)) {
+        alignment = alignof(std::max_align_t);
+    }
+
+    // The stack allocator would request all the remaining pages for a block larger than a page
+    const size_t overhead = alignment + offset + sizeof(size_t) + sizeof(void*) + ScratchBoundsChecking::SizeFront + ScratchBoundsChecking::SizeBack;
+    if (overhead >= pageSize || size > pageSize - overhead) {
+        return nullptr;
+    }
+
+    void* const ptr = _data.arena.allocate(size > offset ? size : offset + 1, alignment, offset, std::forward<CallSite>(callSite)...);
+
+#if defined(LUG_DEBUG)
+    if (ptr) {
+        _data.allocations.push_back(ptr);
+    }
+#endif
+
+    return ptr;
+}
+
+void ScratchScope::free(void*) {}
+
+} // Memory
+} // System
+} // lug
@@ -0,0 +1,403 @@
+#include <lug/System/Memory/Tracking.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <thread>
+#include <lug/System/Logger/Logger.hpp>
+
+namespace lug {
+namespace System {
+namespace Memory {
+namespace Tracking {
+
+namespace {
+
+constexpr size_t callSitesCapacity = 4096;
+constexpr size_t arenasCapacity = 256;
+constexpr size_t threadCountersCapacity = 16384;
+
+// One cache line each, the counters of different threads are written at the same time
+struct alignas(64) ThreadCounters {
+    Counters counters;
+};
+
+// Allocated the first time the tracking is used, the programs not using it don't pay for them
+struct Tables {
+    CallSite callSites[callSitesCapacity];
+
+    // Shared by all the call sites when there are too many
+    CallSite otherCallSites;
+
+    TrackedArena arenas[arenasCapacity];
+
+    ThreadCounters threadCounters[threadCountersCapacity];
+    std::atomic<size_t> threadCountersCount{0};
+};
+
+std::atomic<Tables*> tables{nullptr};
+
+// Used if the tables can't be allocated
+Counters untrackedCounters;
+
+// Bit i is set if the index i is used by a thread, the index 0 is for the threads without index
+std::atomic<uint64_t> usedThreadIndices{1};
+
+static_assert(maxThreadsCount <= 64, "The thread indices don't fit in usedThreadIndices");
+
+// lug-system is loaded with the program, its thread local variables can be in the initial block of
+// the threads and read without calling __tls_get_addr
+#if defined(LUG_SYSTEM_LINUX) && (defined(LUG_COMPILER_GCC) || defined(LUG_COMPILER_CLANG))
+    #define LUG_TRACKING_TLS_MODEL __attribute__((tls_model("initial-exec")))
+#else
+    #define LUG_TRACKING_TLS_MODEL
+#endif
+
+// Only one thread local variable, read by each tracked allocation and deallocation
+constexpr uint32_t noThreadIndexYet = ~uint32_t{0};
+thread_local uint32_t threadIndex LUG_TRACKING_TLS_MODEL = noThreadIndexYet;
+
+// Releases the index of the thread when it exits
+struct ThreadIndexReleaser {
+    ~ThreadIndexReleaser() {
+        if (threadIndex && threadIndex != noThreadIndexYet) {
+            // The next thread with this index sees the counters written by this one
+            usedThreadIndices.fetch_and(~(uint64_t{1} << threadIndex), std::memory_order_release);
+
+            // The deallocations made after are counted as made by another thread
+            threadIndex = 0;
+        }
+    }
+};
+
+Tables* getTables() {
+    Tables* current = tables.load(std::memory_order_acquire);
+
+    if (current) {
+        return current;
+    }
+
+    // Aligned by hand, operator new doesn't align more than std::max_align_t before C++17
+    size_t size = sizeof(Tables) + alignof(Tables);
+    void* const memory = std::malloc(size);
+    void* aligned = memory;
+
+    if (!memory || !std::align(alignof(Tables), sizeof(Tables), aligned, size)) {
+        std::free(memory);
+        return nullptr;
+    }
+
+    Tables* const created = new (aligned) Tables();
+    created->otherCallSites.threadCounters[0].store(&created->otherCallSites.counters, std::memory_order_relaxed);
+
+    // Never freed, the allocations of the static objects can be tracked until the end
+    if (!tables.compare_exchange_strong(current, created, std::memory_order_acq_rel, std::memory_order_acquire)) {
+        created->~Tables();
+        std::free(memory);
+
+        return current;
+    }
+
+    return created;
+}
+
+uint64_t hashCallSite(const char* file, size_t line) {
+    uint64_t hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(file)) * 0x9E3779B97F4A7C15ull;
+    hash ^= static_cast<uint64_t>(line) * 0xC2B2AE3D27D4EB4Full;
+    hash ^= hash >> 29;
+
+    return hash ? hash : 1;
+}
+
+CallSite& findCallSite(Tables& tables, const char* file, size_t line) {
+    const uint64_t key = hashCallSite(file, line);
+
+    for (size_t i = 0; i < callSitesCapacity; ++i) {
+        CallSite& callSite = tables.callSites[(key + i) % callSitesCapacity];
+        uint64_t siteKey = callSite.key.load(std::memory_order_acquire);
+
+        if (!siteKey) {
+            if (callSite.key.compare_exchange_strong(siteKey, key, std::memory_order_acq_rel)) {
+                callSite.line = line;
+                callSite.threadCounters[0].store(&callSite.counters, std::memory_order_relaxed);
+                callSite.file.store(file, std::memory_order_release);
+
+                return callSite;
+            }
+
+            // Taken by another thread in the meantime, siteKey is its key
+        }
+
+        if (siteKey == key) {
+            const char* siteFile;
+
+            // Wait for the thread creating this call site
+            while (!(siteFile = callSite.file.load(std::memory_order_acquire))) {
+                std::this_thread::yield();
+            }
+
+            if (siteFile == file && callSite.line == line) {
+                return callSite;
+            }
+        }
+    }
+
+    return tables.otherCallSites;
+}
+
+// The slot of a thread is only written by the thread itself
+Counters& getThreadCounters(Tables& tables, std::atomic<Counters*>& slot, Counters& sharedCounters, uint32_t thread) {
+    Counters* counters = slot.load(std::memory_order_acquire);
+
+    if (counters) {
+        return *counters;
+    }
+
+    if (!thread) {
+        return sharedCounters;
+    }
+
+    const size_t index = tables.threadCountersCount.fetch_add(1, std::memory_order_relaxed);
+    counters = &sharedCounters;
+
+    if (index < threadCountersCapacity) {
+        counters = &tables.threadCounters[index].counters;
+        counters->owner = thread;
+    }
+
+    slot.store(counters, std::memory_order_release);
+
+    return *counters;
+}
+
+Stats& operator+=(Stats& lhs, const Stats& rhs) {
+    lhs.count += rhs.count;
+    lhs.bytes += rhs.bytes;
+    lhs.peakCount += rhs.peakCount;
+    lhs.peakBytes += rhs.peakBytes;
+    lhs.totalCount += rhs.totalCount;
+
+    return lhs;
+}
+
+Stats sumStats(const Counters& sharedCounters, const std::atomic<Counters*> (&slots)[maxThreadsCount]) {
+    Stats stats = getStats(sharedCounters);
+
+    for (const std::atomic<Counters*>& slot : slots) {
+        const Counters* const counters = slot.load(std::memory_order_acquire);
+
+        if (counters && counters != &sharedCounters) {
+            stats += getStats(*counters);
+        }
+    }
+
+    return stats;
+}
+
+} // anonymous
+
+uint32_t getThreadIndex() {
+    uint32_t index = threadIndex;
+
+    if (index != noThreadIndexYet) {
+        return index;
+    }
+
+    uint64_t used = usedThreadIndices.load(std::memory_order_relaxed);
+
+    do {
+        for (index = 1; index < maxThreadsCount && (used & (uint64_t{1} << index)); ++index) {}
+
+        if (index == maxThreadsCount) {
+            threadIndex = 0;
+            return 0;
+        }
+    } while (!usedThreadIndices.compare_exchange_weak(used, used | (uint64_t{1} << index), std::memory_order_acquire));
+
+    threadIndex = index;
+
+    // Constructed here the first time, destroyed when the thread exits
+    static thread_local ThreadIndexReleaser releaser;
+    (void)releaser;
+
+    return index;
+}
+
+Counters& getCallSiteCounters(const char* file, size_t line, uint32_t thread) {
+    Tables* const current = getTables();
+
+    if (!current) {
+        return untrackedCounters;
+    }
+
+    CallSite& callSite = findCallSite(*current, file, line);
+    return getThreadCounters(*current, callSite.threadCounters[thread], callSite.counters, thread);
+}
+
+Counters& createCallSiteCounters(Location& location, uint32_t thread) {
+    Tables* const current = getTables();
+
+    if (!current) {
+        return untrackedCounters;
+    }
+
+    CallSite* callSite = location.callSite.load(std::memory_order_acquire);
+
+    // The threads resolving it at the same time find the same call site
+    if (!callSite) {
+        callSite = &findCallSite(*current, location.file, location.line);
+        location.callSite.store(callSite, std::memory_order_release);
+    }
+
+    return getThreadCounters(*current, callSite->threadCounters[thread], callSite->counters, thread);
+}
+
+Counters& createArenaCounters(TrackedArena& arena, uint32_t thread) {
+    // The tables exist, the arena is in them
+    return getThreadCounters(*tables.load(std::memory_order_acquire), arena.threadCounters[thread], arena.counters, thread);
+}
+
+TrackedArena* registerArena() {
+    Tables* const current = getTables();
+
+    if (!current) {
+        return nullptr;
+    }
+
+    for (TrackedArena& arena : current->arenas) {
+        bool used = false;
+
+        if (arena.used.compare_exchange_strong(used, true, std::memory_order_acquire)) {
+            arena.name.store(nullptr, std::memory_order_relaxed);
+            arena.counters.clear();
+            arena.threadCounters[0].store(&arena.counters, std::memory_order_relaxed);
+
+            // The counters of the threads are kept for the next arena of this slot
+            for (std::atomic<Counters*>& slot : arena.threadCounters) {
+                Counters* const counters = slot.load(std::memory_order_acquire);
+
+                if (counters && counters != &arena.counters) {
+                    counters->clear();
+                }
+            }
+
+            return &arena;
+        }
+    }
+
+    return nullptr;
+}
+
+void unregisterArena(TrackedArena* arena) {
+    if (arena) {
+        arena->used.store(false, std::memory_order_release);
+    }
+}
+
+void removeAll(TrackedArena& arena) {
+    arena.counters.removeAll();
+
+    for (std::atomic<Counters*>& slot : arena.threadCounters) {
+        Counters* const counters = slot.load(std::memory_order_acquire);
+
+        if (counters && counters != &arena.counters) {
+            counters->removeAll();
+        }
+    }
+}
+
+Stats getStats(const TrackedArena& arena) {
+    return sumStats(arena.counters, arena.threadCounters);
+}
+
+std::vector<CallSiteStats> getCallSites() {
+    std::vector<CallSiteStats> result;
+    const Tables* const current = tables.load(std::memory_order_acquire);
+
+    if (!current) {
+        return result;
+    }
+
+    for (const CallSite& callSite : current->callSites) {
+        const char* const file = callSite.file.load(std::memory_order_acquire);
+
+        if (!file) {
+            continue;
+        }
+
+        const Stats stats = sumStats(callSite.counters, callSite.threadCounters);
+
+        // The same call site can have several copies of __FILE__, one per library
+        const auto it = std::find_if(result.begin(), result.end(), [&](const CallSiteStats& other) {
+            return other.line == callSite.line && std::strcmp(other.file, file) == 0;
+        });
+
+        if (it != result.end()) {
+            it->stats += stats;
+        } else {
+            result.push_back({file, callSite.line, stats});
+        }
+    }
+
+    const Stats others = sumStats(current->otherCallSites.counters, current->otherCallSites.threadCounters);
+    if (others.totalCount) {
+        result.push_back({"<other call sites>", 0, others});
+    }
+
+    std::sort(result.begin(), result.end(), [](const CallSiteStats& lhs, const CallSiteStats& rhs) {
+        return lhs.stats.bytes > rhs.stats.bytes || (lhs.stats.bytes == rhs.stats.bytes && lhs.stats.peakBytes > rhs.stats.peakBytes);
+    });
+
+    return result;
+}
+
+std::vector<ArenaStats> getArenas() {
+    std::vector<ArenaStats> result;
+    const Tables* const current = tables.load(std::memory_order_acquire);
+
+    if (!current) {
+        return result;
+    }
+
+    for (const TrackedArena& arena : current->arenas) {
+        if (!arena.used.load(std::memory_order_acquire)) {
+            continue;
+        }
+
+        const char* const name = arena.name.load(std::memory_order_relaxed);
+        result.push_back({name ? name : "<unnamed>", getStats(arena)});
+    }
+
+    std::sort(result.begin(), result.end(), [](const ArenaStats& lhs, const ArenaStats& rhs) {
+        return lhs.stats.bytes > rhs.stats.bytes;
+    });
+
+    return result;
+}
+
+void dump(size_t maxCallSitesCount) {
+    for (const ArenaStats& arena : getArenas()) {
+        LUG_LOG.info(
+            "Memory: Arena {}: {} bytes in {} allocation(s), peak of {} bytes and {} allocation(s)",
+            arena.name, arena.stats.bytes, arena.stats.count, arena.stats.peakBytes, arena.stats.peakCount
+        );
+    }
+
+    const std::vector<CallSiteStats> sites = getCallSites();
+
+    for (size_t i = 0; i < sites.size() && i < maxCallSitesCount; ++i) {
+        const CallSiteStats& site = sites[i];
+
+        LUG_LOG.info(
+            "Memory: {}:{}: {} bytes in {} allocation(s), peak of {} bytes, {} allocation(s) in total",
+            site.file, site.line, site.stats.bytes, site.stats.count, site.stats.peakBytes, site.stats.totalCount
+        );
+    }
+}
+
+} // Tracking
+} // Memory
+} // System
+} // lug
@@ -0,0 +1,363 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <lug/Graphics/Animation/Animator.hpp>
+#include <lug/Math/Geometry/Transform.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Animation {
+
+namespace {
+
+void expectNear(const Math::Vec3f& lhs, const Math::Vec3f& rhs, float error) {
+    EXPECT_NEAR(lhs.x(), rhs.x(), error);
+    EXPECT_NEAR(lhs.y(), rhs.y(), error);
+    EXPECT_NEAR(lhs.z(), rhs.z(), error);
+}
+
+void expectNear(const Math::Mat4x4f& lhs, const Math::Mat4x4f& rhs, float error) {
+    for (uint8_t row = 0; row < 4; ++row) {
+        for (uint8_t col = 0; col < 4; ++col) {
+            EXPECT_NEAR(lhs(row, col), rhs(row, col), error) << "row " << static_cast<int>(row) << ", col " << static_cast<int>(col);
+        }
+    }
+}
+
+Clip::Track createTrack(uint32_t joint, Clip::Track::Path path, const std::vector<float>& times, const std::vector<std::vector<float>>& values) {
+    Clip::Track track;
+    track.joint = joint;
+    track.path = path;
+    track.times = times;
+
+    for (const std::vector<float>& value : values) {
+        for (size_t component = 0; component < value.size(); ++component) {
+            track.values[component].push_back(value[component]);
+        }
+    }
+
+    return track;
+}
+
+// The skinning matrix of a joint is the identity in the rest pose
+Math::Mat4x4f getBindMatrix(const Math::Vec3f& translation, const Math::Quatf& rotation) {
+    return Math::Geometry::translate(translation) * rotation.transform();
+}
+
+} // anonymous
+
+TEST(Animation, Skeleton) {
+    Skeleton skeleton("skeleton");
+
+    // The parents are after their children
+    std::vector<Skeleton::Joint> joints(4);
+    joints[0].name = "hand";
+    joints[0].parent = 1;
+    joints[1].name = "arm";
+    joints[1].parent = 3;
+    joints[2].name = "leg";
+    joints[2].parent = 3;
+    joints[3].name = "hips";
+
+    ASSERT_TRUE(skeleton.setJoints(joints));
+    EXPECT_EQ(skeleton.getJointsCount(), 4u);
+    EXPECT_EQ(skeleton.getJointIndex("arm"), 1);
+    EXPECT_EQ(skeleton.getJointIndex("head"), -1);
+
+    const std::vector<uint32_t> expectedOrder{3, 1, 2, 0};
+    EXPECT_EQ(skeleton.getEvaluationOrder(), expectedOrder);
+
+    // Cycles and out of range parents
+    joints[3].parent = 0;
+    EXPECT_FALSE(skeleton.setJoints(joints));
+
+    joints[3].parent = 4;
+    EXPECT_FALSE(skeleton.setJoints(joints));
+}
+
+TEST(Animation, Clip) {
+    Clip clip("clip");
+
+    EXPECT_FALSE(clip.addTrack(createTrack(0, Clip::Track::Path::Translation, {}, {})));
+    EXPECT_FALSE(clip.addTrack(createTrack(0, Clip::Track::Path::Translation, {1.0f, 0.0f}, {{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}})));
+    EXPECT_FALSE(clip.addTrack(createTrack(0, Clip::Track::Path::Rotation, {0.0f}, {{0.0f, 0.0f, 0.0f}})));
+
+    EXPECT_TRUE(clip.addTrack(createTrack(0, Clip::Track::Path::Translation, {0.0f, 1.5f}, {{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}})));
+    EXPECT_TRUE(clip.addTrack(createTrack(0, Clip::Track::Path::Rotation, {0.5f, 2.0f}, {{1.0f, 0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f, 0.0f}})));
+
+    EXPECT_EQ(clip.getDuration(), 2.0f);
+    EXPECT_EQ(clip.getTracks(Clip::Track::Path::Translation).size(), 1u);
+    EXPECT_EQ(clip.getTracks(Clip::Track::Path::Rotation).size(), 1u);
+    EXPECT_EQ(clip.getTracks(Clip::Track::Path::Scale).size(), 0u);
+}
+
+TEST(Animation, Sampling) {
+    Skeleton skeleton("skeleton");
+    ASSERT_TRUE(skeleton.setJoints(std::vector<Skeleton::Joint>(2)));
+
+    Clip clip("clip");
+    ASSERT_TRUE(clip.addTrack(createTrack(1, Clip::Track::Path::Translation, {0.0f, 1.0f, 2.0f}, {{0.0f, 0.0f, 0.0f}, {2.0f, 0.0f, 0.0f}, {2.0f, 4.0f, 0.0f}})));
+
+    Clip::Track steps = createTrack(0, Clip::Track::Path::Scale, {0.5f, 1.5f}, {{1.0f, 1.0f, 1.0f}, {3.0f, 3.0f, 3.0f}});
+    steps.interpolation = Clip::Track::Interpolation::Step;
+    ASSERT_TRUE(clip.addTrack(steps));
+
+    Animator animator(&skeleton);
+    const uint32_t layer = animator.addLayer(&clip);
+
+    const struct {
+        float elapsedTime;
+        Math::Vec3f translation;
+        float scale;
+    } frames[] = {
+        {0.0f, {0.0f, 0.0f, 0.0f}, 1.0f},
+        {0.5f, {1.0f, 0.0f, 0.0f}, 1.0f},
+        {1.0f, {2.0f, 2.0f, 0.0f}, 3.0f},
+        // Looped to 0.25
+        {0.75f, {0.5f, 0.0f, 0.0f}, 1.0f},
+        // Backward to 1.75
+        {-0.5f, {2.0f, 3.0f, 0.0f}, 3.0f}
+    };
+
+    for (const auto& frame : frames) {
+        animator.update(System::Time(static_cast<int64_t>(frame.elapsedTime * 1000000.0f)));
+
+        expectNear(animator.getPose().translations.get(1), frame.translation, 1e-5f);
+        expectNear(animator.getPose().scales.get(0), Math::Vec3f(frame.scale), 1e-5f);
+
+        // The joints and paths without tracks stay in the rest pose
+        expectNear(animator.getPose().translations.get(0), Math::Vec3f(0.0f), 1e-5f);
+        expectNear(animator.getPose().scales.get(1), Math::Vec3f(1.0f), 1e-5f);
+    }
+
+    // The clips which don't loop stay on their last keys
+    animator.getLayer(layer).loop = false;
+    animator.update(System::Time(10000000));
+
+    EXPECT_EQ(animator.getLayer(layer).time, 2.0f);
+    expectNear(animator.getPose().translations.get(1), {2.0f, 4.0f, 0.0f}, 1e-5f);
+}
+
+TEST(Animation, Rotations) {
+    Skeleton skeleton("skeleton");
+    ASSERT_TRUE(skeleton.setJoints(std::vector<Skeleton::Joint>(1)));
+
+    const Math::Vec3f axis{0.0f, 0.0f, 1.0f};
+    const Math::Quatf from(0.0f, axis);
+    const Math::Quatf to(2.5f, axis);
+
+    Clip clip("clip");
+    ASSERT_TRUE(clip.addTrack(createTrack(0, Clip::Track::Path::Rotation, {0.0f, 1.0f}, {
+        {from.w(), from.x(), from.y(), from.z()},
+        {to.w(), to.x(), to.y(), to.z()}
+    })));
+
+    Animator animator(&skeleton);
+    animator.addLayer(&clip);
+
+    for (bool slerp : {false, true}) {
+        animator.setSlerpEnabled(slerp);
+        animator.getLayer(0).time = 0.3f;
+        animator.evaluate();
+
+        const Math::Quatf expected = slerp ? Math::slerp(from, to, 0.3f) : Math::nlerp(from, to, 0.3f);
+        const Math::Quatf rotation = animator.getPose().rotations.get(0);
+
+        EXPECT_NEAR(std::abs(dot(rotation, expected)), 1.0f, 1e-6f);
+    }
+
+    // The error of nlerp is large for such an angle
+    EXPECT_GT(std::abs(Math::nlerp(from, to, 0.3f).getAngle() - 0.75f), 0.05f);
+    EXPECT_NEAR(animator.getPose().rotations.get(0).getAngle(), 0.75f, 1e-3f);
+}
+
+TEST(Animation, Palette) {
+    // A chain of three joints, the rest pose is the bind pose
+    const Math::Quatf rotation(Math::halfPi<float>(), Math::Vec3f{0.0f, 0.0f, 1.0f});
+
+    std::vector<Skeleton::Joint> joints(3);
+    joints[0].translation = {0.0f, 1.0f, 0.0f};
+    joints[1].parent = 0;
+    joints[1].translation = {1.0f, 0.0f, 0.0f};
+    joints[1].rotation = rotation;
+    joints[2].parent = 1;
+    joints[2].translation = {1.0f, 0.0f, 0.0f};
+
+    const Math::Mat4x4f bindMatrices[3] = {
+        getBindMatrix(joints[0].translation, joints[0].rotation),
+        getBindMatrix(joints[0].translation, joints[0].rotation) * getBindMatrix(joints[1].translation, joints[1].rotation),
+        getBindMatrix(joints[0].translation, joints[0].rotation) * getBindMatrix(joints[1].translation, joints[1].rotation) * getBindMatrix(joints[2].translation, joints[2].rotation)
+    };
+
+    for (uint8_t i = 0; i < 3; ++i) {
+        joints[i].inverseBindMatrix = Math::Geometry::affineInverse(bindMatrices[i]);
+    }
+
+    Skeleton skeleton("skeleton");
+    ASSERT_TRUE(skeleton.setJoints(joints));
+
+    Animator animator(&skeleton);
+
+    for (uint8_t i = 0; i < 3; ++i) {
+        expectNear(animator.getJointsMatrices()[i], bindMatrices[i], 1e-5f);
+        expectNear(animator.getPalette()[i], Math::Mat4x4f::identity(), 1e-5f);
+    }
+
+    // The tip is at (1, 2, 0)
+    expectNear(Math::Vec3f(animator.getJointsMatrices()[2] * Math::Vec4f{0.0f, 0.0f, 0.0f, 1.0f}), {1.0f, 2.0f, 0.0f}, 1e-5f);
+
+    // Moving the root moves the whole chain
+    Clip clip("clip");
+    ASSERT_TRUE(clip.addTrack(createTrack(0, Clip::Track::Path::Translation, {0.0f}, {{0.0f, 3.0f, 0.0f}})));
+
+    animator.addLayer(&clip);
+    animator.evaluate();
+
+    for (uint8_t i = 0; i < 3; ++i) {
+        expectNear(animator.getPalette()[i], Math::Geometry::translate(Math::Vec3f{0.0f, 2.0f, 0.0f}), 1e-5f);
+    }
+}
+
+TEST(Animation, Blending) {
+    Skeleton skeleton("skeleton");
+    ASSERT_TRUE(skeleton.setJoints(std::vector<Skeleton::Joint>(2)));
+
+    const Math::Quatf rotation(1.0f, Math::Vec3f{1.0f, 0.0f, 0.0f});
+
+    Clip walk("walk");
+    ASSERT_TRUE(walk.addTrack(createTrack(0, Clip::Track::Path::Translation, {0.0f}, {{2.0f, 0.0f, 0.0f}})));
+    ASSERT_TRUE(walk.addTrack(createTrack(1, Clip::Track::Path::Translation, {0.0f}, {{0.0f, 2.0f, 0.0f}})));
+
+    Clip wave("wave");
+    ASSERT_TRUE(wave.addTrack(createTrack(0, Clip::Track::Path::Translation, {0.0f}, {{4.0f, 0.0f, 0.0f}})));
+    ASSERT_TRUE(wave.addTrack(createTrack(0, Clip::Track::Path::Rotation, {0.0f}, {{rotation.w(), rotation.x(), rotation.y(), rotation.z()}})));
+
+    Animator animator(&skeleton);
+    animator.addLayer(&walk);
+    const uint32_t waveLayer = animator.addLayer(&wave, 0.25f);
+    animator.evaluate();
+
+    // The joint 1 isn't animated by the second layer
+    expectNear(animator.getPose().translations.get(0), {2.5f, 0.0f, 0.0f}, 1e-5f);
+    expectNear(animator.getPose().translations.get(1), {0.0f, 2.0f, 0.0f}, 1e-5f);
+    EXPECT_NEAR(animator.getPose().rotations.get(0).getAngle(), 0.25f, 1e-2f);
+
+    animator.getLayer(waveLayer).weight = 0.0f;
+    animator.evaluate();
+
+    expectNear(animator.getPose().translations.get(0), {2.0f, 0.0f, 0.0f}, 1e-5f);
+}
+
+#if defined(ENABLE_LONG_TESTS)
+
+TEST(Animation, Benchmark) {
+    constexpr uint32_t charactersCount = 1000;
+    constexpr uint32_t jointsCount = 60;
+    constexpr uint32_t keysCount = 30;
+    constexpr uint32_t framesCount = 100;
+
+    // A tree of chains of five joints, every joint is animated on the three paths
+    std::vector<Skeleton::Joint> joints(jointsCount);
+    for (uint32_t i = 0; i < jointsCount; ++i) {
+        joints[i].parent = i % 5 ? i - 1 : (i ? 0 : -1);
+        joints[i].translation = {0.0f, 1.0f, 0.0f};
+    }
+
+    Skeleton skeleton("skeleton");
+    ASSERT_TRUE(skeleton.setJoints(joints));
+
+    Clip clip("clip");
+    for (uint32_t joint = 0; joint < jointsCount; ++joint) {
+        std::vector<float> times;
+        std::vector<std::vector<float>> translations;
+        std::vector<std::vector<float>> rotations;
+        std::vector<std::vector<float>> scales;
+
+        for (uint32_t key = 0; key < keysCount; ++key) {
+            const float time = key / 30.0f;
+            const Math::Quatf rotation(std::sin(time + joint), Math::normalize(Math::Vec3f{1.0f, static_cast<float>(joint), 2.0f}));
+
+            times.push_back(time);
+            translations.push_back({std::sin(time), 1.0f, std::cos(time)});
+            rotations.push_back({rotation.w(), rotation.x(), rotation.y(), rotation.z()});
+            scales.push_back({1.0f, 1.0f + time, 1.0f});
+        }
+
+        ASSERT_TRUE(clip.addTrack(createTrack(joint, Clip::Track::Path::Translation, times, translations)));
+        ASSERT_TRUE(clip.addTrack(createTrack(joint, Clip::Track::Path::Rotation, times, rotations)));
+        ASSERT_TRUE(clip.addTrack(createTrack(joint, Clip::Track::Path::Scale, times, scales)));
+    }
+
+    // Two layers per character, at different times
+    std::vector<Animator> animators;
+    animators.reserve(charactersCount);
+    for (uint32_t i = 0; i < charactersCount; ++i) {
+        animators.emplace_back(&skeleton);
+
+        animators.back().addLayer(&clip);
+        animators.back().getLayer(0).time = i * 0.001f;
+
+        animators.back().addLayer(&clip, 0.5f);
+        animators.back().getLayer(1).time = i * 0.0005f;
+    }
+
+    const System::Time elapsedTime(16666);
+
+    const auto benchmark = [&](uint32_t threadsCount) {
+        const auto start = std::chrono::high_resolution_clock::now();
+
+        for (uint32_t frame = 0; frame < framesCount; ++frame) {
+            std::vector<std::thread> threads;
+
+            for (uint32_t thread = 0; thread < threadsCount; ++thread) {
+                threads.emplace_back([&, thread]() {
+                    for (uint32_t i = thread; i < charactersCount; i += threadsCount) {
+                        animators[i].update(elapsedTime);
+                    }
+                });
+            }
+
+            for (std::thread& thread : threads) {
+                thread.join();
+            }
+        }
+
+        const auto end = std::chrono::high_resolution_clock::now();
+        const double seconds = std::chrono::duration<double>(end - start).count();
+
+        std::cout << charactersCount << " characters x " << jointsCount << " joints, " << threadsCount << " thread(s): "
+                  << seconds / framesCount * 1000.0 << " ms/frame, "
+                  << static_cast<double>(charactersCount) * jointsCount * framesCount / seconds / 1e6 << " M joints/s" << std::endl;
+    };
+
+    benchmark(1);
+
+    const uint32_t threadsCount = std::thread::hardware_concurrency();
+    if (threadsCount > 1) {
+        benchmark(threadsCount);
+    }
+
+    // The characters evaluated by different threads give the same palettes as alone
+    Animator animator(&skeleton);
+    animator.addLayer(&clip);
+    animator.addLayer(&clip, 0.5f);
+    animator.getLayer(0).time = animators[7].getLayer(0).time;
+    animator.getLayer(1).time = animators[7].getLayer(1).time;
+    animator.evaluate();
+
+    for (uint32_t joint = 0; joint < jointsCount; ++joint) {
+        expectNear(animator.getPalette()[joint], animators[7].getPalette()[joint], 1e-4f);
+    }
+}
+
+#endif
+
+} // Animation
+} // Graphics
+} // lug
@@ -0,0 +1,252 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <lug/Graphics/AsyncLoader.hpp>
+
+namespace lug {
+namespace Graphics {
+
+class DummyResource : public Resource {
+public:
+    DummyResource(const std::string& name) : Resource(Resource::Type::Mesh, name) {}
+};
+
+// Blocks the loader threads until released
+class Gate {
+public:
+    void wait() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _condition.wait(lock, [this]() { return _open; });
+    }
+
+    void open() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _open = true;
+        }
+
+        _condition.notify_all();
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    bool _open{false};
+};
+
+TEST(AsyncLoader, Complete) {
+    AsyncLoader loader(2);
+    DummyResource resource("resource");
+
+    std::shared_ptr<AsyncLoader::Ticket> ticket = loader.enqueue("resource", 0, {
+        [](AsyncLoader::Ticket& ticket) {
+            ticket.setReadProgress(1.0f);
+            return true;
+        },
+        [&resource](AsyncLoader::Ticket&) {
+            return Resource::SharedPtr<Resource>(&resource);
+        }
+    });
+
+    loader.wait(*ticket);
+
+    EXPECT_EQ(ticket->getStatus(), AsyncLoader::Ticket::Status::Read);
+    EXPECT_FLOAT_EQ(ticket->getProgress(), 0.5f);
+    EXPECT_FALSE(ticket->isDone());
+    EXPECT_EQ(ticket->getResource().get(), nullptr);
+    EXPECT_EQ(loader.getPendingCount(), 1u);
+
+    EXPECT_EQ(loader.integrate(), 1u);
+
+    EXPECT_EQ(ticket->getStatus(), AsyncLoader::Ticket::Status::Completed);
+    EXPECT_FLOAT_EQ(ticket->getProgress(), 1.0f);
+    EXPECT_TRUE(ticket->isDone());
+    EXPECT_EQ(ticket->getResource().get(), &resource);
+    EXPECT_EQ(loader.getPendingCount(), 0u);
+}
+
+TEST(AsyncLoader, Failure) {
+    AsyncLoader loader(1);
+
+    std::shared_ptr<AsyncLoader::Ticket> readFailure = loader.enqueue("readFailure", 0, {
+        [](AsyncLoader::Ticket&) { return false; },
+        [](AsyncLoader::Ticket&) {
+            ADD_FAILURE() << "The build stage must not run after a failed read stage";
+            return Resource::SharedPtr<Resource>(nullptr);
+        }
+    });
+
+    std::shared_ptr<AsyncLoader::Ticket> buildFailure = loader.enqueue("buildFailure", 0, {
+        [](AsyncLoader::Ticket&) { return true; },
+        [](AsyncLoader::Ticket&) { return Resource::SharedPtr<Resource>(nullptr); }
+    });
+
+    loader.wait(*readFailure);
+    loader.wait(*buildFailure);
+
+    EXPECT_EQ(readFailure->getStatus(), AsyncLoader::Ticket::Status::Failed);
+    EXPECT_EQ(loader.integrate(), 1u);
+    EXPECT_EQ(buildFailure->getStatus(), AsyncLoader::Ticket::Status::Failed);
+}
+
+TEST(AsyncLoader, Priorities) {
+    AsyncLoader loader(1);
+    Gate gate;
+
+    std::mutex mutex;
+    std::vector<std::string> readOrder;
+    std::vector<std::string> buildOrder;
+
+    auto createTask = [&](bool blocking) {
+        return AsyncLoader::Task{
+            [&, blocking](AsyncLoader::Ticket& ticket) {
+                if (blocking) {
+                    gate.wait();
+                }
+
+                std::lock_guard<std::mutex> lock(mutex);
+                readOrder.push_back(ticket.getName());
+                return true;
+            },
+            [&](AsyncLoader::Ticket& ticket) {
+                buildOrder.push_back(ticket.getName());
+                return Resource::SharedPtr<Resource>(nullptr);
+            }
+        };
+    };
+
+    // The single loader thread is blocked by the first load while the others are queued
+    std::vector<std::shared_ptr<AsyncLoader::Ticket>> tickets;
+    tickets.push_back(loader.enqueue("blocking", 0, createTask(true)));
+
+    while (tickets[0]->getStatus() == AsyncLoader::Ticket::Status::Queued) {
+        std::this_thread::yield();
+    }
+
+    tickets.push_back(loader.enqueue("low", -1, createTask(false)));
+    tickets.push_back(loader.enqueue("normal1", 0, createTask(false)));
+    tickets.push_back(loader.enqueue("high", 10, createTask(false)));
+    tickets.push_back(loader.enqueue("normal2", 0, createTask(false)));
+
+    gate.open();
+
+    for (const auto& ticket : tickets) {
+        loader.wait(*ticket);
+    }
+
+    ASSERT_EQ(readOrder.size(), 5u);
+    EXPECT_EQ(readOrder[0], "blocking");
+    EXPECT_EQ(readOrder[1], "high");
+    EXPECT_EQ(readOrder[2], "normal1");
+    EXPECT_EQ(readOrder[3], "normal2");
+    EXPECT_EQ(readOrder[4], "low");
+
+    // Integration follows the priorities too, and can be limited
+    EXPECT_EQ(loader.integrate(2), 2u);
+    EXPECT_EQ(loader.integrate(), 3u);
+
+    ASSERT_EQ(buildOrder.size(), 5u);
+    EXPECT_EQ(buildOrder[0], "high");
+    EXPECT_EQ(buildOrder[1], "blocking");
+    EXPECT_EQ(buildOrder[2], "normal1");
+    EXPECT_EQ(buildOrder[3], "normal2");
+    EXPECT_EQ(buildOrder[4], "low");
+}
+
+TEST(AsyncLoader, Cancel) {
+    AsyncLoader loader(1);
+    Gate gate;
+
+    std::atomic<uint32_t> readCount{0};
+    uint32_t buildCount{0};
+
+    auto createTask = [&](bool blocking) {
+        return AsyncLoader::Task{
+            [&, blocking](AsyncLoader::Ticket&) {
+                if (blocking) {
+                    gate.wait();
+                }
+
+                ++readCount;
+                return true;
+            },
+            [&](AsyncLoader::Ticket&) {
+                ++buildCount;
+                return Resource::SharedPtr<Resource>(nullptr);
+            }
+        };
+    };
+
+    std::shared_ptr<AsyncLoader::Ticket> reading = loader.enqueue("reading", 0, createTask(true));
+
+    while (reading->getStatus() == AsyncLoader::Ticket::Status::Queued) {
+        std::this_thread::yield();
+    }
+
+    std::shared_ptr<AsyncLoader::Ticket> queued = loader.enqueue("queued", 0, createTask(false));
+    std::shared_ptr<AsyncLoader::Ticket> read = loader.enqueue("read", -1, createTask(false));
+
+    // Cancelled before its read stage
+    queued->cancel();
+    EXPECT_TRUE(queued->isCancelRequested());
+
+    gate.open();
+
+    loader.wait(*reading);
+    loader.wait(*queued);
+    loader.wait(*read);
+
+    // Cancelled before its build stage
+    read->cancel();
+
+    EXPECT_EQ(loader.integrate(), 1u);
+
+    EXPECT_EQ(reading->getStatus(), AsyncLoader::Ticket::Status::Failed);
+    EXPECT_EQ(queued->getStatus(), AsyncLoader::Ticket::Status::Cancelled);
+    EXPECT_EQ(read->getStatus(), AsyncLoader::Ticket::Status::Cancelled);
+    EXPECT_TRUE(queued->isDone());
+    EXPECT_TRUE(read->isDone());
+
+    EXPECT_EQ(readCount.load(), 2u);
+    EXPECT_EQ(buildCount, 1u);
+    EXPECT_EQ(loader.getPendingCount(), 0u);
+}
+
+TEST(AsyncLoader, Destruction) {
+    Gate gate;
+    std::shared_ptr<AsyncLoader::Ticket> reading;
+    std::shared_ptr<AsyncLoader::Ticket> queued;
+
+    {
+        AsyncLoader loader(1);
+
+        reading = loader.enqueue("reading", 0, {
+            [&gate](AsyncLoader::Ticket&) {
+                gate.wait();
+                return true;
+            },
+            nullptr
+        });
+
+        queued = loader.enqueue("queued", 0, {nullptr, nullptr});
+
+        // Let the loader thread pick the first load
+        while (reading->getStatus() == AsyncLoader::Ticket::Status::Queued) {
+            std::this_thread::yield();
+        }
+
+        gate.open();
+    }
+
+    EXPECT_EQ(reading->getStatus(), AsyncLoader::Ticket::Status::Cancelled);
+    EXPECT_EQ(queued->getStatus(), AsyncLoader::Ticket::Status::Cancelled);
+}
+
+} // Graphics
+} // lug
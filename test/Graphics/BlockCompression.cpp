@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <vector>
+
+#include <lug/Graphics/Render/BlockCompression.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+
+static std::vector<uint8_t> createGradient(uint32_t width, uint32_t height) {
+    std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x) {
+            uint8_t* pixel = &pixels[(static_cast<size_t>(y) * width + x) * 4];
+
+            pixel[0] = static_cast<uint8_t>(x * 255 / (width - 1));
+            pixel[1] = static_cast<uint8_t>(y * 255 / (height - 1));
+            pixel[2] = static_cast<uint8_t>(128 + x * 64 / (width - 1));
+            pixel[3] = static_cast<uint8_t>(255 - y * 255 / (height - 1));
+        }
+    }
+
+    return pixels;
+}
+
+static std::vector<uint8_t> roundTrip(BlockCompression::Format format, const std::vector<uint8_t>& pixels, uint32_t width, uint32_t height) {
+    std::vector<uint8_t> blocks(BlockCompression::getCompressedSize(format, width, height));
+    std::vector<uint8_t> decoded(pixels.size());
+
+    BlockCompression::encode(format, pixels.data(), width, height, blocks.data());
+    BlockCompression::decode(format, blocks.data(), width, height, decoded.data());
+
+    return decoded;
+}
+
+static int getMaxError(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, uint32_t channel) {
+    int maxError = 0;
+
+    for (size_t i = channel; i < a.size(); i += 4) {
+        maxError = std::max(maxError, std::abs(a[i] - b[i]));
+    }
+
+    return maxError;
+}
+
+TEST(BlockCompression, Sizes) {
+    EXPECT_EQ(BlockCompression::getBlockSize(BlockCompression::Format::BC1), 8u);
+    EXPECT_EQ(BlockCompression::getBlockSize(BlockCompression::Format::BC2), 16u);
+    EXPECT_EQ(BlockCompression::getBlockSize(BlockCompression::Format::BC3), 16u);
+    EXPECT_EQ(BlockCompression::getBlockSize(BlockCompression::Format::BC4), 8u);
+    EXPECT_EQ(BlockCompression::getBlockSize(BlockCompression::Format::BC5), 16u);
+
+    EXPECT_EQ(BlockCompression::getCompressedSize(BlockCompression::Format::BC1, 1, 1), 8u);
+    EXPECT_EQ(BlockCompression::getCompressedSize(BlockCompression::Format::BC1, 5, 4), 16u);
+    EXPECT_EQ(BlockCompression::getCompressedSize(BlockCompression::Format::BC3, 256, 128), 64u * 32u * 16u);
+}
+
+TEST(BlockCompression, SolidColor) {
+    // Colors which are exactly representable in 565
+    const std::vector<uint8_t> pixels = [] {
+        std::vector<uint8_t> solid(8 * 8 * 4);
+        for (size_t i = 0; i < solid.size(); i += 4) {
+            solid[i + 0] = 255;
+            solid[i + 1] = 0;
+            solid[i + 2] = 255;
+            solid[i + 3] = 255;
+        }
+        return solid;
+    }();
+
+    EXPECT_EQ(roundTrip(BlockCompression::Format::BC1, pixels, 8, 8), pixels);
+    EXPECT_EQ(roundTrip(BlockCompression::Format::BC2, pixels, 8, 8), pixels);
+    EXPECT_EQ(roundTrip(BlockCompression::Format::BC3, pixels, 8, 8), pixels);
+}
+
+TEST(BlockCompression, Gradient) {
+    std::vector<uint8_t> pixels = createGradient(64, 64);
+
+    const std::vector<uint8_t> bc3 = roundTrip(BlockCompression::Format::BC3, pixels, 64, 64);
+    EXPECT_LE(getMaxError(pixels, bc3, 3), 4);
+
+    // The texels with an alpha under 128 are transparent black in BC1
+    for (size_t i = 0; i < pixels.size(); i += 4) {
+        pixels[i + 3] = 255;
+    }
+
+    const std::vector<uint8_t> bc1 = roundTrip(BlockCompression::Format::BC1, pixels, 64, 64);
+
+    for (uint32_t channel = 0; channel < 3; ++channel) {
+        EXPECT_LE(getMaxError(pixels, bc1, channel), 12) << "channel " << channel;
+        EXPECT_LE(getMaxError(pixels, bc3, channel), 12) << "channel " << channel;
+    }
+}
+
+TEST(BlockCompression, Alpha) {
+    std::vector<uint8_t> pixels = createGradient(16, 16);
+
+    // BC1 keeps only the texels which are transparent
+    for (size_t i = 0; i < pixels.size(); i += 4) {
+        pixels[i + 3] = (i / 4) % 3 == 0 ? 0 : 255;
+    }
+
+    const std::vector<uint8_t> bc1 = roundTrip(BlockCompression::Format::BC1, pixels, 16, 16);
+    for (size_t i = 0; i < pixels.size(); i += 4) {
+        EXPECT_EQ(bc1[i + 3], pixels[i + 3]) << "texel " << i / 4;
+    }
+
+    // BC2 stores 4 bits of alpha
+    const std::vector<uint8_t> gradient = createGradient(16, 16);
+    EXPECT_LE(getMaxError(gradient, roundTrip(BlockCompression::Format::BC2, gradient, 16, 16), 3), 9);
+}
+
+TEST(BlockCompression, PartialBlocks) {
+    const std::vector<uint8_t> gradient = createGradient(64, 64);
+
+    std::vector<uint8_t> pixels;
+    for (uint32_t y = 0; y < 5; ++y) {
+        pixels.insert(pixels.end(), gradient.begin() + y * 64 * 4, gradient.begin() + (y * 64 + 7) * 4);
+    }
+
+    const std::vector<uint8_t> bc3 = roundTrip(BlockCompression::Format::BC3, pixels, 7, 5);
+
+    ASSERT_EQ(bc3.size(), pixels.size());
+    for (uint32_t channel = 0; channel < 4; ++channel) {
+        EXPECT_LE(getMaxError(pixels, bc3, channel), 12) << "channel " << channel;
+    }
+}
+
+TEST(BlockCompression, Channels) {
+    const std::vector<uint8_t> pixels = createGradient(32, 32);
+
+    const std::vector<uint8_t> bc4 = roundTrip(BlockCompression::Format::BC4, pixels, 32, 32);
+    const std::vector<uint8_t> bc5 = roundTrip(BlockCompression::Format::BC5, pixels, 32, 32);
+
+    EXPECT_LE(getMaxError(pixels, bc4, 0), 4);
+    EXPECT_LE(getMaxError(pixels, bc5, 0), 4);
+    EXPECT_LE(getMaxError(pixels, bc5, 1), 4);
+
+    // The missing channels are decoded as 0, and 1 for the alpha
+    for (size_t i = 0; i < pixels.size(); i += 4) {
+        EXPECT_EQ(bc4[i + 1], 0);
+        EXPECT_EQ(bc4[i + 2], 0);
+        EXPECT_EQ(bc4[i + 3], 255);
+        EXPECT_EQ(bc5[i + 2], 0);
+        EXPECT_EQ(bc5[i + 3], 255);
+    }
+}
+
+TEST(BlockCompression, DecodeBC4) {
+    // Red endpoints 255 and 0 with the 8 values mode, the texel i uses the index i % 8
+    uint8_t block[8] = {255, 0};
+
+    uint64_t indices = 0;
+    for (uint32_t i = 0; i < 16; ++i) {
+        indices |= static_cast<uint64_t>(i % 8) << (i * 3);
+    }
+    for (uint32_t i = 0; i < 6; ++i) {
+        block[2 + i] = static_cast<uint8_t>(indices >> (i * 8));
+    }
+
+    uint8_t pixels[4 * 4 * 4];
+    BlockCompression::decode(BlockCompression::Format::BC4, block, 4, 4, pixels);
+
+    const uint8_t expected[8] = {255, 0, 219, 182, 146, 109, 73, 36};
+    for (uint32_t i = 0; i < 16; ++i) {
+        EXPECT_NEAR(pixels[i * 4], expected[i % 8], 1) << "texel " << i;
+    }
+
+    // With the first endpoint not greater than the second, the indices 6 and 7 are 0 and 255
+    block[0] = 0;
+    block[1] = 255;
+    BlockCompression::decode(BlockCompression::Format::BC4, block, 4, 4, pixels);
+
+    EXPECT_EQ(pixels[6 * 4], 0);
+    EXPECT_EQ(pixels[7 * 4], 255);
+}
+
+} // Render
+} // Graphics
+} // lug
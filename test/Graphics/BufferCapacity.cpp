@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <lug/Graphics/Render/BufferCapacity.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+
+// Sizes of the vertex and index data of an UI session, one per frame
+static std::vector<size_t> getUiWorkload() {
+    std::vector<size_t> sizes;
+
+    // Idle, with the text of the frame counters changing
+    for (size_t i = 0; i < 300; ++i) {
+        sizes.push_back(40000 + (i % 7) * 100);
+    }
+
+    // Typing in a text field
+    for (size_t i = 0; i < 300; ++i) {
+        sizes.push_back(40600 + i * 100);
+    }
+
+    // Expanding and collapsing a tree node
+    for (size_t i = 0; i < 300; ++i) {
+        sizes.push_back((i / 10) % 2 ? 90000 : 70600);
+    }
+
+    // Closing the windows
+    for (size_t i = 0; i < 1200; ++i) {
+        sizes.push_back(20000 + (i % 3) * 100);
+    }
+
+    return sizes;
+}
+
+TEST(BufferCapacity, Growth) {
+    BufferCapacity capacity(1024, 256, 2.0f, 10);
+
+    EXPECT_EQ(capacity.getCapacity(), 0u);
+    EXPECT_FALSE(capacity.update(0));
+
+    EXPECT_TRUE(capacity.update(10));
+    EXPECT_EQ(capacity.getCapacity(), 1024u);
+
+    EXPECT_FALSE(capacity.update(1024));
+
+    EXPECT_TRUE(capacity.update(1025));
+    EXPECT_EQ(capacity.getCapacity(), 2048u);
+
+    // A larger size than the growth is aligned
+    EXPECT_TRUE(capacity.update(5000));
+    EXPECT_EQ(capacity.getCapacity(), 5120u);
+
+    capacity.grow(10);
+    EXPECT_EQ(capacity.getCapacity(), 10240u);
+
+    EXPECT_EQ(capacity.getReallocationsCount(), 4u);
+}
+
+TEST(BufferCapacity, SlowGrowth) {
+    BufferCapacity capacity(1024, 1, 2.0f, 10);
+
+    for (size_t size = 1; size <= 1024 * 1024; size += 64) {
+        capacity.update(size);
+    }
+
+    EXPECT_EQ(capacity.getCapacity(), 1024u * 1024u);
+    EXPECT_EQ(capacity.getReallocationsCount(), 11u);
+}
+
+TEST(BufferCapacity, Shrink) {
+    BufferCapacity capacity(1024, 1, 2.0f, 10);
+
+    EXPECT_TRUE(capacity.update(8192));
+
+    // Not low enough to shrink
+    for (uint32_t i = 0; i < 100; ++i) {
+        EXPECT_FALSE(capacity.update(2049));
+    }
+
+    // Low for one frame less than the delay
+    for (uint32_t i = 0; i < 9; ++i) {
+        EXPECT_FALSE(capacity.update(i % 2 ? 1500 : 1000));
+    }
+
+    // A frame needing more resets the delay
+    EXPECT_FALSE(capacity.update(4000));
+
+    for (uint32_t i = 0; i < 9; ++i) {
+        EXPECT_FALSE(capacity.update(i % 2 ? 1500 : 1000));
+    }
+    EXPECT_EQ(capacity.getCapacity(), 8192u);
+
+    // Shrink to fit the largest of the low frames
+    EXPECT_TRUE(capacity.update(1000));
+    EXPECT_EQ(capacity.getCapacity(), 3000u);
+
+    // Never below the minimum
+    for (uint32_t i = 0; i < 100; ++i) {
+        capacity.update(1);
+    }
+    EXPECT_EQ(capacity.getCapacity(), 1024u);
+
+    EXPECT_EQ(capacity.getReallocationsCount(), 3u);
+}
+
+TEST(BufferCapacity, Oscillation) {
+    BufferCapacity capacity(0, 1, 2.0f, 10);
+
+    EXPECT_TRUE(capacity.update(10000));
+
+    for (uint32_t i = 0; i < 1000; ++i) {
+        capacity.update(i % 2 ? 10000 : 3000);
+    }
+
+    EXPECT_EQ(capacity.getCapacity(), 10000u);
+    EXPECT_EQ(capacity.getReallocationsCount(), 1u);
+}
+
+TEST(BufferCapacity, UiWorkload) {
+    const std::vector<size_t> sizes = getUiWorkload();
+
+    BufferCapacity capacity(16 * 1024, 256, 2.0f, 300);
+
+    // Reallocate the buffer with the exact size needed each time it is too small
+    size_t exactCapacity = 0;
+    uint32_t exactReallocationsCount = 0;
+
+    for (const size_t size : sizes) {
+        capacity.update(size);
+        EXPECT_GE(capacity.getCapacity(), size);
+
+        if (size > exactCapacity) {
+            exactCapacity = size;
+            ++exactReallocationsCount;
+        }
+    }
+
+    // The first allocation, one growth while idle, one when the tree node is expanded
+    // and one shrink once the windows are closed
+    EXPECT_EQ(capacity.getReallocationsCount(), 4u);
+    EXPECT_EQ(capacity.getCapacity(), 40448u);
+
+    EXPECT_GT(exactReallocationsCount, 300u);
+}
+
+} // Render
+} // Graphics
+} // lug
@@ -0,0 +1,379 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+#include <lug/Graphics/Render/Ibl.hpp>
+#include <lug/Graphics/Render/Ktx2.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+
+static const float pi = 3.14159265358979f;
+
+static Ibl::CubeMap createCubeMap(uint32_t size, const std::function<Math::Vec3f(const Math::Vec3f&)>& radiance) {
+    Ibl::CubeMap cubeMap;
+    cubeMap.size = size;
+
+    for (uint32_t face = 0; face < 6; ++face) {
+        for (uint32_t y = 0; y < size; ++y) {
+            for (uint32_t x = 0; x < size; ++x) {
+                cubeMap.faces[face].push_back(radiance(Ibl::getDirection(face, (x + 0.5f) / size, (y + 0.5f) / size)));
+            }
+        }
+    }
+
+    return cubeMap;
+}
+
+// Solid angle weighted average of the texels
+static Math::Vec3f getAverage(const Ibl::CubeMap& cubeMap) {
+    Math::Vec3f sum{0.0f, 0.0f, 0.0f};
+    float weights = 0.0f;
+
+    for (uint32_t face = 0; face < 6; ++face) {
+        for (uint32_t y = 0; y < cubeMap.size; ++y) {
+            for (uint32_t x = 0; x < cubeMap.size; ++x) {
+                // The solid angle of a texel is proportional to cos^3 of its angle with the axis of the face
+                const float u = 2.0f * (x + 0.5f) / cubeMap.size - 1.0f;
+                const float v = 2.0f * (y + 0.5f) / cubeMap.size - 1.0f;
+                const float weight = std::pow(1.0f + u * u + v * v, -1.5f);
+
+                for (uint8_t i = 0; i < 3; ++i) {
+                    sum(i) += cubeMap.faces[face][y * cubeMap.size + x](i) * weight;
+                }
+
+                weights += weight;
+            }
+        }
+    }
+
+    return {sum.x() / weights, sum.y() / weights, sum.z() / weights};
+}
+
+// Reference of the irradiance divided by pi, by integration over all the texels
+static Math::Vec3f integrateIrradiance(const Ibl::CubeMap& environment, const Math::Vec3f& normal) {
+    Math::Vec3f sum{0.0f, 0.0f, 0.0f};
+    const float texelSize = 2.0f / environment.size;
+
+    for (uint32_t face = 0; face < 6; ++face) {
+        for (uint32_t y = 0; y < environment.size; ++y) {
+            for (uint32_t x = 0; x < environment.size; ++x) {
+                const float u = (x + 0.5f) * texelSize - 1.0f;
+                const float v = (y + 0.5f) * texelSize - 1.0f;
+                const float solidAngle = texelSize * texelSize * std::pow(1.0f + u * u + v * v, -1.5f);
+
+                const Math::Vec3f direction = Ibl::getDirection(face, (x + 0.5f) / environment.size, (y + 0.5f) / environment.size);
+                const float cosine = std::max(Math::dot(direction, normal), 0.0f);
+
+                for (uint8_t i = 0; i < 3; ++i) {
+                    sum(i) += environment.faces[face][y * environment.size + x](i) * cosine * solidAngle / pi;
+                }
+            }
+        }
+    }
+
+    return sum;
+}
+
+// Reference of integrateBrdf, by quadrature over the hemisphere of the light directions
+static Math::Vec2f integrateBrdfQuadrature(float NdotV, float roughness) {
+    const uint32_t thetaSteps = 1024;
+    const uint32_t phiSteps = 512;
+
+    const double alpha2 = std::pow(roughness, 4.0);
+    const double k = roughness * roughness * 0.5;
+    const double vx = std::sqrt(1.0 - NdotV * NdotV);
+    const double vz = NdotV;
+
+    const double dTheta = 0.5 * pi / thetaSteps;
+    const double dPhi = pi / phiSteps;
+
+    double scale = 0.0;
+    double bias = 0.0;
+
+    for (uint32_t i = 0; i < thetaSteps; ++i) {
+        const double theta = (i + 0.5) * dTheta;
+
+        for (uint32_t j = 0; j < phiSteps; ++j) {
+            const double phi = (j + 0.5) * dPhi;
+
+            const double lx = std::sin(theta) * std::cos(phi);
+            const double ly = std::sin(theta) * std::sin(phi);
+            const double lz = std::cos(theta);
+
+            double hx = vx + lx;
+            double hy = ly;
+            double hz = vz + lz;
+            const double length = std::sqrt(hx * hx + hy * hy + hz * hz);
+            hx /= length;
+            hy /= length;
+            hz /= length;
+
+            const double VdotH = vx * hx + vz * hz;
+            const double denominator = hz * hz * (alpha2 - 1.0) + 1.0;
+            const double d = alpha2 / (pi * denominator * denominator);
+            const double g = NdotV / (NdotV * (1.0 - k) + k) * lz / (lz * (1.0 - k) + k);
+            const double fresnel = std::pow(1.0 - VdotH, 5.0);
+
+            // BRDF * NdotL, the phi in [pi, 2pi] are symmetric
+            const double brdf = d * g / (4.0 * NdotV) * 2.0 * std::sin(theta) * dTheta * dPhi;
+
+            scale += brdf * (1.0 - fresnel);
+            bias += brdf * fresnel;
+        }
+    }
+
+    return {static_cast<float>(scale), static_cast<float>(bias)};
+}
+
+static float fromHalf(const uint8_t* data) {
+    const uint32_t half = data[0] | (data[1] << 8);
+    const float mantissa = static_cast<float>(half & 0x3FF);
+    const int32_t exponent = (half >> 10) & 0x1F;
+
+    const float value = exponent == 0 ? std::ldexp(mantissa, -24) : std::ldexp(mantissa + 1024.0f, exponent - 25);
+
+    return half & 0x8000 ? -value : value;
+}
+
+TEST(Ibl, Directions) {
+    EXPECT_FLOAT_EQ(Ibl::getDirection(0, 0.5f, 0.5f).x(), 1.0f);
+    EXPECT_FLOAT_EQ(Ibl::getDirection(1, 0.5f, 0.5f).x(), -1.0f);
+    EXPECT_FLOAT_EQ(Ibl::getDirection(2, 0.5f, 0.5f).y(), 1.0f);
+    EXPECT_FLOAT_EQ(Ibl::getDirection(3, 0.5f, 0.5f).y(), -1.0f);
+    EXPECT_FLOAT_EQ(Ibl::getDirection(4, 0.5f, 0.5f).z(), 1.0f);
+    EXPECT_FLOAT_EQ(Ibl::getDirection(5, 0.5f, 0.5f).z(), -1.0f);
+
+    // The top of the side faces is +Y
+    EXPECT_GT(Ibl::getDirection(0, 0.5f, 0.0f).y(), 0.0f);
+    EXPECT_GT(Ibl::getDirection(4, 0.5f, 0.0f).y(), 0.0f);
+
+    // Sampling the direction of a texel returns the texel
+    const Ibl::CubeMap cubeMap = createCubeMap(8, [](const Math::Vec3f& direction) { return direction; });
+
+    for (uint32_t face = 0; face < 6; ++face) {
+        for (uint32_t i = 0; i < 64; ++i) {
+            const Math::Vec3f& texel = cubeMap.faces[face][i];
+            const Math::Vec3f sample = Ibl::sample(cubeMap, texel);
+
+            EXPECT_NEAR(sample.x(), texel.x(), 1e-5f) << "face " << face << " texel " << i;
+            EXPECT_NEAR(sample.y(), texel.y(), 1e-5f) << "face " << face << " texel " << i;
+            EXPECT_NEAR(sample.z(), texel.z(), 1e-5f) << "face " << face << " texel " << i;
+        }
+    }
+}
+
+TEST(Ibl, IrradianceConstant) {
+    const Ibl::SphericalHarmonics irradiance = Ibl::computeIrradiance(createCubeMap(16, [](const Math::Vec3f&) {
+        return Math::Vec3f{0.5f, 1.0f, 2.0f};
+    }));
+
+    const Ibl::CubeMap irradianceMap = Ibl::createIrradianceMap(irradiance, 4);
+
+    for (const auto& face : irradianceMap.faces) {
+        for (const auto& texel : face) {
+            EXPECT_NEAR(texel.x(), 0.5f, 1e-4f);
+            EXPECT_NEAR(texel.y(), 1.0f, 1e-4f);
+            EXPECT_NEAR(texel.z(), 2.0f, 1e-4f);
+        }
+    }
+}
+
+TEST(Ibl, IrradianceLinear) {
+    // The harmonics of the first two bands are exact, the irradiance of a radiance 1 + z is 1 + 2/3 z
+    const Ibl::SphericalHarmonics irradiance = Ibl::computeIrradiance(createCubeMap(32, [](const Math::Vec3f& direction) {
+        return Math::Vec3f{1.0f + direction.z(), 1.0f + direction.x(), 1.0f - direction.y()};
+    }));
+
+    for (uint32_t face = 0; face < 6; ++face) {
+        for (float u : {0.1f, 0.5f, 0.8f}) {
+            const Math::Vec3f normal = Ibl::getDirection(face, u, 1.0f - u);
+            const Math::Vec3f result = Ibl::getIrradiance(irradiance, normal);
+
+            EXPECT_NEAR(result.x(), 1.0f + 2.0f / 3.0f * normal.z(), 2e-3f);
+            EXPECT_NEAR(result.y(), 1.0f + 2.0f / 3.0f * normal.x(), 2e-3f);
+            EXPECT_NEAR(result.z(), 1.0f - 2.0f / 3.0f * normal.y(), 2e-3f);
+        }
+    }
+}
+
+TEST(Ibl, IrradianceSky) {
+    // A bright sky over a dark ground, the harmonics approximate the clamped cosine within a few percents
+    const Ibl::CubeMap environment = createCubeMap(32, [](const Math::Vec3f& direction) {
+        const float sky = std::max(direction.y(), 0.0f);
+        return Math::Vec3f{0.1f + sky, 0.1f + 2.0f * sky * sky, 0.2f};
+    });
+
+    const Ibl::SphericalHarmonics irradiance = Ibl::computeIrradiance(environment);
+
+    for (uint32_t face = 0; face < 6; ++face) {
+        for (float u : {0.2f, 0.5f, 0.9f}) {
+            const Math::Vec3f normal = Ibl::getDirection(face, u, u);
+
+            const Math::Vec3f expected = integrateIrradiance(environment, normal);
+            const Math::Vec3f result = Ibl::getIrradiance(irradiance, normal);
+
+            for (uint8_t i = 0; i < 3; ++i) {
+                EXPECT_NEAR(result(i), expected(i), 0.05f * std::max(expected(i), 0.2f)) << "face " << face << " channel " << static_cast<int>(i);
+            }
+        }
+    }
+}
+
+TEST(Ibl, PrefilterConstant) {
+    const Ibl::CubeMap environment = createCubeMap(32, [](const Math::Vec3f&) {
+        return Math::Vec3f{0.25f, 1.0f, 4.0f};
+    });
+
+    const std::vector<Ibl::CubeMap> levels = Ibl::prefilter(environment, 5, 64);
+    ASSERT_EQ(levels.size(), 5u);
+
+    for (uint32_t level = 0; level < levels.size(); ++level) {
+        EXPECT_EQ(levels[level].size, 32u >> level);
+
+        for (const auto& face : levels[level].faces) {
+            ASSERT_EQ(face.size(), levels[level].size * levels[level].size);
+
+            for (const auto& texel : face) {
+                EXPECT_NEAR(texel.x(), 0.25f, 1e-4f);
+                EXPECT_NEAR(texel.y(), 1.0f, 1e-4f);
+                EXPECT_NEAR(texel.z(), 4.0f, 1e-3f);
+            }
+        }
+    }
+
+    // The levels are limited by the size of the environment
+    EXPECT_EQ(Ibl::prefilter(environment, 10, 16).size(), 6u);
+}
+
+TEST(Ibl, PrefilterEnergy) {
+    const Ibl::CubeMap environment = createCubeMap(32, [](const Math::Vec3f& direction) {
+        return Math::Vec3f{1.0f + direction.x(), 0.1f + std::pow(std::max(direction.y(), 0.0f), 8.0f), 1.0f};
+    });
+
+    const Math::Vec3f average = getAverage(environment);
+    const std::vector<Ibl::CubeMap> levels = Ibl::prefilter(environment, 6, 256);
+
+    // The average of the smallest levels is estimated from too few texels
+    for (uint32_t level = 1; levels[level].size >= 4; ++level) {
+        const Math::Vec3f levelAverage = getAverage(levels[level]);
+
+        for (uint8_t i = 0; i < 3; ++i) {
+            EXPECT_NEAR(levelAverage(i), average(i), 0.03f * average(i)) << "level " << level << " channel " << static_cast<int>(i);
+        }
+    }
+
+    // The rough levels blur the bright spot of the top
+    const Math::Vec3f up{0.0f, 1.0f, 0.0f};
+    EXPECT_GT(Ibl::sample(levels[1], up).y(), Ibl::sample(levels[5], up).y());
+    EXPECT_LT(Ibl::sample(levels[5], up).y(), 1.1f * 0.5f);
+}
+
+TEST(Ibl, Brdf) {
+    // A smooth surface reflects all the light, only the fresnel of F0 remains
+    const Math::Vec2f smooth = Ibl::integrateBrdf(1.0f, 0.0f, 16);
+    EXPECT_NEAR(smooth.x(), 1.0f, 1e-5f);
+    EXPECT_NEAR(smooth.y(), 0.0f, 1e-5f);
+
+    for (float roughness : {0.3f, 0.5f, 0.8f, 1.0f}) {
+        for (float NdotV : {0.2f, 0.5f, 0.9f}) {
+            const Math::Vec2f expected = integrateBrdfQuadrature(NdotV, roughness);
+            const Math::Vec2f result = Ibl::integrateBrdf(NdotV, roughness, 1024);
+
+            EXPECT_NEAR(result.x(), expected.x(), 0.01f) << "roughness " << roughness << " NdotV " << NdotV;
+            EXPECT_NEAR(result.y(), expected.y(), 0.01f) << "roughness " << roughness << " NdotV " << NdotV;
+
+            // The BRDF doesn't create energy
+            EXPECT_LE(result.x() + result.y(), 1.0f + 1e-3f);
+        }
+    }
+}
+
+TEST(Ibl, BrdfLut) {
+    const std::vector<Math::Vec2f> lut = Ibl::createBrdfLut(8, 32);
+    ASSERT_EQ(lut.size(), 64u);
+
+    const Math::Vec2f texel = Ibl::integrateBrdf(5.5f / 8.0f, 2.5f / 8.0f, 32);
+    EXPECT_FLOAT_EQ(lut[2 * 8 + 5].x(), texel.x());
+    EXPECT_FLOAT_EQ(lut[2 * 8 + 5].y(), texel.y());
+}
+
+TEST(Ibl, Write) {
+    const Ibl::CubeMap environment = createCubeMap(8, [](const Math::Vec3f&) {
+        return Math::Vec3f{0.5f, 2.0f, 100000.0f};
+    });
+
+    std::vector<Ibl::CubeMap> levels{environment, Ibl::downsample(environment)};
+
+    std::vector<uint8_t> file;
+    ASSERT_TRUE(Ibl::writeCubeMap(levels, file));
+
+    Ktx2::Image image;
+    ASSERT_EQ(Ktx2::read(file.data(), file.size(), image), Ktx2::Result::Success);
+
+    EXPECT_EQ(image.format, Ktx2::Format::R16G16B16A16Sfloat);
+    EXPECT_EQ(image.width, 8u);
+    EXPECT_EQ(image.facesCount, 6u);
+    ASSERT_EQ(image.levels.size(), 2u);
+    EXPECT_EQ(image.levels[1].size, 4u * 4u * 6u * 8u);
+
+    // The values out of the range of the halves are clamped
+    const uint8_t* texel = file.data() + image.levels[1].offset;
+    EXPECT_EQ(fromHalf(texel), 0.5f);
+    EXPECT_EQ(fromHalf(texel + 2), 2.0f);
+    EXPECT_EQ(fromHalf(texel + 4), 65504.0f);
+    EXPECT_EQ(fromHalf(texel + 6), 1.0f);
+
+    // The levels must be a mip chain
+    levels.push_back(levels.back());
+    EXPECT_FALSE(Ibl::writeCubeMap(levels, file));
+
+    const std::vector<Math::Vec2f> lut = Ibl::createBrdfLut(4, 16);
+    ASSERT_TRUE(Ibl::writeBrdfLut(lut, 4, file));
+    ASSERT_EQ(Ktx2::read(file.data(), file.size(), image), Ktx2::Result::Success);
+
+    EXPECT_EQ(image.format, Ktx2::Format::R16G16Sfloat);
+    EXPECT_EQ(image.facesCount, 1u);
+    ASSERT_EQ(image.levels.size(), 1u);
+    EXPECT_NEAR(fromHalf(file.data() + image.levels[0].offset + 4 * 5), lut[5].x(), 1e-3f);
+
+    EXPECT_FALSE(Ibl::writeBrdfLut(lut, 5, file));
+}
+
+#if defined(ENABLE_LONG_TESTS)
+
+TEST(Ibl, Timing) {
+    const Ibl::CubeMap environment = createCubeMap(128, [](const Math::Vec3f& direction) {
+        return Math::Vec3f{1.0f + direction.x(), std::pow(std::max(direction.y(), 0.0f), 16.0f), 0.5f};
+    });
+
+    const auto start = std::chrono::high_resolution_clock::now();
+    const Ibl::CubeMap irradianceMap = Ibl::createIrradianceMap(Ibl::computeIrradiance(environment), 32);
+    const auto irradianceEnd = std::chrono::high_resolution_clock::now();
+    const std::vector<Ibl::CubeMap> specularMap = Ibl::prefilter(environment, 6, 256);
+    const auto specularEnd = std::chrono::high_resolution_clock::now();
+    const std::vector<Math::Vec2f> brdfLut = Ibl::createBrdfLut(128, 512);
+    const auto brdfLutEnd = std::chrono::high_resolution_clock::now();
+
+    std::cout << "Irradiance: " << std::chrono::duration<double, std::milli>(irradianceEnd - start).count() << " ms" << std::endl;
+    std::cout << "Specular: " << std::chrono::duration<double, std::milli>(specularEnd - irradianceEnd).count() << " ms" << std::endl;
+    std::cout << "BRDF LUT: " << std::chrono::duration<double, std::milli>(brdfLutEnd - specularEnd).count() << " ms" << std::endl;
+
+    EXPECT_EQ(irradianceMap.size, 32u);
+    EXPECT_EQ(specularMap.size(), 6u);
+    EXPECT_EQ(brdfLut.size(), 128u * 128u);
+
+    // The environment of a skybox is generated when the application starts
+    EXPECT_LT(std::chrono::duration<double>(brdfLutEnd - start).count(), 10.0);
+}
+
+#endif
+
+} // Render
+} // Graphics
+} // lug
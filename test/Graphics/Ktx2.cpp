@@ -0,0 +1,243 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <lug/Graphics/Render/Ktx2.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+
+static std::vector<std::vector<uint8_t>> createLevels(const Ktx2::FormatInfo& info, uint32_t width, uint32_t height, uint32_t levelsCount) {
+    std::vector<std::vector<uint8_t>> levels(levelsCount);
+
+    for (uint32_t i = 0; i < levelsCount; ++i) {
+        levels[i].resize(Ktx2::getImageSize(info, std::max(width >> i, 1u), std::max(height >> i, 1u)));
+
+        for (size_t j = 0; j < levels[i].size(); ++j) {
+            levels[i][j] = static_cast<uint8_t>(i * 31 + j);
+        }
+    }
+
+    return levels;
+}
+
+static void writeU32(std::vector<uint8_t>& file, size_t offset, uint32_t value) {
+    for (uint32_t i = 0; i < 4; ++i) {
+        file[offset + i] = static_cast<uint8_t>(value >> (i * 8));
+    }
+}
+
+TEST(Ktx2, FormatInfo) {
+    Ktx2::FormatInfo info;
+
+    ASSERT_TRUE(Ktx2::getFormatInfo(Ktx2::Format::BC1RgbaSrgb, info));
+    EXPECT_EQ(info.blockWidth, 4u);
+    EXPECT_EQ(info.blockSize, 8u);
+    EXPECT_TRUE(info.srgb);
+
+    ASSERT_TRUE(Ktx2::getFormatInfo(Ktx2::Format::BC7Unorm, info));
+    EXPECT_EQ(info.blockSize, 16u);
+    EXPECT_FALSE(info.srgb);
+
+    // VK_FORMAT_ASTC_6x5_SRGB_BLOCK
+    ASSERT_TRUE(Ktx2::getFormatInfo(static_cast<Ktx2::Format>(164), info));
+    EXPECT_EQ(info.blockWidth, 6u);
+    EXPECT_EQ(info.blockHeight, 5u);
+    EXPECT_TRUE(info.srgb);
+
+    // VK_FORMAT_R32G32B32A32_SFLOAT
+    EXPECT_FALSE(Ktx2::getFormatInfo(static_cast<Ktx2::Format>(109), info));
+
+    EXPECT_EQ(Ktx2::getImageSize(info, 13, 11), 3u * 3u * 16u);
+}
+
+TEST(Ktx2, SrgbFormat) {
+    EXPECT_EQ(Ktx2::getSrgbFormat(Ktx2::Format::R8G8B8A8Unorm), Ktx2::Format::R8G8B8A8Srgb);
+    EXPECT_EQ(Ktx2::getSrgbFormat(Ktx2::Format::BC1RgbaUnorm), Ktx2::Format::BC1RgbaSrgb);
+    EXPECT_EQ(Ktx2::getSrgbFormat(Ktx2::Format::BC3Srgb), Ktx2::Format::BC3Srgb);
+    EXPECT_EQ(Ktx2::getSrgbFormat(Ktx2::Format::BC7Unorm), Ktx2::Format::BC7Srgb);
+    EXPECT_EQ(Ktx2::getSrgbFormat(Ktx2::Format::ETC2R8G8B8Unorm), static_cast<Ktx2::Format>(148));
+    EXPECT_EQ(Ktx2::getSrgbFormat(Ktx2::Format::ASTC4x4Unorm), static_cast<Ktx2::Format>(158));
+
+    // The formats which aren't colors don't have an sRGB variant
+    EXPECT_EQ(Ktx2::getSrgbFormat(Ktx2::Format::BC4Unorm), Ktx2::Format::BC4Unorm);
+    EXPECT_EQ(Ktx2::getSrgbFormat(Ktx2::Format::BC5Unorm), Ktx2::Format::BC5Unorm);
+    EXPECT_EQ(Ktx2::getSrgbFormat(static_cast<Ktx2::Format>(153)), static_cast<Ktx2::Format>(153));
+}
+
+TEST(Ktx2, RoundTrip) {
+    Ktx2::FormatInfo info;
+    ASSERT_TRUE(Ktx2::getFormatInfo(Ktx2::Format::BC3Srgb, info));
+
+    const std::vector<std::vector<uint8_t>> levels = createLevels(info, 40, 24, 6);
+
+    std::vector<uint8_t> file;
+    ASSERT_TRUE(Ktx2::write(Ktx2::Format::BC3Srgb, 40, 24, levels, file));
+
+    Ktx2::Image image;
+    ASSERT_EQ(Ktx2::read(file.data(), file.size(), image), Ktx2::Result::Success);
+
+    EXPECT_EQ(image.format, Ktx2::Format::BC3Srgb);
+    EXPECT_EQ(image.width, 40u);
+    EXPECT_EQ(image.height, 24u);
+    EXPECT_EQ(image.layersCount, 1u);
+    EXPECT_EQ(image.facesCount, 1u);
+    EXPECT_FALSE(image.generateMipmaps);
+    EXPECT_EQ(image.supercompressionScheme, Ktx2::SupercompressionScheme::None);
+
+    ASSERT_EQ(image.levels.size(), levels.size());
+    for (size_t i = 0; i < levels.size(); ++i) {
+        ASSERT_EQ(image.levels[i].size, levels[i].size());
+        EXPECT_EQ(image.levels[i].offset % 16, 0u);
+        EXPECT_EQ(std::vector<uint8_t>(file.begin() + image.levels[i].offset, file.begin() + image.levels[i].offset + image.levels[i].size), levels[i]);
+    }
+
+    ASSERT_EQ(image.keyValues.size(), 1u);
+    EXPECT_EQ(image.keyValues[0].first, "KTXwriter");
+    EXPECT_EQ(image.keyValues[0].second, "Lugdunum");
+}
+
+TEST(Ktx2, CubeMap) {
+    Ktx2::FormatInfo info;
+    ASSERT_TRUE(Ktx2::getFormatInfo(Ktx2::Format::R16G16B16A16Sfloat, info));
+    EXPECT_EQ(info.blockSize, 8u);
+
+    std::vector<std::vector<uint8_t>> levels = createLevels(info, 8, 8, 4);
+    for (auto& level : levels) {
+        level.resize(level.size() * 6, 0x3C);
+    }
+
+    std::vector<uint8_t> file;
+    ASSERT_TRUE(Ktx2::write(Ktx2::Format::R16G16B16A16Sfloat, 8, 8, 6, levels, file));
+
+    Ktx2::Image image;
+    ASSERT_EQ(Ktx2::read(file.data(), file.size(), image), Ktx2::Result::Success);
+
+    EXPECT_EQ(image.format, Ktx2::Format::R16G16B16A16Sfloat);
+    EXPECT_EQ(image.facesCount, 6u);
+
+    ASSERT_EQ(image.levels.size(), levels.size());
+    for (size_t i = 0; i < levels.size(); ++i) {
+        ASSERT_EQ(image.levels[i].size, levels[i].size());
+        EXPECT_EQ(std::vector<uint8_t>(file.begin() + image.levels[i].offset, file.begin() + image.levels[i].offset + image.levels[i].size), levels[i]);
+    }
+
+    // The faces of a cube map are square
+    EXPECT_FALSE(Ktx2::write(Ktx2::Format::R16G16B16A16Sfloat, 8, 4, 6, levels, file));
+
+    // Only the cube maps have several faces
+    EXPECT_FALSE(Ktx2::write(Ktx2::Format::R16G16B16A16Sfloat, 8, 8, 2, levels, file));
+}
+
+TEST(Ktx2, WriteInvalid) {
+    Ktx2::FormatInfo info;
+    ASSERT_TRUE(Ktx2::getFormatInfo(Ktx2::Format::BC1RgbUnorm, info));
+
+    std::vector<uint8_t> file;
+    std::vector<std::vector<uint8_t>> levels = createLevels(info, 16, 16, 5);
+
+    // The writer can't describe the BC7 blocks
+    EXPECT_FALSE(Ktx2::write(Ktx2::Format::BC7Unorm, 16, 16, levels, file));
+
+    // Too many levels
+    levels.push_back(levels.back());
+    EXPECT_FALSE(Ktx2::write(Ktx2::Format::BC1RgbUnorm, 16, 16, levels, file));
+
+    // Wrong level size
+    levels.pop_back();
+    levels[2].pop_back();
+    EXPECT_FALSE(Ktx2::write(Ktx2::Format::BC1RgbUnorm, 16, 16, levels, file));
+}
+
+TEST(Ktx2, ReadInvalid) {
+    Ktx2::FormatInfo info;
+    ASSERT_TRUE(Ktx2::getFormatInfo(Ktx2::Format::R8G8B8A8Unorm, info));
+
+    std::vector<uint8_t> file;
+    ASSERT_TRUE(Ktx2::write(Ktx2::Format::R8G8B8A8Unorm, 8, 8, createLevels(info, 8, 8, 4), file));
+
+    Ktx2::Image image;
+
+    {
+        std::vector<uint8_t> invalid = file;
+        invalid[5] = 'X';
+        EXPECT_EQ(Ktx2::read(invalid.data(), invalid.size(), image), Ktx2::Result::InvalidIdentifier);
+    }
+
+    // The first level is stored last
+    EXPECT_EQ(Ktx2::read(file.data(), file.size() - 1, image), Ktx2::Result::Truncated);
+    EXPECT_EQ(Ktx2::read(file.data(), 64, image), Ktx2::Result::Truncated);
+
+    {
+        std::vector<uint8_t> invalid = file;
+        writeU32(invalid, 28, 8); // Depth
+        EXPECT_EQ(Ktx2::read(invalid.data(), invalid.size(), image), Ktx2::Result::UnsupportedDimensions);
+    }
+
+    {
+        std::vector<uint8_t> invalid = file;
+        writeU32(invalid, 36, 2); // Faces count
+        EXPECT_EQ(Ktx2::read(invalid.data(), invalid.size(), image), Ktx2::Result::InvalidHeader);
+    }
+
+    {
+        std::vector<uint8_t> invalid = file;
+        writeU32(invalid, 40, 5); // Levels count
+        EXPECT_EQ(Ktx2::read(invalid.data(), invalid.size(), image), Ktx2::Result::InvalidHeader);
+    }
+
+    {
+        // The offset of the second level overflows
+        std::vector<uint8_t> invalid = file;
+        writeU32(invalid, 80 + 24 + 4, 0xFFFFFFFF);
+        EXPECT_EQ(Ktx2::read(invalid.data(), invalid.size(), image), Ktx2::Result::Truncated);
+    }
+
+    {
+        // The size of the level doesn't match the format
+        std::vector<uint8_t> invalid = file;
+        writeU32(invalid, 80 + 8, 4);
+        EXPECT_EQ(Ktx2::read(invalid.data(), invalid.size(), image), Ktx2::Result::InvalidHeader);
+    }
+}
+
+TEST(Ktx2, Supercompression) {
+    Ktx2::FormatInfo info;
+    ASSERT_TRUE(Ktx2::getFormatInfo(Ktx2::Format::BC1RgbUnorm, info));
+
+    std::vector<uint8_t> file;
+    ASSERT_TRUE(Ktx2::write(Ktx2::Format::BC1RgbUnorm, 16, 16, createLevels(info, 16, 16, 1), file));
+
+    // The levels of a supercompressed file don't have the size of the format
+    writeU32(file, 12, 0);
+    writeU32(file, 44, static_cast<uint32_t>(Ktx2::SupercompressionScheme::Zstandard));
+    writeU32(file, 80 + 8, 42);
+
+    Ktx2::Image image;
+    ASSERT_EQ(Ktx2::read(file.data(), file.size(), image), Ktx2::Result::Success);
+
+    EXPECT_EQ(image.format, Ktx2::Format::Undefined);
+    EXPECT_EQ(image.supercompressionScheme, Ktx2::SupercompressionScheme::Zstandard);
+    EXPECT_EQ(image.levels[0].size, 42u);
+}
+
+TEST(Ktx2, DecodedFormat) {
+    BlockCompression::Format blockFormat;
+    Ktx2::Format decodedFormat;
+
+    ASSERT_TRUE(Ktx2::getDecodedFormat(Ktx2::Format::BC1RgbSrgb, blockFormat, decodedFormat));
+    EXPECT_EQ(blockFormat, BlockCompression::Format::BC1);
+    EXPECT_EQ(decodedFormat, Ktx2::Format::R8G8B8A8Srgb);
+
+    ASSERT_TRUE(Ktx2::getDecodedFormat(Ktx2::Format::BC5Unorm, blockFormat, decodedFormat));
+    EXPECT_EQ(blockFormat, BlockCompression::Format::BC5);
+    EXPECT_EQ(decodedFormat, Ktx2::Format::R8G8B8A8Unorm);
+
+    EXPECT_FALSE(Ktx2::getDecodedFormat(Ktx2::Format::BC7Srgb, blockFormat, decodedFormat));
+    EXPECT_FALSE(Ktx2::getDecodedFormat(Ktx2::Format::ASTC4x4Unorm, blockFormat, decodedFormat));
+}
+
+} // Render
+} // Graphics
+} // lug
@@ -0,0 +1,230 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <lug/Graphics/Render/Mipmap.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+
+static std::vector<uint8_t> createImage(uint32_t width, uint32_t height, uint32_t seed) {
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<uint32_t> distribution(0, 255);
+
+    std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+    for (auto& channel : pixels) {
+        channel = static_cast<uint8_t>(distribution(generator));
+    }
+
+    return pixels;
+}
+
+// Scalar 2x2 box filter, the reference of the vectorized one
+static std::vector<uint8_t> downsampleReference(const std::vector<uint8_t>& src, uint32_t srcWidth, uint32_t srcHeight) {
+    const uint32_t dstWidth = std::max(srcWidth / 2, 1u);
+    const uint32_t dstHeight = std::max(srcHeight / 2, 1u);
+
+    std::vector<uint8_t> dst(static_cast<size_t>(dstWidth) * dstHeight * 4);
+
+    for (uint32_t y = 0; y < dstHeight; ++y) {
+        for (uint32_t x = 0; x < dstWidth; ++x) {
+            for (uint32_t c = 0; c < 4; ++c) {
+                uint32_t sum = 0;
+
+                for (uint32_t dy = 0; dy < 2; ++dy) {
+                    for (uint32_t dx = 0; dx < 2; ++dx) {
+                        const uint32_t srcX = std::min(x * 2 + dx, srcWidth - 1);
+                        const uint32_t srcY = std::min(y * 2 + dy, srcHeight - 1);
+                        sum += src[(static_cast<size_t>(srcY) * srcWidth + srcX) * 4 + c];
+                    }
+                }
+
+                dst[(static_cast<size_t>(y) * dstWidth + x) * 4 + c] = static_cast<uint8_t>((sum + 2) / 4);
+            }
+        }
+    }
+
+    return dst;
+}
+
+TEST(Mipmap, LevelsCount) {
+    EXPECT_EQ(Mipmap::getLevelsCount(1, 1), 1u);
+    EXPECT_EQ(Mipmap::getLevelsCount(2, 1), 2u);
+    EXPECT_EQ(Mipmap::getLevelsCount(256, 256), 9u);
+    EXPECT_EQ(Mipmap::getLevelsCount(300, 200), 9u);
+    EXPECT_EQ(Mipmap::getLevelsCount(1, 7), 3u);
+}
+
+TEST(Mipmap, Levels) {
+    const std::vector<Mipmap::Level> levels = Mipmap::getLevels(8, 2);
+
+    ASSERT_EQ(levels.size(), 4u);
+
+    EXPECT_EQ(levels[0].width, 8u);
+    EXPECT_EQ(levels[0].height, 2u);
+    EXPECT_EQ(levels[0].offset, 0u);
+    EXPECT_EQ(levels[0].size, 64u);
+
+    EXPECT_EQ(levels[1].width, 4u);
+    EXPECT_EQ(levels[1].height, 1u);
+    EXPECT_EQ(levels[1].offset, 64u);
+
+    EXPECT_EQ(levels[3].width, 1u);
+    EXPECT_EQ(levels[3].height, 1u);
+    EXPECT_EQ(levels[3].offset, 64u + 16u + 8u);
+    EXPECT_EQ(levels[3].size, 4u);
+
+    // Limited count
+    EXPECT_EQ(Mipmap::getLevels(8, 2, 2).size(), 2u);
+    EXPECT_EQ(Mipmap::getLevels(8, 2, 10).size(), 4u);
+}
+
+TEST(Mipmap, BoxMatchesReference) {
+    const uint32_t sizes[][2] = {
+        {1, 1}, {2, 2}, {1, 9}, {9, 1}, {7, 5}, {16, 16}, {17, 3}, {64, 33}, {101, 77}
+    };
+
+    uint32_t seed = 0;
+    for (const auto& size : sizes) {
+        const uint32_t width = size[0];
+        const uint32_t height = size[1];
+
+        const std::vector<uint8_t> src = createImage(width, height, ++seed);
+        const std::vector<uint8_t> expected = downsampleReference(src, width, height);
+
+        std::vector<uint8_t> dst(expected.size());
+        Mipmap::downsample(src.data(), width, height, dst.data(), Mipmap::Filter::Box);
+
+        EXPECT_EQ(dst, expected) << "Size " << width << "x" << height;
+    }
+}
+
+TEST(Mipmap, KaiserPreservesConstantImage) {
+    const uint32_t sizes[][2] = {{1, 1}, {2, 2}, {7, 5}, {32, 32}, {33, 1}};
+
+    for (const auto& size : sizes) {
+        const uint32_t width = size[0];
+        const uint32_t height = size[1];
+
+        std::vector<uint8_t> src(static_cast<size_t>(width) * height * 4);
+        for (size_t i = 0; i < src.size(); i += 4) {
+            src[i] = 10;
+            src[i + 1] = 128;
+            src[i + 2] = 200;
+            src[i + 3] = 255;
+        }
+
+        std::vector<uint8_t> dst(static_cast<size_t>(std::max(width / 2, 1u)) * std::max(height / 2, 1u) * 4);
+        Mipmap::downsample(src.data(), width, height, dst.data(), Mipmap::Filter::Kaiser);
+
+        for (size_t i = 0; i < dst.size(); i += 4) {
+            EXPECT_NEAR(dst[i], 10, 1);
+            EXPECT_NEAR(dst[i + 1], 128, 1);
+            EXPECT_NEAR(dst[i + 2], 200, 1);
+            EXPECT_NEAR(dst[i + 3], 255, 1);
+        }
+    }
+}
+
+TEST(Mipmap, KaiserRemovesHighFrequencies) {
+    const uint32_t size = 32;
+
+    // A checkerboard is above the Nyquist frequency of the next level, it must become uniform
+    std::vector<uint8_t> src(size * size * 4);
+    for (uint32_t y = 0; y < size; ++y) {
+        for (uint32_t x = 0; x < size; ++x) {
+            std::fill_n(src.begin() + (y * size + x) * 4, 4, static_cast<uint8_t>((x + y) % 2 ? 255 : 0));
+        }
+    }
+
+    std::vector<uint8_t> dst(size / 2 * size / 2 * 4);
+    Mipmap::downsample(src.data(), size, size, dst.data(), Mipmap::Filter::Kaiser);
+
+    // The clamping to edge breaks the pattern on the borders
+    for (uint32_t y = 0; y < size / 2; ++y) {
+        for (uint32_t x = 0; x < size / 2; ++x) {
+            const bool border = x == 0 || y == 0 || x == size / 2 - 1 || y == size / 2 - 1;
+
+            for (uint32_t c = 0; c < 4; ++c) {
+                EXPECT_NEAR(dst[(y * size / 2 + x) * 4 + c], 128, border ? 8 : 2);
+            }
+        }
+    }
+}
+
+TEST(Mipmap, GenerateChain) {
+    const uint32_t width = 64;
+    const uint32_t height = 16;
+
+    const std::vector<Mipmap::Level> levels = Mipmap::getLevels(width, height);
+    std::vector<uint8_t> chain(levels.back().offset + levels.back().size);
+
+    // Gradient of the red channel and constant other channels
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x) {
+            uint8_t* pixel = chain.data() + (y * width + x) * 4;
+            pixel[0] = static_cast<uint8_t>(x * 4);
+            pixel[1] = 50;
+            pixel[2] = 100;
+            pixel[3] = 255;
+        }
+    }
+
+    Mipmap::generate(chain.data(), levels, Mipmap::Filter::Box);
+
+    // Each level is the downsampling of the previous one
+    for (size_t i = 1; i < levels.size(); ++i) {
+        const std::vector<uint8_t> previous(chain.begin() + levels[i - 1].offset, chain.begin() + levels[i - 1].offset + levels[i - 1].size);
+        const std::vector<uint8_t> expected = downsampleReference(previous, levels[i - 1].width, levels[i - 1].height);
+
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(), chain.begin() + levels[i].offset)) << "Level " << i;
+    }
+
+    // The last level is the average of the image
+    const uint8_t* last = chain.data() + levels.back().offset;
+    EXPECT_NEAR(last[0], 126, 2);
+    EXPECT_EQ(last[1], 50);
+    EXPECT_EQ(last[2], 100);
+    EXPECT_EQ(last[3], 255);
+}
+
+#if defined(ENABLE_LONG_TESTS)
+
+TEST(Mipmap, Throughput) {
+    const uint32_t size = 2048;
+    const std::vector<Mipmap::Level> levels = Mipmap::getLevels(size, size);
+
+    std::vector<uint8_t> chain(levels.back().offset + levels.back().size);
+    const std::vector<uint8_t> image = createImage(size, size, 42);
+    std::copy(image.begin(), image.end(), chain.begin());
+
+    for (Mipmap::Filter filter : {Mipmap::Filter::Box, Mipmap::Filter::Kaiser}) {
+        const uint32_t iterations = filter == Mipmap::Filter::Box ? 20 : 2;
+
+        const auto start = std::chrono::high_resolution_clock::now();
+        for (uint32_t i = 0; i < iterations; ++i) {
+            Mipmap::generate(chain.data(), levels, filter);
+        }
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        const double seconds = std::chrono::duration<double>(end - start).count();
+        const double megapixels = static_cast<double>(size) * size * iterations / 1e6;
+
+        std::cout << (filter == Mipmap::Filter::Box ? "Box" : "Kaiser") << ": "
+                  << megapixels / seconds << " source Mpixels/s" << std::endl;
+
+        EXPECT_GT(seconds, 0.0);
+    }
+}
+
+#endif
+
+} // Render
+} // Graphics
+} // lug
@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <lug/Graphics/ResourceBudget.hpp>
+
+using namespace ::testing;
+
+namespace lug {
+namespace Graphics {
+
+class MockProvider : public ResourceBudget::Provider {
+public:
+    MOCK_CONST_METHOD1(getResourceSize, uint64_t(Resource::Handle handle));
+    MOCK_METHOD1(evictResource, bool(Resource::Handle handle));
+    MOCK_METHOD1(reloadResource, bool(Resource::Handle handle));
+};
+
+static Resource::Handle createHandle(Resource::Type type, uint32_t index) {
+    Resource::Handle handle;
+
+    handle.type = static_cast<uint32_t>(type);
+    handle.index = index;
+
+    return handle;
+}
+
+MATCHER_P(HandleEq, handle, "") {
+    return arg == handle;
+}
+
+TEST(ResourceBudget, Accounting) {
+    MockProvider provider;
+    ResourceBudget budget;
+
+    const Resource::Handle texture = createHandle(Resource::Type::Texture, 0);
+    const Resource::Handle mesh = createHandle(Resource::Type::Mesh, 1);
+
+    // Nothing is tracked without provider
+    EXPECT_FALSE(budget.track(texture));
+    EXPECT_TRUE(budget.use(texture));
+    EXPECT_FALSE(budget.isTracked(texture));
+
+    budget.setProvider(&provider);
+
+    EXPECT_CALL(provider, getResourceSize(HandleEq(texture))).WillOnce(Return(1024));
+    EXPECT_CALL(provider, getResourceSize(HandleEq(mesh))).WillOnce(Return(256));
+
+    EXPECT_TRUE(budget.track(texture));
+    EXPECT_TRUE(budget.use(mesh));
+    EXPECT_TRUE(budget.track(texture));
+
+    EXPECT_TRUE(budget.isTracked(texture));
+    EXPECT_TRUE(budget.isTracked(mesh));
+    EXPECT_EQ(budget.getUsage(), 1280u);
+
+    budget.untrack(texture);
+    EXPECT_FALSE(budget.isTracked(texture));
+    EXPECT_EQ(budget.getUsage(), 256u);
+
+    const ResourceBudget::Stats stats = budget.getStats();
+    EXPECT_EQ(stats.usage, 256u);
+    EXPECT_EQ(stats.residentCount, 1u);
+    EXPECT_EQ(stats.evictedCount, 0u);
+}
+
+TEST(ResourceBudget, Unlimited) {
+    NiceMock<MockProvider> provider;
+    ResourceBudget budget;
+
+    budget.setProvider(&provider);
+    ON_CALL(provider, getResourceSize(_)).WillByDefault(Return(1 << 20));
+    EXPECT_CALL(provider, evictResource(_)).Times(0);
+
+    for (uint32_t i = 0; i < 64; ++i) {
+        EXPECT_TRUE(budget.use(createHandle(Resource::Type::Texture, i)));
+    }
+
+    for (uint32_t i = 0; i < 16; ++i) {
+        EXPECT_TRUE(budget.nextFrame());
+    }
+
+    EXPECT_EQ(budget.getUsage(), 64u << 20);
+}
+
+TEST(ResourceBudget, EvictLeastRecentlyUsed) {
+    NiceMock<MockProvider> provider;
+    ResourceBudget budget;
+
+    budget.setProvider(&provider);
+    budget.setBudget(300);
+    budget.setEvictionDelay(2);
+
+    ON_CALL(provider, getResourceSize(_)).WillByDefault(Return(100));
+
+    const Resource::Handle a = createHandle(Resource::Type::Texture, 0);
+    const Resource::Handle b = createHandle(Resource::Type::Texture, 1);
+    const Resource::Handle c = createHandle(Resource::Type::Mesh, 2);
+    const Resource::Handle d = createHandle(Resource::Type::Mesh, 3);
+
+    // Frame 0: a, b, c
+    budget.use(a);
+    budget.use(b);
+    budget.use(c);
+    EXPECT_TRUE(budget.nextFrame());
+
+    // Frame 1: b, c
+    budget.use(b);
+    budget.use(c);
+    EXPECT_TRUE(budget.nextFrame());
+
+    // Frame 2: c, d, over budget and a has been unused for 2 frames
+    budget.use(c);
+    budget.use(d);
+    EXPECT_EQ(budget.getUsage(), 400u);
+    EXPECT_CALL(provider, evictResource(HandleEq(a))).WillOnce(Return(true));
+    EXPECT_TRUE(budget.nextFrame());
+
+    EXPECT_FALSE(budget.isResident(a));
+    EXPECT_TRUE(budget.isResident(b));
+    EXPECT_TRUE(budget.isResident(c));
+    EXPECT_TRUE(budget.isResident(d));
+    EXPECT_EQ(budget.getUsage(), 300u);
+    EXPECT_EQ(budget.getStats().evictions, 1u);
+}
+
+TEST(ResourceBudget, EvictionDelay) {
+    NiceMock<MockProvider> provider;
+    ResourceBudget budget;
+
+    budget.setProvider(&provider);
+    budget.setBudget(100);
+    budget.setEvictionDelay(3);
+
+    ON_CALL(provider, getResourceSize(_)).WillByDefault(Return(100));
+
+    const Resource::Handle a = createHandle(Resource::Type::Texture, 0);
+    const Resource::Handle b = createHandle(Resource::Type::Texture, 1);
+
+    // Both resources are in use: the budget can't be respected
+    EXPECT_CALL(provider, evictResource(_)).Times(0);
+    budget.use(a);
+    budget.use(b);
+    EXPECT_FALSE(budget.nextFrame());
+
+    // Only b is used, a must stay resident during 3 frames
+    for (uint32_t i = 0; i < 2; ++i) {
+        budget.use(b);
+        EXPECT_FALSE(budget.nextFrame());
+    }
+
+    Mock::VerifyAndClearExpectations(&provider);
+    ON_CALL(provider, getResourceSize(_)).WillByDefault(Return(100));
+    EXPECT_CALL(provider, evictResource(HandleEq(a))).WillOnce(Return(true));
+
+    budget.use(b);
+    EXPECT_TRUE(budget.nextFrame());
+    EXPECT_FALSE(budget.isResident(a));
+}
+
+TEST(ResourceBudget, ReloadOnDemand) {
+    NiceMock<MockProvider> provider;
+    ResourceBudget budget;
+
+    budget.setProvider(&provider);
+    budget.setBudget(100);
+    budget.setEvictionDelay(1);
+
+    const Resource::Handle a = createHandle(Resource::Type::Texture, 0);
+    const Resource::Handle b = createHandle(Resource::Type::Texture, 1);
+
+    ON_CALL(provider, getResourceSize(_)).WillByDefault(Return(100));
+    ON_CALL(provider, evictResource(_)).WillByDefault(Return(true));
+
+    budget.use(a);
+    EXPECT_TRUE(budget.nextFrame());
+
+    budget.use(b);
+    EXPECT_TRUE(budget.nextFrame());
+    EXPECT_FALSE(budget.isResident(a));
+
+    // The resource is reloaded with its new size
+    EXPECT_CALL(provider, reloadResource(HandleEq(a))).WillOnce(Return(true));
+    EXPECT_CALL(provider, getResourceSize(HandleEq(a))).WillOnce(Return(50));
+    EXPECT_TRUE(budget.use(a));
+    EXPECT_TRUE(budget.isResident(a));
+    EXPECT_EQ(budget.getUsage(), 150u);
+
+    // b is now the least recently used
+    EXPECT_CALL(provider, evictResource(HandleEq(b))).WillOnce(Return(true));
+    EXPECT_TRUE(budget.nextFrame());
+    EXPECT_EQ(budget.getUsage(), 50u);
+    EXPECT_EQ(budget.getStats().reloads, 1u);
+
+    // A failed reload leaves the resource evicted
+    EXPECT_CALL(provider, reloadResource(HandleEq(b))).WillOnce(Return(false));
+    EXPECT_FALSE(budget.use(b));
+    EXPECT_FALSE(budget.isResident(b));
+    EXPECT_EQ(budget.getUsage(), 50u);
+}
+
+TEST(ResourceBudget, EvictionFailure) {
+    NiceMock<MockProvider> provider;
+    ResourceBudget budget;
+
+    budget.setProvider(&provider);
+    budget.setBudget(100);
+    budget.setEvictionDelay(0);
+
+    ON_CALL(provider, getResourceSize(_)).WillByDefault(Return(100));
+
+    budget.use(createHandle(Resource::Type::Texture, 0));
+    budget.use(createHandle(Resource::Type::Texture, 1));
+
+    // Each resource is tried once, the budget can't be respected
+    EXPECT_CALL(provider, evictResource(_)).Times(2).WillRepeatedly(Return(false));
+    EXPECT_FALSE(budget.nextFrame());
+    EXPECT_EQ(budget.getUsage(), 200u);
+}
+
+} // Graphics
+} // lug
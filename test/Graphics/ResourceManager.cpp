@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <lug/Graphics/Builder/Scene.hpp>
+#include <lug/Graphics/Graphics.hpp>
+#include <lug/Graphics/Renderer.hpp>
+#include <lug/Graphics/ResourceManager.hpp>
+#include <lug/Graphics/Scene/Scene.hpp>
+
+namespace lug {
+namespace Graphics {
+
+namespace {
+
+// Renderer without device, only holding the resource manager
+class TestRenderer : public Renderer {
+public:
+    explicit TestRenderer(Graphics& graphics) : Renderer(graphics, Renderer::Type::Vulkan) {
+        _resourceManager = std::make_unique<ResourceManager>(*this);
+    }
+
+    bool beginInit(const std::string&, const Core::Version&, const InitInfo&) override { return true; }
+    bool finishInit() override { return true; }
+
+    bool beginFrame(const System::Time&) override { return true; }
+    bool endFrame() override { return true; }
+
+    Render::Window* createWindow(Render::Window::InitInfo&) override { return nullptr; }
+    Render::Window* getWindow() override { return nullptr; }
+};
+
+class ResourceManagerTest : public ::testing::Test {
+protected:
+    Resource::SharedPtr<Scene::Scene> createScene(const std::string& name) {
+        Builder::Scene sceneBuilder(renderer);
+        sceneBuilder.setName(name);
+
+        return sceneBuilder.build();
+    }
+
+    Graphics graphics{"test", {0, 1, 0}};
+    TestRenderer renderer{graphics};
+    ResourceManager& resourceManager{*renderer.getResourceManager()};
+};
+
+} // anonymous
+
+TEST_F(ResourceManagerTest, GetByName) {
+    Resource::SharedPtr<Scene::Scene> scene = createScene("scene");
+    ASSERT_TRUE(scene);
+
+    EXPECT_EQ(resourceManager.get<Scene::Scene>("scene").get(), scene.get());
+    EXPECT_EQ(resourceManager.get<Resource>("scene").get(), scene.get());
+    EXPECT_FALSE(resourceManager.get<Resource>("missing"));
+
+    // Only the resources of the requested type are returned
+    EXPECT_FALSE(resourceManager.get<Render::Texture>("scene"));
+}
+
+TEST_F(ResourceManagerTest, Rename) {
+    Resource::SharedPtr<Scene::Scene> scene = createScene("scene");
+    ASSERT_TRUE(scene);
+
+    scene->setName("renamed");
+    EXPECT_EQ(scene->getName(), "renamed");
+    EXPECT_FALSE(resourceManager.get<Resource>("scene"));
+    EXPECT_EQ(resourceManager.get<Resource>("renamed").get(), scene.get());
+
+    // The handle doesn't change
+    EXPECT_EQ(resourceManager.get<Resource>(scene->getHandle()).get(), scene.get());
+}
+
+TEST_F(ResourceManagerTest, DuplicateNames) {
+    Resource::SharedPtr<Scene::Scene> first = createScene("scene");
+    Resource::SharedPtr<Scene::Scene> second = createScene("scene");
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+
+    // The first added is returned
+    EXPECT_EQ(resourceManager.get<Resource>("scene").get(), first.get());
+
+    first->setName("first");
+    EXPECT_EQ(resourceManager.get<Resource>("scene").get(), second.get());
+    EXPECT_EQ(resourceManager.get<Resource>("first").get(), first.get());
+
+    // A resource renamed to an existing name is after the others
+    first->setName("scene");
+    EXPECT_EQ(resourceManager.get<Resource>("scene").get(), second.get());
+    EXPECT_FALSE(resourceManager.get<Resource>("first"));
+}
+
+TEST_F(ResourceManagerTest, Remove) {
+    Resource::SharedPtr<Scene::Scene> first = createScene("scene");
+    Resource::SharedPtr<Scene::Scene> second = createScene("scene");
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+
+    const Resource::Handle firstHandle = first->getHandle();
+    const Resource::Handle secondHandle = second->getHandle();
+
+    resourceManager.remove(firstHandle);
+    EXPECT_FALSE(resourceManager.get<Resource>(firstHandle));
+    EXPECT_EQ(resourceManager.get<Resource>("scene").get(), second.get());
+
+    // Removing it again does nothing
+    resourceManager.remove(firstHandle);
+
+    resourceManager.remove(secondHandle);
+    EXPECT_FALSE(resourceManager.get<Resource>("scene"));
+}
+
+TEST_F(ResourceManagerTest, GetFile) {
+    const std::string filename = "ResourceManager.gltf";
+
+    {
+        std::ofstream file(filename);
+        file << R"({
+            "asset": {"version": "2.0"},
+            "scene": 0,
+            "scenes": [{"name": "file", "nodes": [0]}],
+            "nodes": [{"name": "node", "children": [1]}, {"name": "child"}]
+        })";
+    }
+
+    EXPECT_FALSE(resourceManager.getFile(filename));
+
+    Resource::SharedPtr<Resource> resource = resourceManager.loadFile(filename);
+    std::remove(filename.c_str());
+    ASSERT_TRUE(resource);
+
+    EXPECT_EQ(resourceManager.getFile(filename).get(), resource.get());
+    EXPECT_EQ(resourceManager.get<Scene::Scene>("file").get(), resource.get());
+    EXPECT_FALSE(resourceManager.getFile("missing.gltf"));
+
+    // The nodes of the loaded scene are indexed
+    Scene::Scene& scene = *Resource::SharedPtr<Scene::Scene>::cast(resource);
+    ASSERT_NE(scene.getSceneNode("child"), nullptr);
+    EXPECT_EQ(scene.getSceneNode("child")->getParent(), scene.getSceneNode("node"));
+
+    // A renamed file keeps its filename
+    resource->setName("renamed");
+    EXPECT_EQ(resourceManager.getFile(filename).get(), resource.get());
+
+    resourceManager.remove(resource->getHandle());
+    EXPECT_FALSE(resourceManager.getFile(filename));
+}
+
+} // Graphics
+} // lug
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include <lug/Graphics/Render/RingAllocator.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Render {
+
+TEST(RingAllocator, Alignment) {
+    RingAllocator ring(1024, 256);
+    size_t offset;
+
+    ASSERT_TRUE(ring.allocate(10, offset));
+    EXPECT_EQ(offset, 0u);
+
+    ASSERT_TRUE(ring.allocate(10, offset));
+    EXPECT_EQ(offset, 256u);
+
+    ASSERT_TRUE(ring.allocate(256, offset));
+    EXPECT_EQ(offset, 512u);
+
+    ASSERT_TRUE(ring.allocate(1, offset));
+    EXPECT_EQ(offset, 768u);
+
+    // The padding counts as used
+    EXPECT_EQ(ring.getUsedSize(), 769u);
+    EXPECT_FALSE(ring.allocate(1, offset));
+}
+
+TEST(RingAllocator, Full) {
+    RingAllocator ring(100, 1);
+    size_t offset;
+
+    EXPECT_FALSE(ring.allocate(101, offset));
+
+    ASSERT_TRUE(ring.allocate(100, offset));
+    EXPECT_EQ(offset, 0u);
+    EXPECT_FALSE(ring.allocate(1, offset));
+
+    ring.endFrame(0);
+    EXPECT_FALSE(ring.allocate(1, offset));
+
+    ring.releaseFrame(0);
+    EXPECT_EQ(ring.getUsedSize(), 0u);
+
+    ASSERT_TRUE(ring.allocate(100, offset));
+    EXPECT_EQ(offset, 0u);
+}
+
+TEST(RingAllocator, WrapAround) {
+    RingAllocator ring(100, 1);
+    size_t offset;
+
+    // Frame 0: [0, 40)
+    ASSERT_TRUE(ring.allocate(40, offset));
+    ring.endFrame(0);
+
+    // Frame 1: [40, 80)
+    ASSERT_TRUE(ring.allocate(40, offset));
+    EXPECT_EQ(offset, 40u);
+    ring.endFrame(1);
+
+    // Frame 0 is still in use, no room at the end nor at the beginning
+    EXPECT_FALSE(ring.allocate(30, offset));
+
+    ring.releaseFrame(0);
+
+    // The end of the ring is skipped
+    ASSERT_TRUE(ring.allocate(30, offset));
+    EXPECT_EQ(offset, 0u);
+    EXPECT_EQ(ring.getUsedSize(), 40u + 20u + 30u);
+
+    // Only 10 bytes left before frame 1
+    EXPECT_FALSE(ring.allocate(11, offset));
+    ASSERT_TRUE(ring.allocate(10, offset));
+    EXPECT_EQ(offset, 30u);
+    ring.endFrame(0);
+
+    // The skipped end of the ring is released with the frame that skipped it
+    ring.releaseFrame(1);
+    EXPECT_EQ(ring.getUsedSize(), 20u + 40u);
+
+    // Between the allocations of frame 0 and the skipped end
+    EXPECT_FALSE(ring.allocate(41, offset));
+    ASSERT_TRUE(ring.allocate(40, offset));
+    EXPECT_EQ(offset, 40u);
+    ring.endFrame(1);
+}
+
+TEST(RingAllocator, ReleaseOutOfOrder) {
+    RingAllocator ring(90, 1);
+    size_t offset;
+
+    for (uint32_t frameIndex = 0; frameIndex < 3; ++frameIndex) {
+        ASSERT_TRUE(ring.allocate(30, offset));
+        EXPECT_EQ(offset, frameIndex * 30u);
+        ring.endFrame(frameIndex);
+    }
+
+    // Frame 1 is done before frame 0, its space can't be reused yet
+    ring.releaseFrame(1);
+    EXPECT_EQ(ring.getUsedSize(), 90u);
+    EXPECT_FALSE(ring.allocate(1, offset));
+
+    ring.releaseFrame(0);
+    EXPECT_EQ(ring.getUsedSize(), 30u);
+
+    ASSERT_TRUE(ring.allocate(60, offset));
+    EXPECT_EQ(offset, 0u);
+}
+
+TEST(RingAllocator, ManyFrames) {
+    const uint32_t framesCount = 3;
+    RingAllocator ring(4096, 64);
+
+    // Simulate frames of random sizes, only the oldest frame is released before recording a new one
+    uint32_t seed = 1;
+    for (uint32_t frame = 0; frame < 1000; ++frame) {
+        const uint32_t frameIndex = frame % framesCount;
+        ring.releaseFrame(frameIndex);
+
+        size_t previousOffset = 0;
+        for (uint32_t i = 0; i < 4; ++i) {
+            seed = seed * 1103515245 + 12345;
+            const size_t size = 1 + (seed >> 16) % 300;
+
+            size_t offset;
+            ASSERT_TRUE(ring.allocate(size, offset)) << "Frame " << frame;
+            EXPECT_EQ(offset % 64, 0u);
+            EXPECT_LE(offset + size, ring.getSize());
+
+            if (i) {
+                EXPECT_NE(offset, previousOffset);
+            }
+            previousOffset = offset;
+        }
+
+        ring.endFrame(frameIndex);
+        EXPECT_LE(ring.getUsedSize(), ring.getSize());
+    }
+}
+
+} // Render
+} // Graphics
+} // lug
@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include <lug/Graphics/Builder/Scene.hpp>
+#include <lug/Graphics/Graphics.hpp>
+#include <lug/Graphics/Renderer.hpp>
+#include <lug/Graphics/Scene/Scene.hpp>
+
+namespace lug {
+namespace Graphics {
+namespace Scene {
+
+namespace {
+
+// Renderer without device, only holding the resource manager
+class TestRenderer : public Renderer {
+public:
+    explicit TestRenderer(Graphics& graphics) : Renderer(graphics, Renderer::Type::Vulkan) {
+        _resourceManager = std::make_unique<ResourceManager>(*this);
+    }
+
+    bool beginInit(const std::string&, const Core::Version&, const InitInfo&) override { return true; }
+    bool finishInit() override { return true; }
+
+    bool beginFrame(const System::Time&) override { return true; }
+    bool endFrame() override { return true; }
+
+    Render::Window* createWindow(Render::Window::InitInfo&) override { return nullptr; }
+    Render::Window* getWindow() override { return nullptr; }
+};
+
+class SceneTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        Builder::Scene sceneBuilder(renderer);
+        sceneBuilder.setName("scene");
+
+        scene = sceneBuilder.build();
+        ASSERT_TRUE(scene);
+    }
+
+    Graphics graphics{"test", {0, 1, 0}};
+    TestRenderer renderer{graphics};
+    Resource::SharedPtr<Scene> scene;
+};
+
+} // anonymous
+
+TEST_F(SceneTest, GetSceneNode) {
+    Node& root = scene->getRoot();
+
+    Node* parent = scene->createSceneNode("parent");
+    Node* child = scene->createSceneNode("child");
+
+    // The subtree is indexed when it is attached to the scene graph, not before
+    parent->attachChild(*child);
+    EXPECT_EQ(scene->getSceneNode("child"), nullptr);
+    EXPECT_EQ(parent->getNode("child"), child);
+    EXPECT_FALSE(child->isAttached());
+
+    root.attachChild(*parent);
+    EXPECT_TRUE(child->isAttached());
+    EXPECT_EQ(scene->getSceneNode("root"), &root);
+    EXPECT_EQ(scene->getSceneNode("parent"), parent);
+    EXPECT_EQ(scene->getSceneNode("child"), child);
+    EXPECT_EQ(scene->getSceneNode("missing"), nullptr);
+
+    // The children attached afterwards are indexed too
+    Node* grandChild = scene->createSceneNode("grandChild");
+    child->attachChild(*grandChild);
+    EXPECT_EQ(scene->getSceneNode("grandChild"), grandChild);
+
+    EXPECT_EQ(root.getNode("grandChild"), grandChild);
+    EXPECT_EQ(parent->getNode("grandChild"), grandChild);
+    EXPECT_EQ(child->getNode("child"), child);
+    EXPECT_EQ(child->getNode("parent"), nullptr);
+}
+
+TEST_F(SceneTest, Reparent) {
+    Node& root = scene->getRoot();
+
+    Node* first = scene->createSceneNode("first");
+    Node* second = scene->createSceneNode("second");
+    Node* child = scene->createSceneNode("child");
+
+    root.attachChild(*first);
+    root.attachChild(*second);
+    first->attachChild(*child);
+
+    EXPECT_EQ(first->getNode("child"), child);
+    EXPECT_EQ(second->getNode("child"), nullptr);
+
+    // The child has only one parent
+    second->attachChild(*child);
+    EXPECT_EQ(child->getParent(), second);
+    EXPECT_TRUE(first->getChildren().empty());
+    EXPECT_EQ(first->getNode("child"), nullptr);
+    EXPECT_EQ(second->getNode("child"), child);
+    EXPECT_EQ(scene->getSceneNode("child"), child);
+
+    // Re-parented out of the scene graph, the child leaves the index
+    Node* detached = scene->createSceneNode("detached");
+    detached->attachChild(*child);
+    EXPECT_FALSE(child->isAttached());
+    EXPECT_EQ(scene->getSceneNode("child"), nullptr);
+    EXPECT_EQ(detached->getNode("child"), child);
+    EXPECT_EQ(root.getNode("child"), nullptr);
+
+    // And is indexed again with its new parent
+    root.attachChild(*detached);
+    EXPECT_TRUE(child->isAttached());
+    EXPECT_EQ(scene->getSceneNode("child"), child);
+}
+
+TEST_F(SceneTest, Detach) {
+    Node& root = scene->getRoot();
+
+    Node* parent = scene->createSceneNode("parent");
+    Node* child = scene->createSceneNode("child");
+
+    root.attachChild(*parent);
+    parent->attachChild(*child);
+
+    // The whole subtree is removed from the index
+    root.detachChild(*parent);
+    EXPECT_EQ(parent->getParent(), nullptr);
+    EXPECT_TRUE(root.getChildren().empty());
+    EXPECT_FALSE(parent->isAttached());
+    EXPECT_FALSE(child->isAttached());
+    EXPECT_EQ(scene->getSceneNode("parent"), nullptr);
+    EXPECT_EQ(scene->getSceneNode("child"), nullptr);
+    EXPECT_EQ(root.getNode("child"), nullptr);
+
+    // The detached subtree keeps its children
+    EXPECT_EQ(parent->getNode("child"), child);
+}
+
+TEST_F(SceneTest, DuplicateNames) {
+    Node& root = scene->getRoot();
+
+    Node* first = scene->createSceneNode("first");
+    Node* second = scene->createSceneNode("second");
+    Node* firstLeaf = scene->createSceneNode("leaf");
+    Node* secondLeaf = scene->createSceneNode("leaf");
+
+    first->attachChild(*firstLeaf);
+    second->attachChild(*secondLeaf);
+    root.attachChild(*first);
+    root.attachChild(*second);
+
+    // The first node attached is returned by the scene, each subtree finds its own
+    EXPECT_EQ(scene->getSceneNode("leaf"), firstLeaf);
+    EXPECT_EQ(root.getNode("leaf"), firstLeaf);
+    EXPECT_EQ(first->getNode("leaf"), firstLeaf);
+    EXPECT_EQ(second->getNode("leaf"), secondLeaf);
+
+    // The other node of the same name is found once the first is detached
+    first->detachChild(*firstLeaf);
+    EXPECT_EQ(scene->getSceneNode("leaf"), secondLeaf);
+    EXPECT_EQ(root.getNode("leaf"), secondLeaf);
+    EXPECT_EQ(first->getNode("leaf"), nullptr);
+
+    // And it is after it when attached again
+    first->attachChild(*firstLeaf);
+    EXPECT_EQ(scene->getSceneNode("leaf"), secondLeaf);
+    EXPECT_EQ(first->getNode("leaf"), firstLeaf);
+
+    second->detachChild(*secondLeaf);
+    EXPECT_EQ(scene->getSceneNode("leaf"), firstLeaf);
+}
+
+} // Scene
+} // Graphics
+} // lug
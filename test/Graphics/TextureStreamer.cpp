@@ -0,0 +1,356 @@
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <lug/Graphics/TextureStreamer.hpp>
+
+namespace lug {
+namespace Graphics {
+
+// Square RGBA8 textures, the streams are finished by the test
+class FakeProvider : public TextureStreamer::Provider {
+public:
+    struct Stream {
+        Resource::Handle handle;
+        uint32_t firstLevel;
+    };
+
+public:
+    uint64_t getLevelsSize(Resource::Handle handle, uint32_t firstLevel) const override {
+        uint64_t size = 0;
+
+        for (uint32_t size2D = sizes.at(handle.value) >> firstLevel; size2D; size2D >>= 1) {
+            size += static_cast<uint64_t>(size2D) * size2D * 4;
+        }
+
+        return size;
+    }
+
+    bool streamLevels(Resource::Handle handle, uint32_t firstLevel) override {
+        if (fail) {
+            return false;
+        }
+
+        streams.push_back({handle, firstLevel});
+        return true;
+    }
+
+    std::unordered_map<uint32_t, uint32_t> sizes;
+    std::vector<Stream> streams;
+    bool fail{false};
+};
+
+static Resource::Handle createTexture(FakeProvider& provider, uint32_t index, uint32_t size) {
+    Resource::Handle handle;
+
+    handle.type = static_cast<uint32_t>(Resource::Type::Texture);
+    handle.index = index;
+
+    provider.sizes[handle.value] = size;
+
+    return handle;
+}
+
+static uint32_t getLevelsCount(uint32_t size) {
+    return static_cast<uint32_t>(std::log2(size)) + 1;
+}
+
+TEST(TextureStreamer, RequiredLevel) {
+    // 1024x512, 11 levels
+    EXPECT_EQ(TextureStreamer::getRequiredLevel(1024, 512, 11, 1024.0f), 0u);
+    EXPECT_EQ(TextureStreamer::getRequiredLevel(1024, 512, 11, 2048.0f), 0u);
+    EXPECT_EQ(TextureStreamer::getRequiredLevel(1024, 512, 11, 1023.0f), 0u);
+    EXPECT_EQ(TextureStreamer::getRequiredLevel(1024, 512, 11, 512.0f), 1u);
+    EXPECT_EQ(TextureStreamer::getRequiredLevel(1024, 512, 11, 100.0f), 3u);
+    EXPECT_EQ(TextureStreamer::getRequiredLevel(1024, 512, 11, 1.0f), 10u);
+    EXPECT_EQ(TextureStreamer::getRequiredLevel(1024, 512, 11, 0.01f), 10u);
+    EXPECT_EQ(TextureStreamer::getRequiredLevel(1024, 512, 11, 0.0f), 10u);
+    EXPECT_EQ(TextureStreamer::getRequiredLevel(1024, 512, 11, std::numeric_limits<float>::infinity()), 0u);
+
+    // Truncated chain
+    EXPECT_EQ(TextureStreamer::getRequiredLevel(1024, 512, 4, 1.0f), 3u);
+}
+
+TEST(TextureStreamer, BaseLevel) {
+    EXPECT_EQ(TextureStreamer::getBaseLevel(1024, 1024, 11, 64), 4u);
+    EXPECT_EQ(TextureStreamer::getBaseLevel(1024, 256, 11, 64), 4u);
+    EXPECT_EQ(TextureStreamer::getBaseLevel(100, 60, 7, 64), 1u);
+    EXPECT_EQ(TextureStreamer::getBaseLevel(64, 64, 7, 64), 0u);
+    EXPECT_EQ(TextureStreamer::getBaseLevel(1024, 1024, 3, 64), 2u);
+}
+
+TEST(TextureStreamer, Footprint) {
+    // A sphere of radius 1 at a distance of sqrt(2) is seen with an angle of 90 degrees,
+    // the whole height of the viewport with a vertical field of view of 90 degrees
+    EXPECT_NEAR(TextureStreamer::getFootprint(1.0f, std::sqrt(2.0f), 1.0f, 720.0f), 720.0f, 1e-3f);
+
+    // Half the size twice farther
+    const float near = TextureStreamer::getFootprint(0.5f, 100.0f, 1.5f, 1000.0f);
+    const float far = TextureStreamer::getFootprint(0.5f, 200.0f, 1.5f, 1000.0f);
+
+    EXPECT_NEAR(near, 7.5f, 1e-3f);
+    EXPECT_NEAR(far * 2.0f, near, 1e-3f);
+
+    // Inside the sphere
+    EXPECT_TRUE(std::isinf(TextureStreamer::getFootprint(1.0f, 0.5f, 1.0f, 720.0f)));
+}
+
+TEST(TextureStreamer, Stream) {
+    FakeProvider provider;
+    TextureStreamer streamer;
+
+    const Resource::Handle texture = createTexture(provider, 0, 1024);
+
+    // Nothing is tracked without provider
+    EXPECT_FALSE(streamer.track(texture, 1024, 1024, 11, 4));
+
+    streamer.setProvider(&provider);
+
+    EXPECT_TRUE(streamer.track(texture, 1024, 1024, 11, 4));
+    EXPECT_EQ(streamer.getResidentLevel(texture), 4u);
+    EXPECT_EQ(streamer.getUsage(), provider.getLevelsSize(texture, 4));
+
+    // The base level is enough
+    streamer.request(texture, 10.0f);
+    streamer.nextFrame();
+    EXPECT_TRUE(provider.streams.empty());
+
+    // The finest of the requests of the frame is streamed
+    streamer.request(texture, 300.0f);
+    streamer.request(texture, 10.0f);
+    streamer.nextFrame();
+
+    ASSERT_EQ(provider.streams.size(), 1u);
+    EXPECT_EQ(provider.streams[0].handle, texture);
+    EXPECT_EQ(provider.streams[0].firstLevel, 1u);
+    EXPECT_TRUE(streamer.isStreaming(texture));
+
+    // The streamed levels are reserved in the budget
+    EXPECT_EQ(streamer.getUsage(), provider.getLevelsSize(texture, 1));
+
+    // No other stream of the texture until the first one is finished
+    streamer.request(texture, 1024.0f);
+    streamer.nextFrame();
+    EXPECT_EQ(provider.streams.size(), 1u);
+
+    streamer.finishStream(texture, true);
+    EXPECT_FALSE(streamer.isStreaming(texture));
+    EXPECT_EQ(streamer.getResidentLevel(texture), 1u);
+    EXPECT_EQ(streamer.getUsage(), provider.getLevelsSize(texture, 1));
+
+    streamer.request(texture, 1024.0f);
+    streamer.nextFrame();
+
+    ASSERT_EQ(provider.streams.size(), 2u);
+    EXPECT_EQ(provider.streams[1].firstLevel, 0u);
+
+    streamer.finishStream(texture, true);
+    EXPECT_EQ(streamer.getResidentLevel(texture), 0u);
+
+    const TextureStreamer::Stats stats = streamer.getStats();
+    EXPECT_EQ(stats.texturesCount, 1u);
+    EXPECT_EQ(stats.streamingCount, 0u);
+    EXPECT_EQ(stats.upgrades, 2u);
+    EXPECT_EQ(stats.downgrades, 0u);
+
+    streamer.untrack(texture);
+    EXPECT_FALSE(streamer.isTracked(texture));
+    EXPECT_EQ(streamer.getUsage(), 0u);
+}
+
+TEST(TextureStreamer, Release) {
+    FakeProvider provider;
+    TextureStreamer streamer;
+
+    streamer.setProvider(&provider);
+    streamer.setReleaseDelay(3);
+
+    const Resource::Handle texture = createTexture(provider, 0, 1024);
+
+    EXPECT_TRUE(streamer.track(texture, 1024, 1024, 11, 4));
+
+    streamer.request(texture, 1024.0f);
+    streamer.nextFrame();
+    streamer.finishStream(texture, true);
+    EXPECT_EQ(streamer.getResidentLevel(texture), 0u);
+
+    // The object moves away, the finest levels are kept during the release delay
+    for (uint32_t i = 0; i < 2; ++i) {
+        streamer.request(texture, 200.0f);
+        streamer.nextFrame();
+        EXPECT_EQ(provider.streams.size(), 1u);
+    }
+
+    streamer.request(texture, 200.0f);
+    streamer.nextFrame();
+
+    ASSERT_EQ(provider.streams.size(), 2u);
+    EXPECT_EQ(provider.streams[1].firstLevel, 2u);
+
+    streamer.finishStream(texture, true);
+    EXPECT_EQ(streamer.getUsage(), provider.getLevelsSize(texture, 2));
+
+    // Not requested anymore, only the base level stays resident
+    for (uint32_t i = 0; i < 3; ++i) {
+        streamer.nextFrame();
+    }
+
+    ASSERT_EQ(provider.streams.size(), 3u);
+    EXPECT_EQ(provider.streams[2].firstLevel, 4u);
+
+    // The released levels are still used until the stream is finished
+    EXPECT_EQ(streamer.getUsage(), provider.getLevelsSize(texture, 2));
+
+    streamer.finishStream(texture, true);
+    EXPECT_EQ(streamer.getResidentLevel(texture), 4u);
+    EXPECT_EQ(streamer.getUsage(), provider.getLevelsSize(texture, 4));
+    EXPECT_EQ(streamer.getStats().downgrades, 2u);
+
+    // Never below the base level
+    for (uint32_t i = 0; i < 8; ++i) {
+        streamer.nextFrame();
+    }
+
+    EXPECT_EQ(provider.streams.size(), 3u);
+}
+
+TEST(TextureStreamer, Budget) {
+    FakeProvider provider;
+    TextureStreamer streamer;
+
+    streamer.setProvider(&provider);
+
+    const Resource::Handle small = createTexture(provider, 0, 256);
+    const Resource::Handle large = createTexture(provider, 1, 1024);
+
+    EXPECT_TRUE(streamer.track(small, 256, 256, getLevelsCount(256), 2));
+    EXPECT_TRUE(streamer.track(large, 1024, 1024, getLevelsCount(1024), 4));
+
+    // Enough for the large texture up to its level 1 and the small one entirely
+    const uint64_t budget = provider.getLevelsSize(large, 1) + provider.getLevelsSize(small, 0);
+    streamer.setBudget(budget);
+
+    // The large texture misses more levels, it is streamed first but its level 0 doesn't fit
+    streamer.request(small, 256.0f);
+    streamer.request(large, 1024.0f);
+    streamer.nextFrame();
+
+    ASSERT_EQ(provider.streams.size(), 2u);
+    EXPECT_EQ(provider.streams[0].handle, large);
+    EXPECT_EQ(provider.streams[0].firstLevel, 1u);
+    EXPECT_EQ(provider.streams[1].handle, small);
+    EXPECT_EQ(provider.streams[1].firstLevel, 0u);
+    EXPECT_EQ(streamer.getUsage(), budget);
+
+    streamer.finishStream(large, true);
+    streamer.finishStream(small, true);
+    EXPECT_EQ(streamer.getUsage(), budget);
+
+    // Still no room for the level 0
+    streamer.request(small, 256.0f);
+    streamer.request(large, 1024.0f);
+    streamer.nextFrame();
+    EXPECT_EQ(provider.streams.size(), 2u);
+
+    // The small texture is released, which makes room for the large one
+    streamer.setBudget(budget + provider.getLevelsSize(large, 0) - provider.getLevelsSize(large, 1) - provider.getLevelsSize(small, 0) + provider.getLevelsSize(small, 2));
+
+    for (uint32_t i = 0; i < 4; ++i) {
+        streamer.request(large, 1024.0f);
+        streamer.nextFrame();
+    }
+
+    ASSERT_EQ(provider.streams.size(), 3u);
+    EXPECT_EQ(provider.streams[2].handle, small);
+    EXPECT_EQ(provider.streams[2].firstLevel, 2u);
+
+    streamer.finishStream(small, true);
+    streamer.request(large, 1024.0f);
+    streamer.nextFrame();
+
+    ASSERT_EQ(provider.streams.size(), 4u);
+    EXPECT_EQ(provider.streams[3].handle, large);
+    EXPECT_EQ(provider.streams[3].firstLevel, 0u);
+    EXPECT_EQ(streamer.getUsage(), streamer.getBudget());
+}
+
+TEST(TextureStreamer, MaxStreamingCount) {
+    FakeProvider provider;
+    TextureStreamer streamer;
+
+    streamer.setProvider(&provider);
+    streamer.setMaxStreamingCount(2);
+
+    std::vector<Resource::Handle> textures;
+    for (uint32_t i = 0; i < 4; ++i) {
+        textures.push_back(createTexture(provider, i, 512));
+        EXPECT_TRUE(streamer.track(textures.back(), 512, 512, getLevelsCount(512), 3));
+    }
+
+    for (const Resource::Handle texture : textures) {
+        streamer.request(texture, 512.0f);
+    }
+
+    streamer.nextFrame();
+    ASSERT_EQ(provider.streams.size(), 2u);
+    EXPECT_EQ(streamer.getStats().streamingCount, 2u);
+
+    // The streams are finished in any order
+    streamer.finishStream(provider.streams[1].handle, true);
+
+    for (const Resource::Handle texture : textures) {
+        streamer.request(texture, 512.0f);
+    }
+
+    streamer.nextFrame();
+    EXPECT_EQ(provider.streams.size(), 3u);
+    EXPECT_EQ(streamer.getStats().streamingCount, 2u);
+}
+
+TEST(TextureStreamer, Failure) {
+    FakeProvider provider;
+    TextureStreamer streamer;
+
+    streamer.setProvider(&provider);
+
+    const Resource::Handle texture = createTexture(provider, 0, 1024);
+    EXPECT_TRUE(streamer.track(texture, 1024, 1024, 11, 4));
+
+    const uint64_t usage = streamer.getUsage();
+
+    // The provider can't start the stream
+    provider.fail = true;
+    streamer.request(texture, 1024.0f);
+    streamer.nextFrame();
+
+    EXPECT_FALSE(streamer.isStreaming(texture));
+    EXPECT_EQ(streamer.getUsage(), usage);
+
+    // The stream fails, the texture keeps its levels and is streamed again
+    provider.fail = false;
+    streamer.request(texture, 1024.0f);
+    streamer.nextFrame();
+
+    ASSERT_EQ(provider.streams.size(), 1u);
+    streamer.finishStream(texture, false);
+
+    EXPECT_EQ(streamer.getResidentLevel(texture), 4u);
+    EXPECT_EQ(streamer.getUsage(), usage);
+
+    streamer.request(texture, 1024.0f);
+    streamer.nextFrame();
+    EXPECT_EQ(provider.streams.size(), 2u);
+
+    // A texture untracked during its stream
+    streamer.untrack(texture);
+    streamer.finishStream(texture, true);
+
+    EXPECT_EQ(streamer.getUsage(), 0u);
+    EXPECT_EQ(streamer.getStats().streamingCount, 0u);
+}
+
+} // Graphics
+} // lug
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include <lug/Graphics/Vulkan/Render/MaterialTable.hpp>
+#include <lug/Graphics/Vulkan/Render/Technique/Forward.hpp>
+
+namespace lug {
+namespace Graphics {
+
+using RowAllocator = Vulkan::Render::MaterialTable::RowAllocator;
+
+static constexpr uint32_t maxMaterialsCount = Vulkan::Render::Technique::Forward::maxMaterialsCount;
+
+TEST(MaterialTable, Rows) {
+    RowAllocator rows;
+    rows.init(4);
+
+    uint32_t index;
+    bool newRow;
+
+    ASSERT_TRUE(rows.getIndex(10, index, &newRow));
+    EXPECT_EQ(index, 0u);
+    EXPECT_TRUE(newRow);
+
+    ASSERT_TRUE(rows.getIndex(10, index, &newRow));
+    EXPECT_EQ(index, 0u);
+    EXPECT_FALSE(newRow);
+
+    EXPECT_TRUE(rows.release(10));
+    EXPECT_FALSE(rows.release(10));
+    EXPECT_FALSE(rows.release(11));
+
+    // The released row is reused, and has to be written again
+    ASSERT_TRUE(rows.getIndex(11, index, &newRow));
+    EXPECT_EQ(index, 0u);
+    EXPECT_TRUE(newRow);
+}
+
+TEST(MaterialTable, Full) {
+    RowAllocator rows;
+    rows.init(maxMaterialsCount);
+
+    uint32_t index;
+    for (uint32_t handle = 0; handle < maxMaterialsCount; ++handle) {
+        ASSERT_TRUE(rows.getIndex(handle, index));
+    }
+
+    EXPECT_FALSE(rows.getIndex(maxMaterialsCount, index));
+
+    ASSERT_TRUE(rows.release(42));
+    ASSERT_TRUE(rows.getIndex(maxMaterialsCount, index));
+    EXPECT_EQ(index, 42u);
+}
+
+TEST(MaterialTable, Churn) {
+    constexpr uint32_t liveMaterialsCount = 256;
+
+    RowAllocator rows;
+    rows.init(maxMaterialsCount);
+
+    // Several times more materials than rows over time, e.g. scenes loaded and removed again and again
+    std::vector<bool> usedRows(maxMaterialsCount, false);
+    std::vector<uint32_t> indices;
+
+    for (uint32_t handle = 0; handle < 4 * maxMaterialsCount; ++handle) {
+        uint32_t index;
+        bool newRow;
+
+        ASSERT_TRUE(rows.getIndex(handle, index, &newRow)) << "handle " << handle;
+        EXPECT_TRUE(newRow);
+        ASSERT_LT(index, rows.getMaxRowsCount());
+
+        // A row is never given to two live materials
+        EXPECT_FALSE(usedRows[index]);
+        usedRows[index] = true;
+        indices.push_back(index);
+
+        if (handle >= liveMaterialsCount) {
+            const uint32_t removedHandle = handle - liveMaterialsCount;
+
+            ASSERT_TRUE(rows.release(removedHandle));
+            usedRows[indices[removedHandle]] = false;
+        }
+    }
+}
+
+} // Graphics
+} // lug
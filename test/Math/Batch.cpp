@@ -0,0 +1,694 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <lug/Math/Batch.hpp>
+#include <lug/Math/Geometry/Intersection.hpp>
+#include <lug/Math/Geometry/Transform.hpp>
+#include <lug/Math/Packing.hpp>
+
+namespace lug {
+namespace Math {
+
+namespace {
+
+// Not a multiple of the width of the packs, so that the remaining elements are tested
+constexpr size_t count = 77;
+
+// Calls the function with each instruction set supported, then restores the current one
+template <typename Function>
+void forEachInstructionSet(Function function) {
+    const Batch::InstructionSet current = Batch::getInstructionSet();
+
+    for (Batch::InstructionSet instructionSet : {Batch::InstructionSet::Scalar, Batch::InstructionSet::SSE2, Batch::InstructionSet::AVX2, Batch::InstructionSet::NEON}) {
+        if (Batch::setInstructionSet(instructionSet)) {
+            SCOPED_TRACE(static_cast<int>(instructionSet));
+            function();
+        }
+    }
+
+    Batch::setInstructionSet(current);
+}
+
+Batch::Vec3Array createVectors(std::mt19937& generator, float min, float max) {
+    std::uniform_real_distribution<float> distribution(min, max);
+
+    Batch::Vec3Array vectors(count);
+    for (size_t i = 0; i < count; ++i) {
+        vectors.set(i, {distribution(generator), distribution(generator), distribution(generator)});
+    }
+
+    return vectors;
+}
+
+Mat4x4f createTransform(std::mt19937& generator) {
+    std::uniform_real_distribution<float> distribution(-3.0f, 3.0f);
+
+    return Geometry::translate(Vec3f{distribution(generator), distribution(generator), distribution(generator)})
+        * Geometry::rotate(distribution(generator), normalize(Vec3f{distribution(generator), distribution(generator), 1.0f}))
+        * Geometry::scale(Vec3f{1.5f, -0.5f, 2.0f});
+}
+
+void expectNear(const Vec3f& lhs, const Vec3f& rhs, float error) {
+    EXPECT_NEAR(lhs.x(), rhs.x(), error);
+    EXPECT_NEAR(lhs.y(), rhs.y(), error);
+    EXPECT_NEAR(lhs.z(), rhs.z(), error);
+}
+
+Batch::QuatArray createRotations(std::mt19937& generator) {
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+    Batch::QuatArray rotations(count);
+    for (size_t i = 0; i < count; ++i) {
+        rotations.set(i, normalize(Quatf(distribution(generator), distribution(generator), distribution(generator), distribution(generator))));
+    }
+
+    return rotations;
+}
+
+// Angle of the rotation from lhs to rhs, more precise than acos for the small angles
+float angle(const Quatf& lhs, const Quatf& rhs) {
+    const Quatf difference = conjugate(lhs) * rhs;
+    const float sine = std::sqrt(difference.x() * difference.x() + difference.y() * difference.y() + difference.z() * difference.z());
+
+    return 2.0f * std::atan2(sine, std::abs(difference.w()));
+}
+
+bool isVisible(const std::vector<uint32_t>& visibility, size_t idx) {
+    return (visibility[idx / 32] >> (idx % 32)) & 1;
+}
+
+// The cube [-1, 1]^3
+const Vec4f cubePlanes[6] = {
+    Vec4f{1.0f, 0.0f, 0.0f, 1.0f},
+    Vec4f{-1.0f, 0.0f, 0.0f, 1.0f},
+    Vec4f{0.0f, 1.0f, 0.0f, 1.0f},
+    Vec4f{0.0f, -1.0f, 0.0f, 1.0f},
+    Vec4f{0.0f, 0.0f, 1.0f, 1.0f},
+    Vec4f{0.0f, 0.0f, -1.0f, 1.0f}
+};
+
+} // anonymous
+
+TEST(Batch, InstructionSet) {
+    const Batch::InstructionSet current = Batch::getInstructionSet();
+
+    EXPECT_TRUE(Batch::setInstructionSet(Batch::InstructionSet::Scalar));
+    EXPECT_EQ(Batch::getInstructionSet(), Batch::InstructionSet::Scalar);
+
+    EXPECT_TRUE(Batch::setInstructionSet(current));
+    EXPECT_EQ(Batch::getInstructionSet(), current);
+}
+
+TEST(Batch, TransformPoints) {
+    std::mt19937 generator(42);
+
+    const Mat4x4f matrix = createTransform(generator);
+    const Batch::Vec3Array points = createVectors(generator, -10.0f, 10.0f);
+
+    forEachInstructionSet([&]() {
+        Batch::Vec3Array result(count);
+        Batch::transformPoints(matrix, points.getStream(), result.getStream(), count);
+
+        for (size_t i = 0; i < count; ++i) {
+            expectNear(result.get(i), matrix * points.get(i), 1e-4f);
+        }
+
+        // In place
+        result = points;
+        Batch::transformPoints(matrix, result.getStream(), result.getStream(), count);
+
+        for (size_t i = 0; i < count; ++i) {
+            expectNear(result.get(i), matrix * points.get(i), 1e-4f);
+        }
+    });
+}
+
+TEST(Batch, TransformNormals) {
+    std::mt19937 generator(42);
+
+    const Mat4x4f matrix = createTransform(generator);
+    const Batch::Vec3Array normals = createVectors(generator, -1.0f, 1.0f);
+
+    const Mat3x3f inverse = Mat3x3f{
+        matrix(0, 0), matrix(0, 1), matrix(0, 2),
+        matrix(1, 0), matrix(1, 1), matrix(1, 2),
+        matrix(2, 0), matrix(2, 1), matrix(2, 2)
+    }.inverse();
+
+    forEachInstructionSet([&]() {
+        Batch::Vec3Array result(count);
+        Batch::transformNormals(matrix, normals.getStream(), result.getStream(), count);
+
+        for (size_t i = 0; i < count; ++i) {
+            const Vec3f normal = normals.get(i);
+
+            // Multiplied by the transpose of the inverse
+            Vec3f expected(0.0f);
+            for (uint8_t row = 0; row < 3; ++row) {
+                for (uint8_t col = 0; col < 3; ++col) {
+                    expected(row) += inverse(col, row) * normal(col);
+                }
+            }
+
+            expectNear(result.get(i), normalize(expected), 1e-5f);
+        }
+    });
+}
+
+TEST(Batch, ComposeTransforms) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+    const Batch::Vec3Array translations = createVectors(generator, -10.0f, 10.0f);
+    const Batch::Vec3Array scales = createVectors(generator, 0.1f, 4.0f);
+
+    std::vector<Quatf> rotations;
+    std::vector<float> rotationsComponents[4];
+    for (size_t i = 0; i < count; ++i) {
+        Quatf rotation(distribution(generator), distribution(generator), distribution(generator), distribution(generator));
+        rotation.normalize();
+
+        rotations.push_back(rotation);
+        for (uint8_t component = 0; component < 4; ++component) {
+            rotationsComponents[component].push_back(rotation[component]);
+        }
+    }
+
+    const Batch::ConstQuatStream rotationsStream{
+        rotationsComponents[0].data(),
+        rotationsComponents[1].data(),
+        rotationsComponents[2].data(),
+        rotationsComponents[3].data()
+    };
+
+    forEachInstructionSet([&]() {
+        std::vector<Mat4x4f> result(count);
+        Batch::composeTransforms(translations.getStream(), rotationsStream, scales.getStream(), result.data(), count);
+
+        for (size_t i = 0; i < count; ++i) {
+            const Mat4x4f expected = Geometry::translate(translations.get(i)) * rotations[i].transform() * Geometry::scale(scales.get(i));
+
+            for (uint8_t row = 0; row < 4; ++row) {
+                for (uint8_t col = 0; col < 4; ++col) {
+                    EXPECT_NEAR(result[i](row, col), expected(row, col), 1e-5f);
+                }
+            }
+        }
+    });
+}
+
+TEST(Batch, Multiply) {
+    std::mt19937 generator(42);
+
+    std::vector<Mat4x4f> lhs;
+    std::vector<Mat4x4f> rhs;
+    for (size_t i = 0; i < count; ++i) {
+        lhs.push_back(createTransform(generator));
+        rhs.push_back(createTransform(generator));
+    }
+
+    std::vector<Mat4x4f> result(count);
+    Batch::multiply(lhs.data(), rhs.data(), result.data(), count);
+
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(result[i], lhs[i] * rhs[i]);
+    }
+
+    // In place
+    result = rhs;
+    Batch::multiply(lhs[0], result.data(), result.data(), count);
+
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(result[i], lhs[0] * rhs[i]);
+    }
+}
+
+TEST(Batch, TransformAabbs) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(0.0f, 5.0f);
+
+    const Mat4x4f matrix = createTransform(generator);
+    const Batch::Vec3Array mins = createVectors(generator, -10.0f, 10.0f);
+
+    Batch::Vec3Array maxs(count);
+    for (size_t i = 0; i < count; ++i) {
+        maxs.set(i, mins.get(i) + Vec3f{distribution(generator), distribution(generator), distribution(generator)});
+    }
+
+    forEachInstructionSet([&]() {
+        Batch::Vec3Array resultMins(count);
+        Batch::Vec3Array resultMaxs(count);
+        Batch::transformAabbs(matrix, mins.getStream(), maxs.getStream(), resultMins.getStream(), resultMaxs.getStream(), count);
+
+        for (size_t i = 0; i < count; ++i) {
+            // Box of the transformed corners
+            Vec3f expectedMin(std::numeric_limits<float>::max());
+            Vec3f expectedMax(std::numeric_limits<float>::lowest());
+
+            for (uint8_t corner = 0; corner < 8; ++corner) {
+                const Vec3f point = matrix * Vec3f{
+                    (corner & 1 ? maxs : mins).get(i).x(),
+                    (corner & 2 ? maxs : mins).get(i).y(),
+                    (corner & 4 ? maxs : mins).get(i).z()
+                };
+
+                for (uint8_t axis = 0; axis < 3; ++axis) {
+                    expectedMin(axis) = std::min(expectedMin(axis), point(axis));
+                    expectedMax(axis) = std::max(expectedMax(axis), point(axis));
+                }
+            }
+
+            expectNear(resultMins.get(i), expectedMin, 1e-4f);
+            expectNear(resultMaxs.get(i), expectedMax, 1e-4f);
+        }
+    });
+}
+
+TEST(Batch, CullSpheres) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+
+    const Batch::Vec3Array centers = createVectors(generator, -3.0f, 3.0f);
+
+    std::vector<float> radii;
+    for (size_t i = 0; i < count; ++i) {
+        radii.push_back(distribution(generator));
+    }
+
+    forEachInstructionSet([&]() {
+        std::vector<uint32_t> visibility(Batch::getMaskSize(count), 0xFFFFFFFF);
+        Batch::cullSpheres(cubePlanes, 6, centers.getStream(), radii.data(), visibility.data(), count);
+
+        for (size_t i = 0; i < count; ++i) {
+            const Vec3f center = centers.get(i);
+
+            bool expected = true;
+            for (uint8_t axis = 0; axis < 3; ++axis) {
+                expected = expected && std::abs(center(axis)) <= 1.0f + radii[i];
+            }
+
+            EXPECT_EQ(isVisible(visibility, i), expected) << "sphere " << i;
+        }
+
+        // The bits after the last sphere are cleared
+        EXPECT_EQ(visibility.back() >> (count % 32), 0u);
+    });
+}
+
+TEST(Batch, CullAabbs) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+
+    const Batch::Vec3Array mins = createVectors(generator, -3.0f, 3.0f);
+
+    Batch::Vec3Array maxs(count);
+    for (size_t i = 0; i < count; ++i) {
+        maxs.set(i, mins.get(i) + Vec3f{distribution(generator), distribution(generator), distribution(generator)});
+    }
+
+    forEachInstructionSet([&]() {
+        std::vector<uint32_t> visibility(Batch::getMaskSize(count));
+        Batch::cullAabbs(cubePlanes, 6, mins.getStream(), maxs.getStream(), visibility.data(), count);
+
+        for (size_t i = 0; i < count; ++i) {
+            bool expected = true;
+            for (uint8_t axis = 0; axis < 3; ++axis) {
+                expected = expected && maxs.get(i)(axis) >= -1.0f && mins.get(i)(axis) <= 1.0f;
+            }
+
+            EXPECT_EQ(isVisible(visibility, i), expected) << "box " << i;
+        }
+    });
+}
+
+TEST(Batch, IntersectSpheres) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+
+    const Batch::Vec3Array centers = createVectors(generator, -3.0f, 3.0f);
+
+    std::vector<float> radii;
+    for (size_t i = 0; i < count; ++i) {
+        radii.push_back(distribution(generator));
+    }
+
+    const Geometry::Spheref light{{0.5f, -0.5f, 0.0f}, 1.5f};
+
+    forEachInstructionSet([&]() {
+        std::vector<uint32_t> hits(Batch::getMaskSize(count), 0xFFFFFFFF);
+        Batch::intersectSpheres(light, centers.getStream(), radii.data(), hits.data(), count);
+
+        for (size_t i = 0; i < count; ++i) {
+            EXPECT_EQ(isVisible(hits, i), Geometry::intersects(light, Geometry::Spheref{centers.get(i), radii[i]})) << "sphere " << i;
+        }
+    });
+}
+
+TEST(Batch, IntersectRayAabbs) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(0.0f, 2.0f);
+
+    const Batch::Vec3Array mins = createVectors(generator, -3.0f, 3.0f);
+
+    Batch::Vec3Array maxs(count);
+    for (size_t i = 0; i < count; ++i) {
+        maxs.set(i, mins.get(i) + Vec3f{distribution(generator), distribution(generator), distribution(generator)});
+    }
+
+    // The null component of the direction is handled by the infinite distances
+    const Geometry::Rayf ray{{-5.0f, 0.2f, -0.3f}, normalize(Vec3f{1.0f, 0.1f, 0.0f})};
+
+    forEachInstructionSet([&]() {
+        std::vector<float> distances(count);
+        std::vector<uint32_t> hits(Batch::getMaskSize(count));
+        Batch::intersectRayAabbs(ray, mins.getStream(), maxs.getStream(), distances.data(), hits.data(), count);
+
+        size_t hitsCount = 0;
+        for (size_t i = 0; i < count; ++i) {
+            float distance = 0.0f;
+            const bool expected = Geometry::intersects(ray, Geometry::Aabbf{mins.get(i), maxs.get(i)}, distance);
+
+            EXPECT_EQ(isVisible(hits, i), expected) << "box " << i;
+            if (expected) {
+                EXPECT_NEAR(distances[i], distance, 1e-4f) << "box " << i;
+                ++hitsCount;
+            }
+        }
+
+        EXPECT_GT(hitsCount, 0u);
+    });
+}
+
+TEST(Batch, IntersectRayTriangles) {
+    std::mt19937 generator(42);
+
+    const Batch::Vec3Array v0 = createVectors(generator, -2.0f, 2.0f);
+    const Batch::Vec3Array v1 = createVectors(generator, -2.0f, 2.0f);
+    const Batch::Vec3Array v2 = createVectors(generator, -2.0f, 2.0f);
+
+    const Geometry::Rayf ray{{0.1f, -0.2f, -5.0f}, normalize(Vec3f{0.05f, 0.02f, 1.0f})};
+
+    forEachInstructionSet([&]() {
+        std::vector<float> distances(count);
+        std::vector<uint32_t> hits(Batch::getMaskSize(count));
+        Batch::intersectRayTriangles(ray, v0.getStream(), v1.getStream(), v2.getStream(), distances.data(), hits.data(), count);
+
+        size_t hitsCount = 0;
+        for (size_t i = 0; i < count; ++i) {
+            float distance = 0.0f;
+            const bool expected = Geometry::intersects(ray, v0.get(i), v1.get(i), v2.get(i), distance);
+
+            EXPECT_EQ(isVisible(hits, i), expected) << "triangle " << i;
+            if (expected) {
+                EXPECT_NEAR(distances[i], distance, 1e-3f) << "triangle " << i;
+                ++hitsCount;
+            }
+        }
+
+        EXPECT_GT(hitsCount, 0u);
+    });
+}
+
+TEST(Batch, PackHalf) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-70000.0f, 70000.0f);
+
+    std::vector<float> values(count);
+    for (size_t i = 0; i < count; ++i) {
+        values[i] = distribution(generator) * std::pow(10.0f, -static_cast<float>(i % 10));
+    }
+
+    // Subnormals, ties and specials
+    values[0] = std::ldexp(1.0f, -24);
+    values[1] = -std::ldexp(3.0f, -26);
+    values[2] = 1.0f + 1.0f / 2048.0f;
+    values[3] = 65520.0f;
+    values[4] = std::numeric_limits<float>::infinity();
+    values[5] = std::numeric_limits<float>::quiet_NaN();
+    values[6] = -0.0f;
+
+    forEachInstructionSet([&]() {
+        std::vector<uint16_t> halves(count);
+        Batch::packHalf(values.data(), halves.data(), count);
+
+        std::vector<float> unpacked(count);
+        Batch::unpackHalf(halves.data(), unpacked.data(), count);
+
+        for (size_t i = 0; i < count; ++i) {
+            EXPECT_EQ(halves[i], Packing::packHalf(values[i])) << "value " << i;
+
+            const float expected = Packing::unpackHalf(halves[i]);
+            if (std::isnan(expected)) {
+                EXPECT_TRUE(std::isnan(unpacked[i])) << "value " << i;
+            } else {
+                EXPECT_EQ(unpacked[i], expected) << "value " << i;
+            }
+        }
+    });
+}
+
+TEST(Batch, PackNormalized) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-1.5f, 1.5f);
+
+    std::vector<float> values(count);
+    for (size_t i = 0; i < count; ++i) {
+        values[i] = distribution(generator);
+    }
+
+    forEachInstructionSet([&]() {
+        std::vector<int8_t> snorms8(count);
+        std::vector<uint8_t> unorms8(count);
+        std::vector<int16_t> snorms16(count);
+        std::vector<uint16_t> unorms16(count);
+
+        Batch::packSnorm8(values.data(), snorms8.data(), count);
+        Batch::packUnorm8(values.data(), unorms8.data(), count);
+        Batch::packSnorm16(values.data(), snorms16.data(), count);
+        Batch::packUnorm16(values.data(), unorms16.data(), count);
+
+        // ARMv7 rounds the ties away from zero
+        for (size_t i = 0; i < count; ++i) {
+            EXPECT_LE(std::abs(snorms8[i] - Packing::packSnorm8(values[i])), 1) << "value " << i;
+            EXPECT_LE(std::abs(unorms8[i] - Packing::packUnorm8(values[i])), 1) << "value " << i;
+            EXPECT_LE(std::abs(snorms16[i] - Packing::packSnorm16(values[i])), 1) << "value " << i;
+            EXPECT_LE(std::abs(unorms16[i] - Packing::packUnorm16(values[i])), 1) << "value " << i;
+        }
+    });
+}
+
+TEST(Batch, EncodeOctahedral) {
+    std::mt19937 generator(42);
+
+    Batch::Vec3Array normals = createVectors(generator, -1.0f, 1.0f);
+    normals.set(0, {0.0f, 0.0f, -1.0f});
+    normals.set(1, {0.0f, -0.6f, -0.8f});
+
+    forEachInstructionSet([&]() {
+        std::vector<int16_t> octahedrals(count * 2);
+        Batch::encodeOctahedral(normals.getStream(), octahedrals.data(), count);
+
+        for (size_t i = 0; i < count; ++i) {
+            const Vec2f expected = Packing::encodeOctahedral(normals.get(i));
+
+            EXPECT_LE(std::abs(octahedrals[i * 2] - Packing::packSnorm16(expected.x())), 1) << "normal " << i;
+            EXPECT_LE(std::abs(octahedrals[i * 2 + 1] - Packing::packSnorm16(expected.y())), 1) << "normal " << i;
+        }
+    });
+}
+
+TEST(Batch, EncodeQTangent) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+    Batch::Vec3Array normals(count);
+    Batch::Vec3Array tangents(count);
+    std::vector<float> handedness(count);
+    for (size_t i = 0; i < count; ++i) {
+        normals.set(i, normalize(Vec3f{distribution(generator), distribution(generator), distribution(generator)}));
+        tangents.set(i, {distribution(generator), distribution(generator), distribution(generator)});
+        handedness[i] = i % 3 ? 1.0f : -1.0f;
+    }
+
+    // Half turns, whose w is null
+    normals.set(0, {0.0f, 0.0f, -1.0f});
+    tangents.set(0, {-1.0f, 0.0f, 0.0f});
+    normals.set(1, {0.0f, 1.0f, 0.0f});
+    tangents.set(1, {0.0f, 0.0f, 1.0f});
+
+    forEachInstructionSet([&]() {
+        std::vector<int16_t> qTangents(count * 4);
+        Batch::encodeQTangent(normals.getStream(), tangents.getStream(), handedness.data(), qTangents.data(), count);
+
+        for (size_t i = 0; i < count; ++i) {
+            const int16_t* packed = qTangents.data() + i * 4;
+            EXPECT_NE(packed[3], 0) << "frame " << i;
+
+            Quatf qTangent(
+                Packing::unpackSnorm16(packed[3]),
+                Packing::unpackSnorm16(packed[0]),
+                Packing::unpackSnorm16(packed[1]),
+                Packing::unpackSnorm16(packed[2])
+            );
+            qTangent.normalize();
+
+            Vec3f normal;
+            Vec4f tangent;
+            Packing::decodeQTangent(qTangent, normal, tangent);
+
+            const Vec3f expectedNormal = normals.get(i);
+            const Vec3f expectedTangent = normalize(Vec3f(tangents.get(i) - expectedNormal * dot(expectedNormal, tangents.get(i))));
+
+            expectNear(normal, expectedNormal, 1e-3f);
+            expectNear(Vec3f(tangent), expectedTangent, 1e-3f);
+            EXPECT_EQ(tangent.w(), handedness[i]) << "frame " << i;
+        }
+    });
+}
+
+TEST(Batch, Lerp) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+
+    const Batch::Vec3Array lhs = createVectors(generator, -10.0f, 10.0f);
+    const Batch::Vec3Array rhs = createVectors(generator, -10.0f, 10.0f);
+
+    std::vector<float> factors(count);
+    for (float& factor : factors) {
+        factor = distribution(generator);
+    }
+
+    forEachInstructionSet([&]() {
+        Batch::Vec3Array result(count);
+        Batch::lerp(lhs.getStream(), rhs.getStream(), factors.data(), result.getStream(), count);
+
+        for (size_t i = 0; i < count; ++i) {
+            expectNear(result.get(i), Vec3f(lhs.get(i) * (1.0f - factors[i]) + rhs.get(i) * factors[i]), 1e-5f);
+        }
+    });
+}
+
+TEST(Batch, Nlerp) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+
+    const Batch::QuatArray lhs = createRotations(generator);
+    const Batch::QuatArray rhs = createRotations(generator);
+
+    std::vector<float> factors(count);
+    for (float& factor : factors) {
+        factor = distribution(generator);
+    }
+
+    forEachInstructionSet([&]() {
+        Batch::QuatArray result(count);
+        Batch::nlerp(lhs.getStream(), rhs.getStream(), factors.data(), result.getStream(), count);
+
+        for (size_t i = 0; i < count; ++i) {
+            const Quatf expected = nlerp(lhs.get(i), rhs.get(i), factors[i]);
+
+            for (uint8_t component = 0; component < 4; ++component) {
+                EXPECT_NEAR(result.get(i)[component], expected[component], 1e-5f);
+            }
+        }
+    });
+}
+
+TEST(Batch, Slerp) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+
+    const Batch::QuatArray lhs = createRotations(generator);
+    const Batch::QuatArray rhs = createRotations(generator);
+
+    std::vector<float> factors(count);
+    for (float& factor : factors) {
+        factor = distribution(generator);
+    }
+
+    // The bounds are exact
+    factors[0] = 0.0f;
+    factors[1] = 1.0f;
+
+    forEachInstructionSet([&]() {
+        Batch::QuatArray result(count);
+        Batch::slerp(lhs.getStream(), rhs.getStream(), factors.data(), result.getStream(), count);
+
+        for (size_t i = 0; i < count; ++i) {
+            EXPECT_NEAR(result.get(i).length(), 1.0f, 1e-5f);
+            EXPECT_LT(angle(result.get(i), slerp(lhs.get(i), rhs.get(i), factors[i])), 1e-3f) << "rotation " << i;
+        }
+
+        EXPECT_LT(angle(result.get(0), lhs.get(0)), 1e-3f);
+        EXPECT_LT(angle(result.get(1), rhs.get(1)), 1e-3f);
+    });
+}
+
+#if defined(ENABLE_LONG_TESTS)
+
+TEST(Batch, Throughput) {
+    constexpr size_t pointsCount = 1 << 20;
+    constexpr uint32_t iterations = 50;
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-10.0f, 10.0f);
+
+    const Mat4x4f matrix = createTransform(generator);
+
+    std::vector<Vec3f> points;
+    Batch::Vec3Array pointsArray(pointsCount);
+    std::vector<float> radii(pointsCount, 0.5f);
+    for (size_t i = 0; i < pointsCount; ++i) {
+        points.push_back({distribution(generator), distribution(generator), distribution(generator)});
+        pointsArray.set(i, points.back());
+    }
+
+    std::vector<Vec3f> result(pointsCount);
+    Batch::Vec3Array resultArray(pointsCount);
+    std::vector<uint32_t> visibility(Batch::getMaskSize(pointsCount));
+
+    const auto benchmark = [&](const char* name, const auto& function) {
+        const auto start = std::chrono::high_resolution_clock::now();
+        for (uint32_t i = 0; i < iterations; ++i) {
+            function();
+        }
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        const double seconds = std::chrono::duration<double>(end - start).count();
+
+        std::cout << name << ": " << pointsCount * iterations / seconds / 1e6 << " M/s" << std::endl;
+    };
+
+    benchmark("Mat4x4f * Vec3f", [&]() {
+        for (size_t i = 0; i < pointsCount; ++i) {
+            result[i] = matrix * points[i];
+        }
+    });
+
+    forEachInstructionSet([&]() {
+        std::cout << "Instruction set " << static_cast<int>(Batch::getInstructionSet()) << std::endl;
+
+        benchmark("  transformPoints", [&]() {
+            Batch::transformPoints(matrix, pointsArray.getStream(), resultArray.getStream(), pointsCount);
+        });
+
+        benchmark("  cullSpheres", [&]() {
+            Batch::cullSpheres(cubePlanes, 6, pointsArray.getStream(), radii.data(), visibility.data(), pointsCount);
+        });
+    });
+
+    // Use the results so that they are not optimized out
+    expectNear(result[42], resultArray.get(42), 1e-3f);
+}
+
+#endif
+
+} // Math
+} // lug
@@ -0,0 +1,331 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <lug/Math/Batch.hpp>
+#include <lug/Math/Geometry/Intersection.hpp>
+#include <lug/Math/Geometry/Transform.hpp>
+#include <lug/Math/Geometry/Trigonometry.hpp>
+
+namespace lug {
+namespace Math {
+
+namespace {
+
+// The camera at (0, 0, 5) looking at the origin, the near and far planes at 1 and 10
+Mat4x4f createViewProjection() {
+    return Geometry::perspective(Geometry::radians(90.0f), 1.0f, 1.0f, 10.0f)
+        * Geometry::lookAt(Vec3f{0.0f, 0.0f, 5.0f}, Vec3f(0.0f), Vec3f{0.0f, 1.0f, 0.0f});
+}
+
+} // anonymous
+
+TEST(Geometry, Plane) {
+    const Geometry::Planef plane(Vec3f{0.0f, 1.0f, 0.0f}, Vec3f{3.0f, 2.0f, 1.0f});
+
+    EXPECT_FLOAT_EQ(plane.distance, -2.0f);
+    EXPECT_FLOAT_EQ(plane.getDistance(Vec3f{0.0f, 5.0f, 0.0f}), 3.0f);
+    EXPECT_FLOAT_EQ(plane.getDistance(Vec3f{0.0f, -1.0f, 0.0f}), -3.0f);
+
+    // The coefficients are normalized
+    const Geometry::Planef coefficients(Vec4f{0.0f, 0.0f, 2.0f, 4.0f});
+
+    EXPECT_FLOAT_EQ(coefficients.normal.z(), 1.0f);
+    EXPECT_FLOAT_EQ(coefficients.distance, 2.0f);
+}
+
+TEST(Geometry, Aabb) {
+    Geometry::Aabbf aabb{Vec3f{-1.0f, 0.0f, 1.0f}, Vec3f{1.0f, 2.0f, 5.0f}};
+
+    EXPECT_EQ(aabb.getCenter(), (Vec3f{0.0f, 1.0f, 3.0f}));
+    EXPECT_EQ(aabb.getExtent(), (Vec3f{1.0f, 1.0f, 2.0f}));
+    EXPECT_TRUE(aabb.contains(Vec3f{0.5f, 0.5f, 4.0f}));
+    EXPECT_FALSE(aabb.contains(Vec3f{0.5f, 0.5f, 6.0f}));
+
+    aabb.extend(Vec3f{-3.0f, 1.0f, 1.0f});
+    aabb.extend(Geometry::Aabbf{Vec3f(0.0f), Vec3f{0.0f, 0.0f, 8.0f}});
+
+    EXPECT_EQ(aabb.min, (Vec3f{-3.0f, 0.0f, 0.0f}));
+    EXPECT_EQ(aabb.max, (Vec3f{1.0f, 2.0f, 8.0f}));
+
+    // The transformed box contains the transformed corners
+    const Mat4x4f matrix = Geometry::translate(Vec3f{1.0f, 2.0f, 3.0f}) * Geometry::rotate(0.7f, Vec3f{1.0f, 1.0f, 0.0f});
+    const Geometry::Aabbf transformed = aabb.transform(matrix);
+
+    for (uint8_t corner = 0; corner < 8; ++corner) {
+        const Vec3f point{
+            corner & 1 ? aabb.max.x() : aabb.min.x(),
+            corner & 2 ? aabb.max.y() : aabb.min.y(),
+            corner & 4 ? aabb.max.z() : aabb.min.z()
+        };
+
+        const Vec3f transformedPoint = matrix * point;
+
+        for (uint8_t axis = 0; axis < 3; ++axis) {
+            EXPECT_GE(transformedPoint(axis), transformed.min(axis) - 1e-4f);
+            EXPECT_LE(transformedPoint(axis), transformed.max(axis) + 1e-4f);
+        }
+    }
+}
+
+TEST(Geometry, Obb) {
+    const Geometry::Aabbf aabb{Vec3f(-1.0f), Vec3f(1.0f)};
+    const Mat4x4f matrix = Geometry::translate(Vec3f{5.0f, 0.0f, 0.0f})
+        * Geometry::rotate(Geometry::radians(45.0f), Vec3f{0.0f, 0.0f, 1.0f})
+        * Geometry::scale(Vec3f{2.0f, 1.0f, 1.0f});
+
+    const Geometry::Obbf obb(aabb, matrix);
+
+    EXPECT_NEAR(obb.center.x(), 5.0f, 1e-5f);
+    EXPECT_NEAR(obb.extent.x(), 2.0f, 1e-5f);
+    EXPECT_NEAR(obb.extent.y(), 1.0f, 1e-5f);
+
+    // The points of the box stay inside once transformed
+    EXPECT_TRUE(obb.contains(matrix * Vec3f{0.9f, 0.9f, 0.9f}));
+    EXPECT_TRUE(obb.contains(matrix * Vec3f{-0.9f, 0.5f, -0.9f}));
+    EXPECT_FALSE(obb.contains(matrix * Vec3f{1.1f, 0.0f, 0.0f}));
+    EXPECT_FALSE(obb.contains(matrix * Vec3f{0.0f, 0.0f, -1.1f}));
+}
+
+TEST(Geometry, Frustum) {
+    const Geometry::Frustumf frustum(createViewProjection());
+
+    EXPECT_TRUE(frustum.contains(Vec3f(0.0f)));
+    EXPECT_TRUE(frustum.contains(Vec3f{0.0f, 0.0f, 3.5f}));
+    EXPECT_TRUE(frustum.contains(Vec3f{2.9f, 0.0f, 2.0f}));
+
+    // Behind the camera, before the near plane, after the far plane and on the sides
+    EXPECT_FALSE(frustum.contains(Vec3f{0.0f, 0.0f, 6.0f}));
+    EXPECT_FALSE(frustum.contains(Vec3f{0.0f, 0.0f, 4.5f}));
+    EXPECT_FALSE(frustum.contains(Vec3f{0.0f, 0.0f, -5.5f}));
+    EXPECT_FALSE(frustum.contains(Vec3f{3.1f, 0.0f, 2.0f}));
+    EXPECT_FALSE(frustum.contains(Vec3f{0.0f, -3.1f, 2.0f}));
+
+    // The planes face the inside
+    EXPECT_NEAR(frustum.getPlane(Geometry::Frustumf::Side::Near).normal.z(), -1.0f, 1e-5f);
+    EXPECT_NEAR(frustum.getPlane(Geometry::Frustumf::Side::Near).distance, 4.0f, 1e-4f);
+    EXPECT_NEAR(frustum.getPlane(Geometry::Frustumf::Side::Far).normal.z(), 1.0f, 1e-5f);
+    EXPECT_NEAR(frustum.getPlane(Geometry::Frustumf::Side::Far).distance, 5.0f, 1e-4f);
+}
+
+TEST(Geometry, FrustumIntersection) {
+    const Geometry::Frustumf frustum(createViewProjection());
+
+    EXPECT_TRUE(Geometry::intersects(frustum, Geometry::Aabbf{Vec3f(-0.5f), Vec3f(0.5f)}));
+    EXPECT_TRUE(Geometry::intersects(frustum, Geometry::Aabbf{Vec3f{2.5f, -0.5f, -0.5f}, Vec3f{10.0f, 0.5f, 0.5f}}));
+    EXPECT_FALSE(Geometry::intersects(frustum, Geometry::Aabbf{Vec3f{-1.0f, -1.0f, 6.0f}, Vec3f{1.0f, 1.0f, 8.0f}}));
+    EXPECT_FALSE(Geometry::intersects(frustum, Geometry::Aabbf{Vec3f{8.0f, -1.0f, -1.0f}, Vec3f{9.0f, 1.0f, 1.0f}}));
+
+    EXPECT_TRUE(Geometry::intersects(frustum, Geometry::Spheref{Vec3f{0.0f, 0.0f, 4.5f}, 0.6f}));
+    EXPECT_FALSE(Geometry::intersects(frustum, Geometry::Spheref{Vec3f{0.0f, 0.0f, 4.5f}, 0.4f}));
+    EXPECT_FALSE(Geometry::intersects(frustum, Geometry::Spheref{Vec3f{0.0f, 0.0f, -6.0f}, 0.9f}));
+
+    // A thin box crossing the side plane only when not rotated
+    const Geometry::Aabbf thin{Vec3f{-2.0f, -0.1f, -0.1f}, Vec3f{2.0f, 0.1f, 0.1f}};
+    const Mat4x4f rotation = Geometry::rotate(Geometry::radians(90.0f), Vec3f{0.0f, 0.0f, 1.0f});
+
+    EXPECT_FALSE(Geometry::intersects(frustum, Geometry::Obbf(thin, Geometry::translate(Vec3f{7.5f, 0.0f, 0.0f}))));
+    EXPECT_TRUE(Geometry::intersects(frustum, Geometry::Obbf(thin, Geometry::translate(Vec3f{5.5f, 0.0f, 0.0f}))));
+    EXPECT_FALSE(Geometry::intersects(frustum, Geometry::Obbf(thin, Geometry::translate(Vec3f{5.5f, 0.0f, 0.0f}) * rotation)));
+}
+
+TEST(Geometry, VolumeIntersection) {
+    EXPECT_TRUE(Geometry::intersects(Geometry::Spheref{Vec3f(0.0f), 1.0f}, Geometry::Spheref{Vec3f{1.5f, 0.0f, 0.0f}, 0.6f}));
+    EXPECT_FALSE(Geometry::intersects(Geometry::Spheref{Vec3f(0.0f), 1.0f}, Geometry::Spheref{Vec3f{1.5f, 0.0f, 0.0f}, 0.4f}));
+
+    const Geometry::Aabbf aabb{Vec3f(0.0f), Vec3f(1.0f)};
+
+    EXPECT_TRUE(Geometry::intersects(aabb, Geometry::Aabbf{Vec3f(0.5f), Vec3f(2.0f)}));
+    EXPECT_TRUE(Geometry::intersects(aabb, Geometry::Aabbf{Vec3f(1.0f), Vec3f(2.0f)}));
+    EXPECT_FALSE(Geometry::intersects(aabb, Geometry::Aabbf{Vec3f{0.0f, 0.0f, 1.5f}, Vec3f(2.0f)}));
+
+    // Near the corner, the sphere is closer to the box along the axes than along the diagonal
+    EXPECT_TRUE(Geometry::intersects(Geometry::Spheref{Vec3f{1.5f, 0.5f, 0.5f}, 0.6f}, aabb));
+    EXPECT_TRUE(Geometry::intersects(Geometry::Spheref{Vec3f(0.5f), 0.1f}, aabb));
+    EXPECT_FALSE(Geometry::intersects(Geometry::Spheref{Vec3f(1.5f), 0.6f}, aabb));
+}
+
+TEST(Geometry, RayAabb) {
+    const Geometry::Aabbf aabb{Vec3f(-1.0f), Vec3f(1.0f)};
+    float distance = -1.0f;
+
+    EXPECT_TRUE(Geometry::intersects(Geometry::Rayf{Vec3f{-5.0f, 0.0f, 0.0f}, Vec3f{1.0f, 0.0f, 0.0f}}, aabb, distance));
+    EXPECT_FLOAT_EQ(distance, 4.0f);
+
+    EXPECT_TRUE(Geometry::intersects(Geometry::Rayf{Vec3f{-5.0f, 0.5f, 0.5f}, Vec3f{2.0f, 0.0f, 0.0f}}, aabb, distance));
+    EXPECT_FLOAT_EQ(distance, 2.0f);
+
+    // Inside the box
+    EXPECT_TRUE(Geometry::intersects(Geometry::Rayf{Vec3f(0.0f), Vec3f{0.0f, 1.0f, 0.0f}}, aabb, distance));
+    EXPECT_FLOAT_EQ(distance, 0.0f);
+
+    // Parallel to the box, away from it and behind the ray
+    EXPECT_FALSE(Geometry::intersects(Geometry::Rayf{Vec3f{-5.0f, 2.0f, 0.0f}, Vec3f{1.0f, 0.0f, 0.0f}}, aabb, distance));
+    EXPECT_FALSE(Geometry::intersects(Geometry::Rayf{Vec3f{5.0f, 0.0f, 0.0f}, Vec3f{1.0f, 0.0f, 0.0f}}, aabb, distance));
+    EXPECT_FALSE(Geometry::intersects(Geometry::Rayf{Vec3f{-5.0f, 0.0f, 0.0f}, normalize(Vec3f{1.0f, 1.0f, 0.0f})}, aabb, distance));
+}
+
+TEST(Geometry, RayObb) {
+    const Geometry::Obbf obb(
+        Geometry::Aabbf{Vec3f(-1.0f), Vec3f(1.0f)},
+        Geometry::translate(Vec3f{5.0f, 0.0f, 0.0f}) * Geometry::rotate(Geometry::radians(45.0f), Vec3f{0.0f, 1.0f, 0.0f})
+    );
+
+    float distance = -1.0f;
+
+    // The corner of the box is toward the ray
+    EXPECT_TRUE(Geometry::intersects(Geometry::Rayf{Vec3f(0.0f), Vec3f{1.0f, 0.0f, 0.0f}}, obb, distance));
+    EXPECT_NEAR(distance, 5.0f - std::sqrt(2.0f), 1e-4f);
+
+    EXPECT_TRUE(Geometry::intersects(Geometry::Rayf{Vec3f{0.0f, 0.0f, 1.2f}, Vec3f{1.0f, 0.0f, 0.0f}}, obb, distance));
+    EXPECT_FALSE(Geometry::intersects(Geometry::Rayf{Vec3f{0.0f, 0.0f, 1.5f}, Vec3f{1.0f, 0.0f, 0.0f}}, obb, distance));
+}
+
+TEST(Geometry, RaySphere) {
+    const Geometry::Spheref sphere{Vec3f{0.0f, 0.0f, 10.0f}, 2.0f};
+    float distance = -1.0f;
+
+    EXPECT_TRUE(Geometry::intersects(Geometry::Rayf{Vec3f(0.0f), Vec3f{0.0f, 0.0f, 1.0f}}, sphere, distance));
+    EXPECT_FLOAT_EQ(distance, 8.0f);
+
+    EXPECT_TRUE(Geometry::intersects(Geometry::Rayf{Vec3f{0.0f, 0.0f, 10.0f}, Vec3f{0.0f, 0.0f, 1.0f}}, sphere, distance));
+    EXPECT_FLOAT_EQ(distance, 0.0f);
+
+    EXPECT_FALSE(Geometry::intersects(Geometry::Rayf{Vec3f(0.0f), Vec3f{0.0f, 0.0f, -1.0f}}, sphere, distance));
+    EXPECT_FALSE(Geometry::intersects(Geometry::Rayf{Vec3f{0.0f, 2.5f, 0.0f}, Vec3f{0.0f, 0.0f, 1.0f}}, sphere, distance));
+}
+
+TEST(Geometry, RayPlane) {
+    const Geometry::Planef plane(Vec3f{0.0f, 1.0f, 0.0f}, -2.0f);
+    float distance = -1.0f;
+
+    EXPECT_TRUE(Geometry::intersects(Geometry::Rayf{Vec3f(0.0f), Vec3f{0.0f, 1.0f, 0.0f}}, plane, distance));
+    EXPECT_FLOAT_EQ(distance, 2.0f);
+
+    EXPECT_TRUE(Geometry::intersects(Geometry::Rayf{Vec3f{0.0f, 5.0f, 0.0f}, Vec3f{0.0f, -1.0f, 0.0f}}, plane, distance));
+    EXPECT_FLOAT_EQ(distance, 3.0f);
+
+    EXPECT_FALSE(Geometry::intersects(Geometry::Rayf{Vec3f(0.0f), Vec3f{0.0f, -1.0f, 0.0f}}, plane, distance));
+    EXPECT_FALSE(Geometry::intersects(Geometry::Rayf{Vec3f(0.0f), Vec3f{1.0f, 0.0f, 0.0f}}, plane, distance));
+}
+
+TEST(Geometry, RayTriangle) {
+    const Vec3f v0{-1.0f, -1.0f, 3.0f};
+    const Vec3f v1{1.0f, -1.0f, 3.0f};
+    const Vec3f v2{0.0f, 1.0f, 3.0f};
+
+    float distance = -1.0f;
+
+    EXPECT_TRUE(Geometry::intersects(Geometry::Rayf{Vec3f(0.0f), Vec3f{0.0f, 0.0f, 1.0f}}, v0, v1, v2, distance));
+    EXPECT_FLOAT_EQ(distance, 3.0f);
+
+    // From the back side
+    EXPECT_TRUE(Geometry::intersects(Geometry::Rayf{Vec3f{0.0f, 0.0f, 5.0f}, Vec3f{0.0f, 0.0f, -1.0f}}, v0, v1, v2, distance));
+    EXPECT_FLOAT_EQ(distance, 2.0f);
+
+    // Outside the edges, behind the ray and parallel to the triangle
+    EXPECT_FALSE(Geometry::intersects(Geometry::Rayf{Vec3f{0.9f, 0.9f, 0.0f}, Vec3f{0.0f, 0.0f, 1.0f}}, v0, v1, v2, distance));
+    EXPECT_FALSE(Geometry::intersects(Geometry::Rayf{Vec3f(0.0f), Vec3f{0.0f, 0.0f, -1.0f}}, v0, v1, v2, distance));
+    EXPECT_FALSE(Geometry::intersects(Geometry::Rayf{Vec3f{0.0f, 0.0f, 3.0f}, Vec3f{1.0f, 0.0f, 0.0f}}, v0, v1, v2, distance));
+}
+
+#if defined(ENABLE_LONG_TESTS)
+
+TEST(Geometry, IntersectionThroughput) {
+    constexpr size_t objectsCount = 1 << 18;
+    constexpr uint32_t iterations = 50;
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> position(-20.0f, 20.0f);
+    std::uniform_real_distribution<float> size(0.1f, 1.0f);
+
+    const Geometry::Frustumf frustum(createViewProjection());
+    const Geometry::Rayf ray{Vec3f{0.0f, 0.0f, 30.0f}, normalize(Vec3f{0.1f, 0.05f, -1.0f})};
+
+    std::vector<Geometry::Aabbf> aabbs;
+    std::vector<Vec3f> triangles;
+    Batch::Vec3Array mins(objectsCount);
+    Batch::Vec3Array maxs(objectsCount);
+    Batch::Vec3Array v0(objectsCount);
+    Batch::Vec3Array v1(objectsCount);
+    Batch::Vec3Array v2(objectsCount);
+
+    for (size_t i = 0; i < objectsCount; ++i) {
+        const Vec3f min{position(generator), position(generator), position(generator)};
+        const Vec3f max = min + Vec3f{size(generator), size(generator), size(generator)};
+
+        aabbs.push_back({min, max});
+        mins.set(i, min);
+        maxs.set(i, max);
+
+        triangles.push_back(min);
+        triangles.push_back(max);
+        triangles.push_back(Vec3f{min.x(), max.y(), min.z()});
+        v0.set(i, triangles[i * 3]);
+        v1.set(i, triangles[i * 3 + 1]);
+        v2.set(i, triangles[i * 3 + 2]);
+    }
+
+    std::vector<float> distances(objectsCount);
+    std::vector<uint32_t> hits(Batch::getMaskSize(objectsCount));
+
+    // Accumulate the results so that the tests are not optimized out
+    size_t count = 0;
+
+    const auto benchmark = [&](const char* name, const auto& function) {
+        const auto start = std::chrono::high_resolution_clock::now();
+        for (uint32_t i = 0; i < iterations; ++i) {
+            function();
+        }
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        const double seconds = std::chrono::duration<double>(end - start).count();
+
+        std::cout << name << ": " << objectsCount * iterations / seconds / 1e6 << " M/s" << std::endl;
+    };
+
+    benchmark("Frustum / Aabb", [&]() {
+        for (const Geometry::Aabbf& aabb : aabbs) {
+            count += Geometry::intersects(frustum, aabb);
+        }
+    });
+
+    benchmark("Ray / Aabb", [&]() {
+        float distance;
+        for (const Geometry::Aabbf& aabb : aabbs) {
+            count += Geometry::intersects(ray, aabb, distance);
+        }
+    });
+
+    benchmark("Ray / Triangle", [&]() {
+        float distance;
+        for (size_t i = 0; i < objectsCount; ++i) {
+            count += Geometry::intersects(ray, triangles[i * 3], triangles[i * 3 + 1], triangles[i * 3 + 2], distance);
+        }
+    });
+
+    benchmark("Batch::cullAabbs", [&]() {
+        Batch::cullAabbs(frustum, mins.getStream(), maxs.getStream(), hits.data(), objectsCount);
+        count += hits[0];
+    });
+
+    benchmark("Batch::intersectRayAabbs", [&]() {
+        Batch::intersectRayAabbs(ray, mins.getStream(), maxs.getStream(), distances.data(), hits.data(), objectsCount);
+        count += hits[0];
+    });
+
+    benchmark("Batch::intersectRayTriangles", [&]() {
+        Batch::intersectRayTriangles(ray, v0.getStream(), v1.getStream(), v2.getStream(), distances.data(), hits.data(), objectsCount);
+        count += hits[0];
+    });
+
+    EXPECT_GT(count, 0u);
+}
+
+#endif
+
+} // Math
+} // lug
@@ -1,4 +1,10 @@
 #include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
 #include <lug/Math/Geometry/Transform.hpp>
 #include <lug/Math/Geometry/Trigonometry.hpp>
 
@@ -71,5 +77,226 @@ TEST(Transform, Scale) {
     ASSERT_EQ(point.z(), 9);
 }
 
+namespace {
+
+template <typename T>
+struct TRS {
+    Vector<3, T> position;
+    Quaternion<T> rotation;
+    Vector<3, T> factors;
+
+    Matrix<4, 4, T> transform() const {
+        return Geometry::translate(position) * rotation.transform() * Geometry::scale(factors);
+    }
+};
+
+template <typename T>
+TRS<T> createTRS(std::mt19937& generator, bool uniformScale) {
+    std::uniform_real_distribution<T> position(T(-100), T(100));
+    std::uniform_real_distribution<T> rotation(T(-1), T(1));
+    std::uniform_real_distribution<T> factor(T(0.1), T(10));
+
+    Quaternion<T> quaternion(rotation(generator), rotation(generator), rotation(generator), rotation(generator));
+    quaternion.normalize();
+
+    return {
+        Vector<3, T>{position(generator), position(generator), position(generator)},
+        quaternion,
+        uniformScale ? Vector<3, T>(T(1)) : Vector<3, T>{factor(generator), factor(generator), factor(generator)}
+    };
+}
+
+template <typename T>
+T getMaxError(const Matrix<4, 4, T>& lhs, const Matrix<4, 4, T>& rhs) {
+    T error = T(0);
+
+    for (uint8_t row = 0; row < 4; ++row) {
+        for (uint8_t col = 0; col < 4; ++col) {
+            error = std::max(error, std::abs(lhs(row, col) - rhs(row, col)));
+        }
+    }
+
+    return error;
+}
+
+template <typename T>
+Matrix<4, 4, T> cast(const Matrix<4, 4, double>& matrix) {
+    Matrix<4, 4, T> result;
+
+    for (uint8_t row = 0; row < 4; ++row) {
+        for (uint8_t col = 0; col < 4; ++col) {
+            result(row, col) = static_cast<T>(matrix(row, col));
+        }
+    }
+
+    return result;
+}
+
+} // anonymous
+
+TEST(Transform, Constexpr) {
+    constexpr Mat4x4d translation{
+        1.0, 0.0, 0.0, 2.0,
+        0.0, 1.0, 0.0, 3.0,
+        0.0, 0.0, 1.0, 4.0,
+        0.0, 0.0, 0.0, 1.0
+    };
+
+    constexpr Mat4x4d rigid = Geometry::rigidInverse(translation);
+    constexpr Mat4x4d affine = Geometry::affineInverse(translation);
+    constexpr Mat4x4d composed = Geometry::inverseTransform(Vec3d{2.0, 4.0, 6.0}, Quatd::identity(), Vec3d(2.0));
+
+    static_assert(rigid(0, 3) == -2.0, "rigidInverse is not constexpr");
+    static_assert(affine(2, 3) == -4.0, "affineInverse is not constexpr");
+    static_assert(composed(1, 3) == -2.0, "inverseTransform is not constexpr");
+
+    constexpr Mat3x3d inverse = Mat3x3d{2.0, 0.0, 0.0, 0.0, 4.0, 0.0, 0.0, 0.0, 8.0}.inverse();
+    constexpr Mat2x2f sum = Mat2x2f(1.0f) * 2.0f + Mat2x2f(1.0f);
+
+    static_assert(inverse(1, 1) == 0.25, "Matrix::inverse is not constexpr");
+    static_assert(sum(1, 0) == 3.0f, "Matrix operators are not constexpr");
+    static_assert(Mat4x4f::identity().transpose() == Mat4x4f::identity(), "Matrix::transpose is not constexpr");
+    static_assert(translation.det() == 1.0, "Matrix::det is not constexpr");
+
+    constexpr Vec4f extended(Vec3f{1.0f, 2.0f, 3.0f}, 4.0f);
+    constexpr Vec3f truncated(extended);
+
+    static_assert(dot(cross(Vec3f{1.0f, 0.0f, 0.0f}, Vec3f{0.0f, 1.0f, 0.0f}), Vec3f{0.0f, 0.0f, 1.0f}) == 1.0f, "Vector operations are not constexpr");
+    static_assert(extended.w() == 4.0f && truncated.z() == 3.0f, "Vector conversions are not constexpr");
+
+    static_assert(conjugate(Quatd::identity()) == Quatd::identity(), "Quaternion operations are not constexpr");
+    static_assert(dot(Quatd::identity(), -Quatd::identity()) == -1.0, "Quaternion operations are not constexpr");
+
+    SUCCEED();
+}
+
+TEST(Transform, AffineInverse) {
+    std::mt19937 generator(42);
+
+    for (uint32_t i = 0; i < 1000; ++i) {
+        const TRS<double> trs = createTRS<double>(generator, false);
+        const Mat4x4d matrix = trs.transform();
+
+        EXPECT_LT(getMaxError(Geometry::affineInverse(matrix), matrix.inverse()), 1e-9);
+        EXPECT_LT(getMaxError(Geometry::affineInverse(matrix) * matrix, Mat4x4d::identity()), 1e-9);
+    }
+}
+
+TEST(Transform, RigidInverse) {
+    std::mt19937 generator(42);
+
+    for (uint32_t i = 0; i < 1000; ++i) {
+        const TRS<double> trs = createTRS<double>(generator, true);
+        const Mat4x4d matrix = trs.transform();
+
+        EXPECT_LT(getMaxError(Geometry::rigidInverse(matrix), matrix.inverse()), 1e-9);
+        EXPECT_LT(getMaxError(Geometry::rigidInverse(matrix) * matrix, Mat4x4d::identity()), 1e-9);
+    }
+}
+
+TEST(Transform, InverseTransform) {
+    std::mt19937 generator(42);
+
+    for (uint32_t i = 0; i < 1000; ++i) {
+        const TRS<double> trs = createTRS<double>(generator, false);
+
+        EXPECT_LT(getMaxError(Geometry::inverseTransform(trs.position, trs.rotation, trs.factors), trs.transform().inverse()), 1e-9);
+    }
+}
+
+TEST(Transform, InversePrecision) {
+    std::mt19937 generator(42);
+
+    float generalError = 0.0f;
+    float affineError = 0.0f;
+    float composedError = 0.0f;
+
+    // The double general inverse is the reference of the float inverses
+    for (uint32_t i = 0; i < 1000; ++i) {
+        const TRS<double> trs = createTRS<double>(generator, false);
+        const Mat4x4f expected = cast<float>(trs.transform().inverse());
+
+        const Vec3f position{float(trs.position.x()), float(trs.position.y()), float(trs.position.z())};
+        const Quatf rotation(float(trs.rotation.w()), float(trs.rotation.x()), float(trs.rotation.y()), float(trs.rotation.z()));
+        const Vec3f factors{float(trs.factors.x()), float(trs.factors.y()), float(trs.factors.z())};
+        const Mat4x4f matrix = cast<float>(trs.transform());
+
+        generalError = std::max(generalError, getMaxError(matrix.inverse(), expected));
+        affineError = std::max(affineError, getMaxError(Geometry::affineInverse(matrix), expected));
+        composedError = std::max(composedError, getMaxError(Geometry::inverseTransform(position, rotation, factors), expected));
+    }
+
+    std::cout << "Max error: general " << generalError << ", affine " << affineError << ", composed " << composedError << std::endl;
+
+    // The fast paths must be at least as precise as the general inverse
+    EXPECT_LE(affineError, generalError * 2.0f);
+    EXPECT_LE(composedError, generalError * 2.0f);
+    EXPECT_LT(composedError, 1e-3f);
+}
+
+#if defined(ENABLE_LONG_TESTS)
+
+namespace {
+
+template <typename Function>
+void benchmark(const char* name, uint32_t iterations, Function function) {
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (uint32_t i = 0; i < iterations; ++i) {
+        function(i);
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    const double seconds = std::chrono::duration<double>(end - start).count();
+
+    std::cout << name << ": " << iterations / seconds / 1e6 << " M/s" << std::endl;
+
+    EXPECT_GT(seconds, 0.0);
+}
+
+} // anonymous
+
+TEST(Transform, InverseThroughput) {
+    constexpr uint32_t count = 1024;
+    constexpr uint32_t iterations = 20000000;
+
+    std::mt19937 generator(42);
+
+    std::vector<TRS<float>> transforms;
+    std::vector<Mat4x4f> matrices;
+
+    for (uint32_t i = 0; i < count; ++i) {
+        transforms.push_back(createTRS<float>(generator, false));
+        matrices.push_back(transforms.back().transform());
+    }
+
+    // Accumulate the results so that the operations are not optimized out
+    float sum = 0.0f;
+
+    benchmark("Mat4x4f::inverse", iterations, [&](uint32_t i) {
+        sum += matrices[i % count].inverse()(0, 3);
+    });
+
+    benchmark("Geometry::affineInverse", iterations, [&](uint32_t i) {
+        sum += Geometry::affineInverse(matrices[i % count])(0, 3);
+    });
+
+    benchmark("Geometry::rigidInverse", iterations, [&](uint32_t i) {
+        sum += Geometry::rigidInverse(matrices[i % count])(0, 3);
+    });
+
+    benchmark("Geometry::inverseTransform", iterations, [&](uint32_t i) {
+        const TRS<float>& trs = transforms[i % count];
+        sum += Geometry::inverseTransform(trs.position, trs.rotation, trs.factors)(0, 3);
+    });
+
+    benchmark("TRS then Mat4x4f::inverse", iterations, [&](uint32_t i) {
+        sum += transforms[i % count].transform().inverse()(0, 3);
+    });
+
+    EXPECT_TRUE(std::isfinite(sum));
+}
+
+#endif
+
 } // Math
 } // lug
@@ -0,0 +1,239 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <lug/Math/Batch.hpp>
+#include <lug/Math/Packing.hpp>
+
+namespace lug {
+namespace Math {
+
+namespace {
+
+Vec3f createDirection(std::mt19937& generator) {
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+    Vec3f direction;
+    do {
+        direction = Vec3f{distribution(generator), distribution(generator), distribution(generator)};
+    } while (direction.squaredLength() < 0.01f);
+
+    return normalize(direction);
+}
+
+float angle(const Vec3f& lhs, const Vec3f& rhs) {
+    // More precise than acos for the small angles
+    return std::atan2(cross(lhs, rhs).length(), dot(lhs, rhs));
+}
+
+} // anonymous
+
+TEST(Packing, Half) {
+    EXPECT_EQ(Packing::packHalf(0.0f), 0x0000);
+    EXPECT_EQ(Packing::packHalf(-0.0f), 0x8000);
+    EXPECT_EQ(Packing::packHalf(1.0f), 0x3c00);
+    EXPECT_EQ(Packing::packHalf(-2.0f), 0xc000);
+    EXPECT_EQ(Packing::packHalf(0.333251953125f), 0x3555);
+    EXPECT_EQ(Packing::packHalf(65504.0f), 0x7bff);
+
+    // Rounded to nearest even
+    EXPECT_EQ(Packing::packHalf(1.0f + 1.0f / 2048.0f), 0x3c00);
+    EXPECT_EQ(Packing::packHalf(1.0f + 3.0f / 2048.0f), 0x3c02);
+
+    // Subnormals, overflows and specials
+    EXPECT_EQ(Packing::packHalf(std::ldexp(1.0f, -24)), 0x0001);
+    EXPECT_EQ(Packing::packHalf(std::ldexp(1.0f, -26)), 0x0000);
+    EXPECT_EQ(Packing::packHalf(65520.0f), 0x7c00);
+    EXPECT_EQ(Packing::packHalf(-std::numeric_limits<float>::infinity()), 0xfc00);
+    EXPECT_EQ(Packing::packHalf(std::numeric_limits<float>::quiet_NaN()), 0x7e00);
+
+    EXPECT_EQ(Packing::unpackHalf(0x3c00), 1.0f);
+    EXPECT_EQ(Packing::unpackHalf(0x0001), std::ldexp(1.0f, -24));
+    EXPECT_EQ(Packing::unpackHalf(0xfc00), -std::numeric_limits<float>::infinity());
+    EXPECT_TRUE(std::isnan(Packing::unpackHalf(0x7e00)));
+
+    // Every half survives the round trip
+    for (uint32_t half = 0; half <= 0xffff; ++half) {
+        const float value = Packing::unpackHalf(static_cast<uint16_t>(half));
+
+        if (std::isnan(value)) {
+            EXPECT_EQ(half & 0x7c00, 0x7c00u);
+        } else {
+            EXPECT_EQ(Packing::packHalf(value), half) << half;
+        }
+    }
+}
+
+TEST(Packing, Normalized) {
+    EXPECT_EQ(Packing::packSnorm8(1.0f), 127);
+    EXPECT_EQ(Packing::packSnorm8(-1.0f), -127);
+    EXPECT_EQ(Packing::packSnorm8(3.0f), 127);
+    EXPECT_EQ(Packing::packSnorm8(0.5f), 64);
+    EXPECT_EQ(Packing::packUnorm8(0.5f), 128);
+    EXPECT_EQ(Packing::packUnorm8(-0.5f), 0);
+    EXPECT_EQ(Packing::packSnorm16(-1.0f), -32767);
+    EXPECT_EQ(Packing::packUnorm16(1.0f), 65535);
+    EXPECT_EQ(Packing::packSnorm16(std::numeric_limits<float>::quiet_NaN()), -32767);
+
+    EXPECT_EQ(Packing::unpackSnorm8(-128), -1.0f);
+    EXPECT_EQ(Packing::unpackSnorm16(-32768), -1.0f);
+    EXPECT_EQ(Packing::unpackUnorm16(65535), 1.0f);
+
+    constexpr float unpacked = Packing::unpackUnorm8(255);
+    static_assert(unpacked == 1.0f, "unpackUnorm8 must be constexpr");
+
+    // The error is half a step
+    for (float value = -1.0f; value <= 1.0f; value += 0.001f) {
+        EXPECT_NEAR(Packing::unpackSnorm8(Packing::packSnorm8(value)), value, 0.5f / 127.0f + 1e-6f);
+        EXPECT_NEAR(Packing::unpackSnorm16(Packing::packSnorm16(value)), value, 0.5f / 32767.0f + 1e-6f);
+
+        const float positive = std::abs(value);
+        EXPECT_NEAR(Packing::unpackUnorm8(Packing::packUnorm8(positive)), positive, 0.5f / 255.0f + 1e-6f);
+        EXPECT_NEAR(Packing::unpackUnorm16(Packing::packUnorm16(positive)), positive, 0.5f / 65535.0f + 1e-6f);
+    }
+}
+
+TEST(Packing, Octahedral) {
+    std::mt19937 generator(42);
+
+    const Vec3f axes[] = {{1.0f, 0.0f, 0.0f}, {0.0f, -1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, -1.0f}};
+    for (const Vec3f& axis : axes) {
+        const Vec3f decoded = Packing::decodeOctahedral(Packing::encodeOctahedral(axis));
+        EXPECT_LT(angle(decoded, axis), 1e-3f);
+    }
+
+    float maxError = 0.0f;
+    for (uint32_t i = 0; i < 10000; ++i) {
+        const Vec3f normal = createDirection(generator);
+        const Vec2f value = Packing::encodeOctahedral(normal);
+
+        EXPECT_LE(std::abs(value.x()), 1.0f);
+        EXPECT_LE(std::abs(value.y()), 1.0f);
+        EXPECT_LT(angle(Packing::decodeOctahedral(value), normal), 1e-3f);
+
+        // Through oct16
+        const Vec2f quantized{
+            Packing::unpackSnorm16(Packing::packSnorm16(value.x())),
+            Packing::unpackSnorm16(Packing::packSnorm16(value.y()))
+        };
+
+        maxError = std::max(maxError, angle(Packing::decodeOctahedral(quantized), normal));
+    }
+
+    // 0.005 degrees
+    EXPECT_LT(maxError, 9e-5f);
+}
+
+TEST(Packing, QTangent) {
+    std::mt19937 generator(42);
+
+    for (uint32_t i = 0; i < 10000; ++i) {
+        const Vec3f normal = createDirection(generator);
+        const Vec3f tangent = normalize(cross(normal, createDirection(generator)));
+        const float handedness = i % 2 ? 1.0f : -1.0f;
+
+        const Quatf qTangent = Packing::encodeQTangent(normal, Vec4f(tangent, handedness));
+
+        EXPECT_NEAR(qTangent.length(), 1.0f, 1e-4f);
+        EXPECT_GE(std::abs(qTangent.w()), 1.0f / 32767.0f);
+
+        // Through four snorm16
+        Quatf quantized(
+            Packing::unpackSnorm16(Packing::packSnorm16(qTangent.w())),
+            Packing::unpackSnorm16(Packing::packSnorm16(qTangent.x())),
+            Packing::unpackSnorm16(Packing::packSnorm16(qTangent.y())),
+            Packing::unpackSnorm16(Packing::packSnorm16(qTangent.z()))
+        );
+        quantized.normalize();
+
+        for (const Quatf& value : {qTangent, quantized}) {
+            Vec3f decodedNormal;
+            Vec4f decodedTangent;
+            Packing::decodeQTangent(value, decodedNormal, decodedTangent);
+
+            EXPECT_LT(angle(decodedNormal, normal), 1e-3f);
+            EXPECT_LT(angle(Vec3f(decodedTangent), tangent), 1e-3f);
+            EXPECT_EQ(decodedTangent.w(), handedness);
+        }
+    }
+}
+
+#if defined(ENABLE_LONG_TESTS)
+
+TEST(Packing, Throughput) {
+    constexpr size_t valuesCount = 1 << 20;
+    constexpr uint32_t iterations = 50;
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+    std::vector<float> values(valuesCount);
+    Batch::Vec3Array normals(valuesCount);
+    for (size_t i = 0; i < valuesCount; ++i) {
+        values[i] = distribution(generator);
+        normals.set(i, createDirection(generator));
+    }
+
+    std::vector<uint16_t> halves(valuesCount);
+    std::vector<int16_t> octahedrals(valuesCount * 2);
+
+    const auto benchmark = [&](const char* name, const auto& function) {
+        const auto start = std::chrono::high_resolution_clock::now();
+        for (uint32_t i = 0; i < iterations; ++i) {
+            function();
+        }
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        const double seconds = std::chrono::duration<double>(end - start).count();
+
+        std::cout << name << ": " << valuesCount * iterations / seconds / 1e6 << " M/s" << std::endl;
+    };
+
+    benchmark("Packing::packHalf", [&]() {
+        for (size_t i = 0; i < valuesCount; ++i) {
+            halves[i] = Packing::packHalf(values[i]);
+        }
+    });
+
+    benchmark("Packing::encodeOctahedral", [&]() {
+        for (size_t i = 0; i < valuesCount; ++i) {
+            const Vec2f value = Packing::encodeOctahedral(normals.get(i));
+
+            octahedrals[i * 2] = Packing::packSnorm16(value.x());
+            octahedrals[i * 2 + 1] = Packing::packSnorm16(value.y());
+        }
+    });
+
+    const Batch::InstructionSet current = Batch::getInstructionSet();
+
+    for (Batch::InstructionSet instructionSet : {Batch::InstructionSet::Scalar, Batch::InstructionSet::SSE2, Batch::InstructionSet::AVX2, Batch::InstructionSet::NEON}) {
+        if (!Batch::setInstructionSet(instructionSet)) {
+            continue;
+        }
+
+        std::cout << "Instruction set " << static_cast<int>(instructionSet) << std::endl;
+
+        benchmark("  packHalf", [&]() {
+            Batch::packHalf(values.data(), halves.data(), valuesCount);
+        });
+
+        benchmark("  encodeOctahedral", [&]() {
+            Batch::encodeOctahedral(normals.getStream(), octahedrals.data(), valuesCount);
+        });
+    }
+
+    Batch::setInstructionSet(current);
+
+    // Use the results so that they are not optimized out
+    EXPECT_EQ(halves[42], Packing::packHalf(values[42]));
+}
+
+#endif
+
+} // Math
+} // lug
@@ -122,5 +122,35 @@ TEST(Quaternion, DirectionTo) {
     }
 }
 
+TEST(Quaternion, Nlerp) {
+    const Quatf a{Geometry::radians(10.0f), {0.0f, 0.0f, 1.0f}};
+    const Quatf b{Geometry::radians(70.0f), {0.0f, 0.0f, 1.0f}};
+
+    QUAT_ASSERT_NEAR(nlerp(a, b, 0.0f), a, 1e-6f);
+    QUAT_ASSERT_NEAR(nlerp(a, b, 1.0f), b, 1e-6f);
+
+    // Same angle at the middle, the closest of b and -b is used
+    const Quatf middle{Geometry::radians(40.0f), {0.0f, 0.0f, 1.0f}};
+    QUAT_ASSERT_NEAR(nlerp(a, b, 0.5f), middle, 1e-6f);
+    QUAT_ASSERT_NEAR(nlerp(a, -b, 0.5f), middle, 1e-6f);
+    ASSERT_NEAR(nlerp(a, b, 0.3f).length(), 1.0f, 1e-6f);
+}
+
+TEST(Quaternion, Slerp) {
+    const Vec3f axis = normalize(Vec3f{1.0f, -2.0f, 0.5f});
+    const Quatf a{Geometry::radians(-30.0f), axis};
+    const Quatf b{Geometry::radians(120.0f), axis};
+
+    for (float t = 0.0f; t <= 1.0f; t += 0.125f) {
+        const Quatf expected{Geometry::radians(-30.0f + 150.0f * t), axis};
+
+        QUAT_ASSERT_NEAR(slerp(a, b, t), expected, 1e-5f);
+        QUAT_ASSERT_NEAR(slerp(a, -b, t), expected, 1e-5f);
+    }
+
+    // Too close for the sine
+    QUAT_ASSERT_NEAR(slerp(a, a, 0.5f), a, 1e-6f);
+}
+
 } // Math
 } // lug
@@ -0,0 +1,231 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <lug/Math/Matrix.hpp>
+#include <lug/Math/Quaternion.hpp>
+#include <lug/Math/Vector.hpp>
+
+// The float operations use the vectorized kernels when available, the double ones the scalar code
+
+namespace lug {
+namespace Math {
+
+namespace {
+
+Mat4x4f createMatrix(std::mt19937& generator) {
+    std::uniform_real_distribution<float> distribution(-2.0f, 2.0f);
+
+    Mat4x4f matrix;
+    for (uint8_t row = 0; row < 4; ++row) {
+        for (uint8_t col = 0; col < 4; ++col) {
+            matrix(row, col) = distribution(generator);
+        }
+    }
+
+    // Diagonally dominant, so invertible
+    for (uint8_t i = 0; i < 4; ++i) {
+        matrix(i, i) += matrix(i, i) < 0.0f ? -8.0f : 8.0f;
+    }
+
+    return matrix;
+}
+
+Quatf createQuaternion(std::mt19937& generator) {
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+    Quatf quaternion(distribution(generator), distribution(generator), distribution(generator), distribution(generator));
+    quaternion.normalize();
+
+    return quaternion;
+}
+
+template <uint8_t Rows, uint8_t Columns>
+Matrix<Rows, Columns, double> toDouble(const Matrix<Rows, Columns, float>& matrix) {
+    Matrix<Rows, Columns, double> result;
+
+    for (uint8_t row = 0; row < Rows; ++row) {
+        for (uint8_t col = 0; col < Columns; ++col) {
+            result(row, col) = matrix(row, col);
+        }
+    }
+
+    return result;
+}
+
+Quatd toDouble(const Quatf& quaternion) {
+    return {quaternion.w(), quaternion.x(), quaternion.y(), quaternion.z()};
+}
+
+template <uint8_t Rows, uint8_t Columns>
+void expectNear(const Matrix<Rows, Columns, float>& lhs, const Matrix<Rows, Columns, double>& rhs, double error) {
+    for (uint8_t row = 0; row < Rows; ++row) {
+        for (uint8_t col = 0; col < Columns; ++col) {
+            EXPECT_NEAR(lhs(row, col), rhs(row, col), error) << "row " << int(row) << ", col " << int(col);
+        }
+    }
+}
+
+} // anonymous
+
+TEST(Simd, Alignment) {
+    EXPECT_EQ(alignof(Mat4x4f), 16u);
+    EXPECT_EQ(sizeof(Mat4x4f), 16 * sizeof(float));
+
+    // The vectors keep their layout
+    EXPECT_EQ(sizeof(Vec3f), 3 * sizeof(float));
+    EXPECT_EQ(sizeof(Vec4f), 4 * sizeof(float));
+    EXPECT_EQ(alignof(Vec4f), alignof(float));
+}
+
+TEST(Simd, Multiplication) {
+    std::mt19937 generator(42);
+
+    for (uint32_t i = 0; i < 100; ++i) {
+        const Mat4x4f lhs = createMatrix(generator);
+        const Mat4x4f rhs = createMatrix(generator);
+
+        expectNear(lhs * rhs, toDouble(lhs) * toDouble(rhs), 1e-3);
+
+        Mat4x4f result{lhs};
+        result *= rhs;
+        expectNear(result, toDouble(lhs) * toDouble(rhs), 1e-3);
+    }
+}
+
+TEST(Simd, TransformPoint) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-100.0f, 100.0f);
+
+    for (uint32_t i = 0; i < 100; ++i) {
+        const Mat4x4f matrix = createMatrix(generator);
+        const Vec4f point{distribution(generator), distribution(generator), distribution(generator), 1.0f};
+
+        const Vec4f result = matrix * point;
+        const Vec4d expected = toDouble(matrix) * toDouble<4, 1>(point);
+
+        expectNear<4, 1>(result, expected, 1e-2);
+    }
+}
+
+TEST(Simd, Inverse) {
+    std::mt19937 generator(42);
+
+    for (uint32_t i = 0; i < 100; ++i) {
+        const Mat4x4f matrix = createMatrix(generator);
+
+        expectNear(matrix.inverse(), toDouble(matrix).inverse(), 1e-5);
+        expectNear(matrix * matrix.inverse(), Mat4x4d::identity(), 1e-5);
+    }
+
+    // Affine transformation
+    const Mat4x4f translation{
+        1.0f, 0.0f, 0.0f, 5.0f,
+        0.0f, 2.0f, 0.0f, -3.0f,
+        0.0f, 0.0f, 4.0f, 1.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+
+    const Mat4x4d expected{
+        1.0, 0.0, 0.0, -5.0,
+        0.0, 0.5, 0.0, 1.5,
+        0.0, 0.0, 0.25, -0.25,
+        0.0, 0.0, 0.0, 1.0
+    };
+
+    expectNear(translation.inverse(), expected, 1e-6);
+}
+
+TEST(Simd, Quaternion) {
+    std::mt19937 generator(42);
+
+    for (uint32_t i = 0; i < 100; ++i) {
+        const Quatf lhs = createQuaternion(generator);
+        const Quatf rhs = createQuaternion(generator);
+
+        const Quatf result = lhs * rhs;
+        const Quatd expected = toDouble(lhs) * toDouble(rhs);
+
+        EXPECT_NEAR(result.w(), expected.w(), 1e-5);
+        EXPECT_NEAR(result.x(), expected.x(), 1e-5);
+        EXPECT_NEAR(result.y(), expected.y(), 1e-5);
+        EXPECT_NEAR(result.z(), expected.z(), 1e-5);
+
+        expectNear(lhs.transform(), toDouble(lhs).transform(), 1e-5);
+    }
+}
+
+#if defined(ENABLE_LONG_TESTS)
+
+namespace {
+
+template <typename Function>
+void benchmark(const char* name, uint32_t iterations, Function function) {
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (uint32_t i = 0; i < iterations; ++i) {
+        function(i);
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    const double seconds = std::chrono::duration<double>(end - start).count();
+
+    std::cout << name << ": " << iterations / seconds / 1e6 << " M/s" << std::endl;
+
+    EXPECT_GT(seconds, 0.0);
+}
+
+} // anonymous
+
+TEST(Simd, Throughput) {
+    constexpr uint32_t count = 1024;
+    constexpr uint32_t iterations = 20000000;
+
+    std::mt19937 generator(42);
+
+    std::vector<Mat4x4f> matrices;
+    std::vector<Quatf> quaternions;
+    std::vector<Vec4f> points;
+
+    for (uint32_t i = 0; i < count; ++i) {
+        matrices.push_back(createMatrix(generator));
+        quaternions.push_back(createQuaternion(generator));
+        points.push_back(Vec4f(Vec3f(matrices.back()(0, 1)), 1.0f));
+    }
+
+    // Accumulate the results so that the operations are not optimized out
+    Mat4x4f matrix{Mat4x4f::identity()};
+    Vec4f point(0.0f);
+    float sum = 0.0f;
+
+    benchmark("Mat4x4f * Mat4x4f", iterations, [&](uint32_t i) {
+        matrix = matrices[i % count] * matrices[(i + 1) % count];
+        sum += matrix(0, 0);
+    });
+
+    benchmark("Mat4x4f::inverse", iterations, [&](uint32_t i) {
+        matrix = matrices[i % count].inverse();
+        sum += matrix(1, 1);
+    });
+
+    benchmark("Quatf::transform", iterations, [&](uint32_t i) {
+        matrix = quaternions[i % count].transform();
+        sum += matrix(2, 2);
+    });
+
+    benchmark("Mat4x4f * Vec4f", iterations, [&](uint32_t i) {
+        point = matrices[i % count] * points[i % count];
+        sum += point.x();
+    });
+
+    // Read by nobody, the compiler still has to compute it
+    volatile float sink = sum;
+    (void)(sink);
+}
+
+#endif
+
+} // Math
+} // lug
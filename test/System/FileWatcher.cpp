@@ -0,0 +1,85 @@
+#include <lug/Config.hpp>
+#include <lug/System/FileWatcher.hpp>
+#include <gtest/gtest.h>
+
+#if defined(LUG_SYSTEM_LINUX)
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <stdlib.h>
+#include <unistd.h>
+
+class FileWatcherTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        char directory[] = "/tmp/lug_file_watcher_XXXXXX";
+        ASSERT_NE(mkdtemp(directory), nullptr);
+
+        _directory = directory;
+    }
+
+    void TearDown() override {
+        for (const auto& filename : {"a.txt", "b.txt", "c.txt", "c.txt.tmp"}) {
+            std::remove((_directory + "/" + filename).c_str());
+        }
+
+        rmdir(_directory.c_str());
+    }
+
+    void writeFile(const std::string& filename, const std::string& content) {
+        std::ofstream file(filename);
+        file << content;
+    }
+
+protected:
+    std::string _directory;
+};
+
+TEST_F(FileWatcherTest, NotInitialized) {
+    lug::System::FileWatcher watcher;
+
+    EXPECT_FALSE(watcher.watchDirectory(_directory));
+    EXPECT_TRUE(watcher.poll().empty());
+}
+
+TEST_F(FileWatcherTest, Modifications) {
+    lug::System::FileWatcher watcher;
+
+    ASSERT_TRUE(watcher.init());
+    ASSERT_TRUE(watcher.watchFile(_directory + "/a.txt"));
+    EXPECT_TRUE(watcher.watchDirectory(_directory + "/"));
+
+    EXPECT_TRUE(watcher.poll().empty());
+
+    // Each file is reported once
+    writeFile(_directory + "/a.txt", "first");
+    writeFile(_directory + "/a.txt", "second");
+    writeFile(_directory + "/b.txt", "first");
+
+    std::vector<std::string> filenames = watcher.poll();
+    ASSERT_EQ(filenames.size(), 2u);
+    EXPECT_EQ(filenames[0], _directory + "/a.txt");
+    EXPECT_EQ(filenames[1], _directory + "/b.txt");
+
+    EXPECT_TRUE(watcher.poll().empty());
+
+    // Saved through a temporary file
+    writeFile(_directory + "/c.txt.tmp", "content");
+    watcher.poll();
+    ASSERT_EQ(std::rename((_directory + "/c.txt.tmp").c_str(), (_directory + "/c.txt").c_str()), 0);
+
+    filenames = watcher.poll();
+    ASSERT_EQ(filenames.size(), 1u);
+    EXPECT_EQ(filenames[0], _directory + "/c.txt");
+}
+
+TEST_F(FileWatcherTest, MissingDirectory) {
+    lug::System::FileWatcher watcher;
+
+    ASSERT_TRUE(watcher.init());
+    EXPECT_FALSE(watcher.watchDirectory(_directory + "/missing"));
+}
+
+#endif
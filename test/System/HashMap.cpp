@@ -0,0 +1,262 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <list>
+#include <map>
+#include <random>
+
+#include <lug/System/HashMap.hpp>
+
+TEST(HashMap, InsertFindErase) {
+    lug::System::HashMap<int> map;
+
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find(42), nullptr);
+    EXPECT_FALSE(map.erase(42));
+
+    map[42] = 1;
+    map[0] = 2;
+    map[~size_t(0)] = 3;
+
+    EXPECT_EQ(map.size(), 3u);
+    ASSERT_NE(map.find(42), nullptr);
+    EXPECT_EQ(*map.find(42), 1);
+    ASSERT_NE(map.find(0), nullptr);
+    EXPECT_EQ(*map.find(0), 2);
+    ASSERT_NE(map.find(~size_t(0)), nullptr);
+    EXPECT_EQ(*map.find(~size_t(0)), 3);
+
+    // Existing key
+    map[42] = 4;
+    EXPECT_EQ(map.size(), 3u);
+    EXPECT_EQ(*map.find(42), 4);
+
+    EXPECT_TRUE(map.erase(42));
+    EXPECT_FALSE(map.erase(42));
+    EXPECT_EQ(map.find(42), nullptr);
+    EXPECT_EQ(map.size(), 2u);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find(0), nullptr);
+}
+
+TEST(HashMap, MatchesStdMap) {
+    lug::System::HashMap<size_t> map;
+    std::map<size_t, size_t> reference;
+
+    std::mt19937_64 generator(42);
+
+    // Few distinct keys to get many collisions, erasures and reinsertions
+    std::uniform_int_distribution<size_t> keys(0, 2000);
+    std::uniform_int_distribution<uint32_t> operations(0, 2);
+
+    for (size_t i = 0; i < 100000; ++i) {
+        const size_t key = keys(generator) * 64;
+
+        switch (operations(generator)) {
+            case 0:
+                map[key] = i;
+                reference[key] = i;
+                break;
+            case 1:
+                EXPECT_EQ(map.erase(key), reference.erase(key) == 1);
+                break;
+            case 2: {
+                const auto it = reference.find(key);
+                const size_t* value = map.find(key);
+
+                ASSERT_EQ(value != nullptr, it != reference.end());
+                if (value) {
+                    EXPECT_EQ(*value, it->second);
+                }
+                break;
+            }
+        }
+
+        ASSERT_EQ(map.size(), reference.size());
+    }
+
+    for (const auto& entry : reference) {
+        ASSERT_NE(map.find(entry.first), nullptr);
+        EXPECT_EQ(*map.find(entry.first), entry.second);
+    }
+}
+
+TEST(HashMap, Reserve) {
+    lug::System::HashMap<size_t> map;
+
+    // The entries are kept by the rehash
+    map[7919] = 1;
+    map.reserve(1000);
+
+    for (size_t i = 0; i < 1000; ++i) {
+        map[i * 7919] = i;
+    }
+
+    EXPECT_EQ(map.size(), 1000u);
+    for (size_t i = 0; i < 1000; ++i) {
+        ASSERT_NE(map.find(i * 7919), nullptr);
+        EXPECT_EQ(*map.find(i * 7919), i);
+    }
+}
+
+#if defined(ENABLE_LONG_TESTS)
+
+namespace {
+
+// Bookkeeping of the uniform buffer pools of the renderer, without the GPU buffers
+struct Slot {
+    size_t hash{0};
+    uint32_t referenceCount{0};
+    Slot* nextFree{nullptr};
+};
+
+constexpr size_t slotsPerChunk = 40;
+
+// Previous implementation: ordered map and linear search of a free slot in the chunks
+class MapPool {
+public:
+    Slot* allocate(size_t hash, bool dirty) {
+        auto it = _inUse.find(hash);
+        if (it == _inUse.end() || dirty) {
+            Slot* slot = allocateNewSlot();
+            slot->hash = hash;
+            _inUse[hash] = slot;
+            return slot;
+        }
+
+        it->second->referenceCount += 1;
+        return it->second;
+    }
+
+    void free(Slot* slot) {
+        slot->referenceCount -= 1;
+
+        const auto it = _inUse.find(slot->hash);
+        if (slot->referenceCount == 0 && it != _inUse.end() && it->second == slot) {
+            _inUse.erase(it);
+        }
+    }
+
+private:
+    Slot* allocateNewSlot() {
+        for (auto& chunk : _chunks) {
+            for (auto& slot : chunk) {
+                if (slot.referenceCount == 0) {
+                    slot.referenceCount += 1;
+                    return &slot;
+                }
+            }
+        }
+
+        _chunks.emplace_back();
+        return allocateNewSlot();
+    }
+
+    std::list<std::array<Slot, slotsPerChunk>> _chunks;
+    std::map<size_t, Slot*> _inUse;
+};
+
+// Current implementation: open addressing map and intrusive free list across the chunks
+class HashPool {
+public:
+    Slot* allocate(size_t hash, bool dirty) {
+        Slot** inUse = _inUse.find(hash);
+        if (!inUse || dirty) {
+            Slot* slot = allocateNewSlot();
+            slot->hash = hash;
+            _inUse[hash] = slot;
+            return slot;
+        }
+
+        (*inUse)->referenceCount += 1;
+        return *inUse;
+    }
+
+    void free(Slot* slot) {
+        slot->referenceCount -= 1;
+
+        if (slot->referenceCount == 0) {
+            Slot** inUse = _inUse.find(slot->hash);
+            if (inUse && *inUse == slot) {
+                _inUse.erase(slot->hash);
+            }
+
+            slot->nextFree = _freeSlots;
+            _freeSlots = slot;
+        }
+    }
+
+private:
+    Slot* allocateNewSlot() {
+        if (!_freeSlots) {
+            _chunks.emplace_back();
+            for (auto& slot : _chunks.back()) {
+                slot.nextFree = _freeSlots;
+                _freeSlots = &slot;
+            }
+        }
+
+        Slot* slot = _freeSlots;
+        _freeSlots = slot->nextFree;
+        slot->referenceCount += 1;
+        return slot;
+    }
+
+    std::list<std::array<Slot, slotsPerChunk>> _chunks;
+    lug::System::HashMap<Slot*> _inUse;
+    Slot* _freeSlots{nullptr};
+};
+
+// Each frame allocates the buffers of every material, 1% of them being dirty, and frees the ones of the previous frame
+template <typename Pool>
+double benchmarkPool(size_t materialsCount, size_t framesCount) {
+    std::mt19937_64 generator(42);
+    std::vector<size_t> hashes(materialsCount);
+    for (auto& hash : hashes) {
+        hash = generator();
+    }
+
+    Pool pool;
+    std::vector<Slot*> previousFrame;
+    std::vector<Slot*> currentFrame;
+
+    const auto start = std::chrono::high_resolution_clock::now();
+
+    for (size_t frame = 0; frame < framesCount; ++frame) {
+        currentFrame.clear();
+
+        for (size_t i = 0; i < materialsCount; ++i) {
+            currentFrame.push_back(pool.allocate(hashes[i], (i + frame) % 100 == 0));
+        }
+
+        for (Slot* slot : previousFrame) {
+            pool.free(slot);
+        }
+
+        std::swap(previousFrame, currentFrame);
+    }
+
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    return static_cast<double>(materialsCount * framesCount) / std::chrono::duration<double>(end - start).count();
+}
+
+} // anonymous
+
+TEST(HashMap, PoolThroughput) {
+    const size_t materialsCount = 10000;
+
+    const double mapThroughput = benchmarkPool<MapPool>(materialsCount, 10);
+    const double hashThroughput = benchmarkPool<HashPool>(materialsCount, 200);
+
+    std::cout << "std::map and linear search: " << mapThroughput / 1e6 << " M allocate/free per second" << std::endl;
+    std::cout << "HashMap and free list: " << hashThroughput / 1e6 << " M allocate/free per second" << std::endl;
+
+    EXPECT_GT(hashThroughput, mapThroughput);
+}
+
+#endif
@@ -0,0 +1,259 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <lug/System/Memory.hpp>
+#include <lug/System/Memory/Allocator/Pool.hpp>
+#include <lug/System/Memory/Area/GrowingHeap.hpp>
+#include <lug/System/Memory/Area/Heap.hpp>
+
+#if defined(ENABLE_LONG_TESTS)
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#endif
+
+using namespace lug::System::Memory;
+
+namespace {
+
+struct Object {
+    uint32_t thread;
+    uint32_t index;
+    uint64_t data[3];
+};
+
+using ConcurrentArena = Arena<Allocator::ConcurrentPool<Object>, Policies::SingleThreadPolicy, Policies::NoBoundsChecking, Policies::NoMemoryMarking>;
+
+// Allocates and frees in each thread, and checks that no chunk is given to two threads at the same time
+template <class Arena>
+bool stress(Arena& arena, size_t threadsCount, size_t iterations, size_t objectsCount) {
+    std::atomic<bool> valid{true};
+    std::atomic<size_t> ready{0};
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < threadsCount; ++t) {
+        threads.emplace_back([&, t]() {
+            std::vector<Object*> objects(objectsCount);
+
+            // All the threads are running at the same time
+            ++ready;
+            while (ready < threadsCount) {
+                std::this_thread::yield();
+            }
+
+            for (size_t i = 0; i < iterations; ++i) {
+                for (size_t j = 0; j < objectsCount; ++j) {
+                    objects[j] = LUG_NEW(Object, arena);
+
+                    if (!objects[j]) {
+                        valid = false;
+                        return;
+                    }
+
+                    objects[j]->thread = static_cast<uint32_t>(t);
+                    objects[j]->index = static_cast<uint32_t>(j);
+                }
+
+                for (size_t j = 0; j < objectsCount; ++j) {
+                    if (objects[j]->thread != t || objects[j]->index != j) {
+                        valid = false;
+                    }
+                }
+
+                // Not in the allocation order, to mix the batches
+                for (size_t j = 0; j < objectsCount; ++j) {
+                    LUG_DELETE(objects[(j * 7) % objectsCount], arena);
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    return valid;
+}
+
+} // anonymous
+
+TEST(ConcurrentPool, SingleThread) {
+    Area::GrowingHeap<4096, 64> area;
+    ConcurrentArena arena(&area);
+
+    std::vector<Object*> objects;
+    for (size_t i = 0; i < 1000; ++i) {
+        Object* const object = LUG_NEW(Object, arena);
+
+        ASSERT_NE(object, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(object) % alignof(Object), 0u);
+
+        objects.push_back(object);
+    }
+
+    std::vector<Object*> sorted = objects;
+    std::sort(sorted.begin(), sorted.end());
+    EXPECT_EQ(std::unique(sorted.begin(), sorted.end()), sorted.end());
+
+    for (Object* object : objects) {
+        LUG_DELETE(object, arena);
+    }
+
+    // The freed chunks are used again
+    std::vector<Object*> reused;
+    for (size_t i = 0; i < 1000; ++i) {
+        reused.push_back(LUG_NEW(Object, arena));
+    }
+
+    std::sort(reused.begin(), reused.end());
+    EXPECT_EQ(reused, sorted);
+
+    for (Object* object : reused) {
+        LUG_DELETE(object, arena);
+    }
+}
+
+TEST(ConcurrentPool, SmallObjects) {
+    Area::GrowingHeap<4096, 4> area;
+    Arena<Allocator::ConcurrentPool<uint16_t>, Policies::SingleThreadPolicy, Policies::NoBoundsChecking, Policies::NoMemoryMarking> arena(&area);
+
+    // The chunks are large enough for the free list
+    std::vector<uint16_t*> values;
+    for (uint16_t i = 0; i < 100; ++i) {
+        uint16_t* const value = LUG_NEW(uint16_t, arena, i);
+
+        ASSERT_NE(value, nullptr);
+        values.push_back(value);
+    }
+
+    for (uint16_t i = 0; i < 100; ++i) {
+        EXPECT_EQ(*values[i], i);
+        LUG_DELETE(values[i], arena);
+    }
+
+    EXPECT_NE(LUG_NEW(uint16_t, arena), nullptr);
+}
+
+TEST(ConcurrentPool, Exhaustion) {
+    Area::Heap<4096, 2> area;
+    ConcurrentArena arena(&area);
+
+    const auto allocateAll = [&arena]() {
+        std::vector<Object*> objects;
+
+        while (Object* const object = LUG_NEW(Object, arena)) {
+            objects.push_back(object);
+        }
+
+        return objects;
+    };
+
+    std::vector<Object*> objects = allocateAll();
+    // Each chunk has a link of 8 bytes in the depot, stored after the chunks of the page
+    EXPECT_EQ(objects.size(), 2 * ((4096 - 4) / (sizeof(Object) + 8)));
+
+    for (Object* object : objects) {
+        LUG_DELETE(object, arena);
+    }
+
+    EXPECT_EQ(allocateAll().size(), objects.size());
+
+    arena.allocator().reset();
+    EXPECT_EQ(allocateAll().size(), objects.size());
+}
+
+TEST(ConcurrentPool, Threads) {
+    Area::GrowingHeap<64 * 1024, 256> area;
+    ConcurrentArena arena(&area);
+
+    EXPECT_TRUE(stress(arena, 8, 1000, 100));
+}
+
+TEST(ConcurrentPool, MoreThreadsThanCaches) {
+    Area::GrowingHeap<64 * 1024, 256> area;
+    ConcurrentArena arena(&area);
+
+    EXPECT_TRUE(stress(arena, Allocator::priv::maxThreadCachesCount + 16, 100, 40));
+}
+
+TEST(ConcurrentPool, FreeFromAnotherThread) {
+    Area::GrowingHeap<64 * 1024, 256> area;
+    ConcurrentArena arena(&area);
+
+    std::vector<Object*> objects(10000);
+
+    std::thread producer([&]() {
+        for (Object*& object : objects) {
+            object = LUG_NEW(Object, arena);
+        }
+    });
+    producer.join();
+
+    std::thread consumer([&]() {
+        for (Object* object : objects) {
+            LUG_DELETE(object, arena);
+        }
+    });
+    consumer.join();
+
+    // The chunks freed by the consumer are in the depot or in the cache it left to the next thread
+    std::vector<Object*> sorted = objects;
+    std::sort(sorted.begin(), sorted.end());
+
+    std::vector<Object*> reused(objects.size());
+    std::thread next([&]() {
+        for (Object*& object : reused) {
+            object = LUG_NEW(Object, arena);
+        }
+    });
+    next.join();
+
+    std::sort(reused.begin(), reused.end());
+    EXPECT_EQ(reused, sorted);
+}
+
+#if defined(ENABLE_LONG_TESTS)
+
+TEST(ConcurrentPool, Contention) {
+    using LockedArena = Arena<Allocator::Pool<Object>, Policies::MultiThreadPolicy<std::mutex>, Policies::NoBoundsChecking, Policies::NoMemoryMarking>;
+
+    constexpr size_t operationsCount = 1 << 22;
+    constexpr size_t objectsCount = 64;
+
+    const auto benchmark = [](const char* name, size_t threadsCount, const auto& function) {
+        const auto start = std::chrono::high_resolution_clock::now();
+        EXPECT_TRUE(function());
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        const double seconds = std::chrono::duration<double>(end - start).count();
+
+        std::cout << name << ", " << threadsCount << " thread(s): " << 2.0 * operationsCount / seconds / 1e6 << " M allocations+frees/s" << std::endl;
+    };
+
+    for (size_t threadsCount = 1; threadsCount <= 32; threadsCount *= 2) {
+        const size_t iterations = operationsCount / threadsCount / objectsCount;
+
+        {
+            Area::GrowingHeap<64 * 1024, 1024> area;
+            LockedArena arena(&area);
+
+            benchmark("Pool + std::mutex", threadsCount, [&]() {
+                return stress(arena, threadsCount, iterations, objectsCount);
+            });
+        }
+
+        {
+            Area::GrowingHeap<64 * 1024, 1024> area;
+            ConcurrentArena arena(&area);
+
+            benchmark("ConcurrentPool", threadsCount, [&]() {
+                return stress(arena, threadsCount, iterations, objectsCount);
+            });
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,269 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <lug/System/Memory.hpp>
+#include <lug/System/Memory/Scratch.hpp>
+
+#if defined(ENABLE_LONG_TESTS)
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <lug/System/Memory/Allocator/Linear.hpp>
+#include <lug/System/Memory/Area/GrowingHeap.hpp>
+
+#if defined(__has_include)
+#if __has_include(<memory_resource>) && __cplusplus >= 201703L
+#include <memory_resource>
+#define LUG_TEST_MEMORY_RESOURCE
+#endif
+#endif
+#endif
+
+using namespace lug::System::Memory;
+
+namespace {
+
+bool isAligned(const void* ptr, size_t alignment) {
+    return reinterpret_cast<uintptr_t>(ptr) % alignment == 0;
+}
+
+} // anonymous
+
+TEST(Scratch, Alignment) {
+    ScratchScope scratch;
+
+    for (size_t alignment = 1; alignment <= 4096; alignment *= 2) {
+        for (size_t size : {1, 3, 64, 1000}) {
+            void* const ptr = scratch.allocate(size, alignment);
+
+            ASSERT_NE(ptr, nullptr);
+            EXPECT_TRUE(isAligned(ptr, alignment));
+
+            std::memset(ptr, 0xFF, size);
+        }
+    }
+
+    EXPECT_TRUE(isAligned(scratch.allocate<char>(1), ScratchScope::defaultAlignment));
+    EXPECT_TRUE(isAligned(scratch.allocate<float>(3), ScratchScope::defaultAlignment));
+}
+
+TEST(Scratch, Rewind) {
+    void* first = nullptr;
+
+    {
+        ScratchScope scratch;
+
+        first = scratch.allocate(128);
+        ASSERT_NE(first, nullptr);
+        ASSERT_NE(scratch.allocate(128), first);
+    }
+
+    // The next scope reuses the same memory
+    {
+        ScratchScope scratch;
+
+        EXPECT_EQ(scratch.allocate(128), first);
+    }
+}
+
+TEST(Scratch, Nested) {
+    ScratchScope outer;
+
+    int* const values = outer.allocate<int>(16);
+    ASSERT_NE(values, nullptr);
+    for (int i = 0; i < 16; ++i) {
+        values[i] = i;
+    }
+
+    void* inner = nullptr;
+    {
+        ScratchScope scratch;
+
+        inner = scratch.allocate(1024);
+        ASSERT_NE(inner, nullptr);
+        std::memset(inner, 0, 1024);
+    }
+
+    for (int i = 0; i < 16; ++i) {
+        EXPECT_EQ(values[i], i);
+    }
+
+    // The inner scope has been rewound
+    EXPECT_EQ(outer.allocate(1024), inner);
+}
+
+TEST(Scratch, ManyPages) {
+    ScratchScope scratch;
+
+    std::vector<uint8_t*> blocks;
+    for (size_t i = 0; i < 64; ++i) {
+        uint8_t* const block = scratch.allocate<uint8_t>(ScratchScope::pageSize / 4);
+
+        ASSERT_NE(block, nullptr);
+        std::memset(block, static_cast<int>(i), ScratchScope::pageSize / 4);
+
+        blocks.push_back(block);
+    }
+
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        EXPECT_EQ(blocks[i][0], static_cast<uint8_t>(i));
+        EXPECT_EQ(blocks[i][ScratchScope::pageSize / 4 - 1], static_cast<uint8_t>(i));
+    }
+}
+
+TEST(Scratch, TooLarge) {
+    ScratchScope scratch;
+
+    EXPECT_EQ(scratch.allocate(ScratchScope::pageSize), nullptr);
+    EXPECT_EQ(scratch.allocate(16, ScratchScope::pageSize), nullptr);
+
+    // The scratch is still usable
+    EXPECT_NE(scratch.allocate(ScratchScope::pageSize / 2), nullptr);
+}
+
+TEST(Scratch, Vector) {
+    ScratchScope scratch;
+
+    std::vector<int, ScratchAllocator<int>> values{ScratchAllocator<int>(scratch)};
+    for (int i = 0; i < 10000; ++i) {
+        values.push_back(i);
+    }
+
+    for (int i = 0; i < 10000; ++i) {
+        ASSERT_EQ(values[i], i);
+    }
+
+    EXPECT_TRUE(ScratchAllocator<int>(scratch) == ScratchAllocator<float>(scratch));
+}
+
+TEST(Scratch, Arena) {
+    struct Object {
+        Object(int value) : value(value) {}
+        int value;
+    };
+
+    ScratchScope scratch;
+
+    Object* const object = LUG_NEW(Object, scratch, 42);
+    ASSERT_NE(object, nullptr);
+    EXPECT_EQ(object->value, 42);
+    LUG_DELETE(object, scratch);
+
+    Object* const objects = LUG_NEW_ARRAY_SIZE(Object, 8, scratch, 7);
+    ASSERT_NE(objects, nullptr);
+    for (size_t i = 0; i < 8; ++i) {
+        EXPECT_EQ(objects[i].value, 7);
+    }
+    LUG_DELETE_ARRAY(objects, scratch);
+}
+
+TEST(Scratch, Threads) {
+    constexpr size_t threadsCount = 4;
+
+    // Not a std::vector<bool>, its elements share bytes written by the threads
+    std::vector<char> results(threadsCount, false);
+    std::vector<std::thread> threads;
+
+    for (size_t i = 0; i < threadsCount; ++i) {
+        threads.emplace_back([&results, i]() {
+            ScratchScope scratch;
+
+            uint32_t* const values = scratch.allocate<uint32_t>(4096);
+            if (!values) {
+                return;
+            }
+
+            for (uint32_t j = 0; j < 4096; ++j) {
+                values[j] = static_cast<uint32_t>(i) * j;
+            }
+
+            std::this_thread::yield();
+
+            bool valid = true;
+            for (uint32_t j = 0; j < 4096; ++j) {
+                valid = valid && values[j] == static_cast<uint32_t>(i) * j;
+            }
+
+            results[i] = valid;
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (size_t i = 0; i < threadsCount; ++i) {
+        EXPECT_TRUE(results[i]);
+    }
+}
+
+#if defined(ENABLE_LONG_TESTS)
+
+TEST(Scratch, Benchmark) {
+    constexpr size_t framesCount = 10000;
+    constexpr size_t allocationsCount = 64;
+
+    const auto benchmark = [](const char* name, const auto& function) {
+        const auto start = std::chrono::high_resolution_clock::now();
+        for (size_t frame = 0; frame < framesCount; ++frame) {
+            function(frame);
+        }
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        const double seconds = std::chrono::duration<double>(end - start).count();
+
+        std::cout << name << ": " << seconds * 1e9 / (framesCount * allocationsCount) << " ns/allocation" << std::endl;
+    };
+
+    // Arrays of a frame, of sizes from 16 bytes to 16 KiB, released at the end of the frame
+    const auto getSize = [](size_t frame, size_t i) {
+        return size_t{16} << ((frame + i) % 11);
+    };
+
+    const auto touch = [](void* ptr) {
+        static_cast<volatile char*>(ptr)[0] = 1;
+    };
+
+    benchmark("malloc", [&](size_t frame) {
+        void* pointers[allocationsCount];
+        for (size_t i = 0; i < allocationsCount; ++i) {
+            pointers[i] = std::malloc(getSize(frame, i));
+            touch(pointers[i]);
+        }
+        for (size_t i = 0; i < allocationsCount; ++i) {
+            std::free(pointers[i]);
+        }
+    });
+
+    benchmark("ScratchScope", [&](size_t frame) {
+        ScratchScope scratch;
+        for (size_t i = 0; i < allocationsCount; ++i) {
+            touch(scratch.allocate(getSize(frame, i)));
+        }
+    });
+
+#if defined(LUG_TEST_MEMORY_RESOURCE)
+    std::vector<char> buffer(ScratchScope::pageSize);
+
+    benchmark("std::pmr::monotonic_buffer_resource", [&](size_t frame) {
+        std::pmr::monotonic_buffer_resource resource(buffer.data(), buffer.size());
+        for (size_t i = 0; i < allocationsCount; ++i) {
+            touch(resource.allocate(getSize(frame, i), ScratchScope::defaultAlignment));
+        }
+    });
+#endif
+
+    Area::GrowingHeap<ScratchScope::pageSize, 16> area;
+    Allocator::Linear linear(&area);
+
+    benchmark("Allocator::Linear", [&](size_t frame) {
+        for (size_t i = 0; i < allocationsCount; ++i) {
+            touch(linear.allocate(getSize(frame, i), ScratchScope::defaultAlignment, 0));
+        }
+        linear.reset();
+    });
+}
+
+#endif
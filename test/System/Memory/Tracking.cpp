@@ -0,0 +1,308 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <lug/System/Memory.hpp>
+#include <lug/System/Memory/Allocator/Pool.hpp>
+#include <lug/System/Memory/Allocator/Stack.hpp>
+#include <lug/System/Memory/Area/GrowingHeap.hpp>
+#include <lug/System/Memory/Tracking.hpp>
+
+#if defined(ENABLE_LONG_TESTS)
+#include <chrono>
+#include <iostream>
+#endif
+
+using namespace lug::System::Memory;
+
+namespace {
+
+struct Object {
+    uint64_t data[4];
+};
+
+using TrackedArena = Arena<Allocator::Stack, Policies::SingleThreadPolicy, Policies::NoBoundsChecking, Policies::NoMemoryMarking, Policies::SimpleMemoryTracking>;
+
+// The chunks hold the header of the tracking before the object
+constexpr size_t HeaderSize = Policies::SimpleMemoryTracking::HeaderSize;
+
+const Tracking::CallSiteStats* findCallSite(const std::vector<Tracking::CallSiteStats>& callSites, size_t line) {
+    const auto it = std::find_if(callSites.begin(), callSites.end(), [line](const Tracking::CallSiteStats& callSite) {
+        return callSite.line == line && std::strcmp(callSite.file, __FILE__) == 0;
+    });
+
+    return it != callSites.end() ? &*it : nullptr;
+}
+
+const Tracking::ArenaStats* findArena(const std::vector<Tracking::ArenaStats>& arenas, const char* name) {
+    const auto it = std::find_if(arenas.begin(), arenas.end(), [name](const Tracking::ArenaStats& arena) {
+        return arena.name == name;
+    });
+
+    return it != arenas.end() ? &*it : nullptr;
+}
+
+} // anonymous
+
+TEST(Tracking, CallSites) {
+    static const char* name = "Tracking.CallSites";
+
+    Area::GrowingHeap<4096, 4> area;
+    TrackedArena arena(&area);
+    arena.tracker().setName(name);
+
+    std::vector<Object*> objects;
+
+    const size_t firstLine = __LINE__; objects.push_back(LUG_NEW(Object, arena));
+    const size_t secondLine = __LINE__; for (int i = 0; i < 2; ++i) { objects.push_back(LUG_NEW(Object, arena)); }
+
+    {
+        const auto callSites = Tracking::getCallSites();
+
+        const Tracking::CallSiteStats* const first = findCallSite(callSites, firstLine);
+        ASSERT_NE(first, nullptr);
+        EXPECT_EQ(first->stats.count, 1u);
+        EXPECT_GE(first->stats.bytes, sizeof(Object));
+
+        const Tracking::CallSiteStats* const second = findCallSite(callSites, secondLine);
+        ASSERT_NE(second, nullptr);
+        EXPECT_EQ(second->stats.count, 2u);
+        EXPECT_EQ(second->stats.bytes, 2 * first->stats.bytes);
+
+        const auto arenas = Tracking::getArenas();
+
+        const Tracking::ArenaStats* const stats = findArena(arenas, name);
+        ASSERT_NE(stats, nullptr);
+        EXPECT_EQ(stats->stats.count, 3u);
+        EXPECT_EQ(stats->stats.bytes, first->stats.bytes + second->stats.bytes);
+        EXPECT_EQ(arena.tracker().getStats().bytes, stats->stats.bytes);
+    }
+
+    // Freed in reverse order for the stack allocator
+    const size_t bytes = arena.tracker().getStats().bytes;
+    while (!objects.empty()) {
+        LUG_DELETE(objects.back(), arena);
+        objects.pop_back();
+    }
+
+    {
+        const auto callSites = Tracking::getCallSites();
+
+        const Tracking::CallSiteStats* const second = findCallSite(callSites, secondLine);
+        ASSERT_NE(second, nullptr);
+        EXPECT_EQ(second->stats.count, 0u);
+        EXPECT_EQ(second->stats.bytes, 0u);
+        EXPECT_EQ(second->stats.peakCount, 2u);
+        EXPECT_EQ(second->stats.totalCount, 2u);
+
+        const Tracking::Stats stats = arena.tracker().getStats();
+        EXPECT_EQ(stats.count, 0u);
+        EXPECT_EQ(stats.bytes, 0u);
+        EXPECT_EQ(stats.peakCount, 3u);
+        EXPECT_EQ(stats.peakBytes, bytes);
+        EXPECT_EQ(stats.totalCount, 3u);
+    }
+}
+
+TEST(Tracking, WithOtherPolicies) {
+    Area::GrowingHeap<4096, 4> area;
+    Arena<Allocator::Stack, Policies::SingleThreadPolicy, Policies::SimpleBoundsChecking, Policies::SimpleMemoryMarking, Policies::SimpleMemoryTracking> arena(&area);
+
+    // The guards are checked after the header of the tracking
+    for (size_t alignment = 1; alignment <= 64; alignment *= 2) {
+        uint8_t* const values = LUG_NEW_ARRAY_ALIGN_SIZE(uint8_t, alignment, 13, arena);
+
+        ASSERT_NE(values, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(values) % alignment, 0u);
+
+        std::memset(values, 0, 13);
+        LUG_DELETE_ARRAY(values, arena);
+    }
+
+    EXPECT_EQ(arena.tracker().getStats().count, 0u);
+    EXPECT_EQ(arena.tracker().getStats().totalCount, 7u);
+}
+
+TEST(Tracking, Unregister) {
+    static const char* name = "Tracking.Unregister";
+
+    {
+        Area::GrowingHeap<4096, 4> area;
+        TrackedArena arena(&area);
+        arena.tracker().setName(name);
+
+        const auto arenas = Tracking::getArenas();
+        EXPECT_NE(findArena(arenas, name), nullptr);
+    }
+
+    const auto arenas = Tracking::getArenas();
+    EXPECT_EQ(findArena(arenas, name), nullptr);
+}
+
+TEST(Tracking, Threads) {
+    constexpr size_t threadsCount = 4;
+    constexpr size_t objectsCount = 1000;
+
+    Area::GrowingHeap<64 * 1024, 64> area;
+    Arena<Allocator::ConcurrentChunk<sizeof(Object) + HeaderSize, alignof(Object), HeaderSize>, Policies::SingleThreadPolicy, Policies::NoBoundsChecking, Policies::NoMemoryMarking, Policies::SimpleMemoryTracking> arena(&area);
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadsCount; ++t) {
+        threads.emplace_back([&arena]() {
+            std::vector<Object*> objects;
+
+            for (size_t i = 0; i < objectsCount; ++i) {
+                objects.push_back(LUG_NEW(Object, arena));
+            }
+
+            for (Object* object : objects) {
+                LUG_DELETE(object, arena);
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const Tracking::Stats stats = arena.tracker().getStats();
+    EXPECT_EQ(stats.count, 0u);
+    EXPECT_EQ(stats.bytes, 0u);
+    EXPECT_GE(stats.peakCount, objectsCount);
+    EXPECT_EQ(stats.totalCount, threadsCount * objectsCount);
+}
+
+TEST(Tracking, OtherThreadDeallocations) {
+    constexpr size_t objectsCount = 100;
+
+    Area::GrowingHeap<64 * 1024, 64> area;
+    Arena<Allocator::ConcurrentChunk<sizeof(Object) + HeaderSize, alignof(Object), HeaderSize>, Policies::SingleThreadPolicy, Policies::NoBoundsChecking, Policies::NoMemoryMarking, Policies::SimpleMemoryTracking> arena(&area);
+
+    std::vector<Object*> objects;
+    size_t line = 0;
+
+    // Allocated by a thread, freed by another
+    std::thread thread([&]() {
+        line = __LINE__; for (size_t i = 0; i < objectsCount; ++i) { objects.push_back(LUG_NEW(Object, arena)); }
+    });
+    thread.join();
+
+    EXPECT_EQ(arena.tracker().getStats().count, objectsCount);
+
+    for (Object* object : objects) {
+        LUG_DELETE(object, arena);
+    }
+
+    const Tracking::Stats stats = arena.tracker().getStats();
+    EXPECT_EQ(stats.count, 0u);
+    EXPECT_EQ(stats.bytes, 0u);
+    EXPECT_EQ(stats.peakCount, objectsCount);
+    EXPECT_EQ(stats.totalCount, objectsCount);
+
+    const auto callSites = Tracking::getCallSites();
+
+    const Tracking::CallSiteStats* const callSite = findCallSite(callSites, line);
+    ASSERT_NE(callSite, nullptr);
+    EXPECT_EQ(callSite->stats.count, 0u);
+    EXPECT_EQ(callSite->stats.bytes, 0u);
+    EXPECT_EQ(callSite->stats.peakCount, objectsCount);
+}
+
+TEST(Tracking, Reset) {
+    Area::GrowingHeap<4096, 4> area;
+    TrackedArena arena(&area);
+
+    for (int i = 0; i < 3; ++i) {
+        LUG_NEW(Object, arena);
+    }
+
+    arena.reset();
+
+    Tracking::Stats stats = arena.tracker().getStats();
+    EXPECT_EQ(stats.count, 0u);
+    EXPECT_EQ(stats.bytes, 0u);
+    EXPECT_EQ(stats.peakCount, 3u);
+
+    // The peaks only grow again above the live allocations after the reset
+    Object* const object = LUG_NEW(Object, arena);
+
+    stats = arena.tracker().getStats();
+    EXPECT_EQ(stats.count, 1u);
+    EXPECT_EQ(stats.peakCount, 3u);
+    EXPECT_EQ(stats.totalCount, 4u);
+
+    LUG_DELETE(object, arena);
+}
+
+TEST(Tracking, Locations) {
+    Area::GrowingHeap<4096, 4> area;
+    TrackedArena arena(&area);
+
+    // The call site of a Location is resolved by its first allocation, then shared with its file and line
+    static Location location{__FILE__, __LINE__};
+    EXPECT_EQ(location.callSite.load(), nullptr);
+
+    Object* const first = new_one<Object>(alignof(Object), location, arena);
+    ASSERT_NE(first, nullptr);
+    EXPECT_NE(location.callSite.load(), nullptr);
+
+    Object* const second = new_one<Object>(alignof(Object), location.file, location.line, arena);
+    ASSERT_NE(second, nullptr);
+
+    const auto callSites = Tracking::getCallSites();
+
+    const Tracking::CallSiteStats* const callSite = findCallSite(callSites, location.line);
+    ASSERT_NE(callSite, nullptr);
+    EXPECT_EQ(callSite->stats.count, 2u);
+    EXPECT_EQ(callSite->stats.bytes, arena.tracker().getStats().bytes);
+
+    LUG_DELETE(second, arena);
+    LUG_DELETE(first, arena);
+
+    EXPECT_EQ(arena.tracker().getStats().count, 0u);
+}
+
+#if defined(ENABLE_LONG_TESTS)
+
+TEST(Tracking, Overhead) {
+    constexpr size_t iterations = 1 << 16;
+    constexpr size_t objectsCount = 64;
+
+    const auto benchmark = [](const char* name, auto& arena) {
+        Object* objects[objectsCount];
+
+        const auto start = std::chrono::high_resolution_clock::now();
+        for (size_t i = 0; i < iterations; ++i) {
+            for (size_t j = 0; j < objectsCount; ++j) {
+                objects[j] = LUG_NEW(Object, arena);
+            }
+
+            for (size_t j = 0; j < objectsCount; ++j) {
+                LUG_DELETE(objects[j], arena);
+            }
+        }
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        const double seconds = std::chrono::duration<double>(end - start).count();
+
+        std::cout << name << ": " << seconds * 1e9 / (iterations * objectsCount) << " ns/allocation+free" << std::endl;
+    };
+
+    {
+        Area::GrowingHeap<64 * 1024, 16> area;
+        Arena<Allocator::Pool<Object>, Policies::SingleThreadPolicy, Policies::NoBoundsChecking, Policies::NoMemoryMarking> arena(&area);
+
+        benchmark("NoMemoryTracking", arena);
+    }
+
+    {
+        Area::GrowingHeap<64 * 1024, 16> area;
+        Arena<Allocator::Chunk<sizeof(Object) + HeaderSize, alignof(Object), HeaderSize>, Policies::SingleThreadPolicy, Policies::NoBoundsChecking, Policies::NoMemoryMarking, Policies::SimpleMemoryTracking> arena(&area);
+
+        benchmark("SimpleMemoryTracking", arena);
+    }
+}
+
+#endif
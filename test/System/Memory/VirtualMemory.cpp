@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <lug/System/Memory.hpp>
+#include <lug/System/Memory/Allocator/Linear.hpp>
+#include <lug/System/Memory/Area/VirtualMemory.hpp>
+
+#if defined(ENABLE_LONG_TESTS)
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <lug/System/Memory/Area/GrowingHeap.hpp>
+#endif
+
+using namespace lug::System::Memory;
+
+TEST(VirtualMemory, Pages) {
+    for (Area::HugePages hugePages : {Area::HugePages::None, Area::HugePages::Transparent, Area::HugePages::Explicit}) {
+        Area::VirtualMemory<64 * 1024, 16> area(hugePages);
+
+        ASSERT_TRUE(area.isReserved());
+        EXPECT_EQ(area.getCommittedSize(), 0u);
+
+        Area::Page* previous = nullptr;
+        for (size_t i = 0; i < 16; ++i) {
+            Area::Page* const page = area.requestNextPage();
+
+            ASSERT_NE(page, nullptr);
+            EXPECT_EQ(static_cast<char*>(page->end) - static_cast<char*>(page->start) + 1, 64 * 1024);
+            EXPECT_EQ(page->prev, previous);
+
+            // The pages are contiguous
+            if (previous) {
+                EXPECT_EQ(page->start, static_cast<char*>(previous->end) + 1);
+            }
+
+            std::memset(page->start, static_cast<int>(i), 64 * 1024);
+            previous = page;
+        }
+
+        EXPECT_EQ(area.getCommittedSize(), 16u * 64 * 1024);
+        EXPECT_EQ(area.requestNextPage(), nullptr);
+    }
+}
+
+TEST(VirtualMemory, HugePagesAlignment) {
+    Area::VirtualMemory<2 * 1024 * 1024, 4> area(Area::HugePages::Transparent);
+
+    Area::Page* const page = area.requestNextPage();
+
+    ASSERT_NE(page, nullptr);
+#if !defined(LUG_SYSTEM_WINDOWS)
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(page->start) % (2 * 1024 * 1024), 0u);
+#endif
+}
+
+TEST(VirtualMemory, Reset) {
+    Area::VirtualMemory<64 * 1024, 4> area(Area::HugePages::None);
+    Allocator::Linear allocator(&area);
+
+    // One block per page
+    char* blocks[3];
+    for (char*& block : blocks) {
+        block = static_cast<char*>(allocator.allocate(48 * 1024, 16, 0));
+        ASSERT_NE(block, nullptr);
+        std::memset(block, 0xFF, 48 * 1024);
+    }
+
+    EXPECT_EQ(area.getCommittedSize(), 3u * 64 * 1024);
+
+    allocator.reset();
+    area.reset();
+
+    // Only the first page, kept by the allocator, is still committed
+    EXPECT_EQ(area.getCommittedSize(), 64u * 1024);
+
+    // The same pages are requested again
+    for (char* block : blocks) {
+        char* const reused = static_cast<char*>(allocator.allocate(48 * 1024, 16, 0));
+        EXPECT_EQ(reused, block);
+
+#if defined(LUG_SYSTEM_LINUX) || defined(LUG_SYSTEM_ANDROID)
+        EXPECT_EQ(reused[0], 0);
+#endif
+
+        std::memset(reused, 0xFF, 48 * 1024);
+    }
+
+    EXPECT_EQ(area.getCommittedSize(), 3u * 64 * 1024);
+
+    // All the pages are still available
+    EXPECT_NE(area.requestNextPage(), nullptr);
+    EXPECT_EQ(area.requestNextPage(), nullptr);
+}
+
+TEST(VirtualMemory, Arena) {
+    Area::VirtualMemory<64 * 1024, 64> area(Area::HugePages::None);
+    Arena<Allocator::Linear, Policies::SingleThreadPolicy, Policies::NoBoundsChecking, Policies::NoMemoryMarking> arena(&area);
+
+    // Larger than a page of the system, smaller than a page of the area
+    for (size_t i = 0; i < 1000; ++i) {
+        uint32_t* const values = LUG_NEW_ARRAY_SIZE(uint32_t, 1000, arena);
+
+        ASSERT_NE(values, nullptr);
+        values[999] = static_cast<uint32_t>(i);
+    }
+}
+
+#if defined(ENABLE_LONG_TESTS)
+
+TEST(VirtualMemory, Benchmark) {
+    constexpr size_t pageSize = 2 * 1024 * 1024;
+    constexpr size_t pagesCount = 512;
+    // With the size stored by the linear allocator, a block is 4 KiB
+    constexpr size_t blockSize = 4096 - sizeof(size_t);
+    constexpr size_t accessesCount = 1 << 24;
+
+    // Fills a 1 GiB linear arena, then reads it at random
+    const auto benchmark = [](const char* name, Area::IArea& area) {
+        Allocator::Linear allocator(&area);
+
+        const auto start = std::chrono::high_resolution_clock::now();
+
+        // One block less per page, the pages of the growing heap are not aligned
+        for (size_t i = 0; i < (pageSize / 4096 - 1) * pagesCount; ++i) {
+            char* const block = static_cast<char*>(allocator.allocate(blockSize, alignof(size_t), 0));
+            ASSERT_NE(block, nullptr);
+
+            std::memset(block, static_cast<int>(i), blockSize);
+        }
+
+        const auto filled = std::chrono::high_resolution_clock::now();
+
+        // The pages of the growing heap are not contiguous, read in the first half of random pages
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<size_t> pageDistribution(0, pagesCount - 1);
+        std::uniform_int_distribution<size_t> offsetDistribution(0, pageSize / 2 - 1);
+
+        std::vector<char*> pages;
+        for (Area::Page* page = allocator.getMark().currentPage; page; page = page->prev) {
+            pages.push_back(static_cast<char*>(page->start));
+        }
+
+        size_t sum = 0;
+        for (size_t i = 0; i < accessesCount; ++i) {
+            sum += pages[pageDistribution(generator) % pages.size()][offsetDistribution(generator)];
+        }
+
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        const double fillSeconds = std::chrono::duration<double>(filled - start).count();
+        const double readSeconds = std::chrono::duration<double>(end - filled).count();
+
+        std::cout << name << ": fill " << pageSize * pagesCount / fillSeconds / (1024.0 * 1024.0 * 1024.0) << " GiB/s, random read "
+                  << readSeconds * 1e9 / accessesCount << " ns/access" << std::endl;
+
+        // Read by nobody, the compiler still has to compute it
+        volatile size_t sink = sum;
+        (void)(sink);
+    };
+
+    {
+        Area::GrowingHeap<pageSize, pagesCount> area;
+        benchmark("GrowingHeap", area);
+    }
+
+    {
+        Area::VirtualMemory<pageSize, pagesCount> area(Area::HugePages::None);
+        benchmark("VirtualMemory", area);
+    }
+
+    {
+        Area::VirtualMemory<pageSize, pagesCount> area(Area::HugePages::Transparent);
+        benchmark("VirtualMemory, transparent huge pages", area);
+    }
+
+    {
+        Area::VirtualMemory<pageSize, pagesCount> area(Area::HugePages::Explicit);
+        benchmark("VirtualMemory, explicit huge pages", area);
+    }
+}
+
+#endif